@@ -127,6 +127,7 @@ typedef u64 esif_context_t;	/* opaque ESIF 64-bit context (may be a pointer) */
 #define ESIF_CALLCONV		__cdecl					/* SDK Calling Convention */
 #define ESIF_PATH_SEP		"\\"					/* Path Separator String */
 #define ESIF_EXPORT			__declspec(dllexport)	/* Used for Exported Symbols */
+#define ESIF_THREAD_LOCAL	__declspec(thread)		/* Thread-Local Storage Class */
 #define ESIF_INVALID_HANDLE	((esif_handle_t)(-1))	/* Invalid ESIF Handle */
 
 #define ESIF_HANDLE_DEFAULT ((esif_handle_t)(0))        /* Reserved ESIF handle */
@@ -216,6 +217,7 @@ typedef unsigned long long u64;
 #define ESIF_CALLCONV					/* Func Calling Convention */
 #define ESIF_PATH_SEP		"/"			/* Path Separator String */
 #define ESIF_EXPORT			__attribute__((visibility("default")))	/* Used for Exported Symbols */
+#define ESIF_THREAD_LOCAL	__thread	/* Thread-Local Storage Class */
 #define ESIF_INVALID_HANDLE	((esif_handle_t)(-1))	/* Invalid ESIF Handle */
 
 #define ESIF_HANDLE_DEFAULT ((esif_handle_t)(0))        /* Reserved ESIF handle */
@@ -31,6 +31,7 @@ typedef volatile atomic32_basetype atomic32_t;
 #define atomic32_dec(v)		atomic_dec(v)
 #define atomic32_add(i, v)	atomic_add(i, v)
 #define atomic32_sub(i, v)	atomic_sub(i, v)
+#define atomic32_cmpxchg(v, o, n)	atomic_cmpxchg(v, o, n)
 #define ATOMIC32_FMT		"%d"
 #define ATOMIC32_FMTX		"0x%x"
 #define ATOMIC32_FMT0X		"0x%08x"
@@ -44,6 +45,7 @@ typedef volatile atomic64_basetype atomic64_t;
 #define atomic64_dec(v)		atomic_dec(v)
 #define atomic64_add(i, v)	atomic_add(i, v)
 #define atomic64_sub(i, v)	atomic_sub(i, v)
+#define atomic64_cmpxchg(v, o, n)	atomic_cmpxchg(v, o, n)
 #define ATOMIC64_FMT		"%lld"
 #define ATOMIC64_FMTX		"0x%llx"
 #define ATOMIC64_FMT0X		"0x%016llx"
@@ -67,6 +69,7 @@ typedef volatile atomic_basetype atomic_t;
 #define atomic_dec(v)		__atomic_sub_fetch(v, 1, __ATOMIC_SEQ_CST)
 #define atomic_add(i, v)	__atomic_fetch_add(v, i, __ATOMIC_SEQ_CST)
 #define atomic_sub(i, v)	__atomic_fetch_sub(v, i, __ATOMIC_SEQ_CST)
+#define atomic_cmpxchg(v, o, n)	__sync_val_compare_and_swap(v, o, n)	/* Returns prior value */
 #endif /* !DISABLE */
 
 #endif /* LINUX USER */
@@ -21,7 +21,9 @@
 #if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
 
 #include <errno.h>
+#include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include "esif_ccb_string.h"
 
@@ -85,6 +87,30 @@ static ESIF_INLINE int esif_ccb_file_exists(esif_string filename)
 	return (0 == esif_ccb_stat(filename, &st));
 }
 
+// Map an entire regular file into memory for Read-Only access. Returns NULL for empty files, symlinks, or on failure
+static ESIF_INLINE void *esif_ccb_mmap_readonly(const char *filename, size_t *size_ptr)
+{
+	void *addr = NULL;
+	struct stat st = { 0 };
+	int fd = open(filename, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+
+	if (fd >= 0) {
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (addr == MAP_FAILED) {
+				addr = NULL;
+			}
+			else if (size_ptr) {
+				*size_ptr = (size_t)st.st_size;
+			}
+		}
+		close(fd);
+	}
+	return addr;
+}
+
+#define esif_ccb_munmap(addr, size)					munmap(addr, size)
+
 // mode parameters for esif_ccb_fopen() that can be combined
 #define FILEMODE_READ		"r"		// Open for Read-only; File must exist
 #define FILEMODE_WRITE		"w"		// Open for Write, Overwrite existing file; Create if does not exist
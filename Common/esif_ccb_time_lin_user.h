@@ -43,6 +43,16 @@ static void ESIF_INLINE esif_ccb_system_time(esif_ccb_time_t *time)
 	*time += (now.tv_usec / 1000);	/* Convert usec to msec */
 }
 
+/* Return Monotonic Time In Milliseconds (CLOCK_BOOTTIME, the clock the timer manager uses) */
+static void ESIF_INLINE esif_ccb_monotonic_time(esif_ccb_time_t *time)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_BOOTTIME, &now);
+	*time  = ((esif_ccb_time_t)now.tv_sec * 1000);	/* Convert sec to msec */
+	*time += (now.tv_nsec / 1000000);		/* Convert nsec to msec */
+}
+
 
 static void ESIF_INLINE esif_ccb_get_time(struct timeval *tv)
 {
@@ -96,6 +106,12 @@ static ESIF_INLINE Int64 esif_ccb_realtime_diff_sec(esif_ccb_realtime_t t1, esif
 	return (Int64)(dur64 / res64 / 1000000000);
 }
 
+static ESIF_INLINE u64 esif_ccb_realtime_diff_usec(esif_ccb_realtime_t t1, esif_ccb_realtime_t t2)
+{
+	/* clockticks are CLOCK_BOOTTIME nanoseconds */
+	return (t2.clockticks - t1.clockticks) / 1000;
+}
+
 static ESIF_INLINE time_t esif_ccb_realtime_clocktime(esif_ccb_realtime_t time)
 {
 	return (time_t)(time.clocktime);
@@ -70,15 +70,29 @@
 */
 #define ESIF_TIMER_DISABLE_DELAY 50
 
+/* Number of buckets in each timer look-up table; must be a power of 2 */
+#define ESIF_TMRM_HASH_SIZE 64
+#define ESIF_TMRM_HASH(handle) ((u32)(size_t)(handle) & (ESIF_TMRM_HASH_SIZE - 1))
+
 /*
  * STRUCTURE DECLARATIONS
  */
 
+struct esif_tmrm_item;
+
 struct esif_timer_manager {
 	u8 enabled;	/* Indicates the manager lock is initialized */
 	u8 marked_for_delete; /* Indicates no additional timers may be created */
 	esif_ccb_lock_t mgr_lock;
-	struct esif_link_list *timer_list_ptr; /* List of initialized timers */
+
+	/* Initialized timers hashed by handle, and set timers hashed by CB handle */
+	struct esif_tmrm_item *handle_table[ESIF_TMRM_HASH_SIZE];
+	struct esif_tmrm_item *cb_handle_table[ESIF_TMRM_HASH_SIZE];
+	u32 timer_count;
+
+	/* Scheduler options; 0 selects the default */
+	u32 cb_threads;
+	u32 slack_msec;
 };
 
 struct esif_tmrm_item {
@@ -98,6 +112,9 @@ struct esif_tmrm_item {
 
 	/* List threads waiting for the timer callback to complete */
 	struct esif_link_list *destroy_list_ptr;
+
+	struct esif_tmrm_item *handle_next_ptr;		/* Next item in handle bucket */
+	struct esif_tmrm_item *cb_handle_next_ptr;	/* Next item in CB handle bucket */
 };
 
 
@@ -109,6 +126,18 @@ struct esif_timer_manager g_tmrm = {0};
 u32 g_next_timer_handle = 0;
 u32 g_next_timer_cb_handle = 0;
 
+/*
+ * Bring in the OS-specific scheduler
+ */
+#if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
+#include "esif_ccb_timer_lin_user.c"
+#define esif_ccb_tmrm_os_init() esif_ccb_tmrw_init(g_tmrm.cb_threads, g_tmrm.slack_msec)
+#define esif_ccb_tmrm_os_exit() esif_ccb_tmrw_exit()
+#else
+#define esif_ccb_tmrm_os_init() (ESIF_OK)
+#define esif_ccb_tmrm_os_exit()
+#endif
+
 
 static enum esif_rc esif_ccb_timer_kill_w_event(
 	esif_ccb_timer_t *timer_ptr,
@@ -139,11 +168,16 @@ static void esif_ccb_tmrm_signal_waiters(
 	void *data_ptr
 	);
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_wlock(
+static struct esif_tmrm_item *esif_ccb_tmrm_find_timer_wlock(
 	esif_ccb_timer_handle_t handle
 	);
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_by_cb_wlock(
+static struct esif_tmrm_item *esif_ccb_tmrm_find_timer_by_cb_wlock(
+	esif_ccb_timer_handle_t cb_handle
+	);
+
+static void esif_ccb_tmrm_set_cb_handle_wlock(
+	struct esif_tmrm_item *self,
 	esif_ccb_timer_handle_t cb_handle
 	);
 
@@ -155,8 +189,8 @@ static void esif_ccb_tmrm_get_next_cb_handle_wlock(
 	esif_ccb_timer_handle_t *handle_ptr
 	);
 	
-static void esif_ccb_tmrm_destroy_timer_node_wlock(
-	struct esif_link_list_node *node_ptr
+static void esif_ccb_tmrm_destroy_timer_wlock(
+	struct esif_tmrm_item *tmrm_item_ptr
 	);
 
 
@@ -203,6 +237,7 @@ enum esif_rc esif_ccb_timer_init(
 {
 	enum esif_rc rc = ESIF_OK;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
+	u32 bucket = 0;
 
 	if ((NULL == timer_ptr) || (NULL == function_ptr)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -222,21 +257,11 @@ enum esif_rc esif_ccb_timer_init(
 	/* Place the handle into the timer being initialized*/
 	timer_ptr->timer_handle = tmrm_item_ptr->timer_handle;
 
-	/*
-	 * We create the manager list dynamically so that we don't have to call
-	 * init/exit functions and can destroy the linked list
-	 */
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
-	if (NULL == g_tmrm.timer_list_ptr) {
-
-		g_tmrm.timer_list_ptr = esif_link_list_create();
-		if(NULL == g_tmrm.timer_list_ptr) {
-			rc = ESIF_E_NO_MEMORY;
-			goto lock_exit;
-		}
-	}
-	rc = esif_link_list_add_at_back(g_tmrm.timer_list_ptr, tmrm_item_ptr);
-lock_exit:
+	bucket = ESIF_TMRM_HASH(tmrm_item_ptr->timer_handle);
+	tmrm_item_ptr->handle_next_ptr = g_tmrm.handle_table[bucket];
+	g_tmrm.handle_table[bucket] = tmrm_item_ptr;
+	g_tmrm.timer_count++;
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 exit:
 	if (rc != ESIF_OK)
@@ -277,7 +302,6 @@ static enum esif_rc esif_ccb_timer_kill_w_event(
 {
 	enum esif_rc rc = ESIF_E_UNSPECIFIED;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
-	struct esif_link_list_node *node_ptr = NULL;
 
 	if (NULL == timer_ptr) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -289,14 +313,12 @@ static enum esif_rc esif_ccb_timer_kill_w_event(
 
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
 
-	node_ptr = esif_ccb_tmrm_find_timer_node_wlock(timer_ptr->timer_handle);
-	if ((NULL == node_ptr) || (NULL == node_ptr->data_ptr)) {
+	tmrm_item_ptr = esif_ccb_tmrm_find_timer_wlock(timer_ptr->timer_handle);
+	if (NULL == tmrm_item_ptr) {
 		rc = ESIF_E_INVALID_HANDLE;
 		goto lock_exit;
 	}
 
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-
 	/* Mark for delete in case it is in the callback */
 	tmrm_item_ptr->marked_for_delete = ESIF_TRUE;
 
@@ -304,7 +326,7 @@ static enum esif_rc esif_ccb_timer_kill_w_event(
 
 	/* If not in callback, the timer can be destroyed now */
 	if (!tmrm_item_ptr->is_in_cb) {
-		esif_ccb_tmrm_destroy_timer_node_wlock(node_ptr);
+		esif_ccb_tmrm_destroy_timer_wlock(tmrm_item_ptr);
 	}
 	rc = ESIF_OK;
 lock_exit:
@@ -331,7 +353,6 @@ enum esif_rc esif_ccb_timer_set_msec(
 	)
 {
 	enum esif_rc rc = ESIF_E_UNSPECIFIED;
-	struct esif_link_list_node *node_ptr = NULL;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 	struct esif_timer_obj *timer_obj_ptr = NULL;
 	esif_ccb_timer_handle_t timer_cb_handle = {0};
@@ -352,21 +373,19 @@ enum esif_rc esif_ccb_timer_set_msec(
 
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
 
-	node_ptr = esif_ccb_tmrm_find_timer_node_wlock(timer_ptr->timer_handle);
-	if ((NULL == node_ptr) || (NULL == node_ptr->data_ptr)) {	
+	tmrm_item_ptr = esif_ccb_tmrm_find_timer_wlock(timer_ptr->timer_handle);
+	if (NULL == tmrm_item_ptr) {
 		rc = ESIF_E_INVALID_HANDLE;
 		goto lock_exit;
 	}
 
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-
 	if (tmrm_item_ptr->marked_for_delete) {
 		rc = ESIF_E_INVALID_HANDLE;
 		goto lock_exit;
 	}
 
 	esif_ccb_tmrm_get_next_cb_handle_wlock(&timer_cb_handle);
-	tmrm_item_ptr->timer_cb_handle = timer_cb_handle;
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, timer_cb_handle);
 
 	timer_obj_ptr = tmrm_item_ptr->timer_obj_ptr;
 	esif_ccb_timer_obj_save_pending_timeout(timer_obj_ptr,
@@ -391,9 +410,33 @@ exit:
  */
 enum esif_rc esif_ccb_tmrm_init(void)
 {
+	enum esif_rc rc = ESIF_OK;
+
 	esif_ccb_lock_init(&g_tmrm.mgr_lock);
+
+	rc = esif_ccb_tmrm_os_init();
+	if (rc != ESIF_OK) {
+		esif_ccb_lock_uninit(&g_tmrm.mgr_lock);
+		goto exit;
+	}
 	g_tmrm.enabled = ESIF_TRUE;
-	return ESIF_OK;
+exit:
+	return rc;
+}
+
+
+/*
+ * Sets the number of threads used to call timer callbacks and the interval
+ * within which timer expirations are coalesced.  Must be called before the
+ * timer manager is initialized; 0 selects the default.
+ */
+void esif_ccb_tmrm_set_options(
+	u32 cb_threads,
+	u32 slack_msec
+	)
+{
+	g_tmrm.cb_threads = cb_threads;
+	g_tmrm.slack_msec = slack_msec;
 }
 
 
@@ -435,6 +478,9 @@ void esif_ccb_tmrm_exit(void)
 		esif_ccb_timer_kill_w_wait(&cur_timer);
 	}
 
+	/* Stop the scheduler; no callbacks are in progress once it returns */
+	esif_ccb_tmrm_os_exit();
+
 #ifdef ESIF_ATTR_USER
 	/* Wait for any possible callbacks to be processed before exiting */
 	esif_ccb_sleep_msec(ESIF_TIMER_DISABLE_DELAY);
@@ -453,25 +499,18 @@ static enum esif_rc esif_ccb_tmrm_get_first_timer(
 	)
 {
 	enum esif_rc rc = ESIF_E_UNSPECIFIED;
-	struct esif_link_list_node *node_ptr = NULL;
-	struct esif_tmrm_item *tmrm_item_ptr = NULL;
+	u32 bucket = 0;
 
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
 
-	if (NULL == g_tmrm.timer_list_ptr)
-		goto exit;
-
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	if (NULL == node_ptr)
-		goto exit;
-
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-	if (NULL == tmrm_item_ptr) /* Should never happen */
-		goto exit;
+	for (bucket = 0; bucket < ESIF_TMRM_HASH_SIZE; bucket++) {
+		if (g_tmrm.handle_table[bucket] != NULL) {
+			timer_ptr->timer_handle = g_tmrm.handle_table[bucket]->timer_handle;
+			rc = ESIF_OK;
+			break;
+		}
+	}
 
-	timer_ptr->timer_handle = tmrm_item_ptr->timer_handle;
-	rc = ESIF_OK;
-exit:
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 	return rc;
 }
@@ -481,22 +520,18 @@ void esif_ccb_tmrm_callback(
 	esif_ccb_timer_handle_t cb_handle
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 	struct esif_timer_obj *timer_obj_ptr = NULL;
 
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
 
-	node_ptr = esif_ccb_tmrm_find_timer_node_by_cb_wlock(cb_handle);
-
-	if ((NULL == node_ptr) || (NULL == node_ptr->data_ptr)) {
-		goto lock_exit;	
+	tmrm_item_ptr = esif_ccb_tmrm_find_timer_by_cb_wlock(cb_handle);
+	if (NULL == tmrm_item_ptr) {
+		goto lock_exit;
 	}
 
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-
 	/* Clear the CB handle to lower probability of hitting same handle */
-	tmrm_item_ptr->timer_cb_handle = 0;
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, 0);
 	tmrm_item_ptr->is_in_cb = ESIF_TRUE;
 
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
@@ -507,7 +542,7 @@ void esif_ccb_tmrm_callback(
 
 	/*
 	 * Upon return, perform post processing
-	 * Note:  The item and node pointers will still be valid as the node
+	 * Note:  The item pointer will still be valid as the item
 	 * will not be removed while in the callback function
 	 */
 	esif_ccb_write_lock(&g_tmrm.mgr_lock);
@@ -515,7 +550,7 @@ void esif_ccb_tmrm_callback(
 	tmrm_item_ptr->is_in_cb = ESIF_FALSE;
 
 	if (tmrm_item_ptr->marked_for_delete) {
-		esif_ccb_tmrm_destroy_timer_node_wlock(node_ptr);
+		esif_ccb_tmrm_destroy_timer_wlock(tmrm_item_ptr);
 		goto lock_exit;
 	}
 
@@ -577,7 +612,7 @@ static enum esif_rc esif_ccb_tmrm_get_next_handle(
 	)
 {
 	enum esif_rc rc = ESIF_OK;
-	struct esif_link_list_node *node_ptr = NULL;
+	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 	esif_ccb_timer_t timer = {0};
 	u32 try_count = 0;
 	/*
@@ -591,12 +626,12 @@ static enum esif_rc esif_ccb_tmrm_get_next_handle(
 	do {
 		try_count++;
 		timer.timer_handle = (esif_ccb_timer_handle_t)(size_t)++g_next_timer_handle;
-		node_ptr = esif_ccb_tmrm_find_timer_node_wlock(timer.timer_handle);
-	} while ((node_ptr != NULL) && (try_count < ESIF_CNT_HNDL_RETRIES_MAX));
+		tmrm_item_ptr = esif_ccb_tmrm_find_timer_wlock(timer.timer_handle);
+	} while ((tmrm_item_ptr != NULL) && (try_count < ESIF_CNT_HNDL_RETRIES_MAX));
 
 	esif_ccb_write_unlock(&g_tmrm.mgr_lock);
 
-	if(node_ptr != NULL) {
+	if(tmrm_item_ptr != NULL) {
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
 	}
@@ -619,76 +654,89 @@ static void esif_ccb_tmrm_get_next_cb_handle_wlock(
 }
 
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_wlock(
+static struct esif_tmrm_item *esif_ccb_tmrm_find_timer_wlock(
 	esif_ccb_timer_handle_t handle
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
+	struct esif_tmrm_item *tmrm_item_ptr = g_tmrm.handle_table[ESIF_TMRM_HASH(handle)];
+
+	while ((tmrm_item_ptr != NULL) && (tmrm_item_ptr->timer_handle != handle)) {
+		tmrm_item_ptr = tmrm_item_ptr->handle_next_ptr;
+	}
+	return tmrm_item_ptr;
+}
+
+
+static struct esif_tmrm_item *esif_ccb_tmrm_find_timer_by_cb_wlock(
+	esif_ccb_timer_handle_t cb_handle
+	)
+{
 	struct esif_tmrm_item *tmrm_item_ptr = NULL;
 
-	if (NULL == g_tmrm.timer_list_ptr)
+	if (0 == cb_handle)
 		goto exit;
 
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	while (node_ptr != NULL) {
-		tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-		if (NULL == tmrm_item_ptr) /* Should never happen */
-			continue;
-
-		if (handle == tmrm_item_ptr->timer_handle)
-			break;	
-		node_ptr = node_ptr->next_ptr;
+	tmrm_item_ptr = g_tmrm.cb_handle_table[ESIF_TMRM_HASH(cb_handle)];
+	while ((tmrm_item_ptr != NULL) && (tmrm_item_ptr->timer_cb_handle != cb_handle)) {
+		tmrm_item_ptr = tmrm_item_ptr->cb_handle_next_ptr;
 	}
 exit:
-	return node_ptr;
+	return tmrm_item_ptr;
 }
 
 
-static struct esif_link_list_node *esif_ccb_tmrm_find_timer_node_by_cb_wlock(
+/* Moves the item to the bucket for a new CB handle; 0 removes it from the table */
+static void esif_ccb_tmrm_set_cb_handle_wlock(
+	struct esif_tmrm_item *self,
 	esif_ccb_timer_handle_t cb_handle
 	)
 {
-	struct esif_link_list_node *node_ptr = NULL;
-	struct esif_tmrm_item *tmrm_item_ptr = NULL;
+	struct esif_tmrm_item **link_ptr = NULL;
+	u32 bucket = 0;
 
-	if (NULL == g_tmrm.timer_list_ptr)
-		goto exit;
+	ESIF_ASSERT(self != NULL);
 
-	node_ptr = g_tmrm.timer_list_ptr->head_ptr;
-	while (node_ptr != NULL) {
-		tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-		if (NULL == tmrm_item_ptr) /* Should never happen */
-			continue;
+	if (self->timer_cb_handle != 0) {
+		link_ptr = &g_tmrm.cb_handle_table[ESIF_TMRM_HASH(self->timer_cb_handle)];
+		while ((*link_ptr != NULL) && (*link_ptr != self)) {
+			link_ptr = &(*link_ptr)->cb_handle_next_ptr;
+		}
+		if (*link_ptr != NULL) {
+			*link_ptr = self->cb_handle_next_ptr;
+		}
+		self->cb_handle_next_ptr = NULL;
+	}
 
-		if (cb_handle == tmrm_item_ptr->timer_cb_handle)
-			break;	
-		node_ptr = node_ptr->next_ptr;
+	self->timer_cb_handle = cb_handle;
+
+	if (cb_handle != 0) {
+		bucket = ESIF_TMRM_HASH(cb_handle);
+		self->cb_handle_next_ptr = g_tmrm.cb_handle_table[bucket];
+		g_tmrm.cb_handle_table[bucket] = self;
 	}
-exit:
-	return node_ptr;
 }
 
 
-static void esif_ccb_tmrm_destroy_timer_node_wlock(
-	struct esif_link_list_node *node_ptr
+static void esif_ccb_tmrm_destroy_timer_wlock(
+	struct esif_tmrm_item *tmrm_item_ptr
 	)
 {
-	struct esif_tmrm_item *tmrm_item_ptr = NULL;
+	struct esif_tmrm_item **link_ptr = NULL;
 
-	ESIF_ASSERT(node_ptr != NULL);
-	ESIF_ASSERT(node_ptr->data_ptr != NULL);
+	ESIF_ASSERT(tmrm_item_ptr != NULL);
 
-	tmrm_item_ptr = (struct esif_tmrm_item *)node_ptr->data_ptr;
-	esif_ccb_tmrm_destroy_tmrm_item(tmrm_item_ptr);
+	esif_ccb_tmrm_set_cb_handle_wlock(tmrm_item_ptr, 0);
 
-	esif_link_list_node_remove(g_tmrm.timer_list_ptr, node_ptr);
-			
-	/* If the manager list is empty, destroy it */
-	if(NULL == g_tmrm.timer_list_ptr->head_ptr) {
-		esif_link_list_destroy(g_tmrm.timer_list_ptr);
-		g_tmrm.timer_list_ptr = NULL;
+	link_ptr = &g_tmrm.handle_table[ESIF_TMRM_HASH(tmrm_item_ptr->timer_handle)];
+	while ((*link_ptr != NULL) && (*link_ptr != tmrm_item_ptr)) {
+		link_ptr = &(*link_ptr)->handle_next_ptr;
 	}
-	return;
+	if (*link_ptr != NULL) {
+		*link_ptr = tmrm_item_ptr->handle_next_ptr;
+		g_tmrm.timer_count--;
+	}
+
+	esif_ccb_tmrm_destroy_tmrm_item(tmrm_item_ptr);
 }
 
 
@@ -92,6 +92,12 @@
  *        This functions is expected to be called when the system is in a
  *        "known" state where not attempts to create any timers are in flight
  *        as this function destroys the lock controlling synchronization
+ *        and stops any threads used to service timers.  A binary which
+ *        includes this code must call it before it is unloaded.
+ *
+ *    esif_ccb_tmrm_set_options - May optionally be called before the timer
+ *        manager is initialized to set the number of callback threads and the
+ *        slack within which timer expirations are coalesced
  *
  * IMPORTANT!!!!
  *
@@ -135,6 +141,13 @@ extern "C" {
  */
 enum esif_rc esif_ccb_tmrm_init(void);
 
+/*
+ * Sets the number of threads used to call timer callbacks and the interval
+ * in msec within which timer expirations are coalesced.  Optional; must be
+ * called before the timer manager is initialized.  0 selects the default.
+ */
+void esif_ccb_tmrm_set_options(u32 cb_threads, u32 slack_msec);
+
 /*
  * Releases resources used by the the timer manager.  Should be called after all
  * timers have been destroyed as this code will wait for timer destruction if
@@ -0,0 +1,600 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+/*
+ * Linux user mode timer scheduler.  This file is compiled as part of
+ * esif_ccb_timer.c and is not built separately.
+ *
+ * All timers are kept in a hierarchical timer wheel of ESIF_TMRW_LEVELS levels
+ * of ESIF_TMRW_SLOTS slots each.  One wheel tick is the configured slack, so
+ * timers which expire within the same slack interval fire together.  A timer
+ * is placed in the level which covers its distance from the current tick and
+ * moves down a level ("cascades") each time the wheel passes the start of its
+ * slot, so arming and cancelling a timer are O(1) and do not allocate.
+ *
+ * A single thread waits on a timerfd (CLOCK_BOOTTIME, so time spent suspended
+ * counts) programmed for the next tick with work, advances the wheel and moves
+ * expired timers to a ready list.  A pool of callback threads takes timers
+ * from the ready list and calls esif_ccb_tmrm_callback with the CB handle the
+ * timer was armed with, so a re-armed or killed timer is never called back for
+ * a stale expiration.
+ *
+ * The wheel lock is always acquired after the timer manager lock, never before.
+ */
+
+#if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
+
+#include "esif_ccb_thread.h"
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <errno.h>
+
+#define ESIF_TMRW_SLOT_MASK	((u64)ESIF_TMRW_SLOTS - 1)
+#define ESIF_TMRW_LEVEL_SHIFT(level)	((level) * ESIF_TMRW_SLOT_BITS)
+#define ESIF_TMRW_MAX_DELTA	(((u64)1 << ESIF_TMRW_LEVEL_SHIFT(ESIF_TMRW_LEVELS)) - 1)
+
+struct esif_tmrw_slot {
+	struct esif_timer_obj *head_ptr;
+};
+
+struct esif_timer_wheel {
+	u8 enabled;
+	u8 exit_flag;
+	esif_ccb_mutex_t wheel_lock;
+
+	struct esif_tmrw_slot slots[ESIF_TMRW_LEVELS][ESIF_TMRW_SLOTS];
+	u64 occupied[ESIF_TMRW_LEVELS];	/* Bit per non-empty slot */
+	u64 cur_tick;			/* Last tick processed */
+	u64 programmed_tick;		/* Tick the timerfd is set for; 0 if not set */
+	u32 armed_count;		/* Timers in the wheel */
+	u32 slack_msec;			/* Length of a tick */
+
+	/* Expired timers waiting for a callback thread */
+	struct esif_timer_obj *ready_head_ptr;
+	struct esif_timer_obj *ready_tail_ptr;
+	esif_ccb_sem_t ready_sem;
+
+	int timer_fd;
+	int exit_fd;
+	int epoll_fd;
+	esif_thread_t wheel_thread;
+	u8 wheel_thread_started;
+
+	esif_thread_t *cb_threads_ptr;
+	u32 cb_thread_count;
+};
+
+static struct esif_timer_wheel g_tmrw = {0};
+
+
+static u64 esif_ccb_tmrw_now_msec(void)
+{
+	struct timespec now = {0};
+
+	clock_gettime(CLOCK_BOOTTIME, &now);
+	return ((u64)now.tv_sec * 1000) + ((u64)now.tv_nsec / 1000000);
+}
+
+
+/* Sets the timerfd to expire at the start of the given tick; 0 disarms it */
+static void esif_ccb_tmrw_program_locked(
+	u64 tick
+	)
+{
+	struct itimerspec its = {{0}};
+	u64 msec = tick * g_tmrw.slack_msec;
+
+	if (tick != 0) {
+		its.it_value.tv_sec = (time_t)(msec / 1000);
+		its.it_value.tv_nsec = (long)((msec % 1000) * 1000000);
+	}
+	timerfd_settime(g_tmrw.timer_fd, TFD_TIMER_ABSTIME, &its, NULL);
+	g_tmrw.programmed_tick = tick;
+}
+
+
+static void esif_ccb_tmrw_insert_locked(
+	struct esif_timer_obj *self
+	)
+{
+	u64 delta = 0;
+	u64 place_tick = self->expire_tick;
+	u8 level = 0;
+	struct esif_tmrw_slot *slot_ptr = NULL;
+
+	/*
+	 * Timeouts beyond the range of the wheel are placed at the end of the top
+	 * level and placed again, using the actual expiration, when they cascade.
+	 */
+	delta = self->expire_tick - g_tmrw.cur_tick;
+	if (delta > ESIF_TMRW_MAX_DELTA) {
+		delta = ESIF_TMRW_MAX_DELTA;
+		place_tick = g_tmrw.cur_tick + delta;
+	}
+
+	while ((level < ESIF_TMRW_LEVELS - 1) && (delta >= ((u64)1 << ESIF_TMRW_LEVEL_SHIFT(level + 1)))) {
+		level++;
+	}
+
+	self->wheel_level = level;
+	self->wheel_slot = (u8)((place_tick >> ESIF_TMRW_LEVEL_SHIFT(level)) & ESIF_TMRW_SLOT_MASK);
+	self->wheel_state = ESIF_TMRW_ARMED;
+
+	slot_ptr = &g_tmrw.slots[level][self->wheel_slot];
+	self->wheel_prev_ptr = NULL;
+	self->wheel_next_ptr = slot_ptr->head_ptr;
+	if (slot_ptr->head_ptr != NULL) {
+		slot_ptr->head_ptr->wheel_prev_ptr = self;
+	}
+	slot_ptr->head_ptr = self;
+	g_tmrw.occupied[level] |= ((u64)1 << self->wheel_slot);
+}
+
+
+/* Removes a timer from its slot or the ready list */
+static void esif_ccb_tmrw_unlink_locked(
+	struct esif_timer_obj *self
+	)
+{
+	struct esif_tmrw_slot *slot_ptr = NULL;
+
+	if (ESIF_TMRW_ARMED == self->wheel_state) {
+		slot_ptr = &g_tmrw.slots[self->wheel_level][self->wheel_slot];
+		if (self->wheel_prev_ptr != NULL) {
+			self->wheel_prev_ptr->wheel_next_ptr = self->wheel_next_ptr;
+		} else {
+			slot_ptr->head_ptr = self->wheel_next_ptr;
+		}
+		if (self->wheel_next_ptr != NULL) {
+			self->wheel_next_ptr->wheel_prev_ptr = self->wheel_prev_ptr;
+		}
+		if (NULL == slot_ptr->head_ptr) {
+			g_tmrw.occupied[self->wheel_level] &= ~((u64)1 << self->wheel_slot);
+		}
+		g_tmrw.armed_count--;
+	} else if (ESIF_TMRW_READY == self->wheel_state) {
+		if (self->wheel_prev_ptr != NULL) {
+			self->wheel_prev_ptr->wheel_next_ptr = self->wheel_next_ptr;
+		} else {
+			g_tmrw.ready_head_ptr = self->wheel_next_ptr;
+		}
+		if (self->wheel_next_ptr != NULL) {
+			self->wheel_next_ptr->wheel_prev_ptr = self->wheel_prev_ptr;
+		} else {
+			g_tmrw.ready_tail_ptr = self->wheel_prev_ptr;
+		}
+	}
+	self->wheel_next_ptr = NULL;
+	self->wheel_prev_ptr = NULL;
+	self->wheel_state = ESIF_TMRW_IDLE;
+}
+
+
+/* Detaches and returns the list of timers in a slot */
+static struct esif_timer_obj *esif_ccb_tmrw_take_slot_locked(
+	u8 level,
+	u8 slot
+	)
+{
+	struct esif_timer_obj *list_ptr = g_tmrw.slots[level][slot].head_ptr;
+
+	g_tmrw.slots[level][slot].head_ptr = NULL;
+	g_tmrw.occupied[level] &= ~((u64)1 << slot);
+	return list_ptr;
+}
+
+
+/* Moves the timers in the current level 0 slot to the ready list */
+static u32 esif_ccb_tmrw_expire_locked(void)
+{
+	u32 count = 0;
+	struct esif_timer_obj *cur_ptr = NULL;
+	struct esif_timer_obj *next_ptr = NULL;
+
+	cur_ptr = esif_ccb_tmrw_take_slot_locked(0, (u8)(g_tmrw.cur_tick & ESIF_TMRW_SLOT_MASK));
+	while (cur_ptr != NULL) {
+		next_ptr = cur_ptr->wheel_next_ptr;
+		g_tmrw.armed_count--;
+
+		cur_ptr->wheel_state = ESIF_TMRW_READY;
+		cur_ptr->wheel_next_ptr = NULL;
+		cur_ptr->wheel_prev_ptr = g_tmrw.ready_tail_ptr;
+		if (g_tmrw.ready_tail_ptr != NULL) {
+			g_tmrw.ready_tail_ptr->wheel_next_ptr = cur_ptr;
+		} else {
+			g_tmrw.ready_head_ptr = cur_ptr;
+		}
+		g_tmrw.ready_tail_ptr = cur_ptr;
+		count++;
+
+		cur_ptr = next_ptr;
+	}
+	return count;
+}
+
+
+/* Moves timers down from each level whose slot boundary is the current tick */
+static void esif_ccb_tmrw_cascade_locked(void)
+{
+	int level = 0;
+	u64 mask = 0;
+	struct esif_timer_obj *cur_ptr = NULL;
+	struct esif_timer_obj *next_ptr = NULL;
+
+	for (level = ESIF_TMRW_LEVELS - 1; level > 0; level--) {
+		mask = ((u64)1 << ESIF_TMRW_LEVEL_SHIFT(level)) - 1;
+		if ((g_tmrw.cur_tick & mask) != 0) {
+			continue;
+		}
+		cur_ptr = esif_ccb_tmrw_take_slot_locked((u8)level,
+			(u8)((g_tmrw.cur_tick >> ESIF_TMRW_LEVEL_SHIFT(level)) & ESIF_TMRW_SLOT_MASK));
+
+		while (cur_ptr != NULL) {
+			next_ptr = cur_ptr->wheel_next_ptr;
+			esif_ccb_tmrw_insert_locked(cur_ptr);
+			cur_ptr = next_ptr;
+		}
+	}
+}
+
+
+/* Returns the first tick after the current tick that starts a slot of the given level */
+static u64 esif_ccb_tmrw_next_boundary(
+	int level
+	)
+{
+	return ((g_tmrw.cur_tick >> ESIF_TMRW_LEVEL_SHIFT(level)) + 1) << ESIF_TMRW_LEVEL_SHIFT(level);
+}
+
+
+/*
+ * Advances the wheel to the target tick, skipping over ticks with no work.
+ * Returns the number of timers moved to the ready list.
+ */
+static u32 esif_ccb_tmrw_advance_locked(
+	u64 target_tick
+	)
+{
+	u32 count = 0;
+	u64 next_tick = 0;
+	int level = 0;
+
+	while (g_tmrw.cur_tick < target_tick) {
+		if (0 == g_tmrw.armed_count) {
+			g_tmrw.cur_tick = target_tick;
+			break;
+		}
+
+		if (g_tmrw.occupied[0] != 0) {
+			g_tmrw.cur_tick++;
+		} else {
+			/* Nothing in level 0; jump to the next boundary of the lowest occupied level */
+			next_tick = target_tick;
+			for (level = 1; level < ESIF_TMRW_LEVELS; level++) {
+				if (g_tmrw.occupied[level] != 0) {
+					next_tick = esif_ccb_min(esif_ccb_tmrw_next_boundary(level), target_tick);
+					break;
+				}
+			}
+			g_tmrw.cur_tick = next_tick;
+		}
+
+		esif_ccb_tmrw_cascade_locked();
+		count += esif_ccb_tmrw_expire_locked();
+	}
+	return count;
+}
+
+
+/* Returns the next tick at which the wheel has work; 0 if none */
+static u64 esif_ccb_tmrw_next_tick_locked(void)
+{
+	u64 next_tick = 0;
+	u64 slot = 0;
+	int level = 0;
+
+	if (0 == g_tmrw.armed_count) {
+		goto exit;
+	}
+
+	for (level = 1; level < ESIF_TMRW_LEVELS; level++) {
+		if (g_tmrw.occupied[level] != 0) {
+			next_tick = esif_ccb_tmrw_next_boundary(level);
+			break;
+		}
+	}
+
+	/* Level 0 timers all expire within one revolution of the current tick */
+	if (g_tmrw.occupied[0] != 0) {
+		for (slot = 1; slot <= ESIF_TMRW_SLOTS; slot++) {
+			if (g_tmrw.occupied[0] & ((u64)1 << ((g_tmrw.cur_tick + slot) & ESIF_TMRW_SLOT_MASK))) {
+				break;
+			}
+		}
+		if ((0 == next_tick) || (g_tmrw.cur_tick + slot < next_tick)) {
+			next_tick = g_tmrw.cur_tick + slot;
+		}
+	}
+exit:
+	return next_tick;
+}
+
+
+enum esif_rc esif_ccb_tmrw_arm(
+	struct esif_timer_obj *timer_obj_ptr,
+	const esif_ccb_time_t timeout	/* Timeout in msec */
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	u64 now_msec = 0;
+	u64 now_tick = 0;
+
+	ESIF_ASSERT(timer_obj_ptr != NULL);
+
+	if (!g_tmrw.enabled) {
+		rc = ESIF_E_UNSPECIFIED;
+		goto exit;
+	}
+
+	esif_ccb_mutex_lock(&g_tmrw.wheel_lock);
+
+	esif_ccb_tmrw_unlink_locked(timer_obj_ptr);
+
+	/* An empty wheel may not have advanced in a while; catch it up first */
+	now_msec = esif_ccb_tmrw_now_msec();
+	now_tick = now_msec / g_tmrw.slack_msec;
+	if ((0 == g_tmrw.armed_count) && (now_tick > g_tmrw.cur_tick)) {
+		g_tmrw.cur_tick = now_tick;
+	}
+
+	/* Round up to the next tick so that a timer never fires early */
+	timer_obj_ptr->expire_tick = (now_msec + timeout + g_tmrw.slack_msec - 1) / g_tmrw.slack_msec;
+	if (timer_obj_ptr->expire_tick <= g_tmrw.cur_tick) {
+		timer_obj_ptr->expire_tick = g_tmrw.cur_tick + 1;
+	}
+	timer_obj_ptr->wheel_cb_handle = timer_obj_ptr->timer_cb_handle;
+
+	esif_ccb_tmrw_insert_locked(timer_obj_ptr);
+	g_tmrw.armed_count++;
+
+	if ((0 == g_tmrw.programmed_tick) || (timer_obj_ptr->expire_tick < g_tmrw.programmed_tick)) {
+		esif_ccb_tmrw_program_locked(esif_ccb_tmrw_next_tick_locked());
+	}
+
+	esif_ccb_mutex_unlock(&g_tmrw.wheel_lock);
+exit:
+	return rc;
+}
+
+
+void esif_ccb_tmrw_cancel(
+	struct esif_timer_obj *timer_obj_ptr
+	)
+{
+	ESIF_ASSERT(timer_obj_ptr != NULL);
+
+	if (!g_tmrw.enabled) {
+		return;
+	}
+
+	/* The timerfd is left as is; an early wake-up with nothing to do is harmless */
+	esif_ccb_mutex_lock(&g_tmrw.wheel_lock);
+	esif_ccb_tmrw_unlink_locked(timer_obj_ptr);
+	esif_ccb_mutex_unlock(&g_tmrw.wheel_lock);
+}
+
+
+static void *ESIF_CALLCONV esif_ccb_tmrw_wheel_thread(void *ctx_ptr)
+{
+	struct epoll_event events[2];
+	u64 expirations = 0;
+	u32 count = 0;
+	int num_events = 0;
+	int i = 0;
+
+	UNREFERENCED_PARAMETER(ctx_ptr);
+
+	while (!g_tmrw.exit_flag) {
+		num_events = epoll_wait(g_tmrw.epoll_fd, events, sizeof(events) / sizeof(events[0]), -1);
+		if (num_events < 0) {
+			if (EINTR == errno) {
+				continue;
+			}
+			break;
+		}
+
+		for (i = 0; i < num_events; i++) {
+			if (events[i].data.fd == g_tmrw.timer_fd) {
+				if (read(g_tmrw.timer_fd, &expirations, sizeof(expirations)) < 0) {
+					expirations = 0;
+				}
+			}
+		}
+		if (g_tmrw.exit_flag) {
+			break;
+		}
+
+		esif_ccb_mutex_lock(&g_tmrw.wheel_lock);
+		count = esif_ccb_tmrw_advance_locked(esif_ccb_tmrw_now_msec() / g_tmrw.slack_msec);
+		esif_ccb_tmrw_program_locked(esif_ccb_tmrw_next_tick_locked());
+		esif_ccb_mutex_unlock(&g_tmrw.wheel_lock);
+
+		while (count-- > 0) {
+			esif_ccb_sem_up(&g_tmrw.ready_sem);
+		}
+	}
+	return NULL;
+}
+
+
+static void *ESIF_CALLCONV esif_ccb_tmrw_cb_thread(void *ctx_ptr)
+{
+	struct esif_timer_obj *timer_obj_ptr = NULL;
+	esif_ccb_timer_handle_t cb_handle = 0;
+
+	UNREFERENCED_PARAMETER(ctx_ptr);
+
+	while (!g_tmrw.exit_flag) {
+		esif_ccb_sem_down(&g_tmrw.ready_sem);
+		if (g_tmrw.exit_flag) {
+			break;
+		}
+
+		/* The timer may have been cancelled since it was made ready */
+		esif_ccb_mutex_lock(&g_tmrw.wheel_lock);
+		timer_obj_ptr = g_tmrw.ready_head_ptr;
+		if (timer_obj_ptr != NULL) {
+			cb_handle = timer_obj_ptr->wheel_cb_handle;
+			esif_ccb_tmrw_unlink_locked(timer_obj_ptr);
+		}
+		esif_ccb_mutex_unlock(&g_tmrw.wheel_lock);
+
+		if (timer_obj_ptr != NULL) {
+			esif_ccb_tmrm_callback(cb_handle);
+		}
+	}
+	return NULL;
+}
+
+
+enum esif_rc esif_ccb_tmrw_init(
+	u32 cb_threads,
+	u32 slack_msec
+	)
+{
+	enum esif_rc rc = ESIF_E_UNSPECIFIED;
+	struct epoll_event ev = {0};
+	u32 i = 0;
+
+	if (g_tmrw.enabled) {
+		rc = ESIF_OK;
+		goto exit;
+	}
+
+	g_tmrw.timer_fd = -1;
+	g_tmrw.exit_fd = -1;
+	g_tmrw.epoll_fd = -1;
+	g_tmrw.exit_flag = ESIF_FALSE;
+	g_tmrw.slack_msec = (slack_msec > 0 ? esif_ccb_min(slack_msec, ESIF_TMRW_SLACK_MSEC_MAX) : ESIF_TMRW_SLACK_MSEC_DEFAULT);
+	g_tmrw.cur_tick = esif_ccb_tmrw_now_msec() / g_tmrw.slack_msec;
+	esif_ccb_mutex_init(&g_tmrw.wheel_lock);
+	esif_ccb_sem_init(&g_tmrw.ready_sem);
+
+	g_tmrw.timer_fd = timerfd_create(CLOCK_BOOTTIME, TFD_CLOEXEC | TFD_NONBLOCK);
+	g_tmrw.exit_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	g_tmrw.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if ((g_tmrw.timer_fd < 0) || (g_tmrw.exit_fd < 0) || (g_tmrw.epoll_fd < 0)) {
+		goto exit;
+	}
+
+	ev.events = EPOLLIN;
+	ev.data.fd = g_tmrw.timer_fd;
+	if (epoll_ctl(g_tmrw.epoll_fd, EPOLL_CTL_ADD, g_tmrw.timer_fd, &ev) != 0) {
+		goto exit;
+	}
+	ev.data.fd = g_tmrw.exit_fd;
+	if (epoll_ctl(g_tmrw.epoll_fd, EPOLL_CTL_ADD, g_tmrw.exit_fd, &ev) != 0) {
+		goto exit;
+	}
+
+	g_tmrw.enabled = ESIF_TRUE;
+
+	cb_threads = (cb_threads > 0 ? esif_ccb_min(cb_threads, ESIF_TMRW_CB_THREADS_MAX) : ESIF_TMRW_CB_THREADS_DEFAULT);
+	g_tmrw.cb_threads_ptr = (esif_thread_t *)esif_ccb_malloc(cb_threads * sizeof(esif_thread_t));
+	if (NULL == g_tmrw.cb_threads_ptr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	for (i = 0; i < cb_threads; i++) {
+		rc = esif_ccb_thread_create(&g_tmrw.cb_threads_ptr[i], esif_ccb_tmrw_cb_thread, NULL);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+		g_tmrw.cb_thread_count++;
+	}
+
+	rc = esif_ccb_thread_create(&g_tmrw.wheel_thread, esif_ccb_tmrw_wheel_thread, NULL);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+	g_tmrw.wheel_thread_started = ESIF_TRUE;
+	rc = ESIF_OK;
+exit:
+	if (rc != ESIF_OK) {
+		g_tmrw.enabled = ESIF_TRUE; /* Allow exit to release partial resources */
+		esif_ccb_tmrw_exit();
+	}
+	return rc;
+}
+
+
+/* All timers should be cancelled before the scheduler is stopped */
+void esif_ccb_tmrw_exit(void)
+{
+	u64 signal_value = 1;
+	u32 i = 0;
+
+	if (!g_tmrw.enabled) {
+		return;
+	}
+
+	g_tmrw.exit_flag = ESIF_TRUE;
+
+	if (g_tmrw.wheel_thread_started) {
+		if (write(g_tmrw.exit_fd, &signal_value, sizeof(signal_value)) < 0) {}
+		esif_ccb_thread_join(&g_tmrw.wheel_thread);
+		g_tmrw.wheel_thread_started = ESIF_FALSE;
+	}
+
+	for (i = 0; i < g_tmrw.cb_thread_count; i++) {
+		esif_ccb_sem_up(&g_tmrw.ready_sem);
+	}
+	for (i = 0; i < g_tmrw.cb_thread_count; i++) {
+		esif_ccb_thread_join(&g_tmrw.cb_threads_ptr[i]);
+	}
+	g_tmrw.cb_thread_count = 0;
+	esif_ccb_free(g_tmrw.cb_threads_ptr);
+	g_tmrw.cb_threads_ptr = NULL;
+
+	if (g_tmrw.epoll_fd >= 0) {
+		close(g_tmrw.epoll_fd);
+	}
+	if (g_tmrw.exit_fd >= 0) {
+		close(g_tmrw.exit_fd);
+	}
+	if (g_tmrw.timer_fd >= 0) {
+		close(g_tmrw.timer_fd);
+	}
+	g_tmrw.epoll_fd = -1;
+	g_tmrw.exit_fd = -1;
+	g_tmrw.timer_fd = -1;
+
+	esif_ccb_sem_uninit(&g_tmrw.ready_sem);
+	esif_ccb_mutex_uninit(&g_tmrw.wheel_lock);
+	esif_ccb_memset(&g_tmrw.slots, 0, sizeof(g_tmrw.slots));
+	esif_ccb_memset(&g_tmrw.occupied, 0, sizeof(g_tmrw.occupied));
+	g_tmrw.ready_head_ptr = NULL;
+	g_tmrw.ready_tail_ptr = NULL;
+	g_tmrw.armed_count = 0;
+	g_tmrw.programmed_tick = 0;
+	g_tmrw.enabled = ESIF_FALSE;
+}
+
+#endif /* LINUX USER */
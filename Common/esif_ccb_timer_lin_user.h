@@ -25,15 +25,37 @@
 
 #if defined(ESIF_ATTR_OS_LINUX) && defined(ESIF_ATTR_USER)
 
-#include <signal.h>
+/*
+ * Timers are scheduled on a hierarchical timer wheel serviced by a single
+ * timerfd/epoll thread; expired timers are handed to a small pool of callback
+ * threads.  Timers which expire within the same slack interval are coalesced
+ * and fire together.  See esif_ccb_timer_lin_user.c.
+ */
+#define ESIF_TMRW_LEVELS	4	/* Wheel levels */
+#define ESIF_TMRW_SLOT_BITS	6
+#define ESIF_TMRW_SLOTS		(1 << ESIF_TMRW_SLOT_BITS)	/* Slots per level */
+
+#define ESIF_TMRW_CB_THREADS_DEFAULT	2	/* Callback threads */
+#define ESIF_TMRW_CB_THREADS_MAX	256
+#define ESIF_TMRW_SLACK_MSEC_DEFAULT	4	/* Coalescing interval (and wheel tick) in msec */
+#define ESIF_TMRW_SLACK_MSEC_MAX	1000
 
-typedef void (*esif_ccb_tmrm_cb_t)(esif_ccb_timer_handle_t cb_handle);
+/* Wheel state of a timer object */
+#define ESIF_TMRW_IDLE		0	/* Not scheduled */
+#define ESIF_TMRW_ARMED		1	/* In a wheel slot */
+#define ESIF_TMRW_READY		2	/* Expired; waiting for a callback thread */
 
 #pragma pack(push, 1)
 
 struct esif_timer_obj {
-	/* TODO: OS-specific items*/
-	timer_t  timer;
+	/* Wheel linkage; only accessed under the wheel lock */
+	struct esif_timer_obj *wheel_next_ptr;
+	struct esif_timer_obj *wheel_prev_ptr;
+	u64 expire_tick;
+	u8 wheel_state;
+	u8 wheel_level;
+	u8 wheel_slot;
+	esif_ccb_timer_handle_t wheel_cb_handle; /* CB handle when armed */
 
 	esif_ccb_timer_cb function_ptr;		/* Callback when timer fires */
 	void *context_ptr;			/* Callback context if any */
@@ -50,77 +72,36 @@ struct esif_timer_obj {
 	esif_ccb_timer_handle_t timer_cb_handle;
 };
 
-struct esif_tmrm_cb_obj {
-	esif_ccb_tmrm_cb_t func;
-	esif_ccb_timer_handle_t cb_handle;
-};
-
 #pragma pack(pop)
 
-static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
-	struct esif_timer_obj *self
-	);
+/* Timer wheel interface; implemented in esif_ccb_timer_lin_user.c */
+enum esif_rc esif_ccb_tmrw_init(u32 cb_threads, u32 slack_msec);
+void esif_ccb_tmrw_exit(void);
+enum esif_rc esif_ccb_tmrw_arm(struct esif_timer_obj *timer_obj_ptr, const esif_ccb_time_t timeout);
+void esif_ccb_tmrw_cancel(struct esif_timer_obj *timer_obj_ptr);
 
 static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_create_timer(
 	struct esif_timer_obj *self
 	)
 {
-	UNREFERENCED_PARAMETER(self);
+	ESIF_ASSERT(self != NULL);
 
+	self->wheel_next_ptr = NULL;
+	self->wheel_prev_ptr = NULL;
+	self->wheel_state = ESIF_TMRW_IDLE;
 	return ESIF_OK;
 }
 
+/* Re-arming replaces any current timeout without allocating */
 static ESIF_INLINE enum esif_rc esif_ccb_timer_obj_enable_timer(
 	struct esif_timer_obj *self,
 	const esif_ccb_time_t timeout	/* Timeout in msec */
 	)
 {
-	enum esif_rc rc = ESIF_OK;
-	struct sigevent se;
-	struct itimerspec its;
-	u64 freq_nanosecs = timeout * 1000 * 1000; /* convert msec to nsec */
-	struct esif_tmrm_cb_obj *cb_object_ptr = NULL;
-
 	ESIF_ASSERT(self != NULL);
 
-	esif_ccb_timer_obj_disable_timer(self);
-
-	/* Use native malloc() because if the associated timer is disabled
-	 * (due to ESIF UF exiting for example), then the esif_ccb_memtrace functions
-	 * will report memory leaks. This is not a real issue though because once
-	 * the daemon process exists, all the heaps allocated by esif_ufd will
-	 * be reclaimed by the OS.
-	 */
-	cb_object_ptr = (struct esif_tmrm_cb_obj *) malloc(sizeof(*cb_object_ptr));
-	if (NULL == cb_object_ptr) {
-		rc = ESIF_E_NO_MEMORY;
-		goto exit;
-	}
-	cb_object_ptr->func = esif_ccb_tmrm_callback;
-	cb_object_ptr->cb_handle = self->timer_cb_handle;
-
-	se.sigev_notify = SIGEV_SIGNAL;
-	se.sigev_signo = SIGRTMIN;
-	se.sigev_value.sival_ptr = cb_object_ptr;
-
-	if (0 != timer_create(CLOCK_REALTIME,
-		&se,
-		(timer_t *)&self->timer)) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
-	} 
-
-	its.it_value.tv_sec     = freq_nanosecs / 1000000000;
-	its.it_value.tv_nsec    = freq_nanosecs % 1000000000;
-	its.it_interval.tv_sec  = 0;
-	its.it_interval.tv_nsec = 0;
-
-	if (0 != timer_settime(self->timer, 0, &its, NULL)) {
-		rc = ESIF_E_UNSPECIFIED;
-		goto exit;
-	}
-exit:
-	return rc;
+	self->timeout = timeout;
+	return esif_ccb_tmrw_arm(self, timeout);
 }
 
 
@@ -130,10 +111,7 @@ static ESIF_INLINE void esif_ccb_timer_obj_disable_timer(
 {
 	ESIF_ASSERT(self != NULL);
 
-	if (self->timer != 0) {
-		timer_delete(self->timer);
-		self->timer = 0;
-	}
+	esif_ccb_tmrw_cancel(self);
 }
 
 #endif /* LINUX USER */
@@ -0,0 +1,368 @@
+/*******************************************************************************
+** This file is provided under a dual BSD/GPLv2 license.  When using or
+** redistributing this file, you may do so under either license.
+**
+** GPL LICENSE SUMMARY
+**
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** This program is free software; you can redistribute it and/or modify it under
+** the terms of version 2 of the GNU General Public License as published by the
+** Free Software Foundation.
+**
+** This program is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+** FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+** details.
+**
+** You should have received a copy of the GNU General Public License along with
+** this program; if not, write to the Free Software  Foundation, Inc.,
+** 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+** The full GNU General Public License is included in this distribution in the
+** file called LICENSE.GPL.
+**
+** BSD LICENSE
+**
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** * Redistributions of source code must retain the above copyright notice, this
+**   list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice,
+**   this list of conditions and the following disclaimer in the documentation
+**   and/or other materials provided with the distribution.
+** * Neither the name of Intel Corporation nor the names of its contributors may
+**   be used to endorse or promote products derived from this software without
+**   specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+**
+*******************************************************************************/
+
+#include "esif_ring.h"
+#include "esif_ccb_memory.h"
+#include "esif_ccb_string.h"
+
+#ifdef ESIF_ATTR_OS_WINDOWS
+//
+// The Windows banned-API check header must be included after all other headers, or issues can be identified
+// against Windows SDK/DDK included headers which we have no control over.
+//
+#define _SDL_BANNED_RECOMMENDED
+#include "win\banned.h"
+#endif
+
+/* Each cell holds its sequence number followed by the item data */
+#define ESIF_RING_CELL_HDR_SIZE	sizeof(u64)
+#define ESIF_RING_ALIGN(x)	(((x) + (sizeof(u64) - 1)) & ~((u32)sizeof(u64) - 1))
+
+#define esif_ring_cell(self, pos) \
+	((self)->cells_ptr + ((size_t)((pos) & (self)->mask) * (self)->cell_size))
+#define esif_ring_cell_seq(cell_ptr) ((atomic_t *)(cell_ptr))
+#define esif_ring_cell_item(cell_ptr) ((cell_ptr) + ESIF_RING_CELL_HDR_SIZE)
+
+/* Signed distance between two free-running positions; tolerates wraparound */
+#define esif_ring_pos_diff(a, b) ((atomic_basetype)((unsigned long)(a) - (unsigned long)(b)))
+
+
+static void esif_ring_update_high_water(
+	struct esif_ring_instance *self,
+	atomic_basetype depth
+	)
+{
+	atomic_basetype high_water = atomic_read(&self->high_water);
+
+	while (depth > high_water) {
+		if (atomic_cmpxchg(&self->high_water, high_water, depth) == high_water)
+			break;
+		high_water = atomic_read(&self->high_water);
+	}
+}
+
+
+/* Ring Create */
+struct esif_ring_instance *esif_ring_create(
+	u32 depth,
+	u32 item_size,
+	char *name_ptr,
+	u32 ms_timeout
+	)
+{
+	enum esif_rc rc = ESIF_E_NO_MEMORY;
+	struct esif_ring_instance *ring_ptr = NULL;
+	u32 capacity = 2;
+	u32 i = 0;
+
+	if ((0 == item_size) || (depth > ESIF_RING_MAX_DEPTH))
+		goto exit;
+
+	while (capacity < depth)
+		capacity <<= 1;
+
+	ring_ptr = (struct esif_ring_instance *)
+		esif_ccb_malloc(sizeof(*ring_ptr));
+	if (NULL == ring_ptr)
+		goto exit;
+
+	esif_ccb_event_init(&ring_ptr->event);
+	ring_ptr->capacity   = capacity;
+	ring_ptr->mask       = capacity - 1;
+	ring_ptr->item_size  = item_size;
+	ring_ptr->cell_size  = ESIF_RING_CELL_HDR_SIZE + ESIF_RING_ALIGN(item_size);
+	ring_ptr->ms_timeout = ms_timeout;
+
+	esif_ccb_strcpy(ring_ptr->ring_name,
+		name_ptr,
+		sizeof(ring_ptr->ring_name));
+
+	ring_ptr->cells_ptr = (u8 *)esif_ccb_malloc((size_t)capacity * ring_ptr->cell_size);
+	if (NULL == ring_ptr->cells_ptr)
+		goto exit;
+
+	/* Cell N is initially available to the producer at position N */
+	for (i = 0; i < capacity; i++)
+		atomic_set(esif_ring_cell_seq(esif_ring_cell(ring_ptr, i)), (atomic_basetype)i);
+
+	rc = ESIF_OK;
+exit:
+	if (rc != ESIF_OK) {
+		esif_ring_destroy(ring_ptr, NULL);
+		ring_ptr = NULL;
+	}
+	return ring_ptr;
+}
+
+
+/* Ring Destroy */
+void esif_ring_destroy(
+	struct esif_ring_instance *self,
+	ring_item_destroy_func destroy_func_ptr
+	)
+{
+	u8 *item_ptr = NULL;
+
+	if (NULL == self)
+		goto exit;
+
+	if (self->cells_ptr != NULL) {
+		item_ptr = (u8 *)esif_ccb_malloc(self->item_size);
+
+		while ((item_ptr != NULL) && (esif_ring_dequeue(self, item_ptr) == ESIF_OK)) {
+			if (destroy_func_ptr != NULL)
+				destroy_func_ptr(item_ptr);
+		}
+		esif_ccb_free(item_ptr);
+	}
+
+	esif_ccb_event_uninit(&self->event);
+
+	esif_ccb_free(self->cells_ptr);
+	esif_ccb_free(self);
+exit:
+	return;
+}
+
+
+/* Ring Enqueue (Copies item into the next free cell) */
+enum esif_rc esif_ring_enqueue(
+	struct esif_ring_instance *self,
+	const void *item_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	u8 *cell_ptr = NULL;
+	atomic_basetype pos = 0;
+	atomic_basetype diff = 0;
+
+	if ((NULL == self) || (NULL == item_ptr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	/* Claim a cell by advancing the enqueue position */
+	pos = atomic_read(&self->enqueue_pos);
+	for (;;) {
+		cell_ptr = esif_ring_cell(self, pos);
+		diff = esif_ring_pos_diff(atomic_read(esif_ring_cell_seq(cell_ptr)), pos);
+
+		if (0 == diff) {
+			if (atomic_cmpxchg(&self->enqueue_pos, pos, pos + 1) == pos)
+				break;
+			pos = atomic_read(&self->enqueue_pos);
+		} else if (diff < 0) {
+			/* Cell still owned by the consumer from the previous lap */
+			atomic64_inc(&self->drops);
+			rc = ESIF_E_MAXIMUM_CAPACITY_REACHED;
+			goto exit;
+		} else {
+			pos = atomic_read(&self->enqueue_pos);
+		}
+	}
+
+	esif_ccb_memcpy(esif_ring_cell_item(cell_ptr), item_ptr, self->item_size);
+
+	/* Publish the cell to the consumer */
+	atomic_set(esif_ring_cell_seq(cell_ptr), pos + 1);
+
+	atomic64_inc(&self->enqueued);
+	esif_ring_update_high_water(self,
+		esif_ring_pos_diff(pos + 1, atomic_read(&self->dequeue_pos)));
+
+	/* Wakeup; only take the event lock if a consumer may be waiting */
+	if (atomic_read(&self->waiters) > 0)
+		esif_ccb_event_set(&self->event);
+exit:
+	return rc;
+}
+
+
+/* Ring Dequeue (Copies the oldest item out and releases its cell) */
+enum esif_rc esif_ring_dequeue(
+	struct esif_ring_instance *self,
+	void *item_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	u8 *cell_ptr = NULL;
+	atomic_basetype pos = 0;
+	atomic_basetype diff = 0;
+
+	if ((NULL == self) || (NULL == item_ptr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	pos = atomic_read(&self->dequeue_pos);
+	for (;;) {
+		cell_ptr = esif_ring_cell(self, pos);
+		diff = esif_ring_pos_diff(atomic_read(esif_ring_cell_seq(cell_ptr)), pos + 1);
+
+		if (0 == diff) {
+			if (atomic_cmpxchg(&self->dequeue_pos, pos, pos + 1) == pos)
+				break;
+			pos = atomic_read(&self->dequeue_pos);
+		} else if (diff < 0) {
+			/* Cell not yet published; ring is empty */
+			rc = ESIF_E_NOT_FOUND;
+			goto exit;
+		} else {
+			pos = atomic_read(&self->dequeue_pos);
+		}
+	}
+
+	esif_ccb_memcpy(item_ptr, esif_ring_cell_item(cell_ptr), self->item_size);
+
+	/* Hand the cell back to producers for the next lap */
+	atomic_set(esif_ring_cell_seq(cell_ptr), pos + (atomic_basetype)self->mask + 1);
+
+	atomic64_inc(&self->dequeued);
+exit:
+	return rc;
+}
+
+
+/* Ring Pull */
+enum esif_rc esif_ring_pull(
+	struct esif_ring_instance *self,
+	void *item_ptr
+	)
+{
+	enum esif_rc rc = ESIF_E_PARAMETER_IS_NULL;
+
+	if (NULL == self)
+		goto exit;
+
+	rc = esif_ring_dequeue(self, item_ptr);
+	if (rc != ESIF_E_NOT_FOUND)
+		goto exit;
+
+	/*
+	 * Announce the waiter and reset the event before checking again so that
+	 * an item published between the check and the wait re-signals the event
+	 */
+	atomic_inc(&self->waiters);
+	esif_ccb_event_reset(&self->event);
+
+	rc = esif_ring_dequeue(self, item_ptr);
+	if (rc == ESIF_E_NOT_FOUND) {
+		/*
+		 * If no timeout, wait forever; else, wait the specified time for an event.
+		 */
+		if (ESIF_RING_TIMEOUT_INFINITE == self->ms_timeout) {
+			esif_ccb_event_wait(&self->event);
+		} else {
+			esif_ccb_event_try_wait(&self->event, self->ms_timeout);
+		}
+		rc = esif_ring_dequeue(self, item_ptr);
+	}
+	atomic_dec(&self->waiters);
+exit:
+	return rc;
+}
+
+
+/* Ring Size */
+u32 esif_ring_size(struct esif_ring_instance *self)
+{
+	atomic_basetype depth = 0;
+
+	if (NULL == self)
+		return 0;
+
+	depth = esif_ring_pos_diff(atomic_read(&self->enqueue_pos), atomic_read(&self->dequeue_pos));
+	return (depth > 0 ? (u32)depth : 0);
+}
+
+
+/* Used to allow a waiting thread to exit before destruction */
+void esif_ring_signal_event(struct esif_ring_instance *self)
+{
+	if (self != NULL)
+		esif_ccb_event_set(&self->event);
+}
+
+
+void esif_ring_get_stats(
+	struct esif_ring_instance *self,
+	struct esif_ring_stats *stats_ptr
+	)
+{
+	if ((NULL == self) || (NULL == stats_ptr))
+		return;
+
+	stats_ptr->enqueued = (u64)atomic64_read(&self->enqueued);
+	stats_ptr->dequeued = (u64)atomic64_read(&self->dequeued);
+	stats_ptr->drops = (u64)atomic64_read(&self->drops);
+	stats_ptr->depth = esif_ring_size(self);
+	stats_ptr->high_water = (u32)atomic_read(&self->high_water);
+	stats_ptr->capacity = self->capacity;
+}
+
+
+void esif_ring_reset_stats(struct esif_ring_instance *self)
+{
+	if (NULL == self)
+		return;
+
+	atomic64_set(&self->enqueued, 0);
+	atomic64_set(&self->dequeued, 0);
+	atomic64_set(&self->drops, 0);
+	atomic_set(&self->high_water, (atomic_basetype)esif_ring_size(self));
+}
+
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
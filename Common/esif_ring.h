@@ -0,0 +1,170 @@
+/*******************************************************************************
+** This file is provided under a dual BSD/GPLv2 license.  When using or
+** redistributing this file, you may do so under either license.
+**
+** GPL LICENSE SUMMARY
+**
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** This program is free software; you can redistribute it and/or modify it under
+** the terms of version 2 of the GNU General Public License as published by the
+** Free Software Foundation.
+**
+** This program is distributed in the hope that it will be useful, but WITHOUT
+** ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+** FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+** details.
+**
+** You should have received a copy of the GNU General Public License along with
+** this program; if not, write to the Free Software  Foundation, Inc.,
+** 51 Franklin St - Fifth Floor, Boston, MA 02110-1301 USA.
+** The full GNU General Public License is included in this distribution in the
+** file called LICENSE.GPL.
+**
+** BSD LICENSE
+**
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Redistribution and use in source and binary forms, with or without
+** modification, are permitted provided that the following conditions are met:
+**
+** * Redistributions of source code must retain the above copyright notice, this
+**   list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice,
+**   this list of conditions and the following disclaimer in the documentation
+**   and/or other materials provided with the distribution.
+** * Neither the name of Intel Corporation nor the names of its contributors may
+**   be used to endorse or promote products derived from this software without
+**   specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+** POSSIBILITY OF SUCH DAMAGE.
+**
+*******************************************************************************/
+
+
+#ifndef _ESIF_RING_H_
+#define _ESIF_RING_H_
+
+#include "esif_ccb.h"
+#include "esif_ccb_atomic.h"
+#include "esif_ccb_sem.h"
+
+/*
+ * Bounded Ring Buffer
+ *
+ * Fixed-size items are copied into a preallocated array of cells, so no
+ * allocation or lock is required to enqueue or dequeue. Each cell carries a
+ * sequence number which hands ownership of the cell back and forth between
+ * producers and consumers (Vyukov-style bounded queue).  Any number of
+ * threads may enqueue concurrently; dequeue is also safe with multiple
+ * consumers, though the expected usage is a single consumer thread.
+ * When the ring is full, enqueue fails immediately and the drop is counted.
+ */
+
+#define ESIF_RING_NAME_LEN 32
+#define ESIF_RING_TIMEOUT_INFINITE 0
+#define ESIF_RING_MAX_DEPTH 0x100000	/* Maximum number of cells (rounded up to power of 2) */
+
+/* Ring Statistics */
+struct esif_ring_stats {
+	u64 enqueued;		/* Total items successfully enqueued */
+	u64 dequeued;		/* Total items dequeued */
+	u64 drops;		/* Items rejected because the ring was full */
+	u32 depth;		/* Current number of items in the ring */
+	u32 high_water;		/* Largest number of items ever in the ring */
+	u32 capacity;		/* Number of cells in the ring */
+};
+
+/* Ring Instance */
+struct esif_ring_instance {
+	u32 capacity;		/* Number of cells; always a power of 2 */
+	u32 mask;		/* capacity - 1 */
+	u32 item_size;		/* Size of each item in bytes */
+	u32 cell_size;		/* Size of each cell (sequence + item), aligned */
+	u32 ms_timeout;		/* Pull timeout in milliseconds */
+	u8 *cells_ptr;		/* Cell array */
+	atomic_t enqueue_pos;	/* Next cell for producers */
+	atomic_t dequeue_pos;	/* Next cell for consumers */
+	atomic64_t enqueued;
+	atomic64_t dequeued;
+	atomic64_t drops;
+	atomic_t high_water;
+	atomic_t waiters;	/* Consumers preparing to wait; producers only signal when non-zero */
+	esif_ccb_event_t event;	/* Allow blocking if ring is empty */
+	char ring_name[ESIF_RING_NAME_LEN];	/* Ring Name */
+};
+
+#ifdef ESIF_ATTR_USER
+typedef struct esif_ring_instance EsifRing, *EsifRingPtr;
+typedef struct esif_ring_stats EsifRingStats, *EsifRingStatsPtr;
+#endif
+
+typedef void (*ring_item_destroy_func) (void *item_ptr);
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct esif_ring_instance *esif_ring_create(
+	u32 depth,
+	u32 item_size,
+	char *name_ptr,
+	u32 ms_timeout
+	);
+
+/* Destroy function is called with a pointer to each item remaining in the ring */
+void esif_ring_destroy(
+	struct esif_ring_instance *self,
+	ring_item_destroy_func destroy_func_ptr
+	);
+
+/* Copies item_size bytes from item_ptr into the ring; fails if the ring is full */
+enum esif_rc esif_ring_enqueue(
+	struct esif_ring_instance *self,
+	const void *item_ptr
+	);
+
+/* Non-blocking; copies the oldest item to item_ptr. Returns ESIF_E_NOT_FOUND if empty */
+enum esif_rc esif_ring_dequeue(
+	struct esif_ring_instance *self,
+	void *item_ptr
+	);
+
+/* Blocks until an item is available, the timeout expires, or the ring is signaled */
+enum esif_rc esif_ring_pull(
+	struct esif_ring_instance *self,
+	void *item_ptr
+	);
+
+/* Used to allow a waiting thread to exit before destruction */
+void esif_ring_signal_event(struct esif_ring_instance *self);
+
+u32 esif_ring_size(struct esif_ring_instance *self);
+
+void esif_ring_get_stats(
+	struct esif_ring_instance *self,
+	struct esif_ring_stats *stats_ptr
+	);
+
+void esif_ring_reset_stats(struct esif_ring_instance *self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ESIF_RING_H_ */
+
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
@@ -70,7 +70,8 @@
 
 
 #define APP_INTERFACE_VERSION_4 4 /* Handles moved to 64-bit vs. system-dependent VOID* */
-#define APP_INTERFACE_VERSION   APP_INTERFACE_VERSION_4
+#define APP_INTERFACE_VERSION_5 5 /* Added bound primitive execution to the ESIF interface */
+#define APP_INTERFACE_VERSION   APP_INTERFACE_VERSION_5
 #define APP_PARTICIPANT_VERSION 1
 #define APP_DOMAIN_VERSION 1
 
@@ -342,6 +343,21 @@ struct _t_AppInterfaceSet {
 
 #pragma pack(pop)
 
+/*
+* A Version 4 interface set is identical to Version 5 except that it ends
+* before the bound primitive functions, which are treated as absent.
+*/
+#define APP_INTERFACE_SET_SIZE_V4 \
+	((UInt16)(offsetof(AppInterfaceSet, esifIface) + offsetof(EsifInterface, fPrimitiveBindFuncPtr)))
+
+#define APP_INTERFACE_SET_SIZE(version) \
+	((UInt16)((version) >= APP_INTERFACE_VERSION_5 ? sizeof(AppInterfaceSet) : APP_INTERFACE_SET_SIZE_V4))
+
+#define APP_INTERFACE_SET_IS_SUPPORTED(hdrPtr) \
+	((hdrPtr)->fIfaceType == eIfaceTypeApplication && \
+	 ((hdrPtr)->fIfaceVersion == APP_INTERFACE_VERSION_5 || (hdrPtr)->fIfaceVersion == APP_INTERFACE_VERSION_4) && \
+	 (hdrPtr)->fIfaceSize == APP_INTERFACE_SET_SIZE((hdrPtr)->fIfaceVersion))
+
 /* C++ */
 
 #ifdef __cplusplus
@@ -152,6 +152,38 @@ typedef eEsifError(ESIF_CALLCONV *AppSendCommandFunction)(
 	const EsifDataArray argv,        /* array of command arguments must be ESIF_DATA_STRING today */
 	EsifDataPtr response      /* response must be ESIF_DATA_STRING today */
 	);
+
+/* Version 5 */
+/*
+ * Primitive Binding
+ * Resolves a participant/domain/primitive/instance once and returns a handle that may be used to execute
+ * the primitive repeatedly without resolving the participant and domain handles on each call.  Bound
+ * handles are released when unbound or when the participant is destroyed; executing a released handle
+ * returns ESIF_E_INVALID_HANDLE.
+ */
+typedef eEsifError(ESIF_CALLCONV *AppPrimitiveBindFunction)(
+	const esif_handle_t esifHandle,		/* ESIF provided context handle */
+	const esif_handle_t participantHandle,	/* Optional participant identifier */
+	const esif_handle_t domainHandle,	/* Optional required if particpant identifier is provided */
+	const ePrimitiveType primitive,	/* Primitive ID e.g. GET_TEMPERATURE */
+	const UInt8 instance,		/* Primitive instance may be 255 or ESIF_INSTANCE_INVALID */
+	esif_handle_t *primitiveHandlePtr	/* Bound primitive handle */
+	);
+
+/* Execute Bound Primitive */
+typedef eEsifError(ESIF_CALLCONV *AppPrimitiveBoundFunction)(
+	const esif_handle_t esifHandle,		/* ESIF provided context handle */
+	const esif_handle_t primitiveHandle,	/* Handle returned by the bind function */
+	const EsifDataPtr request,	/* Request data for SET_* based primitives */
+	EsifDataPtr response		/* Response data for GET_* based primitives */
+	);
+
+/* Primitive Unbind */
+typedef eEsifError(ESIF_CALLCONV *AppPrimitiveUnbindFunction)(
+	const esif_handle_t esifHandle,		/* ESIF provided context handle */
+	const esif_handle_t primitiveHandle	/* Handle returned by the bind function */
+	);
+
 /*
  * ESIF Service Interface ESIF <-- APPLICATION
  * Forward declared and typedef in esif_uf_iface.h
@@ -174,6 +206,11 @@ struct _t_EsifInterface {
 	AppSendEventFunction fSendEventFuncPtr;
 
 	AppSendCommandFunction fSendCommandFuncPtr;
+
+	/* Bound Primitive Execution */
+	AppPrimitiveBindFunction    fPrimitiveBindFuncPtr;
+	AppPrimitiveBoundFunction   fPrimitiveBoundFuncPtr;
+	AppPrimitiveUnbindFunction  fPrimitiveUnbindFuncPtr;
 };
 
 #pragma pack(pop)
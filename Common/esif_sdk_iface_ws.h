@@ -26,7 +26,7 @@
 
 #define WS_LIBRARY_NAME				"esif_ws"			// Name of Loadable Library (.dll or .so)
 #define WS_GET_INTERFACE_FUNCTION	"GetWsInterface"	// Interface Function Exported from Loadable Library
-#define WS_IFACE_VERSION			4					// Interface Version
+#define WS_IFACE_VERSION			5					// Interface Version
 #define WS_MAX_REST_RESPONSE		0x7FFFFFFE			// Max REST API Response Length
 #define WS_LISTENERS				1					// Max Number of Listener Ports
 #define WS_FLAG_NOWHITELIST			0x01				// Do not enforce REST API Whitelist
@@ -38,6 +38,9 @@ typedef Bool	(ESIF_CALLCONV *EsifWsShellEnabledFunc)(void);
 typedef char *	(ESIF_CALLCONV *EsifWsShellExecFunc)(char *cmd, size_t cmd_len, char *prefix, size_t prefix_len);
 typedef int     (ESIF_CALLCONV *EsifWsTraceMessageFunc)(int level, const char *func, const char *file, int line, const char *msg, va_list arglist);
 typedef int     (ESIF_CALLCONV *EsifWsConsoleMessageFunc)(const char *msg, va_list args);
+typedef void *	(ESIF_CALLCONV *EsifWsShellCtxCreateFunc)(void);
+typedef void	(ESIF_CALLCONV *EsifWsShellCtxDestroyFunc)(void *ctx);
+typedef char *	(ESIF_CALLCONV *EsifWsShellCtxExecFunc)(void *ctx, char *cmd, size_t cmd_len, char *prefix, size_t prefix_len);
 
 // Interface Function Prototypes (ESIF -> WS) [Filled by Plugin]
 typedef esif_error_t (ESIF_CALLCONV *EsifWsInitFunc)(void);
@@ -67,6 +70,9 @@ typedef struct EsifWsInterface_s {
 	EsifWsShellExecFunc			tEsifWsShellExecFuncPtr;
 	EsifWsTraceMessageFunc		tEsifWsTraceMessageFuncPtr;
 	EsifWsConsoleMessageFunc	tEsifWsConsoleMessageFuncPtr;
+	EsifWsShellCtxCreateFunc	tEsifWsShellCtxCreateFuncPtr;	// Create an isolated Shell Execution Context
+	EsifWsShellCtxDestroyFunc	tEsifWsShellCtxDestroyFuncPtr;	// Destroy a Shell Execution Context
+	EsifWsShellCtxExecFunc		tEsifWsShellCtxExecFuncPtr;		// Execute a Shell Command in a Shell Execution Context
 
 	// ESIF_UF -> ESIF_WS Interface Parameters and Functions [Filled by ESIF_WS]
 	char						wsVersion[ESIF_VERSION_LEN];
@@ -0,0 +1,95 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#include "Benchmark.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace std;
+
+static atomic<UInt64> g_allocationCount(0);
+static volatile size_t g_sink = 0;
+
+void* operator new(size_t size)
+{
+	g_allocationCount.fetch_add(1, memory_order_relaxed);
+	void* memory = malloc(size ? size : 1);
+	if (memory == nullptr)
+	{
+		throw bad_alloc();
+	}
+	return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+	free(memory);
+}
+
+UInt64 Benchmark::getAllocationCount(void)
+{
+	return g_allocationCount.load(memory_order_relaxed);
+}
+
+BenchmarkResult Benchmark::run(const function<void(void)>& function, double minimumSeconds)
+{
+	function();
+
+	UInt64 iterations = 0;
+	UInt64 allocationsBefore = getAllocationCount();
+	auto start = chrono::steady_clock::now();
+	chrono::duration<double> elapsed(0);
+	do
+	{
+		function();
+		iterations++;
+		elapsed = chrono::steady_clock::now() - start;
+	} while (elapsed.count() < minimumSeconds);
+	UInt64 allocations = getAllocationCount() - allocationsBefore;
+
+	BenchmarkResult result;
+	result.iterations = iterations;
+	result.nanosecondsPerIteration = elapsed.count() * 1e9 / (double)iterations;
+	result.allocationsPerIteration = (double)allocations / (double)iterations;
+	return result;
+}
+
+void Benchmark::printHeader(const string& title)
+{
+	printf("\n%s\n", title.c_str());
+	printf("%-56s %12s %14s %14s\n", "Benchmark", "Iterations", "ns/iteration", "allocs/iter");
+}
+
+void Benchmark::printResult(const string& name, const BenchmarkResult& result)
+{
+	printf(
+		"%-56s %12llu %14.1f %14.1f\n",
+		name.c_str(),
+		(unsigned long long)result.iterations,
+		result.nanosecondsPerIteration,
+		result.allocationsPerIteration);
+}
+
+void Benchmark::consume(size_t value)
+{
+	g_sink = g_sink + value;
+}
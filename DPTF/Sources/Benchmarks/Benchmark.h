@@ -0,0 +1,47 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#pragma once
+
+#include "Dptf.h"
+#include <functional>
+
+struct BenchmarkResult
+{
+	UInt64 iterations;
+	double nanosecondsPerIteration;
+	double allocationsPerIteration;
+};
+
+// Times a function over many iterations and counts the heap allocations it makes.  Every benchmark executable links
+// Benchmark.cpp, which replaces the global operator new to count allocations.
+class Benchmark
+{
+public:
+	static UInt64 getAllocationCount(void);
+
+	// Runs the function once to warm up, then repeats it until minimumSeconds have passed
+	static BenchmarkResult run(const std::function<void(void)>& function, double minimumSeconds = 0.5);
+
+	static void printHeader(const std::string& title);
+	static void printResult(const std::string& name, const BenchmarkResult& result);
+
+	// Keeps results observable so the optimizer cannot remove the work being measured
+	static void consume(size_t value);
+};
@@ -0,0 +1,215 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#include "Benchmark.h"
+#include "ThermalRelationshipTable.h"
+#include "ActiveRelationshipTable.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+// Compares the indexed TRT and ART lookups against a scan of every table row, which is how the policies found the
+// relationships of a participant before the tables were indexed.  The synthetic tables relate randomly chosen source
+// and target participants; every participant is associated with the tables like the policies do at runtime.
+
+typedef vector<shared_ptr<RelationshipTableEntryBase>> EntryList;
+
+class RandomSequence
+{
+public:
+	RandomSequence(UInt32 seed)
+		: m_state(seed)
+	{
+	}
+
+	UInt32 next(UInt32 limit)
+	{
+		m_state = m_state * 1103515245 + 12345;
+		return (m_state >> 8) % limit;
+	}
+
+private:
+	UInt32 m_state;
+};
+
+static string participantScope(UIntN participantIndex)
+{
+	return "\\_SB_.PC00.TSR" + to_string(participantIndex);
+}
+
+static EntryList createTrtEntries(UIntN participantCount, UIntN entryCount)
+{
+	RandomSequence random(1);
+	EntryList entries;
+	for (UIntN e = 0; e < entryCount; e++)
+	{
+		auto source = random.next(participantCount);
+		auto target = random.next(participantCount);
+		entries.push_back(make_shared<ThermalRelationshipTableEntry>(
+			participantScope(source), participantScope(target), random.next(20) * 5, TimeSpan::createFromSeconds(1)));
+	}
+	return entries;
+}
+
+static EntryList createArtEntries(UIntN participantCount, UIntN entryCount)
+{
+	RandomSequence random(2);
+	EntryList entries;
+	for (UIntN e = 0; e < entryCount; e++)
+	{
+		auto source = random.next(participantCount);
+		auto target = random.next(participantCount);
+		vector<UInt32> acEntries(10, 100);
+		entries.push_back(make_shared<ActiveRelationshipTableEntry>(
+			participantScope(source), participantScope(target), random.next(20) * 5, acEntries));
+	}
+	return entries;
+}
+
+// Row scans as the policies did them before the tables were indexed
+template <typename EntryType, typename WeightFunction>
+static vector<shared_ptr<EntryType>> scanEntries(
+	const EntryList& entries,
+	UIntN participantIndex,
+	Bool matchTarget,
+	WeightFunction weight)
+{
+	vector<shared_ptr<EntryType>> matches;
+	for (auto entry = entries.begin(); entry != entries.end(); ++entry)
+	{
+		auto typedEntry = dynamic_pointer_cast<EntryType>(*entry);
+		auto index = matchTarget ? (*entry)->getTargetDeviceIndex() : (*entry)->getSourceDeviceIndex();
+		if (typedEntry && (index == participantIndex))
+		{
+			matches.push_back(typedEntry);
+		}
+	}
+	stable_sort(
+		matches.begin(), matches.end(), [weight](const shared_ptr<EntryType>& left, const shared_ptr<EntryType>& right) {
+			return weight(*left) > weight(*right);
+		});
+	return matches;
+}
+
+static Bool scanIsTargetDevice(const EntryList& entries, UIntN participantIndex)
+{
+	for (auto entry = entries.begin(); entry != entries.end(); ++entry)
+	{
+		if ((*entry)->getTargetDeviceIndex() == participantIndex)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static UInt32 trtInfluence(const ThermalRelationshipTableEntry& entry)
+{
+	return entry.thermalInfluence();
+}
+
+static UInt32 artWeight(const ActiveRelationshipTableEntry& entry)
+{
+	return entry.getWeight();
+}
+
+template <typename TableType>
+static void associateParticipants(TableType& table, UIntN participantCount)
+{
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		table.associateParticipant(participantScope(p), p, "TSR" + to_string(p));
+	}
+}
+
+int main(int argc, char** argv)
+{
+	UIntN participantCount = (argc > 1) ? (UIntN)strtoul(argv[1], nullptr, 10) : 40;
+	UIntN entryCount = (argc > 2) ? (UIntN)strtoul(argv[2], nullptr, 10) : 400;
+	if (participantCount == 0)
+	{
+		fprintf(stderr, "usage: %s [participants] [entries]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	auto trtEntries = createTrtEntries(participantCount, entryCount);
+	auto artEntries = createArtEntries(participantCount, entryCount);
+	ThermalRelationshipTable trt(trtEntries);
+	ActiveRelationshipTable art(artEntries);
+	associateParticipants(trt, participantCount);
+	associateParticipants(art, participantCount);
+
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		if ((trt.getEntriesForTarget(p)
+			 != scanEntries<ThermalRelationshipTableEntry>(trtEntries, p, true, trtInfluence))
+			|| (art.getEntriesForTarget(p)
+				!= scanEntries<ActiveRelationshipTableEntry>(artEntries, p, true, artWeight))
+			|| (art.getEntriesForSource(p)
+				!= scanEntries<ActiveRelationshipTableEntry>(artEntries, p, false, artWeight))
+			|| (trt.isParticipantTargetDevice(p) != scanIsTargetDevice(trtEntries, p)))
+		{
+			fprintf(stderr, "Indexed and scanned lookups differ for participant %u\n", p);
+			return EXIT_FAILURE;
+		}
+	}
+
+	Benchmark::printHeader(
+		"Relationship table lookups for all " + to_string(participantCount) + " participants, "
+		+ to_string(entryCount) + " entries per table");
+	Benchmark::printResult("TRT getEntriesForTarget (indexed)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(trt.getEntriesForTarget(p).size());
+		}
+	}));
+	Benchmark::printResult("TRT entries for target (row scan)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(scanEntries<ThermalRelationshipTableEntry>(trtEntries, p, true, trtInfluence).size());
+		}
+	}));
+	Benchmark::printResult("TRT isParticipantTargetDevice (indexed)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(trt.isParticipantTargetDevice(p));
+		}
+	}));
+	Benchmark::printResult("TRT is target device (row scan)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(scanIsTargetDevice(trtEntries, p));
+		}
+	}));
+	Benchmark::printResult("ART getEntriesForSource (indexed)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(art.getEntriesForSource(p).size());
+		}
+	}));
+	Benchmark::printResult("ART entries for source (row scan)", Benchmark::run([&]() {
+		for (UIntN p = 0; p < participantCount; p++)
+		{
+			Benchmark::consume(scanEntries<ActiveRelationshipTableEntry>(artEntries, p, false, artWeight).size());
+		}
+	}));
+	return EXIT_SUCCESS;
+}
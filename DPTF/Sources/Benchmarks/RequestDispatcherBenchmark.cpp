@@ -0,0 +1,173 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#include "Benchmark.h"
+#include "RequestDispatcher.h"
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <set>
+
+using namespace std;
+
+// Measures the cost of one dispatch() and one dispatchForAllControls() as the number of participants grows.  The
+// routed RequestDispatcher is compared against a broadcast dispatcher that copies the handler set of the request type
+// and asks every handler canProcessRequest(), which is how requests were dispatched before they were routed.
+
+static const UIntN DomainsPerParticipant = 3;
+static const DptfRequestType::Enum ControlRequestTypes[] = {DptfRequestType::ActiveControlGetStatus,
+															DptfRequestType::TemperatureControlGetTemperatureStatus,
+															DptfRequestType::BatteryStatusGetBatteryStatus,
+															DptfRequestType::ProcessorControlSetTccOffsetTemperature};
+
+// A control of one domain, accepting only requests addressed to that domain
+class FakeControl : public RequestHandlerInterface
+{
+public:
+	FakeControl(UIntN participantIndex, UIntN domainIndex)
+		: m_participantIndex(participantIndex)
+		, m_domainIndex(domainIndex)
+	{
+	}
+
+	virtual DptfRequestResult processRequest(const PolicyRequest& policyRequest) override
+	{
+		return DptfRequestResult(true, "", policyRequest.getRequest());
+	}
+
+	virtual Bool canProcessRequest(const PolicyRequest& policyRequest) override
+	{
+		auto& request = policyRequest.getRequest();
+		return (request.getParticipantIndex() == m_participantIndex) && (request.getDomainIndex() == m_domainIndex);
+	}
+
+private:
+	UIntN m_participantIndex;
+	UIntN m_domainIndex;
+};
+
+class BroadcastDispatcher
+{
+public:
+	void registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler)
+	{
+		m_handlers[requestType].insert(handler);
+	}
+
+	DptfRequestResult dispatch(const PolicyRequest& policyRequest)
+	{
+		auto handlers = m_handlers[policyRequest.getRequest().getRequestType()];
+		for (auto handler = handlers.begin(); handler != handlers.end(); ++handler)
+		{
+			if ((*handler)->canProcessRequest(policyRequest))
+			{
+				return (*handler)->processRequest(policyRequest);
+			}
+		}
+		return DptfRequestResult(false, "No handler for request.", policyRequest.getRequest());
+	}
+
+	void dispatchForAllControls(const PolicyRequest& policyRequest)
+	{
+		auto handlers = m_handlers[policyRequest.getRequest().getRequestType()];
+		for (auto handler = handlers.begin(); handler != handlers.end(); ++handler)
+		{
+			if ((*handler)->canProcessRequest(policyRequest))
+			{
+				(*handler)->processRequest(policyRequest);
+			}
+		}
+	}
+
+private:
+	map<DptfRequestType::Enum, set<RequestHandlerInterface*>> m_handlers;
+};
+
+static void runForParticipantCount(UIntN participantCount)
+{
+	vector<shared_ptr<FakeControl>> controls;
+	RequestDispatcher routed;
+	BroadcastDispatcher broadcast;
+
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		for (UIntN d = 0; d < DomainsPerParticipant; d++)
+		{
+			for (auto requestType : ControlRequestTypes)
+			{
+				auto control = make_shared<FakeControl>(p, d);
+				controls.push_back(control);
+				routed.registerHandler(requestType, p, d, control.get());
+				routed.registerHandler(DptfRequestType::ClearCachedData, p, d, control.get());
+				broadcast.registerHandler(requestType, control.get());
+				broadcast.registerHandler(DptfRequestType::ClearCachedData, control.get());
+			}
+		}
+	}
+
+	// Requests rotate through every domain of every participant
+	vector<PolicyRequest> getRequests;
+	vector<PolicyRequest> clearRequests;
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		for (UIntN d = 0; d < DomainsPerParticipant; d++)
+		{
+			getRequests.push_back(
+				PolicyRequest(0, DptfRequest(DptfRequestType::TemperatureControlGetTemperatureStatus, p, d)));
+			clearRequests.push_back(PolicyRequest(0, DptfRequest(DptfRequestType::ClearCachedData, p, d)));
+		}
+	}
+
+	size_t next = 0;
+	auto suffix = ", " + to_string(participantCount) + " participants";
+	Benchmark::printResult("dispatch (routed)" + suffix, Benchmark::run([&]() {
+		Benchmark::consume(routed.dispatch(getRequests[next++ % getRequests.size()]).isSuccessful());
+	}));
+	Benchmark::printResult("dispatch (broadcast)" + suffix, Benchmark::run([&]() {
+		Benchmark::consume(broadcast.dispatch(getRequests[next++ % getRequests.size()]).isSuccessful());
+	}));
+	Benchmark::printResult("dispatchForAllControls (routed)" + suffix, Benchmark::run([&]() {
+		routed.dispatchForAllControls(clearRequests[next++ % clearRequests.size()]);
+	}));
+	Benchmark::printResult("dispatchForAllControls (broadcast)" + suffix, Benchmark::run([&]() {
+		broadcast.dispatchForAllControls(clearRequests[next++ % clearRequests.size()]);
+	}));
+}
+
+int main(int argc, char** argv)
+{
+	vector<UIntN> participantCounts;
+	for (int arg = 1; arg < argc; arg++)
+	{
+		participantCounts.push_back((UIntN)strtoul(argv[arg], nullptr, 10));
+	}
+	if (participantCounts.empty())
+	{
+		participantCounts = {4, 16, 64, 256};
+	}
+
+	Benchmark::printHeader(
+		"Request dispatch: " + to_string(DomainsPerParticipant) + " domains per participant, "
+		+ to_string(sizeof(ControlRequestTypes) / sizeof(ControlRequestTypes[0])) + " controls per domain");
+	for (auto participantCount : participantCounts)
+	{
+		runForParticipantCount(participantCount);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#include "Benchmark.h"
+#include "XmlNode.h"
+#include "XmlWriter.h"
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+// Compares building a status page as an XmlNode tree and serializing it with toString() against writing the same
+// page straight into an XmlWriter.  The synthetic page is shaped like the participant status of a platform: every
+// participant has a few domains, each reporting a set of control and capability values.
+
+static const UIntN DomainsPerParticipant = 4;
+static const UIntN ValuesPerDomain = 16;
+
+static string valueTag(UIntN valueIndex)
+{
+	return "value_" + to_string(valueIndex);
+}
+
+static string valueData(UIntN participantIndex, UIntN domainIndex, UIntN valueIndex)
+{
+	return to_string(participantIndex * 1000 + domainIndex * 100 + valueIndex) + " mW <limit & \"bias\">";
+}
+
+static string buildStatusWithTree(UIntN participantCount)
+{
+	auto root = XmlNode::createRoot();
+	auto participants = XmlNode::createWrapperElement("participants");
+	root->addChild(XmlNode::createComment("synthetic participant status"));
+	root->addChild(participants);
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		auto participant = XmlNode::createWrapperElement("participant");
+		participant->addChild(XmlNode::createDataElement("index", to_string(p)));
+		participant->addChild(XmlNode::createDataElement("name", "TSR" + to_string(p)));
+		for (UIntN d = 0; d < DomainsPerParticipant; d++)
+		{
+			auto domain = XmlNode::createWrapperElement("domain");
+			domain->addChild(XmlNode::createDataElement("index", to_string(d)));
+			auto controls = XmlNode::createWrapperElement("controls");
+			for (UIntN v = 0; v < ValuesPerDomain; v++)
+			{
+				controls->addChild(XmlNode::createDataElement(valueTag(v), valueData(p, d, v)));
+			}
+			domain->addChild(controls);
+			participant->addChild(domain);
+		}
+		participants->addChild(participant);
+	}
+	return root->toString();
+}
+
+static string buildStatusWithWriter(UIntN participantCount)
+{
+	XmlWriter writer(participantCount * DomainsPerParticipant * ValuesPerDomain * 64);
+	writer.beginRoot();
+	writer.writeComment("synthetic participant status");
+	writer.beginElement("participants");
+	for (UIntN p = 0; p < participantCount; p++)
+	{
+		writer.beginElement("participant");
+		writer.writeDataElement("index", to_string(p));
+		writer.writeDataElement("name", "TSR" + to_string(p));
+		for (UIntN d = 0; d < DomainsPerParticipant; d++)
+		{
+			writer.beginElement("domain");
+			writer.writeDataElement("index", to_string(d));
+			writer.beginElement("controls");
+			for (UIntN v = 0; v < ValuesPerDomain; v++)
+			{
+				writer.writeDataElement(valueTag(v), valueData(p, d, v));
+			}
+			writer.endElement();
+			writer.endElement();
+		}
+		writer.endElement();
+	}
+	writer.endElement();
+	writer.endRoot();
+	return writer.release();
+}
+
+int main(int argc, char** argv)
+{
+	UIntN participantCount = (argc > 1) ? (UIntN)strtoul(argv[1], nullptr, 10) : 32;
+
+	auto treeXml = buildStatusWithTree(participantCount);
+	auto writerXml = buildStatusWithWriter(participantCount);
+	if (treeXml != writerXml)
+	{
+		fprintf(stderr, "XmlNode and XmlWriter output differ\n");
+		return EXIT_FAILURE;
+	}
+
+	Benchmark::printHeader(
+		"Participant status XML: " + to_string(participantCount) + " participants, "
+		+ to_string(treeXml.size()) + " bytes");
+	Benchmark::printResult(
+		"XmlNode tree + toString()",
+		Benchmark::run([participantCount]() { Benchmark::consume(buildStatusWithTree(participantCount).size()); }));
+	Benchmark::printResult(
+		"XmlWriter",
+		Benchmark::run([participantCount]() { Benchmark::consume(buildStatusWithWriter(participantCount).size()); }));
+	return EXIT_SUCCESS;
+}
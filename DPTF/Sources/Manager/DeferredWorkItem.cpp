@@ -22,7 +22,7 @@
 DeferredWorkItem::DeferredWorkItem(std::shared_ptr<WorkItemInterface> workItem, const TimeSpan& timeUntilExecution)
 	: m_workItem(workItem)
 {
-	m_deferredProcessingTime = EsifTime().getTimeStamp() + timeUntilExecution;
+	m_deferredProcessingTime = EsifTime::getMonotonicTime() + timeUntilExecution;
 }
 
 DeferredWorkItem::~DeferredWorkItem(void)
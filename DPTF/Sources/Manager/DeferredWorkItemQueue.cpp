@@ -19,12 +19,21 @@
 #include "DeferredWorkItemQueue.h"
 #include "EsifMutexHelper.h"
 #include "XmlNode.h"
+#include <algorithm>
+using namespace std;
 
 DeferredWorkItemQueue::DeferredWorkItemQueue(
 	EsifSemaphore* workItemQueueSemaphore,
 	ImmediateWorkItemQueue* immediateWorkItemQueue)
 	: m_queue()
+	, m_queued()
+	, m_nextSequenceNumber(0)
 	, m_maxCount(0)
+	, m_dequeueCount(0)
+	, m_removeCount(0)
+	, m_totalWaitTime(TimeSpan::createFromMilliseconds(0))
+	, m_timerRearmCount(0)
+	, m_isTimerArmed(false)
 	, m_workItemQueueSemaphore(workItemQueueSemaphore)
 	, m_immediateQueue(immediateWorkItemQueue)
 	, m_timer(TimerCallback, this)
@@ -39,8 +48,6 @@ DeferredWorkItemQueue::~DeferredWorkItemQueue(void)
 
 void DeferredWorkItemQueue::enqueue(std::shared_ptr<DeferredWorkItem> newWorkItem)
 {
-	// FIMXE:  during round 2, need to add statistics logging
-
 	// Insert into the queue sorted based on time stamp.  The timer must be set to expire
 	// when the first item in the queue is ready to process.
 
@@ -70,11 +77,9 @@ void DeferredWorkItemQueue::makeEmtpy(void)
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 	m_timer.cancelTimer();
-	while (m_queue.empty() == false)
-	{
-		auto currentWorkItem = m_queue.front();
-		m_queue.pop_front();
-	}
+	m_isTimerArmed = false;
+	m_queue.clear();
+	m_queued.clear();
 	esifMutexHelper.unlock();
 }
 
@@ -83,7 +88,7 @@ UInt64 DeferredWorkItemQueue::getCount(void) const
 	UInt64 count;
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
-	count = m_queue.size();
+	count = m_queued.size();
 	esifMutexHelper.unlock();
 	return count;
 }
@@ -105,13 +110,14 @@ UIntN DeferredWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& matchC
 
 	UIntN numRemoved = 0;
 
-	auto it = m_queue.begin();
-	while (it != m_queue.end())
+	auto it = m_queued.begin();
+	while (it != m_queued.end())
 	{
-		if ((*it)->matches(matchCriteria) == true)
+		if (it->second->matches(matchCriteria) == true)
 		{
-			(*it)->signal();
-			it = m_queue.erase(it);
+			auto next = std::next(it);
+			removeWorkItem(it);
+			it = next;
 			numRemoved++;
 		}
 		else
@@ -120,21 +126,46 @@ UIntN DeferredWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& matchC
 		}
 	}
 
-	setTimer();
-
 	esifMutexHelper.unlock();
 
 	return numRemoved;
 }
 
+Bool DeferredWorkItemQueue::removeByUniqueId(UInt64 uniqueId, const WorkItemMatchCriteria& matchCriteria)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	Bool removed = false;
+
+	auto it = m_queued.find(uniqueId);
+	if ((it != m_queued.end()) && (it->second->matches(matchCriteria) == true))
+	{
+		removeWorkItem(it);
+		removed = true;
+	}
+
+	esifMutexHelper.unlock();
+
+	return removed;
+}
+
 std::shared_ptr<XmlNode> DeferredWorkItemQueue::getXml(void) const
 {
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
+	auto averageWaitTime =
+		(m_dequeueCount > 0) ? (m_totalWaitTime.asMilliseconds() / m_dequeueCount) : 0.0;
+
 	auto deferredQueueStastics = XmlNode::createWrapperElement("deferred_queue_statistics");
-	deferredQueueStastics->addChild(XmlNode::createDataElement("current_count", std::to_string(m_queue.size())));
+	deferredQueueStastics->addChild(XmlNode::createDataElement("current_count", std::to_string(m_queued.size())));
 	deferredQueueStastics->addChild(XmlNode::createDataElement("max_count", std::to_string(m_maxCount)));
+	deferredQueueStastics->addChild(XmlNode::createDataElement("dequeue_count", std::to_string(m_dequeueCount)));
+	deferredQueueStastics->addChild(XmlNode::createDataElement("remove_count", std::to_string(m_removeCount)));
+	deferredQueueStastics->addChild(XmlNode::createDataElement("average_wait_ms", std::to_string(averageWaitTime)));
+	deferredQueueStastics->addChild(
+		XmlNode::createDataElement("timer_rearm_count", std::to_string(m_timerRearmCount)));
 
 	esifMutexHelper.unlock();
 
@@ -148,32 +179,41 @@ std::shared_ptr<XmlNode> DeferredWorkItemQueue::getXml(void) const
 
 void DeferredWorkItemQueue::setTimer(void)
 {
-	// Set the timer to expire when the first item in the queue is ready to process
+	// Set the timer to expire when the first item in the queue is ready to process.  The timer is only moved
+	// when an item is due before it.  When items are removed it is left to expire early and the callback sets
+	// it for the next item.
 
 	if (m_queue.empty() == false)
 	{
-		auto firstWorkItem = m_queue.front();
-		auto firstWorkItemTime = firstWorkItem->getDeferredProcessingTime();
+		auto firstWorkItemTime = m_queue.front().workItem->getDeferredProcessingTime();
 
-		m_timer.startTimer(firstWorkItemTime);
+		if ((m_isTimerArmed == false) || (firstWorkItemTime < m_timer.getExpirationTime()))
+		{
+			m_timer.startTimer(firstWorkItemTime);
+			m_isTimerArmed = true;
+			m_timerRearmCount++;
+		}
 	}
 }
 
 std::shared_ptr<DeferredWorkItem> DeferredWorkItemQueue::getFirstReadyWorkItemFromQueue(void)
 {
 	std::shared_ptr<DeferredWorkItem> firstReadyWorkItem;
+	discardRemovedEntries();
 	if (m_queue.empty() == false)
 	{
-		auto currentTime = EsifTime().getTimeStamp();
-		firstReadyWorkItem = m_queue.front();
+		auto currentTime = EsifTime::getMonotonicTime();
+		auto firstWorkItemTime = m_queue.front().workItem->getDeferredProcessingTime();
 
-		if (firstReadyWorkItem->getDeferredProcessingTime() <= currentTime)
+		if (firstWorkItemTime <= currentTime)
 		{
-			m_queue.pop_front();
-		}
-		else
-		{
-			firstReadyWorkItem = nullptr;
+			pop_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
+			firstReadyWorkItem = m_queue.back().workItem;
+			m_queue.pop_back();
+			m_queued.erase(firstReadyWorkItem->getUniqueId());
+
+			m_totalWaitTime = m_totalWaitTime + (currentTime - firstWorkItemTime);
+			m_dequeueCount++;
 		}
 	}
 	return firstReadyWorkItem;
@@ -181,60 +221,110 @@ std::shared_ptr<DeferredWorkItem> DeferredWorkItemQueue::getFirstReadyWorkItemFr
 
 void DeferredWorkItemQueue::insertSortedByDeferredProcessingTime(std::shared_ptr<DeferredWorkItem> newWorkItem)
 {
-	auto it = m_queue.begin();
-	for (; it != m_queue.end(); it++)
+	QueueEntry newEntry = {newWorkItem, m_nextSequenceNumber++};
+	m_queue.push_back(newEntry);
+	push_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
+	m_queued[newWorkItem->getUniqueId()] = newWorkItem;
+}
+
+void DeferredWorkItemQueue::removeWorkItem(
+	std::unordered_map<UInt64, std::shared_ptr<DeferredWorkItem>>::iterator it)
+{
+	it->second->signal();
+	m_queued.erase(it);
+	m_removeCount++;
+	discardRemovedEntries();
+}
+
+Bool DeferredWorkItemQueue::isQueued(const QueueEntry& entry) const
+{
+	auto it = m_queued.find(entry.workItem->getUniqueId());
+	return ((it != m_queued.end()) && (it->second == entry.workItem));
+}
+
+void DeferredWorkItemQueue::discardRemovedEntries(void)
+{
+	// Rebuild the heap once removed entries outnumber the queued ones, which keeps the cost per removal constant
+	if ((m_queue.size() / 2) > m_queued.size())
 	{
-		auto currentWorkItem = *it;
-		if (currentWorkItem->getDeferredProcessingTime() > newWorkItem->getDeferredProcessingTime())
-		{
-			m_queue.insert(it, newWorkItem);
-			break;
-		}
+		m_queue.erase(
+			remove_if(m_queue.begin(), m_queue.end(), [this](const QueueEntry& entry) { return !isQueued(entry); }),
+			m_queue.end());
+		make_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
 	}
 
-	if (it == m_queue.end())
+	while ((m_queue.empty() == false) && (isQueued(m_queue.front()) == false))
 	{
-		m_queue.push_back(newWorkItem);
+		pop_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
+		m_queue.pop_back();
 	}
 }
 
 void DeferredWorkItemQueue::updateMaxCount()
 {
-	if (m_queue.size() > m_maxCount)
+	if (m_queued.size() > m_maxCount)
+	{
+		m_maxCount = m_queued.size();
+	}
+}
+
+Bool DeferredWorkItemQueue::ProcessesAfter::operator()(const QueueEntry& lhs, const QueueEntry& rhs) const
+{
+	auto& lhsTime = lhs.workItem->getDeferredProcessingTime();
+	auto& rhsTime = rhs.workItem->getDeferredProcessingTime();
+	if (lhsTime != rhsTime)
 	{
-		m_maxCount = m_queue.size();
+		return (lhsTime > rhsTime);
 	}
+	return (lhs.sequenceNumber > rhs.sequenceNumber);
 }
 
 //
-// The following two functions get called when the timer expires.  The semaphore is signaled so the
-// work item thread will check the queue for work items that are ready to process.
-// The timer starts again when the work item thread dequeues the first work item.
+// The following two functions get called when the timer expires.  All of the ready work items are moved
+// to the immediate queue together so the work item thread is woken up once per expiration.
+// The timer is started again for the next work item that is not ready yet.
 
 void DeferredWorkItemQueue::timerCallback(void)
 {
 	// The WorkItemQueueManager is not locked while this executes.
-	// Move the ready items to the immediate queue and signal the semaphore.
 
-	auto readyWorkItem = dequeue();
+	std::vector<std::shared_ptr<ImmediateWorkItem>> readyWorkItems;
+
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
+	m_isTimerArmed = false;
+
+	auto readyWorkItem = getFirstReadyWorkItemFromQueue();
 	while (readyWorkItem != nullptr)
 	{
 		try
 		{
-			auto immediateWorkItem = std::make_shared<ImmediateWorkItem>(readyWorkItem, 0);
-			m_immediateQueue->enqueue(immediateWorkItem);
+			readyWorkItems.push_back(std::make_shared<ImmediateWorkItem>(readyWorkItem, 0));
 		}
 		catch (...)
 		{
 		}
-		readyWorkItem = dequeue();
+		readyWorkItem = getFirstReadyWorkItemFromQueue();
+	}
+
+	try
+	{
+		m_immediateQueue->enqueue(readyWorkItems);
+	}
+	catch (...)
+	{
+	}
+
+	try
+	{
+		setTimer();
+	}
+	catch (...)
+	{
 	}
 
 	esifMutexHelper.unlock();
-	m_workItemQueueSemaphore->signal();
 }
 
 void TimerCallback(void* context_ptr)
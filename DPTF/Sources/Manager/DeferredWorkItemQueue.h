@@ -26,6 +26,7 @@
 #include "EsifTime.h"
 #include "EsifTimer.h"
 #include "ImmediateWorkItemQueue.h"
+#include <unordered_map>
 
 class DeferredWorkItemQueue : public WorkItemQueueInterface
 {
@@ -43,13 +44,38 @@ public:
 	virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override final;
 	virtual std::shared_ptr<XmlNode> getXml(void) const override final;
 
+	// Removes the work item with the given unique id without searching the queue.  Returns false if it is not
+	// queued or does not match the criteria.
+	Bool removeByUniqueId(UInt64 uniqueId, const WorkItemMatchCriteria& matchCriteria);
+
 private:
 	// hide the copy constructor and assignment operator.
 	DeferredWorkItemQueue(const DeferredWorkItemQueue& rhs);
 	DeferredWorkItemQueue& operator=(const DeferredWorkItemQueue& rhs);
 
-	std::list<std::shared_ptr<DeferredWorkItem>> m_queue;
+	struct QueueEntry
+	{
+		std::shared_ptr<DeferredWorkItem> workItem;
+		UInt64 sequenceNumber;
+	};
+
+	// Heap ordering: the earliest processing time is at the front and equal times are processed in insertion order
+	struct ProcessesAfter
+	{
+		Bool operator()(const QueueEntry& lhs, const QueueEntry& rhs) const;
+	};
+
+	// Removed work items are only dropped from m_queued.  Their heap entries are discarded when they reach the
+	// front or when they make up most of the heap, so removing a work item never searches or rebuilds the heap.
+	std::vector<QueueEntry> m_queue; // binary heap ordered by ProcessesAfter
+	std::unordered_map<UInt64, std::shared_ptr<DeferredWorkItem>> m_queued; // work items still queued by unique id
+	UInt64 m_nextSequenceNumber;
 	UInt64 m_maxCount; // stores the maximum number of items in the queue at any one time
+	UInt64 m_dequeueCount;
+	UInt64 m_removeCount;
+	TimeSpan m_totalWaitTime; // time between the processing time and dequeue for all dequeued work items
+	UInt64 m_timerRearmCount;
+	Bool m_isTimerArmed; // cleared when the timer fires or is cancelled
 	mutable EsifMutex m_mutex;
 	EsifSemaphore* m_workItemQueueSemaphore;
 	ImmediateWorkItemQueue* m_immediateQueue;
@@ -58,6 +84,9 @@ private:
 	void setTimer(void);
 	std::shared_ptr<DeferredWorkItem> getFirstReadyWorkItemFromQueue(void);
 	void insertSortedByDeferredProcessingTime(std::shared_ptr<DeferredWorkItem> newWorkItem);
+	void removeWorkItem(std::unordered_map<UInt64, std::shared_ptr<DeferredWorkItem>>::iterator it);
+	Bool isQueued(const QueueEntry& entry) const;
+	void discardRemovedEntries(void);
 	void updateMaxCount(void);
 
 	// The timer will call a 'C' function which will need to forward the call to our private
@@ -66,6 +66,8 @@ Domain::Domain(DptfManagerInterface* dptfManager)
 	, m_rfProfileCapabilities(nullptr)
 	, m_rfProfileData(nullptr)
 	, m_utilizationStatus(nullptr)
+	, m_cachedCategories(DomainCachedDataCategory::None)
+	, m_cacheStatistics()
 {
 }
 
@@ -165,20 +167,31 @@ std::string Domain::getDomainName(void) const
 void Domain::clearDomainCachedData(void)
 {
 	m_dptfManager->getDptfStatus()->clearCache();
-	clearDomainCachedDataCoreControl();
-	clearDomainCachedDataDisplayControl();
-	clearDomainCachedDataPerformanceControl();
-	clearDomainCachedDataPowerControl();
-	clearDomainCachedDataPowerStatus();
-	clearDomainCachedDataSystemPowerControl();
-	clearDomainCachedDataPriority();
-	clearDomainCachedDataRfProfileControl();
-	clearDomainCachedDataRfProfileStatus();
-	clearDomainCachedDataUtilizationStatus();
-	clearDomainCachedDataPlatformPowerStatus();
+	invalidateCachedData(DomainCachedDataCategory::All);
 	clearDomainCachedRequestData();
 }
 
+void Domain::invalidateCachedData(DomainCachedDataCategory::Mask categories)
+{
+	DomainCachedDataCategory::Mask filledCategories = m_cachedCategories & categories;
+	for (UIntN category = 0; (filledCategories != 0) && (category < DomainCachedDataCategory::Max); ++category)
+	{
+		auto categoryType = (DomainCachedDataCategory::Type)category;
+		if ((filledCategories & DomainCachedDataCategory::toMask(categoryType)) != 0)
+		{
+			clearCachedDataCategory(categoryType);
+			m_cacheStatistics.countInvalidation(DomainCachedDataCategory::getControlFactoryType(categoryType));
+			filledCategories &= ~DomainCachedDataCategory::toMask(categoryType);
+		}
+	}
+	m_cachedCategories &= ~categories;
+}
+
+void Domain::invalidateCachedData(DomainCachedDataCategory::Type category)
+{
+	invalidateCachedData(DomainCachedDataCategory::toMask(category));
+}
+
 void Domain::clearDomainCachedRequestData(void)
 {
 	DptfRequest clearCachedDataRequest(DptfRequestType::ClearCachedData, m_participantIndex, m_domainIndex);
@@ -211,6 +224,14 @@ std::shared_ptr<XmlNode> Domain::getDiagnosticsAsXml() const
 	return m_theRealParticipant->getDiagnosticsAsXml(m_domainIndex);
 }
 
+std::shared_ptr<XmlNode> Domain::getCachedDataStatisticsXml() const
+{
+	auto domainRoot = XmlNode::createWrapperElement("domain");
+	domainRoot->addChild(XmlNode::createDataElement("domain_name", getDomainName()));
+	domainRoot->addChild(m_cacheStatistics.getXml());
+	return domainRoot;
+}
+
 //
 // The following macro (FILL_CACHE_AND_RETURN) is in place to remove this code many times:
 //
@@ -221,13 +242,20 @@ std::shared_ptr<XmlNode> Domain::getDiagnosticsAsXml() const
 //}
 //
 // return *m_activeControlStaticCaps;
+//
+// It also records which category of cached data is now filled and counts the cache hit/miss.
 
-#define FILL_CACHE_AND_RETURN(mv, ct, fn)                                                                              \
+#define FILL_CACHE_AND_RETURN(mv, ct, fn, cat)                                                                         \
 	if (mv == nullptr)                                                                                                 \
 	{                                                                                                                  \
+		countCacheMiss(DomainCachedDataCategory::cat);                                                                 \
 		ct var = m_theRealParticipant->fn(m_participantIndex, m_domainIndex);                                          \
 		mv = new ct(var);                                                                                              \
 	}                                                                                                                  \
+	else                                                                                                               \
+	{                                                                                                                  \
+		countCacheHit(DomainCachedDataCategory::cat);                                                                  \
+	}                                                                                                                  \
 	return *mv;
 
 Percentage Domain::getUtilizationThreshold()
@@ -267,22 +295,25 @@ void Domain::setPowerShareEffectiveBias(UInt32 powerShareEffectiveBias)
 
 CoreControlStaticCaps Domain::getCoreControlStaticCaps(void)
 {
-	FILL_CACHE_AND_RETURN(m_coreControlStaticCaps, CoreControlStaticCaps, getCoreControlStaticCaps);
+	FILL_CACHE_AND_RETURN(
+		m_coreControlStaticCaps, CoreControlStaticCaps, getCoreControlStaticCaps, CoreControlCapabilities);
 }
 
 CoreControlDynamicCaps Domain::getCoreControlDynamicCaps(void)
 {
-	FILL_CACHE_AND_RETURN(m_coreControlDynamicCaps, CoreControlDynamicCaps, getCoreControlDynamicCaps);
+	FILL_CACHE_AND_RETURN(
+		m_coreControlDynamicCaps, CoreControlDynamicCaps, getCoreControlDynamicCaps, CoreControlCapabilities);
 }
 
 CoreControlLpoPreference Domain::getCoreControlLpoPreference(void)
 {
-	FILL_CACHE_AND_RETURN(m_coreControlLpoPreference, CoreControlLpoPreference, getCoreControlLpoPreference);
+	FILL_CACHE_AND_RETURN(
+		m_coreControlLpoPreference, CoreControlLpoPreference, getCoreControlLpoPreference, CoreControlStatus);
 }
 
 CoreControlStatus Domain::getCoreControlStatus(void)
 {
-	FILL_CACHE_AND_RETURN(m_coreControlStatus, CoreControlStatus, getCoreControlStatus);
+	FILL_CACHE_AND_RETURN(m_coreControlStatus, CoreControlStatus, getCoreControlStatus, CoreControlStatus);
 }
 
 void Domain::setActiveCoreControl(UIntN policyIndex, const CoreControlStatus& coreControlStatus)
@@ -309,14 +340,18 @@ void Domain::setActiveCoreControl(UIntN policyIndex, const CoreControlStatus& co
 	if (shouldSetControlStatus)
 	{
 		m_theRealParticipant->setActiveCoreControl(m_participantIndex, m_domainIndex, newControlStatus);
-		clearDomainCachedDataCoreControl();
+		invalidateCachedData(DomainCachedDataCategory::CoreControlStatus);
 	}
 	coreControlArbitrator->commitPolicyRequest(policyIndex, coreControlStatus);
 }
 
 DisplayControlDynamicCaps Domain::getDisplayControlDynamicCaps(void)
 {
-	FILL_CACHE_AND_RETURN(m_displayControlDynamicCaps, DisplayControlDynamicCaps, getDisplayControlDynamicCaps);
+	FILL_CACHE_AND_RETURN(
+		m_displayControlDynamicCaps,
+		DisplayControlDynamicCaps,
+		getDisplayControlDynamicCaps,
+		DisplayControlCapabilities);
 }
 
 UIntN Domain::getUserPreferredDisplayIndex(void)
@@ -336,7 +371,7 @@ Bool Domain::isUserPreferredIndexModified()
 
 DisplayControlStatus Domain::getDisplayControlStatus(void)
 {
-	FILL_CACHE_AND_RETURN(m_displayControlStatus, DisplayControlStatus, getDisplayControlStatus);
+	FILL_CACHE_AND_RETURN(m_displayControlStatus, DisplayControlStatus, getDisplayControlStatus, DisplayControlStatus);
 }
 
 UIntN Domain::getSoftBrightnessIndex(void)
@@ -346,7 +381,7 @@ UIntN Domain::getSoftBrightnessIndex(void)
 
 DisplayControlSet Domain::getDisplayControlSet(void)
 {
-	FILL_CACHE_AND_RETURN(m_displayControlSet, DisplayControlSet, getDisplayControlSet);
+	FILL_CACHE_AND_RETURN(m_displayControlSet, DisplayControlSet, getDisplayControlSet, DisplayControlCapabilities);
 }
 
 void Domain::setDisplayControl(UIntN policyIndex, UIntN displayControlIndex)
@@ -355,7 +390,7 @@ void Domain::setDisplayControl(UIntN policyIndex, UIntN displayControlIndex)
 	UIntN arbitratedDisplayControlIndex = displayControlArbitrator->arbitrate(policyIndex, displayControlIndex);
 	// always set even if arbitrated value has not changed
 	m_theRealParticipant->setDisplayControl(m_participantIndex, m_domainIndex, arbitratedDisplayControlIndex);
-	clearDomainCachedDataDisplayControl();
+	invalidateCachedData(DomainCachedDataCategory::DisplayControlStatus);
 	displayControlArbitrator->commitPolicyRequest(policyIndex, displayControlIndex);
 }
 
@@ -398,7 +433,9 @@ void Domain::setDisplayControlDynamicCaps(UIntN policyIndex, DisplayControlDynam
 	if (shouldSetDisplayCapabilities)
 	{
 		m_theRealParticipant->setDisplayControlDynamicCaps(m_participantIndex, m_domainIndex, newCaps);
-		clearDomainCachedDataDisplayControl();
+		invalidateCachedData(
+			DomainCachedDataCategory::toMask(DomainCachedDataCategory::DisplayControlCapabilities)
+			| DomainCachedDataCategory::toMask(DomainCachedDataCategory::DisplayControlStatus));
 	}
 	arbitrator->commitPolicyRequest(policyIndex, newCapabilities);
 }
@@ -517,23 +554,31 @@ void Domain::setDCPeakPower(UIntN policyIndex, const Power& dcPeakPower)
 PerformanceControlStaticCaps Domain::getPerformanceControlStaticCaps(void)
 {
 	FILL_CACHE_AND_RETURN(
-		m_performanceControlStaticCaps, PerformanceControlStaticCaps, getPerformanceControlStaticCaps);
+		m_performanceControlStaticCaps,
+		PerformanceControlStaticCaps,
+		getPerformanceControlStaticCaps,
+		PerformanceControlCapabilities);
 }
 
 PerformanceControlDynamicCaps Domain::getPerformanceControlDynamicCaps(void)
 {
 	FILL_CACHE_AND_RETURN(
-		m_performanceControlDynamicCaps, PerformanceControlDynamicCaps, getPerformanceControlDynamicCaps);
+		m_performanceControlDynamicCaps,
+		PerformanceControlDynamicCaps,
+		getPerformanceControlDynamicCaps,
+		PerformanceControlCapabilities);
 }
 
 PerformanceControlStatus Domain::getPerformanceControlStatus(void)
 {
-	FILL_CACHE_AND_RETURN(m_performanceControlStatus, PerformanceControlStatus, getPerformanceControlStatus);
+	FILL_CACHE_AND_RETURN(
+		m_performanceControlStatus, PerformanceControlStatus, getPerformanceControlStatus, PerformanceControlStatus);
 }
 
 PerformanceControlSet Domain::getPerformanceControlSet(void)
 {
-	FILL_CACHE_AND_RETURN(m_performanceControlSet, PerformanceControlSet, getPerformanceControlSet);
+	FILL_CACHE_AND_RETURN(
+		m_performanceControlSet, PerformanceControlSet, getPerformanceControlSet, PerformanceControlCapabilities);
 }
 
 void Domain::setPerformanceControl(UIntN policyIndex, UIntN performanceControlIndex)
@@ -560,7 +605,7 @@ void Domain::setPerformanceControl(UIntN policyIndex, UIntN performanceControlIn
 	if (shouldSetPerformanceControlIndex)
 	{
 		m_theRealParticipant->setPerformanceControl(m_participantIndex, m_domainIndex, newIndex);
-		clearDomainCachedDataPerformanceControl();
+		invalidateCachedData(DomainCachedDataCategory::PerformanceControlStatus);
 	}
 	performanceControlArbitrator->commitPolicyRequest(policyIndex, performanceControlIndex);
 }
@@ -590,7 +635,9 @@ void Domain::setPerformanceControlDynamicCaps(UIntN policyIndex, PerformanceCont
 	if (shouldSetPerformanceCapabilities)
 	{
 		m_theRealParticipant->setPerformanceControlDynamicCaps(m_participantIndex, m_domainIndex, newCaps);
-		clearDomainCachedDataPerformanceControl();
+		invalidateCachedData(
+			DomainCachedDataCategory::toMask(DomainCachedDataCategory::PerformanceControlCapabilities)
+			| DomainCachedDataCategory::toMask(DomainCachedDataCategory::PerformanceControlStatus));
 	}
 	arbitrator->commitPolicyRequest(policyIndex, newCapabilities);
 }
@@ -608,7 +655,11 @@ void Domain::setPerformanceCapsLock(UIntN policyIndex, Bool lock)
 
 PowerControlDynamicCapsSet Domain::getPowerControlDynamicCapsSet(void)
 {
-	FILL_CACHE_AND_RETURN(m_powerControlDynamicCapsSet, PowerControlDynamicCapsSet, getPowerControlDynamicCapsSet);
+	FILL_CACHE_AND_RETURN(
+		m_powerControlDynamicCapsSet,
+		PowerControlDynamicCapsSet,
+		getPowerControlDynamicCapsSet,
+		PowerControlCapabilities);
 }
 
 void Domain::setPowerControlDynamicCapsSet(UIntN policyIndex, PowerControlDynamicCapsSet capsSet)
@@ -636,7 +687,9 @@ void Domain::setPowerControlDynamicCapsSet(UIntN policyIndex, PowerControlDynami
 	if (shouldSetPowerControlCapabilities)
 	{
 		m_theRealParticipant->setPowerControlDynamicCapsSet(m_participantIndex, m_domainIndex, newCaps);
-		clearDomainCachedDataPowerControl();
+		invalidateCachedData(
+			DomainCachedDataCategory::toMask(DomainCachedDataCategory::PowerControlCapabilities)
+			| DomainCachedDataCategory::toMask(DomainCachedDataCategory::PowerControlLimits));
 	}
 	arbitrator->commitPolicyRequest(policyIndex, capsSet);
 }
@@ -646,9 +699,14 @@ Bool Domain::isPowerLimitEnabled(PowerControlType::Type controlType)
 	auto enabled = m_powerLimitEnabled.find(controlType);
 	if (enabled == m_powerLimitEnabled.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::PowerControlLimits);
 		m_powerLimitEnabled[controlType] =
 			m_theRealParticipant->isPowerLimitEnabled(m_participantIndex, m_domainIndex, controlType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::PowerControlLimits);
+	}
 	return m_powerLimitEnabled.at(controlType);
 }
 
@@ -657,8 +715,13 @@ Power Domain::getPowerLimit(PowerControlType::Type controlType)
 	auto limit = m_powerLimit.find(controlType);
 	if (limit == m_powerLimit.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::PowerControlLimits);
 		m_powerLimit[controlType] = m_theRealParticipant->getPowerLimit(m_participantIndex, m_domainIndex, controlType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::PowerControlLimits);
+	}
 	return m_powerLimit.at(controlType);
 }
 
@@ -701,7 +764,7 @@ void Domain::setPowerLimit(UIntN policyIndex, PowerControlType::Type controlType
 	if (shouldSetPowerLimit)
 	{
 		m_theRealParticipant->setPowerLimit(m_participantIndex, m_domainIndex, controlType, newPowerLimit);
-		clearDomainCachedDataPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::PowerControlLimits);
 	}
 	powerControlArbitrator->commitPolicyRequest(policyIndex, controlType, powerLimit);
 }
@@ -716,9 +779,14 @@ TimeSpan Domain::getPowerLimitTimeWindow(PowerControlType::Type controlType)
 	auto limit = m_powerLimitTimeWindow.find(controlType);
 	if (limit == m_powerLimitTimeWindow.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::PowerControlLimits);
 		m_powerLimitTimeWindow[controlType] =
 			m_theRealParticipant->getPowerLimitTimeWindow(m_participantIndex, m_domainIndex, controlType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::PowerControlLimits);
+	}
 	return m_powerLimitTimeWindow.at(controlType);
 }
 
@@ -746,7 +814,7 @@ void Domain::setPowerLimitTimeWindow(UIntN policyIndex, PowerControlType::Type c
 	if (shouldSetTimeWindow)
 	{
 		m_theRealParticipant->setPowerLimitTimeWindow(m_participantIndex, m_domainIndex, controlType, newTimeWindow);
-		clearDomainCachedDataPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::PowerControlLimits);
 	}
 	powerControlArbitrator->commitPolicyRequest(policyIndex, controlType, timeWindow);
 }
@@ -765,9 +833,14 @@ Percentage Domain::getPowerLimitDutyCycle(PowerControlType::Type controlType)
 	auto limit = m_powerLimitDutyCycle.find(controlType);
 	if (limit == m_powerLimitDutyCycle.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::PowerControlLimits);
 		m_powerLimitDutyCycle[controlType] =
 			m_theRealParticipant->getPowerLimitDutyCycle(m_participantIndex, m_domainIndex, controlType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::PowerControlLimits);
+	}
 	return m_powerLimitDutyCycle.at(controlType);
 }
 
@@ -795,7 +868,7 @@ void Domain::setPowerLimitDutyCycle(UIntN policyIndex, PowerControlType::Type co
 	if (shouldSetDutyCycle)
 	{
 		m_theRealParticipant->setPowerLimitDutyCycle(m_participantIndex, m_domainIndex, controlType, newDutyCycle);
-		clearDomainCachedDataPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::PowerControlLimits);
 	}
 	powerControlArbitrator->commitPolicyRequest(policyIndex, controlType, dutyCycle);
 }
@@ -822,7 +895,7 @@ TimeSpan Domain::getPowerSharePowerLimitTimeWindow()
 
 Bool Domain::isPowerShareControl()
 {
-	FILL_CACHE_AND_RETURN(m_isPowerShareControl, Bool, isPowerShareControl);
+	FILL_CACHE_AND_RETURN(m_isPowerShareControl, Bool, isPowerShareControl, PowerControlCapabilities);
 }
 
 double Domain::getPidKpTerm()
@@ -893,13 +966,13 @@ void Domain::removePowerLimitPolicyRequest(UIntN policyIndex, PowerControlType::
 	if (currLimit != newLimit)
 	{
 		m_theRealParticipant->setPowerLimit(m_participantIndex, m_domainIndex, controlType, newLimit);
-		clearDomainCachedDataPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::PowerControlLimits);
 	}
 }
 
 PowerStatus Domain::getPowerStatus(void)
 {
-	FILL_CACHE_AND_RETURN(m_powerStatus, PowerStatus, getPowerStatus);
+	FILL_CACHE_AND_RETURN(m_powerStatus, PowerStatus, getPowerStatus, PowerStatus);
 }
 
 Power Domain::getAveragePower(const PowerControlDynamicCaps& capabilities)
@@ -917,9 +990,14 @@ Bool Domain::isSystemPowerLimitEnabled(PsysPowerLimitType::Type limitType)
 	auto enabled = m_systemPowerLimitEnabled.find(limitType);
 	if (enabled == m_systemPowerLimitEnabled.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::SystemPowerControlLimits);
 		m_systemPowerLimitEnabled[limitType] =
 			m_theRealParticipant->isSystemPowerLimitEnabled(m_participantIndex, m_domainIndex, limitType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::SystemPowerControlLimits);
+	}
 	return m_systemPowerLimitEnabled.at(limitType);
 }
 
@@ -928,9 +1006,14 @@ Power Domain::getSystemPowerLimit(PsysPowerLimitType::Type limitType)
 	auto limit = m_systemPowerLimit.find(limitType);
 	if (limit == m_systemPowerLimit.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::SystemPowerControlLimits);
 		m_systemPowerLimit[limitType] =
 			m_theRealParticipant->getSystemPowerLimit(m_participantIndex, m_domainIndex, limitType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::SystemPowerControlLimits);
+	}
 	return m_systemPowerLimit.at(limitType);
 }
 
@@ -958,7 +1041,7 @@ void Domain::setSystemPowerLimit(UIntN policyIndex, PsysPowerLimitType::Type lim
 	if (shouldSetPowerLimit)
 	{
 		m_theRealParticipant->setSystemPowerLimit(m_participantIndex, m_domainIndex, limitType, newSystemPowerLimit);
-		clearDomainCachedDataSystemPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::SystemPowerControlLimits);
 	}
 	systemPowerControlArbitrator->commitPolicyRequest(policyIndex, limitType, powerLimit);
 }
@@ -968,9 +1051,14 @@ TimeSpan Domain::getSystemPowerLimitTimeWindow(PsysPowerLimitType::Type limitTyp
 	auto timeWindow = m_systemPowerLimitTimeWindow.find(limitType);
 	if (timeWindow == m_systemPowerLimitTimeWindow.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::SystemPowerControlLimits);
 		m_systemPowerLimitTimeWindow[limitType] =
 			m_theRealParticipant->getSystemPowerLimitTimeWindow(m_participantIndex, m_domainIndex, limitType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::SystemPowerControlLimits);
+	}
 	return m_systemPowerLimitTimeWindow.at(limitType);
 }
 
@@ -1002,7 +1090,7 @@ void Domain::setSystemPowerLimitTimeWindow(
 	{
 		m_theRealParticipant->setSystemPowerLimitTimeWindow(
 			m_participantIndex, m_domainIndex, limitType, newTimeWindow);
-		clearDomainCachedDataSystemPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::SystemPowerControlLimits);
 	}
 	SystemPowerControlArbitrator->commitPolicyRequest(policyIndex, limitType, timeWindow);
 }
@@ -1012,9 +1100,14 @@ Percentage Domain::getSystemPowerLimitDutyCycle(PsysPowerLimitType::Type limitTy
 	auto dutyCycle = m_systemPowerLimitDutyCycle.find(limitType);
 	if (dutyCycle == m_systemPowerLimitDutyCycle.end())
 	{
+		countCacheMiss(DomainCachedDataCategory::SystemPowerControlLimits);
 		m_systemPowerLimitDutyCycle[limitType] =
 			m_theRealParticipant->getSystemPowerLimitDutyCycle(m_participantIndex, m_domainIndex, limitType);
 	}
+	else
+	{
+		countCacheHit(DomainCachedDataCategory::SystemPowerControlLimits);
+	}
 	return m_systemPowerLimitDutyCycle.at(limitType);
 }
 
@@ -1045,7 +1138,7 @@ void Domain::setSystemPowerLimitDutyCycle(
 	if (shouldSetDutyCycle)
 	{
 		m_theRealParticipant->setSystemPowerLimitDutyCycle(m_participantIndex, m_domainIndex, limitType, newDutyCycle);
-		clearDomainCachedDataSystemPowerControl();
+		invalidateCachedData(DomainCachedDataCategory::SystemPowerControlLimits);
 	}
 	systemPowerControlArbitrator->commitPolicyRequest(policyIndex, limitType, dutyCycle);
 }
@@ -1057,42 +1150,44 @@ void Domain::setPowerSharePolicyPower(const Power& powerSharePolicyPower)
 
 Power Domain::getPlatformRestOfPower(void)
 {
-	FILL_CACHE_AND_RETURN(m_platformRestOfPower, Power, getPlatformRestOfPower);
+	FILL_CACHE_AND_RETURN(m_platformRestOfPower, Power, getPlatformRestOfPower, PlatformRestOfPower);
 }
 
 Power Domain::getAdapterPowerRating(void)
 {
-	FILL_CACHE_AND_RETURN(m_adapterRating, Power, getAdapterPowerRating);
+	FILL_CACHE_AND_RETURN(m_adapterRating, Power, getAdapterPowerRating, PlatformPowerCapabilities);
 }
 
 PlatformPowerSource::Type Domain::getPlatformPowerSource(void)
 {
-	FILL_CACHE_AND_RETURN(m_platformPowerSource, PlatformPowerSource::Type, getPlatformPowerSource);
+	FILL_CACHE_AND_RETURN(
+		m_platformPowerSource, PlatformPowerSource::Type, getPlatformPowerSource, PlatformPowerCapabilities);
 }
 
 UInt32 Domain::getACNominalVoltage(void)
 {
-	FILL_CACHE_AND_RETURN(m_acNominalVoltage, UInt32, getACNominalVoltage);
+	FILL_CACHE_AND_RETURN(m_acNominalVoltage, UInt32, getACNominalVoltage, PlatformPowerCapabilities);
 }
 
 UInt32 Domain::getACOperationalCurrent(void)
 {
-	FILL_CACHE_AND_RETURN(m_acOperationalCurrent, UInt32, getACOperationalCurrent);
+	FILL_CACHE_AND_RETURN(m_acOperationalCurrent, UInt32, getACOperationalCurrent, PlatformPowerCapabilities);
 }
 
 Percentage Domain::getAC1msPercentageOverload(void)
 {
-	FILL_CACHE_AND_RETURN(m_ac1msPercentageOverload, Percentage, getAC1msPercentageOverload);
+	FILL_CACHE_AND_RETURN(m_ac1msPercentageOverload, Percentage, getAC1msPercentageOverload, PlatformPowerCapabilities);
 }
 
 Percentage Domain::getAC2msPercentageOverload(void)
 {
-	FILL_CACHE_AND_RETURN(m_ac2msPercentageOverload, Percentage, getAC2msPercentageOverload);
+	FILL_CACHE_AND_RETURN(m_ac2msPercentageOverload, Percentage, getAC2msPercentageOverload, PlatformPowerCapabilities);
 }
 
 Percentage Domain::getAC10msPercentageOverload(void)
 {
-	FILL_CACHE_AND_RETURN(m_ac10msPercentageOverload, Percentage, getAC10msPercentageOverload);
+	FILL_CACHE_AND_RETURN(
+		m_ac10msPercentageOverload, Percentage, getAC10msPercentageOverload, PlatformPowerCapabilities);
 }
 
 void Domain::notifyForProchotDeassertion(void)
@@ -1102,12 +1197,13 @@ void Domain::notifyForProchotDeassertion(void)
 
 DomainPriority Domain::getDomainPriority(void)
 {
-	FILL_CACHE_AND_RETURN(m_domainPriority, DomainPriority, getDomainPriority);
+	FILL_CACHE_AND_RETURN(m_domainPriority, DomainPriority, getDomainPriority, Priority);
 }
 
 RfProfileCapabilities Domain::getRfProfileCapabilities(void)
 {
-	FILL_CACHE_AND_RETURN(m_rfProfileCapabilities, RfProfileCapabilities, getRfProfileCapabilities);
+	FILL_CACHE_AND_RETURN(
+		m_rfProfileCapabilities, RfProfileCapabilities, getRfProfileCapabilities, RfProfileCapabilities);
 }
 
 void Domain::setRfProfileCenterFrequency(UIntN policyIndex, const Frequency& centerFrequency)
@@ -1115,8 +1211,9 @@ void Domain::setRfProfileCenterFrequency(UIntN policyIndex, const Frequency& cen
 	// No arbitration.  Last caller wins.
 
 	m_theRealParticipant->setRfProfileCenterFrequency(m_participantIndex, m_domainIndex, centerFrequency);
-	clearDomainCachedDataRfProfileControl();
-	clearDomainCachedDataRfProfileStatus();
+	invalidateCachedData(
+		DomainCachedDataCategory::toMask(DomainCachedDataCategory::RfProfileCapabilities)
+		| DomainCachedDataCategory::toMask(DomainCachedDataCategory::RfProfileStatus));
 }
 
 Percentage Domain::getSscBaselineSpreadValue()
@@ -1136,88 +1233,96 @@ Percentage Domain::getSscBaselineGuardBand()
 
 RfProfileDataSet Domain::getRfProfileDataSet(void)
 {
-	FILL_CACHE_AND_RETURN(m_rfProfileData, RfProfileDataSet, getRfProfileDataSet);
+	FILL_CACHE_AND_RETURN(m_rfProfileData, RfProfileDataSet, getRfProfileDataSet, RfProfileStatus);
 }
 
 UtilizationStatus Domain::getUtilizationStatus(void)
 {
-	FILL_CACHE_AND_RETURN(m_utilizationStatus, UtilizationStatus, getUtilizationStatus);
-}
-
-void Domain::clearDomainCachedDataCoreControl()
-{
-	DELETE_MEMORY_TC(m_coreControlStaticCaps);
-	DELETE_MEMORY_TC(m_coreControlDynamicCaps);
-	DELETE_MEMORY_TC(m_coreControlLpoPreference);
-	DELETE_MEMORY_TC(m_coreControlStatus);
+	FILL_CACHE_AND_RETURN(m_utilizationStatus, UtilizationStatus, getUtilizationStatus, UtilizationStatus);
 }
 
-void Domain::clearDomainCachedDataDisplayControl()
+void Domain::countCacheHit(DomainCachedDataCategory::Type category)
 {
-	DELETE_MEMORY_TC(m_displayControlDynamicCaps);
-	DELETE_MEMORY_TC(m_displayControlStatus);
-	DELETE_MEMORY_TC(m_displayControlSet);
+	m_cacheStatistics.countHit(DomainCachedDataCategory::getControlFactoryType(category));
 }
 
-void Domain::clearDomainCachedDataPerformanceControl()
+void Domain::countCacheMiss(DomainCachedDataCategory::Type category)
 {
-	DELETE_MEMORY_TC(m_performanceControlStaticCaps);
-	DELETE_MEMORY_TC(m_performanceControlDynamicCaps);
-	DELETE_MEMORY_TC(m_performanceControlStatus);
-	DELETE_MEMORY_TC(m_performanceControlSet);
+	m_cachedCategories |= DomainCachedDataCategory::toMask(category);
+	m_cacheStatistics.countMiss(DomainCachedDataCategory::getControlFactoryType(category));
 }
 
-void Domain::clearDomainCachedDataPowerControl()
+void Domain::clearCachedDataCategory(DomainCachedDataCategory::Type category)
 {
-	DELETE_MEMORY_TC(m_powerControlDynamicCapsSet);
-	m_powerLimitEnabled.clear();
-	m_powerLimit.clear();
-	m_powerLimitTimeWindow.clear();
-	m_powerLimitDutyCycle.clear();
-	DELETE_MEMORY_TC(m_isPowerShareControl);
-}
-
-void Domain::clearDomainCachedDataPowerStatus()
-{
-	DELETE_MEMORY_TC(m_powerStatus);
-}
-
-void Domain::clearDomainCachedDataPriority()
-{
-	DELETE_MEMORY_TC(m_domainPriority);
-}
-
-void Domain::clearDomainCachedDataRfProfileControl()
-{
-	DELETE_MEMORY_TC(m_rfProfileCapabilities);
-}
-
-void Domain::clearDomainCachedDataRfProfileStatus()
-{
-	DELETE_MEMORY_TC(m_rfProfileData);
-}
-
-void Domain::clearDomainCachedDataUtilizationStatus()
-{
-	DELETE_MEMORY_TC(m_utilizationStatus);
-}
-
-void Domain::clearDomainCachedDataPlatformPowerStatus()
-{
-	DELETE_MEMORY_TC(m_adapterRating);
-	DELETE_MEMORY_TC(m_platformRestOfPower);
-	DELETE_MEMORY_TC(m_platformPowerSource);
-	DELETE_MEMORY_TC(m_acNominalVoltage);
-	DELETE_MEMORY_TC(m_acOperationalCurrent);
-	DELETE_MEMORY_TC(m_ac1msPercentageOverload);
-	DELETE_MEMORY_TC(m_ac2msPercentageOverload);
-	DELETE_MEMORY_TC(m_ac10msPercentageOverload);
-}
-
-void Domain::clearDomainCachedDataSystemPowerControl()
-{
-	m_systemPowerLimitEnabled.clear();
-	m_systemPowerLimit.clear();
-	m_systemPowerLimitTimeWindow.clear();
-	m_systemPowerLimitDutyCycle.clear();
+	switch (category)
+	{
+	case DomainCachedDataCategory::CoreControlCapabilities:
+		DELETE_MEMORY_TC(m_coreControlStaticCaps);
+		DELETE_MEMORY_TC(m_coreControlDynamicCaps);
+		break;
+	case DomainCachedDataCategory::CoreControlStatus:
+		DELETE_MEMORY_TC(m_coreControlLpoPreference);
+		DELETE_MEMORY_TC(m_coreControlStatus);
+		break;
+	case DomainCachedDataCategory::DisplayControlCapabilities:
+		DELETE_MEMORY_TC(m_displayControlDynamicCaps);
+		DELETE_MEMORY_TC(m_displayControlSet);
+		break;
+	case DomainCachedDataCategory::DisplayControlStatus:
+		DELETE_MEMORY_TC(m_displayControlStatus);
+		break;
+	case DomainCachedDataCategory::PerformanceControlCapabilities:
+		DELETE_MEMORY_TC(m_performanceControlStaticCaps);
+		DELETE_MEMORY_TC(m_performanceControlDynamicCaps);
+		DELETE_MEMORY_TC(m_performanceControlSet);
+		break;
+	case DomainCachedDataCategory::PerformanceControlStatus:
+		DELETE_MEMORY_TC(m_performanceControlStatus);
+		break;
+	case DomainCachedDataCategory::PowerControlCapabilities:
+		DELETE_MEMORY_TC(m_powerControlDynamicCapsSet);
+		DELETE_MEMORY_TC(m_isPowerShareControl);
+		break;
+	case DomainCachedDataCategory::PowerControlLimits:
+		m_powerLimitEnabled.clear();
+		m_powerLimit.clear();
+		m_powerLimitTimeWindow.clear();
+		m_powerLimitDutyCycle.clear();
+		break;
+	case DomainCachedDataCategory::PowerStatus:
+		DELETE_MEMORY_TC(m_powerStatus);
+		break;
+	case DomainCachedDataCategory::SystemPowerControlLimits:
+		m_systemPowerLimitEnabled.clear();
+		m_systemPowerLimit.clear();
+		m_systemPowerLimitTimeWindow.clear();
+		m_systemPowerLimitDutyCycle.clear();
+		break;
+	case DomainCachedDataCategory::PlatformPowerCapabilities:
+		DELETE_MEMORY_TC(m_adapterRating);
+		DELETE_MEMORY_TC(m_platformPowerSource);
+		DELETE_MEMORY_TC(m_acNominalVoltage);
+		DELETE_MEMORY_TC(m_acOperationalCurrent);
+		DELETE_MEMORY_TC(m_ac1msPercentageOverload);
+		DELETE_MEMORY_TC(m_ac2msPercentageOverload);
+		DELETE_MEMORY_TC(m_ac10msPercentageOverload);
+		break;
+	case DomainCachedDataCategory::PlatformRestOfPower:
+		DELETE_MEMORY_TC(m_platformRestOfPower);
+		break;
+	case DomainCachedDataCategory::Priority:
+		DELETE_MEMORY_TC(m_domainPriority);
+		break;
+	case DomainCachedDataCategory::RfProfileCapabilities:
+		DELETE_MEMORY_TC(m_rfProfileCapabilities);
+		break;
+	case DomainCachedDataCategory::RfProfileStatus:
+		DELETE_MEMORY_TC(m_rfProfileData);
+		break;
+	case DomainCachedDataCategory::UtilizationStatus:
+		DELETE_MEMORY_TC(m_utilizationStatus);
+		break;
+	default:
+		break;
+	}
 }
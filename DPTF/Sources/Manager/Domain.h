@@ -25,6 +25,8 @@
 #include "PsysPowerLimitType.h"
 #include "RfProfileDataSet.h"
 #include "DptfManagerInterface.h"
+#include "DomainCachedDataCategory.h"
+#include "DomainCachedDataStatistics.h"
 
 class Domain
 {
@@ -51,10 +53,16 @@ public:
 	// actual domain to clear its cache.
 	void clearDomainCachedData(void);
 	void clearDomainCachedRequestData(void);
+
+	// Clears only the cached data in the given categories.  Used after work items and sets so that values
+	// which could not have changed stay cached.
+	void invalidateCachedData(DomainCachedDataCategory::Mask categories);
+	void invalidateCachedData(DomainCachedDataCategory::Type category);
 	void clearArbitrationDataForPolicy(UIntN policyIndex);
 	std::shared_ptr<XmlNode> getArbitrationXmlForPolicy(UIntN policyIndex, ControlFactoryType::Type type) const;
 
 	std::shared_ptr<XmlNode> getDiagnosticsAsXml() const;
+	std::shared_ptr<XmlNode> getCachedDataStatisticsXml() const;
 
 	//
 	// The following set of functions pass the call through to the actual domain.  They
@@ -217,7 +225,6 @@ private:
 
 	//
 	// Cached data.
-	// FIXME:  consider adding a dirty bit to speed up clearing the cache.
 	//
 
 	// Core controls
@@ -277,15 +284,11 @@ private:
 	// Utilization
 	UtilizationStatus* m_utilizationStatus;
 
-	void clearDomainCachedDataCoreControl();
-	void clearDomainCachedDataDisplayControl();
-	void clearDomainCachedDataPerformanceControl();
-	void clearDomainCachedDataPowerControl();
-	void clearDomainCachedDataPowerStatus();
-	void clearDomainCachedDataSystemPowerControl();
-	void clearDomainCachedDataPriority();
-	void clearDomainCachedDataRfProfileControl();
-	void clearDomainCachedDataRfProfileStatus();
-	void clearDomainCachedDataUtilizationStatus();
-	void clearDomainCachedDataPlatformPowerStatus();
+	// One bit per DomainCachedDataCategory that currently holds a cached value
+	DomainCachedDataCategory::Mask m_cachedCategories;
+	DomainCachedDataStatistics m_cacheStatistics;
+
+	void countCacheHit(DomainCachedDataCategory::Type category);
+	void countCacheMiss(DomainCachedDataCategory::Type category);
+	void clearCachedDataCategory(DomainCachedDataCategory::Type category);
 };
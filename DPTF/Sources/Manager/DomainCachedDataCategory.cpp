@@ -0,0 +1,168 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "DomainCachedDataCategory.h"
+
+using namespace DomainCachedDataCategory;
+
+Mask DomainCachedDataCategory::toMask(Type category)
+{
+	return (1u << category);
+}
+
+Mask DomainCachedDataCategory::getVolatileMask(void)
+{
+	// Power limits are arbitrated through ESIF, so BIOS, the EC or another application can change them without
+	// sending DPTF an event
+	return toMask(CoreControlStatus) | toMask(DisplayControlStatus) | toMask(PerformanceControlStatus)
+		   | toMask(PowerControlLimits) | toMask(PowerStatus) | toMask(SystemPowerControlLimits)
+		   | toMask(PlatformRestOfPower) | toMask(RfProfileStatus) | toMask(UtilizationStatus);
+}
+
+Mask DomainCachedDataCategory::getMaskForFrameworkEvent(FrameworkEvent::Type frameworkEvent)
+{
+	switch (frameworkEvent)
+	{
+	case FrameworkEvent::DomainCoreControlCapabilityChanged:
+		return toMask(CoreControlCapabilities) | toMask(CoreControlStatus);
+	case FrameworkEvent::DomainDisplayControlCapabilityChanged:
+		return toMask(DisplayControlCapabilities) | toMask(DisplayControlStatus);
+	case FrameworkEvent::DomainDisplayStatusChanged:
+		return toMask(DisplayControlStatus);
+	case FrameworkEvent::DomainPerformanceControlCapabilityChanged:
+	case FrameworkEvent::DomainPerformanceControlsChanged:
+	case FrameworkEvent::PerformanceCapabilitiesChanged:
+		return toMask(PerformanceControlCapabilities) | toMask(PerformanceControlStatus);
+	case FrameworkEvent::DomainPowerControlCapabilityChanged:
+		return toMask(PowerControlCapabilities) | toMask(PowerControlLimits);
+	case FrameworkEvent::PowerLimitChanged:
+		return toMask(PowerControlLimits) | toMask(SystemPowerControlLimits);
+	case FrameworkEvent::DomainPriorityChanged:
+		return toMask(Priority);
+	case FrameworkEvent::DomainRadioConnectionStatusChanged:
+	case FrameworkEvent::DomainRfProfileChanged:
+		return toMask(RfProfileCapabilities) | toMask(RfProfileStatus);
+	case FrameworkEvent::DomainPlatformPowerSourceChanged:
+	case FrameworkEvent::DomainAdapterPowerRatingChanged:
+	case FrameworkEvent::DomainChargerTypeChanged:
+	case FrameworkEvent::DomainPlatformRestOfPowerChanged:
+	case FrameworkEvent::DomainMaxBatteryPowerChanged:
+	case FrameworkEvent::DomainPlatformBatterySteadyStateChanged:
+	case FrameworkEvent::DomainACNominalVoltageChanged:
+	case FrameworkEvent::DomainACOperationalCurrentChanged:
+	case FrameworkEvent::DomainAC1msPercentageOverloadChanged:
+	case FrameworkEvent::DomainAC2msPercentageOverloadChanged:
+	case FrameworkEvent::DomainAC10msPercentageOverloadChanged:
+	case FrameworkEvent::PolicyOperatingSystemPowerSourceChanged:
+		return toMask(PlatformPowerCapabilities) | toMask(PlatformRestOfPower);
+
+	// events that only report status or only change policy configuration
+	case FrameworkEvent::DptfGetStatus:
+	case FrameworkEvent::DptfLogVerbosityChanged:
+	case FrameworkEvent::DptfParticipantActivityLoggingEnabled:
+	case FrameworkEvent::DptfParticipantActivityLoggingDisabled:
+	case FrameworkEvent::DptfPolicyActivityLoggingEnabled:
+	case FrameworkEvent::DptfPolicyActivityLoggingDisabled:
+	case FrameworkEvent::DomainTemperatureThresholdCrossed:
+	case FrameworkEvent::DomainVirtualSensorCalibrationTableChanged:
+	case FrameworkEvent::DomainVirtualSensorPollingTableChanged:
+	case FrameworkEvent::DomainVirtualSensorRecalcChanged:
+	case FrameworkEvent::DomainBatteryStatusChanged:
+	case FrameworkEvent::DomainBatteryInformationChanged:
+	case FrameworkEvent::DomainBatteryHighFrequencyImpedanceChanged:
+	case FrameworkEvent::DomainBatteryNoLoadVoltageChanged:
+	case FrameworkEvent::DomainMaxBatteryPeakCurrentChanged:
+	case FrameworkEvent::DomainEnergyThresholdCrossed:
+	case FrameworkEvent::DomainFanCapabilityChanged:
+	case FrameworkEvent::DomainSocWorkloadClassificationChanged:
+	case FrameworkEvent::DomainEppSensitivityHintChanged:
+	case FrameworkEvent::PolicyInitiatedCallback:
+	case FrameworkEvent::PolicyActiveRelationshipTableChanged:
+	case FrameworkEvent::PolicyThermalRelationshipTableChanged:
+	case FrameworkEvent::PolicyPassiveTableChanged:
+	case FrameworkEvent::PolicyActiveControlPointRelationshipTableChanged:
+	case FrameworkEvent::PolicyPidAlgorithmTableChanged:
+	case FrameworkEvent::PolicyPowerShareAlgorithmTableChanged:
+	case FrameworkEvent::PolicyPowerShareAlgorithmTable2Changed:
+	case FrameworkEvent::PolicyAdaptivePerformanceConditionsTableChanged:
+	case FrameworkEvent::PolicyAdaptivePerformanceParticipantConditionTableChanged:
+	case FrameworkEvent::PolicyAdaptivePerformanceActionsTableChanged:
+	case FrameworkEvent::PolicyPowerBossConditionsTableChanged:
+	case FrameworkEvent::PolicyPowerBossActionsTableChanged:
+	case FrameworkEvent::PolicyPowerBossMathTableChanged:
+	case FrameworkEvent::PolicyVoltageThresholdMathTableChanged:
+	case FrameworkEvent::PolicyEmergencyCallModeTableChanged:
+	case FrameworkEvent::PolicyOemVariablesChanged:
+	case FrameworkEvent::PolicyForegroundApplicationChanged:
+	case FrameworkEvent::PolicyForegroundRatioChanged:
+	case FrameworkEvent::PolicySensorOrientationChanged:
+	case FrameworkEvent::PolicySensorMotionChanged:
+	case FrameworkEvent::PolicySensorSpatialOrientationChanged:
+	case FrameworkEvent::PolicyOperatingSystemLidStateChanged:
+	case FrameworkEvent::PolicyOperatingSystemBatteryPercentageChanged:
+	case FrameworkEvent::PolicyOperatingSystemScreenStateChanged:
+	case FrameworkEvent::PolicyOperatingSystemUserPresenceChanged:
+	case FrameworkEvent::PolicyOperatingSystemSessionStateChanged:
+	case FrameworkEvent::PolicyOperatingSystemPowerSliderChanged:
+	case FrameworkEvent::PolicyOperatingSystemGameModeChanged:
+	case FrameworkEvent::PolicyWorkloadHintConfigurationChanged:
+	case FrameworkEvent::DptfAppAliveRequest:
+	case FrameworkEvent::DptfCommand:
+		return None;
+
+	// anything else (participant/policy lifetime, suspend/resume, ...) may change any cached value
+	default:
+		return All;
+	}
+}
+
+ControlFactoryType::Type DomainCachedDataCategory::getControlFactoryType(Type category)
+{
+	switch (category)
+	{
+	case CoreControlCapabilities:
+	case CoreControlStatus:
+		return ControlFactoryType::Core;
+	case DisplayControlCapabilities:
+	case DisplayControlStatus:
+		return ControlFactoryType::Display;
+	case PerformanceControlCapabilities:
+	case PerformanceControlStatus:
+		return ControlFactoryType::Performance;
+	case PowerControlCapabilities:
+	case PowerControlLimits:
+		return ControlFactoryType::PowerControl;
+	case PowerStatus:
+		return ControlFactoryType::PowerStatus;
+	case SystemPowerControlLimits:
+		return ControlFactoryType::SystemPower;
+	case PlatformPowerCapabilities:
+	case PlatformRestOfPower:
+		return ControlFactoryType::PlatformPowerStatus;
+	case Priority:
+		return ControlFactoryType::Priority;
+	case RfProfileCapabilities:
+		return ControlFactoryType::RfProfileControl;
+	case RfProfileStatus:
+		return ControlFactoryType::RfProfileStatus;
+	case UtilizationStatus:
+		return ControlFactoryType::Utilization;
+	default:
+		throw dptf_exception("Invalid domain cached data category.");
+	}
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "FrameworkEvent.h"
+#include "ControlFactoryType.h"
+
+//
+// Groups the values cached by Domain by what can change them.  Capability style values only change when
+// the participant reports a change (or when DPTF sets them), so they survive across work items.  Status
+// values and power limits are read back from hardware and are dropped after every work item.
+//
+
+namespace DomainCachedDataCategory
+{
+	enum Type
+	{
+		CoreControlCapabilities,
+		CoreControlStatus,
+		DisplayControlCapabilities,
+		DisplayControlStatus,
+		PerformanceControlCapabilities,
+		PerformanceControlStatus,
+		PowerControlCapabilities,
+		PowerControlLimits,
+		PowerStatus,
+		SystemPowerControlLimits,
+		PlatformPowerCapabilities,
+		PlatformRestOfPower,
+		Priority,
+		RfProfileCapabilities,
+		RfProfileStatus,
+		UtilizationStatus,
+		Max
+	};
+
+	typedef UInt32 Mask;
+
+	const Mask None = 0;
+	const Mask All = (1u << Max) - 1;
+
+	Mask toMask(Type category);
+	Mask getVolatileMask(void);
+	Mask getMaskForFrameworkEvent(FrameworkEvent::Type frameworkEvent);
+	ControlFactoryType::Type getControlFactoryType(Type category);
+}
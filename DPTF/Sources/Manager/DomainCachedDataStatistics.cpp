@@ -0,0 +1,102 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "DomainCachedDataStatistics.h"
+#include "StatusFormat.h"
+
+DomainCachedDataStatistics::DomainCachedDataStatistics(void)
+	: m_counters()
+{
+}
+
+DomainCachedDataStatistics::~DomainCachedDataStatistics(void)
+{
+}
+
+void DomainCachedDataStatistics::countHit(ControlFactoryType::Type controlType)
+{
+	m_counters[controlType].hits++;
+}
+
+void DomainCachedDataStatistics::countMiss(ControlFactoryType::Type controlType)
+{
+	m_counters[controlType].misses++;
+}
+
+void DomainCachedDataStatistics::countInvalidation(ControlFactoryType::Type controlType)
+{
+	m_counters[controlType].invalidations++;
+}
+
+void DomainCachedDataStatistics::reset(void)
+{
+	m_counters.clear();
+}
+
+UInt64 DomainCachedDataStatistics::getTotalHits(void) const
+{
+	UInt64 total = 0;
+	for (auto counter = m_counters.begin(); counter != m_counters.end(); ++counter)
+	{
+		total += counter->second.hits;
+	}
+	return total;
+}
+
+UInt64 DomainCachedDataStatistics::getTotalMisses(void) const
+{
+	UInt64 total = 0;
+	for (auto counter = m_counters.begin(); counter != m_counters.end(); ++counter)
+	{
+		total += counter->second.misses;
+	}
+	return total;
+}
+
+std::shared_ptr<XmlNode> DomainCachedDataStatistics::getXml(void) const
+{
+	auto root = XmlNode::createWrapperElement("cache_statistics");
+	root->addChild(XmlNode::createDataElement("hits", StatusFormat::friendlyValue(getTotalHits())));
+	root->addChild(XmlNode::createDataElement("misses", StatusFormat::friendlyValue(getTotalMisses())));
+	root->addChild(XmlNode::createDataElement("hit_rate", getHitRate(getTotalHits(), getTotalMisses())));
+
+	for (auto counter = m_counters.begin(); counter != m_counters.end(); ++counter)
+	{
+		auto control = XmlNode::createWrapperElement("control");
+		control->addChild(XmlNode::createDataElement("type", ControlFactoryType::toString(counter->first)));
+		control->addChild(XmlNode::createDataElement("hits", StatusFormat::friendlyValue(counter->second.hits)));
+		control->addChild(XmlNode::createDataElement("misses", StatusFormat::friendlyValue(counter->second.misses)));
+		control->addChild(XmlNode::createDataElement(
+			"invalidations", StatusFormat::friendlyValue(counter->second.invalidations)));
+		control->addChild(
+			XmlNode::createDataElement("hit_rate", getHitRate(counter->second.hits, counter->second.misses)));
+		root->addChild(control);
+	}
+
+	return root;
+}
+
+std::string DomainCachedDataStatistics::getHitRate(UInt64 hits, UInt64 misses)
+{
+	UInt64 total = hits + misses;
+	if (total == 0)
+	{
+		return Constants::InvalidString;
+	}
+	return StatusFormat::friendlyValueWithPrecision((double)hits * 100.0 / (double)total, 1) + "%";
+}
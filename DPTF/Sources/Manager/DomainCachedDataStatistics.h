@@ -0,0 +1,55 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "ControlFactoryType.h"
+#include "XmlNode.h"
+
+//
+// Counts how often a Domain answers a request from its cache versus asking the participant, per control type.
+//
+
+class DomainCachedDataStatistics
+{
+public:
+	DomainCachedDataStatistics(void);
+	~DomainCachedDataStatistics(void);
+
+	void countHit(ControlFactoryType::Type controlType);
+	void countMiss(ControlFactoryType::Type controlType);
+	void countInvalidation(ControlFactoryType::Type controlType);
+	void reset(void);
+
+	UInt64 getTotalHits(void) const;
+	UInt64 getTotalMisses(void) const;
+	std::shared_ptr<XmlNode> getXml(void) const;
+
+private:
+	struct Counters
+	{
+		UInt64 hits;
+		UInt64 misses;
+		UInt64 invalidations;
+	};
+
+	std::map<ControlFactoryType::Type, Counters> m_counters;
+
+	static std::string getHitRate(UInt64 hits, UInt64 misses);
+};
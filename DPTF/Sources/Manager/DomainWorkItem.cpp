@@ -127,3 +127,11 @@ void DomainWorkItem::writeDomainWorkItemStartingInfoMessage() const
 		return message;
 	});
 }
+
+void DomainWorkItem::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeDomainWorkItemErrorMessagePolicy(ex, functionName, policyIndex);
+}
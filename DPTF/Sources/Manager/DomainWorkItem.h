@@ -50,6 +50,10 @@ protected:
 		const std::string& functionName,
 		UIntN policyIndex) const;
 	void writeDomainWorkItemErrorMessage(const std::string& errorMessage) const;
+	virtual void writeWorkItemPolicyExceptionMessage(
+		const std::exception& ex,
+		const std::string& functionName,
+		UIntN policyIndex) const override;
 	void writeDomainWorkItemStartingInfoMessage() const;
 
 private:
@@ -27,6 +27,7 @@
 #include "WorkItemQueueManagerInterface.h"
 #include "BinaryParse.h"
 #include "XmlNode.h"
+#include "XmlWriter.h"
 #include "ParticipantStatusMap.h"
 #include "EsifDataString.h"
 #include <StatusFormat.h>
@@ -178,36 +179,16 @@ std::string DptfStatus::getXsltContent(eEsifError* returnCode)
 
 std::string DptfStatus::getGroupsXml(eEsifError* returnCode)
 {
-	auto groups = XmlNode::createWrapperElement("groups");
-
-	auto group0 = XmlNode::createWrapperElement("group");
-	groups->addChild(group0);
-	group0->addChild(XmlNode::createDataElement("id", "0"));
-	group0->addChild(XmlNode::createDataElement("name", "Policies"));
-
-	auto group1 = XmlNode::createWrapperElement("group");
-	groups->addChild(group1);
-	group1->addChild(XmlNode::createDataElement("id", "1"));
-	group1->addChild(XmlNode::createDataElement("name", "Participants"));
-
-	auto group2 = XmlNode::createWrapperElement("group");
-	groups->addChild(group2);
-	group2->addChild(XmlNode::createDataElement("id", "2"));
-	group2->addChild(XmlNode::createDataElement("name", "Manager"));
-
-	auto group3 = XmlNode::createWrapperElement("group");
-	groups->addChild(group3);
-	group3->addChild(XmlNode::createDataElement("id", "3"));
-	group3->addChild(XmlNode::createDataElement("name", "Arbitrator"));
-
-	auto group4 = XmlNode::createWrapperElement("group");
-	groups->addChild(group4);
-	group4->addChild(XmlNode::createDataElement("id", "4"));
-	group4->addChild(XmlNode::createDataElement("name", "System"));
-
-	std::string s = groups->toString();
-
-	return s;
+	XmlWriter writer;
+	writer.beginElement("groups");
+	writeModule(writer, "group", GroupType::Policies, "Policies");
+	writeModule(writer, "group", GroupType::Participants, "Participants");
+	writeModule(writer, "group", GroupType::Framework, "Manager");
+	writeModule(writer, "group", GroupType::Arbitrator, "Arbitrator");
+	writeModule(writer, "group", GroupType::System, "System");
+	writer.endElement();
+
+	return writer.release();
 }
 
 std::string DptfStatus::getModulesInGroup(const UInt32 appStatusIn, eEsifError* returnCode)
@@ -240,7 +221,8 @@ std::string DptfStatus::getModulesInGroup(const UInt32 appStatusIn, eEsifError*
 
 std::string DptfStatus::getPoliciesGroup()
 {
-	auto modules = XmlNode::createWrapperElement("modules");
+	XmlWriter writer;
+	writer.beginElement("modules");
 
 	auto policyIndexes = m_policyManager->getPolicyIndexes();
 	for (auto policyIndex = policyIndexes.begin(); policyIndex != policyIndexes.end(); ++policyIndex)
@@ -252,14 +234,7 @@ std::string DptfStatus::getPoliciesGroup()
 			auto policy = m_policyManager->getPolicyPtr(*policyIndex);
 			std::string name = policy->getName();
 
-			auto module = XmlNode::createWrapperElement("module");
-			modules->addChild(module);
-
-			auto policyId = XmlNode::createDataElement("id", std::to_string(*policyIndex));
-			module->addChild(policyId);
-
-			auto policyName = XmlNode::createDataElement("name", name);
-			module->addChild(policyName);
+			writeModule(writer, "module", *policyIndex, name);
 		}
 		catch (...)
 		{
@@ -267,9 +242,8 @@ std::string DptfStatus::getPoliciesGroup()
 		}
 	}
 
-	std::string s = modules->toString();
-
-	return s;
+	writer.endElement();
+	return writer.release();
 }
 
 std::string DptfStatus::getParticipantsGroup()
@@ -279,87 +253,74 @@ std::string DptfStatus::getParticipantsGroup()
 
 std::string DptfStatus::getFrameworkGroup()
 {
-	auto modules = XmlNode::createWrapperElement("modules");
+	XmlWriter writer;
+	writer.beginElement("modules");
 
 	for (UIntN moduleType = 0; moduleType < (UIntN)ManagerModuleType::Statistics; ++moduleType)
 	{
-		auto module = XmlNode::createWrapperElement("module");
-		modules->addChild(module);
-
-		auto moduleId = XmlNode::createDataElement("id", std::to_string(moduleType));
-		module->addChild(moduleId);
-
-		auto moduleName =
-			XmlNode::createDataElement("name", ManagerModuleType::ToString((ManagerModuleType::Type)moduleType));
-		module->addChild(moduleName);
+		writeModule(writer, "module", moduleType, ManagerModuleType::ToString((ManagerModuleType::Type)moduleType));
 	}
 
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
 
 	// Work Item Statistics
-
-	module = XmlNode::createWrapperElement("module");
-	modules->addChild(module);
-
-	moduleId = XmlNode::createDataElement("id", std::to_string(ManagerModuleType::Statistics));
-	module->addChild(moduleId);
-
-	moduleName = XmlNode::createDataElement("name", ManagerModuleType::ToString(ManagerModuleType::Statistics));
-	module->addChild(moduleName);
+	writeModule(
+		writer,
+		"module",
+		ManagerModuleType::Statistics,
+		ManagerModuleType::ToString(ManagerModuleType::Statistics));
 
 #endif
 
-	std::string s = modules->toString();
-
-	return s;
+	writer.endElement();
+	return writer.release();
 }
 
 std::string DptfStatus::getArbitratorGroup()
 {
-	auto modules = XmlNode::createWrapperElement("modules");
+	XmlWriter writer;
+	writer.beginElement("modules");
 
 	// in alphabetical order
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::Active));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::Core));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::Display));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::PeakPowerControl));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::Performance));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::PowerControl));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::ProcessorControl));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::SystemPower));
-	modules->addChild(getArbitratorModuleInGroup(ControlFactoryType::Temperature));
-
-	std::string s = modules->toString();
-
-	return s;
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::Active);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::Core);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::Display);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::PeakPowerControl);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::Performance);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::PowerControl);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::ProcessorControl);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::SystemPower);
+	writeArbitratorModuleInGroup(writer, ControlFactoryType::Temperature);
+
+	writer.endElement();
+	return writer.release();
 }
 
 std::string DptfStatus::getSystemGroup()
 {
-	auto modules = XmlNode::createWrapperElement("modules");
-	auto module = XmlNode::createWrapperElement("module");
-	modules->addChild(module);
-
-	auto moduleId = XmlNode::createDataElement("id", std::to_string((UIntN)SystemModuleType::SystemConfiguration));
-	module->addChild(moduleId);
-
-	auto moduleName =
-		XmlNode::createDataElement("name", SystemModuleType::ToString(SystemModuleType::SystemConfiguration));
-	module->addChild(moduleName);
+	XmlWriter writer;
+	writer.beginElement("modules");
+	writeModule(
+		writer,
+		"module",
+		SystemModuleType::SystemConfiguration,
+		SystemModuleType::ToString(SystemModuleType::SystemConfiguration));
+	writer.endElement();
+
+	return writer.release();
+}
 
-	return modules->toString();
+void DptfStatus::writeArbitratorModuleInGroup(XmlWriter& writer, ControlFactoryType::Type type)
+{
+	writeModule(writer, "module", type, ControlFactoryType::getArbitratorString(type));
 }
 
-std::shared_ptr<XmlNode> DptfStatus::getArbitratorModuleInGroup(ControlFactoryType::Type type)
+void DptfStatus::writeModule(XmlWriter& writer, const std::string& tag, UIntN id, const std::string& name)
 {
-	auto module = XmlNode::createWrapperElement("module");
-	auto moduleId = XmlNode::createDataElement("id", std::to_string(type));
-	module->addChild(moduleId);
-
-	auto moduleName =
-		XmlNode::createDataElement("name", ControlFactoryType::getArbitratorString((ControlFactoryType::Type)type));
-	module->addChild(moduleName);
-	return module;
+	writer.beginElement(tag);
+	writer.writeDataElement("id", std::to_string(id));
+	writer.writeDataElement("name", name);
+	writer.endElement();
 }
 
 std::string DptfStatus::getModuleData(const UInt32 appStatusIn, eEsifError* returnCode)
@@ -466,14 +427,16 @@ std::string DptfStatus::getXmlForFramework(UInt32 moduleIndex, eEsifError* retur
 	case ManagerModuleType::Manager:
 	{
 		*returnCode = ESIF_OK;
-		auto frameworkRoot = XmlNode::createRoot();
-		frameworkRoot->addChild(XmlNode::createComment("format_id=" + ManagerStatusFormatId.toString()));
-		auto dppmRoot = XmlNode::createWrapperElement("manager_status");
-		dppmRoot->addChild(getXmlForFrameworkLoadedPolicies());
-		dppmRoot->addChild(getXmlForFrameworkLoadedParticipants());
-		dppmRoot->addChild(getXmlForPlatformRequests());
-		frameworkRoot->addChild(dppmRoot);
-		return frameworkRoot->toString();
+		XmlWriter writer;
+		writer.beginRoot();
+		writer.writeComment("format_id=" + ManagerStatusFormatId.toString());
+		writer.beginElement("manager_status");
+		getXmlForFrameworkLoadedPolicies()->writeTo(writer);
+		getXmlForFrameworkLoadedParticipants()->writeTo(writer);
+		getXmlForPlatformRequests()->writeTo(writer);
+		writer.endElement();
+		writer.endRoot();
+		return writer.release();
 	}
 	case ManagerModuleType::Events:
 	{
@@ -23,6 +23,7 @@
 #include "ControlFactoryType.h"
 
 class XmlNode;
+class XmlWriter;
 class Indent;
 class Participant;
 class ParticipantStatusMap;
@@ -52,7 +53,8 @@ private:
 	std::string getFrameworkGroup();
 	std::string getArbitratorGroup();
 	std::string getSystemGroup();
-	std::shared_ptr<XmlNode> getArbitratorModuleInGroup(ControlFactoryType::Type type);
+	void writeArbitratorModuleInGroup(XmlWriter& writer, ControlFactoryType::Type type);
+	void writeModule(XmlWriter& writer, const std::string& tag, UIntN id, const std::string& name);
 	std::string getModuleData(const UInt32 appStatusIn, eEsifError* returnCode);
 	std::string getXmlForPolicy(UInt32 policyIndex, eEsifError* returnCode);
 	std::string getXmlForParticipant(UInt32 mappedIndex, eEsifError* returnCode);
@@ -66,6 +66,52 @@ eEsifError EsifAppServices::executePrimitive(
 		esifHandle, participantHandle, domainHandle, request, response, primitive, instance);
 }
 
+eEsifError EsifAppServices::bindPrimitive(
+	const esif_handle_t esifHandle,
+	const esif_handle_t appHandle,
+	const esif_handle_t participantHandle,
+	const esif_handle_t domainHandle,
+	const ePrimitiveType primitive,
+	const UInt8 instance,
+	esif_handle_t* primitiveHandle)
+{
+	UNREFERENCED_PARAMETER(appHandle);
+	if (m_esifInterface.fPrimitiveBindFuncPtr == nullptr)
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+	return m_esifInterface.fPrimitiveBindFuncPtr(
+		esifHandle, participantHandle, domainHandle, primitive, instance, primitiveHandle);
+}
+
+eEsifError EsifAppServices::executeBoundPrimitive(
+	const esif_handle_t esifHandle,
+	const esif_handle_t appHandle,
+	const esif_handle_t primitiveHandle,
+	const EsifDataPtr request,
+	EsifDataPtr response)
+{
+	UNREFERENCED_PARAMETER(appHandle);
+	if (m_esifInterface.fPrimitiveBoundFuncPtr == nullptr)
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+	return m_esifInterface.fPrimitiveBoundFuncPtr(esifHandle, primitiveHandle, request, response);
+}
+
+eEsifError EsifAppServices::unbindPrimitive(
+	const esif_handle_t esifHandle,
+	const esif_handle_t appHandle,
+	const esif_handle_t primitiveHandle)
+{
+	UNREFERENCED_PARAMETER(appHandle);
+	if (m_esifInterface.fPrimitiveUnbindFuncPtr == nullptr)
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+	return m_esifInterface.fPrimitiveUnbindFuncPtr(esifHandle, primitiveHandle);
+}
+
 eEsifError EsifAppServices::writeLog(
 	const esif_handle_t esifHandle,
 	const esif_handle_t appHandle,
@@ -51,6 +51,27 @@ public:
 		const ePrimitiveType primitive,
 		const UInt8 instance) override;
 
+	virtual eEsifError bindPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const ePrimitiveType primitive,
+		const UInt8 instance,
+		esif_handle_t* primitiveHandle) override;
+
+	virtual eEsifError executeBoundPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t primitiveHandle,
+		const EsifDataPtr request,
+		EsifDataPtr response) override;
+
+	virtual eEsifError unbindPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t primitiveHandle) override;
+
 	virtual eEsifError writeLog(
 		const esif_handle_t esifHandle,
 		const esif_handle_t appHandle,
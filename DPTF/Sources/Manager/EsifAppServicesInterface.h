@@ -49,6 +49,27 @@ public:
 		const ePrimitiveType primitive,
 		const UInt8 instance) = 0;
 
+	virtual eEsifError bindPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const ePrimitiveType primitive,
+		const UInt8 instance,
+		esif_handle_t* primitiveHandle) = 0;
+
+	virtual eEsifError executeBoundPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t primitiveHandle,
+		const EsifDataPtr request,
+		EsifDataPtr response) = 0;
+
+	virtual eEsifError unbindPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t appHandle,
+		const esif_handle_t primitiveHandle) = 0;
+
 	virtual eEsifError writeLog(
 		const esif_handle_t esifHandle,
 		const esif_handle_t appHandle,
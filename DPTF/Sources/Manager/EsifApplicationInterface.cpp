@@ -32,6 +32,7 @@
 #include "CommandDispatcher.h"
 #include <iostream>
 #include "WIRunCommand.h"
+#include "EsifTimer.h"
 
 using namespace std;
 
@@ -152,16 +153,19 @@ extern "C"
 		// the ESIF interface pointers.  In this case we will check everything manually here instead of in a
 		// constructor. If this fails we can't throw an exception or log a message since the infrastructure isn't up.
 		// All we can do is return an error.
-		if (ifaceSetPtr == nullptr || appHandlePtr == nullptr || ifaceSetPtr->hdr.fIfaceType != eIfaceTypeApplication
-			|| ifaceSetPtr->hdr.fIfaceVersion != APP_INTERFACE_VERSION
-			|| ifaceSetPtr->hdr.fIfaceSize != (UInt16)sizeof(*ifaceSetPtr)
+		if (ifaceSetPtr == nullptr || appHandlePtr == nullptr || !APP_INTERFACE_SET_IS_SUPPORTED(&ifaceSetPtr->hdr)
 			|| ifaceSetPtr->esifIface.fGetConfigFuncPtr == nullptr
 			|| ifaceSetPtr->esifIface.fSetConfigFuncPtr == nullptr
 			|| ifaceSetPtr->esifIface.fPrimitiveFuncPtr == nullptr || ifaceSetPtr->esifIface.fWriteLogFuncPtr == nullptr
 			|| ifaceSetPtr->esifIface.fRegisterEventFuncPtr == nullptr
 			|| ifaceSetPtr->esifIface.fUnregisterEventFuncPtr == nullptr
 			|| (ifaceSetPtr->esifIface.fSendEventFuncPtr == nullptr)
-			|| (ifaceSetPtr->esifIface.fSendCommandFuncPtr == nullptr) || (appData == nullptr))
+			|| (ifaceSetPtr->esifIface.fSendCommandFuncPtr == nullptr)
+			|| ((ifaceSetPtr->hdr.fIfaceVersion >= APP_INTERFACE_VERSION_5)
+				&& ((ifaceSetPtr->esifIface.fPrimitiveBindFuncPtr == nullptr)
+					|| (ifaceSetPtr->esifIface.fPrimitiveBoundFuncPtr == nullptr)
+					|| (ifaceSetPtr->esifIface.fPrimitiveUnbindFuncPtr == nullptr)))
+			|| (appData == nullptr))
 		{
 			rc = ESIF_E_UNSPECIFIED;
 		}
@@ -184,14 +188,26 @@ extern "C"
 						eLogType::eLogTypeInfo);
 				}
 
+				// EsifTimer.cpp compiles this module's own copy of the timer manager.  Start it before any timer is
+				// created so that its threads are not started lazily by whichever thread creates the first timer.
+				// It is stopped by DptfDestroy.
+				esif_ccb_tmrm_init();
+
 				// Creating the DptfManager will start the framework.  When this call returns the work item queue
 				// manager is up and running and the polices have been created.  All future work will execute in the
 				// context of a work item and will only take place on the work item thread.
 				Bool enabled = (appInitialState == eAppState::eAppStateEnabled);
 				std::string dptfHomeDirectoryPath = EsifDataString(&appData->fPathHome);
+				// A Version 4 interface set ends before the bound primitive functions, so only copy what ESIF
+				// supplied and leave the rest null.
+				EsifInterface esifInterface = {0};
+				esif_ccb_memcpy(
+					&esifInterface,
+					&ifaceSetPtr->esifIface,
+					ifaceSetPtr->hdr.fIfaceSize - offsetof(AppInterfaceSet, esifIface));
 				DptfManagerInterface* dptfManager = (DptfManagerInterface*)appHandle;
 				dptfManager->createDptfManager(
-					esifHandle, &ifaceSetPtr->esifIface, dptfHomeDirectoryPath, currentLogVerbosityLevel, enabled);
+					esifHandle, &esifInterface, dptfHomeDirectoryPath, currentLogVerbosityLevel, enabled);
 
 				if (eLogType::eLogTypeInfo <= currentLogVerbosityLevel)
 				{
@@ -211,6 +227,7 @@ extern "C"
 					ESIF_INVALID_HANDLE,
 					EsifDataString("DptfCreate: Initialization failed."),
 					eLogType::eLogTypeFatal);
+				esif_ccb_tmrm_exit();
 				rc = ESIF_E_UNSPECIFIED;
 			}
 		}
@@ -236,6 +253,9 @@ extern "C"
 		try
 		{
 			DELETE_MEMORY(dptfManager);
+
+			// Stop the timer manager started in DptfCreate now that all of its timers are destroyed
+			esif_ccb_tmrm_exit();
 		}
 		catch (...)
 		{
@@ -1188,9 +1208,7 @@ extern "C"
 		 * First verify the size and version of the passed in structure in the
 		 * header before supplying pointers.
 		 */
-		if ((ifaceSetPtr->hdr.fIfaceType != eIfaceTypeApplication)
-			|| (ifaceSetPtr->hdr.fIfaceSize != (UInt16)sizeof(*ifaceSetPtr))
-			|| (ifaceSetPtr->hdr.fIfaceVersion != APP_INTERFACE_VERSION))
+		if (!APP_INTERFACE_SET_IS_SUPPORTED(&ifaceSetPtr->hdr))
 		{
 			rc = ESIF_E_NOT_SUPPORTED;
 			goto exit;
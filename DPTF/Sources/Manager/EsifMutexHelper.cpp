@@ -24,6 +24,14 @@ EsifMutexHelper::EsifMutexHelper(EsifMutex* esifMutex)
 {
 }
 
+// Transfers ownership of a locked mutex so a function can return the MutexHelper to its caller
+EsifMutexHelper::EsifMutexHelper(EsifMutexHelper&& rhs)
+	: m_esifMutex(rhs.m_esifMutex)
+	, m_mutexLocked(rhs.m_mutexLocked)
+{
+	rhs.m_mutexLocked = false;
+}
+
 EsifMutexHelper::~EsifMutexHelper(void)
 {
 	if (m_mutexLocked == true)
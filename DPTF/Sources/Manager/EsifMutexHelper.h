@@ -33,6 +33,7 @@ class EsifMutexHelper final
 {
 public:
 	EsifMutexHelper(EsifMutex* esifMutex);
+	EsifMutexHelper(EsifMutexHelper&& rhs);
 	~EsifMutexHelper(void);
 
 	void lock(void);
@@ -34,6 +34,7 @@
 #include "ManagerMessage.h"
 #include "ManagerLogger.h"
 #include "EsifDataTime.h"
+#include "EsifMutexHelper.h"
 
 using namespace std;
 
@@ -46,6 +47,7 @@ EsifServices::EsifServices(
 	, m_esifHandle(esifHandle)
 	, m_appServices(appServices)
 	, m_currentLogVerbosityLevel(currentLogVerbosityLevel)
+	, m_primitiveBindingStripes()
 {
 }
 
@@ -254,15 +256,7 @@ UInt8 EsifServices::primitiveExecuteGetAsUInt8(
 
 	EsifDataUInt8 esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -277,15 +271,8 @@ void EsifServices::primitiveExecuteSetAsUInt8(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataUInt8(elementValue),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataUInt8(elementValue), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -299,15 +286,7 @@ UInt32 EsifServices::primitiveExecuteGetAsUInt32(
 
 	EsifDataUInt32 esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -322,15 +301,8 @@ void EsifServices::primitiveExecuteSetAsUInt32(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataUInt32(elementValue),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataUInt32(elementValue), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -344,15 +316,7 @@ UInt64 EsifServices::primitiveExecuteGetAsUInt64(
 
 	EsifDataUInt64 esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -367,15 +331,8 @@ void EsifServices::primitiveExecuteSetAsUInt64(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataUInt64(elementValue),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataUInt64(elementValue), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -389,15 +346,7 @@ Temperature EsifServices::primitiveExecuteGetAsTemperatureTenthK(
 
 	EsifDataTemperature esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 
 #ifdef ONLY_LOG_TEMPERATURE_THRESHOLDS
 	// Added to help debug issue with missing temperature threshold events
@@ -452,15 +401,8 @@ void EsifServices::primitiveExecuteSetAsTemperatureTenthK(
 	}
 #endif
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataTemperature(temperature),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataTemperature(temperature), EsifDataVoid());
 
 #ifdef ONLY_LOG_TEMPERATURE_THRESHOLDS
 	// Added to help debug issue with missing temperature threshold events
@@ -495,15 +437,7 @@ Percentage EsifServices::primitiveExecuteGetAsPercentage(
 
 	EsifDataPercentage esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -518,15 +452,8 @@ void EsifServices::primitiveExecuteSetAsPercentage(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataPercentage(percentage),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataPercentage(percentage), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -540,15 +467,7 @@ Frequency EsifServices::primitiveExecuteGetAsFrequency(
 
 	EsifDataFrequency esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -563,15 +482,8 @@ void EsifServices::primitiveExecuteSetAsFrequency(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataFrequency(frequency),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataFrequency(frequency), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -585,15 +497,7 @@ Power EsifServices::primitiveExecuteGetAsPower(
 
 	EsifDataPower esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -608,15 +512,8 @@ void EsifServices::primitiveExecuteSetAsPower(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataPower(power),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataPower(power), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -630,15 +527,7 @@ TimeSpan EsifServices::primitiveExecuteGetAsTimeInMilliseconds(
 
 	EsifDataTime esifResult;
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult.createTimeSpanFromMilliseconds();
@@ -653,15 +542,8 @@ void EsifServices::primitiveExecuteSetAsTimeInMilliseconds(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataTime(time.asMillisecondsInt()),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataTime(time.asMillisecondsInt()), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -675,15 +557,7 @@ std::string EsifServices::primitiveExecuteGetAsString(
 
 	EsifDataString esifResult(Constants::DefaultBufferSize);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		(const esif_handle_t)(UInt64)m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifResult,
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifResult);
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
 	return esifResult;
@@ -698,15 +572,8 @@ void EsifServices::primitiveExecuteSetAsString(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataString(stringValue),
-		EsifDataVoid(),
-		primitive,
-		instance);
+	eEsifError rc = executePrimitive(
+		primitive, participantIndex, domainIndex, instance, EsifDataString(stringValue), EsifDataVoid());
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 }
 
@@ -719,35 +586,24 @@ DptfBuffer EsifServices::primitiveExecuteGet(
 {
 	throwIfParticipantDomainCombinationInvalid(FLF, participantIndex, domainIndex);
 
-	DptfBuffer buffer(Constants::DefaultBufferSize);
-	EsifDataContainer esifData(esifDataType, buffer.get(), buffer.size(), 0);
-	eEsifError rc = m_appServices->executePrimitive(
-		m_esifHandle,
-		(const esif_handle_t)(UInt64)m_dptfManager,
-		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		(const esif_handle_t)(UInt64)m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataVoid(),
-		esifData,
-		primitive,
-		instance);
+	// Most results fit in the stack buffer, so the returned buffer is only allocated once at the size of the data
+	UInt8 stackBuffer[Constants::DefaultBufferSize];
+	EsifDataContainer esifData(esifDataType, stackBuffer, sizeof(stackBuffer), 0);
+	eEsifError rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifData);
 	if (rc == ESIF_E_NEED_LARGER_BUFFER)
 	{
-		buffer.allocate(esifData.getDataLength());
+		DptfBuffer buffer(esifData.getDataLength());
 		EsifDataContainer esifDataTryAgain(esifDataType, buffer.get(), buffer.size(), 0);
-		rc = m_appServices->executePrimitive(
-			m_esifHandle,
-			(const esif_handle_t)(UInt64)m_dptfManager,
-			m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-			(const esif_handle_t)(UInt64)m_dptfManager->getIndexContainer()->getDomainHandle(
-				participantIndex, domainIndex),
-			EsifDataVoid(),
-			esifDataTryAgain,
-			primitive,
-			instance);
+		rc = executePrimitive(primitive, participantIndex, domainIndex, instance, EsifDataVoid(), esifDataTryAgain);
+		throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
+
+		buffer.trim(esifDataTryAgain.getDataLength());
+		return buffer;
 	}
 	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
 
-	buffer.trim(esifData.getDataLength());
+	DptfBuffer buffer(esifData.getDataLength());
+	buffer.put(0, stackBuffer, esifData.getDataLength());
 	return buffer;
 }
 
@@ -769,16 +625,202 @@ void EsifServices::primitiveExecuteSet(
 		bufferPtr = nonEmptyBuffer;
 	}
 
-	eEsifError rc = m_appServices->executePrimitive(
+	eEsifError rc = executePrimitive(
+		primitive,
+		participantIndex,
+		domainIndex,
+		instance,
+		EsifDataContainer(esifDataType, bufferPtr, bufferLength, dataLength),
+		EsifDataVoid());
+	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
+}
+
+void EsifServices::releasePrimitiveBindings(UIntN participantIndex, UIntN domainIndex)
+{
+	std::vector<esif_handle_t> primitiveHandles;
+	auto& stripe = getPrimitiveBindingStripe(participantIndex);
+	EsifMutexHelper mutexHelper(&stripe.mutex);
+	mutexHelper.lock();
+
+	auto binding = stripe.bindings.begin();
+	while (binding != stripe.bindings.end())
+	{
+		UIntN bindingParticipantIndex = (UIntN)((binding->first >> 48) & 0xFFFF);
+		UIntN bindingDomainIndex = (UIntN)((binding->first >> 32) & 0xFFFF);
+		if ((bindingParticipantIndex == participantIndex)
+			&& ((domainIndex == Constants::Esif::NoDomain) || (bindingDomainIndex == domainIndex)))
+		{
+			if (binding->second.bindResult == ESIF_OK)
+			{
+				primitiveHandles.push_back(binding->second.primitiveHandle);
+			}
+			binding = stripe.bindings.erase(binding);
+		}
+		else
+		{
+			++binding;
+		}
+	}
+	stripe.releaseCount++;
+
+	mutexHelper.unlock();
+
+	// ESIF may already have released the bindings along with the participant
+	for (auto primitiveHandle : primitiveHandles)
+	{
+		m_appServices->unbindPrimitive(m_esifHandle, (const esif_handle_t)(UInt64)m_dptfManager, primitiveHandle);
+	}
+}
+
+eEsifError EsifServices::executePrimitive(
+	esif_primitive_type primitive,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt8 instance,
+	const EsifDataPtr request,
+	EsifDataPtr response)
+{
+	auto binding = getPrimitiveBinding(primitive, participantIndex, domainIndex, instance, ESIF_INVALID_HANDLE);
+	if (binding.bindResult != ESIF_OK)
+	{
+		return executeUnboundPrimitive(primitive, participantIndex, domainIndex, instance, request, response);
+	}
+
+	eEsifError rc = m_appServices->executeBoundPrimitive(
+		m_esifHandle, (const esif_handle_t)(UInt64)m_dptfManager, binding.primitiveHandle, request, response);
+
+	// ESIF releases the bindings of a participant when it is removed, so a binding cached before the participant
+	// was re-created must be bound again
+	if (rc == ESIF_E_INVALID_HANDLE)
+	{
+		binding = getPrimitiveBinding(primitive, participantIndex, domainIndex, instance, binding.primitiveHandle);
+		if (binding.bindResult != ESIF_OK)
+		{
+			return executeUnboundPrimitive(primitive, participantIndex, domainIndex, instance, request, response);
+		}
+		rc = m_appServices->executeBoundPrimitive(
+			m_esifHandle, (const esif_handle_t)(UInt64)m_dptfManager, binding.primitiveHandle, request, response);
+	}
+
+	return rc;
+}
+
+eEsifError EsifServices::executeUnboundPrimitive(
+	esif_primitive_type primitive,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt8 instance,
+	const EsifDataPtr request,
+	EsifDataPtr response)
+{
+	return m_appServices->executePrimitive(
 		m_esifHandle,
 		(const esif_handle_t)(UInt64)m_dptfManager,
 		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
-		(const esif_handle_t)(UInt64)m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
-		EsifDataContainer(esifDataType, bufferPtr, bufferLength, dataLength),
-		EsifDataVoid(),
+		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+		request,
+		response,
 		primitive,
 		instance);
-	throwIfNotSuccessful(FLF, rc, primitive, participantIndex, domainIndex, instance);
+}
+
+UInt64 EsifServices::makePrimitiveBindingKey(
+	esif_primitive_type primitive,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt8 instance)
+{
+	// Participant and domain indexes, including NoParticipant and NoDomain, fit in 16 bits
+	return ((UInt64)(participantIndex & 0xFFFF) << 48) | ((UInt64)(domainIndex & 0xFFFF) << 32)
+		| ((UInt64)((UInt32)primitive & 0xFFFFFF) << 8) | (UInt64)instance;
+}
+
+EsifServices::PrimitiveBindingStripe& EsifServices::getPrimitiveBindingStripe(UIntN participantIndex)
+{
+	return m_primitiveBindingStripes[participantIndex % PrimitiveBindingStripeCount];
+}
+
+EsifServices::PrimitiveBinding EsifServices::getPrimitiveBinding(
+	esif_primitive_type primitive,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	UInt8 instance,
+	esif_handle_t staleHandle)
+{
+	auto key = makePrimitiveBindingKey(primitive, participantIndex, domainIndex, instance);
+	auto& stripe = getPrimitiveBindingStripe(participantIndex);
+	EsifMutexHelper mutexHelper(&stripe.mutex);
+	mutexHelper.lock();
+
+	// A stale handle is only replaced once, by the first caller that finds it invalid
+	auto cachedBinding = stripe.bindings.find(key);
+	if ((cachedBinding != stripe.bindings.end())
+		&& ((staleHandle == ESIF_INVALID_HANDLE) || (cachedBinding->second.primitiveHandle != staleHandle)))
+	{
+		auto binding = cachedBinding->second;
+		mutexHelper.unlock();
+		return binding;
+	}
+	auto releaseCount = stripe.releaseCount;
+	mutexHelper.unlock();
+
+	// Binding is a call into ESIF, so the stripe is not locked while it runs
+	PrimitiveBinding binding = {ESIF_INVALID_HANDLE, ESIF_OK};
+	binding.bindResult = m_appServices->bindPrimitive(
+		m_esifHandle,
+		(const esif_handle_t)(UInt64)m_dptfManager,
+		m_dptfManager->getIndexContainer()->getParticipantHandle(participantIndex),
+		m_dptfManager->getIndexContainer()->getDomainHandle(participantIndex, domainIndex),
+		primitive,
+		instance,
+		&binding.primitiveHandle);
+
+	mutexHelper.lock();
+	esif_handle_t unusedHandle = ESIF_INVALID_HANDLE;
+	cachedBinding = stripe.bindings.find(key);
+	if (stripe.releaseCount != releaseCount)
+	{
+		// The participant or domain was destroyed while binding, so the binding must not outlive this call
+		if (binding.bindResult == ESIF_OK)
+		{
+			unusedHandle = binding.primitiveHandle;
+		}
+		binding = {ESIF_INVALID_HANDLE, ESIF_E_INVALID_HANDLE};
+	}
+	else if (
+		(cachedBinding != stripe.bindings.end())
+		&& ((staleHandle == ESIF_INVALID_HANDLE) || (cachedBinding->second.primitiveHandle != staleHandle)))
+	{
+		// Another caller bound the primitive first
+		if (binding.bindResult == ESIF_OK)
+		{
+			unusedHandle = binding.primitiveHandle;
+		}
+		binding = cachedBinding->second;
+	}
+	else if ((binding.bindResult == ESIF_OK) || isPrimitiveBindingFailureFinal(binding.bindResult))
+	{
+		stripe.bindings[key] = binding;
+	}
+	else if (cachedBinding != stripe.bindings.end())
+	{
+		// The stale binding is dropped so the next execution tries to bind again
+		stripe.bindings.erase(cachedBinding);
+	}
+	mutexHelper.unlock();
+
+	if (unusedHandle != ESIF_INVALID_HANDLE)
+	{
+		m_appServices->unbindPrimitive(m_esifHandle, (const esif_handle_t)(UInt64)m_dptfManager, unusedHandle);
+	}
+	return binding;
+}
+
+Bool EsifServices::isPrimitiveBindingFailureFinal(eEsifError bindResult)
+{
+	// Only an ESIF without primitive binding fails every bind.  Other failures, such as a domain handle that is not
+	// known yet or running out of memory, may succeed on a later execution.
+	return (bindResult == ESIF_E_NOT_SUPPORTED) || (bindResult == ESIF_E_NOT_IMPLEMENTED);
 }
 
 void EsifServices::writeMessageFatal(const std::string& message, MessageCategory::Type messageCategory)
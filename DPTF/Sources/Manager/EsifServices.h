@@ -19,6 +19,8 @@
 #pragma once
 
 #include "EsifServicesInterface.h"
+#include "EsifMutex.h"
+#include <unordered_map>
 
 class dptf_export EsifServices : public EsifServicesInterface
 {
@@ -180,6 +182,10 @@ public:
 		UIntN domainIndex = Constants::Esif::NoDomain,
 		UInt8 instance = Constants::Esif::NoInstance) override;
 
+	virtual void releasePrimitiveBindings(
+		UIntN participantIndex,
+		UIntN domainIndex = Constants::Esif::NoDomain) override;
+
 	// Message logging
 
 	virtual void writeMessageFatal(
@@ -229,6 +235,51 @@ private:
 	EsifAppServicesInterface* m_appServices;
 	eLogType m_currentLogVerbosityLevel;
 
+	// Primitive handles bound on behalf of the primitiveExecute* functions.  Each participant index maps to one
+	// stripe with its own lock, so executions on different participants rarely contend.  A bind that failed because
+	// ESIF does not support binding is kept as well so that the primitive is not bound again on every execution.
+	struct PrimitiveBinding
+	{
+		esif_handle_t primitiveHandle;
+		eEsifError bindResult;
+	};
+	struct PrimitiveBindingStripe
+	{
+		EsifMutex mutex;
+		std::unordered_map<UInt64, PrimitiveBinding> bindings;
+		UInt64 releaseCount; // Incremented each time bindings are released, so binds in progress are not cached
+	};
+	static const UIntN PrimitiveBindingStripeCount = 16;
+	PrimitiveBindingStripe m_primitiveBindingStripes[PrimitiveBindingStripeCount];
+
+	eEsifError executePrimitive(
+		esif_primitive_type primitive,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		UInt8 instance,
+		const EsifDataPtr request,
+		EsifDataPtr response);
+	static UInt64 makePrimitiveBindingKey(
+		esif_primitive_type primitive,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		UInt8 instance);
+	PrimitiveBindingStripe& getPrimitiveBindingStripe(UIntN participantIndex);
+	PrimitiveBinding getPrimitiveBinding(
+		esif_primitive_type primitive,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		UInt8 instance,
+		esif_handle_t staleHandle);
+	static Bool isPrimitiveBindingFailureFinal(eEsifError bindResult);
+	eEsifError executeUnboundPrimitive(
+		esif_primitive_type primitive,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		UInt8 instance,
+		const EsifDataPtr request,
+		EsifDataPtr response);
+
 	void writeMessage(eLogType messageLevel, MessageCategory::Type messageCategory, const std::string& message);
 
 	std::string getParticipantName(UIntN participantIndex);
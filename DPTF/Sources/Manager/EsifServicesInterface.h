@@ -191,6 +191,12 @@ public:
 		UIntN domainIndex = Constants::Esif::NoDomain,
 		UInt8 instance = Constants::Esif::NoInstance) = 0;
 
+	// Unbinds the primitives the primitiveExecute* functions bound for a domain, or for every domain of the
+	// participant when no domain is given.  Called when the domain or participant is destroyed.
+	virtual void releasePrimitiveBindings(
+		UIntN participantIndex,
+		UIntN domainIndex = Constants::Esif::NoDomain) = 0;
+
 	// Message logging
 
 	virtual void writeMessageFatal(
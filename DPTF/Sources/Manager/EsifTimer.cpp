@@ -98,7 +98,7 @@ void EsifTimer::esifTimerSet(const TimeSpan& expirationTime)
 
 UInt64 EsifTimer::calculateMilliSecondsUntilTimerExpires(const TimeSpan& expirationTime)
 {
-	auto currentTime = EsifTime().getTimeStamp();
+	auto currentTime = EsifTime::getMonotonicTime();
 	auto numMilliSeconds =
 		(expirationTime > currentTime) ? (expirationTime - currentTime) : TimeSpan::createFromMilliseconds(1);
 	return numMilliSeconds.asMillisecondsUInt();
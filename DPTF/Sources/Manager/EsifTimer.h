@@ -32,6 +32,7 @@ public:
 	EsifTimer(esif_ccb_timer_cb callbackFunction, void* contextPtr = nullptr);
 	~EsifTimer(void);
 
+	// expirationTime is on the EsifTime::getMonotonicTime() clock
 	void startTimer(const TimeSpan& expirationTime);
 	void cancelTimer(void);
 
@@ -0,0 +1,142 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "FrameworkLock.h"
+#include <algorithm>
+
+FrameworkLock::FrameworkLock(void)
+{
+}
+
+FrameworkLock::~FrameworkLock(void)
+{
+}
+
+void FrameworkLock::lockAll(void)
+{
+	m_executionMutex.lock();
+	for (UIntN i = 0; i < FRAMEWORK_LOCK_PARTICIPANT_STRIPES; ++i)
+	{
+		m_participantMutexes[i].lock();
+	}
+	m_loggingMutex.lock();
+	m_configurationMutex.lock();
+}
+
+void FrameworkLock::unlockAll(void)
+{
+	m_configurationMutex.unlock();
+	m_loggingMutex.unlock();
+	for (UIntN i = FRAMEWORK_LOCK_PARTICIPANT_STRIPES; i > 0; --i)
+	{
+		m_participantMutexes[i - 1].unlock();
+	}
+	m_executionMutex.unlock();
+}
+
+EsifMutex* FrameworkLock::getParticipantMutex(UIntN participantIndex)
+{
+	return &m_participantMutexes[participantIndex % FRAMEWORK_LOCK_PARTICIPANT_STRIPES];
+}
+
+EsifMutex* FrameworkLock::getLoggingMutex(void)
+{
+	return &m_loggingMutex;
+}
+
+EsifMutex* FrameworkLock::getConfigurationMutex(void)
+{
+	return &m_configurationMutex;
+}
+
+EsifMutex* FrameworkLock::getPlatformPowerStateMutex(void)
+{
+	return &m_platformPowerStateMutex;
+}
+
+void FrameworkLock::recordParticipantAccess(UIntN policyIndex, UIntN participantIndex)
+{
+	EsifMutexHelper accessLock(&m_accessMutex);
+	accessLock.lock();
+
+	auto& access = m_participantAccess[policyIndex];
+	if ((access.allParticipants == false)
+		&& (std::find(access.participantIndexes.begin(), access.participantIndexes.end(), participantIndex)
+			== access.participantIndexes.end()))
+	{
+		access.participantIndexes.push_back(participantIndex);
+	}
+}
+
+void FrameworkLock::recordAllParticipantsAccess(UIntN policyIndex)
+{
+	EsifMutexHelper accessLock(&m_accessMutex);
+	accessLock.lock();
+
+	auto& access = m_participantAccess[policyIndex];
+	access.allParticipants = true;
+	access.participantIndexes.clear();
+}
+
+PolicyParticipantAccess FrameworkLock::takeParticipantAccess(UIntN policyIndex)
+{
+	EsifMutexHelper accessLock(&m_accessMutex);
+	accessLock.lock();
+
+	PolicyParticipantAccess access;
+	auto policyAccess = m_participantAccess.find(policyIndex);
+	if (policyAccess != m_participantAccess.end())
+	{
+		std::swap(access, policyAccess->second);
+	}
+	return access;
+}
+
+FrameworkLockHelper::FrameworkLockHelper(FrameworkLock* frameworkLock)
+	: m_frameworkLock(frameworkLock)
+	, m_locked(false)
+{
+}
+
+// Transfers ownership of the held locks so a function can return the helper to its caller
+FrameworkLockHelper::FrameworkLockHelper(FrameworkLockHelper&& rhs)
+	: m_frameworkLock(rhs.m_frameworkLock)
+	, m_locked(rhs.m_locked)
+{
+	rhs.m_locked = false;
+}
+
+FrameworkLockHelper::~FrameworkLockHelper(void)
+{
+	if (m_locked == true)
+	{
+		unlock();
+	}
+}
+
+void FrameworkLockHelper::lock(void)
+{
+	m_frameworkLock->lockAll();
+	m_locked = true;
+}
+
+void FrameworkLockHelper::unlock(void)
+{
+	m_frameworkLock->unlockAll();
+	m_locked = false;
+}
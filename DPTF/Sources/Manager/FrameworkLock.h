@@ -0,0 +1,114 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "EsifMutex.h"
+#include "EsifMutexHelper.h"
+#include <map>
+#include <vector>
+
+#define FRAMEWORK_LOCK_PARTICIPANT_STRIPES 16
+
+//
+// Serializes access to framework state between the work item thread and the policies running on the policy
+// executor.  Participant and domain state (cached data, arbitration, the participant library) is guarded by one of
+// a fixed set of participant mutexes, chosen by participant index.  A policy service that only touches one
+// participant takes just that mutex, so policies working on different participants run concurrently.
+//
+// The work item thread, and policy services that touch framework wide state, take the execution mutex and then
+// every participant mutex in order (see FrameworkLockHelper).  Code holding a single participant mutex must not
+// take any other framework lock.
+//
+// Logging, configuration data and platform power state services only go to ESIF and to their own state.  Each kind
+// has its own service mutex, held only around the call into ESIF, so code holding one must not take any other
+// framework lock either.  lockAll takes the logging and configuration mutexes last, since the work item thread
+// changes the ESIF settings they read.  The platform power state mutex only guards the power state threads and is
+// never held by the work item thread, which therefore never waits for a power state request.
+//
+// The lock also records the participants each policy worked on, so that the status values a policy read during a
+// call on the policy executor can be dropped under just those participants' mutexes once the call completes.
+//
+
+struct PolicyParticipantAccess
+{
+	PolicyParticipantAccess(void)
+		: participantIndexes()
+		, allParticipants(false)
+	{
+	}
+
+	std::vector<UIntN> participantIndexes;
+	Bool allParticipants; // the policy made a call that can reach any participant
+};
+
+class FrameworkLock final
+{
+public:
+	FrameworkLock(void);
+	~FrameworkLock(void);
+
+	void lockAll(void);
+	void unlockAll(void);
+	EsifMutex* getParticipantMutex(UIntN participantIndex);
+	EsifMutex* getLoggingMutex(void);
+	EsifMutex* getConfigurationMutex(void);
+	EsifMutex* getPlatformPowerStateMutex(void);
+
+	void recordParticipantAccess(UIntN policyIndex, UIntN participantIndex);
+	void recordAllParticipantsAccess(UIntN policyIndex);
+	PolicyParticipantAccess takeParticipantAccess(UIntN policyIndex);
+
+private:
+	// hide the copy constructor and assignment operator.
+	FrameworkLock(const FrameworkLock& rhs);
+	FrameworkLock& operator=(const FrameworkLock& rhs);
+
+	EsifMutex m_executionMutex;
+	EsifMutex m_participantMutexes[FRAMEWORK_LOCK_PARTICIPANT_STRIPES];
+	EsifMutex m_loggingMutex;
+	EsifMutex m_configurationMutex;
+	EsifMutex m_platformPowerStateMutex;
+
+	EsifMutex m_accessMutex; // only held while updating m_participantAccess
+	std::map<UIntN, PolicyParticipantAccess> m_participantAccess;
+};
+
+//
+// Holds every framework lock until unlock() is called or the helper goes out of scope.  See EsifMutexHelper.
+//
+
+class FrameworkLockHelper final
+{
+public:
+	FrameworkLockHelper(FrameworkLock* frameworkLock);
+	FrameworkLockHelper(FrameworkLockHelper&& rhs);
+	~FrameworkLockHelper(void);
+
+	void lock(void);
+	void unlock(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	FrameworkLockHelper(const FrameworkLockHelper& rhs);
+	FrameworkLockHelper& operator=(const FrameworkLockHelper& rhs);
+
+	FrameworkLock* m_frameworkLock;
+	Bool m_locked;
+};
@@ -18,13 +18,17 @@
 
 #include "ImmediateWorkItemQueue.h"
 #include "EsifMutexHelper.h"
+#include "EsifTime.h"
 #include "ParticipantWorkItem.h"
 #include "XmlNode.h"
 using namespace std;
 
 ImmediateWorkItemQueue::ImmediateWorkItemQueue(EsifSemaphore* workItemQueueSemaphore)
 	: m_queue()
+	, m_nextSequenceNumber(0)
 	, m_maxCount(0)
+	, m_dequeueCount(0)
+	, m_totalWaitTime(TimeSpan::createFromMilliseconds(0))
 	, m_workItemQueueSemaphore(workItemQueueSemaphore)
 {
 }
@@ -44,10 +48,44 @@ void ImmediateWorkItemQueue::enqueue(std::shared_ptr<ImmediateWorkItem> newWorkI
 	// event if the same event is already in the queue.
 	throwIfDuplicateThermalThresholdCrossedEvent(newWorkItem);
 
-	insertSortedByPriority(newWorkItem);
+	insertSortedByPriority(newWorkItem, EsifTime().getTimeStamp());
 	updateMaxCount();
 
 	esifMutexHelper.unlock();
+
+	m_workItemQueueSemaphore->signal();
+}
+
+UIntN ImmediateWorkItemQueue::enqueue(const std::vector<std::shared_ptr<ImmediateWorkItem>>& newWorkItems)
+{
+	UIntN numEnqueued = 0;
+	auto enqueueTime = EsifTime().getTimeStamp();
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	for (auto it = newWorkItems.begin(); it != newWorkItems.end(); it++)
+	{
+		try
+		{
+			throwIfDuplicateThermalThresholdCrossedEvent(*it);
+			insertSortedByPriority(*it, enqueueTime);
+			numEnqueued++;
+		}
+		catch (duplicate_work_item&)
+		{
+		}
+	}
+	updateMaxCount();
+
+	esifMutexHelper.unlock();
+
+	if (numEnqueued > 0)
+	{
+		m_workItemQueueSemaphore->signal();
+	}
+
+	return numEnqueued;
 }
 
 std::shared_ptr<ImmediateWorkItem> ImmediateWorkItemQueue::dequeue(void)
@@ -59,8 +97,18 @@ std::shared_ptr<ImmediateWorkItem> ImmediateWorkItemQueue::dequeue(void)
 
 	if (m_queue.empty() == false)
 	{
-		firstItemInQueue = m_queue.front();
-		m_queue.pop_front();
+		pop_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
+		auto& firstEntry = m_queue.back();
+		firstItemInQueue = firstEntry.workItem;
+
+		auto currentTime = EsifTime().getTimeStamp();
+		if (currentTime > firstEntry.enqueueTime)
+		{
+			m_totalWaitTime = m_totalWaitTime + (currentTime - firstEntry.enqueueTime);
+		}
+		m_dequeueCount++;
+
+		m_queue.pop_back();
 	}
 
 	esifMutexHelper.unlock();
@@ -73,10 +121,7 @@ void ImmediateWorkItemQueue::makeEmtpy(void)
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
-	while (m_queue.empty() == false)
-	{
-		m_queue.pop_front();
-	}
+	m_queue.clear();
 
 	esifMutexHelper.unlock();
 }
@@ -115,9 +160,9 @@ UIntN ImmediateWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& match
 	auto it = m_queue.begin();
 	while (it != m_queue.end())
 	{
-		if ((*it)->matches(matchCriteria) == true)
+		if (it->workItem->matches(matchCriteria) == true)
 		{
-			(*it)->getWorkItem()->signal();
+			it->workItem->getWorkItem()->signal();
 			it = m_queue.erase(it);
 			numRemoved++;
 		}
@@ -127,6 +172,11 @@ UIntN ImmediateWorkItemQueue::removeIfMatches(const WorkItemMatchCriteria& match
 		}
 	}
 
+	if (numRemoved > 0)
+	{
+		make_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
+	}
+
 	esifMutexHelper.unlock();
 
 	return numRemoved;
@@ -137,9 +187,14 @@ std::shared_ptr<XmlNode> ImmediateWorkItemQueue::getXml(void) const
 	EsifMutexHelper esifMutexHelper(&m_mutex);
 	esifMutexHelper.lock();
 
+	auto averageWaitTime =
+		(m_dequeueCount > 0) ? (m_totalWaitTime.asMilliseconds() / m_dequeueCount) : 0.0;
+
 	auto immediateQueueStastics = XmlNode::createWrapperElement("immediate_queue_statistics");
 	immediateQueueStastics->addChild(XmlNode::createDataElement("current_count", std::to_string(m_queue.size())));
 	immediateQueueStastics->addChild(XmlNode::createDataElement("max_count", std::to_string(m_maxCount)));
+	immediateQueueStastics->addChild(XmlNode::createDataElement("dequeue_count", std::to_string(m_dequeueCount)));
+	immediateQueueStastics->addChild(XmlNode::createDataElement("average_wait_ms", std::to_string(averageWaitTime)));
 
 	esifMutexHelper.unlock();
 
@@ -168,8 +223,7 @@ void ImmediateWorkItemQueue::throwIfDuplicateThermalThresholdCrossedEvent(
 
 		for (auto it = m_queue.begin(); it != m_queue.end(); it++)
 		{
-			auto currentWorkItem = *it;
-			Bool foundDuplicate = currentWorkItem->matches(matchCriteria);
+			Bool foundDuplicate = it->workItem->matches(matchCriteria);
 			if (foundDuplicate == true)
 			{
 				throw duplicate_work_item(
@@ -179,35 +233,13 @@ void ImmediateWorkItemQueue::throwIfDuplicateThermalThresholdCrossedEvent(
 	}
 }
 
-void ImmediateWorkItemQueue::insertSortedByPriority(std::shared_ptr<ImmediateWorkItem> newWorkItem)
+void ImmediateWorkItemQueue::insertSortedByPriority(
+	std::shared_ptr<ImmediateWorkItem> newWorkItem,
+	const TimeSpan& enqueueTime)
 {
-	// To improve performance we check for the common cases first and skip the queue
-	// iteration when we can.
-	if (m_queue.empty() == true || newWorkItem->getPriority() == 0)
-	{
-		m_queue.push_back(newWorkItem);
-	}
-	else
-	{
-		auto it = m_queue.begin();
-
-		for (; it != m_queue.end(); it++)
-		{
-			auto currentWorkItem = *it;
-			if (newWorkItem->getPriority() > currentWorkItem->getPriority())
-			{
-				m_queue.insert(it, newWorkItem);
-				break;
-			}
-		}
-
-		if (it == m_queue.end())
-		{
-			m_queue.push_back(newWorkItem);
-		}
-	}
-
-	m_workItemQueueSemaphore->signal();
+	QueueEntry newEntry = {newWorkItem, m_nextSequenceNumber++, enqueueTime};
+	m_queue.push_back(newEntry);
+	push_heap(m_queue.begin(), m_queue.end(), ProcessesAfter());
 }
 
 void ImmediateWorkItemQueue::updateMaxCount()
@@ -217,3 +249,14 @@ void ImmediateWorkItemQueue::updateMaxCount()
 		m_maxCount = m_queue.size();
 	}
 }
+
+Bool ImmediateWorkItemQueue::ProcessesAfter::operator()(const QueueEntry& lhs, const QueueEntry& rhs) const
+{
+	auto lhsPriority = lhs.workItem->getPriority();
+	auto rhsPriority = rhs.workItem->getPriority();
+	if (lhsPriority != rhsPriority)
+	{
+		return (lhsPriority < rhsPriority);
+	}
+	return (lhs.sequenceNumber > rhs.sequenceNumber);
+}
@@ -31,6 +31,10 @@ public:
 	virtual ~ImmediateWorkItemQueue(void);
 
 	void enqueue(std::shared_ptr<ImmediateWorkItem> newWorkItem);
+
+	// Enqueues all of the work items and signals the work item thread once.  Duplicate thermal threshold crossed
+	// events are dropped instead of throwing.  Returns the number of work items enqueued.
+	UIntN enqueue(const std::vector<std::shared_ptr<ImmediateWorkItem>>& newWorkItems);
 	std::shared_ptr<ImmediateWorkItem> dequeue(void);
 
 	// implement WorkItemQueueInterface
@@ -45,12 +49,28 @@ private:
 	ImmediateWorkItemQueue(const ImmediateWorkItemQueue& rhs);
 	ImmediateWorkItemQueue& operator=(const ImmediateWorkItemQueue& rhs);
 
-	std::list<std::shared_ptr<ImmediateWorkItem>> m_queue;
+	struct QueueEntry
+	{
+		std::shared_ptr<ImmediateWorkItem> workItem;
+		UInt64 sequenceNumber;
+		TimeSpan enqueueTime;
+	};
+
+	// Heap ordering: the highest priority is at the front and equal priorities are processed in insertion order
+	struct ProcessesAfter
+	{
+		Bool operator()(const QueueEntry& lhs, const QueueEntry& rhs) const;
+	};
+
+	std::vector<QueueEntry> m_queue; // binary heap ordered by ProcessesAfter
+	UInt64 m_nextSequenceNumber;
 	UInt64 m_maxCount; // stores the maximum number of items in the queue at any one time
+	UInt64 m_dequeueCount;
+	TimeSpan m_totalWaitTime; // time between enqueue and dequeue for all dequeued work items
 	mutable EsifMutex m_mutex;
 	EsifSemaphore* m_workItemQueueSemaphore;
 
 	void throwIfDuplicateThermalThresholdCrossedEvent(std::shared_ptr<ImmediateWorkItem> newWorkItem);
-	void insertSortedByPriority(std::shared_ptr<ImmediateWorkItem> newWorkItem);
+	void insertSortedByPriority(std::shared_ptr<ImmediateWorkItem> newWorkItem, const TimeSpan& enqueueTime);
 	void updateMaxCount(void);
 };
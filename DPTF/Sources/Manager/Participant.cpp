@@ -137,6 +137,15 @@ void Participant::destroyParticipant(void)
 		m_theRealParticipant = nullptr;
 	}
 
+	// releases the bindings of every domain, including the primitives executed on the participant itself
+	try
+	{
+		getEsifServices()->releasePrimitiveBindings(m_participantIndex);
+	}
+	catch (...)
+	{
+	}
+
 	m_participantIndex = Constants::Invalid;
 	m_participantGuid = Guid();
 	m_participantName = "";
@@ -214,6 +223,14 @@ void Participant::destroyDomain(UIntN domainIndex)
 		{
 		}
 
+		try
+		{
+			getEsifServices()->releasePrimitiveBindings(m_participantIndex, domainIndex);
+		}
+		catch (...)
+		{
+		}
+
 		m_domains.erase(domainIndex);
 	}
 }
@@ -269,6 +286,18 @@ void Participant::clearParticipantCachedData(void)
 	m_theRealParticipant->clearCachedResults();
 }
 
+void Participant::invalidateParticipantCachedData(DomainCachedDataCategory::Mask categories)
+{
+	for (auto domain = m_domains.begin(); domain != m_domains.end(); ++domain)
+	{
+		if (domain->second != nullptr)
+		{
+			domain->second->invalidateCachedData(categories);
+		}
+	}
+	m_theRealParticipant->clearCachedResults();
+}
+
 void Participant::clearArbitrationDataForPolicy(UIntN policyIndex)
 {
 	for (auto domain = m_domains.begin(); domain != m_domains.end(); ++domain)
@@ -333,6 +362,17 @@ std::string Participant::getDiagnosticsAsXml() const
 	throwIfRealParticipantIsInvalid();
 	std::shared_ptr<XmlNode> node = XmlNode::createWrapperElement("participant");
 	node->addChild(m_theRealParticipant->getDiagnosticsAsXml(Constants::Invalid));
+
+	auto cacheStatistics = XmlNode::createWrapperElement("domain_cache_statistics");
+	for (auto domain = m_domains.begin(); domain != m_domains.end(); ++domain)
+	{
+		if (domain->second != nullptr)
+		{
+			cacheStatistics->addChild(domain->second->getCachedDataStatisticsXml());
+		}
+	}
+	node->addChild(cacheStatistics);
+
 	return node->toString();
 }
 
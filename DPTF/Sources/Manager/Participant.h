@@ -66,6 +66,7 @@ public:
 	// This will clear the cached data stored within the participant and associated domains within the framework.
 	// It will not ask the actual participant to clear any of its data.
 	void clearParticipantCachedData(void);
+	void invalidateParticipantCachedData(DomainCachedDataCategory::Mask categories);
 
 	void clearArbitrationDataForPolicy(UIntN policyIndex);
 
@@ -154,6 +154,18 @@ void ParticipantManager::clearAllParticipantCachedData()
 	}
 }
 
+void ParticipantManager::invalidateAllParticipantCachedData(DomainCachedDataCategory::Mask categories)
+{
+	m_dptfManager->getDptfStatus()->clearCache();
+	for (auto p = m_participants.begin(); p != m_participants.end(); p++)
+	{
+		if (p->second != nullptr)
+		{
+			p->second->invalidateParticipantCachedData(categories);
+		}
+	}
+}
+
 std::string ParticipantManager::GetStatusAsXml(void)
 {
 	throw implement_me();
@@ -41,6 +41,10 @@ public:
 	// This will clear the cached data stored within all participants *within* the framework.  It will not ask the
 	// actual participants to clear their caches.
 	virtual void clearAllParticipantCachedData() override;
+
+	// Clears only the given categories of cached data within all participants.  The actual participants are
+	// asked to drop their cached request results.
+	virtual void invalidateAllParticipantCachedData(DomainCachedDataCategory::Mask categories) override;
 	virtual Bool participantExists(const std::string& participantName) const override;
 	virtual std::shared_ptr<IParticipant> getParticipant(const std::string& participantName) const override;
 	virtual std::string GetStatusAsXml(void) override;
@@ -39,6 +39,7 @@ public:
 	virtual std::set<UIntN> getParticipantIndexes(void) const = 0;
 	virtual Participant* getParticipantPtr(UIntN participantIndex) const = 0;
 	virtual void clearAllParticipantCachedData() = 0;
+	virtual void invalidateAllParticipantCachedData(DomainCachedDataCategory::Mask categories) = 0;
 	virtual Bool participantExists(const std::string& participantName) const = 0;
 	virtual std::shared_ptr<IParticipant> getParticipant(const std::string& participantName) const = 0;
 
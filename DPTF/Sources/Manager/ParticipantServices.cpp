@@ -400,14 +400,18 @@ DomainType::Type ParticipantServices::getDomainType(UIntN domainIndex)
 
 void ParticipantServices::registerRequestHandler(
 	DptfRequestType::Enum requestType,
+	UIntN domainIndex,
 	RequestHandlerInterface* handler)
 {
-	m_dptfManager->getRequestDispatcher()->registerHandler(requestType, handler);
+	m_dptfManager->getRequestDispatcher()->registerHandler(requestType, m_participantIndex, domainIndex, handler);
 }
 
-void ParticipantServices::unregisterRequestHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler)
+void ParticipantServices::unregisterRequestHandler(
+	DptfRequestType::Enum requestType,
+	UIntN domainIndex,
+	RequestHandlerInterface* handler)
 {
-	m_dptfManager->getRequestDispatcher()->unregisterHandler(requestType, handler);
+	m_dptfManager->getRequestDispatcher()->unregisterHandler(requestType, m_participantIndex, domainIndex, handler);
 }
 
 EsifServicesInterface* ParticipantServices::getEsifServices()
@@ -174,8 +174,14 @@ public:
 	virtual void invalidateUserPreferredDisplayCache(UIntN participantIndex, UIntN domainIndex) override final;
 	virtual Bool isUserPreferredDisplayCacheValid(UIntN participantIndex, UIntN domainIndex) override final;
 
-	virtual void registerRequestHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
-	virtual void unregisterRequestHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
+	virtual void registerRequestHandler(
+		DptfRequestType::Enum requestType,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) override;
+	virtual void unregisterRequestHandler(
+		DptfRequestType::Enum requestType,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) override;
 	
 	virtual DomainType::Type getDomainType(UIntN domainIndex) override final;
 
@@ -19,6 +19,7 @@
 #include "ParticipantStatusMap.h"
 #include "ParticipantManagerInterface.h"
 #include "XmlNode.h"
+#include "XmlWriter.h"
 
 ParticipantStatusMap::ParticipantStatusMap(ParticipantManagerInterface* participantManager)
 	: m_participantManager(participantManager)
@@ -38,7 +39,8 @@ std::string ParticipantStatusMap::getGroupsString()
 		buildParticipantDomainsList();
 	}
 
-	auto modules = XmlNode::createWrapperElement("modules");
+	XmlWriter writer;
+	writer.beginElement("modules");
 
 	for (UIntN i = 0; i < m_participantDomainsList.size(); i++)
 	{
@@ -54,14 +56,10 @@ std::string ParticipantStatusMap::getGroupsString()
 				name << '(' << m_participantDomainsList[i].second << ')';
 			}
 
-			auto module = XmlNode::createWrapperElement("module");
-			modules->addChild(module);
-
-			auto participantId = XmlNode::createDataElement("id", std::to_string(i));
-			module->addChild(participantId);
-
-			auto participantName = XmlNode::createDataElement("name", name.str());
-			module->addChild(participantName);
+			writer.beginElement("module");
+			writer.writeDataElement("id", std::to_string(i));
+			writer.writeDataElement("name", name.str());
+			writer.endElement();
 		}
 		catch (dptf_exception&)
 		{
@@ -69,9 +67,8 @@ std::string ParticipantStatusMap::getGroupsString()
 		}
 	}
 
-	std::string s = modules->toString();
-
-	return s;
+	writer.endElement();
+	return writer.release();
 }
 
 void ParticipantStatusMap::buildParticipantDomainsList()
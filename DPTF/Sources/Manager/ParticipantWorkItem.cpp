@@ -85,7 +85,7 @@ void ParticipantWorkItem::writeParticipantWorkItemWarningMessage(
 void ParticipantWorkItem::writeParticipantWorkItemErrorMessagePolicy(
 	const std::exception& ex,
 	const std::string& functionName,
-	UIntN policyIndex)
+	UIntN policyIndex) const
 {
 	MANAGER_LOG_MESSAGE_ERROR_EX({
 		ManagerMessage message = ManagerMessage(
@@ -101,7 +101,7 @@ void ParticipantWorkItem::writeParticipantWorkItemErrorMessagePolicy(
 void ParticipantWorkItem::writeParticipantWorkItemWarningMessagePolicy(
 	const std::exception& ex,
 	const std::string& functionName,
-	UIntN policyIndex)
+	UIntN policyIndex) const
 {
 	MANAGER_LOG_MESSAGE_WARNING_EX({
 		ManagerMessage message = ManagerMessage(
@@ -124,3 +124,11 @@ void ParticipantWorkItem::writeParticipantWorkItemStartingInfoMessage() const
 		return message;
 	});
 }
+
+void ParticipantWorkItem::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeParticipantWorkItemErrorMessagePolicy(ex, functionName, policyIndex);
+}
@@ -46,11 +46,15 @@ protected:
 	void writeParticipantWorkItemErrorMessagePolicy(
 		const std::exception& ex,
 		const std::string& functionName,
-		UIntN policyIndex);
+		UIntN policyIndex) const;
 	void writeParticipantWorkItemWarningMessagePolicy(
 		const std::exception& ex,
 		const std::string& functionName,
-		UIntN policyIndex);
+		UIntN policyIndex) const;
+	virtual void writeWorkItemPolicyExceptionMessage(
+		const std::exception& ex,
+		const std::string& functionName,
+		UIntN policyIndex) const override;
 	void writeParticipantWorkItemStartingInfoMessage() const;
 
 private:
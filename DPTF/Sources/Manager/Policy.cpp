@@ -1366,4 +1366,11 @@ void Policy::executePolicyForegroundRatioChanged(UIntN ratio)
 	{
 		m_theRealPolicy->foregroundRatioChanged(ratio);
 	}
-}
\ No newline at end of file
+}
+
+#ifdef DPTF_SIMULATOR
+void Policy::overrideTimeObject(std::shared_ptr<TimeInterface> timeObject)
+{
+	m_theRealPolicy->overrideTimeObject(timeObject);
+}
+#endif
\ No newline at end of file
@@ -210,6 +210,10 @@ public:
 	virtual void executePolicyUserInteractionChanged(UserInteraction::Type userInteraction) = 0;
 	virtual void executePolicyUserPresenceCorrelationStatusChanged(UserPresenceCorrelation::Type correlationStatus) = 0;
 	virtual void executePolicyForegroundRatioChanged(UIntN ratio) = 0;
+
+#ifdef DPTF_SIMULATOR
+	virtual void overrideTimeObject(std::shared_ptr<TimeInterface> timeObject) = 0;
+#endif
 };
 
 class dptf_export Policy : public IPolicy
@@ -401,6 +405,10 @@ public:
 	virtual void executePolicyUserPresenceCorrelationStatusChanged(UserPresenceCorrelation::Type correlationStatus) override;
 	virtual void executePolicyForegroundRatioChanged(UIntN ratio) override;
 
+#ifdef DPTF_SIMULATOR
+	virtual void overrideTimeObject(std::shared_ptr<TimeInterface> timeObject) override;
+#endif
+
 private:
 	// hide the copy constructor and assignment operator.
 	Policy(const Policy& rhs);
@@ -0,0 +1,314 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "PolicyExecutor.h"
+#include "EsifMutexHelper.h"
+#include "EsifTime.h"
+#include "XmlNode.h"
+
+PolicyExecutor::PolicyExecutor(UIntN numberOfThreads)
+	: m_mutex()
+	, m_destroyThreads(false)
+	, m_policyQueues()
+	, m_readyPolicies()
+	, m_outstandingTasks(0)
+	, m_idleWaiters()
+	, m_readySemaphore()
+	, m_threads()
+	, m_threadIds()
+{
+	try
+	{
+		for (UIntN i = 0; i < numberOfThreads; i++)
+		{
+			m_threads.push_back(new EsifThread(PolicyExecutorThreadStart, this));
+		}
+	}
+	catch (...)
+	{
+		m_destroyThreads = true;
+		for (UIntN i = 0; i < m_threads.size(); i++)
+		{
+			m_readySemaphore.signal();
+		}
+		for (auto thread = m_threads.begin(); thread != m_threads.end(); ++thread)
+		{
+			DELETE_MEMORY_TC(*thread);
+		}
+		throw;
+	}
+}
+
+PolicyExecutor::~PolicyExecutor(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_destroyThreads = true;
+	esifMutexHelper.unlock();
+
+	// Threads finish whatever is still queued before they exit
+	for (UIntN i = 0; i < m_threads.size(); i++)
+	{
+		m_readySemaphore.signal();
+	}
+	for (auto thread = m_threads.begin(); thread != m_threads.end(); ++thread)
+	{
+		DELETE_MEMORY_TC(*thread);
+	}
+}
+
+void PolicyExecutor::enqueue(UIntN policyIndex, const std::function<void(void)>& task)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	auto queue = m_policyQueues.find(policyIndex);
+	if (queue == m_policyQueues.end())
+	{
+		PolicyQueue newQueue;
+		newQueue.running = false;
+		newQueue.totalExecuted = 0;
+		newQueue.totalExecutionTime = TimeSpan::createFromMicroseconds(0);
+		newQueue.maxExecutionTime = TimeSpan::createFromMicroseconds(0);
+		newQueue.maxQueueTime = TimeSpan::createFromMicroseconds(0);
+		newQueue.maxQueueDepth = 0;
+		queue = m_policyQueues.insert(std::make_pair(policyIndex, newQueue)).first;
+	}
+
+	PolicyTask policyTask;
+	policyTask.task = task;
+	policyTask.enqueueTime = EsifTime().getTimeStamp();
+	queue->second.tasks.push_back(policyTask);
+	queue->second.maxQueueDepth = std::max(queue->second.maxQueueDepth, (UIntN)queue->second.tasks.size());
+	m_outstandingTasks++;
+
+	if (queue->second.running == false)
+	{
+		queue->second.running = true;
+		m_readyPolicies.push_back(policyIndex);
+		m_readySemaphore.signal();
+	}
+
+	esifMutexHelper.unlock();
+}
+
+void PolicyExecutor::waitUntilIdle(void)
+{
+	EsifSemaphore idleSemaphore;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	if (m_outstandingTasks == 0)
+	{
+		esifMutexHelper.unlock();
+		return;
+	}
+	m_idleWaiters.push_back(&idleSemaphore);
+
+	esifMutexHelper.unlock();
+
+	idleSemaphore.wait();
+}
+
+Bool PolicyExecutor::isExecutorThread(void)
+{
+	EsifThreadId currentThreadId;
+	Bool isExecutorThread = false;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	for (auto threadId = m_threadIds.begin(); threadId != m_threadIds.end(); ++threadId)
+	{
+		if (*threadId == currentThreadId)
+		{
+			isExecutorThread = true;
+			break;
+		}
+	}
+
+	esifMutexHelper.unlock();
+
+	return isExecutorThread;
+}
+
+UIntN PolicyExecutor::getNumberOfThreads(void) const
+{
+	return (UIntN)m_threads.size();
+}
+
+Bool PolicyExecutor::requiresSerializedExecution(FrameworkEvent::Type frameworkEvent)
+{
+	switch (frameworkEvent)
+	{
+	case FrameworkEvent::DptfConnectedStandbyEntry:
+	case FrameworkEvent::DptfConnectedStandbyExit:
+	case FrameworkEvent::DptfSuspend:
+	case FrameworkEvent::DptfResume:
+	case FrameworkEvent::DptfGetStatus:
+	case FrameworkEvent::DptfSupportedPoliciesChanged:
+	case FrameworkEvent::ParticipantAllocate:
+	case FrameworkEvent::ParticipantCreate:
+	case FrameworkEvent::ParticipantDestroy:
+	case FrameworkEvent::DomainAllocate:
+	case FrameworkEvent::DomainCreate:
+	case FrameworkEvent::DomainDestroy:
+	case FrameworkEvent::PolicyCreate:
+	case FrameworkEvent::PolicyDestroy:
+	case FrameworkEvent::DptfPolicyLoadedUnloadedEvent:
+	case FrameworkEvent::DptfAppLoaded:
+	case FrameworkEvent::DptfAppUnloaded:
+	case FrameworkEvent::DptfAppUnloading:
+	case FrameworkEvent::DptfCommand:
+		return true;
+	default:
+		return false;
+	}
+}
+
+std::shared_ptr<XmlNode> PolicyExecutor::getXml(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	auto executorStatistics = XmlNode::createWrapperElement("policy_executor_statistics");
+	executorStatistics->addChild(XmlNode::createDataElement("threads", std::to_string(m_threads.size())));
+	executorStatistics->addChild(XmlNode::createDataElement("outstanding_tasks", std::to_string(m_outstandingTasks)));
+
+	for (auto queue = m_policyQueues.begin(); queue != m_policyQueues.end(); ++queue)
+	{
+		auto averageExecutionTime = TimeSpan::createFromMicroseconds(0);
+		if (queue->second.totalExecuted > 0)
+		{
+			averageExecutionTime = queue->second.totalExecutionTime / queue->second.totalExecuted;
+		}
+
+		auto policy = XmlNode::createWrapperElement("policy");
+		executorStatistics->addChild(policy);
+
+		policy->addChild(XmlNode::createDataElement("policy_index", std::to_string(queue->first)));
+		policy->addChild(XmlNode::createDataElement("total_executed", std::to_string(queue->second.totalExecuted)));
+		policy->addChild(XmlNode::createDataElement("queued", std::to_string(queue->second.tasks.size())));
+		policy->addChild(XmlNode::createDataElement("max_queued", std::to_string(queue->second.maxQueueDepth)));
+		policy->addChild(
+			XmlNode::createDataElement("total_execution_time", queue->second.totalExecutionTime.toStringMilliseconds()));
+		policy->addChild(XmlNode::createDataElement("average_execution_time", averageExecutionTime.toStringMilliseconds()));
+		policy->addChild(
+			XmlNode::createDataElement("max_execution_time", queue->second.maxExecutionTime.toStringMilliseconds()));
+		policy->addChild(XmlNode::createDataElement("max_queue_time", queue->second.maxQueueTime.toStringMilliseconds()));
+	}
+
+	esifMutexHelper.unlock();
+
+	return executorStatistics;
+}
+
+void PolicyExecutor::executeThread(void)
+{
+	// This is running on one of the executor threads and processes policy tasks until the destructor is executed
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_threadIds.push_back(EsifThreadId());
+	esifMutexHelper.unlock();
+
+	while (true)
+	{
+		m_readySemaphore.wait();
+
+		esifMutexHelper.lock();
+		if (m_readyPolicies.empty())
+		{
+			Bool destroyThread = m_destroyThreads;
+			esifMutexHelper.unlock();
+			if (destroyThread)
+			{
+				break;
+			}
+			continue;
+		}
+
+		// Run one task for the policy at the front, then put the policy at the back so every policy gets a turn
+		UIntN policyIndex = m_readyPolicies.front();
+		m_readyPolicies.pop_front();
+		auto& queue = m_policyQueues[policyIndex];
+		PolicyTask policyTask = queue.tasks.front();
+		queue.tasks.pop_front();
+		esifMutexHelper.unlock();
+
+		auto startTime = EsifTime().getTimeStamp();
+		try
+		{
+			policyTask.task();
+		}
+		catch (...)
+		{
+		}
+		auto endTime = EsifTime().getTimeStamp();
+		policyTask.task = nullptr;
+
+		esifMutexHelper.lock();
+		auto executionTime = endTime - startTime;
+		auto queueTime = startTime - policyTask.enqueueTime;
+		queue.totalExecuted++;
+		queue.totalExecutionTime = queue.totalExecutionTime + executionTime;
+		if (executionTime > queue.maxExecutionTime)
+		{
+			queue.maxExecutionTime = executionTime;
+		}
+		if (queueTime > queue.maxQueueTime)
+		{
+			queue.maxQueueTime = queueTime;
+		}
+
+		if (queue.tasks.empty())
+		{
+			queue.running = false;
+		}
+		else
+		{
+			m_readyPolicies.push_back(policyIndex);
+			m_readySemaphore.signal();
+		}
+
+		m_outstandingTasks--;
+		if (m_outstandingTasks == 0)
+		{
+			signalIdleWaiters();
+		}
+		esifMutexHelper.unlock();
+	}
+}
+
+void PolicyExecutor::signalIdleWaiters(void)
+{
+	// Caller must hold m_mutex
+	for (auto waiter = m_idleWaiters.begin(); waiter != m_idleWaiters.end(); ++waiter)
+	{
+		(*waiter)->signal();
+	}
+	m_idleWaiters.clear();
+}
+
+void* PolicyExecutorThreadStart(void* contextPtr)
+{
+	PolicyExecutor* policyExecutor = static_cast<PolicyExecutor*>(contextPtr);
+	policyExecutor->executeThread();
+	return nullptr;
+}
@@ -0,0 +1,101 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "FrameworkEvent.h"
+#include "EsifMutex.h"
+#include "EsifSemaphore.h"
+#include "EsifThread.h"
+#include "EsifThreadId.h"
+#include <deque>
+#include <functional>
+
+class XmlNode;
+
+//
+// Delivers work to policies on a small pool of threads.  Each policy has its own serial queue so a policy always
+// runs its work in the order it was enqueued and never on two threads at once, while different policies run
+// concurrently.  A slow policy therefore only delays its own queue.
+//
+// Framework state is not thread safe.  Code running on the executor threads must hold the framework lock, or the
+// participant mutex for the participant it works on, whenever it calls into the framework (see FrameworkLock).
+//
+
+class PolicyExecutor
+{
+public:
+	PolicyExecutor(UIntN numberOfThreads);
+	~PolicyExecutor(void);
+
+	void enqueue(UIntN policyIndex, const std::function<void(void)>& task);
+
+	// Blocks until every queued task has completed.  Must not be called while holding the framework lock.
+	void waitUntilIdle(void);
+
+	Bool isExecutorThread(void);
+	UIntN getNumberOfThreads(void) const;
+
+	// Work items for these events create or destroy participants, domains or policies, or inspect policy state.
+	// They run on the work item thread only after all queued policy work has completed, and they call the policies
+	// directly instead of going through the executor.
+	static Bool requiresSerializedExecution(FrameworkEvent::Type frameworkEvent);
+
+	std::shared_ptr<XmlNode> getXml(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	PolicyExecutor(const PolicyExecutor& rhs);
+	PolicyExecutor& operator=(const PolicyExecutor& rhs);
+
+	struct PolicyTask
+	{
+		std::function<void(void)> task;
+		TimeSpan enqueueTime;
+	};
+
+	struct PolicyQueue
+	{
+		std::deque<PolicyTask> tasks;
+		Bool running; // TRUE while the policy is scheduled on or running on an executor thread
+		UInt64 totalExecuted;
+		TimeSpan totalExecutionTime;
+		TimeSpan maxExecutionTime;
+		TimeSpan maxQueueTime;
+		UIntN maxQueueDepth;
+	};
+
+	EsifMutex m_mutex;
+	Bool m_destroyThreads;
+	std::map<UIntN, PolicyQueue> m_policyQueues;
+	std::deque<UIntN> m_readyPolicies; // policies with queued tasks that are not running
+	UInt64 m_outstandingTasks;
+	std::vector<EsifSemaphore*> m_idleWaiters;
+
+	// signaled once for every policy placed in m_readyPolicies and once per thread at shutdown
+	EsifSemaphore m_readySemaphore;
+	std::vector<EsifThread*> m_threads;
+	std::vector<EsifThreadId> m_threadIds;
+
+	friend void* PolicyExecutorThreadStart(void* contextPtr);
+	void executeThread(void);
+	void signalIdleWaiters(void);
+};
+
+void* PolicyExecutorThreadStart(void* contextPtr);
@@ -75,3 +75,32 @@ void PolicyServices::throwIfNotWorkItemThread(void) const
 		throw dptf_exception("Policy Services functionality called from an unknown thread.");
 	}
 }
+
+// Policies may run on the policy executor threads, concurrently with the work item thread and with each other.
+// Calls that touch a participant or its domains hold that participant's framework mutex until they return, and
+// calls that touch framework wide state hold the whole framework lock.  Logging, configuration data and platform
+// power state only go to ESIF and hold the service mutex for their kind (see FrameworkLock).
+EsifMutexHelper PolicyServices::lockParticipant(UIntN participantIndex) const
+{
+	throwIfNotWorkItemThread();
+	auto frameworkLock = m_workItemQueueManager->getFrameworkLock();
+	EsifMutexHelper participantLock(frameworkLock->getParticipantMutex(participantIndex));
+	participantLock.lock();
+	frameworkLock->recordParticipantAccess(m_policyIndex, participantIndex);
+	return participantLock;
+}
+
+FrameworkLockHelper PolicyServices::lockFramework(void) const
+{
+	FrameworkLockHelper frameworkLock(m_workItemQueueManager->getFrameworkLock());
+	frameworkLock.lock();
+	return frameworkLock;
+}
+
+EsifMutexHelper PolicyServices::lockService(EsifMutex* serviceMutex) const
+{
+	throwIfNotWorkItemThread();
+	EsifMutexHelper serviceLock(serviceMutex);
+	serviceLock.lock();
+	return serviceLock;
+}
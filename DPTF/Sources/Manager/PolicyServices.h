@@ -20,6 +20,8 @@
 
 #include "Dptf.h"
 #include "DptfManagerInterface.h"
+#include "EsifMutexHelper.h"
+#include "FrameworkLock.h"
 class PolicyManagerInterface;
 class IPolicy;
 class ParticipantManagerInterface;
@@ -39,6 +41,9 @@ public:
 	WorkItemQueueManagerInterface* getWorkItemQueueManager(void) const;
 	EsifServicesInterface* getEsifServices(void) const;
 	void throwIfNotWorkItemThread(void) const;
+	EsifMutexHelper lockParticipant(UIntN participantIndex) const;
+	FrameworkLockHelper lockFramework(void) const;
+	EsifMutexHelper lockService(EsifMutex* serviceMutex) const;
 
 private:
 	DptfManagerInterface* m_dptfManager;
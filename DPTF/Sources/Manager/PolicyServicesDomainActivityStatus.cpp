@@ -28,43 +28,43 @@ PolicyServicesDomainActivityStatus::PolicyServicesDomainActivityStatus(
 
 Percentage PolicyServicesDomainActivityStatus::getUtilizationThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUtilizationThreshold(domainIndex);
 }
 
 Percentage PolicyServicesDomainActivityStatus::getResidencyUtilization(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getResidencyUtilization(domainIndex);
 }
 
 UInt64 PolicyServicesDomainActivityStatus::getCoreActivityCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreActivityCounter(domainIndex);
 }
 
 UInt32 PolicyServicesDomainActivityStatus::getCoreActivityCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreActivityCounterWidth(domainIndex);
 }
 
 UInt64 PolicyServicesDomainActivityStatus::getTimestampCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getTimestampCounter(domainIndex);
 }
 
 UInt32 PolicyServicesDomainActivityStatus::getTimestampCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getTimestampCounterWidth(domainIndex);
 }
 
 void PolicyServicesDomainActivityStatus::setPowerShareEffectiveBias(UIntN participantIndex, UIntN domainIndex, UInt32 powerShareEffectiveBias)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerShareEffectiveBias(domainIndex, powerShareEffectiveBias);
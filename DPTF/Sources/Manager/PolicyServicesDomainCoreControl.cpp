@@ -28,7 +28,7 @@ CoreControlStaticCaps PolicyServicesDomainCoreControl::getCoreControlStaticCaps(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreControlStaticCaps(domainIndex);
 }
 
@@ -36,7 +36,7 @@ CoreControlDynamicCaps PolicyServicesDomainCoreControl::getCoreControlDynamicCap
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreControlDynamicCaps(domainIndex);
 }
 
@@ -44,13 +44,13 @@ CoreControlLpoPreference PolicyServicesDomainCoreControl::getCoreControlLpoPrefe
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreControlLpoPreference(domainIndex);
 }
 
 CoreControlStatus PolicyServicesDomainCoreControl::getCoreControlStatus(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getCoreControlStatus(domainIndex);
 }
 
@@ -59,7 +59,7 @@ void PolicyServicesDomainCoreControl::setActiveCoreControl(
 	UIntN domainIndex,
 	const CoreControlStatus& coreControlStatus)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setActiveCoreControl(domainIndex, getPolicyIndex(), coreControlStatus);
@@ -26,31 +26,31 @@ PolicyServicesDomainEnergyControl::PolicyServicesDomainEnergyControl(DptfManager
 
 UInt32 PolicyServicesDomainEnergyControl::getRaplEnergyCounter(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyCounter(domainIndex);
 }
 
 double PolicyServicesDomainEnergyControl::getRaplEnergyUnit(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyUnit(domainIndex);
 }
 
 UInt32 PolicyServicesDomainEnergyControl::getRaplEnergyCounterWidth(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRaplEnergyCounterWidth(domainIndex);
 }
 
 Power PolicyServicesDomainEnergyControl::getInstantaneousPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getInstantaneousPower(domainIndex);
 }
 
 UInt32 PolicyServicesDomainEnergyControl::getEnergyThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getEnergyThreshold(domainIndex);
 }
 
@@ -59,7 +59,7 @@ void PolicyServicesDomainEnergyControl::setEnergyThreshold(
 	UIntN domainIndex,
 	UInt32 energyThreshold)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()->getParticipantPtr(participantIndex)->setEnergyThreshold(domainIndex, energyThreshold);
 }
 
@@ -67,7 +67,7 @@ void PolicyServicesDomainEnergyControl::setEnergyThresholdInterruptDisable(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setEnergyThresholdInterruptDisable(domainIndex);
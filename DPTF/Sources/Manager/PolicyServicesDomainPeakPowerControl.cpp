@@ -28,7 +28,7 @@ PolicyServicesDomainPeakPowerControl::PolicyServicesDomainPeakPowerControl(
 
 Power PolicyServicesDomainPeakPowerControl::getACPeakPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getACPeakPower(domainIndex);
 }
 
@@ -37,7 +37,7 @@ void PolicyServicesDomainPeakPowerControl::setACPeakPower(
 	UIntN domainIndex,
 	const Power& acPeakPower)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setACPeakPower(domainIndex, getPolicyIndex(), acPeakPower);
@@ -45,7 +45,7 @@ void PolicyServicesDomainPeakPowerControl::setACPeakPower(
 
 Power PolicyServicesDomainPeakPowerControl::getDCPeakPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDCPeakPower(domainIndex);
 }
 
@@ -54,7 +54,7 @@ void PolicyServicesDomainPeakPowerControl::setDCPeakPower(
 	UIntN domainIndex,
 	const Power& dcPeakPower)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setDCPeakPower(domainIndex, getPolicyIndex(), dcPeakPower);
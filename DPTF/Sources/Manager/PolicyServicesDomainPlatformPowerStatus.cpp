@@ -28,14 +28,14 @@ PolicyServicesDomainPlatformPowerStatus::PolicyServicesDomainPlatformPowerStatus
 
 Power PolicyServicesDomainPlatformPowerStatus::getPlatformRestOfPower(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getPlatformRestOfPower(domainIndex);
 }
 
 Power PolicyServicesDomainPlatformPowerStatus::getAdapterPowerRating(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getAdapterPowerRating(domainIndex);
 }
@@ -44,21 +44,21 @@ PlatformPowerSource::Type PolicyServicesDomainPlatformPowerStatus::getPlatformPo
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getPlatformPowerSource(domainIndex);
 }
 
 UInt32 PolicyServicesDomainPlatformPowerStatus::getACNominalVoltage(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getACNominalVoltage(domainIndex);
 }
 
 UInt32 PolicyServicesDomainPlatformPowerStatus::getACOperationalCurrent(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getACOperationalCurrent(domainIndex);
 }
@@ -67,7 +67,7 @@ Percentage PolicyServicesDomainPlatformPowerStatus::getAC1msPercentageOverload(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getAC1msPercentageOverload(domainIndex);
 }
@@ -76,7 +76,7 @@ Percentage PolicyServicesDomainPlatformPowerStatus::getAC2msPercentageOverload(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getAC2msPercentageOverload(domainIndex);
 }
@@ -85,14 +85,14 @@ Percentage PolicyServicesDomainPlatformPowerStatus::getAC10msPercentageOverload(
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getAC10msPercentageOverload(domainIndex);
 }
 
 void PolicyServicesDomainPlatformPowerStatus::notifyForProchotDeassertion(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->notifyForProchotDeassertion(domainIndex);
 }
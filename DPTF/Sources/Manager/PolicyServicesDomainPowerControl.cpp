@@ -28,7 +28,7 @@ PowerControlDynamicCapsSet PolicyServicesDomainPowerControl::getPowerControlDyna
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerControlDynamicCapsSet(domainIndex);
 }
 
@@ -37,7 +37,7 @@ void PolicyServicesDomainPowerControl::setPowerControlDynamicCapsSet(
 	UIntN domainIndex,
 	PowerControlDynamicCapsSet capsSet)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerControlDynamicCapsSet(domainIndex, getPolicyIndex(), capsSet);
@@ -48,7 +48,7 @@ Bool PolicyServicesDomainPowerControl::isPowerLimitEnabled(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isPowerLimitEnabled(domainIndex, controlType);
 }
 
@@ -57,7 +57,7 @@ Power PolicyServicesDomainPowerControl::getPowerLimit(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerLimit(domainIndex, controlType);
 }
 
@@ -66,7 +66,7 @@ Power PolicyServicesDomainPowerControl::getPowerLimitWithoutCache(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitWithoutCache(domainIndex, controlType);
@@ -74,13 +74,13 @@ Power PolicyServicesDomainPowerControl::getPowerLimitWithoutCache(
 
 Bool PolicyServicesDomainPowerControl::isSocPowerFloorEnabled(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isSocPowerFloorEnabled(domainIndex);
 }
 
 Bool PolicyServicesDomainPowerControl::isSocPowerFloorSupported(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isSocPowerFloorSupported(domainIndex);
 }
 
@@ -90,7 +90,7 @@ void PolicyServicesDomainPowerControl::setPowerLimit(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimit(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -102,7 +102,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitIgnoringCaps(
 	PowerControlType::Type controlType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitIgnoringCaps(domainIndex, getPolicyIndex(), controlType, powerLimit);
@@ -113,7 +113,7 @@ TimeSpan PolicyServicesDomainPowerControl::getPowerLimitTimeWindow(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitTimeWindow(domainIndex, controlType);
@@ -125,7 +125,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitTimeWindow(
 	PowerControlType::Type controlType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitTimeWindow(domainIndex, getPolicyIndex(), controlType, timeWindow);
@@ -137,7 +137,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitTimeWindowIgnoringCaps(
 	PowerControlType::Type controlType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitTimeWindowIgnoringCaps(domainIndex, getPolicyIndex(), controlType, timeWindow);
@@ -148,7 +148,7 @@ Percentage PolicyServicesDomainPowerControl::getPowerLimitDutyCycle(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->getPowerLimitDutyCycle(domainIndex, controlType);
@@ -160,7 +160,7 @@ void PolicyServicesDomainPowerControl::setPowerLimitDutyCycle(
 	PowerControlType::Type controlType,
 	const Percentage& dutyCycle)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerLimitDutyCycle(domainIndex, getPolicyIndex(), controlType, dutyCycle);
@@ -171,7 +171,7 @@ void PolicyServicesDomainPowerControl::setSocPowerFloorState(
 	UIntN domainIndex,
 	Bool socPowerFloorState)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setSocPowerFloorState(domainIndex, getPolicyIndex(), socPowerFloorState);
@@ -179,61 +179,61 @@ void PolicyServicesDomainPowerControl::setSocPowerFloorState(
 
 void PolicyServicesDomainPowerControl::setPowerCapsLock(UIntN participantIndex, UIntN domainIndex, Bool lock)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()->getParticipantPtr(participantIndex)->setPowerCapsLock(domainIndex, getPolicyIndex(), lock);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getPowerSharePowerLimitTimeWindow(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerSharePowerLimitTimeWindow(domainIndex);
 }
 
 Bool PolicyServicesDomainPowerControl::isPowerShareControl(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->isPowerShareControl(domainIndex);
 }
 
 double PolicyServicesDomainPowerControl::getPidKpTerm(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPidKpTerm(domainIndex);
 }
 
 double PolicyServicesDomainPowerControl::getPidKiTerm(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPidKiTerm(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getAlpha(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getAlpha(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getFastPollTime(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getFastPollTime(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getSlowPollTime(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSlowPollTime(domainIndex);
 }
 
 TimeSpan PolicyServicesDomainPowerControl::getWeightedSlowPollAvgConstant(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getWeightedSlowPollAvgConstant(domainIndex);
 }
 
 Power PolicyServicesDomainPowerControl::getSlowPollPowerThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSlowPollPowerThreshold(domainIndex);
 }
 
@@ -242,7 +242,7 @@ void PolicyServicesDomainPowerControl::removePowerLimitPolicyRequest(
 	UIntN domainIndex,
 	PowerControlType::Type controlType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->removePowerLimitPolicyRequest(domainIndex, getPolicyIndex(), controlType);
@@ -253,7 +253,7 @@ void PolicyServicesDomainPowerControl::setPowerSharePolicyPower(
 	UIntN domainIndex,
 	const Power& powerSharePolicyPower)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setPowerSharePolicyPower(domainIndex, powerSharePolicyPower);
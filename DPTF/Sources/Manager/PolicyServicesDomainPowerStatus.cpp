@@ -26,7 +26,7 @@ PolicyServicesDomainPowerStatus::PolicyServicesDomainPowerStatus(DptfManagerInte
 
 PowerStatus PolicyServicesDomainPowerStatus::getPowerStatus(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getPowerStatus(domainIndex);
 }
 
@@ -35,7 +35,7 @@ Power PolicyServicesDomainPowerStatus::getAveragePower(
 	UIntN domainIndex,
 	const PowerControlDynamicCaps& capabilities)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getAveragePower(domainIndex, capabilities);
 }
 
@@ -44,6 +44,6 @@ void PolicyServicesDomainPowerStatus::setCalculatedAveragePower(
 	UIntN domainIndex,
 	Power powerValue)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()->getParticipantPtr(participantIndex)->setCalculatedAveragePower(domainIndex, powerValue);
 }
\ No newline at end of file
@@ -26,6 +26,6 @@ PolicyServicesDomainPriority::PolicyServicesDomainPriority(DptfManagerInterface*
 
 DomainPriority PolicyServicesDomainPriority::getDomainPriority(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDomainPriority(domainIndex);
 }
@@ -30,7 +30,7 @@ RfProfileCapabilities PolicyServicesDomainRfProfileControl::getRfProfileCapabili
 	UIntN participantIndex,
 	UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRfProfileCapabilities(domainIndex);
 }
 
@@ -39,7 +39,7 @@ void PolicyServicesDomainRfProfileControl::setRfProfileCenterFrequency(
 	UIntN domainIndex,
 	const Frequency& centerFrequency)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setRfProfileCenterFrequency(domainIndex, getPolicyIndex(), centerFrequency);
@@ -47,18 +47,18 @@ void PolicyServicesDomainRfProfileControl::setRfProfileCenterFrequency(
 
 Percentage PolicyServicesDomainRfProfileControl::getSscBaselineSpreadValue(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSscBaselineSpreadValue(domainIndex);
 }
 
 Percentage PolicyServicesDomainRfProfileControl::getSscBaselineThreshold(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSscBaselineThreshold(domainIndex);
 }
 
 Percentage PolicyServicesDomainRfProfileControl::getSscBaselineGuardBand(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getSscBaselineGuardBand(domainIndex);
 }
\ No newline at end of file
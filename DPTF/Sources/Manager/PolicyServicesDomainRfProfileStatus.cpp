@@ -28,6 +28,6 @@ PolicyServicesDomainRfProfileStatus::PolicyServicesDomainRfProfileStatus(
 
 RfProfileDataSet PolicyServicesDomainRfProfileStatus::getRfProfileDataSet(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getRfProfileDataSet(domainIndex);
 }
@@ -31,7 +31,7 @@ Bool PolicyServicesDomainSystemPowerControl::isSystemPowerLimitEnabled(
 	UIntN domainIndex,
 	PsysPowerLimitType::Type limitType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->isSystemPowerLimitEnabled(domainIndex, limitType);
 }
@@ -41,7 +41,7 @@ Power PolicyServicesDomainSystemPowerControl::getSystemPowerLimit(
 	UIntN domainIndex,
 	PsysPowerLimitType::Type limitType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getSystemPowerLimit(domainIndex, limitType);
 }
@@ -52,7 +52,7 @@ void PolicyServicesDomainSystemPowerControl::setSystemPowerLimit(
 	PsysPowerLimitType::Type limitType,
 	const Power& powerLimit)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	participant->setSystemPowerLimit(domainIndex, getPolicyIndex(), limitType, powerLimit);
 }
@@ -62,7 +62,7 @@ TimeSpan PolicyServicesDomainSystemPowerControl::getSystemPowerLimitTimeWindow(
 	UIntN domainIndex,
 	PsysPowerLimitType::Type limitType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getSystemPowerLimitTimeWindow(domainIndex, limitType);
 }
@@ -73,7 +73,7 @@ void PolicyServicesDomainSystemPowerControl::setSystemPowerLimitTimeWindow(
 	PsysPowerLimitType::Type limitType,
 	const TimeSpan& timeWindow)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	participant->setSystemPowerLimitTimeWindow(domainIndex, getPolicyIndex(), limitType, timeWindow);
 }
@@ -83,7 +83,7 @@ Percentage PolicyServicesDomainSystemPowerControl::getSystemPowerLimitDutyCycle(
 	UIntN domainIndex,
 	PsysPowerLimitType::Type limitType)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	return participant->getSystemPowerLimitDutyCycle(domainIndex, limitType);
 }
@@ -94,7 +94,7 @@ void PolicyServicesDomainSystemPowerControl::setSystemPowerLimitDutyCycle(
 	PsysPowerLimitType::Type limitType,
 	const Percentage& dutyCycle)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	auto participant = getParticipantManager()->getParticipantPtr(participantIndex);
 	participant->setSystemPowerLimitDutyCycle(domainIndex, getPolicyIndex(), limitType, dutyCycle);
 }
@@ -26,6 +26,6 @@ PolicyServicesDomainUtilization::PolicyServicesDomainUtilization(DptfManagerInte
 
 UtilizationStatus PolicyServicesDomainUtilization::getUtilizationStatus(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getUtilizationStatus(domainIndex);
 }
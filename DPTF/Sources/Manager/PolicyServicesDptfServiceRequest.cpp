@@ -19,6 +19,7 @@
 #include "PolicyServicesDptfServiceRequest.h"
 #include "PolicyRequest.h"
 #include "ParticipantManagerInterface.h"
+#include "WorkItemQueueManagerInterface.h"
 
 PolicyServicesDptfServiceRequest::PolicyServicesDptfServiceRequest(DptfManagerInterface* dptfManager, UIntN policyIndex)
 	: PolicyServices(dptfManager, policyIndex)
@@ -29,6 +30,19 @@ PolicyServicesDptfServiceRequest::PolicyServicesDptfServiceRequest(DptfManagerIn
 DptfRequestResult PolicyServicesDptfServiceRequest::submitRequest(DptfRequest request)
 {
 	throwIfNotWorkItemThread();
+	auto frameworkLock = lockFramework();
+
+	// handlers registered for the whole request type may reach any participant
+	if (request.getParticipantIndex() == Constants::Invalid)
+	{
+		getWorkItemQueueManager()->getFrameworkLock()->recordAllParticipantsAccess(getPolicyIndex());
+	}
+	else
+	{
+		getWorkItemQueueManager()->getFrameworkLock()->recordParticipantAccess(
+			getPolicyIndex(), request.getParticipantIndex());
+	}
+
 	PolicyRequest policyRequest(getPolicyIndex(), request);
 	return m_requestDispatcher->dispatch(policyRequest);
 }
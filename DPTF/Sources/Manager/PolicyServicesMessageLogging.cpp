@@ -18,6 +18,7 @@
 
 #include "PolicyServicesMessageLogging.h"
 #include "EsifServicesInterface.h"
+#include "WorkItemQueueManagerInterface.h"
 #include "ManagerMessage.h"
 #include "ManagerLogger.h"
 
@@ -28,7 +29,7 @@ PolicyServicesMessageLogging::PolicyServicesMessageLogging(DptfManagerInterface*
 
 void PolicyServicesMessageLogging::writeMessageFatal(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 
 	MANAGER_LOG_MESSAGE_FATAL({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -39,7 +40,7 @@ void PolicyServicesMessageLogging::writeMessageFatal(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageError(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 
 	MANAGER_LOG_MESSAGE_ERROR({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -50,7 +51,7 @@ void PolicyServicesMessageLogging::writeMessageError(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageWarning(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 
 	MANAGER_LOG_MESSAGE_WARNING({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -61,7 +62,7 @@ void PolicyServicesMessageLogging::writeMessageWarning(const DptfMessage& messag
 
 void PolicyServicesMessageLogging::writeMessageInfo(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 
 	MANAGER_LOG_MESSAGE_INFO({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -72,7 +73,7 @@ void PolicyServicesMessageLogging::writeMessageInfo(const DptfMessage& message)
 
 void PolicyServicesMessageLogging::writeMessageDebug(const DptfMessage& message)
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 
 	MANAGER_LOG_MESSAGE_DEBUG({
 		ManagerMessage updatedMessage = ManagerMessage(getDptfManager(), message);
@@ -83,6 +84,6 @@ void PolicyServicesMessageLogging::writeMessageDebug(const DptfMessage& message)
 
 eLogType PolicyServicesMessageLogging::getLoggingLevel()
 {
-	throwIfNotWorkItemThread();
+	auto loggingLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getLoggingMutex());
 	return getEsifServices()->getCurrentLogVerbosityLevel();
 }
@@ -31,6 +31,6 @@ std::map<ParticipantSpecificInfoKey::Type, Temperature> PolicyServicesParticipan
 		UIntN participantIndex,
 		const std::vector<ParticipantSpecificInfoKey::Type>& requestedInfo)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getParticipantSpecificInfo(requestedInfo);
 }
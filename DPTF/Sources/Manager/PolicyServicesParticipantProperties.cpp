@@ -28,12 +28,12 @@ PolicyServicesParticipantProperties::PolicyServicesParticipantProperties(
 
 ParticipantProperties PolicyServicesParticipantProperties::getParticipantProperties(UIntN participantIndex) const
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getParticipantProperties();
 }
 
 DomainPropertiesSet PolicyServicesParticipantProperties::getDomainPropertiesSet(UIntN participantIndex) const
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	return getParticipantManager()->getParticipantPtr(participantIndex)->getDomainPropertiesSet();
 }
@@ -30,7 +30,7 @@ void PolicyServicesParticipantSetSpecificInfo::setParticipantDeviceTemperatureIn
 	UIntN participantIndex,
 	const Temperature& temperature)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()
 		->getParticipantPtr(participantIndex)
 		->setParticipantDeviceTemperatureIndication(temperature);
@@ -41,6 +41,6 @@ void PolicyServicesParticipantSetSpecificInfo::setParticipantSpecificInfo(
 	ParticipantSpecificInfoKey::Type tripPoint,
 	const Temperature& tripValue)
 {
-	throwIfNotWorkItemThread();
+	auto participantLock = lockParticipant(participantIndex);
 	getParticipantManager()->getParticipantPtr(participantIndex)->setParticipantSpecificInfo(tripPoint, tripValue);
 }
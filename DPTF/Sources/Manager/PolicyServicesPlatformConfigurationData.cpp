@@ -18,6 +18,7 @@
 
 #include "PolicyServicesPlatformConfigurationData.h"
 #include "EsifServicesInterface.h"
+#include "WorkItemQueueManagerInterface.h"
 #include "esif_sdk_data_misc.h"
 
 PolicyServicesPlatformConfigurationData::PolicyServicesPlatformConfigurationData(
@@ -31,7 +32,7 @@ PolicyServicesPlatformConfigurationData::PolicyServicesPlatformConfigurationData
 
 UInt32 PolicyServicesPlatformConfigurationData::readConfigurationUInt32(const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 value = getEsifServices()->readConfigurationUInt32(key);
 	return value;
 }
@@ -40,21 +41,21 @@ UInt32 PolicyServicesPlatformConfigurationData::readConfigurationUInt32(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 value = getEsifServices()->readConfigurationUInt32(nameSpace, key);
 	return value;
 }
 
 void PolicyServicesPlatformConfigurationData::writeConfigurationUInt32(const std::string& key, UInt32 data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	getEsifServices()->writeConfigurationUInt32(key, data);
 }
 
 std::string PolicyServicesPlatformConfigurationData::readConfigurationString(
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	std::string value = getEsifServices()->readConfigurationString(key);
 	return value;
 }
@@ -63,26 +64,26 @@ std::string PolicyServicesPlatformConfigurationData::readConfigurationString(
 	const std::string& nameSpace,
 	const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	std::string value = getEsifServices()->readConfigurationString(nameSpace, key);
 	return value;
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::readConfigurationBinary(const std::string& key)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	return getEsifServices()->readConfigurationBinary(key);
 }
 
 eEsifError PolicyServicesPlatformConfigurationData::sendCommand(UInt32 argc, const std::string& argv)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	return getEsifServices()->sendCommand(argc, argv);
 }
 
 TimeSpan PolicyServicesPlatformConfigurationData::getMinimumAllowableSamplePeriod(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	if (m_defaultSamplePeriod.isInvalid())
 	{
@@ -95,14 +96,14 @@ TimeSpan PolicyServicesPlatformConfigurationData::getMinimumAllowableSamplePerio
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getActiveRelationshipTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_ACTIVE_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setActiveRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_ACTIVE_RELATIONSHIP_TABLE,
@@ -117,7 +118,7 @@ void PolicyServicesPlatformConfigurationData::setActiveRelationshipTable(DptfBuf
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getThermalRelationshipTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_THERMAL_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
@@ -125,7 +126,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getThermalRelationshipTable(
 
 void PolicyServicesPlatformConfigurationData::setThermalRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_THERMAL_RELATIONSHIP_TABLE,
@@ -140,7 +141,7 @@ void PolicyServicesPlatformConfigurationData::setThermalRelationshipTable(DptfBu
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPassiveTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_PASSIVE_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
@@ -148,7 +149,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPassiveTable(void)
 
 void PolicyServicesPlatformConfigurationData::setPassiveTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_PASSIVE_RELATIONSHIP_TABLE,
@@ -163,7 +164,7 @@ void PolicyServicesPlatformConfigurationData::setPassiveTable(DptfBuffer data)
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptiveUserPresenceTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_ADAPTIVE_USER_PRESENCE_TABLE, ESIF_DATA_BINARY);
@@ -171,7 +172,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptiveUserPresenceTable
 
 void PolicyServicesPlatformConfigurationData::setAdaptiveUserPresenceTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_ADAPTIVE_USER_PRESENCE_TABLE,
@@ -186,7 +187,7 @@ void PolicyServicesPlatformConfigurationData::setAdaptiveUserPresenceTable(DptfB
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceConditionsTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_ADAPTIVE_PERFORMANCE_CONDITIONS_TABLE, ESIF_DATA_BINARY);
@@ -194,7 +195,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceCondit
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceParticipantConditionTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_ADAPTIVE_PERFORMANCE_PARTICIPANT_CONDITION_TABLE, ESIF_DATA_BINARY);
@@ -202,7 +203,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformancePartic
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceActionsTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_ADAPTIVE_PERFORMANCE_ACTIONS_TABLE, ESIF_DATA_BINARY);
@@ -210,14 +211,14 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getAdaptivePerformanceAction
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getOemVariables(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_OEM_VARS, ESIF_DATA_BINARY);
 }
 
 UInt64 PolicyServicesPlatformConfigurationData::getHwpfState(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	const UInt64 hwpfState = getEsifServices()->primitiveExecuteGetAsUInt64(
 		esif_primitive_type::GET_HWPF_STATE, participantIndex, domainIndex);
@@ -227,7 +228,7 @@ UInt64 PolicyServicesPlatformConfigurationData::getHwpfState(UIntN participantIn
 
 UInt32 PolicyServicesPlatformConfigurationData::getSocWorkload(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	const UInt32 socWorkload = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_SOC_WORKLOAD, participantIndex, domainIndex);
@@ -237,7 +238,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getSocWorkload(UIntN participant
 
 UInt32 PolicyServicesPlatformConfigurationData::getSupportEppHint(UIntN participantIndex, UIntN domainIndex)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	const UInt32 supportEppHint = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_SUPPORT_EPP_HINT, participantIndex, domainIndex);
@@ -265,7 +266,7 @@ const Guid DptfDppeGroup(
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossConditionsTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_POWER_BOSS_CONDITIONS_TABLE, ESIF_DATA_BINARY);
@@ -273,28 +274,28 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossConditionsTable(
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossActionsTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_POWER_BOSS_ACTIONS_TABLE, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getEmergencyCallModeTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_EMERGENCY_CALL_MODE_TABLE, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPidAlgorithmTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_PID_ALGORITHM_TABLE, ESIF_DATA_BINARY);
 }
 
 void PolicyServicesPlatformConfigurationData::setPidAlgorithmTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_PID_ALGORITHM_TABLE,
@@ -309,14 +310,14 @@ void PolicyServicesPlatformConfigurationData::setPidAlgorithmTable(DptfBuffer da
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerBossMathTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(esif_primitive_type::GET_POWER_BOSS_MATH_TABLE, ESIF_DATA_BINARY);
 }
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getVoltageThresholdMathTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_VOLTAGE_THRESHOLD_MATH_TABLE, ESIF_DATA_BINARY);
@@ -324,7 +325,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getVoltageThresholdMathTable
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getActiveControlPointRelationshipTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_ACTIVE_CONTROL_POINT_RELATIONSHIP_TABLE, ESIF_DATA_BINARY);
@@ -332,7 +333,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getActiveControlPointRelatio
 
 void PolicyServicesPlatformConfigurationData::setActiveControlPointRelationshipTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_ACTIVE_CONTROL_POINT_RELATIONSHIP_TABLE,
@@ -347,7 +348,7 @@ void PolicyServicesPlatformConfigurationData::setActiveControlPointRelationshipT
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_POWER_SHARING_ALGORITHM_TABLE, ESIF_DATA_BINARY);
@@ -355,7 +356,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable(
 
 void PolicyServicesPlatformConfigurationData::setPowerShareAlgorithmTable(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_POWER_SHARING_ALGORITHM_TABLE,
@@ -370,7 +371,7 @@ void PolicyServicesPlatformConfigurationData::setPowerShareAlgorithmTable(DptfBu
 
 DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable2()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	return getEsifServices()->primitiveExecuteGet(
 		esif_primitive_type::GET_POWER_SHARING_ALGORITHM_TABLE_2, ESIF_DATA_BINARY);
@@ -378,7 +379,7 @@ DptfBuffer PolicyServicesPlatformConfigurationData::getPowerShareAlgorithmTable2
 
 void PolicyServicesPlatformConfigurationData::setPowerShareAlgorithmTable2(DptfBuffer data)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSet(
 		esif_primitive_type::SET_POWER_SHARING_ALGORITHM_TABLE_2,
@@ -580,7 +581,7 @@ void PolicyServicesPlatformConfigurationData::resetPowerShareAlgorithmTable2(voi
 
 void PolicyServicesPlatformConfigurationData::resetAdaptiveUserPresenceTable(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -616,7 +617,7 @@ void PolicyServicesPlatformConfigurationData::resetAllTables(void)
 
 void PolicyServicesPlatformConfigurationData::setScreenAutolock(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_SCREEN_AUTO_LOCK_STATE,
@@ -628,7 +629,7 @@ void PolicyServicesPlatformConfigurationData::setScreenAutolock(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setWorkstationLock(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_WORKSTATION_LOCK,
@@ -640,7 +641,7 @@ void PolicyServicesPlatformConfigurationData::setWorkstationLock(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproach(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_WAKE_ON_APPROACH_STATE,
@@ -652,7 +653,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproach(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setScreenState(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	getEsifServices()->primitiveExecuteSetAsUInt32(
 		esif_primitive_type::SET_SCREEN_STATE,
@@ -664,7 +665,7 @@ void PolicyServicesPlatformConfigurationData::setScreenState(UInt32 value)
 
 UInt32 PolicyServicesPlatformConfigurationData::getLastHidInputTime(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_LAST_HID_INPUT_TIME,
 		Constants::Esif::NoParticipant,
@@ -674,7 +675,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getLastHidInputTime(void)
 
 UInt32 PolicyServicesPlatformConfigurationData::getIsExternalMonitorConnected(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	return getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_IS_EXTERNAL_MONITOR_CONNECTED,
 		Constants::Esif::NoParticipant,
@@ -684,7 +685,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getIsExternalMonitorConnected(vo
 
 Bool PolicyServicesPlatformConfigurationData::getDisplayRequired(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 displayRequired = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_ES_DISPLAY_REQUIRED,
 		Constants::Esif::NoParticipant,
@@ -700,7 +701,7 @@ Bool PolicyServicesPlatformConfigurationData::getDisplayRequired(void)
 
 Bool PolicyServicesPlatformConfigurationData::getIsCVFSensor(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 isCVFSensor = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_IS_CVF_SENSOR,
 		Constants::Esif::NoParticipant,
@@ -716,7 +717,7 @@ Bool PolicyServicesPlatformConfigurationData::getIsCVFSensor(void)
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproachDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -734,7 +735,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproachDppeSetting(UInt3
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproachExternalMonitorDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -752,7 +753,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproachExternalMonitorDp
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproachLowBatteryDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -770,7 +771,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproachLowBatteryDppeSet
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproachBatteryRemainingPercentageDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -788,7 +789,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproachBatteryRemainingP
 
 void PolicyServicesPlatformConfigurationData::setWalkAwayLockDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -806,7 +807,7 @@ void PolicyServicesPlatformConfigurationData::setWalkAwayLockDppeSetting(UInt32
 
 void PolicyServicesPlatformConfigurationData::setWalkAwayLockExternalMonitorDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -824,7 +825,7 @@ void PolicyServicesPlatformConfigurationData::setWalkAwayLockExternalMonitorDppe
 
 void PolicyServicesPlatformConfigurationData::setWalkAwayLockPreDimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -842,7 +843,7 @@ void PolicyServicesPlatformConfigurationData::setWalkAwayLockPreDimWaitTimeDppeS
 
 void PolicyServicesPlatformConfigurationData::setUserPresentWaitTimeoutDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -860,7 +861,7 @@ void PolicyServicesPlatformConfigurationData::setUserPresentWaitTimeoutDppeSetti
 
 void PolicyServicesPlatformConfigurationData::setDimIntervalDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -878,7 +879,7 @@ void PolicyServicesPlatformConfigurationData::setDimIntervalDppeSetting(UInt32 v
 
 void PolicyServicesPlatformConfigurationData::setDimScreenDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -896,7 +897,7 @@ void PolicyServicesPlatformConfigurationData::setDimScreenDppeSetting(UInt32 val
 
 void PolicyServicesPlatformConfigurationData::setHonorPowerRequestsForDisplayDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -914,7 +915,7 @@ void PolicyServicesPlatformConfigurationData::setHonorPowerRequestsForDisplayDpp
 
 void PolicyServicesPlatformConfigurationData::setHonorUserInCallDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -932,7 +933,7 @@ void PolicyServicesPlatformConfigurationData::setHonorUserInCallDppeSetting(UInt
 
 void PolicyServicesPlatformConfigurationData::setWalkAwayLockScreenLockWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -950,7 +951,7 @@ void PolicyServicesPlatformConfigurationData::setWalkAwayLockScreenLockWaitTimeD
 
 void PolicyServicesPlatformConfigurationData::setDisplayOffAfterLockDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -968,7 +969,7 @@ void PolicyServicesPlatformConfigurationData::setDisplayOffAfterLockDppeSetting(
 
 void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -986,7 +987,7 @@ void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceDppeSetting(UIn
 
 void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceExternalMonitorDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1004,7 +1005,7 @@ void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceExternalMonitor
 
 void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceBatteryDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1022,7 +1023,7 @@ void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceBatteryDppeSett
 
 void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceBatteryRemainingPercentageDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1040,7 +1041,7 @@ void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceBatteryRemainin
 
 void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceResetWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1058,7 +1059,7 @@ void PolicyServicesPlatformConfigurationData::setNoLockOnPresenceResetWaitTimeDp
 
 void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1076,7 +1077,7 @@ void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingDppeSetting(UInt
 
 void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingExternalMonitorDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1094,7 +1095,7 @@ void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingExternalMonitorD
 
 void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingPresentationModeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1112,7 +1113,7 @@ void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingPresentationMode
 
 void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingPreDimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1130,7 +1131,7 @@ void PolicyServicesPlatformConfigurationData::setAdaptiveDimmingPreDimWaitTimeDp
 
 void PolicyServicesPlatformConfigurationData::setMispredictionFaceDetectionDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1148,7 +1149,7 @@ void PolicyServicesPlatformConfigurationData::setMispredictionFaceDetectionDppeS
 
 void PolicyServicesPlatformConfigurationData::setMispredictionTimeWindowDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1166,7 +1167,7 @@ void PolicyServicesPlatformConfigurationData::setMispredictionTimeWindowDppeSett
 
 void PolicyServicesPlatformConfigurationData::setMisprediction1DimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1184,7 +1185,7 @@ void PolicyServicesPlatformConfigurationData::setMisprediction1DimWaitTimeDppeSe
 
 void PolicyServicesPlatformConfigurationData::setMisprediction2DimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1202,7 +1203,7 @@ void PolicyServicesPlatformConfigurationData::setMisprediction2DimWaitTimeDppeSe
 
 void PolicyServicesPlatformConfigurationData::setMisprediction3DimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1220,7 +1221,7 @@ void PolicyServicesPlatformConfigurationData::setMisprediction3DimWaitTimeDppeSe
 
 void PolicyServicesPlatformConfigurationData::setMisprediction4DimWaitTimeDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1238,7 +1239,7 @@ void PolicyServicesPlatformConfigurationData::setMisprediction4DimWaitTimeDppeSe
 
 void PolicyServicesPlatformConfigurationData::setFailsafeTimeoutDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1256,7 +1257,7 @@ void PolicyServicesPlatformConfigurationData::setFailsafeTimeoutDppeSetting(UInt
 
 void PolicyServicesPlatformConfigurationData::setWakeOnApproachEventDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1274,7 +1275,7 @@ void PolicyServicesPlatformConfigurationData::setWakeOnApproachEventDppeSetting(
 
 void PolicyServicesPlatformConfigurationData::setWalkAwayLockEventDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1292,7 +1293,7 @@ void PolicyServicesPlatformConfigurationData::setWalkAwayLockEventDppeSetting(UI
 
 void PolicyServicesPlatformConfigurationData::setExternalMonitorConnectedEventDppeSetting(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1310,7 +1311,7 @@ void PolicyServicesPlatformConfigurationData::setExternalMonitorConnectedEventDp
 
 void PolicyServicesPlatformConfigurationData::setUserNotPresentDimTarget(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1328,7 +1329,7 @@ void PolicyServicesPlatformConfigurationData::setUserNotPresentDimTarget(UInt32
 
 void PolicyServicesPlatformConfigurationData::setUserDisengagedDimmingInterval(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1346,7 +1347,7 @@ void PolicyServicesPlatformConfigurationData::setUserDisengagedDimmingInterval(U
 
 void PolicyServicesPlatformConfigurationData::setUserDisengagedDimTarget(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1364,7 +1365,7 @@ void PolicyServicesPlatformConfigurationData::setUserDisengagedDimTarget(UInt32
 
 void PolicyServicesPlatformConfigurationData::setUserDisengagedDimWaitTime(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1382,7 +1383,7 @@ void PolicyServicesPlatformConfigurationData::setUserDisengagedDimWaitTime(UInt3
 
 void PolicyServicesPlatformConfigurationData::setPolicyUserPresenceState(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1400,7 +1401,7 @@ void PolicyServicesPlatformConfigurationData::setPolicyUserPresenceState(UInt32
 
 Bool PolicyServicesPlatformConfigurationData::getPositiveEventFilteringState(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 positiveEventFilteringState = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_POSITIVE_EVENT_FILTERING_STATE,
 		Constants::Esif::NoParticipant,
@@ -1416,7 +1417,7 @@ Bool PolicyServicesPlatformConfigurationData::getPositiveEventFilteringState(voi
 
 Bool PolicyServicesPlatformConfigurationData::getNegativeEventFilteringState(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	UInt32 negativeEventFilteringState = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_NEGATIVE_EVENT_FILTERING_STATE,
 		Constants::Esif::NoParticipant,
@@ -1432,7 +1433,7 @@ Bool PolicyServicesPlatformConfigurationData::getNegativeEventFilteringState(voi
 
 TimeSpan PolicyServicesPlatformConfigurationData::getPresentStabilityWindow(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	TimeSpan presentStabilityWindow = TimeSpan::createInvalid();
 
@@ -1450,7 +1451,7 @@ TimeSpan PolicyServicesPlatformConfigurationData::getPresentStabilityWindow(void
 
 TimeSpan PolicyServicesPlatformConfigurationData::getDisengagedStabilityWindow(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	TimeSpan disengagedStabilityWindow = TimeSpan::createInvalid();
 
@@ -1468,7 +1469,7 @@ TimeSpan PolicyServicesPlatformConfigurationData::getDisengagedStabilityWindow(v
 
 TimeSpan PolicyServicesPlatformConfigurationData::getNotPresentStabilityWindow(void)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	TimeSpan notPresentStabilityWindow = TimeSpan::createInvalid();
 
@@ -1486,7 +1487,7 @@ TimeSpan PolicyServicesPlatformConfigurationData::getNotPresentStabilityWindow(v
 
 void PolicyServicesPlatformConfigurationData::setPpmPackage(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1504,7 +1505,7 @@ void PolicyServicesPlatformConfigurationData::setPpmPackage(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setPpmPackageSettings(PpmPackage::PpmParam param)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1518,7 +1519,7 @@ void PolicyServicesPlatformConfigurationData::setPpmPackageSettings(PpmPackage::
 
 void PolicyServicesPlatformConfigurationData::setPowerSchemeEpp(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1531,7 +1532,7 @@ void PolicyServicesPlatformConfigurationData::setPowerSchemeEpp(UInt32 value)
 
 void PolicyServicesPlatformConfigurationData::setActivePowerScheme()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1545,7 +1546,7 @@ void PolicyServicesPlatformConfigurationData::setActivePowerScheme()
 
 void PolicyServicesPlatformConfigurationData::clearPpmPackageSettings()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
@@ -1559,7 +1560,7 @@ void PolicyServicesPlatformConfigurationData::clearPpmPackageSettings()
 
 UInt32 PolicyServicesPlatformConfigurationData::getAutonomousBatteryLifeManagementState()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	const UInt32 autonomousBatteryLifeManagement = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_AUTONOMOUS_BATTERY_LIFE_MANAGEMENT_STATE,
@@ -1572,7 +1573,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getAutonomousBatteryLifeManageme
 
 TimeSpan PolicyServicesPlatformConfigurationData::getExpectedBatteryLife()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 	TimeSpan expectedBatteryLife =
 		getEsifServices()->primitiveExecuteGetAsTimeInMilliseconds(
 			esif_primitive_type::GET_EXPECTED_BATTERY_LIFE);
@@ -1582,7 +1583,7 @@ TimeSpan PolicyServicesPlatformConfigurationData::getExpectedBatteryLife()
 
 UInt32 PolicyServicesPlatformConfigurationData::getAggressivenessLevel()
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	const UInt32 aggressivenessLevel = getEsifServices()->primitiveExecuteGetAsUInt32(
 		esif_primitive_type::GET_AGGRESSIVENESS_LEVEL,
@@ -1595,7 +1596,7 @@ UInt32 PolicyServicesPlatformConfigurationData::getAggressivenessLevel()
 
 void PolicyServicesPlatformConfigurationData::setForegroundAppRatioPeriod(UInt32 value)
 {
-	throwIfNotWorkItemThread();
+	auto configurationLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getConfigurationMutex());
 
 	try
 	{
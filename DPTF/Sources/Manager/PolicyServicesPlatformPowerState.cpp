@@ -18,6 +18,7 @@
 
 #include "PolicyServicesPlatformPowerState.h"
 #include "EsifServicesInterface.h"
+#include "WorkItemQueueManagerInterface.h"
 #include "esif_ccb_string.h"
 #include "ManagerLogger.h"
 #include "ManagerMessage.h"
@@ -55,7 +56,7 @@ void PolicyServicesPlatformPowerState::setThermalEvent(
 
 void PolicyServicesPlatformPowerState::sleep(void)
 {
-	throwIfNotWorkItemThread();
+	auto powerStateLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getPlatformPowerStateMutex());
 
 	esif_ccb_thread_join(&m_thread);
 	eEsifError rc = esif_ccb_thread_create(&m_thread, ThreadSleep, this);
@@ -75,10 +76,11 @@ void PolicyServicesPlatformPowerState::hibernate(
 	const Temperature& tripPointTemperature,
 	const std::string& participantName)
 {
-	throwIfNotWorkItemThread();
+	auto powerStateLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getPlatformPowerStateMutex());
 
-	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
+	// the previous request's thread may still be reading the thermal event
 	esif_ccb_thread_join(&m_thread);
+	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
 	eEsifError rc = esif_ccb_thread_create(&m_thread, ThreadHibernate, this);
 	if (rc != ESIF_OK)
 	{
@@ -96,10 +98,11 @@ void PolicyServicesPlatformPowerState::shutDown(
 	const Temperature& tripPointTemperature,
 	const std::string& participantName)
 {
-	throwIfNotWorkItemThread();
+	auto powerStateLock = lockService(getWorkItemQueueManager()->getFrameworkLock()->getPlatformPowerStateMutex());
 
-	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
+	// the previous request's thread may still be reading the thermal event
 	esif_ccb_thread_join(&m_thread);
+	setThermalEvent(currentTemperature, tripPointTemperature, participantName);
 	eEsifError rc = esif_ccb_thread_create(&m_thread, ThreadShutdown, this);
 	if (rc != ESIF_OK)
 	{
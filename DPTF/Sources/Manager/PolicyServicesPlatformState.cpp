@@ -25,61 +25,73 @@ PolicyServicesPlatformState::PolicyServicesPlatformState(DptfManagerInterface* d
 
 OnOffToggle::Type PolicyServicesPlatformState::getMotion(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->sensorMotion.get();
 }
 
 SensorOrientation::Type PolicyServicesPlatformState::getOrientation(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->sensorOrientation.get();
 }
 
 SensorSpatialOrientation::Type PolicyServicesPlatformState::getSpatialOrientation(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->sensorSpatialOrientation.get();
 }
 
 OsLidState::Type PolicyServicesPlatformState::getLidState(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->lidState.get();
 }
 
 OsPowerSource::Type PolicyServicesPlatformState::getPowerSource(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->powerSource.get();
 }
 
 const std::string& PolicyServicesPlatformState::getForegroundApplicationName(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->foregroundApplication.get();
 }
 
 CoolingMode::Type PolicyServicesPlatformState::getCoolingMode(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->coolingMode.get();
 }
 
 UIntN PolicyServicesPlatformState::getBatteryPercentage(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->batteryPercentage.get();
 }
 
 OsPlatformType::Type PolicyServicesPlatformState::getPlatformType(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->platformType.get();
 }
 
 OsDockMode::Type PolicyServicesPlatformState::getDockMode(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->dockMode.get();
 }
 
 OsPowerSchemePersonality::Type PolicyServicesPlatformState::getPowerSchemePersonality(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->powerSchemePersonality.get();
 }
 
 UIntN PolicyServicesPlatformState::getMobileNotification(OsMobileNotificationType::Type notificationType) const
 {
+	auto frameworkLock = lockFramework();
 	switch (notificationType)
 	{
 	case OsMobileNotificationType::EmergencyCallMode:
@@ -97,50 +109,60 @@ UIntN PolicyServicesPlatformState::getMobileNotification(OsMobileNotificationTyp
 
 OnOffToggle::Type PolicyServicesPlatformState::getMixedRealityMode(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->mixedRealityMode.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getGameMode(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->gameMode.get();
 }
 
 OsUserPresence::Type PolicyServicesPlatformState::getOsUserPresence(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->osUserPresence.get();
 }
 
 OsSessionState::Type PolicyServicesPlatformState::getSessionState(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->sessionState.get();
 }
 
 OnOffToggle::Type PolicyServicesPlatformState::getScreenState(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->screenState.get();
 }
 
 UIntN PolicyServicesPlatformState::getBatteryCount(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->batteryCount.get();
 }
 
 UIntN PolicyServicesPlatformState::getPowerSlider(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->powerSlider.get();
 }
 
 SensorUserPresence::Type PolicyServicesPlatformState::getSensorUserPresence(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->sensorUserPresence.get();
 }
 
 SensorUserPresence::Type PolicyServicesPlatformState::getPlatformUserPresence(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->platformUserPresence.get();
 }
 
 UserInteraction::Type PolicyServicesPlatformState::getUserInteraction(void) const
 {
+	auto frameworkLock = lockFramework();
 	return getDptfManager()->getEventCache()->userInteraction.get();
 }
\ No newline at end of file
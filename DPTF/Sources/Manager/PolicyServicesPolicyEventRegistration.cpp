@@ -29,11 +29,13 @@ PolicyServicesPolicyEventRegistration::PolicyServicesPolicyEventRegistration(
 void PolicyServicesPolicyEventRegistration::registerEvent(PolicyEvent::Type policyEvent)
 {
 	throwIfNotWorkItemThread();
+	auto frameworkLock = lockFramework();
 	getPolicyManager()->registerEvent(getPolicyIndex(), policyEvent);
 }
 
 void PolicyServicesPolicyEventRegistration::unregisterEvent(PolicyEvent::Type policyEvent)
 {
 	throwIfNotWorkItemThread();
+	auto frameworkLock = lockFramework();
 	getPolicyManager()->unregisterEvent(getPolicyIndex(), policyEvent);
 }
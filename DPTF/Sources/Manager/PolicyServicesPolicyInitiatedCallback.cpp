@@ -61,9 +61,6 @@ Bool PolicyServicesPolicyInitiatedCallback::removePolicyInitiatedCallback(UInt64
 	// This can be called from any thread
 	WorkItemMatchCriteria matchCriteria;
 	matchCriteria.addPolicyIndexToMatchList(getPolicyIndex());
-	matchCriteria.addUniqueIdToMatchList(callbackHandle);
 
-	UIntN numRemoved = getWorkItemQueueManager()->removeIfMatches(matchCriteria);
-
-	return (numRemoved > 0);
+	return getWorkItemQueueManager()->removeByUniqueId(callbackHandle, matchCriteria);
 }
@@ -20,7 +20,9 @@
 using namespace std;
 
 RequestDispatcher::RequestDispatcher()
-	: m_handlers()
+	: m_routes()
+	, m_walkDepth(0)
+	, m_hasRemovedHandlers(false)
 {
 }
 
@@ -31,44 +33,170 @@ RequestDispatcher::~RequestDispatcher()
 void RequestDispatcher::dispatchForAllControls(const PolicyRequest& policyRequest)
 {
 	auto& request = policyRequest.getRequest();
-	auto handlers = m_handlers[request.getRequestType()];
-	for (auto handler = handlers.begin(); handler != handlers.end(); ++handler)
+	auto targetKey = makeRouteKey(request.getRequestType(), request.getParticipantIndex(), request.getDomainIndex());
+	auto anyTargetKey = makeRouteKey(request.getRequestType(), Constants::Invalid, Constants::Invalid);
+
+	processRequestForAllHandlers(targetKey, policyRequest);
+	if (anyTargetKey != targetKey)
 	{
-		if ((*handler)->canProcessRequest(policyRequest))
-		{
-			(*handler)->processRequest(policyRequest);
-		}
+		processRequestForAllHandlers(anyTargetKey, policyRequest);
 	}
 }
 
 DptfRequestResult RequestDispatcher::dispatch(const PolicyRequest& policyRequest)
 {
 	auto& request = policyRequest.getRequest();
-	auto handlers = m_handlers[request.getRequestType()];
-	for (auto handler = handlers.begin(); handler != handlers.end(); ++handler)
+	auto targetKey = makeRouteKey(request.getRequestType(), request.getParticipantIndex(), request.getDomainIndex());
+	auto anyTargetKey = makeRouteKey(request.getRequestType(), Constants::Invalid, Constants::Invalid);
+
+	auto handler = findHandler(targetKey, policyRequest);
+	if ((handler == nullptr) && (anyTargetKey != targetKey))
 	{
-		if ((*handler)->canProcessRequest(policyRequest))
-		{
-			return (*handler)->processRequest(policyRequest);
-		}
+		handler = findHandler(anyTargetKey, policyRequest);
+	}
+
+	if (handler != nullptr)
+	{
+		return handler->processRequest(policyRequest);
 	}
 	return DptfRequestResult(false, "No handler for request.", request);
 }
 
 void RequestDispatcher::registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler)
 {
-	m_handlers[requestType].insert(handler);
+	addRoute(makeRouteKey(requestType, Constants::Invalid, Constants::Invalid), handler);
+}
+
+void RequestDispatcher::registerHandler(
+	DptfRequestType::Enum requestType,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	RequestHandlerInterface* handler)
+{
+	addRoute(makeRouteKey(requestType, participantIndex, domainIndex), handler);
 }
 
 void RequestDispatcher::unregisterHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler)
 {
-	auto request = m_handlers.find(requestType);
-	if (request != m_handlers.end())
+	removeRoute(makeRouteKey(requestType, Constants::Invalid, Constants::Invalid), handler);
+}
+
+void RequestDispatcher::unregisterHandler(
+	DptfRequestType::Enum requestType,
+	UIntN participantIndex,
+	UIntN domainIndex,
+	RequestHandlerInterface* handler)
+{
+	removeRoute(makeRouteKey(requestType, participantIndex, domainIndex), handler);
+}
+
+RequestDispatcher::RouteKey RequestDispatcher::makeRouteKey(
+	DptfRequestType::Enum requestType,
+	UIntN participantIndex,
+	UIntN domainIndex)
+{
+	// 16 bits of request type, 24 bits each of participant and domain index (Constants::Invalid keeps all bits set)
+	return ((RouteKey)(requestType & 0xFFFF) << 48) | ((RouteKey)(participantIndex & 0xFFFFFF) << 24)
+		   | (RouteKey)(domainIndex & 0xFFFFFF);
+}
+
+const RequestDispatcher::HandlerList* RequestDispatcher::findRoute(RouteKey key) const
+{
+	auto route = m_routes.find(key);
+	if (route == m_routes.end())
+	{
+		return nullptr;
+	}
+	return &route->second;
+}
+
+void RequestDispatcher::addRoute(RouteKey key, RequestHandlerInterface* handler)
+{
+	auto& handlers = m_routes[key];
+	if (std::find(handlers.begin(), handlers.end(), handler) == handlers.end())
+	{
+		handlers.push_back(handler);
+	}
+}
+
+void RequestDispatcher::removeRoute(RouteKey key, RequestHandlerInterface* handler)
+{
+	// empty routes are kept so that a handler unregistering while a request is being dispatched
+	// does not invalidate the list being walked.  During a walk the handler is only cleared, since erasing it
+	// would shift the handlers after it and the walk would skip one.
+	auto route = m_routes.find(key);
+	if (route != m_routes.end())
+	{
+		auto handlerIterator = std::find(route->second.begin(), route->second.end(), handler);
+		if (handlerIterator != route->second.end())
+		{
+			if (m_walkDepth > 0)
+			{
+				*handlerIterator = nullptr;
+				m_hasRemovedHandlers = true;
+			}
+			else
+			{
+				route->second.erase(handlerIterator);
+			}
+		}
+	}
+}
+
+RequestHandlerInterface* RequestDispatcher::findHandler(RouteKey key, const PolicyRequest& policyRequest) const
+{
+	auto handlers = findRoute(key);
+	if (handlers != nullptr)
+	{
+		for (auto handler = handlers->begin(); handler != handlers->end(); ++handler)
+		{
+			if ((*handler != nullptr) && (*handler)->canProcessRequest(policyRequest))
+			{
+				return *handler;
+			}
+		}
+	}
+	return nullptr;
+}
+
+void RequestDispatcher::processRequestForAllHandlers(RouteKey key, const PolicyRequest& policyRequest)
+{
+	auto handlers = findRoute(key);
+	if (handlers != nullptr)
+	{
+		// walk by index since a handler may register another handler while processing the request.  Handlers
+		// unregistered during the walk are cleared in place and removed once no walk is in progress.
+		m_walkDepth++;
+		try
+		{
+			for (size_t index = 0; index < handlers->size(); ++index)
+			{
+				auto handler = (*handlers)[index];
+				if ((handler != nullptr) && handler->canProcessRequest(policyRequest))
+				{
+					handler->processRequest(policyRequest);
+				}
+			}
+		}
+		catch (...)
+		{
+			endWalk();
+			throw;
+		}
+		endWalk();
+	}
+}
+
+void RequestDispatcher::endWalk(void)
+{
+	m_walkDepth--;
+	if ((m_walkDepth == 0) && m_hasRemovedHandlers)
 	{
-		auto handlerIterator = request->second.find(handler);
-		if (handlerIterator != request->second.end())
+		for (auto route = m_routes.begin(); route != m_routes.end(); ++route)
 		{
-			request->second.erase(handlerIterator);
+			auto& handlers = route->second;
+			handlers.erase(std::remove(handlers.begin(), handlers.end(), nullptr), handlers.end());
 		}
+		m_hasRemovedHandlers = false;
 	}
 }
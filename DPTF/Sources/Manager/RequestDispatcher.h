@@ -22,6 +22,8 @@
 #include "PolicyRequest.h"
 #include "RequestHandlerInterface.h"
 #include "DptfRequestResult.h"
+#include <unordered_map>
+#include <algorithm>
 
 class RequestDispatcherInterface
 {
@@ -31,7 +33,17 @@ public:
 	virtual DptfRequestResult dispatch(const PolicyRequest& policyRequest) = 0;
 	virtual void dispatchForAllControls(const PolicyRequest& policyRequest) = 0;
 	virtual void registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
+	virtual void registerHandler(
+		DptfRequestType::Enum requestType,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) = 0;
 	virtual void unregisterHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
+	virtual void unregisterHandler(
+		DptfRequestType::Enum requestType,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) = 0;
 };
 
 class RequestDispatcher : public RequestDispatcherInterface
@@ -42,9 +54,35 @@ public:
 
 	virtual DptfRequestResult dispatch(const PolicyRequest& policyRequest) override;
 	virtual void dispatchForAllControls(const PolicyRequest& policyRequest) override;
+	// Handlers registered without a participant/domain are offered every request of the type
 	virtual void registerHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
+	virtual void registerHandler(
+		DptfRequestType::Enum requestType,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) override;
 	virtual void unregisterHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) override;
+	virtual void unregisterHandler(
+		DptfRequestType::Enum requestType,
+		UIntN participantIndex,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) override;
 
 private:
-	std::map<DptfRequestType::Enum, std::set<RequestHandlerInterface*>> m_handlers;
+	typedef UInt64 RouteKey;
+	typedef std::vector<RequestHandlerInterface*> HandlerList;
+
+	// Handlers are indexed by (request type, participant index, domain index) so a request only reaches
+	// the handlers registered for its target plus the ones registered for the whole request type.
+	std::unordered_map<RouteKey, HandlerList> m_routes;
+	UIntN m_walkDepth;
+	Bool m_hasRemovedHandlers;
+
+	static RouteKey makeRouteKey(DptfRequestType::Enum requestType, UIntN participantIndex, UIntN domainIndex);
+	const HandlerList* findRoute(RouteKey key) const;
+	void addRoute(RouteKey key, RequestHandlerInterface* handler);
+	void removeRoute(RouteKey key, RequestHandlerInterface* handler);
+	RequestHandlerInterface* findHandler(RouteKey key, const PolicyRequest& policyRequest) const;
+	void processRequestForAllHandlers(RouteKey key, const PolicyRequest& policyRequest);
+	void endWalk(void);
 };
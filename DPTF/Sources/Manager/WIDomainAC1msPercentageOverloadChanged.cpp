@@ -54,23 +54,7 @@ void WIDomainAC1msPercentageOverloadChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainAC1msPercentageOverloadChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainAC1msPercentageOverloadChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainAC1msPercentageOverloadChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainAC1msPercentageOverloadChanged", [=](IPolicy* policy) {
+		policy->executeDomainAC1msPercentageOverloadChanged(getParticipantIndex());
+	});
 }
@@ -54,23 +54,7 @@ void WIDomainAC2msPercentageOverloadChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainAC2msPercentageOverloadChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainAC2msPercentageOverloadChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainAC2msPercentageOverloadChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainAC2msPercentageOverloadChanged", [=](IPolicy* policy) {
+		policy->executeDomainAC2msPercentageOverloadChanged(getParticipantIndex());
+	});
 }
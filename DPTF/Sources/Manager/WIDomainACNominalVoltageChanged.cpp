@@ -50,23 +50,7 @@ void WIDomainACNominalVoltageChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainACNominalChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainACNominalVoltageChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainACNominalVoltageChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainACNominalVoltageChanged", [=](IPolicy* policy) {
+		policy->executeDomainACNominalVoltageChanged(getParticipantIndex());
+	});
 }
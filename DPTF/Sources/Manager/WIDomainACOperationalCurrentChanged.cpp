@@ -54,23 +54,7 @@ void WIDomainACOperationalCurrentChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainACOperationalCurrentChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainACOperationalCurrentChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainACOperationalCurrentChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainACOperationalCurrentChanged", [=](IPolicy* policy) {
+		policy->executeDomainACOperationalCurrentChanged(getParticipantIndex());
+	});
 }
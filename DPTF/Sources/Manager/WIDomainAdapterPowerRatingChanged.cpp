@@ -50,23 +50,7 @@ void WIDomainAdapterPowerRatingChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainAdapterPowerRatingChanged");
 	}
 
-	PolicyManagerInterface* policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainAdapterPowerRatingChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainAdapterPowerRatingChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainAdapterPowerRatingChanged", [=](IPolicy* policy) {
+		policy->executeDomainAdapterPowerRatingChanged(getParticipantIndex());
+	});
 }
@@ -54,23 +54,7 @@ void WIDomainBatteryHighFrequencyImpedanceChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainBatteryHighFrequencyImpedanceChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainBatteryHighFrequencyImpedanceChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainBatteryHighFrequencyImpedanceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainBatteryHighFrequencyImpedanceChanged", [=](IPolicy* policy) {
+		policy->executeDomainBatteryHighFrequencyImpedanceChanged(getParticipantIndex());
+	});
 }
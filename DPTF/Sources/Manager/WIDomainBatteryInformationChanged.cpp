@@ -50,23 +50,7 @@ void WIDomainBatteryInformationChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainBatteryInformationChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainBatteryInformationChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainBatteryInformationChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainBatteryInformationChanged", [=](IPolicy* policy) {
+		policy->executeDomainBatteryInformationChanged(getParticipantIndex());
+	});
 }
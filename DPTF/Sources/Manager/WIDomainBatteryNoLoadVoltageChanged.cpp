@@ -55,24 +55,8 @@ void WIDomainBatteryNoLoadVoltageChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainBatteryNoLoadVoltageChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainBatteryNoLoadVoltageChanged(getParticipantIndex());
-			policy->executeDomainMaxBatteryPeakCurrentChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainBatteryNoLoadVoltageChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainBatteryNoLoadVoltageChanged", [=](IPolicy* policy) {
+		policy->executeDomainBatteryNoLoadVoltageChanged(getParticipantIndex());
+		policy->executeDomainMaxBatteryPeakCurrentChanged(getParticipantIndex());
+	});
 }
@@ -50,23 +50,7 @@ void WIDomainBatteryStatusChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainBatteryStatusChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainBatteryStatusChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainBatteryStatusChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainBatteryStatusChanged", [=](IPolicy* policy) {
+		policy->executeDomainBatteryStatusChanged(getParticipantIndex());
+	});
 }
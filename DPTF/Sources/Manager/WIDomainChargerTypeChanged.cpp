@@ -50,23 +50,7 @@ void WIDomainChargerTypeChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainChargerTypeChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainChargerTypeChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainChargerTypeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainChargerTypeChanged", [=](IPolicy* policy) {
+		policy->executeDomainChargerTypeChanged(getParticipantIndex());
+	});
 }
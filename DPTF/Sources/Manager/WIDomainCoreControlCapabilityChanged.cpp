@@ -54,23 +54,7 @@ void WIDomainCoreControlCapabilityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainCoreControlCapabilityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainCoreControlCapabilityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainCoreControlCapabilityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainCoreControlCapabilityChanged", [=](IPolicy* policy) {
+		policy->executeDomainCoreControlCapabilityChanged(getParticipantIndex());
+	});
 }
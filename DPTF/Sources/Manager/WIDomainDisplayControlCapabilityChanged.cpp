@@ -54,23 +54,7 @@ void WIDomainDisplayControlCapabilityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainDisplayControlCapabilityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainDisplayControlCapabilityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainDisplayControlCapabilityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainDisplayControlCapabilityChanged", [=](IPolicy* policy) {
+		policy->executeDomainDisplayControlCapabilityChanged(getParticipantIndex());
+	});
 }
@@ -50,23 +50,7 @@ void WIDomainDisplayStatusChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainDisplayStatusChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainDisplayStatusChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainDisplayStatusChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainDisplayStatusChanged", [=](IPolicy* policy) {
+		policy->executeDomainDisplayStatusChanged(getParticipantIndex());
+	});
 }
@@ -50,23 +50,7 @@ void WIDomainEnergyThresholdCrossed::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainEnergyThresholdCrossed");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainEnergyThresholdCrossed(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainEnergyThresholdCrossed", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainEnergyThresholdCrossed", [=](IPolicy* policy) {
+		policy->executeDomainEnergyThresholdCrossed(getParticipantIndex());
+	});
 }
@@ -52,23 +52,7 @@ void WIDomainEppSensitivityHintChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainEppSensitivityHintChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainEppSensitivityHintChanged(getParticipantIndex(), getDomainIndex(), m_mbtHint);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainEppSensitivityHintChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainEppSensitivityHintChanged", [=](IPolicy* policy) {
+		policy->executeDomainEppSensitivityHintChanged(getParticipantIndex(), getDomainIndex(), m_mbtHint);
+	});
 }
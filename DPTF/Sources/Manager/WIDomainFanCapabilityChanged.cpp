@@ -50,23 +50,7 @@ void WIDomainFanCapabilityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainFanCapabilityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainFanCapabilityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainFanCapabilityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainFanCapabilityChanged", [=](IPolicy* policy) {
+		policy->executeDomainFanCapabilityChanged(getParticipantIndex());
+	});
 }
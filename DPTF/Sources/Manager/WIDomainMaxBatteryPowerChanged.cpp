@@ -50,23 +50,7 @@ void WIDomainMaxBatteryPowerChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainMaxBatteryPowerChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainMaxBatteryPowerChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainMaxBatteryPowerChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainMaxBatteryPowerChanged", [=](IPolicy* policy) {
+		policy->executeDomainMaxBatteryPowerChanged(getParticipantIndex());
+	});
 }
@@ -54,23 +54,7 @@ void WIDomainPerformanceControlCapabilityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPerformanceControlCapabilityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPerformanceControlCapabilityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPerformanceControlCapabilityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPerformanceControlCapabilityChanged", [=](IPolicy* policy) {
+		policy->executeDomainPerformanceControlCapabilityChanged(getParticipantIndex());
+	});
 }
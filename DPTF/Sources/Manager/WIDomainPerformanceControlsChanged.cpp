@@ -50,23 +50,7 @@ void WIDomainPerformanceControlsChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPerformanceControlsChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPerformanceControlsChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPerformanceControlsChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPerformanceControlsChanged", [=](IPolicy* policy) {
+		policy->executeDomainPerformanceControlsChanged(getParticipantIndex());
+	});
 }
@@ -54,23 +54,7 @@ void WIDomainPlatformBatterySteadyStateChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPlatformBatterySteadyStateChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPlatformBatterySteadyStateChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPlatformBatterySteadyStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPlatformBatterySteadyStateChanged", [=](IPolicy* policy) {
+		policy->executeDomainPlatformBatterySteadyStateChanged(getParticipantIndex());
+	});
 }
@@ -56,38 +56,22 @@ void WIDomainPlatformPowerSourceChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPlatformPowerSourceChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	executeOnAllPolicies("Policy::executeDomainPlatformPowerSourceChanged", [=](IPolicy* policy) {
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-
-			// FIXME:
-			// As requested by DPTF architecture, the event for power source changed
-			// should also result in DPTF re-reading up to 3 other data items.  Because
-			// we do not have separate events for these on the platform, we are
-			// representing these data change events separately in DPTF only.
-			// Alternative is to represent all 4 pieces of information as a single
-			// data structure with a single event mapped to it, or BIOS/EC should send
-			// a different event code for each item if it changes.
-			policy->executeDomainPlatformPowerSourceChanged(getParticipantIndex());
-			policy->executeDomainAdapterPowerRatingChanged(getParticipantIndex());
-			policy->executeDomainACNominalVoltageChanged(getParticipantIndex());
-			policy->executeDomainACOperationalCurrentChanged(getParticipantIndex());
-			policy->executeDomainAC1msPercentageOverloadChanged(getParticipantIndex());
-			policy->executeDomainAC2msPercentageOverloadChanged(getParticipantIndex());
-			policy->executeDomainAC10msPercentageOverloadChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPlatformPowerSourceChanged", *i);
-		}
-	}
+		// FIXME:
+		// As requested by DPTF architecture, the event for power source changed
+		// should also result in DPTF re-reading up to 3 other data items.  Because
+		// we do not have separate events for these on the platform, we are
+		// representing these data change events separately in DPTF only.
+		// Alternative is to represent all 4 pieces of information as a single
+		// data structure with a single event mapped to it, or BIOS/EC should send
+		// a different event code for each item if it changes.
+		policy->executeDomainPlatformPowerSourceChanged(getParticipantIndex());
+		policy->executeDomainAdapterPowerRatingChanged(getParticipantIndex());
+		policy->executeDomainACNominalVoltageChanged(getParticipantIndex());
+		policy->executeDomainACOperationalCurrentChanged(getParticipantIndex());
+		policy->executeDomainAC1msPercentageOverloadChanged(getParticipantIndex());
+		policy->executeDomainAC2msPercentageOverloadChanged(getParticipantIndex());
+		policy->executeDomainAC10msPercentageOverloadChanged(getParticipantIndex());
+	});
 }
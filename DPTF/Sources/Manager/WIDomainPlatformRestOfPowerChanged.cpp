@@ -50,23 +50,7 @@ void WIDomainPlatformRestOfPowerChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPlatformRestOfPowerChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPlatformRestOfPowerChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPlatformRestOfPowerChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPlatformRestOfPowerChanged", [=](IPolicy* policy) {
+		policy->executeDomainPlatformRestOfPowerChanged(getParticipantIndex());
+	});
 }
@@ -54,23 +54,7 @@ void WIDomainPowerControlCapabilityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPowerControlCapabilityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPowerControlCapabilityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPowerControlCapabilityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPowerControlCapabilityChanged", [=](IPolicy* policy) {
+		policy->executeDomainPowerControlCapabilityChanged(getParticipantIndex());
+	});
 }
@@ -50,23 +50,7 @@ void WIDomainPriorityChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainPriorityChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainPriorityChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainPriorityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainPriorityChanged", [=](IPolicy* policy) {
+		policy->executeDomainPriorityChanged(getParticipantIndex());
+	});
 }
@@ -56,23 +56,7 @@ void WIDomainRadioConnectionStatusChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainRadioConnectionStatusChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainRadioConnectionStatusChanged(getParticipantIndex(), m_radioConnectionStatus);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainRadioConnectionStatusChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainRadioConnectionStatusChanged", [=](IPolicy* policy) {
+		policy->executeDomainRadioConnectionStatusChanged(getParticipantIndex(), m_radioConnectionStatus);
+	});
 }
@@ -50,23 +50,7 @@ void WIDomainRfProfileChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainRfProfileChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainRfProfileChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainRfProfileChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainRfProfileChanged", [=](IPolicy* policy) {
+		policy->executeDomainRfProfileChanged(getParticipantIndex());
+	});
 }
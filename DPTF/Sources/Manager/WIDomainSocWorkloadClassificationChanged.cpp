@@ -52,23 +52,7 @@ void WIDomainSocWorkloadClassificationChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainSocWorkloadClassificationChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainSocWorkloadClassificationChanged(getParticipantIndex(), getDomainIndex(), m_socWorkloadClassification);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainSocWorkloadClassificationChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainSocWorkloadClassificationChanged", [=](IPolicy* policy) {
+		policy->executeDomainSocWorkloadClassificationChanged(getParticipantIndex(), getDomainIndex(), m_socWorkloadClassification);
+	});
 }
@@ -50,23 +50,15 @@ void WIDomainTemperatureThresholdCrossed::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainTemperatureThresholdCrossed");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	executeOnAllPolicies("Policy::executeDomainTemperatureThresholdCrossed", [=](IPolicy* policy) {
+		policy->executeDomainTemperatureThresholdCrossed(getParticipantIndex());
+	});
+}
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainTemperatureThresholdCrossed(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemWarningMessagePolicy(ex, "Policy::executeDomainTemperatureThresholdCrossed", *i);
-		}
-	}
+void WIDomainTemperatureThresholdCrossed::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeDomainWorkItemWarningMessagePolicy(ex, functionName, policyIndex);
 }
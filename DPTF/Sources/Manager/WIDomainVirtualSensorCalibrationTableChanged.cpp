@@ -54,23 +54,7 @@ void WIDomainVirtualSensorCalibrationTableChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainVirtualSensorCalibrationTableChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainVirtualSensorCalibrationTableChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainVirtualSensorCalibrationTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainVirtualSensorCalibrationTableChanged", [=](IPolicy* policy) {
+		policy->executeDomainVirtualSensorCalibrationTableChanged(getParticipantIndex());
+	});
 }
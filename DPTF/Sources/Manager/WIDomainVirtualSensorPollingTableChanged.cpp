@@ -50,23 +50,7 @@ void WIDomainVirtualSensorPollingTableChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainVirtualSensorPollingTableChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainVirtualSensorPollingTableChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainVirtualSensorPollingTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainVirtualSensorPollingTableChanged", [=](IPolicy* policy) {
+		policy->executeDomainVirtualSensorPollingTableChanged(getParticipantIndex());
+	});
 }
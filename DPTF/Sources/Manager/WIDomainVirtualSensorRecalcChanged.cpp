@@ -50,23 +50,7 @@ void WIDomainVirtualSensorRecalcChanged::onExecute(void)
 		writeDomainWorkItemErrorMessage(ex, "Participant::domainVirtualSensorRecalcChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeDomainVirtualSensorRecalcChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeDomainWorkItemErrorMessagePolicy(ex, "Policy::executeDomainVirtualSensorRecalcChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executeDomainVirtualSensorRecalcChanged", [=](IPolicy* policy) {
+		policy->executeDomainVirtualSensorRecalcChanged(getParticipantIndex());
+	});
 }
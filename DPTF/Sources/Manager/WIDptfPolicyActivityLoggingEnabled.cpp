@@ -36,23 +36,7 @@ void WIDptfPolicyActivityLoggingEnabled::onExecute(void)
 
 	// notify all policies
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyActivityLoggingEnabled();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyActivityLoggingEnabled", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyActivityLoggingEnabled", [=](IPolicy* policy) {
+		policy->executePolicyActivityLoggingEnabled();
+	});
 }
@@ -49,27 +49,15 @@ void WIParticipantSpecificInfoChanged::onExecute(void)
 		writeParticipantWorkItemErrorMessage(ex, "Participant::participantSpecificInfoChanged");
 	}
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	executeOnAllPolicies("Policy::executeParticipantSpecificInfoChanged", [=](IPolicy* policy) {
+		policy->executeParticipantSpecificInfoChanged(getParticipantIndex());
+	});
+}
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executeParticipantSpecificInfoChanged(getParticipantIndex());
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (temperature_out_of_range& ex)
-		{
-			writeParticipantWorkItemWarningMessagePolicy(ex, "Policy::executeParticipantSpecificInfoChanged", *i);
-		}
-		catch (std::exception& ex)
-		{
-			writeParticipantWorkItemWarningMessagePolicy(ex, "Policy::executeParticipantSpecificInfoChanged", *i);
-		}
-	}
+void WIParticipantSpecificInfoChanged::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeParticipantWorkItemWarningMessagePolicy(ex, functionName, policyIndex);
 }
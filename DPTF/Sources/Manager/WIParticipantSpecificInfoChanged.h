@@ -28,4 +28,11 @@ public:
 	virtual ~WIParticipantSpecificInfoChanged(void);
 
 	virtual void onExecute(void) override final;
+
+protected:
+	// policy failures for this event are expected while sensors settle and are only logged as warnings
+	virtual void writeWorkItemPolicyExceptionMessage(
+		const std::exception& ex,
+		const std::string& functionName,
+		UIntN policyIndex) const override;
 };
@@ -34,23 +34,7 @@ void WIPerformanceCapabilitiesChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePerformanceCapabilitiesChanged(m_participantIndex);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePerformanceCapabilitiesChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePerformanceCapabilitiesChanged", [=](IPolicy* policy) {
+		policy->executePerformanceCapabilitiesChanged(m_participantIndex);
+	});
 }
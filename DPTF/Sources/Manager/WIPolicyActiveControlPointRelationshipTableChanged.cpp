@@ -34,23 +34,7 @@ void WIPolicyActiveControlPointRelationshipTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyActiveControlPointRelationshipTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyActiveControlPointRelationshipTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyActiveControlPointRelationshipTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyActiveControlPointRelationshipTableChanged();
+	});
 }
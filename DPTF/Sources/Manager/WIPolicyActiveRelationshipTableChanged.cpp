@@ -33,23 +33,7 @@ void WIPolicyActiveRelationshipTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyActiveRelationshipTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyActiveRelationshipTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyActiveRelationshipTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyActiveRelationshipTableChanged();
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyAdaptiveDimmingFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->adaptiveDimmingFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->adaptiveDimmingFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyAdaptiveDimmingFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptiveDimmingFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyAdaptiveDimmingFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyAdaptiveDimmingFeatureStateChanged(m_state);
+	});
 }
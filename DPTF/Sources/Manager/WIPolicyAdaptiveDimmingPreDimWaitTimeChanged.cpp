@@ -36,24 +36,9 @@ void WIPolicyAdaptiveDimmingPreDimWaitTimeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->adaptiveDimmingPreDimWaitTime.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->adaptiveDimmingPreDimWaitTime.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyAdaptiveDimmingPreDimWaitTimeChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptiveDimmingPreDimWaitTimeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyAdaptiveDimmingPreDimWaitTimeChanged", [=](IPolicy* policy) {
+		policy->executePolicyAdaptiveDimmingPreDimWaitTimeChanged(m_time);
+	});
 }
@@ -38,24 +38,10 @@ void WIPolicyAdaptiveDimmingWithExternalMonitorFeatureStateChanged::onExecute(vo
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->adaptiveDimmingWithExternalMonitorFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->adaptiveDimmingWithExternalMonitorFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyAdaptiveDimmingWithExternalMonitorFeatureStateChanged", [=](IPolicy* policy) {
 			policy->executePolicyAdaptiveDimmingWithExternalMonitorFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptiveDimmingWithExternalMonitorFeatureStateChanged", *i);
-		}
-	}
+		});
 }
@@ -38,24 +38,10 @@ void WIPolicyAdaptiveDimmingWithPresentationmodeFeatureStateChanged::onExecute(v
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->adaptiveDimmingWithPresentationModeFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->adaptiveDimmingWithPresentationModeFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyAdaptiveDimmingWithPresentationModeFeatureStateChanged", [=](IPolicy* policy) {
 			policy->executePolicyAdaptiveDimmingWithPresentationModeFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptiveDimmingWithPresentationModeFeatureStateChanged", *i);
-		}
-	}
+		});
 }
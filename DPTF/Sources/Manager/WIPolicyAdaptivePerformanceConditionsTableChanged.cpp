@@ -34,23 +34,7 @@ void WIPolicyAdaptivePerformanceConditionsTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyAdaptivePerformanceConditionsTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptivePerformanceConditionsTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyAdaptivePerformanceConditionsTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyAdaptivePerformanceConditionsTableChanged();
+	});
 }
@@ -35,24 +35,8 @@ void WIPolicyAdaptivePerformanceParticipantConditionTableChanged::onExecute(void
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyAdaptivePerformanceParticipantConditionTableChanged", [=](IPolicy* policy) {
 			policy->executePolicyAdaptivePerformanceParticipantConditionTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(
-				ex, "Policy::executePolicyAdaptivePerformanceParticipantConditionTableChanged", *i);
-		}
-	}
+		});
 }
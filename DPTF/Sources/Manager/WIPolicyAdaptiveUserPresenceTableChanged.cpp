@@ -33,23 +33,7 @@ void WIPolicyAdaptiveUserPresenceTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyAdaptiveUserPresenceTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyAdaptiveUserPresenceTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyAdaptiveUserPresenceTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyAdaptiveUserPresenceTableChanged();
+	});
 }
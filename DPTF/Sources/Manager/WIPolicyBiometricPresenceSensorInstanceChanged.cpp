@@ -36,24 +36,9 @@ void WIPolicyBiometricPresenceSensorInstanceChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->biometricPresenceSensorInstance.set(m_sensorInstance);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->biometricPresenceSensorInstance.set(m_sensorInstance);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyBiometricPresenceSensorInstanceChanged(m_sensorInstance);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyBiometricPresencesensorInstanceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyBiometricPresencesensorInstanceChanged", [=](IPolicy* policy) {
+		policy->executePolicyBiometricPresenceSensorInstanceChanged(m_sensorInstance);
+	});
 }
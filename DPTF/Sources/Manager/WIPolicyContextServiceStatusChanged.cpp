@@ -36,24 +36,9 @@ void WIPolicyContextServiceStatusChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->contextServiceStatus.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->contextServiceStatus.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyContextServiceStatusChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyContextServiceStatusChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyContextServiceStatusChanged", [=](IPolicy* policy) {
+		policy->executePolicyContextServiceStatusChanged(m_state);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyCoolingModePolicyChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->coolingMode.set(m_coolingMode);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->coolingMode.set(m_coolingMode);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyCoolingModePolicyChanged(m_coolingMode);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyCoolingModePolicyChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyCoolingModePolicyChanged", [=](IPolicy* policy) {
+		policy->executePolicyCoolingModePolicyChanged(m_coolingMode);
+	});
 }
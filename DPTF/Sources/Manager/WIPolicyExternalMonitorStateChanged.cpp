@@ -36,24 +36,9 @@ void WIPolicyExternalMonitorStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->externalMonitorState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->externalMonitorState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyExternalMonitorStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyExternalMonitorStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyExternalMonitorStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyExternalMonitorStateChanged(m_state);
+	});
 }
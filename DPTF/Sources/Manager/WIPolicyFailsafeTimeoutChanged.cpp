@@ -36,24 +36,9 @@ void WIPolicyFailsafeTimeoutChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->failsafeTimeout.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->failsafeTimeout.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyFailsafeTimeoutChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyFailsafeTimeoutChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyFailsafeTimeoutChanged", [=](IPolicy* policy) {
+		policy->executePolicyFailsafeTimeoutChanged(m_time);
+	});
 }
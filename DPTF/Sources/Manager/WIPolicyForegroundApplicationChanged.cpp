@@ -36,24 +36,9 @@ void WIPolicyForegroundApplicationChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->foregroundApplication.set(m_foregroundApplicationName);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->foregroundApplication.set(m_foregroundApplicationName);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyForegroundApplicationChanged(m_foregroundApplicationName);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyForegroundApplicationChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyForegroundApplicationChanged", [=](IPolicy* policy) {
+		policy->executePolicyForegroundApplicationChanged(m_foregroundApplicationName);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyForegroundRatioChanged::onExecute()
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	//getDptfManager()->getEventCache()->foregroundRatio.set(m_ratio);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			//getDptfManager()->getEventCache()->foregroundRatio.set(m_ratio);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyForegroundRatioChanged(m_ratio);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyForegroundRatioChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyForegroundRatioChanged", [=](IPolicy* policy) {
+		policy->executePolicyForegroundRatioChanged(m_ratio);
+	});
 }
@@ -42,19 +42,18 @@ void WIPolicyInitiatedCallback::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	try
-	{
-		auto policy = getPolicyManager()->getPolicyPtr(m_policyIndex);
+	// The callback must run on the policy's executor queue so it is serialized with the rest of its work
+	executeOnSinglePolicy(m_policyIndex, "Policy::executePolicyInitiatedCallback", [=](IPolicy* policy) {
 		policy->executePolicyInitiatedCallback(m_policyDefinedEventCode, m_param1, m_param2);
-	}
-	catch (policy_index_invalid&)
-	{
-		// do nothing.  No item in the policy list at this index.
-	}
-	catch (std::exception& ex)
-	{
-		writeWorkItemWarningMessagePolicy(ex, "Policy::executePolicyInitiatedCallback", m_policyIndex);
-	}
+	});
+}
+
+void WIPolicyInitiatedCallback::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeWorkItemWarningMessagePolicy(ex, functionName, policyIndex);
 }
 
 Bool WIPolicyInitiatedCallback::matches(const WorkItemMatchCriteria& matchCriteria) const
@@ -35,6 +35,12 @@ public:
 	virtual Bool matches(const WorkItemMatchCriteria& matchCriteria) const override;
 	virtual void onExecute(void) override final;
 
+protected:
+	virtual void writeWorkItemPolicyExceptionMessage(
+		const std::exception& ex,
+		const std::string& functionName,
+		UIntN policyIndex) const override;
+
 private:
 	const UIntN m_policyIndex;
 	const UInt64 m_policyDefinedEventCode;
@@ -36,24 +36,9 @@ void WIPolicyMisprediction2DimWaitTimeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->misprediction2DimWaitTime.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->misprediction2DimWaitTime.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyMisprediction2DimWaitTimeChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyMisprediction2DimWaitTimeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyMisprediction2DimWaitTimeChanged", [=](IPolicy* policy) {
+		policy->executePolicyMisprediction2DimWaitTimeChanged(m_time);
+	});
 }
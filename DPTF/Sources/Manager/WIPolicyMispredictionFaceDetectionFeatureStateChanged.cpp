@@ -36,24 +36,9 @@ void WIPolicyMispredictionFaceDetectionFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->mispredictionFaceDetectionFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->mispredictionFaceDetectionFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyMispredictionFaceDetectionFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyMispredictionFaceDetectionFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyMispredictionFaceDetectionFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyMispredictionFaceDetectionFeatureStateChanged(m_state);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyMispredictionTimeWindowChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->mispredictionTimeWindow.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->mispredictionTimeWindow.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyMispredictionTimeWindowChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyMispredictionTimeWindowChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyMispredictionTimeWindowChanged", [=](IPolicy* policy) {
+		policy->executePolicyMispredictionTimeWindowChanged(m_time);
+	});
 }
@@ -37,24 +37,10 @@ void WIPolicyNoLockOnPresenceBatteryRemainingPercentageChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->noLockOnPresenceBatteryRemainingPercentage.set(m_remainingPercentage);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->noLockOnPresenceBatteryRemainingPercentage.set(m_remainingPercentage);
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyNoLockOnPresenceBatteryRemainingPercentageChanged", [=](IPolicy* policy) {
 			policy->executePolicyNoLockOnPresenceBatteryRemainingPercentageChanged(m_remainingPercentage);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyNoLockOnPresenceBatteryRemainingPercentageChanged", *i);
-		}
-	}
+		});
 }
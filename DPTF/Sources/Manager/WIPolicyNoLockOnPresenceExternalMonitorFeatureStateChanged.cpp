@@ -37,24 +37,10 @@ void WIPolicyNoLockOnPresenceExternalMonitorFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->noLockOnPresenceExternalMonitorFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->noLockOnPresenceExternalMonitorFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyNoLockOnPresenceExternalMonitorFeatureStateChanged", [=](IPolicy* policy) {
 			policy->executePolicyNoLockOnPresenceExternalMonitorFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyNoLockOnPresenceExternalMonitorFeatureStateChanged", *i);
-		}
-	}
+		});
 }
@@ -36,24 +36,9 @@ void WIPolicyNoLockOnPresenceFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->noLockOnPresenceFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->noLockOnPresenceFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyNoLockOnPresenceFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyNoLockOnPresenceFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyNoLockOnPresenceFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyNoLockOnPresenceFeatureStateChanged(m_state);
+	});
 }
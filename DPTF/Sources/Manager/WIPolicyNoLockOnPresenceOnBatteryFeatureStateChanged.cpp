@@ -36,24 +36,9 @@ void WIPolicyNoLockOnPresenceOnBatteryFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->noLockOnPresenceOnBatteryFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->noLockOnPresenceOnBatteryFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyNoLockOnPresenceOnBatteryFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyNoLockOnPresenceOnBatteryFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyNoLockOnPresenceOnBatteryFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyNoLockOnPresenceOnBatteryFeatureStateChanged(m_state);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyNoLockOnPresenceResetWaitTimeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->noLockOnPresenceResetWaitTime.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->noLockOnPresenceResetWaitTime.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyNoLockOnPresenceResetWaitTimeChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyNoLockOnPresenceResetWaitTimeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyNoLockOnPresenceResetWaitTimeChanged", [=](IPolicy* policy) {
+		policy->executePolicyNoLockOnPresenceResetWaitTimeChanged(m_time);
+	});
 }
@@ -33,23 +33,7 @@ void WIPolicyOemVariablesChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOemVariablesChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOemVariablesChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOemVariablesChanged", [=](IPolicy* policy) {
+		policy->executePolicyOemVariablesChanged();
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemBatteryCountChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->batteryCount.set(m_batteryCount);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->batteryCount.set(m_batteryCount);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemBatteryCountChanged(m_batteryCount);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemBatteryCountChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemBatteryCountChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemBatteryCountChanged(m_batteryCount);
+	});
 }
@@ -36,8 +36,6 @@ void WIPolicyOperatingSystemBatteryPercentageChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
 	UIntN osBatteryPercentage = 0;
 
 	if (m_batteryPercentage <= 100)
@@ -45,21 +43,9 @@ void WIPolicyOperatingSystemBatteryPercentageChanged::onExecute(void)
 		osBatteryPercentage = m_batteryPercentage;
 	}
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->batteryPercentage.set(osBatteryPercentage);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemBatteryPercentageChanged(osBatteryPercentage);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemBatteryPercentageChanged", *i);
-		}
-	}
+	getDptfManager()->getEventCache()->batteryPercentage.set(osBatteryPercentage);
+
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemBatteryPercentageChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemBatteryPercentageChanged(osBatteryPercentage);
+	});
 }
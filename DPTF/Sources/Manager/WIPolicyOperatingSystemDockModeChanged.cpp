@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemDockModeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->dockMode.set(m_dockMode);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->dockMode.set(m_dockMode);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemDockModeChanged(m_dockMode);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemDockModeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemDockModeChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemDockModeChanged(m_dockMode);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemGameModeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->gameMode.set(m_gameMode);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->gameMode.set(m_gameMode);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemGameModeChanged(m_gameMode);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemGameModeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemGameModeChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemGameModeChanged(m_gameMode);
+	});
 }
\ No newline at end of file
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemLidStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->lidState.set(m_lidState);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->lidState.set(m_lidState);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemLidStateChanged(m_lidState);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemLidStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemLidStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemLidStateChanged(m_lidState);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemMixedRealityModeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->mixedRealityMode.set(m_mixedRealityMode);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->mixedRealityMode.set(m_mixedRealityMode);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemMixedRealityModeChanged(m_mixedRealityMode);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemMixedRealityModeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemMixedRealityModeChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemMixedRealityModeChanged(m_mixedRealityMode);
+	});
 }
@@ -37,50 +37,33 @@ void WIPolicyOperatingSystemMobileNotification::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	OsMobileNotificationType::Type notificationType =
+		(OsMobileNotificationType::Type)(((UInt32)m_mobileNotification & 0xFFFF0000) >> 16);
+	UInt32 notificationValue = (UInt32)m_mobileNotification & 0xFFFF;
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
+	switch (notificationType)
 	{
-		std::string functionName = "";
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
+	case OsMobileNotificationType::EmergencyCallMode:
+		getDptfManager()->getEventCache()->emergencyCallModeState.set(notificationValue);
+		executeOnAllPolicies("Policy::executePolicyOperatingSystemEmergencyCallModeStateChanged", [=](IPolicy* policy) {
+			policy->executePolicyOperatingSystemEmergencyCallModeStateChanged((OnOffToggle::Type)notificationValue);
+		});
+		break;
 
-			OsMobileNotificationType::Type notificationType =
-				(OsMobileNotificationType::Type)(((UInt32)m_mobileNotification & 0xFFFF0000) >> 16);
-			UInt32 notificationValue = (UInt32)m_mobileNotification & 0xFFFF;
-
-			switch (notificationType)
-			{
-			case OsMobileNotificationType::EmergencyCallMode:
-				getDptfManager()->getEventCache()->emergencyCallModeState.set(notificationValue);
-				functionName = "Policy::executePolicyOperatingSystemEmergencyCallModeStateChanged";
-				policy->executePolicyOperatingSystemEmergencyCallModeStateChanged((OnOffToggle::Type)notificationValue);
-				break;
-
-			case OsMobileNotificationType::ScreenState:
-			{
-				OnOffToggle::Type screenState = OnOffToggle::toType(notificationValue);
-				getDptfManager()->getEventCache()->screenState.set(screenState);
-				functionName = "Policy::executePolicyOperatingSystemScreenStateChanged";
-				policy->executePolicyOperatingSystemScreenStateChanged(screenState);
-			}
-				break;
+	case OsMobileNotificationType::ScreenState:
+	{
+		OnOffToggle::Type screenState = OnOffToggle::toType(notificationValue);
+		getDptfManager()->getEventCache()->screenState.set(screenState);
+		executeOnAllPolicies("Policy::executePolicyOperatingSystemScreenStateChanged", [=](IPolicy* policy) {
+			policy->executePolicyOperatingSystemScreenStateChanged(screenState);
+		});
+	}
+		break;
 
-			default:
-				functionName = "Policy::executePolicyOperatingSystemMobileNotification";
-				policy->executePolicyOperatingSystemMobileNotification(notificationType, notificationValue);
-				break;
-			}
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, functionName, *i);
-		}
+	default:
+		executeOnAllPolicies("Policy::executePolicyOperatingSystemMobileNotification", [=](IPolicy* policy) {
+			policy->executePolicyOperatingSystemMobileNotification(notificationType, notificationValue);
+		});
+		break;
 	}
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemPlatformTypeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->platformType.set(m_platformType);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->platformType.set(m_platformType);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemPlatformTypeChanged(m_platformType);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemPlatformTypeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemPlatformTypeChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemPlatformTypeChanged(m_platformType);
+	});
 }
@@ -36,25 +36,9 @@ void WIPolicyOperatingSystemPowerSchemePersonalityChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->powerSchemePersonality.set(m_powerSchemePersonality);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->powerSchemePersonality.set(m_powerSchemePersonality);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemPowerSchemePersonalityChanged(m_powerSchemePersonality);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(
-				ex, "Policy::executePolicyOperatingSystemPowerSchemePersonalityChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemPowerSchemePersonalityChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemPowerSchemePersonalityChanged(m_powerSchemePersonality);
+	});
 }
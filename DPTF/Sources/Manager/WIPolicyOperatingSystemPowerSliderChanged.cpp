@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemPowerSliderChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->powerSlider.set(m_powerSlider);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->powerSlider.set(m_powerSlider);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemPowerSliderChanged(m_powerSlider);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemPowerSliderChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemPowerSliderChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemPowerSliderChanged(m_powerSlider);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemPowerSourceChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->powerSource.set(m_powerSource);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->powerSource.set(m_powerSource);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemPowerSourceChanged(m_powerSource);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemPowerSourceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemPowerSourceChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemPowerSourceChanged(m_powerSource);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemScreenStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->screenState.set(m_screenState);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->screenState.set(m_screenState);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemScreenStateChanged(m_screenState);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemScreenStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemScreenStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemScreenStateChanged(m_screenState);
+	});
 }
@@ -37,24 +37,9 @@ void WIPolicyOperatingSystemSessionStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sessionState.set(m_sessionState);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sessionState.set(m_sessionState);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemSessionStateChanged(m_sessionState);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemSessionStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemSessionStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemSessionStateChanged(m_sessionState);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyOperatingSystemUserPresenceChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->osUserPresence.set(m_osUserPresence);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->osUserPresence.set(m_osUserPresence);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyOperatingSystemUserPresenceChanged(m_osUserPresence);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyOperatingSystemUserPresenceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyOperatingSystemUserPresenceChanged", [=](IPolicy* policy) {
+		policy->executePolicyOperatingSystemUserPresenceChanged(m_osUserPresence);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyPlatformUserPresenceChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorUserPresence.set(m_platformUserPresence);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorUserPresence.set(m_platformUserPresence);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyPlatformUserPresenceChanged(m_platformUserPresence);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyPlatformUserPresenceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyPlatformUserPresenceChanged", [=](IPolicy* policy) {
+		policy->executePolicyPlatformUserPresenceChanged(m_platformUserPresence);
+	});
 }
@@ -33,23 +33,7 @@ void WIPolicyPowerBossMathTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyPowerBossMathTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyPowerBossMathTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyPowerBossMathTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyPowerBossMathTableChanged();
+	});
 }
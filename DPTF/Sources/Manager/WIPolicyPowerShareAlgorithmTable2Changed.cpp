@@ -33,23 +33,7 @@ void WIPolicyPowerShareAlgorithmTable2Changed::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyPowerShareAlgorithmTable2Changed();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyPowerShareAlgorithmTable2Changed", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyPowerShareAlgorithmTable2Changed", [=](IPolicy* policy) {
+		policy->executePolicyPowerShareAlgorithmTable2Changed();
+	});
 }
@@ -33,23 +33,7 @@ void WIPolicyPowerShareAlgorithmTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyPowerShareAlgorithmTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyPowerShareAlgorithmTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyPowerShareAlgorithmTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyPowerShareAlgorithmTableChanged();
+	});
 }
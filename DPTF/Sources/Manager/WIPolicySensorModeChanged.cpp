@@ -35,24 +35,9 @@ void WIPolicySensorModeChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorMode.set(m_sensorMode);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorMode.set(m_sensorMode);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicySensorModeChanged(m_sensorMode);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicySensorModeChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicySensorModeChanged", [=](IPolicy* policy) {
+		policy->executePolicySensorModeChanged(m_sensorMode);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicySensorMotionChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorMotion.set(m_sensorMotion);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorMotion.set(m_sensorMotion);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicySensorMotionChanged(m_sensorMotion);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicySensorMotionChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicySensorMotionChanged", [=](IPolicy* policy) {
+		policy->executePolicySensorMotionChanged(m_sensorMotion);
+	});
 }
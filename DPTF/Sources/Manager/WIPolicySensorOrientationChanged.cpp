@@ -36,24 +36,9 @@ void WIPolicySensorOrientationChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorOrientation.set(m_sensorOrientation);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorOrientation.set(m_sensorOrientation);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicySensorOrientationChanged(m_sensorOrientation);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicySensorOrientationChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicySensorOrientationChanged", [=](IPolicy* policy) {
+		policy->executePolicySensorOrientationChanged(m_sensorOrientation);
+	});
 }
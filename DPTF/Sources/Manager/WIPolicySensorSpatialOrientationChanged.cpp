@@ -36,24 +36,9 @@ void WIPolicySensorSpatialOrientationChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorSpatialOrientation.set(m_sensorSpatialOrientation);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorSpatialOrientation.set(m_sensorSpatialOrientation);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicySensorSpatialOrientationChanged(m_sensorSpatialOrientation);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicySensorSpatialOrientationChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicySensorSpatialOrientationChanged", [=](IPolicy* policy) {
+		policy->executePolicySensorSpatialOrientationChanged(m_sensorSpatialOrientation);
+	});
 }
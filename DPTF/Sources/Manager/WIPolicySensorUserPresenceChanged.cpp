@@ -36,24 +36,9 @@ void WIPolicySensorUserPresenceChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->sensorUserPresence.set(m_sensorUserPresence);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->sensorUserPresence.set(m_sensorUserPresence);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicySensorUserPresenceChanged(m_sensorUserPresence);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicySensorUserPresenceChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicySensorUserPresenceChanged", [=](IPolicy* policy) {
+		policy->executePolicySensorUserPresenceChanged(m_sensorUserPresence);
+	});
 }
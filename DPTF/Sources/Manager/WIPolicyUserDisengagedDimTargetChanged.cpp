@@ -36,24 +36,9 @@ void WIPolicyUserDisengagedDimTargetChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->disengagedDimTarget.set(m_value);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->disengagedDimTarget.set(m_value);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserDisengagedDimTargetChanged(m_value);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserDisengagedDimTargetChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserDisengagedDimTargetChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserDisengagedDimTargetChanged(m_value);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyUserDisengagedDimmingIntervalChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->disengagedDimmingInterval.set(m_value);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->disengagedDimmingInterval.set(m_value);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserDisengagedDimmingIntervalChanged(m_value);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserDisengagedDimmingIntervalChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserDisengagedDimmingIntervalChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserDisengagedDimmingIntervalChanged(m_value);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyUserInCallStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->userInCallState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->userInCallState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserInCallStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserInCallStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserInCallStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserInCallStateChanged(m_state);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyUserInteractionChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->userInteraction.set(m_userInteraction);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->userInteraction.set(m_userInteraction);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserInteractionChanged(m_userInteraction);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserInteractionChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserInteractionChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserInteractionChanged(m_userInteraction);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyUserNotPresentDimTargetChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->notPresentDimTarget.set(m_value);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->notPresentDimTarget.set(m_value);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserNotPresentDimTargetChanged(m_value);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserNotPresentDimTargetChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserNotPresentDimTargetChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserNotPresentDimTargetChanged(m_value);
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyUserPresenceCorrelationStatusChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->userPresenceCorrelation.set(m_correlationStatus);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->userPresenceCorrelation.set(m_correlationStatus);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyUserPresenceCorrelationStatusChanged(m_correlationStatus);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyUserPresenceCorrelationStatusChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyUserPresenceCorrelationStatusChanged", [=](IPolicy* policy) {
+		policy->executePolicyUserPresenceCorrelationStatusChanged(m_correlationStatus);
+	});
 }
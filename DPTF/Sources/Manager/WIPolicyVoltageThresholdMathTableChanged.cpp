@@ -33,23 +33,7 @@ void WIPolicyVoltageThresholdMathTableChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyVoltageThresholdMathTableChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyVoltageThresholdMathTableChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyVoltageThresholdMathTableChanged", [=](IPolicy* policy) {
+		policy->executePolicyVoltageThresholdMathTableChanged();
+	});
 }
@@ -36,24 +36,9 @@ void WIPolicyWakeOnApproachBatteryRemainingPercentageChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->wakeOnApproachBatteryRemainingPercentage.set(m_remainingPercentage);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->wakeOnApproachBatteryRemainingPercentage.set(m_remainingPercentage);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWakeOnApproachBatteryRemainingPercentageChanged(m_remainingPercentage);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWakeOnApproachBatteryRemainingPercentageChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWakeOnApproachBatteryRemainingPercentageChanged", [=](IPolicy* policy) {
+		policy->executePolicyWakeOnApproachBatteryRemainingPercentageChanged(m_remainingPercentage);
+	});
 }
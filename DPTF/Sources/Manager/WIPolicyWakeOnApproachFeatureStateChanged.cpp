@@ -36,24 +36,9 @@ void WIPolicyWakeOnApproachFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->wakeOnApproachFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->wakeOnApproachFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWakeOnApproachFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWakeOnApproachFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWakeOnApproachFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyWakeOnApproachFeatureStateChanged(m_state);
+	});
 }
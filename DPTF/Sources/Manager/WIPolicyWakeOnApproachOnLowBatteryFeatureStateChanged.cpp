@@ -36,24 +36,9 @@ void WIPolicyWakeOnApproachOnLowBatteryFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->wakeOnApproachOnLowBatteryFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->wakeOnApproachOnLowBatteryFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWakeOnApproachOnLowBatteryFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWakeOnApproachOnLowBatteryFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWakeOnApproachOnLowBatteryFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyWakeOnApproachOnLowBatteryFeatureStateChanged(m_state);
+	});
 }
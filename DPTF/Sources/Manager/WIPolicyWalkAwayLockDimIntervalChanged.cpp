@@ -36,24 +36,9 @@ void WIPolicyWalkAwayLockDimIntervalChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->walkAwayLockDimInterval.set(m_time);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->walkAwayLockDimInterval.set(m_time);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWalkAwayLockDimIntervalChanged(m_time);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWalkAwayLockDimIntervalChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWalkAwayLockDimIntervalChanged", [=](IPolicy* policy) {
+		policy->executePolicyWalkAwayLockDimIntervalChanged(m_time);
+	});
 }
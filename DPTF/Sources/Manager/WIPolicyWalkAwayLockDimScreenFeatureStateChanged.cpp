@@ -36,24 +36,9 @@ void WIPolicyWalkAwayLockDimScreenFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->walkAwayLockDimScreenFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->walkAwayLockDimScreenFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWalkAwayLockDimScreenFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWalkAwayLockDimScreenFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWalkAwayLockDimScreenFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyWalkAwayLockDimScreenFeatureStateChanged(m_state);
+	});
 }
@@ -37,24 +37,10 @@ void WIPolicyWalkAwayLockDisplayOffAfterLockFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->walkAwayLockDisplayOffAfterLockFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->walkAwayLockDisplayOffAfterLockFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
+	executeOnAllPolicies(
+		"Policy::executePolicyWalkAwayLockDisplayOffAfterLockFeatureStateChanged", [=](IPolicy* policy) {
 			policy->executePolicyWalkAwayLockDisplayOffAfterLockFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWalkAwayLockDisplayOffAfterLockFeatureStateChanged", *i);
-		}
-	}
+		});
 }
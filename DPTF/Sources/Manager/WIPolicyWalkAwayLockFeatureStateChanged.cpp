@@ -36,24 +36,9 @@ void WIPolicyWalkAwayLockFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->walkAwayLockFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->walkAwayLockFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWalkAwayLockFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWalkAwayLockFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWalkAwayLockFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyWalkAwayLockFeatureStateChanged(m_state);
+	});
 }
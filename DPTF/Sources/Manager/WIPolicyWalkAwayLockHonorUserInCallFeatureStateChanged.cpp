@@ -36,24 +36,9 @@ void WIPolicyWalkAwayLockHonorUserInCallFeatureStateChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
+	getDptfManager()->getEventCache()->walkAwayLockHonorUserInCallFeatureState.set(m_state);
 
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			getDptfManager()->getEventCache()->walkAwayLockHonorUserInCallFeatureState.set(m_state);
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePolicyWalkAwayLockHonorUserInCallFeatureStateChanged(m_state);
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePolicyWalkAwayLockHonorUserInCallFeatureStateChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePolicyWalkAwayLockHonorUserInCallFeatureStateChanged", [=](IPolicy* policy) {
+		policy->executePolicyWalkAwayLockHonorUserInCallFeatureStateChanged(m_state);
+	});
 }
@@ -33,23 +33,7 @@ void WIPowerLimitChanged::onExecute(void)
 {
 	writeWorkItemStartingInfoMessage();
 
-	auto policyManager = getPolicyManager();
-	auto policyIndexes = policyManager->getPolicyIndexes();
-
-	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
-	{
-		try
-		{
-			auto policy = policyManager->getPolicyPtr(*i);
-			policy->executePowerLimitChanged();
-		}
-		catch (policy_index_invalid&)
-		{
-			// do nothing.  No item in the policy list at this index.
-		}
-		catch (std::exception& ex)
-		{
-			writeWorkItemErrorMessagePolicy(ex, "Policy::executePowerLimitChanged", *i);
-		}
-	}
+	executeOnAllPolicies("Policy::executePowerLimitChanged", [=](IPolicy* policy) {
+		policy->executePowerLimitChanged();
+	});
 }
@@ -22,6 +22,11 @@
 #include "ParticipantManagerInterface.h"
 #include "UniqueIdGenerator.h"
 #include "EsifServicesInterface.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "PolicyExecutor.h"
+#include "FrameworkLock.h"
+#include "Participant.h"
+#include "DomainCachedDataCategory.h"
 #include "ManagerLogger.h"
 
 WorkItem::WorkItem(DptfManagerInterface* dptfManager, FrameworkEvent::Type frameworkEventType)
@@ -237,3 +242,133 @@ void WorkItem::writeWorkItemErrorMessageParticipant(
 		return message;
 	});
 }
+
+void WorkItem::writeWorkItemPolicyExceptionMessage(
+	const std::exception& ex,
+	const std::string& functionName,
+	UIntN policyIndex) const
+{
+	writeWorkItemErrorMessagePolicy(ex, functionName, policyIndex);
+}
+
+void WorkItem::executeOnAllPolicies(
+	const std::string& functionName,
+	const std::function<void(IPolicy*)>& policyFunction)
+{
+	executeOnPolicies(getPolicyManager()->getPolicyIndexes(), functionName, policyFunction);
+}
+
+void WorkItem::executeOnSinglePolicy(
+	UIntN policyIndex,
+	const std::string& functionName,
+	const std::function<void(IPolicy*)>& policyFunction)
+{
+	std::set<UIntN> policyIndexes;
+	policyIndexes.insert(policyIndex);
+	executeOnPolicies(policyIndexes, functionName, policyFunction);
+}
+
+void WorkItem::executeOnPolicies(
+	const std::set<UIntN>& policyIndexes,
+	const std::string& functionName,
+	const std::function<void(IPolicy*)>& policyFunction)
+{
+	auto policyManager = getPolicyManager();
+	auto policyExecutor = getDptfManager()->getWorkItemQueueManager()->getPolicyExecutor();
+
+	Bool serialized = (policyExecutor == nullptr) || (policyExecutor->getNumberOfThreads() == 0)
+					  || PolicyExecutor::requiresSerializedExecution(getFrameworkEventType());
+
+	// Queued calls keep this work item alive until the last policy has run
+	std::shared_ptr<WorkItem> self;
+	if (serialized == false)
+	{
+		try
+		{
+			self = shared_from_this();
+		}
+		catch (std::bad_weak_ptr&)
+		{
+			serialized = true;
+		}
+	}
+
+	for (auto i = policyIndexes.begin(); i != policyIndexes.end(); ++i)
+	{
+		try
+		{
+			auto policy = policyManager->getPolicyPtr(*i);
+			if (serialized)
+			{
+				executeOnPolicy(policy, *i, functionName, policyFunction);
+			}
+			else
+			{
+				auto policyIndex = *i;
+				policyExecutor->enqueue(policyIndex, [=]() {
+					self->executeOnPolicy(policy, policyIndex, functionName, policyFunction);
+					self->invalidateVolatileCachedData(policyIndex);
+				});
+			}
+		}
+		catch (policy_index_invalid&)
+		{
+			// do nothing.  No item in the policy list at this index.
+		}
+	}
+}
+
+void WorkItem::executeOnPolicy(
+	IPolicy* policy,
+	UIntN policyIndex,
+	const std::string& functionName,
+	const std::function<void(IPolicy*)>& policyFunction) const
+{
+	try
+	{
+		policyFunction(policy);
+	}
+	catch (std::exception& ex)
+	{
+		writeWorkItemPolicyExceptionMessage(ex, functionName, policyIndex);
+	}
+}
+
+// Status values read by a policy call on the executor are dropped once the call completes, the same way the work item
+// thread drops them after a work item that runs its policies inline.  Only the participants the call worked on are
+// touched, each under its own participant mutex.
+void WorkItem::invalidateVolatileCachedData(UIntN policyIndex) const
+{
+	try
+	{
+		auto frameworkLock = getDptfManager()->getWorkItemQueueManager()->getFrameworkLock();
+		auto access = frameworkLock->takeParticipantAccess(policyIndex);
+		if (access.allParticipants)
+		{
+			FrameworkLockHelper frameworkLockHelper(frameworkLock);
+			frameworkLockHelper.lock();
+			getParticipantManager()->invalidateAllParticipantCachedData(DomainCachedDataCategory::getVolatileMask());
+			return;
+		}
+
+		for (auto participantIndex = access.participantIndexes.begin();
+			 participantIndex != access.participantIndexes.end();
+			 ++participantIndex)
+		{
+			EsifMutexHelper participantLock(frameworkLock->getParticipantMutex(*participantIndex));
+			participantLock.lock();
+			try
+			{
+				getParticipantManager()->getParticipantPtr(*participantIndex)->invalidateParticipantCachedData(
+					DomainCachedDataCategory::getVolatileMask());
+			}
+			catch (participant_index_invalid&)
+			{
+				// the participant was destroyed after the policy worked on it
+			}
+		}
+	}
+	catch (...)
+	{
+	}
+}
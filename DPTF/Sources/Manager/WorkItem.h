@@ -24,12 +24,14 @@
 #include "ManagerMessage.h"
 #include "EsifTime.h"
 #include "DptfManagerInterface.h"
+#include <functional>
 
 class PolicyManagerInterface;
 class ParticipantManagerInterface;
 class EsifServicesInterface;
+class IPolicy;
 
-class WorkItem : public WorkItemInterface
+class WorkItem : public WorkItemInterface, public std::enable_shared_from_this<WorkItem>
 {
 public:
 	WorkItem(DptfManagerInterface* dptfManager, FrameworkEvent::Type frameworkEventType);
@@ -79,6 +81,20 @@ protected:
 		const std::exception& ex,
 		const std::string& functionName,
 		UIntN participantIndex) const;
+	virtual void writeWorkItemPolicyExceptionMessage(
+		const std::exception& ex,
+		const std::string& functionName,
+		UIntN policyIndex) const;
+
+	// Calls policyFunction for every loaded policy.  Unless this work item requires serialized execution, each call
+	// is queued for its policy on the policy executor and may still be running after onExecute() returns.
+	void executeOnAllPolicies(const std::string& functionName, const std::function<void(IPolicy*)>& policyFunction);
+
+	// Same as executeOnAllPolicies() for a single policy.  Indexes without a loaded policy are ignored.
+	void executeOnSinglePolicy(
+		UIntN policyIndex,
+		const std::string& functionName,
+		const std::function<void(IPolicy*)>& policyFunction);
 
 	virtual void onExecute(void) = 0;
 
@@ -87,6 +103,17 @@ private:
 	WorkItem(const WorkItem& rhs);
 	WorkItem& operator=(const WorkItem& rhs);
 
+	void executeOnPolicies(
+		const std::set<UIntN>& policyIndexes,
+		const std::string& functionName,
+		const std::function<void(IPolicy*)>& policyFunction);
+	void executeOnPolicy(
+		IPolicy* policy,
+		UIntN policyIndex,
+		const std::string& functionName,
+		const std::function<void(IPolicy*)>& policyFunction) const;
+	void invalidateVolatileCachedData(UIntN policyIndex) const;
+
 	DptfManagerInterface* m_dptfManager;
 	PolicyManagerInterface* m_policyManager;
 	ParticipantManagerInterface* m_participantManager;
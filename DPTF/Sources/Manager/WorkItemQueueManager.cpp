@@ -31,6 +31,7 @@ WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager)
 	, m_immediateQueue(nullptr)
 	, m_deferredQueue(nullptr)
 	, m_workItemQueueThread(nullptr)
+	, m_policyExecutor(nullptr)
 	, m_workItemQueueSemaphore(nullptr)
 {
 	try
@@ -39,8 +40,15 @@ WorkItemQueueManager::WorkItemQueueManager(DptfManagerInterface* dptfManager)
 		m_workItemQueueSemaphore = new EsifSemaphore();
 		m_immediateQueue = new ImmediateWorkItemQueue(m_workItemQueueSemaphore);
 		m_deferredQueue = new DeferredWorkItemQueue(m_workItemQueueSemaphore, m_immediateQueue);
+		m_policyExecutor = new PolicyExecutor(POLICY_EXECUTOR_THREADS);
 		m_workItemQueueThread = new WorkItemQueueThread(
-			m_dptfManager, m_immediateQueue, m_deferredQueue, m_workItemQueueSemaphore, m_workItemStatistics);
+			m_dptfManager,
+			m_immediateQueue,
+			m_deferredQueue,
+			m_workItemQueueSemaphore,
+			m_workItemStatistics,
+			m_policyExecutor,
+			&m_frameworkLock);
 	}
 	catch (...)
 	{
@@ -64,6 +72,7 @@ void WorkItemQueueManager::deleteAllObjects(void)
 {
 	// Do not acquire mutex for this function.
 	DELETE_MEMORY_TC(m_workItemQueueThread);
+	DELETE_MEMORY_TC(m_policyExecutor);
 	DELETE_MEMORY_TC(m_deferredQueue);
 	DELETE_MEMORY_TC(m_immediateQueue);
 	DELETE_MEMORY_TC(m_workItemQueueSemaphore);
@@ -197,6 +206,26 @@ UIntN WorkItemQueueManager::removeIfMatches(const WorkItemMatchCriteria& matchCr
 	return numRemoved;
 }
 
+Bool WorkItemQueueManager::removeByUniqueId(UInt64 uniqueId, const WorkItemMatchCriteria& matchCriteria)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	// Deferred work items are found by id.  Once the timer has moved one to the immediate queue it is searched for
+	// there, which only holds the work items that are ready to run.
+	Bool removed = m_deferredQueue->removeByUniqueId(uniqueId, matchCriteria);
+	if (removed == false)
+	{
+		WorkItemMatchCriteria uniqueIdMatchCriteria(matchCriteria);
+		uniqueIdMatchCriteria.addUniqueIdToMatchList(uniqueId);
+		removed = (m_immediateQueue->removeIfMatches(uniqueIdMatchCriteria) > 0);
+	}
+
+	esifMutexHelper.unlock();
+
+	return removed;
+}
+
 Bool WorkItemQueueManager::isWorkItemThread()
 {
 	Bool isWorkItemThread = false;
@@ -211,9 +240,25 @@ Bool WorkItemQueueManager::isWorkItemThread()
 	{
 	}
 
+	// Policies running on the policy executor act on behalf of the work item thread
+	if ((isWorkItemThread == false) && (m_policyExecutor != nullptr))
+	{
+		isWorkItemThread = m_policyExecutor->isExecutorThread();
+	}
+
 	return isWorkItemThread;
 }
 
+PolicyExecutor* WorkItemQueueManager::getPolicyExecutor(void)
+{
+	return m_policyExecutor;
+}
+
+FrameworkLock* WorkItemQueueManager::getFrameworkLock(void)
+{
+	return &m_frameworkLock;
+}
+
 std::shared_ptr<XmlNode> WorkItemQueueManager::getStatusAsXml(void)
 {
 	EsifMutexHelper esifMutexHelper(&m_mutex);
@@ -228,6 +273,7 @@ std::shared_ptr<XmlNode> WorkItemQueueManager::getStatusAsXml(void)
 	workItemQueueManagerStatus->addChild(m_immediateQueue->getXml());
 	workItemQueueManagerStatus->addChild(m_deferredQueue->getXml());
 	workItemQueueManagerStatus->addChild(m_workItemStatistics->getXml());
+	workItemQueueManagerStatus->addChild(m_policyExecutor->getXml());
 
 	esifMutexHelper.unlock();
 
@@ -22,7 +22,12 @@
 #include "WorkItemQueueThread.h"
 #include "ImmediateWorkItemQueue.h"
 #include "DeferredWorkItemQueue.h"
+#include "PolicyExecutor.h"
 #include "EsifMutex.h"
+#include "FrameworkLock.h"
+
+// Number of threads used to deliver work items to policies
+#define POLICY_EXECUTOR_THREADS 4
 
 class WorkItemQueueManager : public WorkItemQueueManagerInterface
 {
@@ -40,8 +45,12 @@ public:
 		const TimeSpan& timeUntilExecution) override;
 
 	virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) override;
+	virtual Bool removeByUniqueId(UInt64 uniqueId, const WorkItemMatchCriteria& matchCriteria) override;
 	virtual Bool isWorkItemThread(void) override;
 
+	virtual PolicyExecutor* getPolicyExecutor(void) override;
+	virtual FrameworkLock* getFrameworkLock(void) override;
+
 	virtual void disableAndEmptyAllQueues(void) override;
 
 	virtual std::shared_ptr<XmlNode> getStatusAsXml(void) override;
@@ -59,6 +68,11 @@ private:
 	ImmediateWorkItemQueue* m_immediateQueue;
 	DeferredWorkItemQueue* m_deferredQueue;
 	WorkItemQueueThread* m_workItemQueueThread;
+	PolicyExecutor* m_policyExecutor;
+
+	// Held by the work item thread while it executes a work item and by the policy executor threads while a
+	// policy calls back into the framework, so only one thread at a time touches framework state.
+	FrameworkLock m_frameworkLock;
 
 	// - The following semaphore is signaled when:
 	//    * an item is placed in the immediate or deferred queue
@@ -22,6 +22,9 @@
 #include "WorkItem.h"
 #include <memory>
 
+class PolicyExecutor;
+class FrameworkLock;
+
 class WorkItemQueueManagerInterface
 {
 public:
@@ -36,8 +39,12 @@ public:
 		const TimeSpan& timeUntilExecution) = 0;
 
 	virtual UIntN removeIfMatches(const WorkItemMatchCriteria& matchCriteria) = 0;
+	virtual Bool removeByUniqueId(UInt64 uniqueId, const WorkItemMatchCriteria& matchCriteria) = 0;
 	virtual Bool isWorkItemThread(void) = 0;
 
+	virtual PolicyExecutor* getPolicyExecutor(void) = 0;
+	virtual FrameworkLock* getFrameworkLock(void) = 0;
+
 	virtual void disableAndEmptyAllQueues(void) = 0;
 
 	virtual std::shared_ptr<XmlNode> getStatusAsXml(void) = 0;
@@ -18,13 +18,16 @@
 
 #include "WorkItemQueueThread.h"
 #include "ParticipantManagerInterface.h"
+#include "DomainCachedDataCategory.h"
 
 WorkItemQueueThread::WorkItemQueueThread(
 	DptfManagerInterface* dptfManager,
 	ImmediateWorkItemQueue* immediateQueue,
 	DeferredWorkItemQueue* deferredQueue,
 	EsifSemaphore* workItemQueueSemaphore,
-	WorkItemStatistics* workItemStatistics)
+	WorkItemStatistics* workItemStatistics,
+	PolicyExecutor* policyExecutor,
+	FrameworkLock* frameworkLock)
 	: m_dptfManager(dptfManager)
 	, m_participantManager(nullptr)
 	, m_destroyThread(false)
@@ -35,6 +38,8 @@ WorkItemQueueThread::WorkItemQueueThread(
 	, m_workItemQueueThreadId(nullptr)
 	, m_workItemQueueThreadExitSemaphore(nullptr)
 	, m_workItemStatistics(workItemStatistics)
+	, m_policyExecutor(policyExecutor)
+	, m_frameworkLock(frameworkLock)
 {
 	m_participantManager = m_dptfManager->getParticipantManager();
 	m_workItemQueueThreadExitSemaphore = new EsifSemaphore();
@@ -90,7 +95,32 @@ void WorkItemQueueThread::processImmediateQueue(void)
 	auto immediateWorkItem = m_immediateQueue->dequeue();
 	while (immediateWorkItem.get() != nullptr)
 	{
-		// FrameworkEvent::Type eventType = immediateWorkItem->getFrameworkEventType();
+		// Work items that create or destroy participants, domains or policies wait for the policies to finish
+		// everything queued before them.  This must happen before taking the framework lock because the policies
+		// need it to complete their work.
+		if (PolicyExecutor::requiresSerializedExecution(immediateWorkItem->getFrameworkEventType()))
+		{
+			m_policyExecutor->waitUntilIdle();
+		}
+
+		FrameworkLockHelper frameworkLockHelper(m_frameworkLock);
+		frameworkLockHelper.lock();
+
+		// Values the event may have changed must be re-read while the work item executes.  Everything else
+		// stays cached except for status values, which are dropped once the work item completes and once each
+		// policy call it queued on the policy executor completes (see WorkItem::executeOnPolicies).
+		auto eventCategories =
+			DomainCachedDataCategory::getMaskForFrameworkEvent(immediateWorkItem->getFrameworkEventType());
+		if (eventCategories != DomainCachedDataCategory::None)
+		{
+			try
+			{
+				m_participantManager->invalidateAllParticipantCachedData(eventCategories);
+			}
+			catch (...)
+			{
+			}
+		}
 
 #ifdef INCLUDE_WORK_ITEM_STATISTICS
 		try
@@ -112,7 +142,7 @@ void WorkItemQueueThread::processImmediateQueue(void)
 
 		try
 		{
-			m_participantManager->clearAllParticipantCachedData();
+			m_participantManager->invalidateAllParticipantCachedData(DomainCachedDataCategory::getVolatileMask());
 		}
 		catch (...)
 		{
@@ -127,6 +157,7 @@ void WorkItemQueueThread::processImmediateQueue(void)
 		{
 		}
 #endif
+		frameworkLockHelper.unlock();
 		immediateWorkItem = m_immediateQueue->dequeue();
 	}
 }
@@ -24,6 +24,8 @@
 #include "EsifThread.h"
 #include "EsifThreadId.h"
 #include "WorkItemStatistics.h"
+#include "PolicyExecutor.h"
+#include "FrameworkLock.h"
 
 class ParticipantManagerInterface;
 
@@ -35,7 +37,9 @@ public:
 		ImmediateWorkItemQueue* immediateQueue,
 		DeferredWorkItemQueue* deferredQueue,
 		EsifSemaphore* workItemQueueSemaphore,
-		WorkItemStatistics* workItemStatistics);
+		WorkItemStatistics* workItemStatistics,
+		PolicyExecutor* policyExecutor,
+		FrameworkLock* frameworkLock);
 	~WorkItemQueueThread(void);
 
 	EsifThreadId getWorkItemQueueThreadId(void) const;
@@ -56,6 +60,8 @@ private:
 	EsifThreadId* m_workItemQueueThreadId;
 	EsifSemaphore* m_workItemQueueThreadExitSemaphore;
 	WorkItemStatistics* m_workItemStatistics;
+	PolicyExecutor* m_policyExecutor;
+	FrameworkLock* m_frameworkLock;
 
 	friend void* ThreadStart(void* contextPtr);
 	void executeThread(void);
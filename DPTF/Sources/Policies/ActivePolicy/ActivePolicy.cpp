@@ -133,7 +133,7 @@ string ActivePolicy::getDiagnosticsAsXml(void) const
 void ActivePolicy::onBindParticipant(UIntN participantIndex)
 {
 	getParticipantTracker()->remember(participantIndex);
-	associateParticipantInArt(getParticipantTracker()->getParticipant(participantIndex));
+	associateParticipantInArt(getParticipantTracker()->getParticipant(participantIndex), m_art);
 }
 
 void ActivePolicy::onUnbindParticipant(UIntN participantIndex)
@@ -274,50 +274,10 @@ void ActivePolicy::onDomainFanCapabilityChanged(UIntN participantIndex)
 
 void ActivePolicy::onActiveRelationshipTableChanged(void)
 {
-	vector<UIntN> indexes = m_art->getAllTargets();
-	for (auto participantIndex = indexes.begin(); participantIndex != indexes.end(); participantIndex++)
-	{
-		try
-		{
-			if (getParticipantTracker()->remembers(*participantIndex))
-			{
-				auto target = getParticipantTracker()->getParticipant(*participantIndex);
-				target->setTemperatureThresholds(Temperature::createInvalid(), Temperature::createInvalid());
-			}
-		}
-		catch (std::exception& ex)
-		{
-			POLICY_LOG_MESSAGE_DEBUG_EX(
-				{ return "Failed to reset temperature thresholds for participant: " + std::string(ex.what()); });
-		}
-
-		auto entries = m_art->getEntriesForTarget(*participantIndex);
-		for (auto entry = entries.begin(); entry != entries.end(); entry++)
-		{
-			try
-			{
-				requestFanTurnedOff(*entry);
-			}
-			catch (...)
-			{
-				// no action for failure.  make best attempt to turn off the fan.
-			}
-		}
-	}
-	m_art.reset(new ActiveRelationshipTable(ActiveRelationshipTable::createArtFromDptfBuffer(
-		getPolicyServices().platformConfigurationData->getActiveRelationshipTable())));
-	associateAllParticipantsInArt();
-
-	auto targetIndexes = m_art->getAllTargets();
-	for (auto target = targetIndexes.begin(); target != targetIndexes.end(); target++)
-	{
-		// TODO: This may force a fan speed to be set multiple times.
-		// Need to fix it such that all requests are collected and applied once
-		if (getParticipantTracker()->remembers(*target))
-		{
-			updateThresholdsAndCoolTargetParticipant(getParticipantTracker()->getParticipant(*target));
-		}
-	}
+	auto newArt = std::make_shared<ActiveRelationshipTable>(ActiveRelationshipTable::createArtFromDptfBuffer(
+		getPolicyServices().platformConfigurationData->getActiveRelationshipTable()));
+	associateAllParticipantsInArt(newArt);
+	applyArtChanges(newArt->getChangesFrom(*m_art), newArt);
 }
 
 Temperature ActivePolicy::getCurrentTemperature(ParticipantProxyInterface* participant)
@@ -462,7 +422,63 @@ void ActivePolicy::reloadArt()
 {
 	m_art.reset(new ActiveRelationshipTable(ActiveRelationshipTable::createArtFromDptfBuffer(
 		getPolicyServices().platformConfigurationData->getActiveRelationshipTable())));
-	associateAllParticipantsInArt();
+	associateAllParticipantsInArt(m_art);
+}
+
+void ActivePolicy::applyArtChanges(
+	const RelationshipTableChanges& changes,
+	std::shared_ptr<ActiveRelationshipTable> newArt)
+{
+	// only fan requests from removed relationships are dropped.  targets in added or modified relationships are
+	// cooled again below, which replaces their fan requests, and every other target keeps its current requests.
+	auto removedEntries = changes.getRemovedEntries();
+	for (auto entry = removedEntries.begin(); entry != removedEntries.end(); entry++)
+	{
+		auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
+		if (artEntry)
+		{
+			try
+			{
+				requestFanTurnedOff(artEntry);
+			}
+			catch (...)
+			{
+				// no action for failure.  make best attempt to turn off the fan.
+			}
+		}
+	}
+
+	m_art = newArt;
+
+	auto targets = changes.getAffectedTargetIndexes();
+	for (auto target = targets.begin(); target != targets.end(); target++)
+	{
+		if (participantIsTargetDevice(*target))
+		{
+			updateThresholdsAndCoolTargetParticipant(getParticipantTracker()->getParticipant(*target));
+		}
+		else
+		{
+			stopCoolingTarget(*target);
+		}
+	}
+}
+
+void ActivePolicy::stopCoolingTarget(UIntN target)
+{
+	try
+	{
+		if (getParticipantTracker()->remembers(target))
+		{
+			auto participant = getParticipantTracker()->getParticipant(target);
+			participant->setTemperatureThresholds(Temperature::createInvalid(), Temperature::createInvalid());
+		}
+	}
+	catch (std::exception& ex)
+	{
+		POLICY_LOG_MESSAGE_DEBUG_EX(
+			{ return "Failed to reset temperature thresholds for participant: " + std::string(ex.what()); });
+	}
 }
 
 void ActivePolicy::takeCoolingActionsForAllParticipants()
@@ -561,19 +577,21 @@ UIntN ActivePolicy::findTripPointCrossed(SpecificInfo& tripPoints, const Tempera
 	return Constants::Invalid;
 }
 
-void ActivePolicy::associateAllParticipantsInArt()
+void ActivePolicy::associateAllParticipantsInArt(std::shared_ptr<ActiveRelationshipTable> art)
 {
 	vector<UIntN> participantIndicies = getParticipantTracker()->getAllTrackedIndexes();
 	for (auto index = participantIndicies.begin(); index != participantIndicies.end(); index++)
 	{
-		associateParticipantInArt(getParticipantTracker()->getParticipant(*index));
+		associateParticipantInArt(getParticipantTracker()->getParticipant(*index), art);
 	}
 }
 
-void ActivePolicy::associateParticipantInArt(ParticipantProxyInterface* participant)
+void ActivePolicy::associateParticipantInArt(
+	ParticipantProxyInterface* participant,
+	std::shared_ptr<ActiveRelationshipTable> art)
 {
 	auto participantProperties = participant->getParticipantProperties();
-	m_art->associateParticipant(
+	art->associateParticipant(
 		participantProperties.getAcpiInfo().getAcpiScope(), participant->getIndex(), participantProperties.getName());
 }
 
@@ -72,6 +72,8 @@ private:
 	void turnOffAllFans();
 	void refreshArtAndTargetsAndTakeCoolingAction();
 	void reloadArt();
+	void applyArtChanges(const RelationshipTableChanges& changes, std::shared_ptr<ActiveRelationshipTable> newArt);
+	void stopCoolingTarget(UIntN target);
 	void takeCoolingActionsForAllParticipants();
 
 	// setting target trip point notification
@@ -89,8 +91,10 @@ private:
 	UIntN findTripPointCrossed(SpecificInfo& tripPoints, const Temperature& temperature);
 
 	// associating participants with entries in the ART
-	void associateAllParticipantsInArt();
-	void associateParticipantInArt(ParticipantProxyInterface* participant);
+	void associateAllParticipantsInArt(std::shared_ptr<ActiveRelationshipTable> art);
+	void associateParticipantInArt(
+		ParticipantProxyInterface* participant,
+		std::shared_ptr<ActiveRelationshipTable> art);
 
 	// selecting participants
 	Bool participantIsSourceDevice(UIntN participantIndex);
@@ -19,11 +19,18 @@
 #include "ActiveRelationshipTable.h"
 #include "BinaryParse.h"
 #include "TableStringParser.h"
+#include <algorithm>
 
 ActiveRelationshipTable::ActiveRelationshipTable(
 	const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
 	: RelationshipTableBase(entries)
 {
+	m_artEntries.reserve(m_entries.size());
+	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	{
+		m_artEntries.push_back(std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry));
+	}
+	indexEntries();
 }
 
 ActiveRelationshipTable::ActiveRelationshipTable()
@@ -38,6 +45,7 @@ ActiveRelationshipTable::~ActiveRelationshipTable()
 ActiveRelationshipTable ActiveRelationshipTable::createArtFromDptfBuffer(const DptfBuffer& buffer)
 {
 	std::vector<std::shared_ptr<RelationshipTableEntryBase>> entries;
+	std::set<std::pair<std::string, std::string>> relationships;
 
 	UInt8* data = reinterpret_cast<UInt8*>(buffer.get());
 	struct EsifDataBinaryArtPackage* currentRow = reinterpret_cast<struct EsifDataBinaryArtPackage*>(data);
@@ -97,18 +105,9 @@ ActiveRelationshipTable ActiveRelationshipTable::createArtFromDptfBuffer(const D
 		if (newArtEntry)
 		{
 			// Check for duplicate entries. Don't add entry if previous entry exists with same target/source pair
-			Bool isDuplicateEntry = false;
-			for (auto e = entries.begin(); e != entries.end(); e++)
-			{
-				auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*e);
-				if (artEntry && newArtEntry->isSameAs(*artEntry))
-				{
-					isDuplicateEntry = true;
-					break;
-				}
-			}
-
-			if (isDuplicateEntry == false)
+			auto relationship =
+				std::make_pair(newArtEntry->getSourceDeviceScope(), newArtEntry->getTargetDeviceScope());
+			if (relationships.insert(relationship).second)
 			{
 				entries.push_back(newArtEntry);
 			}
@@ -185,73 +184,53 @@ void ActiveRelationshipTable::throwIfOutOfRange(IntN bytesRemaining)
 
 std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTable::getEntriesForTarget(UIntN target)
 {
-	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForTarget.find(target);
+	if (entries != m_entriesForTarget.end())
 	{
-		if ((*entry)->getTargetDeviceIndex() == target)
-		{
-			auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
-			if (artEntry)
-			{
-				entries.push_back(artEntry);
-			}
-		}
+		return entries->second;
 	}
-	return entries;
+	return std::vector<std::shared_ptr<ActiveRelationshipTableEntry>>();
 }
 
 std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> ActiveRelationshipTable::getEntriesForSource(UIntN source)
 {
-	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForSource.find(source);
+	if (entries != m_entriesForSource.end())
 	{
-		if ((*entry)->getSourceDeviceIndex() == source)
-		{
-			auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
-			if (artEntry)
-			{
-				entries.push_back(artEntry);
-			}
-		}
+		return entries->second;
 	}
-	return entries;
+	return std::vector<std::shared_ptr<ActiveRelationshipTableEntry>>();
 }
 
 std::vector<UIntN> ActiveRelationshipTable::getAllSources(void) const
 {
-	std::set<UIntN> sources;
-	for (UIntN row = 0; row < m_entries.size(); ++row)
-	{
-		if (m_entries[row]->getSourceDeviceIndex() != Constants::Invalid)
-		{
-			sources.insert(m_entries[row]->getSourceDeviceIndex());
-		}
-	}
+	auto sources = getAllSourceIndexes();
 	return std::vector<UIntN>(sources.begin(), sources.end());
 }
 
 std::vector<UIntN> ActiveRelationshipTable::getAllTargets(void) const
 {
-	std::set<UIntN> targets;
-	for (UIntN row = 0; row < m_entries.size(); ++row)
-	{
-		if (m_entries[row]->getTargetDeviceIndex() != Constants::Invalid)
-		{
-			targets.insert(m_entries[row]->getTargetDeviceIndex());
-		}
-	}
+	auto targets = getAllTargetIndexes();
 	return std::vector<UIntN>(targets.begin(), targets.end());
 }
 
+RelationshipTableChanges ActiveRelationshipTable::getChangesFrom(const ActiveRelationshipTable& previousArt) const
+{
+	return findChangesFrom(previousArt, [this, &previousArt](UIntN row, UIntN previousRow) {
+		auto& entry = m_artEntries[row];
+		auto& previousEntry = previousArt.m_artEntries[previousRow];
+		return (entry && previousEntry && (*entry == *previousEntry));
+	});
+}
+
 std::shared_ptr<XmlNode> ActiveRelationshipTable::getXml()
 {
 	auto status = XmlNode::createWrapperElement("art");
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
+	for (auto entry = m_artEntries.begin(); entry != m_artEntries.end(); entry++)
 	{
-		auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
-		if (artEntry)
+		if (*entry)
 		{
-			status->addChild(artEntry->getXml());
+			status->addChild((*entry)->getXml());
 		}
 	}
 	return status;
@@ -266,8 +245,8 @@ Bool ActiveRelationshipTable::operator==(const ActiveRelationshipTable& art) con
 
 	for (UIntN i = 0; i < getNumberOfEntries(); i++)
 	{
-		auto lhsArtEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(m_entries[i]);
-		auto rhsArtEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(art.m_entries[i]);
+		auto& lhsArtEntry = m_artEntries[i];
+		auto& rhsArtEntry = art.m_artEntries[i];
 		if (!lhsArtEntry || !rhsArtEntry || !(*lhsArtEntry == *rhsArtEntry))
 		{
 			return false;
@@ -285,9 +264,9 @@ DptfBuffer ActiveRelationshipTable::toArtBinary() const
 
 	DptfBuffer packages;
 	UInt32 offset = 0;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
+	for (auto entry = m_artEntries.begin(); entry != m_artEntries.end(); entry++)
 	{
-		auto artEntry = std::dynamic_pointer_cast<ActiveRelationshipTableEntry>(*entry);
+		auto& artEntry = *entry;
 		if (artEntry)
 		{
 			UInt32 sourceScopeLength = (UInt32)(*entry)->getSourceDeviceScope().size();
@@ -402,3 +381,40 @@ DptfBuffer ActiveRelationshipTable::toArtBinary() const
 	buffer.put(sizeOfRevision, packages.get(), packages.size());
 	return buffer;
 }
+
+void ActiveRelationshipTable::participantIndexesChanged(void)
+{
+	RelationshipTableBase::participantIndexesChanged();
+	indexEntries();
+}
+
+void ActiveRelationshipTable::indexEntries(void)
+{
+	m_entriesForTarget.clear();
+	m_entriesForSource.clear();
+	for (auto entry = m_artEntries.begin(); entry != m_artEntries.end(); ++entry)
+	{
+		if (*entry)
+		{
+			m_entriesForTarget[(*entry)->getTargetDeviceIndex()].push_back(*entry);
+			m_entriesForSource[(*entry)->getSourceDeviceIndex()].push_back(*entry);
+		}
+	}
+
+	// Entries with the same weight stay in table order
+	for (auto target = m_entriesForTarget.begin(); target != m_entriesForTarget.end(); ++target)
+	{
+		std::stable_sort(target->second.begin(), target->second.end(), compareEntriesOnWeight);
+	}
+	for (auto source = m_entriesForSource.begin(); source != m_entriesForSource.end(); ++source)
+	{
+		std::stable_sort(source->second.begin(), source->second.end(), compareEntriesOnWeight);
+	}
+}
+
+Bool ActiveRelationshipTable::compareEntriesOnWeight(
+	const std::shared_ptr<ActiveRelationshipTableEntry>& left,
+	const std::shared_ptr<ActiveRelationshipTableEntry>& right)
+{
+	return (left->getWeight() > right->getWeight());
+}
@@ -36,12 +36,31 @@ public:
 	DptfBuffer toArtBinary() const;
 	std::vector<UIntN> getAllSources(void) const;
 	std::vector<UIntN> getAllTargets(void) const;
+
+	// Entries are returned with the highest weight first
 	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> getEntriesForTarget(UIntN target);
 	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> getEntriesForSource(UIntN source);
+
+	// Relationships added, removed or modified in this table compared to previousArt
+	RelationshipTableChanges getChangesFrom(const ActiveRelationshipTable& previousArt) const;
+
 	std::shared_ptr<XmlNode> getXml();
 	Bool operator==(const ActiveRelationshipTable& art) const;
 
+protected:
+	virtual void participantIndexesChanged(void) override;
+
 private:
 	static UIntN countArtRows(UInt32 size, UInt8* data);
 	static void throwIfOutOfRange(IntN bytesRemaining);
+	static Bool compareEntriesOnWeight(
+		const std::shared_ptr<ActiveRelationshipTableEntry>& left,
+		const std::shared_ptr<ActiveRelationshipTableEntry>& right);
+
+	void indexEntries(void);
+
+	// m_artEntries holds each row of m_entries already cast to its ART type
+	std::vector<std::shared_ptr<ActiveRelationshipTableEntry>> m_artEntries;
+	std::map<UIntN, std::vector<std::shared_ptr<ActiveRelationshipTableEntry>>> m_entriesForTarget;
+	std::map<UIntN, std::vector<std::shared_ptr<ActiveRelationshipTableEntry>>> m_entriesForSource;
 };
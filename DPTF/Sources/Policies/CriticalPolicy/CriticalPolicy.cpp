@@ -317,6 +317,14 @@ void CriticalPolicy::onPolicyInitiatedCallback(UInt64 eventCode, UInt64 param1,
 	}
 }
 
+void CriticalPolicy::onOverrideTimeObject(std::shared_ptr<TimeInterface> timeObject)
+{
+	if (m_scheduler != nullptr)
+	{
+		m_scheduler->setTimeObject(timeObject);
+	}
+}
+
 void CriticalPolicy::reEvaluateAllParticipants()
 {
 	auto allParticipants = getParticipantTracker()->getAllTrackedIndexes();
@@ -56,6 +56,7 @@ public:
 	virtual void onDomainTemperatureThresholdCrossed(UIntN participantIndex) override;
 	virtual void onParticipantSpecificInfoChanged(UIntN participantIndex) override;
 	virtual void onPolicyInitiatedCallback(UInt64 eventCode, UInt64 param1, void* param2) override;
+	virtual void onOverrideTimeObject(std::shared_ptr<TimeInterface> timeObject) override;
 
 private:
 	mutable CriticalPolicyStatistics m_stats;
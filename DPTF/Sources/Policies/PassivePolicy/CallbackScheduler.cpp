@@ -115,6 +115,21 @@ void CallbackScheduler::markSourceAsBusy(UIntN source, const TargetMonitor& targ
 	m_sourceAvailability.setSourceAsBusy(source, time + minimumSamplePeriod);
 }
 
+void CallbackScheduler::removeRelationshipFromSchedule(UIntN target, UIntN source)
+{
+	m_requestSchedule.erase(TargetSourceRelationship(target, source));
+}
+
+void CallbackScheduler::removeTargetFromSchedule(UIntN target)
+{
+	m_targetScheduler->cancelCallback(target);
+	auto relationship = m_requestSchedule.lower_bound(TargetSourceRelationship(target, 0));
+	while ((relationship != m_requestSchedule.end()) && (relationship->first.target == target))
+	{
+		relationship = m_requestSchedule.erase(relationship);
+	}
+}
+
 void CallbackScheduler::acknowledgeCallback(UIntN target)
 {
 	m_targetScheduler->acknowledgeCallback(target);
@@ -49,6 +49,10 @@ public:
 	void removeParticipantFromSchedule(UIntN participant);
 	void markSourceAsBusy(UIntN source, const TargetMonitor& targetMonitor, const TimeSpan& time);
 
+	// trt changes
+	void removeRelationshipFromSchedule(UIntN target, UIntN source);
+	void removeTargetFromSchedule(UIntN target);
+
 	// updates service objects
 	void setTrt(std::shared_ptr<ThermalRelationshipTable> trt);
 	void setTimeObject(std::shared_ptr<TimeInterface> time);
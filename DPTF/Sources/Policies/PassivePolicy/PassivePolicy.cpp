@@ -560,23 +560,59 @@ void PassivePolicy::reloadTrtIfDifferent()
 	associateAllParticipantsInTrt(newTrt);
 	if (*m_trt != *newTrt)
 	{
-		vector<UIntN> indexes = getParticipantTracker()->getAllTrackedIndexes();
-		for (auto participantIndex = indexes.begin(); participantIndex != indexes.end(); participantIndex++)
+		applyTrtChanges(newTrt->getChangesFrom(*m_trt), newTrt);
+	}
+}
+
+void PassivePolicy::applyTrtChanges(
+	const RelationshipTableChanges& changes,
+	std::shared_ptr<ThermalRelationshipTable> newTrt)
+{
+	// only the targets and sources in relationships that were added, removed or modified are touched.  every other
+	// target keeps its thresholds, monitoring, callbacks and source requests.
+	auto removedEntries = changes.getRemovedEntries();
+	for (auto entry = removedEntries.begin(); entry != removedEntries.end(); ++entry)
+	{
+		removeRequestsForTargetFromSource((*entry)->getTargetDeviceIndex(), (*entry)->getSourceDeviceIndex());
+		m_callbackScheduler->removeRelationshipFromSchedule(
+			(*entry)->getTargetDeviceIndex(), (*entry)->getSourceDeviceIndex());
+	}
+
+	// a modified sample period must apply to the next request instead of the one already scheduled
+	auto modifiedEntries = changes.getModifiedEntries();
+	for (auto entry = modifiedEntries.begin(); entry != modifiedEntries.end(); ++entry)
+	{
+		m_callbackScheduler->removeRelationshipFromSchedule(
+			entry->first->getTargetDeviceIndex(), entry->first->getSourceDeviceIndex());
+	}
+
+	m_trt = newTrt;
+	m_callbackScheduler->setTrt(m_trt);
+
+	auto sources = changes.getAffectedSourceIndexes();
+	for (auto source = sources.begin(); source != sources.end(); ++source)
+	{
+		if (participantIsSourceDevice(*source))
 		{
-			if (m_trt->isParticipantTargetDevice(*participantIndex))
-			{
-				auto target = getParticipantTracker()->getParticipant(*participantIndex);
-				target->setTemperatureThresholds(Temperature::createInvalid(), Temperature::createInvalid());
-			}
+			commitSourceControls(*source);
+		}
+		else if (getParticipantTracker()->remembers(*source))
+		{
+			clearSourceControls(*source);
 		}
+	}
 
-		clearAllSourceControls(); // resets the sources from current TRT
-		m_trt = newTrt;
-		associateAllParticipantsInTrt(m_trt);
-		m_targetMonitor.stopMonitoringAll();
-		m_callbackScheduler.reset(new CallbackScheduler(getPolicyServices(), m_trt, getTime()));
-		clearAllSourceControls(); // resets the sources from new TRT
-		takePossibleThermalActionForAllTargets();
+	auto targets = changes.getAffectedTargetIndexes();
+	for (auto target = targets.begin(); target != targets.end(); ++target)
+	{
+		if (participantIsTargetDevice(*target))
+		{
+			takePossibleThermalActionForTarget(*target);
+		}
+		else
+		{
+			stopManagingTarget(*target);
+		}
 	}
 }
 
@@ -629,44 +665,90 @@ std::shared_ptr<XmlNode> PassivePolicy::getXmlForPassiveTripPoints() const
 	return allStatus;
 }
 
-void PassivePolicy::clearAllSourceControls()
+void PassivePolicy::removeRequestsForTargetFromSource(UIntN target, UIntN source)
 {
-	vector<UIntN> allIndicies = getParticipantTracker()->getAllTrackedIndexes();
-	for (auto index = allIndicies.begin(); index != allIndicies.end(); ++index)
+	if (getParticipantTracker()->remembers(source))
 	{
-		auto participant = getParticipantTracker()->getParticipant(*index);
-		if (participantIsSourceDevice(participant->getIndex()))
+		auto participant = getParticipantTracker()->getParticipant(source);
+		auto domainIndexes = participant->getDomainIndexes();
+		for (auto domainIndex = domainIndexes.begin(); domainIndex != domainIndexes.end(); domainIndex++)
 		{
-			auto domainIndexes = participant->getDomainIndexes();
-			for (auto domainIndex = domainIndexes.begin(); domainIndex != domainIndexes.end(); domainIndex++)
+			auto domain = dynamic_pointer_cast<PassiveDomainProxy>(participant->getDomain(*domainIndex));
+			if (domain.get() != nullptr)
 			{
-				auto domain = dynamic_pointer_cast<PassiveDomainProxy>(participant->getDomain(*domainIndex));
-				if (domain.get() != nullptr)
-				{
-					domain->clearAllControlKnobRequests();
-					domain->setControlsToMax();
-				}
+				domain->clearAllRequestsForTarget(target);
 			}
 		}
 	}
 }
 
-void PassivePolicy::associateAllParticipantsInTrt(std::shared_ptr<ThermalRelationshipTable> trt)
+void PassivePolicy::commitSourceControls(UIntN source)
 {
-	vector<UIntN> allIndicies = getParticipantTracker()->getAllTrackedIndexes();
-	for (auto index = allIndicies.begin(); index != allIndicies.end(); ++index)
+	auto participant = getParticipantTracker()->getParticipant(source);
+	auto domainIndexes = participant->getDomainIndexes();
+	for (auto domainIndex = domainIndexes.begin(); domainIndex != domainIndexes.end(); domainIndex++)
 	{
-		auto participant = getParticipantTracker()->getParticipant(*index);
-		associateParticipantInTrt(participant, trt);
+		auto domain = dynamic_pointer_cast<PassiveDomainProxy>(participant->getDomain(*domainIndex));
+		if (domain.get() != nullptr)
+		{
+			try
+			{
+				domain->commitLimits();
+			}
+			catch (std::exception& ex)
+			{
+				POLICY_LOG_MESSAGE_WARNING_EX({
+					std::stringstream message;
+					message << "Failed to commit limits for source: " << string(ex.what())
+							<< ". ParticipantIndex = " << source;
+					return message.str();
+				});
+			}
+		}
 	}
 }
 
-void PassivePolicy::takePossibleThermalActionForAllTargets()
+void PassivePolicy::clearSourceControls(UIntN source)
+{
+	auto participant = getParticipantTracker()->getParticipant(source);
+	auto domainIndexes = participant->getDomainIndexes();
+	for (auto domainIndex = domainIndexes.begin(); domainIndex != domainIndexes.end(); domainIndex++)
+	{
+		auto domain = dynamic_pointer_cast<PassiveDomainProxy>(participant->getDomain(*domainIndex));
+		if (domain.get() != nullptr)
+		{
+			domain->clearAllControlKnobRequests();
+			domain->setControlsToMax();
+		}
+	}
+}
+
+void PassivePolicy::stopManagingTarget(UIntN target)
+{
+	if (getParticipantTracker()->remembers(target))
+	{
+		try
+		{
+			auto participant = getParticipantTracker()->getParticipant(target);
+			participant->setTemperatureThresholds(Temperature::createInvalid(), Temperature::createInvalid());
+		}
+		catch (std::exception& ex)
+		{
+			POLICY_LOG_MESSAGE_DEBUG_EX(
+				{ return "Failed to reset temperature thresholds for participant: " + std::string(ex.what()); });
+		}
+	}
+	m_targetMonitor.stopMonitoring(target);
+	m_callbackScheduler->removeTargetFromSchedule(target);
+}
+
+void PassivePolicy::associateAllParticipantsInTrt(std::shared_ptr<ThermalRelationshipTable> trt)
 {
 	vector<UIntN> allIndicies = getParticipantTracker()->getAllTrackedIndexes();
 	for (auto index = allIndicies.begin(); index != allIndicies.end(); ++index)
 	{
-		takePossibleThermalActionForTarget(*index);
+		auto participant = getParticipantTracker()->getParticipant(*index);
+		associateParticipantInTrt(participant, trt);
 	}
 }
 
@@ -78,16 +78,19 @@ private:
 	TargetActionBase* determineAction(UIntN target);
 	void takeThermalActionForTarget(UIntN target);
 	void removeAllRequestsForTarget(UIntN target);
-	void takePossibleThermalActionForAllTargets();
+	void removeRequestsForTargetFromSource(UIntN target, UIntN source);
 	void takePossibleThermalActionForTarget(UIntN participantIndex);
 	void takePossibleThermalActionForTarget(UIntN participantIndex, const Temperature& temperature);
-	void clearAllSourceControls();
+	void commitSourceControls(UIntN source);
+	void clearSourceControls(UIntN source);
+	void stopManagingTarget(UIntN target);
 
 	// TRT actions
 	void associateParticipantInTrt(
 		ParticipantProxyInterface* participant,
 		std::shared_ptr<ThermalRelationshipTable> trt);
 	void reloadTrtIfDifferent();
+	void applyTrtChanges(const RelationshipTableChanges& changes, std::shared_ptr<ThermalRelationshipTable> newTrt);
 	void associateAllParticipantsInTrt(std::shared_ptr<ThermalRelationshipTable> trt);
 
 	// temperature notification actions
@@ -66,9 +66,6 @@ protected:
 	std::vector<UIntN> getDomainsThatDoNotReportTemperature(UIntN source, std::vector<UIntN> domains);
 
 	// comparisons
-	static Bool compareTrtTableEntriesOnInfluence(
-		const std::shared_ptr<ThermalRelationshipTableEntry>& left,
-		const std::shared_ptr<ThermalRelationshipTableEntry>& right);
 	static Bool compareDomainsOnPriorityAndUtilization(
 		const std::tuple<UIntN, DomainPriority, UtilizationStatus>& left,
 		const std::tuple<UIntN, DomainPriority, UtilizationStatus>& right);
@@ -113,13 +113,13 @@ void TargetLimitAction::execute()
 
 std::vector<UIntN> TargetLimitAction::chooseSourcesToLimitForTarget(UIntN target)
 {
-	// choose sources that are tied for the highest influence in the TRT
+	// choose sources that are tied for the highest influence in the TRT.  the TRT returns entries for the target
+	// sorted with the highest influence first.
 	vector<UIntN> sourcesToLimit;
 	auto availableSourcesForTarget = getTrt()->getEntriesForTarget(target);
 	availableSourcesForTarget = getEntriesWithControlsToLimit(target, availableSourcesForTarget);
 	if (availableSourcesForTarget.size() > 0)
 	{
-		sort(availableSourcesForTarget.begin(), availableSourcesForTarget.end(), compareTrtTableEntriesOnInfluence);
 		for (auto entry = availableSourcesForTarget.begin(); entry != availableSourcesForTarget.end(); entry++)
 		{
 			if ((*entry)->thermalInfluence() == availableSourcesForTarget.front()->thermalInfluence())
@@ -131,8 +131,8 @@ std::vector<UIntN> TargetUnlimitAction::chooseSourcesToUnlimitForTarget(UIntN ta
 
 	if (availableSourcesForTarget.size() > 0)
 	{
-		// choose all sources that are tied for the lowest influence value in the TRT for the target
-		sort(availableSourcesForTarget.begin(), availableSourcesForTarget.end(), compareTrtTableEntriesOnInfluence);
+		// choose all sources that are tied for the lowest influence value in the TRT for the target.  the TRT returns
+		// entries for the target sorted with the highest influence first.
 		for (auto entry = availableSourcesForTarget.begin(); entry != availableSourcesForTarget.end(); entry++)
 		{
 			if ((*entry)->thermalInfluence() == availableSourcesForTarget.back()->thermalInfluence())
@@ -20,11 +20,18 @@
 #include "EsifDataBinaryTrtPackage.h"
 #include "BinaryParse.h"
 #include "TableStringParser.h"
+#include <algorithm>
 
 ThermalRelationshipTable::ThermalRelationshipTable(
 	const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
 	: RelationshipTableBase(entries)
 {
+	m_trtEntries.reserve(m_entries.size());
+	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	{
+		m_trtEntries.push_back(std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry));
+	}
+	indexEntries();
 }
 
 ThermalRelationshipTable::ThermalRelationshipTable()
@@ -39,6 +46,7 @@ ThermalRelationshipTable::~ThermalRelationshipTable()
 ThermalRelationshipTable ThermalRelationshipTable::createTrtFromDptfBuffer(const DptfBuffer& buffer)
 {
 	std::vector<std::shared_ptr<RelationshipTableEntryBase>> entries;
+	std::set<std::pair<std::string, std::string>> relationships;
 	UInt8* data = reinterpret_cast<UInt8*>(buffer.get());
 	struct EsifDataBinaryTrtPackage* currentRow = reinterpret_cast<struct EsifDataBinaryTrtPackage*>(data);
 
@@ -81,18 +89,9 @@ ThermalRelationshipTable ThermalRelationshipTable::createTrtFromDptfBuffer(const
 			if (newTrtEntry)
 			{
 				// Check for duplicate entries. Don't add entry if previous entry exists with same target/source pair
-				Bool isDuplicateEntry = false;
-				for (auto e = entries.begin(); e != entries.end(); e++)
-				{
-					auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*e);
-					if (trtEntry && newTrtEntry->isSameAs(*trtEntry))
-					{
-						isDuplicateEntry = true;
-						break;
-					}
-				}
-
-				if (isDuplicateEntry == false)
+				auto relationship =
+					std::make_pair(newTrtEntry->getSourceDeviceScope(), newTrtEntry->getTargetDeviceScope());
+				if (relationships.insert(relationship).second)
 				{
 					entries.push_back(newTrtEntry);
 				}
@@ -110,19 +109,12 @@ ThermalRelationshipTable ThermalRelationshipTable::createTrtFromDptfBuffer(const
 std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> ThermalRelationshipTable::getEntriesForTarget(
 	UIntN targetIndex)
 {
-	std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> entries;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForTarget.find(targetIndex);
+	if (entries != m_entriesForTarget.end())
 	{
-		if ((*entry)->getTargetDeviceIndex() == targetIndex)
-		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
-			{
-				entries.push_back(trtEntry);
-			}
-		}
+		return entries->second;
 	}
-	return entries;
+	return std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>();
 }
 
 TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
@@ -130,15 +122,14 @@ TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
 	std::set<UIntN> activeTargets)
 {
 	auto minimumSamplePeriod = TimeSpan::createInvalid();
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForSource.find(sourceIndex);
+	if (entries != m_entriesForSource.end())
 	{
-		if (((*entry)->getSourceDeviceIndex() == sourceIndex)
-			&& (activeTargets.find((*entry)->getTargetDeviceIndex()) != activeTargets.end()))
+		for (auto entry = entries->second.begin(); entry != entries->second.end(); ++entry)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
+			if (activeTargets.find((*entry)->getTargetDeviceIndex()) != activeTargets.end())
 			{
-				auto samplingPeriod = trtEntry->thermalSamplingPeriod();
+				auto samplingPeriod = (*entry)->thermalSamplingPeriod();
 				if (minimumSamplePeriod.isInvalid() || samplingPeriod < minimumSamplePeriod)
 				{
 					minimumSamplePeriod = samplingPeriod;
@@ -152,18 +143,15 @@ TimeSpan ThermalRelationshipTable::getMinimumActiveSamplePeriodForSource(
 TimeSpan ThermalRelationshipTable::getShortestSamplePeriodForTarget(UIntN target)
 {
 	auto shortestSamplePeriod = TimeSpan::createInvalid();
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForTarget.find(target);
+	if (entries != m_entriesForTarget.end())
 	{
-		if ((*entry)->getTargetDeviceIndex() == target)
+		for (auto entry = entries->second.begin(); entry != entries->second.end(); ++entry)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
+			auto samplingPeriod = (*entry)->thermalSamplingPeriod();
+			if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
 			{
-				auto samplingPeriod = trtEntry->thermalSamplingPeriod();
-				if (shortestSamplePeriod.isInvalid() || samplingPeriod < shortestSamplePeriod)
-				{
-					shortestSamplePeriod = samplingPeriod;
-				}
+				shortestSamplePeriod = samplingPeriod;
 			}
 		}
 	}
@@ -173,29 +161,37 @@ TimeSpan ThermalRelationshipTable::getShortestSamplePeriodForTarget(UIntN target
 
 TimeSpan ThermalRelationshipTable::getSampleTimeForRelationship(UIntN target, UIntN source) const
 {
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); ++entry)
+	auto entries = m_entriesForTarget.find(target);
+	if (entries != m_entriesForTarget.end())
 	{
-		if (((*entry)->getTargetDeviceIndex() == target) && ((*entry)->getSourceDeviceIndex() == source))
+		for (auto entry = entries->second.begin(); entry != entries->second.end(); ++entry)
 		{
-			auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-			if (trtEntry)
+			if ((*entry)->getSourceDeviceIndex() == source)
 			{
-				return trtEntry->thermalSamplingPeriod();
+				return (*entry)->thermalSamplingPeriod();
 			}
 		}
 	}
 	throw dptf_exception("No match found for target and source in TRT.");
 }
 
+RelationshipTableChanges ThermalRelationshipTable::getChangesFrom(const ThermalRelationshipTable& previousTrt) const
+{
+	return findChangesFrom(previousTrt, [this, &previousTrt](UIntN row, UIntN previousRow) {
+		auto& entry = m_trtEntries[row];
+		auto& previousEntry = previousTrt.m_trtEntries[previousRow];
+		return (entry && previousEntry && (*entry == *previousEntry));
+	});
+}
+
 std::shared_ptr<XmlNode> ThermalRelationshipTable::getXml()
 {
 	auto status = XmlNode::createWrapperElement("trt");
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
+	for (auto entry = m_trtEntries.begin(); entry != m_trtEntries.end(); entry++)
 	{
-		auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
-		if (trtEntry)
+		if (*entry)
 		{
-			status->addChild(trtEntry->getXml());
+			status->addChild((*entry)->getXml());
 		}
 	}
 	return status;
@@ -246,8 +242,8 @@ Bool ThermalRelationshipTable::operator==(const ThermalRelationshipTable& trt) c
 
 	for (UIntN i = 0; i < getNumberOfEntries(); i++)
 	{
-		auto lhsTrtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(m_entries[i]);
-		auto rhsTrtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(trt.m_entries[i]);
+		auto& lhsTrtEntry = m_trtEntries[i];
+		auto& rhsTrtEntry = trt.m_trtEntries[i];
 		if (!lhsTrtEntry || !rhsTrtEntry || !(*lhsTrtEntry == *rhsTrtEntry))
 		{
 			return false;
@@ -266,9 +262,9 @@ DptfBuffer ThermalRelationshipTable::toTrtBinary() const
 {
 	DptfBuffer packages;
 	UInt32 offset = 0;
-	for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
+	for (auto entry = m_trtEntries.begin(); entry != m_trtEntries.end(); entry++)
 	{
-		auto trtEntry = std::dynamic_pointer_cast<ThermalRelationshipTableEntry>(*entry);
+		auto& trtEntry = *entry;
 		if (trtEntry)
 		{
 			UInt32 sourceScopeLength = (UInt32)(*entry)->getSourceDeviceScope().size();
@@ -353,3 +349,40 @@ void ThermalRelationshipTable::throwIfOutOfRange(IntN bytesRemaining)
 		throw dptf_exception("Expected binary data size mismatch. (TRT)");
 	}
 }
+
+void ThermalRelationshipTable::participantIndexesChanged(void)
+{
+	RelationshipTableBase::participantIndexesChanged();
+	indexEntries();
+}
+
+void ThermalRelationshipTable::indexEntries(void)
+{
+	m_entriesForTarget.clear();
+	m_entriesForSource.clear();
+	for (auto entry = m_trtEntries.begin(); entry != m_trtEntries.end(); ++entry)
+	{
+		if (*entry)
+		{
+			m_entriesForTarget[(*entry)->getTargetDeviceIndex()].push_back(*entry);
+			m_entriesForSource[(*entry)->getSourceDeviceIndex()].push_back(*entry);
+		}
+	}
+
+	// Entries with the same influence stay in table order
+	for (auto target = m_entriesForTarget.begin(); target != m_entriesForTarget.end(); ++target)
+	{
+		std::stable_sort(target->second.begin(), target->second.end(), compareEntriesOnInfluence);
+	}
+	for (auto source = m_entriesForSource.begin(); source != m_entriesForSource.end(); ++source)
+	{
+		std::stable_sort(source->second.begin(), source->second.end(), compareEntriesOnInfluence);
+	}
+}
+
+Bool ThermalRelationshipTable::compareEntriesOnInfluence(
+	const std::shared_ptr<ThermalRelationshipTableEntry>& left,
+	const std::shared_ptr<ThermalRelationshipTableEntry>& right)
+{
+	return (left->thermalInfluence() > right->thermalInfluence());
+}
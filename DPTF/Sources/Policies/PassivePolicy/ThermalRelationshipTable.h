@@ -33,16 +33,33 @@ public:
 	static ThermalRelationshipTable createTrtFromDptfBuffer(const DptfBuffer& buffer);
 	DptfBuffer toTrtBinary(void) const;
 
+	// Entries are returned with the highest thermal influence first
 	std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> getEntriesForTarget(UIntN targetIndex);
 	TimeSpan getMinimumActiveSamplePeriodForSource(UIntN sourceIndex, std::set<UIntN> activeTargets);
 	TimeSpan getShortestSamplePeriodForTarget(UIntN target);
 	TimeSpan getSampleTimeForRelationship(UIntN target, UIntN source) const;
 
+	// Relationships added, removed or modified in this table compared to previousTrt
+	RelationshipTableChanges getChangesFrom(const ThermalRelationshipTable& previousTrt) const;
+
 	std::shared_ptr<XmlNode> getXml();
 	Bool operator==(const ThermalRelationshipTable& trt) const;
 	Bool operator!=(const ThermalRelationshipTable& trt) const;
 
+protected:
+	virtual void participantIndexesChanged(void) override;
+
 private:
 	static UIntN countTrtRows(UInt32 size, UInt8* data);
 	static void throwIfOutOfRange(IntN bytesRemaining);
+	static Bool compareEntriesOnInfluence(
+		const std::shared_ptr<ThermalRelationshipTableEntry>& left,
+		const std::shared_ptr<ThermalRelationshipTableEntry>& right);
+
+	void indexEntries(void);
+
+	// m_trtEntries holds each row of m_entries already cast to its TRT type
+	std::vector<std::shared_ptr<ThermalRelationshipTableEntry>> m_trtEntries;
+	std::map<UIntN, std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>> m_entriesForTarget;
+	std::map<UIntN, std::vector<std::shared_ptr<ThermalRelationshipTableEntry>>> m_entriesForSource;
 };
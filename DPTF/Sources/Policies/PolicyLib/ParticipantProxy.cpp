@@ -253,6 +253,11 @@ Temperature ParticipantProxy::getTemperatureOfLastThresholdCrossed() const
 	return m_lastThresholdCrossedTemperature;
 }
 
+void ParticipantProxy::setTimeServiceObject(std::shared_ptr<TimeInterface> time)
+{
+	m_time = time;
+}
+
 std::shared_ptr<DomainProxyInterface> ParticipantProxy::getDomain(UIntN domainIndex)
 {
 	auto domainProxyInterfacePtr = m_domains.at(domainIndex);
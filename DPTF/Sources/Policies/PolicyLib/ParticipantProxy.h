@@ -76,6 +76,9 @@ public:
 	virtual const TimeSpan& getTimeOfLastThresholdCrossed() const override;
 	virtual Temperature getTemperatureOfLastThresholdCrossed() const override;
 
+	// time
+	void setTimeServiceObject(std::shared_ptr<TimeInterface> time);
+
 private:
 	// services
 	PolicyServicesInterfaceContainer m_policyServices;
@@ -108,4 +108,8 @@ std::shared_ptr<DomainProxyInterface> ParticipantTracker::findDomain(DomainType:
 void ParticipantTracker::setTimeServiceObject(std::shared_ptr<TimeInterface> time)
 {
 	m_time = time;
+	for (auto item = m_trackedParticipants.begin(); item != m_trackedParticipants.end(); item++)
+	{
+		item->second.setTimeServiceObject(m_time);
+	}
 }
@@ -17,6 +17,10 @@
 ******************************************************************************/
 
 #include "RelationshipTableBase.h"
+#include <algorithm>
+#include <iterator>
+
+static const std::vector<UIntN> NoRows;
 
 RelationshipTableBase::RelationshipTableBase()
 {
@@ -25,6 +29,8 @@ RelationshipTableBase::RelationshipTableBase()
 RelationshipTableBase::RelationshipTableBase(const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& entries)
 	: m_entries(entries)
 {
+	indexParticipantScopes();
+	indexParticipantIndexes();
 }
 
 RelationshipTableBase::~RelationshipTableBase()
@@ -41,6 +47,11 @@ void RelationshipTableBase::associateParticipant(
 	{
 		m_entries.at(*tableRow)->associateParticipant(participantScope, participantIndex, participantName);
 	}
+
+	if (tableRows.size() > 0)
+	{
+		participantIndexesChanged();
+	}
 }
 
 void RelationshipTableBase::disassociateParticipant(UIntN participantIndex)
@@ -50,6 +61,11 @@ void RelationshipTableBase::disassociateParticipant(UIntN participantIndex)
 	{
 		m_entries.at(*tableRow)->disassociateParticipant(participantIndex);
 	}
+
+	if (tableRows.size() > 0)
+	{
+		participantIndexesChanged();
+	}
 }
 
 void RelationshipTableBase::associateDomain(
@@ -84,28 +100,12 @@ void RelationshipTableBase::disassociateDomain(UIntN participantIndex, UIntN dom
 
 Bool RelationshipTableBase::isParticipantSourceDevice(UIntN participantIndex) const
 {
-	auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-	{
-		if (m_entries.at(*tableRow)->getSourceDeviceIndex() == participantIndex)
-		{
-			return true;
-		}
-	}
-	return false;
+	return (m_rowsForSource.find(participantIndex) != m_rowsForSource.end());
 }
 
 Bool RelationshipTableBase::isParticipantTargetDevice(UIntN participantIndex) const
 {
-	auto tableRows = findTableRowsWithParticipantIndex(participantIndex);
-	for (auto tableRow = tableRows.begin(); tableRow != tableRows.end(); ++tableRow)
-	{
-		if (m_entries.at(*tableRow)->getTargetDeviceIndex() == participantIndex)
-		{
-			return true;
-		}
-	}
-	return false;
+	return (m_rowsForTarget.find(participantIndex) != m_rowsForTarget.end());
 }
 
 UIntN RelationshipTableBase::getNumberOfEntries(void) const
@@ -115,40 +115,55 @@ UIntN RelationshipTableBase::getNumberOfEntries(void) const
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantScope(std::string participantScope) const
 {
-	std::vector<UIntN> rows;
-	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	auto rows = m_rowsForScope.find(participantScope);
+	if (rows != m_rowsForScope.end())
 	{
-		auto entry = m_entries.at(row);
-		if ((entry->getSourceDeviceScope() == participantScope) || (entry->getTargetDeviceScope() == participantScope))
-		{
-			rows.push_back(row);
-		}
+		return rows->second;
 	}
-	return rows;
+	return std::vector<UIntN>();
 }
 
 std::vector<UIntN> RelationshipTableBase::findTableRowsWithParticipantIndex(UIntN participantIndex) const
 {
+	auto& sourceRows = findTableRowsWithSourceIndex(participantIndex);
+	auto& targetRows = findTableRowsWithTargetIndex(participantIndex);
+
+	// Both lists are in table order, so merging them keeps the rows in table order without duplicates
 	std::vector<UIntN> rows;
-	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	rows.reserve(sourceRows.size() + targetRows.size());
+	std::set_union(
+		sourceRows.begin(), sourceRows.end(), targetRows.begin(), targetRows.end(), std::back_inserter(rows));
+	return rows;
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithTargetIndex(UIntN targetIndex) const
+{
+	auto rows = m_rowsForTarget.find(targetIndex);
+	if (rows != m_rowsForTarget.end())
 	{
-		auto entry = m_entries.at(row);
-		if ((entry->getSourceDeviceIndex() == participantIndex) || (entry->getTargetDeviceIndex() == participantIndex))
-		{
-			rows.push_back(row);
-		}
+		return rows->second;
 	}
-	return rows;
+	return NoRows;
+}
+
+const std::vector<UIntN>& RelationshipTableBase::findTableRowsWithSourceIndex(UIntN sourceIndex) const
+{
+	auto rows = m_rowsForSource.find(sourceIndex);
+	if (rows != m_rowsForSource.end())
+	{
+		return rows->second;
+	}
+	return NoRows;
 }
 
 std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 {
 	std::set<UIntN> targetIndexes;
-	for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+	for (auto target = m_rowsForTarget.begin(); target != m_rowsForTarget.end(); ++target)
 	{
-		if ((*entry)->targetDeviceIndexValid())
+		if (target->first != Constants::Invalid)
 		{
-			targetIndexes.insert((*entry)->getTargetDeviceIndex());
+			targetIndexes.insert(targetIndexes.end(), target->first);
 		}
 	}
 	return targetIndexes;
@@ -157,12 +172,87 @@ std::set<UIntN> RelationshipTableBase::getAllTargetIndexes() const
 std::set<UIntN> RelationshipTableBase::getAllSourceIndexes() const
 {
 	std::set<UIntN> sourceIndexes;
-	for (auto entry = m_entries.begin(); entry < m_entries.end(); ++entry)
+	for (auto source = m_rowsForSource.begin(); source != m_rowsForSource.end(); ++source)
 	{
-		if ((*entry)->sourceDeviceIndexValid())
+		if (source->first != Constants::Invalid)
 		{
-			sourceIndexes.insert((*entry)->getSourceDeviceIndex());
+			sourceIndexes.insert(sourceIndexes.end(), source->first);
 		}
 	}
 	return sourceIndexes;
 }
+
+RelationshipTableChanges RelationshipTableBase::findChangesFrom(
+	const RelationshipTableBase& previousTable,
+	const std::function<Bool(UIntN row, UIntN previousRow)>& isSameRow) const
+{
+	std::map<std::pair<std::string, std::string>, UIntN> previousRows;
+	for (UIntN previousRow = 0; previousRow < previousTable.getNumberOfEntries(); ++previousRow)
+	{
+		auto& entry = previousTable.m_entries[previousRow];
+		previousRows.insert(
+			std::make_pair(std::make_pair(entry->getSourceDeviceScope(), entry->getTargetDeviceScope()), previousRow));
+	}
+
+	RelationshipTableChanges changes;
+	std::vector<Bool> isPreviousRowMatched(previousTable.getNumberOfEntries(), false);
+	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	{
+		auto& entry = m_entries[row];
+		auto previousRow =
+			previousRows.find(std::make_pair(entry->getSourceDeviceScope(), entry->getTargetDeviceScope()));
+		if (previousRow == previousRows.end())
+		{
+			changes.addAddedEntry(entry);
+		}
+		else
+		{
+			isPreviousRowMatched[previousRow->second] = true;
+			if (isSameRow(row, previousRow->second) == false)
+			{
+				changes.addModifiedEntry(previousTable.m_entries[previousRow->second], entry);
+			}
+		}
+	}
+
+	for (UIntN previousRow = 0; previousRow < previousTable.getNumberOfEntries(); ++previousRow)
+	{
+		if (isPreviousRowMatched[previousRow] == false)
+		{
+			changes.addRemovedEntry(previousTable.m_entries[previousRow]);
+		}
+	}
+
+	return changes;
+}
+
+void RelationshipTableBase::participantIndexesChanged(void)
+{
+	indexParticipantIndexes();
+}
+
+void RelationshipTableBase::indexParticipantScopes(void)
+{
+	m_rowsForScope.clear();
+	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	{
+		auto& entry = m_entries[row];
+		m_rowsForScope[entry->getSourceDeviceScope()].push_back(row);
+		if (entry->getTargetDeviceScope() != entry->getSourceDeviceScope())
+		{
+			m_rowsForScope[entry->getTargetDeviceScope()].push_back(row);
+		}
+	}
+}
+
+void RelationshipTableBase::indexParticipantIndexes(void)
+{
+	m_rowsForTarget.clear();
+	m_rowsForSource.clear();
+	for (UIntN row = 0; row < getNumberOfEntries(); ++row)
+	{
+		auto& entry = m_entries[row];
+		m_rowsForSource[entry->getSourceDeviceIndex()].push_back(row);
+		m_rowsForTarget[entry->getTargetDeviceIndex()].push_back(row);
+	}
+}
@@ -21,6 +21,8 @@
 #include "Dptf.h"
 #include "RelationshipTableInterface.h"
 #include "RelationshipTableEntryBase.h"
+#include "RelationshipTableChanges.h"
+#include <functional>
 
 class dptf_export RelationshipTableBase : public RelationshipTableInterface
 {
@@ -44,6 +46,26 @@ public:
 protected:
 	std::vector<UIntN> findTableRowsWithParticipantScope(std::string participantScope) const;
 	std::vector<UIntN> findTableRowsWithParticipantIndex(UIntN participantIndex) const;
+	const std::vector<UIntN>& findTableRowsWithTargetIndex(UIntN targetIndex) const;
+	const std::vector<UIntN>& findTableRowsWithSourceIndex(UIntN sourceIndex) const;
+
+	// Called after participants are associated or disassociated so derived tables can rebuild their own indexes
+	virtual void participantIndexesChanged(void);
+
+	// Rows are matched to the previous table by source and target scope.  isSameRow(row, previousRow) compares the
+	// values of matched rows, which only the derived tables know about.
+	RelationshipTableChanges findChangesFrom(
+		const RelationshipTableBase& previousTable,
+		const std::function<Bool(UIntN row, UIntN previousRow)>& isSameRow) const;
 
 	std::vector<std::shared_ptr<RelationshipTableEntryBase>> m_entries;
+
+private:
+	void indexParticipantScopes(void);
+	void indexParticipantIndexes(void);
+
+	// Table rows in table order, keyed by scope or by the participant index currently associated with the row
+	std::map<std::string, std::vector<UIntN>> m_rowsForScope;
+	std::map<UIntN, std::vector<UIntN>> m_rowsForTarget;
+	std::map<UIntN, std::vector<UIntN>> m_rowsForSource;
 };
@@ -0,0 +1,107 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "RelationshipTableChanges.h"
+
+RelationshipTableChanges::RelationshipTableChanges()
+	: m_addedEntries()
+	, m_removedEntries()
+	, m_modifiedEntries()
+{
+}
+
+RelationshipTableChanges::~RelationshipTableChanges()
+{
+}
+
+void RelationshipTableChanges::addAddedEntry(std::shared_ptr<RelationshipTableEntryBase> entry)
+{
+	m_addedEntries.push_back(entry);
+}
+
+void RelationshipTableChanges::addRemovedEntry(std::shared_ptr<RelationshipTableEntryBase> previousEntry)
+{
+	m_removedEntries.push_back(previousEntry);
+}
+
+void RelationshipTableChanges::addModifiedEntry(
+	std::shared_ptr<RelationshipTableEntryBase> previousEntry,
+	std::shared_ptr<RelationshipTableEntryBase> entry)
+{
+	m_modifiedEntries.push_back(std::make_pair(previousEntry, entry));
+}
+
+Bool RelationshipTableChanges::hasChanges(void) const
+{
+	return ((m_addedEntries.size() > 0) || (m_removedEntries.size() > 0) || (m_modifiedEntries.size() > 0));
+}
+
+const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& RelationshipTableChanges::getAddedEntries(void) const
+{
+	return m_addedEntries;
+}
+
+const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& RelationshipTableChanges::getRemovedEntries(void) const
+{
+	return m_removedEntries;
+}
+
+const std::vector<RelationshipTableChanges::ModifiedEntry>& RelationshipTableChanges::getModifiedEntries(void) const
+{
+	return m_modifiedEntries;
+}
+
+std::set<UIntN> RelationshipTableChanges::getAffectedTargetIndexes(void) const
+{
+	std::set<UIntN> targets;
+	for (auto entry = m_addedEntries.begin(); entry != m_addedEntries.end(); ++entry)
+	{
+		targets.insert((*entry)->getTargetDeviceIndex());
+	}
+	for (auto entry = m_removedEntries.begin(); entry != m_removedEntries.end(); ++entry)
+	{
+		targets.insert((*entry)->getTargetDeviceIndex());
+	}
+	for (auto entry = m_modifiedEntries.begin(); entry != m_modifiedEntries.end(); ++entry)
+	{
+		targets.insert(entry->first->getTargetDeviceIndex());
+		targets.insert(entry->second->getTargetDeviceIndex());
+	}
+	targets.erase(Constants::Invalid);
+	return targets;
+}
+
+std::set<UIntN> RelationshipTableChanges::getAffectedSourceIndexes(void) const
+{
+	std::set<UIntN> sources;
+	for (auto entry = m_addedEntries.begin(); entry != m_addedEntries.end(); ++entry)
+	{
+		sources.insert((*entry)->getSourceDeviceIndex());
+	}
+	for (auto entry = m_removedEntries.begin(); entry != m_removedEntries.end(); ++entry)
+	{
+		sources.insert((*entry)->getSourceDeviceIndex());
+	}
+	for (auto entry = m_modifiedEntries.begin(); entry != m_modifiedEntries.end(); ++entry)
+	{
+		sources.insert(entry->first->getSourceDeviceIndex());
+		sources.insert(entry->second->getSourceDeviceIndex());
+	}
+	sources.erase(Constants::Invalid);
+	return sources;
+}
@@ -0,0 +1,55 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "RelationshipTableEntryBase.h"
+
+// The relationships that differ between two versions of a relationship table.  Relationships are matched by their
+// source and target scope, so removed and previous entries keep the participant indexes of the previous table.
+class dptf_export RelationshipTableChanges
+{
+public:
+	// The previous entry and the entry that replaced it
+	typedef std::pair<std::shared_ptr<RelationshipTableEntryBase>, std::shared_ptr<RelationshipTableEntryBase>>
+		ModifiedEntry;
+
+	RelationshipTableChanges();
+	~RelationshipTableChanges();
+
+	void addAddedEntry(std::shared_ptr<RelationshipTableEntryBase> entry);
+	void addRemovedEntry(std::shared_ptr<RelationshipTableEntryBase> previousEntry);
+	void addModifiedEntry(
+		std::shared_ptr<RelationshipTableEntryBase> previousEntry,
+		std::shared_ptr<RelationshipTableEntryBase> entry);
+
+	Bool hasChanges(void) const;
+	const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& getAddedEntries(void) const;
+	const std::vector<std::shared_ptr<RelationshipTableEntryBase>>& getRemovedEntries(void) const;
+	const std::vector<ModifiedEntry>& getModifiedEntries(void) const;
+
+	// Participant indexes of the targets and sources that appear in any added, removed or modified relationship
+	std::set<UIntN> getAffectedTargetIndexes(void) const;
+	std::set<UIntN> getAffectedSourceIndexes(void) const;
+
+private:
+	std::vector<std::shared_ptr<RelationshipTableEntryBase>> m_addedEntries;
+	std::vector<std::shared_ptr<RelationshipTableEntryBase>> m_removedEntries;
+	std::vector<ModifiedEntry> m_modifiedEntries;
+};
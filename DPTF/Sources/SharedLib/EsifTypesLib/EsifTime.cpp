@@ -19,6 +19,29 @@
 #include "EsifTime.h"
 #include "esif_ccb_time.h"
 
+#ifdef DPTF_SIMULATOR
+static EsifTimeSource g_timeSource = nullptr;
+
+void EsifTime::setTimeSource(EsifTimeSource timeSource)
+{
+	g_timeSource = timeSource;
+}
+#endif
+
+TimeSpan EsifTime::getMonotonicTime(void)
+{
+#ifdef DPTF_SIMULATOR
+	if (g_timeSource != nullptr)
+	{
+		return g_timeSource();
+	}
+#endif
+
+	esif_ccb_time_t currentTimeInMilliSeconds;
+	esif_ccb_monotonic_time(&currentTimeInMilliSeconds);
+	return TimeSpan::createFromMilliseconds(currentTimeInMilliSeconds);
+}
+
 EsifTime::EsifTime(void)
 {
 	refresh();
@@ -83,6 +106,13 @@ tm EsifTime::getLocalTime(void)
 
 TimeSpan EsifTime::getCurrentTime(void)
 {
+#ifdef DPTF_SIMULATOR
+	if (g_timeSource != nullptr)
+	{
+		return g_timeSource();
+	}
+#endif
+
 	esif_ccb_time_t currentTimeInMilliSeconds;
 	esif_ccb_system_time(&currentTimeInMilliSeconds);
 	return TimeSpan::createFromMilliseconds(currentTimeInMilliSeconds);
@@ -20,9 +20,21 @@
 
 #include "Dptf.h"
 
+typedef TimeSpan (*EsifTimeSource)(void);
+
 class EsifTime final
 {
 public:
+#ifdef DPTF_SIMULATOR
+	// Replaces the system clocks behind EsifTime in this module, or restores them when passed nullptr.  Only simulator
+	// builds have it.  It must be set before any framework thread is started.
+	static void setTimeSource(EsifTimeSource timeSource);
+#endif
+
+	// Returns the time on a clock that is not changed by wall clock adjustments.  Use it for deadlines and intervals;
+	// it is not comparable with getTimeStamp().
+	static TimeSpan getMonotonicTime(void);
+
 	// Creates a new instance of EsifTime initialized to the current time.
 	EsifTime(void);
 
@@ -37,7 +37,13 @@ class ParticipantServicesInterface : public MessageLoggingInterface,
 									 public UserPreferredCacheInterface
 {
 public:
-	virtual void registerRequestHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
-	virtual void unregisterRequestHandler(DptfRequestType::Enum requestType, RequestHandlerInterface* handler) = 0;
+	virtual void registerRequestHandler(
+		DptfRequestType::Enum requestType,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) = 0;
+	virtual void unregisterRequestHandler(
+		DptfRequestType::Enum requestType,
+		UIntN domainIndex,
+		RequestHandlerInterface* handler) = 0;
 	virtual DomainType::Type getDomainType(UIntN domainIndex) = 0;
 };
@@ -41,6 +41,8 @@
 #include "UserPresenceCorrelation.h"
 #include "MbtHint.h"
 
+class TimeInterface;
+
 class dptf_export PolicyInterface
 {
 public:
@@ -256,6 +258,15 @@ public:
 	virtual void userInteractionChanged(UserInteraction::Type userInteraction) = 0;
 	virtual void userPresenceCorrelationStatusChanged(UserPresenceCorrelation::Type correlationStatus) = 0;
 	virtual void foregroundRatioChanged(UIntN ratio) = 0;
+
+#ifdef DPTF_SIMULATOR
+	//
+	// Replaces the clock the policy uses for all of its time keeping, which lets the simulator run the policy on
+	// virtual time.  Only simulator builds have it, and it is the last entry so that the vtable layout of the
+	// functions above is the same in both builds.  PolicyBase::overrideTimeObject implements it.
+	//
+	virtual void overrideTimeObject(std::shared_ptr<TimeInterface> timeObject) = 0;
+#endif
 };
 
 //
@@ -17,7 +17,7 @@
 ******************************************************************************/
 
 #include "XmlNode.h"
-#include "StringParser.h"
+#include "XmlWriter.h"
 
 using namespace std;
 
@@ -86,121 +86,48 @@ std::string XmlNode::getData()
 	return m_data;
 }
 
-std::string tab(UInt32 numberOfTabs)
-{
-	string value;
-	value.insert(0, numberOfTabs, '\t');
-	return value;
-}
-
-std::string tagOpen(const std::string& name)
-{
-	stringstream stream;
-	stream << "<" << name << ">";
-	return stream.str();
-}
-
-std::string tagClose(const std::string& name)
-{
-	stringstream stream;
-	stream << "</" << name << ">";
-	return stream.str();
-}
-
-std::string tagOpenAndClose(const std::string& name)
-{
-	stringstream stream;
-	stream << "<" << name << "/>";
-	return stream.str();
-}
-
-std::string newLine()
-{
-	return "\n";
-}
-
-std::string commentOpen()
-{
-	return "<!-- ";
-}
-
-std::string commentClose()
-{
-	return " -->";
-}
-
-std::string sanitizeData(const std::string& input)
+std::string XmlNode::toString(UInt8 tabDepth)
 {
-	string modified = input;
-	modified = StringParser::replaceAll(modified, "&", "&amp;");
-	modified = StringParser::replaceAll(modified, "<", "&lt;");
-	modified = StringParser::replaceAll(modified, ">", "&gt;");
-	modified = StringParser::replaceAll(modified, "'", "&apos;");
-	modified = StringParser::replaceAll(modified, "\"", "&quot;");
-	modified = StringParser::removeCharacter(modified, '\0');
-	return modified;
+	XmlWriter writer(XmlWriter::DefaultCapacity, tabDepth);
+	writeTo(writer);
+	return writer.release();
 }
 
-std::string XmlNode::toString(UInt8 tabDepth)
+void XmlNode::writeTo(XmlWriter& writer) const
 {
-	stringstream stream;
-
 	switch (m_type)
 	{
 	case NodeType::Root:
-		stream << generateXmlForChildren(tabDepth);
+		writer.beginRoot();
+		writeChildrenTo(writer);
+		writer.endRoot();
 		break;
 	case NodeType::Element:
-		stream << generateXmlForElement(tabDepth);
-		break;
-	case NodeType::Comment:
-		stream << generateXmlForComment(tabDepth);
-		break;
-	default:
-		break;
-	}
-
-	return stream.str();
-}
-
-std::string XmlNode::generateXmlForElement(UInt8 tabDepth)
-{
-	stringstream stream;
-	if (hasNoData())
-	{
-		if (hasNoChildren())
+		if (hasNoData())
 		{
-			stream << tab(tabDepth) << tagOpenAndClose(m_tag);
+			writer.beginElement(m_tag);
+			writeChildrenTo(writer);
+			writer.endElement();
 		}
 		else
 		{
-			stream << tab(tabDepth) << tagOpen(m_tag) << newLine();
-			stream << generateXmlForChildren(tabDepth + 1);
-			stream << tab(tabDepth) << tagClose(m_tag);
+			writer.writeDataElement(m_tag, m_data);
 		}
+		break;
+	case NodeType::Comment:
+		writer.writeComment(m_data);
+		break;
+	default:
+		break;
 	}
-	else
-	{
-		stream << tab(tabDepth) << tagOpen(m_tag) << sanitizeData(m_data) << tagClose(m_tag);
-	}
-	return stream.str();
-}
-
-std::string XmlNode::generateXmlForComment(UInt8 tabDepth)
-{
-	stringstream stream;
-	stream << tab(tabDepth) << commentOpen() << sanitizeData(m_data) << commentClose();
-	return stream.str();
 }
 
-std::string XmlNode::generateXmlForChildren(UInt8 tabDepth)
+void XmlNode::writeChildrenTo(XmlWriter& writer) const
 {
-	stringstream stream;
 	for (auto child = m_children.begin(); child != m_children.end(); ++child)
 	{
-		stream << (*child)->toString(tabDepth) << newLine();
+		(*child)->writeTo(writer);
 	}
-	return stream.str();
 }
 
 bool XmlNode::hasNoChildren() const
@@ -20,6 +20,8 @@
 
 #include "Dptf.h"
 
+class XmlWriter;
+
 namespace NodeType
 {
 	enum Type
@@ -46,13 +48,12 @@ public:
 	std::string getData();
 	NodeType::Type getNodeType();
 	std::string toString(UInt8 tabDepth = 0);
+	void writeTo(XmlWriter& writer) const;
 
 private:
 	XmlNode(NodeType::Type type, std::string tag);
 	XmlNode(NodeType::Type type, std::string tag, std::string data);
-	std::string generateXmlForChildren(UInt8 tabDepth);
-	std::string generateXmlForComment(UInt8 tabDepth);
-	std::string generateXmlForElement(UInt8 tabDepth);
+	void writeChildrenTo(XmlWriter& writer) const;
 	bool hasNoData() const;
 	bool hasNoChildren() const;
 
@@ -0,0 +1,189 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "XmlWriter.h"
+
+using namespace std;
+
+XmlWriter::XmlWriter(size_t capacity, UInt8 tabDepth)
+	: m_buffer()
+	, m_openNodes()
+	, m_tabDepth(tabDepth)
+	, m_elementDepth(0)
+	, m_isStartTagPending(false)
+{
+	m_buffer.reserve(capacity);
+	m_openNodes.reserve(16);
+}
+
+void XmlWriter::beginRoot(void)
+{
+	openPendingStartTag();
+	OpenNode node = {0, 0, true};
+	m_openNodes.push_back(node);
+}
+
+void XmlWriter::endRoot(void)
+{
+	if (m_openNodes.empty() || (m_openNodes.back().isRoot == false))
+	{
+		throw dptf_exception("XmlWriter::endRoot() does not match an open root.");
+	}
+
+	m_openNodes.pop_back();
+	completeNode();
+}
+
+void XmlWriter::beginElement(const std::string& tag)
+{
+	openPendingStartTag();
+	writeTabs();
+	m_buffer.push_back('<');
+	OpenNode node = {m_buffer.size(), tag.size(), false};
+	m_buffer.append(tag);
+	m_openNodes.push_back(node);
+	m_elementDepth++;
+
+	// Whether this becomes <tag/> or <tag>...</tag> is not known until a child is written or the element ends
+	m_isStartTagPending = true;
+}
+
+void XmlWriter::endElement(void)
+{
+	if (m_openNodes.empty() || m_openNodes.back().isRoot)
+	{
+		throw dptf_exception("XmlWriter::endElement() does not match an open element.");
+	}
+
+	OpenNode node = m_openNodes.back();
+	m_openNodes.pop_back();
+	m_elementDepth--;
+
+	if (m_isStartTagPending)
+	{
+		m_buffer.append("/>");
+		m_isStartTagPending = false;
+	}
+	else
+	{
+		writeTabs();
+		m_buffer.append("</");
+		m_buffer.append(m_buffer, node.tagOffset, node.tagLength);
+		m_buffer.push_back('>');
+	}
+	completeNode();
+}
+
+void XmlWriter::writeDataElement(const std::string& tag, const std::string& data)
+{
+	openPendingStartTag();
+	writeTabs();
+	m_buffer.push_back('<');
+	m_buffer.append(tag);
+	if (data.empty())
+	{
+		m_buffer.append("/>");
+	}
+	else
+	{
+		m_buffer.push_back('>');
+		writeSanitized(data);
+		m_buffer.append("</");
+		m_buffer.append(tag);
+		m_buffer.push_back('>');
+	}
+	completeNode();
+}
+
+void XmlWriter::writeComment(const std::string& comment)
+{
+	openPendingStartTag();
+	writeTabs();
+	m_buffer.append("<!-- ");
+	writeSanitized(comment);
+	m_buffer.append(" -->");
+	completeNode();
+}
+
+const std::string& XmlWriter::getString(void) const
+{
+	return m_buffer;
+}
+
+std::string XmlWriter::release(void)
+{
+	std::string output;
+	output.swap(m_buffer);
+	m_openNodes.clear();
+	m_elementDepth = 0;
+	m_isStartTagPending = false;
+	return output;
+}
+
+void XmlWriter::openPendingStartTag(void)
+{
+	if (m_isStartTagPending)
+	{
+		m_buffer.append(">\n");
+		m_isStartTagPending = false;
+	}
+}
+
+void XmlWriter::completeNode(void)
+{
+	// Children of a root or element each end with a new line; top-level nodes do not
+	if (!m_openNodes.empty())
+	{
+		m_buffer.push_back('\n');
+	}
+}
+
+void XmlWriter::writeTabs(void)
+{
+	m_buffer.append(m_tabDepth + m_elementDepth, '\t');
+}
+
+void XmlWriter::writeSanitized(const std::string& data)
+{
+	for (auto c = data.begin(); c != data.end(); ++c)
+	{
+		switch (*c)
+		{
+		case '&':
+			m_buffer.append("&amp;");
+			break;
+		case '<':
+			m_buffer.append("&lt;");
+			break;
+		case '>':
+			m_buffer.append("&gt;");
+			break;
+		case '\'':
+			m_buffer.append("&apos;");
+			break;
+		case '"':
+			m_buffer.append("&quot;");
+			break;
+		case '\0':
+			break;
+		default:
+			m_buffer.push_back(*c);
+			break;
+		}
+	}
+}
@@ -0,0 +1,64 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+
+// Writes XML directly into a single output buffer with the same formatting as XmlNode::toString(), without building
+// an intermediate tree.  Every beginRoot()/beginElement() must be matched by endRoot()/endElement() in reverse order.
+class XmlWriter
+{
+public:
+	static const size_t DefaultCapacity = 4096;
+
+	XmlWriter(size_t capacity = DefaultCapacity, UInt8 tabDepth = 0);
+
+	// A root groups its children without adding a tag, like a node from XmlNode::createRoot()
+	void beginRoot(void);
+	void endRoot(void);
+
+	void beginElement(const std::string& tag);
+	void endElement(void);
+
+	void writeDataElement(const std::string& tag, const std::string& data);
+	void writeComment(const std::string& comment);
+
+	const std::string& getString(void) const;
+	std::string release(void);
+
+private:
+	// An open root or element; roots have no tag
+	struct OpenNode
+	{
+		size_t tagOffset;
+		size_t tagLength;
+		Bool isRoot;
+	};
+
+	std::string m_buffer;
+	std::vector<OpenNode> m_openNodes;
+	UInt8 m_tabDepth;
+	UInt32 m_elementDepth;
+	Bool m_isStartTagPending;
+
+	void openPendingStartTag(void);
+	void completeNode(void);
+	void writeTabs(void);
+	void writeSanitized(const std::string& data);
+};
@@ -0,0 +1,416 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+//
+// Runs the Critical, Passive and Active policies on a simulated platform and checks what they ask of it.  Each policy
+// watches its own sensor, so the scenarios do not disturb one another:
+//
+//   SEN1  has hot and critical trip points.  A scripted scenario walks it through both, then a soak repeats an hourly
+//         excursion past the hot trip point for the requested number of simulated hours.  The Critical policy must
+//         request hibernate and shutdown at the right temperatures and repeat them on its watchdog.
+//   SEN2  has a passive trip point and is the target of TCPU in the TRT.  The Passive policy must step the PL1 limit
+//         of TCPU down to its minimum while SEN2 is above the trip point and back up to its maximum once it cools.
+//   SEN3  has two active trip points and is the target of TFN1 in the ART.  The Active policy must run TFN1 at the
+//         speed the ART gives for the highest trip point crossed.
+//
+// The run reports how fast virtual time went and the real time spent per timer and event, so it doubles as a
+// reproducible profile of the framework and the policies.
+//
+// Usage: DptfSimulator [hours] [-v]
+//
+
+#include "Simulator.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+static const Guid CriticalPolicyGuid(
+	0xE7, 0x8A, 0xC6, 0x97, 0xFA, 0x15, 0x9C, 0x49, 0xB8, 0xC9, 0x5D, 0xA8, 0x1D, 0x60, 0x6E, 0x0A);
+static const Guid PassivePolicyGuid(
+	0xD6, 0x41, 0xA4, 0x42, 0x6A, 0xAE, 0x2B, 0x46, 0xA8, 0x4B, 0x4A, 0x8C, 0xE7, 0x90, 0x27, 0xD3);
+static const Guid ActivePolicyGuid(
+	0x89, 0xC3, 0x95, 0x3A, 0xB8, 0xE4, 0x29, 0x46, 0xA5, 0x26, 0xC5, 0x2C, 0x88, 0x62, 0x6B, 0xAE);
+
+// Participant handles.  Each participant's domain takes the next handle.
+static const esif_handle_t CriticalSensor = 100;
+static const esif_handle_t PassiveSensor = 102;
+static const esif_handle_t ActiveSensor = 104;
+static const esif_handle_t Processor = 110;
+static const esif_handle_t Fan = 112;
+
+static const double HotTripPointCelsius = 100.0;
+static const double CriticalTripPointCelsius = 110.0;
+static const double PassiveTripPointCelsius = 90.0;
+static const double Ac0TripPointCelsius = 70.0;
+static const double Ac1TripPointCelsius = 60.0;
+static const double IdleCelsius = 40.0;
+
+// The fan speeds the ART gives for AC0 and AC1, in whole percent
+static const UInt32 Ac0FanSpeed = 100;
+static const UInt32 Ac1FanSpeed = 50;
+
+// The PL1 range of the processor.  The Passive policy moves it one step per TRT sampling period.
+static const UInt32 MinPowerLimitWatts = 10;
+static const UInt32 MaxPowerLimitWatts = 25;
+static const UInt32 PowerStepWatts = 5;
+static const UInt64 SamplingPeriodSeconds = 5;
+
+// Long enough for the Passive policy to move PL1 across its whole range
+static const UInt64 PassiveHoldSeconds = 60;
+
+// The Critical policy repeats its action at this interval for as long as the trip point stays crossed
+static const UInt64 WatchdogSeconds = 15;
+
+// Hold times are not multiples of the watchdog interval, so no repeat falls on the end of a hold
+static const UInt64 HotHoldSeconds = 100;
+static const UInt64 CriticalHoldSeconds = 50;
+static const UInt64 SoakHotHoldSeconds = 290;
+static const UInt64 SoakCycleSeconds = 3600;
+static const UInt64 DefaultSoakHours = 1000;
+
+static UIntN g_failureCount = 0;
+
+static void check(Bool condition, const string& description)
+{
+	if (condition == false)
+	{
+		printf("FAILED: %s\n", description.c_str());
+		g_failureCount++;
+	}
+}
+
+static UInt64 countPowerRequests(const vector<PlatformPowerRequest>& requests, PlatformPowerAction::Type action)
+{
+	UInt64 count = 0;
+	for (auto request = requests.begin(); request != requests.end(); ++request)
+	{
+		if (request->action == action)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+static void hold(
+	Simulator& simulator,
+	SimulatedPlatform& platform,
+	esif_handle_t sensor,
+	double celsius,
+	UInt64 seconds)
+{
+	platform.setSensorTemperature(sensor, Temperature::fromCelsius(celsius));
+	simulator.advance(TimeSpan::createFromSeconds(seconds));
+}
+
+static UInt64 expectedRepeats(UInt64 holdSeconds)
+{
+	return 1 + (holdSeconds / WatchdogSeconds);
+}
+
+static void checkPowerRequests(const vector<PlatformPowerRequest>& requests, UInt64 soakCycles)
+{
+	auto hotTripPoint = Temperature::fromCelsius(HotTripPointCelsius);
+	auto criticalTripPoint = Temperature::fromCelsius(CriticalTripPointCelsius);
+
+	UInt64 expectedHibernates = expectedRepeats(HotHoldSeconds) + soakCycles * expectedRepeats(SoakHotHoldSeconds);
+	UInt64 expectedShutdowns = expectedRepeats(CriticalHoldSeconds);
+
+	check(
+		countPowerRequests(requests, PlatformPowerAction::Sleep) == 0,
+		"no sleep is requested without a warm trip point");
+	check(
+		countPowerRequests(requests, PlatformPowerAction::Hibernate) == expectedHibernates,
+		"hibernate is requested " + to_string(expectedHibernates) + " times");
+	check(
+		countPowerRequests(requests, PlatformPowerAction::Shutdown) == expectedShutdowns,
+		"shutdown is requested " + to_string(expectedShutdowns) + " times");
+
+	for (auto request = requests.begin(); request != requests.end(); ++request)
+	{
+		if (request->temperature.isValid() == false)
+		{
+			check(false, PlatformPowerAction::ToString(request->action) + " request carries the temperature");
+			continue;
+		}
+
+		if (request->action == PlatformPowerAction::Hibernate)
+		{
+			check(
+				(request->temperature >= hotTripPoint) && (request->temperature < criticalTripPoint),
+				"hibernate at " + request->temperature.toString() + " is between the hot and critical trip points");
+		}
+		else if (request->action == PlatformPowerAction::Shutdown)
+		{
+			check(
+				request->temperature >= criticalTripPoint,
+				"shutdown at " + request->temperature.toString() + " is at or above the critical trip point");
+		}
+	}
+}
+
+// Checks that the PL1 limits set since the given point in the history move one way by at most a step at a time
+static void checkPowerLimitSteps(
+	const vector<Power>& history,
+	size_t first,
+	Power previous,
+	Bool decreasing,
+	const string& phase)
+{
+	auto stepSize = Power::createFromWatts(PowerStepWatts);
+	for (size_t i = first; i < history.size(); i++)
+	{
+		Bool inDirection = decreasing ? (history[i] <= previous) : (history[i] >= previous);
+		check(
+			inDirection && ((decreasing ? (previous - history[i]) : (history[i] - previous)) <= stepSize),
+			"PL1 moves by at most one step from " + previous.toString() + " to " + history[i].toString() + " "
+				+ phase);
+		previous = history[i];
+	}
+}
+
+static void runCriticalScenario(Simulator& simulator, SimulatedPlatform& platform)
+{
+	// Warming up to just below the hot trip point must not disturb the platform
+	hold(simulator, platform, CriticalSensor, IdleCelsius, 60);
+	hold(simulator, platform, CriticalSensor, 80.0, 60);
+	hold(simulator, platform, CriticalSensor, 99.0, 60);
+	check(platform.getPowerRequests().empty(), "no power request is made below the hot trip point");
+
+	hold(simulator, platform, CriticalSensor, 105.0, HotHoldSeconds);
+	hold(simulator, platform, CriticalSensor, 115.0, CriticalHoldSeconds);
+
+	// Once cool, the pending watchdog expires without a new request
+	hold(simulator, platform, CriticalSensor, IdleCelsius, 10 * WatchdogSeconds);
+}
+
+static void runPassiveScenario(Simulator& simulator, SimulatedPlatform& platform)
+{
+	auto minPowerLimit = Power::createFromWatts(MinPowerLimitWatts);
+	auto maxPowerLimit = Power::createFromWatts(MaxPowerLimitWatts);
+
+	// The processor runs at its maximum PL1 for as long as the target stays below the passive trip point
+	hold(simulator, platform, PassiveSensor, IdleCelsius, 60);
+	hold(simulator, platform, PassiveSensor, 85.0, 60);
+	auto history = platform.getPowerLimitHistory(Processor);
+	check(platform.getPowerLimit(Processor) == maxPowerLimit, "PL1 is at its maximum below the passive trip point");
+	for (auto powerLimit = history.begin(); powerLimit != history.end(); ++powerLimit)
+	{
+		check(*powerLimit == maxPowerLimit, "PL1 is not limited below the passive trip point");
+	}
+
+	size_t hotStart = history.size();
+	hold(simulator, platform, PassiveSensor, 95.0, PassiveHoldSeconds);
+	history = platform.getPowerLimitHistory(Processor);
+	check(
+		platform.getPowerLimit(Processor) == minPowerLimit,
+		"PL1 is limited to " + minPowerLimit.toString() + " above the passive trip point");
+	checkPowerLimitSteps(history, hotStart, maxPowerLimit, true, "while limiting");
+
+	size_t coolStart = history.size();
+	hold(simulator, platform, PassiveSensor, IdleCelsius, PassiveHoldSeconds);
+	history = platform.getPowerLimitHistory(Processor);
+	check(
+		platform.getPowerLimit(Processor) == maxPowerLimit,
+		"PL1 is restored to " + maxPowerLimit.toString() + " after cooling");
+	checkPowerLimitSteps(history, coolStart, minPowerLimit, false, "while restoring");
+}
+
+static void checkFanLevel(SimulatedPlatform& platform, UInt32 expectedLevel, const string& condition)
+{
+	auto level = platform.getFanLevel(Fan);
+	check(
+		level == Percentage::fromWholeNumber(expectedLevel),
+		"fan runs at " + to_string(expectedLevel) + "% " + condition + ", not " + level.toString());
+}
+
+static void runActiveScenario(Simulator& simulator, SimulatedPlatform& platform)
+{
+	hold(simulator, platform, ActiveSensor, IdleCelsius, 60);
+	checkFanLevel(platform, 0, "below AC1");
+
+	hold(simulator, platform, ActiveSensor, 65.0, 60);
+	checkFanLevel(platform, Ac1FanSpeed, "between AC1 and AC0");
+
+	hold(simulator, platform, ActiveSensor, 75.0, 60);
+	checkFanLevel(platform, Ac0FanSpeed, "above AC0");
+
+	hold(simulator, platform, ActiveSensor, 65.0, 60);
+	checkFanLevel(platform, Ac1FanSpeed, "after falling below AC0");
+
+	hold(simulator, platform, ActiveSensor, IdleCelsius, 60);
+	checkFanLevel(platform, 0, "after falling below AC1");
+}
+
+static void runSoak(Simulator& simulator, SimulatedPlatform& platform, UInt64 cycles)
+{
+	for (UInt64 cycle = 0; cycle < cycles; cycle++)
+	{
+		hold(simulator, platform, CriticalSensor, IdleCelsius, SoakCycleSeconds - SoakHotHoldSeconds);
+		hold(simulator, platform, CriticalSensor, 105.0, SoakHotHoldSeconds);
+	}
+	hold(simulator, platform, CriticalSensor, IdleCelsius, 10 * WatchdogSeconds);
+}
+
+static void createPlatform(SimulatedPlatform& platform)
+{
+	vector<Guid> policies;
+	policies.push_back(CriticalPolicyGuid);
+	policies.push_back(PassivePolicyGuid);
+	policies.push_back(ActivePolicyGuid);
+	platform.setSupportedPolicies(policies);
+
+	platform.addSensor(CriticalSensor);
+	platform.setSensorTripPoint(CriticalSensor, GET_TRIP_POINT_HOT, Temperature::fromCelsius(HotTripPointCelsius));
+	platform.setSensorTripPoint(
+		CriticalSensor, GET_TRIP_POINT_CRITICAL, Temperature::fromCelsius(CriticalTripPointCelsius));
+	platform.setSensorTemperature(CriticalSensor, Temperature::fromCelsius(IdleCelsius));
+
+	platform.addSensor(PassiveSensor);
+	platform.setSensorTripPoint(
+		PassiveSensor, GET_TRIP_POINT_PASSIVE, Temperature::fromCelsius(PassiveTripPointCelsius));
+	platform.setSensorTemperature(PassiveSensor, Temperature::fromCelsius(IdleCelsius));
+
+	platform.addSensor(ActiveSensor);
+	platform.setSensorTripPoint(ActiveSensor, GET_TRIP_POINT_ACTIVE, Temperature::fromCelsius(Ac0TripPointCelsius), 0);
+	platform.setSensorTripPoint(ActiveSensor, GET_TRIP_POINT_ACTIVE, Temperature::fromCelsius(Ac1TripPointCelsius), 1);
+	platform.setSensorTemperature(ActiveSensor, Temperature::fromCelsius(IdleCelsius));
+
+	platform.addPowerControl(
+		Processor,
+		Power::createFromWatts(MinPowerLimitWatts),
+		Power::createFromWatts(MaxPowerLimitWatts),
+		Power::createFromWatts(PowerStepWatts));
+	platform.addFan(Fan);
+
+	ThermalRelationship thermalRelationship = {Simulator::getAcpiScope("TCPU"),
+											   Simulator::getAcpiScope("SEN2"),
+											   10,
+											   TimeSpan::createFromSeconds(SamplingPeriodSeconds)};
+	platform.setThermalRelationshipTable(vector<ThermalRelationship>(1, thermalRelationship));
+
+	ActiveRelationship activeRelationship = {
+		Simulator::getAcpiScope("TFN1"), Simulator::getAcpiScope("SEN3"), 100, vector<UInt32>()};
+	activeRelationship.fanSpeeds.push_back(Ac0FanSpeed);
+	activeRelationship.fanSpeeds.push_back(Ac1FanSpeed);
+	platform.setActiveRelationshipTable(vector<ActiveRelationship>(1, activeRelationship));
+}
+
+int main(int argc, char* argv[])
+{
+	UInt64 soakHours = DefaultSoakHours;
+	Bool verbose = false;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-v") == 0)
+		{
+			verbose = true;
+		}
+		else
+		{
+			soakHours = strtoull(argv[i], nullptr, 10);
+		}
+	}
+	UInt64 soakCycles = soakHours * 3600 / SoakCycleSeconds;
+
+	auto platform = make_shared<SimulatedPlatform>();
+	createPlatform(*platform);
+
+	Simulator simulator(platform);
+	TimeSpan simulatedTime = TimeSpan::createFromSeconds(0);
+	UInt64 eventCount = 0;
+	UInt64 timerCount = 0;
+	UInt64 powerLimitCount = 0;
+	UInt64 fanLevelCount = 0;
+	auto start = chrono::steady_clock::now();
+	try
+	{
+		simulator.start();
+		if ((simulator.isPolicyLoaded(CriticalPolicyGuid) == false)
+			|| (simulator.isPolicyLoaded(PassivePolicyGuid) == false)
+			|| (simulator.isPolicyLoaded(ActivePolicyGuid) == false))
+		{
+			printf("FAILED: the policies were not loaded from the directory of the simulator\n");
+			return EXIT_FAILURE;
+		}
+		simulator.createPowerParticipant(Processor, "TCPU");
+		simulator.createFanParticipant(Fan, "TFN1");
+		simulator.createSensorParticipant(CriticalSensor, "SEN1");
+		simulator.createSensorParticipant(PassiveSensor, "SEN2");
+		simulator.createSensorParticipant(ActiveSensor, "SEN3");
+
+		runCriticalScenario(simulator, *platform);
+		runPassiveScenario(simulator, *platform);
+		runActiveScenario(simulator, *platform);
+		runSoak(simulator, *platform, soakCycles);
+
+		simulatedTime = simulator.getElapsedTime();
+		eventCount = simulator.getEventCount();
+		timerCount = simulator.getFiredTimerCount();
+		powerLimitCount = platform->getPowerLimitHistory(Processor).size();
+		fanLevelCount = platform->getFanLevelHistory(Fan).size();
+
+		// Power requests are made on their own threads, which are joined when DPTF is destroyed
+		simulator.stop();
+	}
+	catch (const exception& ex)
+	{
+		printf("FAILED: %s\n", ex.what());
+		return EXIT_FAILURE;
+	}
+	chrono::duration<double> wallTime = chrono::steady_clock::now() - start;
+
+	auto requests = platform->getPowerRequests();
+	checkPowerRequests(requests, soakCycles);
+
+	double simulatedHours = simulatedTime.asSeconds() / 3600.0;
+	UInt64 callbackCount = eventCount + timerCount;
+	printf("Simulated time            %14.1f h\n", simulatedHours);
+	printf("Wall time                 %14.3f s\n", wallTime.count());
+	printf("Simulated hours/minute    %14.0f\n", simulatedHours * 60.0 / wallTime.count());
+	printf("Temperature events        %14llu\n", (unsigned long long)eventCount);
+	printf("Timers fired              %14llu\n", (unsigned long long)timerCount);
+	printf("Primitives executed       %14llu\n", (unsigned long long)platform->getPrimitiveCount());
+	printf("Aux threshold updates     %14llu\n", (unsigned long long)platform->getTemperatureThresholdSetCount());
+	printf("Power requests            %14llu\n", (unsigned long long)requests.size());
+	printf("PL1 limits set            %14llu\n", (unsigned long long)powerLimitCount);
+	printf("Fan levels set            %14llu\n", (unsigned long long)fanLevelCount);
+	printf(
+		"us per event or timer     %14.1f\n",
+		(callbackCount > 0) ? (wallTime.count() * 1e6 / (double)callbackCount) : 0.0);
+
+	if (verbose)
+	{
+		auto unsupportedPrimitives = platform->getUnsupportedPrimitives();
+		for (auto primitive = unsupportedPrimitives.begin(); primitive != unsupportedPrimitives.end(); ++primitive)
+		{
+			printf("Unsupported primitive     %14u\n", (unsigned int)*primitive);
+		}
+	}
+
+	if (g_failureCount > 0)
+	{
+		printf("%u checks FAILED\n", g_failureCount);
+		return EXIT_FAILURE;
+	}
+	printf("PASSED\n");
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,786 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "SimulatedPlatform.h"
+#include "EsifMutexHelper.h"
+#include "esif_sdk_data_misc.h"
+#include "esif_sdk_fan.h"
+#include "esif_ccb_memory.h"
+#include "ActiveControlStatus.h"
+
+using namespace std;
+
+static const UIntN GuidSize = 16;
+
+// Revision of the ART and of the fan information the platform serves
+static const UInt64 ArtRevision = 1;
+static const UInt64 FifRevision = 0;
+
+// Shortest interval the policies may sample a participant at
+static const UInt32 MinimumSamplePeriodMilliseconds = 1000;
+
+// The fan reaches a requested level at once, turning at this speed for each percent
+static const UInt32 FanRpmPerPercent = 50;
+
+#pragma pack(push, 1)
+typedef struct _AcpiEsifGuid
+{
+	union esif_data_variant esifDataVariant;
+	UInt8 uuid[GuidSize];
+} AcpiEsifGuid;
+#pragma pack(pop)
+
+namespace PlatformPowerAction
+{
+	std::string ToString(PlatformPowerAction::Type type)
+	{
+		switch (type)
+		{
+		case Sleep:
+			return "Sleep";
+		case Hibernate:
+			return "Hibernate";
+		case Shutdown:
+			return "Shutdown";
+		default:
+			throw dptf_exception("PlatformPowerAction::Type is invalid.");
+		}
+	}
+}
+
+//
+// ESIF service interface
+//
+
+extern "C"
+{
+	static eEsifError SimulatedGetConfig(
+		const esif_handle_t esifHandle,
+		const EsifDataPtr nameSpace,
+		const EsifDataPtr elementPath,
+		EsifDataPtr elementValue)
+	{
+		return ESIF_E_NOT_FOUND;
+	}
+
+	static eEsifError SimulatedSetConfig(
+		const esif_handle_t esifHandle,
+		const EsifDataPtr nameSpace,
+		const EsifDataPtr elementPath,
+		const EsifDataPtr elementValue,
+		const EsifFlags elementFlags)
+	{
+		return ESIF_OK;
+	}
+
+	static eEsifError SimulatedPrimitive(
+		const esif_handle_t esifHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const ePrimitiveType primitive,
+		const UInt8 instance)
+	{
+		SimulatedPlatform* platform = reinterpret_cast<SimulatedPlatform*>(esifHandle);
+		return platform->executePrimitive(participantHandle, domainHandle, request, response, primitive, instance);
+	}
+
+	static eEsifError SimulatedWriteLog(
+		const esif_handle_t esifHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr message,
+		const eLogType logType)
+	{
+		return ESIF_OK;
+	}
+
+	static eEsifError SimulatedRegisterEvent(
+		const esif_handle_t esifHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr eventGuid)
+	{
+		return ESIF_OK;
+	}
+
+	static eEsifError SimulatedUnregisterEvent(
+		const esif_handle_t esifHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr eventGuid)
+	{
+		return ESIF_OK;
+	}
+
+	static eEsifError SimulatedSendEvent(
+		const esif_handle_t esifHandle,
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr eventData,
+		const EsifDataPtr eventGuid)
+	{
+		return ESIF_OK;
+	}
+
+	static eEsifError SimulatedSendCommand(
+		const esif_handle_t esifHandle,
+		const UInt32 argc,
+		const EsifDataArray argv,
+		EsifDataPtr response)
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+}
+
+SimulatedPlatform::SimulatedPlatform(void)
+	: m_mutex()
+	, m_supportedPolicies()
+	, m_thermalRelationshipTable()
+	, m_activeRelationshipTable()
+	, m_sensors()
+	, m_powerControls()
+	, m_fans()
+	, m_powerRequests()
+	, m_unsupportedPrimitives()
+	, m_primitiveCount(0)
+	, m_temperatureThresholdSetCount(0)
+{
+}
+
+SimulatedPlatform::~SimulatedPlatform(void)
+{
+}
+
+esif_handle_t SimulatedPlatform::getEsifHandle(void)
+{
+	return reinterpret_cast<esif_handle_t>(this);
+}
+
+void SimulatedPlatform::fillEsifInterface(EsifInterface& esifInterface)
+{
+	// The bound primitive functions are left null, as they are in a Version 4 interface set
+	esif_ccb_memset(&esifInterface, 0, sizeof(esifInterface));
+	esifInterface.fGetConfigFuncPtr = SimulatedGetConfig;
+	esifInterface.fSetConfigFuncPtr = SimulatedSetConfig;
+	esifInterface.fPrimitiveFuncPtr = SimulatedPrimitive;
+	esifInterface.fWriteLogFuncPtr = SimulatedWriteLog;
+	esifInterface.fRegisterEventFuncPtr = SimulatedRegisterEvent;
+	esifInterface.fUnregisterEventFuncPtr = SimulatedUnregisterEvent;
+	esifInterface.fSendEventFuncPtr = SimulatedSendEvent;
+	esifInterface.fSendCommandFuncPtr = SimulatedSendCommand;
+}
+
+void SimulatedPlatform::setSupportedPolicies(const std::vector<Guid>& policyGuids)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_supportedPolicies = policyGuids;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::setThermalRelationshipTable(const std::vector<ThermalRelationship>& relationships)
+{
+	// Each row is the source and target strings followed by the influence, the sampling period in tenths of a
+	// second and four reserved fields
+	DptfBuffer table;
+	for (auto row = relationships.begin(); row != relationships.end(); ++row)
+	{
+		appendString(table, row->source);
+		appendString(table, row->target);
+		appendInteger(table, row->influence);
+		appendInteger(table, (UInt64)row->samplingPeriod.asTenthSecondsInt());
+		for (UIntN reserved = 0; reserved < 4; reserved++)
+		{
+			appendInteger(table, 0);
+		}
+	}
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_thermalRelationshipTable = table;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::setActiveRelationshipTable(const std::vector<ActiveRelationship>& relationships)
+{
+	// A revision is followed by rows of the source and target strings, the weight and the fan speeds for AC0 to AC9
+	DptfBuffer table;
+	appendInteger(table, ArtRevision);
+	for (auto row = relationships.begin(); row != relationships.end(); ++row)
+	{
+		appendString(table, row->source);
+		appendString(table, row->target);
+		appendInteger(table, row->weight);
+		for (UIntN ac = 0; ac < 10; ac++)
+		{
+			appendInteger(table, (ac < row->fanSpeeds.size()) ? row->fanSpeeds[ac] : Constants::Invalid);
+		}
+	}
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_activeRelationshipTable = table;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::addSensor(esif_handle_t participantHandle)
+{
+	Sensor sensor;
+	sensor.temperature = Temperature::fromCelsius(25);
+	sensor.aux0 = Temperature::createInvalid();
+	sensor.aux1 = Temperature::createInvalid();
+	sensor.thresholdCrossedReported = false;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_sensors[participantHandle] = sensor;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::addPowerControl(
+	esif_handle_t participantHandle,
+	const Power& minPowerLimit,
+	const Power& maxPowerLimit,
+	const Power& stepSize)
+{
+	// PL1 ranges over the given limits with a one second to one minute time window.  PL2 is fixed at the maximum.
+	vector<PowerControlDynamicCaps> capabilities;
+	capabilities.push_back(PowerControlDynamicCaps(
+		PowerControlType::PL1,
+		minPowerLimit,
+		maxPowerLimit,
+		stepSize,
+		TimeSpan::createFromSeconds(1),
+		TimeSpan::createFromSeconds(60),
+		Percentage(0.0),
+		Percentage(0.0)));
+	capabilities.push_back(PowerControlDynamicCaps(
+		PowerControlType::PL2,
+		maxPowerLimit,
+		maxPowerLimit,
+		stepSize,
+		TimeSpan::createFromMilliseconds(0),
+		TimeSpan::createFromMilliseconds(0),
+		Percentage(0.0),
+		Percentage(0.0)));
+
+	PowerControl powerControl;
+	powerControl.capabilities = PowerControlDynamicCapsSet(capabilities);
+	powerControl.powerLimits[PowerControlType::PL1] = maxPowerLimit;
+	powerControl.powerLimits[PowerControlType::PL2] = maxPowerLimit;
+	powerControl.timeWindows[PowerControlType::PL1] = (UInt32)TimeSpan::createFromSeconds(60).asMillisecondsUInt();
+	powerControl.enables[PowerControlType::PL1] = 1;
+	powerControl.enables[PowerControlType::PL2] = 1;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_powerControls[participantHandle] = powerControl;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::addFan(esif_handle_t participantHandle)
+{
+	Fan fan;
+	fan.level = 0;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_fans[participantHandle] = fan;
+	esifMutexHelper.unlock();
+}
+
+void SimulatedPlatform::setSensorTemperature(esif_handle_t participantHandle, const Temperature& temperature)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	getSensor(participantHandle).temperature = temperature;
+	esifMutexHelper.unlock();
+}
+
+Temperature SimulatedPlatform::getSensorTemperature(esif_handle_t participantHandle) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	Temperature temperature = getSensor(participantHandle).temperature;
+	esifMutexHelper.unlock();
+	return temperature;
+}
+
+void SimulatedPlatform::setSensorTripPoint(
+	esif_handle_t participantHandle,
+	esif_primitive_type primitive,
+	const Temperature& temperature,
+	UInt8 instance)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	getSensor(participantHandle).tripPoints[make_pair(primitive, instance)] = temperature;
+	esifMutexHelper.unlock();
+}
+
+Bool SimulatedPlatform::checkTemperatureThresholdCrossed(esif_handle_t participantHandle)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	auto& sensor = getSensor(participantHandle);
+	Bool crossed = false;
+	if (sensor.thresholdCrossedReported == false)
+	{
+		Bool aboveAux1 = sensor.aux1.isValid() && (sensor.temperature >= sensor.aux1);
+		Bool belowAux0 = sensor.aux0.isValid() && (sensor.temperature < sensor.aux0);
+		crossed = aboveAux1 || belowAux0;
+		sensor.thresholdCrossedReported = crossed;
+	}
+
+	esifMutexHelper.unlock();
+	return crossed;
+}
+
+Power SimulatedPlatform::getPowerLimit(esif_handle_t participantHandle) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	Power powerLimit(getPowerControl(participantHandle).powerLimits.at(PowerControlType::PL1));
+	esifMutexHelper.unlock();
+	return powerLimit;
+}
+
+std::vector<Power> SimulatedPlatform::getPowerLimitHistory(esif_handle_t participantHandle) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	auto history = getPowerControl(participantHandle).pl1History;
+	esifMutexHelper.unlock();
+	return history;
+}
+
+Percentage SimulatedPlatform::getFanLevel(esif_handle_t participantHandle) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	auto level = Percentage::fromWholeNumber(getFan(participantHandle).level);
+	esifMutexHelper.unlock();
+	return level;
+}
+
+std::vector<Percentage> SimulatedPlatform::getFanLevelHistory(esif_handle_t participantHandle) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	auto history = getFan(participantHandle).levelHistory;
+	esifMutexHelper.unlock();
+	return history;
+}
+
+UInt64 SimulatedPlatform::getPrimitiveCount(void) const
+{
+	return m_primitiveCount.load();
+}
+
+UInt64 SimulatedPlatform::getTemperatureThresholdSetCount(void) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	UInt64 count = m_temperatureThresholdSetCount;
+	esifMutexHelper.unlock();
+	return count;
+}
+
+std::vector<PlatformPowerRequest> SimulatedPlatform::getPowerRequests(void) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	auto powerRequests = m_powerRequests;
+	esifMutexHelper.unlock();
+	return powerRequests;
+}
+
+std::set<esif_primitive_type> SimulatedPlatform::getUnsupportedPrimitives(void) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	auto unsupportedPrimitives = m_unsupportedPrimitives;
+	esifMutexHelper.unlock();
+	return unsupportedPrimitives;
+}
+
+eEsifError SimulatedPlatform::executePrimitive(
+	const esif_handle_t participantHandle,
+	const esif_handle_t domainHandle,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const esif_primitive_type primitive,
+	const UInt8 instance)
+{
+	m_primitiveCount++;
+
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	// Each participant has a single domain, so the domain handle is not looked at
+	eEsifError rc = ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	auto sensor = m_sensors.find(participantHandle);
+	auto powerControl = m_powerControls.find(participantHandle);
+	auto fan = m_fans.find(participantHandle);
+	switch (primitive)
+	{
+	case GET_SUPPORTED_POLICIES:
+		rc = getSupportedPolicies(response);
+		break;
+	case GET_MINIMUM_SAMPLE_PERIOD:
+		rc = fillResponse(response, &MinimumSamplePeriodMilliseconds, sizeof(MinimumSamplePeriodMilliseconds));
+		break;
+	case GET_THERMAL_RELATIONSHIP_TABLE:
+		rc = fillResponse(response, m_thermalRelationshipTable);
+		break;
+	case GET_ACTIVE_RELATIONSHIP_TABLE:
+		rc = fillResponse(response, m_activeRelationshipTable);
+		break;
+	case SET_SYSTEM_SLEEP:
+		rc = recordPowerRequest(PlatformPowerAction::Sleep, request);
+		break;
+	case SET_SYSTEM_HIBERNATE:
+		rc = recordPowerRequest(PlatformPowerAction::Hibernate, request);
+		break;
+	case SET_SYSTEM_SHUTDOWN:
+		rc = recordPowerRequest(PlatformPowerAction::Shutdown, request);
+		break;
+	default:
+		if (sensor != m_sensors.end())
+		{
+			rc = executeSensorPrimitive(sensor->second, request, response, primitive, instance);
+		}
+		else if (powerControl != m_powerControls.end())
+		{
+			rc = executePowerControlPrimitive(powerControl->second, request, response, primitive, instance);
+		}
+		else if (fan != m_fans.end())
+		{
+			rc = executeFanPrimitive(fan->second, request, response, primitive);
+		}
+		break;
+	}
+
+	if (rc == ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP)
+	{
+		m_unsupportedPrimitives.insert(primitive);
+	}
+
+	esifMutexHelper.unlock();
+	return rc;
+}
+
+eEsifError SimulatedPlatform::executeSensorPrimitive(
+	Sensor& sensor,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const esif_primitive_type primitive,
+	const UInt8 instance)
+{
+	switch (primitive)
+	{
+	case GET_TEMPERATURE:
+		return getTemperature(sensor.temperature, response);
+	case GET_TRIP_POINT_WARM:
+	case GET_TRIP_POINT_HOT:
+	case GET_TRIP_POINT_CRITICAL:
+	case GET_TRIP_POINT_PASSIVE:
+	case GET_TRIP_POINT_ACTIVE:
+	{
+		auto tripPoint = sensor.tripPoints.find(make_pair(primitive, instance));
+		if (tripPoint != sensor.tripPoints.end())
+		{
+			return getTemperature(tripPoint->second, response);
+		}
+
+		// ESIF reports the active trip points a participant leaves out as not present
+		return (primitive == GET_TRIP_POINT_ACTIVE) ? ESIF_I_ACPI_TRIP_POINT_NOT_PRESENT
+													: ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+	case GET_TEMPERATURE_THRESHOLDS:
+		if (instance <= 1)
+		{
+			return getTemperature((instance == 0) ? sensor.aux0 : sensor.aux1, response);
+		}
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	case SET_TEMPERATURE_THRESHOLDS:
+		return setTemperatureThreshold(sensor, request, instance);
+	default:
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+}
+
+eEsifError SimulatedPlatform::executePowerControlPrimitive(
+	PowerControl& powerControl,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const esif_primitive_type primitive,
+	const UInt8 instance)
+{
+	switch (primitive)
+	{
+	case GET_RAPL_POWER_CONTROL_CAPABILITIES:
+		return fillResponse(response, powerControl.capabilities.toPpccBinary());
+	case GET_RAPL_POWER_LIMIT:
+		return getValue(powerControl.powerLimits, instance, response);
+	case SET_RAPL_POWER_LIMIT:
+	{
+		eEsifError rc = setValue(powerControl.powerLimits, instance, request);
+		if ((rc == ESIF_OK) && (instance == PowerControlType::PL1))
+		{
+			powerControl.pl1History.push_back(Power(powerControl.powerLimits[instance]));
+		}
+		return rc;
+	}
+	case GET_RAPL_POWER_LIMIT_TIME_WINDOW:
+		return getValue(powerControl.timeWindows, instance, response);
+	case SET_RAPL_POWER_LIMIT_TIME_WINDOW:
+		return setValue(powerControl.timeWindows, instance, request);
+	case GET_RAPL_POWER_LIMIT_ENABLE:
+		return getValue(powerControl.enables, instance, response);
+	case SET_RAPL_POWER_LIMIT_ENABLE:
+		return setValue(powerControl.enables, instance, request);
+	default:
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+}
+
+eEsifError SimulatedPlatform::executeFanPrimitive(
+	Fan& fan,
+	const EsifDataPtr request,
+	EsifDataPtr response,
+	const esif_primitive_type primitive)
+{
+	switch (primitive)
+	{
+	case GET_FAN_INFORMATION:
+	{
+		EsifDataBinaryFifPackage fif;
+		esif_ccb_memset(&fif, 0, sizeof(fif));
+		fif.revision.integer.type = ESIF_DATA_UINT64;
+		fif.revision.integer.value = FifRevision;
+		fif.hasFineGrainControl.integer.type = ESIF_DATA_UINT64;
+		fif.hasFineGrainControl.integer.value = 1;
+		fif.stepSize.integer.type = ESIF_DATA_UINT64;
+		fif.stepSize.integer.value = 1;
+		fif.supportsLowSpeedNotification.integer.type = ESIF_DATA_UINT64;
+		fif.supportsLowSpeedNotification.integer.value = 0;
+		return fillResponse(response, &fif, sizeof(fif));
+	}
+	case GET_FAN_STATUS:
+		return fillResponse(response, ActiveControlStatus(fan.level, fan.level * FanRpmPerPercent).toFstBinary());
+	case SET_FAN_LEVEL:
+		// The level is a whole number percentage
+		if ((request == nullptr) || (request->buf_ptr == nullptr) || (request->data_len < sizeof(UInt32)))
+		{
+			return ESIF_E_PARAMETER_IS_NULL;
+		}
+		fan.level = *static_cast<UInt32*>(request->buf_ptr);
+		fan.levelHistory.push_back(Percentage::fromWholeNumber(fan.level));
+		return ESIF_OK;
+	default:
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+}
+
+eEsifError SimulatedPlatform::getSupportedPolicies(EsifDataPtr response)
+{
+	vector<AcpiEsifGuid> acpiEsifGuids(m_supportedPolicies.size());
+	for (size_t i = 0; i < m_supportedPolicies.size(); i++)
+	{
+		esif_ccb_memset(&acpiEsifGuids[i], 0, sizeof(AcpiEsifGuid));
+		acpiEsifGuids[i].esifDataVariant.type = ESIF_DATA_BINARY;
+		m_supportedPolicies[i].copyToBuffer(acpiEsifGuids[i].uuid);
+	}
+	return fillResponse(response, acpiEsifGuids.data(), (UInt32)(acpiEsifGuids.size() * sizeof(AcpiEsifGuid)));
+}
+
+eEsifError SimulatedPlatform::getTemperature(const Temperature& temperature, EsifDataPtr response)
+{
+	if (temperature.isValid() == false)
+	{
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+
+	UInt32 temperatureTenthK = temperature;
+	return fillResponse(response, &temperatureTenthK, sizeof(temperatureTenthK));
+}
+
+eEsifError SimulatedPlatform::setTemperatureThreshold(Sensor& sensor, const EsifDataPtr request, UInt8 instance)
+{
+	if ((request == nullptr) || (request->buf_ptr == nullptr) || (request->data_len < sizeof(UInt32))
+		|| (instance > 1))
+	{
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	// Thresholds outside of the valid temperature range disable the aux
+	UInt32 temperatureTenthK = *static_cast<UInt32*>(request->buf_ptr);
+	Temperature threshold = Temperature::createInvalid();
+	if ((temperatureTenthK >= Temperature::minValidTemperature)
+		&& (temperatureTenthK <= Temperature::maxValidTemperature))
+	{
+		threshold = Temperature(temperatureTenthK);
+	}
+
+	if (instance == 0)
+	{
+		sensor.aux0 = threshold;
+	}
+	else
+	{
+		sensor.aux1 = threshold;
+	}
+	sensor.thresholdCrossedReported = false;
+	m_temperatureThresholdSetCount++;
+	return ESIF_OK;
+}
+
+eEsifError SimulatedPlatform::getValue(const std::map<UInt8, UInt32>& values, UInt8 instance, EsifDataPtr response)
+{
+	// Control types the domain does not have are reported as unsupported rather than missing from the DSP
+	auto value = values.find(instance);
+	if (value == values.end())
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+	return fillResponse(response, &value->second, sizeof(value->second));
+}
+
+eEsifError SimulatedPlatform::setValue(std::map<UInt8, UInt32>& values, UInt8 instance, const EsifDataPtr request)
+{
+	if ((request == nullptr) || (request->buf_ptr == nullptr) || (request->data_len < sizeof(UInt32)))
+	{
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	auto value = values.find(instance);
+	if (value == values.end())
+	{
+		return ESIF_E_NOT_SUPPORTED;
+	}
+	value->second = *static_cast<UInt32*>(request->buf_ptr);
+	return ESIF_OK;
+}
+
+eEsifError SimulatedPlatform::recordPowerRequest(PlatformPowerAction::Type action, const EsifDataPtr request)
+{
+	PlatformPowerRequest powerRequest = {action, Temperature::createInvalid(), Temperature::createInvalid()};
+	if ((request != nullptr) && (request->buf_ptr != nullptr)
+		&& (request->data_len >= sizeof(esif_data_complex_thermal_event)))
+	{
+		auto thermalEvent = static_cast<esif_data_complex_thermal_event*>(request->buf_ptr);
+		powerRequest.temperature = Temperature(thermalEvent->temperature);
+		powerRequest.tripPointTemperature = Temperature(thermalEvent->tripPointTemperature);
+	}
+	m_powerRequests.push_back(powerRequest);
+	return ESIF_OK;
+}
+
+eEsifError SimulatedPlatform::fillResponse(EsifDataPtr response, const void* data, UInt32 dataLength)
+{
+	if (response == nullptr)
+	{
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	response->data_len = dataLength;
+	if ((response->buf_ptr == nullptr) || (response->buf_len < dataLength))
+	{
+		return ESIF_E_NEED_LARGER_BUFFER;
+	}
+
+	if (dataLength > 0)
+	{
+		esif_ccb_memcpy(response->buf_ptr, data, dataLength);
+	}
+	return ESIF_OK;
+}
+
+eEsifError SimulatedPlatform::fillResponse(EsifDataPtr response, const DptfBuffer& buffer)
+{
+	if (buffer.size() == 0)
+	{
+		return ESIF_E_PRIMITIVE_NOT_FOUND_IN_DSP;
+	}
+	return fillResponse(response, buffer.get(), buffer.size());
+}
+
+SimulatedPlatform::Sensor& SimulatedPlatform::getSensor(esif_handle_t participantHandle)
+{
+	auto sensor = m_sensors.find(participantHandle);
+	if (sensor == m_sensors.end())
+	{
+		throw dptf_exception("The simulated platform has no sensor " + to_string(participantHandle) + ".");
+	}
+	return sensor->second;
+}
+
+const SimulatedPlatform::Sensor& SimulatedPlatform::getSensor(esif_handle_t participantHandle) const
+{
+	auto sensor = m_sensors.find(participantHandle);
+	if (sensor == m_sensors.end())
+	{
+		throw dptf_exception("The simulated platform has no sensor " + to_string(participantHandle) + ".");
+	}
+	return sensor->second;
+}
+
+const SimulatedPlatform::PowerControl& SimulatedPlatform::getPowerControl(esif_handle_t participantHandle) const
+{
+	auto powerControl = m_powerControls.find(participantHandle);
+	if (powerControl == m_powerControls.end())
+	{
+		throw dptf_exception(
+			"The simulated platform has no power control " + to_string(participantHandle) + ".");
+	}
+	return powerControl->second;
+}
+
+const SimulatedPlatform::Fan& SimulatedPlatform::getFan(esif_handle_t participantHandle) const
+{
+	auto fan = m_fans.find(participantHandle);
+	if (fan == m_fans.end())
+	{
+		throw dptf_exception("The simulated platform has no fan " + to_string(participantHandle) + ".");
+	}
+	return fan->second;
+}
+
+void SimulatedPlatform::appendInteger(DptfBuffer& buffer, UInt64 value)
+{
+	union esif_data_variant variant;
+	esif_ccb_memset(&variant, 0, sizeof(variant));
+	variant.integer.type = ESIF_DATA_UINT64;
+	variant.integer.value = value;
+	buffer.append(reinterpret_cast<UInt8*>(&variant), sizeof(variant));
+}
+
+void SimulatedPlatform::appendString(DptfBuffer& buffer, const std::string& value)
+{
+	// The string follows its variant, and its length includes the null terminator
+	union esif_data_variant variant;
+	esif_ccb_memset(&variant, 0, sizeof(variant));
+	variant.string.type = ESIF_DATA_STRING;
+	variant.string.length = (u32)(value.size() + 1);
+	buffer.append(reinterpret_cast<UInt8*>(&variant), sizeof(variant));
+	buffer.append(reinterpret_cast<UInt8*>(const_cast<char*>(value.c_str())), variant.string.length);
+}
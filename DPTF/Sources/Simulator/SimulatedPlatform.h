@@ -0,0 +1,211 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "EsifMutex.h"
+#include "PowerControlDynamicCapsSet.h"
+#include "esif_sdk_iface_esif.h"
+#include "esif_sdk_primitive_type.h"
+#include <atomic>
+#include <map>
+#include <set>
+
+namespace PlatformPowerAction
+{
+	enum Type
+	{
+		Sleep,
+		Hibernate,
+		Shutdown
+	};
+
+	std::string ToString(PlatformPowerAction::Type type);
+}
+
+struct PlatformPowerRequest
+{
+	PlatformPowerAction::Type action;
+	Temperature temperature;
+	Temperature tripPointTemperature;
+};
+
+// A row of the TRT.  Devices are named by their ACPI scope.
+struct ThermalRelationship
+{
+	std::string source;
+	std::string target;
+	UInt32 influence;
+	TimeSpan samplingPeriod;
+};
+
+// A row of the ART.  fanSpeeds holds the fan speed in whole percent for AC0 onwards; Constants::Invalid or a missing
+// entry leaves that trip point out.
+struct ActiveRelationship
+{
+	std::string source;
+	std::string target;
+	UInt32 weight;
+	std::vector<UInt32> fanSpeeds;
+};
+
+//
+// Stands in for ESIF.  The platform has temperature sensors, processors with a PL1/PL2 power control and fans with
+// fine grained speed control, each a participant with a single domain added by the simulator.  Sensor temperatures
+// and trip points are scripted by the simulator.  The platform answers the primitives DPTF executes against these
+// participants and serves the TRT and ART.  It records the aux temperature thresholds, power limits, fan levels and
+// platform power requests it receives, and reports the rest as missing from the DSP.
+//
+// Primitives arrive on the work item thread, the policy executor threads and the platform power state threads.
+//
+class SimulatedPlatform
+{
+public:
+	SimulatedPlatform(void);
+	~SimulatedPlatform(void);
+
+	// Points every function of the ESIF service interface at this platform
+	esif_handle_t getEsifHandle(void);
+	void fillEsifInterface(EsifInterface& esifInterface);
+
+	// The policies read these tables when they are created
+	void setSupportedPolicies(const std::vector<Guid>& policyGuids);
+	void setThermalRelationshipTable(const std::vector<ThermalRelationship>& relationships);
+	void setActiveRelationshipTable(const std::vector<ActiveRelationship>& relationships);
+
+	// Participants are known to the platform before the simulator creates them in DPTF
+	void addSensor(esif_handle_t participantHandle);
+	void addPowerControl(
+		esif_handle_t participantHandle,
+		const Power& minPowerLimit,
+		const Power& maxPowerLimit,
+		const Power& stepSize);
+	void addFan(esif_handle_t participantHandle);
+
+	void setSensorTemperature(esif_handle_t participantHandle, const Temperature& temperature);
+	Temperature getSensorTemperature(esif_handle_t participantHandle) const;
+
+	// Trip points are read with GET_TRIP_POINT_* and the instance, which is the AC number for active trip points
+	void setSensorTripPoint(
+		esif_handle_t participantHandle,
+		esif_primitive_type primitive,
+		const Temperature& temperature,
+		UInt8 instance = Constants::Esif::NoInstance);
+
+	// Returns true once each time the sensor temperature leaves the window set by the aux thresholds, which is
+	// when ESIF sends a temperature threshold crossed event.  The sensor reports no hysteresis.
+	Bool checkTemperatureThresholdCrossed(esif_handle_t participantHandle);
+
+	// The PL1 limit in effect and every PL1 limit set, in order
+	Power getPowerLimit(esif_handle_t participantHandle) const;
+	std::vector<Power> getPowerLimitHistory(esif_handle_t participantHandle) const;
+
+	// The fan level in effect and every fan level set, in order
+	Percentage getFanLevel(esif_handle_t participantHandle) const;
+	std::vector<Percentage> getFanLevelHistory(esif_handle_t participantHandle) const;
+
+	UInt64 getPrimitiveCount(void) const;
+	UInt64 getTemperatureThresholdSetCount(void) const;
+	std::vector<PlatformPowerRequest> getPowerRequests(void) const;
+	std::set<esif_primitive_type> getUnsupportedPrimitives(void) const;
+
+	eEsifError executePrimitive(
+		const esif_handle_t participantHandle,
+		const esif_handle_t domainHandle,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const esif_primitive_type primitive,
+		const UInt8 instance);
+
+private:
+	// hide the copy constructor and assignment operator.
+	SimulatedPlatform(const SimulatedPlatform& rhs);
+	SimulatedPlatform& operator=(const SimulatedPlatform& rhs);
+
+	struct Sensor
+	{
+		Temperature temperature;
+		std::map<std::pair<esif_primitive_type, UInt8>, Temperature> tripPoints;
+		Temperature aux0;
+		Temperature aux1;
+		Bool thresholdCrossedReported;
+	};
+
+	// Limits, time windows and enables are kept per control type, which is the primitive instance
+	struct PowerControl
+	{
+		PowerControlDynamicCapsSet capabilities;
+		std::map<UInt8, UInt32> powerLimits;
+		std::map<UInt8, UInt32> timeWindows;
+		std::map<UInt8, UInt32> enables;
+		std::vector<Power> pl1History;
+	};
+
+	struct Fan
+	{
+		UInt32 level;
+		std::vector<Percentage> levelHistory;
+	};
+
+	mutable EsifMutex m_mutex;
+	std::vector<Guid> m_supportedPolicies;
+	DptfBuffer m_thermalRelationshipTable;
+	DptfBuffer m_activeRelationshipTable;
+	std::map<esif_handle_t, Sensor> m_sensors;
+	std::map<esif_handle_t, PowerControl> m_powerControls;
+	std::map<esif_handle_t, Fan> m_fans;
+	std::vector<PlatformPowerRequest> m_powerRequests;
+	std::set<esif_primitive_type> m_unsupportedPrimitives;
+	std::atomic<UInt64> m_primitiveCount;
+	UInt64 m_temperatureThresholdSetCount;
+
+	eEsifError executeSensorPrimitive(
+		Sensor& sensor,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const esif_primitive_type primitive,
+		const UInt8 instance);
+	eEsifError executePowerControlPrimitive(
+		PowerControl& powerControl,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const esif_primitive_type primitive,
+		const UInt8 instance);
+	eEsifError executeFanPrimitive(
+		Fan& fan,
+		const EsifDataPtr request,
+		EsifDataPtr response,
+		const esif_primitive_type primitive);
+
+	eEsifError getSupportedPolicies(EsifDataPtr response);
+	eEsifError getTemperature(const Temperature& temperature, EsifDataPtr response);
+	eEsifError setTemperatureThreshold(Sensor& sensor, const EsifDataPtr request, UInt8 instance);
+	eEsifError getValue(const std::map<UInt8, UInt32>& values, UInt8 instance, EsifDataPtr response);
+	eEsifError setValue(std::map<UInt8, UInt32>& values, UInt8 instance, const EsifDataPtr request);
+	eEsifError recordPowerRequest(PlatformPowerAction::Type action, const EsifDataPtr request);
+	eEsifError fillResponse(EsifDataPtr response, const void* data, UInt32 dataLength);
+	eEsifError fillResponse(EsifDataPtr response, const DptfBuffer& buffer);
+	Sensor& getSensor(esif_handle_t participantHandle);
+	const Sensor& getSensor(esif_handle_t participantHandle) const;
+	const PowerControl& getPowerControl(esif_handle_t participantHandle) const;
+	const Fan& getFan(esif_handle_t participantHandle) const;
+
+	static void appendInteger(DptfBuffer& buffer, UInt64 value);
+	static void appendString(DptfBuffer& buffer, const std::string& value);
+};
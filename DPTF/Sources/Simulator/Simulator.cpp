@@ -0,0 +1,306 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "Simulator.h"
+#include "DptfManagerInterface.h"
+#include "WorkItemQueueManagerInterface.h"
+#include "WISimulatorSettle.h"
+#include "WISimulatorOverridePolicyTime.h"
+#include "PolicyManagerInterface.h"
+#include "Policy.h"
+#include "FrameworkLock.h"
+#include "FrameworkEvent.h"
+#include "EsifDataString.h"
+#include "EsifDataGuid.h"
+#include "EsifDataVoid.h"
+#include "EsifTime.h"
+#include "PolicyExecutor.h"
+#include "esif_ccb_memory.h"
+
+using namespace std;
+
+// A settle pass that causes no primitive calls ends the settling.  This bounds the passes if a policy keeps the
+// framework busy without ever becoming idle.
+static const UIntN MaxSettlePasses = 100;
+
+// A policy that sets aux thresholds the temperature has already crossed is sent the event again, up to this many
+// times for one change of the temperature
+static const UIntN MaxThresholdEventsPerUpdate = 10;
+
+Simulator::Simulator(std::shared_ptr<SimulatedPlatform> platform)
+	: m_platform(platform)
+	, m_clock()
+	, m_startTime(TimeSpan::createInvalid())
+	, m_interfaceSet()
+	, m_appHandle(ESIF_INVALID_HANDLE)
+	, m_dptfManager(nullptr)
+	, m_eventCount(0)
+	, m_sensorHandles()
+{
+	esif_ccb_memset(&m_interfaceSet, 0, sizeof(m_interfaceSet));
+}
+
+Simulator::~Simulator(void)
+{
+	try
+	{
+		stop();
+	}
+	catch (...)
+	{
+	}
+}
+
+void Simulator::start(void)
+{
+	if (m_dptfManager != nullptr)
+	{
+		throw dptf_exception("The simulator is already started.");
+	}
+
+	// Virtual time starts at the real time so that time stamps taken before the policies are moved onto the
+	// virtual clock stay in order
+	m_startTime = EsifTime().getTimeStamp();
+	m_clock = make_shared<VirtualClock>(m_startTime);
+	VirtualClock::install(m_clock);
+
+	// The simulated platform does not implement bound primitive execution, so it offers a Version 4 interface set
+	m_interfaceSet.hdr.fIfaceType = eIfaceTypeApplication;
+	m_interfaceSet.hdr.fIfaceVersion = APP_INTERFACE_VERSION_4;
+	m_interfaceSet.hdr.fIfaceSize = APP_INTERFACE_SET_SIZE(APP_INTERFACE_VERSION_4);
+	eEsifError rc = GetApplicationInterfaceV2(&m_interfaceSet);
+	if (rc != ESIF_OK)
+	{
+		throw dptf_exception("DPTF did not accept the application interface set.");
+	}
+	m_platform->fillEsifInterface(m_interfaceSet.esifIface);
+
+	EsifDataString homePath(".");
+	AppData appData;
+	appData.fPathHome = homePath;
+	appData.fLogLevel = eLogTypeFatal;
+	rc = m_interfaceSet.appIface.fAppCreateFuncPtr(
+		&m_interfaceSet, m_platform->getEsifHandle(), &m_appHandle, &appData, eAppStateEnabled);
+	m_dptfManager = reinterpret_cast<DptfManagerInterface*>(m_appHandle);
+	if ((rc != ESIF_OK) || (m_dptfManager == nullptr) || (m_dptfManager->isDptfManagerCreated() == false))
+	{
+		throw dptf_exception("Failed to create DPTF.");
+	}
+
+	m_dptfManager->getWorkItemQueueManager()->enqueueImmediateWorkItemAndWait(
+		make_shared<WISimulatorOverridePolicyTime>(m_dptfManager, m_clock));
+	settle();
+}
+
+void Simulator::stop(void)
+{
+	if (m_dptfManager != nullptr)
+	{
+		m_interfaceSet.appIface.fAppDestroyFuncPtr(m_appHandle);
+		m_dptfManager = nullptr;
+		m_appHandle = ESIF_INVALID_HANDLE;
+		VirtualClock::install(nullptr);
+	}
+}
+
+void Simulator::createSensorParticipant(esif_handle_t participantHandle, const std::string& name)
+{
+	vector<esif_capability_type> capabilities;
+	capabilities.push_back(ESIF_CAPABILITY_TYPE_TEMP_STATUS);
+	capabilities.push_back(ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD);
+	createParticipant(
+		participantHandle, name, "Simulated temperature sensor", ESIF_DOMAIN_TYPE_TEMPERATURE, capabilities);
+	m_sensorHandles.push_back(participantHandle);
+	deliverTemperatureThresholdEvents();
+}
+
+void Simulator::createPowerParticipant(esif_handle_t participantHandle, const std::string& name)
+{
+	vector<esif_capability_type> capabilities;
+	capabilities.push_back(ESIF_CAPABILITY_TYPE_POWER_CONTROL);
+	createParticipant(participantHandle, name, "Simulated processor", ESIF_DOMAIN_TYPE_PROCESSOR, capabilities);
+}
+
+void Simulator::createFanParticipant(esif_handle_t participantHandle, const std::string& name)
+{
+	vector<esif_capability_type> capabilities;
+	capabilities.push_back(ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL);
+	createParticipant(participantHandle, name, "Simulated fan", ESIF_DOMAIN_TYPE_FAN, capabilities);
+}
+
+std::string Simulator::getAcpiScope(const std::string& name)
+{
+	return "\\_SB_." + name;
+}
+
+void Simulator::advance(const TimeSpan& interval)
+{
+	throwIfNotStarted();
+
+	// Changes the simulator made to the platform take effect now, before any time passes
+	deliverTemperatureThresholdEvents();
+
+	auto endTime = m_clock->getCurrentTime() + interval;
+	while (m_clock->fireNextTimer(endTime))
+	{
+		settle();
+		deliverTemperatureThresholdEvents();
+	}
+	m_clock->setCurrentTime(endTime);
+}
+
+Bool Simulator::isPolicyLoaded(const Guid& policyGuid)
+{
+	throwIfNotStarted();
+
+	FrameworkLockHelper frameworkLockHelper(m_dptfManager->getWorkItemQueueManager()->getFrameworkLock());
+	frameworkLockHelper.lock();
+
+	auto policyManager = m_dptfManager->getPolicyManager();
+	auto policyIndexes = policyManager->getPolicyIndexes();
+	for (auto policyIndex = policyIndexes.begin(); policyIndex != policyIndexes.end(); ++policyIndex)
+	{
+		if (policyManager->getPolicyPtr(*policyIndex)->getGuid() == policyGuid)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+TimeSpan Simulator::getElapsedTime(void)
+{
+	throwIfNotStarted();
+	return m_clock->getCurrentTime() - m_startTime;
+}
+
+UInt64 Simulator::getEventCount(void) const
+{
+	return m_eventCount;
+}
+
+UInt64 Simulator::getFiredTimerCount(void) const
+{
+	return (m_clock != nullptr) ? m_clock->getFiredTimerCount() : 0;
+}
+
+void Simulator::createParticipant(
+	esif_handle_t participantHandle,
+	const std::string& name,
+	const std::string& description,
+	eDomainType domainType,
+	const std::vector<esif_capability_type>& capabilities)
+{
+	throwIfNotStarted();
+
+	EsifDataString participantName(name);
+	EsifDataString participantDescription(description);
+	EsifDataString acpiScope(getAcpiScope(name));
+	EsifDataString emptyString("");
+	UInt8 zeroGuidBytes[Guid::GuidSize] = {0};
+	Guid zeroGuid(zeroGuidBytes);
+	EsifDataGuid driverType(zeroGuid);
+	AppParticipantData participantData;
+	esif_ccb_memset(&participantData, 0, sizeof(participantData));
+	participantData.fDriverType = driverType;
+	participantData.fDeviceType = driverType;
+	participantData.fName = participantName;
+	participantData.fDesc = participantDescription;
+	participantData.fDriverName = emptyString;
+	participantData.fDeviceName = emptyString;
+	participantData.fDevicePath = emptyString;
+	participantData.fDomainCount = 1;
+	participantData.fBusEnumerator = ESIF_PARTICIPANT_ENUM_ACPI;
+	participantData.fAcpiDevice = emptyString;
+	participantData.fAcpiScope = acpiScope;
+	participantData.fAcpiUID = emptyString;
+	participantData.fAcpiType = domainType;
+
+	eEsifError rc = m_interfaceSet.appIface.fParticipantCreateFuncPtr(
+		m_appHandle, participantHandle, &participantData, eParticipantStateEnabled);
+	if (rc != ESIF_OK)
+	{
+		throw dptf_exception("Failed to create participant " + name + ".");
+	}
+
+	// The platform does not look at domain handles, so the domain takes the handle after its participant
+	EsifDataString domainName("D0");
+	EsifDataString domainDescription(description);
+	EsifDataGuid domainGuid(zeroGuid);
+	AppDomainData domainData;
+	esif_ccb_memset(&domainData, 0, sizeof(domainData));
+	domainData.fName = domainName;
+	domainData.fDescription = domainDescription;
+	domainData.fGuid = domainGuid;
+	domainData.fType = domainType;
+	for (auto capability = capabilities.begin(); capability != capabilities.end(); ++capability)
+	{
+		domainData.fCapabilityBytes[*capability] = 1;
+	}
+
+	rc = m_interfaceSet.appIface.fDomainCreateFuncPtr(
+		m_appHandle, participantHandle, participantHandle + 1, &domainData, eDomainStateEnabled);
+	if (rc != ESIF_OK)
+	{
+		throw dptf_exception("Failed to create the domain of participant " + name + ".");
+	}
+
+	settle();
+}
+
+void Simulator::settle(void)
+{
+	auto workItemQueueManager = m_dptfManager->getWorkItemQueueManager();
+	for (UIntN pass = 0; pass < MaxSettlePasses; pass++)
+	{
+		auto primitiveCount = m_platform->getPrimitiveCount();
+		workItemQueueManager->enqueueImmediateWorkItemAndWait(make_shared<WISimulatorSettle>(m_dptfManager));
+		workItemQueueManager->getPolicyExecutor()->waitUntilIdle();
+		if (m_platform->getPrimitiveCount() == primitiveCount)
+		{
+			break;
+		}
+	}
+}
+
+void Simulator::deliverTemperatureThresholdEvents(void)
+{
+	EsifDataGuid eventGuid(
+		FrameworkEventInfo::instance()->getGuid(FrameworkEvent::DomainTemperatureThresholdCrossed));
+
+	for (auto sensor = m_sensorHandles.begin(); sensor != m_sensorHandles.end(); ++sensor)
+	{
+		for (UIntN event = 0;
+			 (event < MaxThresholdEventsPerUpdate) && m_platform->checkTemperatureThresholdCrossed(*sensor);
+			 event++)
+		{
+			EsifDataVoid eventData;
+			m_interfaceSet.appIface.fAppEventFuncPtr(m_appHandle, *sensor, *sensor + 1, eventData, eventGuid);
+			m_eventCount++;
+			settle();
+		}
+	}
+}
+
+void Simulator::throwIfNotStarted(void) const
+{
+	if (m_dptfManager == nullptr)
+	{
+		throw dptf_exception("The simulator is not started.");
+	}
+}
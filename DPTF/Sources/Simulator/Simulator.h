@@ -0,0 +1,83 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "SimulatedPlatform.h"
+#include "VirtualClock.h"
+#include "esif_sdk_iface_app.h"
+#include "esif_sdk_capability_type.h"
+
+class DptfManagerInterface;
+
+//
+// Runs the DPTF framework and the policy libraries next to the Manager on a simulated platform and a virtual clock.
+// Virtual time only moves in advance(), which fires the framework's timers in order and delivers temperature
+// threshold events, letting the framework settle after each one.  Everything the policies do in response therefore
+// happens at the virtual time of its cause, however long it takes in real time.
+//
+class Simulator
+{
+public:
+	Simulator(std::shared_ptr<SimulatedPlatform> platform);
+	~Simulator(void);
+
+	// Creates DPTF, which loads the supported policies from the directory of this executable, and moves the
+	// policies onto the virtual clock
+	void start(void);
+	void stop(void);
+
+	// Creates a participant the platform already has, with one domain.  Its ACPI scope is getAcpiScope(name).
+	void createSensorParticipant(esif_handle_t participantHandle, const std::string& name);
+	void createPowerParticipant(esif_handle_t participantHandle, const std::string& name);
+	void createFanParticipant(esif_handle_t participantHandle, const std::string& name);
+	static std::string getAcpiScope(const std::string& name);
+
+	// Moves virtual time forward, firing timers and delivering events as they happen
+	void advance(const TimeSpan& interval);
+
+	Bool isPolicyLoaded(const Guid& policyGuid);
+	TimeSpan getElapsedTime(void);
+	UInt64 getEventCount(void) const;
+	UInt64 getFiredTimerCount(void) const;
+
+private:
+	// hide the copy constructor and assignment operator.
+	Simulator(const Simulator& rhs);
+	Simulator& operator=(const Simulator& rhs);
+
+	std::shared_ptr<SimulatedPlatform> m_platform;
+	std::shared_ptr<VirtualClock> m_clock;
+	TimeSpan m_startTime;
+	AppInterfaceSet m_interfaceSet;
+	esif_handle_t m_appHandle;
+	DptfManagerInterface* m_dptfManager;
+	UInt64 m_eventCount;
+	std::vector<esif_handle_t> m_sensorHandles;
+
+	void createParticipant(
+		esif_handle_t participantHandle,
+		const std::string& name,
+		const std::string& description,
+		eDomainType domainType,
+		const std::vector<esif_capability_type>& capabilities);
+	void settle(void);
+	void deliverTemperatureThresholdEvents(void);
+	void throwIfNotStarted(void) const;
+};
@@ -0,0 +1,152 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "VirtualClock.h"
+#include "EsifMutexHelper.h"
+#include "EsifTime.h"
+
+static std::shared_ptr<VirtualClock> g_installedClock;
+
+static TimeSpan GetInstalledClockTime(void)
+{
+	return g_installedClock->getCurrentTime();
+}
+
+VirtualClock::VirtualClock(const TimeSpan& startTime)
+	: m_mutex()
+	, m_currentTime(startTime)
+	, m_timers()
+	, m_nextSequenceNumber(0)
+	, m_firedTimerCount(0)
+{
+	if (startTime.isInvalid())
+	{
+		throw dptf_exception("Virtual time cannot start at an invalid time.");
+	}
+}
+
+VirtualClock::~VirtualClock(void)
+{
+}
+
+TimeSpan VirtualClock::getCurrentTime(void)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	TimeSpan currentTime = m_currentTime;
+	esifMutexHelper.unlock();
+	return currentTime;
+}
+
+Bool VirtualClock::fireNextTimer(const TimeSpan& endTime)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+
+	auto nextTimer = m_timers.end();
+	for (auto timer = m_timers.begin(); timer != m_timers.end(); ++timer)
+	{
+		if ((nextTimer == m_timers.end()) || (timer->second.expirationTime < nextTimer->second.expirationTime)
+			|| ((timer->second.expirationTime == nextTimer->second.expirationTime)
+				&& (timer->second.sequenceNumber < nextTimer->second.sequenceNumber)))
+		{
+			nextTimer = timer;
+		}
+	}
+
+	if ((nextTimer == m_timers.end()) || (nextTimer->second.expirationTime > endTime))
+	{
+		esifMutexHelper.unlock();
+		return false;
+	}
+
+	// A timer set for a time that has already passed fires now
+	if (nextTimer->second.expirationTime > m_currentTime)
+	{
+		m_currentTime = nextTimer->second.expirationTime;
+	}
+	auto callback = nextTimer->second.callback;
+	auto context = nextTimer->second.context;
+	m_timers.erase(nextTimer);
+	m_firedTimerCount++;
+
+	// The callback may set or cancel timers, so it runs without the lock held
+	esifMutexHelper.unlock();
+	callback(context);
+	return true;
+}
+
+void VirtualClock::setCurrentTime(const TimeSpan& currentTime)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	throwIfMovingBackwards(currentTime);
+	m_currentTime = currentTime;
+	esifMutexHelper.unlock();
+}
+
+void VirtualClock::setTimer(
+	const void* owner,
+	const TimeSpan& expirationTime,
+	esif_ccb_timer_cb callback,
+	void* context)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	Timer timer = {expirationTime, m_nextSequenceNumber++, callback, context};
+	m_timers[owner] = timer;
+	esifMutexHelper.unlock();
+}
+
+void VirtualClock::cancelTimer(const void* owner)
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	m_timers.erase(owner);
+	esifMutexHelper.unlock();
+}
+
+UInt64 VirtualClock::getFiredTimerCount(void) const
+{
+	EsifMutexHelper esifMutexHelper(&m_mutex);
+	esifMutexHelper.lock();
+	UInt64 firedTimerCount = m_firedTimerCount;
+	esifMutexHelper.unlock();
+	return firedTimerCount;
+}
+
+void VirtualClock::install(std::shared_ptr<VirtualClock> clock)
+{
+	g_installedClock = clock;
+	EsifTime::setTimeSource((clock != nullptr) ? GetInstalledClockTime : nullptr);
+}
+
+std::shared_ptr<VirtualClock> VirtualClock::getInstalled(void)
+{
+	return g_installedClock;
+}
+
+void VirtualClock::throwIfMovingBackwards(const TimeSpan& newTime) const
+{
+	if (newTime.isInvalid() || (newTime < m_currentTime))
+	{
+		throw dptf_exception(
+			"Cannot move virtual time from " + m_currentTime.toStringMilliseconds() + " to "
+			+ newTime.toStringMilliseconds() + ".");
+	}
+}
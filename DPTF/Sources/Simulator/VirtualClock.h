@@ -0,0 +1,73 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "TimeInterface.h"
+#include "EsifMutex.h"
+#include "esif_ccb_timer.h"
+#include <map>
+
+// A clock that only moves when the simulator moves it.  The simulator builds its own EsifTimer on top of this clock
+// (see VirtualEsifTimer.cpp), so the framework's deferred work items expire in virtual time, and the policies are
+// given the clock as their time object.  Time never moves backwards.
+class VirtualClock : public TimeInterface
+{
+public:
+	VirtualClock(const TimeSpan& startTime);
+	virtual ~VirtualClock(void);
+
+	virtual TimeSpan getCurrentTime(void) override;
+
+	// Fires the earliest timer that expires at or before endTime after moving the clock to its expiration time.
+	// The callback runs on the calling thread.  Returns false, without moving the clock, if no timer is due.
+	Bool fireNextTimer(const TimeSpan& endTime);
+
+	// Moves the clock to the given time without firing any timers
+	void setCurrentTime(const TimeSpan& currentTime);
+
+	void setTimer(const void* owner, const TimeSpan& expirationTime, esif_ccb_timer_cb callback, void* context);
+	void cancelTimer(const void* owner);
+	UInt64 getFiredTimerCount(void) const;
+
+	// The clock behind EsifTime and EsifTimer in this process, or null while the system clock is used
+	static void install(std::shared_ptr<VirtualClock> clock);
+	static std::shared_ptr<VirtualClock> getInstalled(void);
+
+private:
+	// hide the copy constructor and assignment operator.
+	VirtualClock(const VirtualClock& rhs);
+	VirtualClock& operator=(const VirtualClock& rhs);
+
+	struct Timer
+	{
+		TimeSpan expirationTime;
+		UInt64 sequenceNumber;
+		esif_ccb_timer_cb callback;
+		void* context;
+	};
+
+	mutable EsifMutex m_mutex;
+	TimeSpan m_currentTime;
+	std::map<const void*, Timer> m_timers;
+	UInt64 m_nextSequenceNumber;
+	UInt64 m_firedTimerCount;
+
+	void throwIfMovingBackwards(const TimeSpan& newTime) const;
+};
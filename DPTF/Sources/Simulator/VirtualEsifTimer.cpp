@@ -0,0 +1,95 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+//
+// The simulator is built with this file in place of Manager/EsifTimer.cpp.  Timers are kept by the installed
+// VirtualClock and fire when the simulator advances it, so no timer manager threads are needed.
+//
+
+#include "EsifTimer.h"
+#include "VirtualClock.h"
+
+enum esif_rc esif_ccb_tmrm_init(void)
+{
+	return ESIF_OK;
+}
+
+void esif_ccb_tmrm_exit(void)
+{
+}
+
+EsifTimer::EsifTimer(esif_ccb_timer_cb callbackFunction, void* contextPtr)
+	: m_callbackFunction(callbackFunction)
+	, m_contextPtr(contextPtr)
+	, m_timerInitialized(false)
+	, m_expirationTime(TimeSpan::createFromSeconds(0))
+{
+	esif_ccb_memset(&m_timer, 0, sizeof(esif_ccb_timer_t));
+}
+
+EsifTimer::~EsifTimer(void)
+{
+	esifTimerKill();
+}
+
+void EsifTimer::startTimer(const TimeSpan& expirationTime)
+{
+	esifTimerSet(expirationTime);
+}
+
+void EsifTimer::cancelTimer(void)
+{
+	esifTimerKill();
+}
+
+Bool EsifTimer::isExpirationTimeValid(void) const
+{
+	return (m_expirationTime.asMillisecondsInt() != 0);
+}
+
+const TimeSpan& EsifTimer::getExpirationTime(void) const
+{
+	return m_expirationTime;
+}
+
+void EsifTimer::esifTimerKill()
+{
+	if (m_timerInitialized == true)
+	{
+		auto clock = VirtualClock::getInstalled();
+		if (clock != nullptr)
+		{
+			clock->cancelTimer(this);
+		}
+		m_timerInitialized = false;
+		m_expirationTime = TimeSpan::createFromMilliseconds(0);
+	}
+}
+
+void EsifTimer::esifTimerSet(const TimeSpan& expirationTime)
+{
+	auto clock = VirtualClock::getInstalled();
+	if (clock == nullptr)
+	{
+		throw dptf_exception("Failed to start timer.  No virtual clock is installed.");
+	}
+
+	clock->setTimer(this, expirationTime, m_callbackFunction, m_contextPtr);
+	m_timerInitialized = true;
+	m_expirationTime = expirationTime;
+}
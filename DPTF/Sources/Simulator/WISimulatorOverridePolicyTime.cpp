@@ -0,0 +1,40 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#include "WISimulatorOverridePolicyTime.h"
+#include "Policy.h"
+
+WISimulatorOverridePolicyTime::WISimulatorOverridePolicyTime(
+	DptfManagerInterface* dptfManager,
+	std::shared_ptr<TimeInterface> time)
+	: WorkItem(dptfManager, FrameworkEvent::DptfCommand)
+	, m_time(time)
+{
+}
+
+WISimulatorOverridePolicyTime::~WISimulatorOverridePolicyTime(void)
+{
+}
+
+void WISimulatorOverridePolicyTime::onExecute(void)
+{
+	writeWorkItemStartingInfoMessage();
+
+	// DptfCommand work items require serialized execution, so the policies are called directly
+	executeOnAllPolicies("Policy::overrideTimeObject", [=](IPolicy* policy) { policy->overrideTimeObject(m_time); });
+}
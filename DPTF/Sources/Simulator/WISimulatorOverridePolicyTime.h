@@ -0,0 +1,37 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "WorkItem.h"
+
+class TimeInterface;
+
+// Gives every loaded policy the simulator's clock as its time object
+class WISimulatorOverridePolicyTime : public WorkItem
+{
+public:
+	WISimulatorOverridePolicyTime(DptfManagerInterface* dptfManager, std::shared_ptr<TimeInterface> time);
+	virtual ~WISimulatorOverridePolicyTime(void);
+
+	virtual void onExecute(void) override final;
+
+private:
+	std::shared_ptr<TimeInterface> m_time;
+};
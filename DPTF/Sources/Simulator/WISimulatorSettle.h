@@ -0,0 +1,33 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "Dptf.h"
+#include "WorkItem.h"
+
+// Does nothing.  It requires serialized execution, so the work item thread only runs it after every policy call
+// queued before it has completed.  The simulator waits on it to let the framework settle.
+class WISimulatorSettle : public WorkItem
+{
+public:
+	WISimulatorSettle(DptfManagerInterface* dptfManager);
+	virtual ~WISimulatorSettle(void);
+
+	virtual void onExecute(void) override final;
+};
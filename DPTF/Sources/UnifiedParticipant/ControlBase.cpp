@@ -127,7 +127,7 @@ void ControlBase::unbindRequestHandlers()
 	{
 		try
 		{
-			getParticipantServices()->unregisterRequestHandler(handler->first, this);
+			getParticipantServices()->unregisterRequestHandler(handler->first, getDomainIndex(), this);
 		}
 		catch (...)
 		{
@@ -169,7 +169,7 @@ void ControlBase::bindRequestHandler(
 	std::function<DptfRequestResult(const PolicyRequest&)> functionObj)
 {
 	m_requestHandlers[requestType] = functionObj;
-	getParticipantServices()->registerRequestHandler(requestType, this);
+	getParticipantServices()->registerRequestHandler(requestType, getDomainIndex(), this);
 }
 
 UInt16 ControlBase::createTupleDomain() const
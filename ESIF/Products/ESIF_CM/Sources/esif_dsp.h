@@ -230,6 +230,7 @@ enum esif_domain_type get_domain_type(
 #ifdef ESIF_ATTR_USER
 #include "esif_primitive.h"
 #include "esif_uf_fpc.h"
+#include "esif_hash_table.h"
 
 #undef THIS
 #define THIS struct esif_up_dsp *THIS
@@ -254,6 +255,7 @@ typedef struct esif_uf_dm {
 	UInt8  dme_count;			/* Current Reference Count */
 	EsifUfDme dme[MAX_DSP_MANAGER_ENTRY];	/* Max Participants */
 	esif_ccb_lock_t lock;			/* Package Manager Lock */
+	atomic_t generation;			/* Changed whenever the DSP table is built or destroyed */
 } EsifUfDm, *EsifUfDmPtr;
 
 typedef struct _t_EsifDspQuery {
@@ -309,6 +311,11 @@ struct esif_up_dsp {
 	struct esif_link_list   *algo_ptr;	/* Algorithm */
 	struct esif_link_list   *evt_ptr;	/* Events */
 
+	/* Lookup Tables Built At Load Time, Pointing Into The FPC */
+	EsifFpcAlgorithmPtr algo_by_type[MAX_ESIF_ACTION_ENUM_VALUE + 1];	/* Algorithm By Action Type */
+	EsifFpcEventPtr evt_by_type[MAX_ESIF_EVENT_ENUM_VALUE + 1];	/* Event By Type */
+	struct esif_ht  *evt_guid_ht;	/* Event By GUID */
+
 	/* Boolean array indicating if a given action type is used in the DSP */
 	UInt8 contained_actions[MAX_ESIF_ACTION_ENUM_VALUE + 1];
 
@@ -418,6 +425,17 @@ struct esif_uf_dm_query_plat {
 /* Query */
 struct esif_ipc_event_data_create_participant;
 
+/* DSP Lookup Table Statistics */
+typedef struct _t_EsifDspLookupStats {
+	char code[ESIF_NAME_LEN];		/* DSP Code */
+	UInt32 numAlgorithms;			/* Algorithms In The FPC */
+	UInt32 numAlgorithmsIndexed;	/* Algorithm By Action Type Entries In Use */
+	UInt32 numEvents;				/* Events In The FPC */
+	UInt32 numEventsIndexed;		/* Event By Type Entries In Use */
+	struct esif_ht_stats primitiveStats;	/* Primitive Hash Table */
+	struct esif_ht_stats eventGuidStats;	/* Event By GUID Hash Table */
+} EsifDspLookupStats, *EsifDspLookupStatsPtr;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -425,6 +443,12 @@ extern "C" {
 struct esif_up_dsp *esif_uf_dm_select_dsp_by_code (esif_string code);
 EsifString EsifDspMgr_SelectDsp(EsifDspQuery query);
 
+/* Get Lookup Table Statistics For The DSP In The Given Manager Slot */
+eEsifError EsifDspMgr_GetLookupStats(UInt8 index, EsifDspLookupStatsPtr statsPtr);
+
+/* DSP pointers saved with an older generation may refer to a freed DSP */
+UInt32 EsifDspMgr_GetGeneration(void);
+
 /* DSP Manager Init */
 eEsifError EsifDspMgrInit(void);
 
@@ -511,6 +511,42 @@ exit:
 }
 
 
+/* Get Hash Table Statistics */
+enum esif_rc esif_ht_get_stats(
+	struct esif_ht *self,
+	struct esif_ht_stats *stats_ptr
+	)
+{
+	enum esif_rc rc = ESIF_OK;
+	u32 index = 0;
+	u32 nodes = 0;
+
+	if ((self == NULL) || (self->table == NULL) || (stats_ptr == NULL)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	esif_ccb_memset(stats_ptr, 0, sizeof(*stats_ptr));
+	stats_ptr->size = self->size;
+
+	for (index = 0; index < self->size; ++index) {
+		if (self->table[index] == NULL)
+			continue;
+
+		nodes = self->table[index]->nodes;
+		if (nodes > 0) {
+			stats_ptr->items += nodes;
+			stats_ptr->used_buckets++;
+			stats_ptr->collisions += nodes - 1;
+			if (nodes > stats_ptr->max_chain)
+				stats_ptr->max_chain = nodes;
+		}
+	}
+exit:
+	return rc;
+}
+
+
 /* Init */
 enum esif_rc esif_ht_init(void)
 {
@@ -69,6 +69,15 @@ struct esif_ht_node {
 	void *item_ptr; /* points to the actual item */
 };
 
+/* Hash Table Occupancy Statistics */
+struct esif_ht_stats {
+	u32 size;		/* Number of buckets */
+	u32 items;		/* Number of items in all buckets */
+	u32 used_buckets;	/* Buckets holding at least one item */
+	u32 collisions;		/* Items sharing a bucket with an earlier item */
+	u32 max_chain;		/* Longest bucket chain */
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -102,6 +111,13 @@ void *esif_ht_get_item(
 	);
 
 
+/* Gets the occupancy statistics of the Hash Table */
+enum esif_rc esif_ht_get_stats(
+	struct esif_ht *self,
+	struct esif_ht_stats *stats_ptr
+	);
+
+
 /* Init */
 enum esif_rc esif_ht_init(void);
 void esif_ht_exit(void);
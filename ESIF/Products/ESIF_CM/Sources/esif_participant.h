@@ -356,6 +356,15 @@ typedef struct _t_EsifUp {
 	esif_ccb_lock_t objLock;
 } EsifUp, *EsifUpPtr, **EsifUpPtrLocation;
 
+/* A primitive resolved to the DSP action that last succeeded for it; see EsifUp_ExecuteResolvedPrimitive */
+typedef struct _t_EsifUpResolvedPrimitive {
+	EsifDspPtr dspPtr;					/* Participant DSP the action was resolved from */
+	UInt32 dspGeneration;				/* DSP table generation the action was resolved in */
+	EsifFpcPrimitivePtr primitivePtr;	/* NULL when not resolved */
+	EsifFpcActionPtr fpcActionPtr;
+	UInt16 kernelActNum;
+} EsifUpResolvedPrimitive, *EsifUpResolvedPrimitivePtr;
+
 /*
  * The following functions are data "accessor" functions
  */
@@ -487,6 +496,21 @@ eEsifError EsifUp_ExecutePrimitive(
 	EsifDataPtr responsePtr
 	);
 
+/*
+ * Executes a primitive which is read repeatedly, such as by the domain sampler.
+ * The first call resolves the primitive and saves the DSP action that succeeded
+ * in the caller's resolvedPtr; later calls execute that action directly.  The
+ * saved action is resolved again when the participant DSP or the DSP table
+ * changes, or when the action fails.  resolvedPtr must be zeroed before first use.
+ */
+eEsifError EsifUp_ExecuteResolvedPrimitive(
+	EsifUpPtr upPtr,
+	EsifUpResolvedPrimitivePtr resolvedPtr,
+	EsifPrimitiveTuplePtr tuplePtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	);
+
 eEsifError EsifUp_UpdatePolling(
 	EsifUpPtr self,
 	UInt16 domain_index,
@@ -64,7 +64,7 @@
  *******************************************************************************
  */
 
-/* Maximum Participant Entries */
+/* Maximum Participant Entries (LF); Initial Participant Entries (UF) */
 #define MAX_PARTICIPANT_ENTRY 32
 #define ESIF_INSTANCE_FIRST     1	/* The First Useable Instance        */
 #define ESIF_INSTANCE_UF        254	/* Reserved For ESIF Upper Framework */
@@ -205,24 +205,45 @@ void esif_lf_pm_exit(void);
 
 typedef struct UfPmIterator_s {
 	u32 marker;
-	UInt8 index;
+	UInt32 index;
 	Bool ref_taken;
 	EsifUpPtr upPtr;
 } UfPmIterator, *UfPmIteratorPtr;
 
 #define UF_PM_ITERATOR_MARKER 'UFPM'
 
+/* Number of hash buckets used to index the participant table */
+#define ESIF_UPPMGR_INDEX_SIZE	61
+
+/* Number of Logical Participant instances tracked by the LP index */
+#define ESIF_UPPMGR_LP_INDEX_SIZE	256
+
 /* Participant Manager Entry */
 typedef struct _t_EsifUpManagerEntry {
 	enum esif_pm_participant_state  fState;
 	EsifUpPtr fUpPtr;
+	UInt32 fIndex;						/* Position in the participant table */
+	esif_handle_t fIndexedInstance;		/* Instance the entry is indexed by, if any */
+	char fIndexedName[ESIF_NAME_LEN];	/* Upper-case name the entry is indexed by, if any */
+	Bool fIsNameCollision;				/* Entry could not be indexed by name */
 } EsifUpManagerEntry, *EsifUpManagerEntryPtr, **EsifUpManagerEntryPtrLocation;
 
 
-/* Participant Manager */
+/*
+ * Participant Manager
+ * Entries are allocated individually so entry pointers remain valid while the
+ * table grows. The available list holds the sorted table positions of all
+ * entries whose state is greater than ESIF_PM_PARTICIPANT_STATE_REMOVED.
+ */
 typedef struct _t_EsifUppMgr {
-	UInt8 fEntryCount;
-	EsifUpManagerEntry fEntries[MAX_PARTICIPANT_ENTRY];
+	UInt32 fEntryCount;					/* Number of entries in the available list */
+	UInt32 fEntrySize;					/* Number of allocated entries */
+	EsifUpManagerEntryPtr *fEntries;
+	UInt32 *fAvailable;					/* Sorted table positions of available entries */
+	struct esif_ht *fInstanceIndex;		/* Instance -> Entry */
+	struct esif_ht *fNameIndex;			/* Upper-case Name -> Entry */
+	UInt32 fNameCollisions;				/* Entries left out of the name index because of a case-insensitive duplicate */
+	UInt32 fLpIndex[ESIF_UPPMGR_LP_INDEX_SIZE];	/* LP Instance -> Table position + 1 (hint only) */
 	esif_ccb_lock_t fLock;
 } EsifUppMgr, *EsifUppMgrPtr, **EsifUppMgrPtrLocation;
 
@@ -286,7 +307,7 @@ eEsifError EsifUpPm_GetNextUp(
 	);
 
 /* Returns current Participant count without iterating */
-UInt8 EsifUpPm_ParticipantCount();
+UInt32 EsifUpPm_ParticipantCount();
 
 eEsifError EsifUpPm_MapLpidToParticipantInstance(
 	const UInt8 lpInstance,
@@ -32,10 +32,24 @@
 ///////////////////////////////////////////////////////
 // DataCache Class
 
+#define DATACACHE_MIN_CAPACITY		16	// Minimum number of allocated elements
+#define DATACACHE_MIN_HASHBUCKETS	32	// Minimum number of hash index slots (power of 2)
+#define DATACACHE_HASH_EMPTY		0	// Unused hash index slot
+#define DATACACHE_HASH_DELETED		((UInt32)(-1)) // Deleted hash index slot
+
 // private members
 static DataCacheEntryPtr DataCache_GetList(DataCachePtr self);
 static int DataCache_Search(DataCachePtr self, esif_string key);
 static int DataCache_FindInsertionPoint(DataCachePtr self, esif_string key);
+static eEsifError DataCache_Reserve(DataCachePtr self, UInt32 count);
+static void DataCache_Shrink(DataCachePtr self);
+static void DataCache_SortElements(DataCachePtr self);
+static UInt32 DataCache_HashKey(esif_string key);
+static eEsifError DataCache_RebuildIndex(DataCachePtr self);
+static int DataCache_IndexFind(DataCachePtr self, esif_string key);
+static void DataCache_IndexAdd(DataCachePtr self, UInt32 node);
+static void DataCache_IndexReplace(DataCachePtr self, UInt32 node, UInt32 newValue);
+static void DataCache_IndexShift(DataCachePtr self, UInt32 first, int delta);
 static EsifDataPtr CloneCacheData(EsifDataPtr dataPtr);
 
 // constructor
@@ -59,6 +73,7 @@ void DataCache_Destroy (DataCachePtr self)
 		EsifData_dtor(&self->elements[i].value);
 	}
 	esif_ccb_free(self->elements);
+	esif_ccb_free(self->hashIndex);
 	WIPEPTR(self);
 	esif_ccb_free(self);
 }
@@ -71,7 +86,7 @@ DataCacheEntryPtr DataCache_GetValue (
 {
 	int index = 0;
 
-	if (NULL == self) {
+	if (NULL == self || NULL == key) {
 		return NULL;
 	}
 	
@@ -89,8 +104,8 @@ DataCacheEntryPtr DataCache_GetValue (
 // member indicates the buf_ptr represents a file offset; not whether the EsifData
 // items owns the associated buffer.
 // Notes: The pair is inserted even if a key with the same name already exists.
-// The cache array will be re-allocated to fit the new member and old members
-// will be copied down if needed to allow insertion
+// The cache array grows geometrically and old members are copied down if needed
+// to allow insertion. During a Bulk Load the pair is appended instead.
 //
 eEsifError DataCache_InsertValue(
 	DataCachePtr self,
@@ -100,12 +115,11 @@ eEsifError DataCache_InsertValue(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	DataCacheEntryPtr old_elements = NULL;
 	EsifData keydata;
 	EsifDataPtr valueClonePtr = NULL;
 	int node = 0;
 
-	if ((NULL == self) || (NULL == valuePtr)) {
+	if ((NULL == self) || (NULL == key) || (NULL == valuePtr)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
@@ -116,16 +130,18 @@ eEsifError DataCache_InsertValue(
 		goto exit;
 	}
 
-	node = DataCache_FindInsertionPoint(self, key);
-
-	// Reallocate the elements to fit the new pair
-	old_elements = self->elements;
-	self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size + 1) * sizeof(*self->elements));
-	if (NULL == self->elements) {
-		self->elements = old_elements;
-		rc = ESIF_E_NO_MEMORY;
+	// Make room for the new pair
+	rc = DataCache_Reserve(self, self->size + 1);
+	if (rc != ESIF_OK) {
 		goto exit;
 	}
+
+	if (self->bulkLoad) {
+		node = (int)self->size;
+	}
+	else {
+		node = DataCache_FindInsertionPoint(self, key);
+	}
 	
 	// Move old pairs down to fit the new pair
 	if (node < (int)self->size) {
@@ -139,6 +155,19 @@ eEsifError DataCache_InsertValue(
 	self->elements[node].value = *valueClonePtr;
 	self->elements[node].flags = flags;
 	self->size++;
+
+	// Keep the index valid here, while the caller holds the write lock, so lookups never modify it.
+	// Appends (including every Bulk Load insert) only add a slot; a mid-array insert also shifts the
+	// indexes of every element after it.
+	if (self->hashValid) {
+		if (node < (int)self->size - 1) {
+			DataCache_IndexShift(self, (UInt32)node, 1);
+		}
+		DataCache_IndexAdd(self, node);
+	}
+	else {
+		DataCache_RebuildIndex(self);
+	}
 exit:
 	if (rc == ESIF_OK) {
 		esif_ccb_free(valueClonePtr); // Free pointer but don't destroy as the element owns buffer now
@@ -155,39 +184,47 @@ eEsifError DataCache_DeleteValue(
 	)
 {
 	eEsifError rc = ESIF_OK;
+	int found = EOF;
 	UInt32 node = 0;
+	UInt32 last = 0;
 
-	if (NULL == self) {
+	if (NULL == self || NULL == key) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
 
-	node = DataCache_Search(self, key);
-	if (node == EOF) {
+	found = DataCache_Search(self, key);
+	if (found == EOF) {
 		rc = ESIF_E_NOT_FOUND;
 		goto exit;
 	}
+	node = (UInt32)found;
+	last = self->size - 1;
+
+	// Remove the index entry while the key is still available
+	DataCache_IndexReplace(self, node, DATACACHE_HASH_DELETED);
 	EsifData_dtor(&self->elements[node].key);
 	EsifData_dtor(&self->elements[node].value);
 
-	if (node < self->size - 1) {
-		esif_ccb_memmove(&self->elements[node], &self->elements[node + 1], (self->size - node - 1) * sizeof(*self->elements));
-		esif_ccb_memset(&self->elements[self->size - 1], 0, sizeof(self->elements[0]));
-	}
-
-	if (self->size > 1) {
-		DataCacheEntryPtr old_elements = self->elements;
-		self->elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, (self->size - 1) * sizeof(*self->elements));
-		if (NULL == self->elements) {
-			self->elements = old_elements;
-			rc = ESIF_E_NO_MEMORY;
-			goto exit;
+	if (node < last) {
+		if (self->bulkLoad) {
+			// Order does not matter until the Bulk Load ends, so move the last pair into the hole
+			self->elements[node] = self->elements[last];
+			DataCache_IndexReplace(self, last, node + 1);
+		}
+		else {
+			esif_ccb_memmove(&self->elements[node], &self->elements[node + 1], (last - node) * sizeof(*self->elements));
+			DataCache_IndexShift(self, node + 1, -1);
 		}
-	} else {
-		esif_ccb_free(self->elements);
-		self->elements = NULL;
 	}
+	esif_ccb_memset(&self->elements[last], 0, sizeof(self->elements[0]));
 	self->size--;
+
+	if (!self->hashValid) {
+		DataCache_RebuildIndex(self);
+	}
+
+	DataCache_Shrink(self);
 exit:
 	return rc;
 }
@@ -199,6 +236,24 @@ UInt32 DataCache_GetCount (DataCachePtr self)
 }
 
 
+void DataCache_BeginBulkLoad(DataCachePtr self)
+{
+	if (self) {
+		self->bulkLoad = ESIF_TRUE;
+	}
+}
+
+
+void DataCache_EndBulkLoad(DataCachePtr self)
+{
+	if (self && self->bulkLoad) {
+		DataCache_SortElements(self);
+		self->bulkLoad = ESIF_FALSE;
+		DataCache_RebuildIndex(self);
+	}
+}
+
+
 // Private Members
 DataCacheEntryPtr DataCache_GetList (DataCachePtr self)
 {
@@ -211,13 +266,33 @@ static int DataCache_Search (
 	esif_string key
 	)
 {
-	// Do Binary Search on Sorted Array
 	int items = 0;
+	int node = 0;
 	
 	ESIF_ASSERT(self != NULL);
 
+	// Exact-key lookups use the hash index, which only inserts and deletes maintain. Lookups must not
+	// modify the cache since DataVault readers share a read lock, so if the index could not be built
+	// (out of memory) this falls back to searching the elements.
+	if (self->hashValid) {
+		return DataCache_IndexFind(self, key);
+	}
+
 	items = self->size;
-	int start = 0, end = items - 1, node = items / 2;
+
+	// Unable to build the index, so fall back to a linear search while unsorted
+	if (self->bulkLoad) {
+		for (node = 0; node < items; node++) {
+			if (esif_ccb_stricmp(key, (esif_string)(self->elements[node].key.buf_ptr)) == 0) {
+				return node;
+			}
+		}
+		return EOF;
+	}
+
+	// Do Binary Search on Sorted Array
+	int start = 0, end = items - 1;
+	node = items / 2;
 	while (start <= end) {
 		int comp = esif_ccb_stricmp(key, (esif_string)(self->elements[node].key.buf_ptr));
 		if (comp == 0) {
@@ -254,6 +329,11 @@ static int DataCache_FindInsertionPoint (
 	end = items - 1;
 	node = items / 2;
 
+	// Appending in sorted order (cloning or exporting a cache) needs only one compare
+	if (items > 0 && esif_ccb_stricmp(key, (esif_string)self->elements[end].key.buf_ptr) > 0) {
+		return items;
+	}
+
 	// Do insersion sort using binary search on sorted array
 	while (start <= end) {
 		int comp = esif_ccb_stricmp(key, (esif_string)self->elements[node].key.buf_ptr);
@@ -269,6 +349,279 @@ static int DataCache_FindInsertionPoint (
 	return node;
 }
 
+
+// Grow the elements array geometrically so that N inserts cost O(N) copies in total
+static eEsifError DataCache_Reserve(
+	DataCachePtr self,
+	UInt32 count
+	)
+{
+	eEsifError rc = ESIF_OK;
+	DataCacheEntryPtr new_elements = NULL;
+	UInt32 new_capacity = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (count <= self->capacity) {
+		goto exit;
+	}
+
+	new_capacity = esif_ccb_max(self->capacity, DATACACHE_MIN_CAPACITY);
+	while (new_capacity < count) {
+		new_capacity *= 2;
+	}
+
+	new_elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, new_capacity * sizeof(*self->elements));
+	if (NULL == new_elements) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	esif_ccb_memset(&new_elements[self->size], 0, (new_capacity - self->size) * sizeof(*new_elements));
+	self->elements = new_elements;
+	self->capacity = new_capacity;
+exit:
+	return rc;
+}
+
+
+// Release memory once the cache is mostly empty
+static void DataCache_Shrink(DataCachePtr self)
+{
+	ESIF_ASSERT(self != NULL);
+
+	if (self->size == 0) {
+		esif_ccb_free(self->elements);
+		esif_ccb_free(self->hashIndex);
+		self->elements = NULL;
+		self->capacity = 0;
+		self->hashIndex = NULL;
+		self->hashBuckets = 0;
+		self->hashUsed = 0;
+		self->hashValid = ESIF_FALSE;
+	}
+	else if (self->capacity > DATACACHE_MIN_CAPACITY && self->size < self->capacity / 4) {
+		UInt32 new_capacity = self->capacity / 2;
+		DataCacheEntryPtr new_elements = (DataCacheEntryPtr)esif_ccb_realloc(self->elements, new_capacity * sizeof(*self->elements));
+		if (new_elements) {
+			self->elements = new_elements;
+			self->capacity = new_capacity;
+		}
+	}
+}
+
+
+// Sort all elements by key once at the end of a Bulk Load (in-place Heap Sort, so no allocation can fail)
+static void DataCache_SortElements(DataCachePtr self)
+{
+	DataCacheEntry temp = {0};
+	UInt32 count = 0;
+	UInt32 start = 0;
+	UInt32 root = 0;
+	UInt32 child = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	count = self->size;
+	if (count < 2) {
+		return;
+	}
+
+	// Build Max Heap, then repeatedly move the largest key to the end
+	for (start = count / 2; start-- > 0; ) {
+		for (root = start; (child = 2 * root + 1) < count; root = child) {
+			if (child + 1 < count && esif_ccb_stricmp((esif_string)self->elements[child].key.buf_ptr, (esif_string)self->elements[child + 1].key.buf_ptr) < 0) {
+				child++;
+			}
+			if (esif_ccb_stricmp((esif_string)self->elements[root].key.buf_ptr, (esif_string)self->elements[child].key.buf_ptr) >= 0) {
+				break;
+			}
+			temp = self->elements[root];
+			self->elements[root] = self->elements[child];
+			self->elements[child] = temp;
+		}
+	}
+	while (--count > 0) {
+		temp = self->elements[0];
+		self->elements[0] = self->elements[count];
+		self->elements[count] = temp;
+
+		for (root = 0; (child = 2 * root + 1) < count; root = child) {
+			if (child + 1 < count && esif_ccb_stricmp((esif_string)self->elements[child].key.buf_ptr, (esif_string)self->elements[child + 1].key.buf_ptr) < 0) {
+				child++;
+			}
+			if (esif_ccb_stricmp((esif_string)self->elements[root].key.buf_ptr, (esif_string)self->elements[child].key.buf_ptr) >= 0) {
+				break;
+			}
+			temp = self->elements[root];
+			self->elements[root] = self->elements[child];
+			self->elements[child] = temp;
+		}
+	}
+}
+
+
+// Case-insensitive FNV-1a hash of a key, matching esif_ccb_stricmp equality
+static UInt32 DataCache_HashKey(esif_string key)
+{
+	UInt32 hash = 2166136261U;
+
+	while (key && *key) {
+		hash ^= (UInt32)(UInt8)tolower((UInt8)*key++);
+		hash *= 16777619U;
+	}
+	return hash;
+}
+
+
+// Rebuild the hash index from scratch, sized for at most 50% load
+static eEsifError DataCache_RebuildIndex(DataCachePtr self)
+{
+	eEsifError rc = ESIF_OK;
+	UInt32 buckets = DATACACHE_MIN_HASHBUCKETS;
+	UInt32 node = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	while (buckets < 2 * (self->size + 1)) {
+		buckets *= 2;
+	}
+
+	if (buckets != self->hashBuckets) {
+		UInt32 *new_index = (UInt32 *)esif_ccb_malloc(buckets * sizeof(*new_index));
+		if (NULL == new_index) {
+			self->hashValid = ESIF_FALSE;
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		esif_ccb_free(self->hashIndex);
+		self->hashIndex = new_index;
+		self->hashBuckets = buckets;
+	}
+	else {
+		esif_ccb_memset(self->hashIndex, 0, buckets * sizeof(*self->hashIndex));
+	}
+
+	self->hashUsed = 0;
+	self->hashValid = ESIF_TRUE;
+	for (node = 0; node < self->size; node++) {
+		UInt32 slot = DataCache_HashKey((esif_string)self->elements[node].key.buf_ptr) & (self->hashBuckets - 1);
+		while (self->hashIndex[slot] != DATACACHE_HASH_EMPTY) {
+			slot = (slot + 1) & (self->hashBuckets - 1);
+		}
+		self->hashIndex[slot] = node + 1;
+		self->hashUsed++;
+	}
+exit:
+	return rc;
+}
+
+
+// Find an element index by exact key using a valid hash index
+static int DataCache_IndexFind(
+	DataCachePtr self,
+	esif_string key
+	)
+{
+	UInt32 slot = 0;
+	UInt32 value = 0;
+
+	ESIF_ASSERT(self != NULL && self->hashValid);
+
+	slot = DataCache_HashKey(key) & (self->hashBuckets - 1);
+	while ((value = self->hashIndex[slot]) != DATACACHE_HASH_EMPTY) {
+		if (value != DATACACHE_HASH_DELETED && esif_ccb_stricmp(key, (esif_string)self->elements[value - 1].key.buf_ptr) == 0) {
+			return (int)(value - 1);
+		}
+		slot = (slot + 1) & (self->hashBuckets - 1);
+	}
+	return EOF;
+}
+
+
+// Add an element that was appended to the end of the array to a valid hash index
+static void DataCache_IndexAdd(
+	DataCachePtr self,
+	UInt32 node
+	)
+{
+	UInt32 slot = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (!self->hashValid) {
+		return;
+	}
+
+	// Rebuilding includes the new element since it is already in the array
+	if (2 * (self->hashUsed + 1) > self->hashBuckets) {
+		DataCache_RebuildIndex(self);
+		return;
+	}
+
+	slot = DataCache_HashKey((esif_string)self->elements[node].key.buf_ptr) & (self->hashBuckets - 1);
+	while (self->hashIndex[slot] != DATACACHE_HASH_EMPTY && self->hashIndex[slot] != DATACACHE_HASH_DELETED) {
+		slot = (slot + 1) & (self->hashBuckets - 1);
+	}
+	if (self->hashIndex[slot] == DATACACHE_HASH_EMPTY) {
+		self->hashUsed++;
+	}
+	self->hashIndex[slot] = node + 1;
+}
+
+
+// Replace the hash index slot for an element with a new value (DATACACHE_HASH_DELETED or new element index + 1)
+static void DataCache_IndexReplace(
+	DataCachePtr self,
+	UInt32 node,
+	UInt32 newValue
+	)
+{
+	UInt32 slot = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (!self->hashValid) {
+		return;
+	}
+
+	slot = DataCache_HashKey((esif_string)self->elements[node].key.buf_ptr) & (self->hashBuckets - 1);
+	while (self->hashIndex[slot] != DATACACHE_HASH_EMPTY) {
+		if (self->hashIndex[slot] == node + 1) {
+			self->hashIndex[slot] = newValue;
+			return;
+		}
+		slot = (slot + 1) & (self->hashBuckets - 1);
+	}
+
+	// Not found, so the index no longer matches the elements
+	self->hashValid = ESIF_FALSE;
+}
+
+
+// Adjust the hash index after elements from first onward moved by delta positions in the array
+static void DataCache_IndexShift(
+	DataCachePtr self,
+	UInt32 first,
+	int delta
+	)
+{
+	UInt32 slot = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (!self->hashValid) {
+		return;
+	}
+
+	// Only element indexes change, so no key needs to be hashed again
+	for (slot = 0; slot < self->hashBuckets; slot++) {
+		UInt32 value = self->hashIndex[slot];
+		if (value != DATACACHE_HASH_EMPTY && value != DATACACHE_HASH_DELETED && value - 1 >= first) {
+			self->hashIndex[slot] = (UInt32)((int)value + delta);
+		}
+	}
+}
+
 // Make a clone of NOCACHE entries only so they can be restored in the event of I/O Failure
 DataCachePtr DataCache_CloneOffsets(
 	DataCachePtr self
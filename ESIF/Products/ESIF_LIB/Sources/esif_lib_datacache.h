@@ -48,7 +48,13 @@ typedef struct DataCache_s DataCache, *DataCachePtr, **DataCachePtrLocation;
 #ifdef _DATACACHE_CLASS
 struct DataCache_s {
 	UInt32				size; // Number of DataCacheEntry's
-	DataCacheEntryPtr	elements; // Array of entry pointers
+	DataCacheEntryPtr	elements; // Array of entries, sorted by key except during a bulk load
+	UInt32				capacity; // Number of allocated DataCacheEntry's
+	UInt32				*hashIndex; // Open-addressed hash table of (element index + 1) for exact-key lookups
+	UInt32				hashBuckets; // Number of hashIndex slots (power of 2)
+	UInt32				hashUsed; // Number of occupied or deleted hashIndex slots
+	Bool				hashValid; // hashIndex matches elements
+	Bool				bulkLoad; // Entries are appended unsorted until DataCache_EndBulkLoad
 };
 
 #endif	// _DATACACHE_CLASS
@@ -75,6 +81,14 @@ eEsifError DataCache_InsertValue(DataCachePtr self, esif_string key, EsifDataPtr
 eEsifError DataCache_DeleteValue(DataCachePtr self, esif_string key);
 UInt32 DataCache_GetCount(DataCachePtr self);
 
+//
+// Bulk Load: Between Begin and End, inserts are appended in O(1) and exact-key
+// lookups and deletes remain valid, but the elements array is not sorted, so it
+// must not be iterated in order until DataCache_EndBulkLoad sorts it once.
+//
+void DataCache_BeginBulkLoad(DataCachePtr self);
+void DataCache_EndBulkLoad(DataCachePtr self);
+
 DataCachePtr DataCache_CloneOffsets(DataCachePtr self);
 eEsifError DataCache_RestoreOffsets(DataCachePtr self, DataCachePtr backup);
 
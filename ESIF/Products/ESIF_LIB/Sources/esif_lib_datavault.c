@@ -54,6 +54,19 @@
 #define ESIFDV_ITEM_KEYS_REV0_SIGNATURE	0xA0D8	// [D8 A0] = DV 2.0 Key-Value Pair Item Signature (Revision 0)
 #define ESIFDV_ITEM_KEYS_REV1_SIGNATURE	0xA1D8	// [D8 A1] = Reserved for Future Expansion (Revision 1)
 
+// DataVault Journal Signatures and Version
+#define ESIFDV_JOURNAL_SIGNATURE		0x4AE5	// [E5 4A] = DataVault Journal Header Signature
+#define ESIFDV_JOURNAL_RECORD_SIGNATURE	0xA0DA	// [DA A0] = Journal Change Record Signature (Revision 0)
+#define ESIFDV_JOURNAL_VERSION			ESIFHDR_VERSION(1, 0, 0)
+
+// DataVault Decompressed Payload Cache Signature and Version
+#define ESIFDV_CACHE_SIGNATURE			0x43E5	// [E5 43] = Decompressed Payload Cache Header Signature
+#define ESIFDV_CACHE_VERSION			ESIFHDR_VERSION(1, 0, 0)
+
+// DataVault Journal Change Record Operations
+#define ESIFDV_JOURNAL_OP_SET			1		// Set Key/Value Pair
+#define ESIFDV_JOURNAL_OP_DELETE		2		// Delete Key
+
 // Default Version Number for new DV files
 #define ESIFDV_MAJOR_VERSION        2			// 1-99:    DV Header Major Version [2.1 can read 2.0-2.1 but not 3.0]
 #define ESIFDV_MINOR_VERSION        0			// 0-99:    DV Header Minor Version	[2.1 can write 2.1 but not 2.0]
@@ -111,6 +124,32 @@ typedef struct DataVaultHeaderV2_s {
 	UInt32	payload_class;					// Payload Class (default=KEYS)
 } DataVaultHeaderV2, *DataVaultHeaderV2Ptr;
 
+// DV Journal Header v1.0.0
+typedef struct DataVaultJournalHeader_s {
+	UInt16	signature;						// Journal Signature [E5 4A]
+	UInt16	headersize;						// Header Size, including signature & headersize
+	UInt32	version;						// Journal Format Version
+	UInt8	base_hash[SHA256_HASH_BYTES];	// Payload Hash of the Primary Repo this Journal applies to
+} DataVaultJournalHeader, *DataVaultJournalHeaderPtr;
+
+// DV Journal Change Record Header
+// Followed by the Record Body <flags><keylen><key...><type><datalen><data...> and a SHA-256 Hash of the Header and Body
+typedef struct DataVaultJournalRecord_s {
+	UInt16	signature;		// Record Signature [DA A0]
+	UInt16	operation;		// Change Operation (SET or DELETE)
+	UInt32	bodysize;		// Record Body Size
+} DataVaultJournalRecord, *DataVaultJournalRecordPtr;
+
+// DV Decompressed Payload Cache Header v1.0.0, followed by the Decompressed Payload
+typedef struct DataVaultCacheHeader_s {
+	UInt16	signature;						// Cache Signature [E5 43]
+	UInt16	headersize;						// Header Size, including signature & headersize
+	UInt32	version;						// Cache Format Version
+	UInt8	source_hash[SHA256_HASH_BYTES];	// Payload Hash of the Compressed Payload
+	UInt8	payload_hash[SHA256_HASH_BYTES];// SHA-256 Hash of the Decompressed Payload
+	UInt32	payload_size;					// Decompressed Payload Size
+} DataVaultCacheHeader, *DataVaultCacheHeaderPtr;
+
 // DV File Header Union (all versions)
 // DataVaultHeader typedef in esif_lib_datarepo.h for clang compliance
 union DataVaultHeader_u {
@@ -179,6 +218,13 @@ static Bool DataVault_IsPrimary(
 	DataVaultHeaderPtr header
 	);
 
+static void DataVault_JournalReset(
+	DataVaultPtr self,
+	UInt8 *baseHash
+	);
+
+static esif_error_t DataVault_JournalCompact(DataVaultPtr self);
+
 // Friend Class Static Members
 
 static esif_error_t DataRepo_ReadHeader(
@@ -218,6 +264,7 @@ static void DataVault_ctor(DataVaultPtr self)
 		self->stream = IOStream_Create();
 		self->version = ESIFHDR_VERSION(ESIFDV_MAJOR_VERSION, ESIFDV_MINOR_VERSION, ESIFDV_REVISION);
 		self->dataclass = ESIFDV_PAYLOAD_CLASS_KEYS;
+		self->journalMode = ESIFDV_JOURNAL_MODE;
 	}
 }
 
@@ -226,8 +273,23 @@ static void DataVault_ctor(DataVaultPtr self)
 static void DataVault_dtor(DataVaultPtr self)
 {
 	if (self) {
+		UInt32 idx = 0;
+
+		// Wait for any Background Compaction to finish, then fold any remaining Journal into the Primary Stream
+		if (esif_ccb_thread_id(&self->compactThread) != ESIF_THREAD_ID_NULL) {
+			esif_ccb_thread_join(&self->compactThread);
+		}
+		if (self->journalSize > 0) {
+			IGNORE_RESULT(DataVault_JournalCompact(self));
+		}
 		DataCache_Destroy(self->cache);
 		IOStream_Destroy(self->stream);
+
+		// Release Mapped Repos only after the Cache values that point into them are gone
+		for (idx = 0; idx < self->mappingCount; idx++) {
+			IOMapping_PutRef(self->mappings[idx]);
+		}
+		esif_ccb_free(self->mappings);
 		esif_ccb_lock_uninit(&self->lock);
 		WIPEPTR(self);
 	}
@@ -553,6 +615,11 @@ exit:
 	if (esif_ccb_file_exists(tempName)) {
 		IGNORE_RESULT(esif_ccb_unlink(tempName));
 	}
+
+	// The Primary Stream now contains every Journaled change, so bind any new Journal to it
+	if (rc == ESIF_OK) {
+		DataVault_JournalReset(self, (ESIFHDR_GET_MAJOR(header.common.version) == ESIFDV_V2 ? header.v2.payload_hash : NULL));
+	}
 	return rc;
 }
 
@@ -697,6 +764,412 @@ exit:
 	return rc;
 }
 
+// Build the Journal filename for the Primary Stream [name.dv.jnl]
+static Bool DataVault_GetJournalName(
+	DataVaultPtr self,
+	char *journalName,
+	size_t journalName_len
+)
+{
+	if (self->stream != NULL && self->stream->type == StreamFile && self->stream->file.name != NULL) {
+		esif_ccb_sprintf(journalName_len, journalName, "%s%s", self->stream->file.name, ESIFDV_JOURNALEXT);
+		return ESIF_TRUE;
+	}
+	return ESIF_FALSE;
+}
+
+// True if Persisted Key updates may be appended to the Journal instead of rewriting the Primary Stream
+static Bool DataVault_CanJournal(DataVaultPtr self)
+{
+	return (self->journalMode &&
+		self->baseSize > 0 &&
+		self->dataclass == ESIFDV_PAYLOAD_CLASS_KEYS &&
+		ESIFHDR_GET_MAJOR(self->version) == ESIFDV_V2 &&
+		!FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC | ESIF_SERVICE_CONFIG_READONLY) &&
+		self->stream != NULL &&
+		self->stream->type == StreamFile &&
+		self->stream->base.store == StoreReadWrite &&
+		self->stream->file.name != NULL &&
+		esif_ccb_file_exists(self->stream->file.name));
+}
+
+// Delete the Journal and bind future Journal Records to the Primary Stream with the given Payload Hash
+static void DataVault_JournalReset(
+	DataVaultPtr self,
+	UInt8 *baseHash
+	)
+{
+	char journalName[MAX_PATH] = { 0 };
+
+	if (DataVault_GetJournalName(self, journalName, sizeof(journalName)) && esif_ccb_file_exists(journalName)) {
+		IGNORE_RESULT(esif_ccb_unlink(journalName));
+	}
+	self->journalSize = 0;
+	self->baseSize = 0;
+	esif_ccb_memset(self->journalBase, 0, sizeof(self->journalBase));
+
+	if (baseHash != NULL && self->stream != NULL && self->stream->type == StreamFile && self->stream->file.name != NULL) {
+		esif_ccb_memcpy(self->journalBase, baseHash, sizeof(self->journalBase));
+		self->baseSize = IOStream_GetFileSize(self->stream->file.name);
+	}
+}
+
+// Append a SET or DELETE Change Record for the given Key to the Journal
+static esif_error_t DataVault_JournalAppend(
+	DataVaultPtr self,
+	esif_string key
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	char journalName[MAX_PATH] = { 0 };
+	DataCacheEntryPtr keyPair = NULL;
+	DataVaultJournalRecord record = { 0 };
+	esif_flags_t item_flags = 0;
+	UInt32 key_len = 0;
+	esif_data_type_t value_type = ESIF_DATA_VOID;
+	UInt32 value_len = 0;
+	UInt8 *value_ptr = NULL;
+	UInt8 *nocache_buffer = NULL;
+	BytePtr buffer = NULL;
+	size_t offset = 0;
+	IOStreamPtr journal = NULL;
+	esif_sha256_t digest = { 0 };
+	UInt32 byte = 0;
+
+	if (!DataVault_GetJournalName(self, journalName, sizeof(journalName))) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+	key_len = (UInt32)esif_ccb_strlen(key, ESIFDV_MAX_KEYLEN) + 1;
+	keyPair = DataCache_GetValue(self->cache, key);
+
+	// Persisted Keys are SET; Deleted Keys and Keys that are no longer Persisted are DELETEd
+	if (keyPair != NULL && FLAGS_TEST(keyPair->flags, ESIF_SERVICE_CONFIG_PERSIST)) {
+		record.operation = ESIFDV_JOURNAL_OP_SET;
+		item_flags = keyPair->flags;
+		value_type = keyPair->value.type;
+		value_len = keyPair->value.data_len;
+		value_ptr = (UInt8 *)keyPair->value.buf_ptr;
+
+		// Unmodified NOCACHE values are read from the Primary Stream
+		if (FLAGS_TEST(keyPair->flags, ESIF_SERVICE_CONFIG_NOCACHE) && keyPair->value.buf_len == 0) {
+			nocache_buffer = (UInt8 *)esif_ccb_malloc(esif_ccb_max(1, value_len));
+			if (nocache_buffer == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+				goto exit;
+			}
+			if (IOStream_LoadBlock(self->stream, nocache_buffer, value_len, (size_t)keyPair->value.buf_ptr) != EOK) {
+				rc = ESIF_E_IO_OPEN_FAILED;
+				goto exit;
+			}
+			value_ptr = nocache_buffer;
+		}
+	}
+	else {
+		record.operation = ESIFDV_JOURNAL_OP_DELETE;
+	}
+	record.signature = ESIFDV_JOURNAL_RECORD_SIGNATURE;
+	record.bodysize = (UInt32)(sizeof(item_flags) + sizeof(key_len) + key_len + sizeof(value_type) + sizeof(value_len) + value_len);
+
+	// Build the entire Record in memory so that it is appended with a single write
+	buffer = (BytePtr)esif_ccb_malloc(sizeof(record) + record.bodysize + SHA256_HASH_BYTES);
+	if (buffer == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	esif_ccb_memcpy(buffer + offset, &record, sizeof(record));
+	offset += sizeof(record);
+	esif_ccb_memcpy(buffer + offset, &item_flags, sizeof(item_flags));
+	offset += sizeof(item_flags);
+	esif_ccb_memcpy(buffer + offset, &key_len, sizeof(key_len));
+	offset += sizeof(key_len);
+	esif_ccb_memcpy(buffer + offset, key, key_len);
+	offset += key_len;
+	esif_ccb_memcpy(buffer + offset, &value_type, sizeof(value_type));
+	offset += sizeof(value_type);
+	esif_ccb_memcpy(buffer + offset, &value_len, sizeof(value_len));
+	offset += sizeof(value_len);
+
+	// Scramble Data?
+	if (value_len > 0) {
+		if (FLAGS_TEST(item_flags, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
+			for (byte = 0; byte < value_len; byte++)
+				buffer[offset + byte] = ~value_ptr[byte];
+		}
+		else {
+			esif_ccb_memcpy(buffer + offset, value_ptr, value_len);
+		}
+		offset += value_len;
+	}
+
+	esif_sha256_init(&digest);
+	esif_sha256_update(&digest, buffer, offset);
+	esif_sha256_finish(&digest);
+	esif_ccb_memcpy(buffer + offset, digest.hash, SHA256_HASH_BYTES);
+	offset += SHA256_HASH_BYTES;
+
+	// Start a new Journal bound to the current Primary Stream, or append to the existing one
+	journal = IOStream_Create();
+	if (journal == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	if (IOStream_OpenFile(journal, StoreReadWrite, journalName, (self->journalSize == 0 ? "wb" : "ab")) != EOK) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+	if (self->journalSize == 0) {
+		DataVaultJournalHeader header = { 0 };
+		header.signature = ESIFDV_JOURNAL_SIGNATURE;
+		header.headersize = (UInt16)sizeof(header);
+		header.version = ESIFDV_JOURNAL_VERSION;
+		esif_ccb_memcpy(header.base_hash, self->journalBase, sizeof(header.base_hash));
+
+		if (IOStream_Write(journal, &header, sizeof(header)) != sizeof(header)) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		self->journalSize = sizeof(header);
+	}
+	if (IOStream_Write(journal, buffer, offset) != offset) {
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+	self->journalSize += offset;
+
+exit:
+	IOStream_Destroy(journal);
+	esif_ccb_free(buffer);
+	esif_ccb_free(nocache_buffer);
+	return rc;
+}
+
+// Apply a validated Journal Change Record to the DataVault Cache
+static esif_error_t DataVault_JournalApply(
+	DataVaultPtr self,
+	DataVaultJournalRecordPtr record,
+	BytePtr body
+	)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+	size_t offset = 0;
+	esif_flags_t item_flags = 0;
+	UInt32 key_len = 0;
+	esif_string key = NULL;
+	EsifData value = { ESIF_DATA_VOID };
+	UInt32 byte = 0;
+
+	if (record->operation != ESIFDV_JOURNAL_OP_SET && record->operation != ESIFDV_JOURNAL_OP_DELETE) {
+		rc = ESIF_E_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	// Body = <flags><keylen><key...><type><datalen><data...>
+	if (record->bodysize < sizeof(item_flags) + sizeof(key_len)) {
+		goto exit;
+	}
+	esif_ccb_memcpy(&item_flags, body + offset, sizeof(item_flags));
+	offset += sizeof(item_flags);
+	esif_ccb_memcpy(&key_len, body + offset, sizeof(key_len));
+	offset += sizeof(key_len);
+
+	if (key_len <= 1 || key_len > ESIFDV_MAX_KEYLEN || record->bodysize - offset < key_len + sizeof(value.type) + sizeof(value.data_len)) {
+		goto exit;
+	}
+	key = (esif_string)(body + offset);
+	if (key[key_len - 1] != 0) {
+		goto exit;
+	}
+	offset += key_len;
+	esif_ccb_memcpy(&value.type, body + offset, sizeof(value.type));
+	offset += sizeof(value.type);
+	esif_ccb_memcpy(&value.data_len, body + offset, sizeof(value.data_len));
+	offset += sizeof(value.data_len);
+
+	if (value.data_len != record->bodysize - offset) {
+		goto exit;
+	}
+	value.buf_ptr = body + offset;
+	value.buf_len = esif_ccb_max(1, value.data_len);
+	FLAGS_CLEAR(item_flags, ESIFDV_IGNORED_ITEM_FLAGS);
+
+	//  Unscramble Data?
+	if (FLAGS_TEST(item_flags, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
+		for (byte = 0; byte < value.data_len; byte++)
+			((UInt8 *)value.buf_ptr)[byte] = ~((UInt8 *)value.buf_ptr)[byte];
+	}
+
+	// Replace or Delete the existing Key (the Cache makes its own copy of the value)
+	rc = ESIF_OK;
+	if (DataCache_GetValue(self->cache, key) != NULL) {
+		rc = DataCache_DeleteValue(self->cache, key);
+	}
+	if (rc == ESIF_OK && record->operation == ESIFDV_JOURNAL_OP_SET) {
+		rc = DataCache_InsertValue(self->cache, key, &value, item_flags);
+	}
+
+exit:
+	return rc;
+}
+
+// Replay the Journal into the DataVault Cache after loading the Primary Stream
+// Returns ESIF_E_IO_HASH_FAILED if a damaged or partially written Record was found
+static esif_error_t DataVault_JournalReplay(DataVaultPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+	char journalName[MAX_PATH] = { 0 };
+	IOStreamPtr journal = NULL;
+	DataVaultJournalHeader header = { 0 };
+	DataVaultJournalRecord record = { 0 };
+	BytePtr body = NULL;
+	esif_sha256_t digest = { 0 };
+	size_t bytes = 0;
+	UInt32 records = 0;
+
+	if (!DataVault_GetJournalName(self, journalName, sizeof(journalName)) || !esif_ccb_file_exists(journalName)) {
+		goto exit;
+	}
+	journal = IOStream_Create();
+	if (journal == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	if (IOStream_OpenFile(journal, StoreReadOnly, journalName, "rb") != EOK) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+
+	// Discard Journals that do not apply to the Primary Stream that was just loaded,
+	// such as when the Primary Stream was rewritten but the Journal could not be deleted
+	if (IOStream_Read(journal, &header, sizeof(header)) != sizeof(header) ||
+		header.signature != ESIFDV_JOURNAL_SIGNATURE ||
+		header.headersize != sizeof(header) ||
+		ESIFHDR_GET_MAJOR(header.version) != ESIFHDR_GET_MAJOR(ESIFDV_JOURNAL_VERSION) ||
+		memcmp(header.base_hash, self->journalBase, sizeof(header.base_hash)) != 0) {
+		ESIF_TRACE_INFO("Discarding stale DV Journal (%s)\n", self->name);
+		IOStream_Close(journal);
+		IGNORE_RESULT(esif_ccb_unlink(journalName));
+		goto exit;
+	}
+
+	// Apply each Record in order, stopping at the first one that fails validation
+	while (rc == ESIF_OK && (bytes = IOStream_Read(journal, &record, sizeof(record))) > 0) {
+		if (bytes != sizeof(record) || record.signature != ESIFDV_JOURNAL_RECORD_SIGNATURE || record.bodysize > ESIFDV_MAX_PAYLOAD) {
+			rc = ESIF_E_IO_HASH_FAILED;
+			break;
+		}
+		body = (BytePtr)esif_ccb_malloc((size_t)record.bodysize + SHA256_HASH_BYTES);
+		if (body == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			break;
+		}
+		if (IOStream_Read(journal, body, (size_t)record.bodysize + SHA256_HASH_BYTES) != (size_t)record.bodysize + SHA256_HASH_BYTES) {
+			rc = ESIF_E_IO_HASH_FAILED;
+			break;
+		}
+
+		esif_sha256_init(&digest);
+		esif_sha256_update(&digest, &record, sizeof(record));
+		esif_sha256_update(&digest, body, record.bodysize);
+		esif_sha256_finish(&digest);
+		if (memcmp(digest.hash, body + record.bodysize, SHA256_HASH_BYTES) != 0) {
+			rc = ESIF_E_IO_HASH_FAILED;
+			break;
+		}
+
+		rc = DataVault_JournalApply(self, &record, body);
+		esif_ccb_free(body);
+		body = NULL;
+		records++;
+	}
+	self->journalSize = IOStream_GetOffset(journal);
+	ESIF_TRACE_INFO("Replayed %u DV Journal records (%s): %s\n", records, self->name, esif_rc_str(rc));
+
+exit:
+	esif_ccb_free(body);
+	IOStream_Destroy(journal);
+	return rc;
+}
+
+// Compact the Journal by rewriting the Primary Stream, restoring NOCACHE Offsets on failure
+static esif_error_t DataVault_JournalCompact(DataVaultPtr self)
+{
+	esif_error_t rc = ESIF_E_NO_MEMORY;
+	DataCachePtr nocacheClone = DataCache_CloneOffsets(self->cache);
+
+	if (nocacheClone != NULL) {
+		rc = DataVault_RepoFlush(self, NULL, ESIF_FALSE);
+		if (rc != ESIF_OK) {
+			DataCache_RestoreOffsets(self->cache, nocacheClone);
+		}
+	}
+	DataCache_Destroy(nocacheClone);
+	return rc;
+}
+
+// Bind the Journal to a newly loaded Primary Stream and Replay it, compacting the Journal if it was damaged
+static void DataVault_JournalLoad(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header
+	)
+{
+	esif_error_t rc = ESIF_OK;
+
+	if (ESIFHDR_GET_MAJOR(header->common.version) == ESIFDV_V2 &&
+		self->stream != NULL &&
+		self->stream->type == StreamFile &&
+		self->stream->base.store == StoreReadWrite &&
+		self->stream->file.name != NULL) {
+
+		esif_ccb_memcpy(self->journalBase, header->v2.payload_hash, sizeof(self->journalBase));
+		self->baseSize = IOStream_GetFileSize(self->stream->file.name);
+
+		rc = DataVault_JournalReplay(self);
+		if (rc != ESIF_OK) {
+			ESIF_TRACE_WARN("Invalid DV Journal (%s): %s (%d)\n", self->name, esif_rc_str(rc), rc);
+			if (DataVault_JournalCompact(self) != ESIF_OK) {
+				self->journalMode = ESIF_FALSE;
+			}
+		}
+	}
+}
+
+// Background Journal Compaction Worker Thread
+static void *ESIF_CALLCONV DataVault_JournalCompactWorker(void *ctx)
+{
+	DataVaultPtr self = (DataVaultPtr)ctx;
+
+	esif_ccb_write_lock(&self->lock);
+	if (self->journalSize > 0) {
+		esif_error_t rc = DataVault_JournalCompact(self);
+		if (rc != ESIF_OK) {
+			ESIF_TRACE_WARN("DV Journal Compaction Failed (%s): %s (%d)\n", self->name, esif_rc_str(rc), rc);
+		}
+	}
+	esif_ccb_write_unlock(&self->lock);
+	atomic_set(&self->compacting, 0);
+	return 0;
+}
+
+// Start a Background Compaction once the Journal grows past a percentage of the Primary Stream size
+// Called with the DataVault Write Lock held; the Compaction Thread waits for it to be released
+static void DataVault_JournalCheckCompact(DataVaultPtr self)
+{
+	size_t threshold = esif_ccb_max(ESIFDV_JOURNAL_COMPACT_MIN, (self->baseSize / 100) * ESIFDV_JOURNAL_COMPACT_PCT);
+
+	if (self->journalSize > threshold && atomic_cmpxchg(&self->compacting, 0, 1) == 0) {
+		// Reap the previous Compaction Thread, which has already released the lock
+		if (esif_ccb_thread_id(&self->compactThread) != ESIF_THREAD_ID_NULL) {
+			esif_ccb_thread_join(&self->compactThread);
+			esif_ccb_thread_init(&self->compactThread);
+		}
+		if (esif_ccb_thread_create(&self->compactThread, DataVault_JournalCompactWorker, self) != ESIF_OK) {
+			esif_ccb_thread_init(&self->compactThread);
+			atomic_set(&self->compacting, 0);
+		}
+	}
+}
+
 // True if the optional segmentid in the Segment header matches the DataVault name
 static Bool DataVault_IsSegmentMatch(
 	DataVaultPtr self,
@@ -807,7 +1280,19 @@ static esif_error_t DataVault_ValidatePayload(
 
 			esif_sha256_init(&self->digest);
 
-			if (buffer == NULL) {
+			// Hash Memory and Mapped Payloads in place
+			if (IOStream_GetType(repo->stream) == StreamMemory && IOStream_GetMemoryBuffer(repo->stream) != NULL) {
+				esif_ccb_free(buffer);
+				buffer = NULL;
+				if (payload_size > IOStream_GetSize(repo->stream) - offset) {
+					rc = ESIF_E_IO_ERROR;
+				}
+				else {
+					esif_sha256_update(&self->digest, IOStream_GetMemoryBuffer(repo->stream) + offset, payload_size);
+					bytes_to_read = 0;
+				}
+			}
+			else if (buffer == NULL) {
 				rc = ESIF_E_NO_MEMORY;
 			}
 			else {
@@ -907,12 +1392,249 @@ static esif_error_t DataVault_ReadSegment(
 	return rc;
 }
 
+// Keep a File Mapping alive for as long as this DataVault's Cache may point into it
+static esif_error_t DataVault_RetainMapping(
+	DataVaultPtr self,
+	IOMappingPtr mapping
+	)
+{
+	IOMappingPtr *mappings = NULL;
+	UInt32 idx = 0;
+
+	if (mapping == NULL) {
+		return ESIF_OK;
+	}
+	for (idx = 0; idx < self->mappingCount; idx++) {
+		if (self->mappings[idx] == mapping) {
+			return ESIF_OK;
+		}
+	}
+	mappings = (IOMappingPtr *)esif_ccb_realloc(self->mappings, (self->mappingCount + 1) * sizeof(*mappings));
+	if (mappings == NULL) {
+		return ESIF_E_NO_MEMORY;
+	}
+	IOMapping_GetRef(mapping);
+	mappings[self->mappingCount++] = mapping;
+	self->mappings = mappings;
+	return ESIF_OK;
+}
+
+// Return whether a Static/Mapped (buf_len == 0) buffer points into one of this DataVault's Mapped Repos
+static Bool DataVault_IsMappedData(
+	DataVaultPtr self,
+	EsifDataPtr data
+	)
+{
+	UInt32 idx = 0;
+
+	if (data->buf_len == 0 && data->buf_ptr != NULL) {
+		for (idx = 0; idx < self->mappingCount; idx++) {
+			BytePtr buffer = self->mappings[idx]->buffer;
+			if ((BytePtr)data->buf_ptr >= buffer && (BytePtr)data->buf_ptr < buffer + self->mappings[idx]->size) {
+				return ESIF_TRUE;
+			}
+		}
+	}
+	return ESIF_FALSE;
+}
+
+// Replace a Mapped buffer with a private copy of its data
+static esif_error_t DataVault_DetachMappedData(EsifDataPtr data)
+{
+	u32 buf_len = esif_ccb_max(1, data->data_len);
+	void *buf_ptr = esif_ccb_malloc(buf_len);
+
+	if (buf_ptr == NULL) {
+		return ESIF_E_NO_MEMORY;
+	}
+	esif_ccb_memcpy(buf_ptr, data->buf_ptr, data->data_len);
+	data->buf_ptr = buf_ptr;
+	data->buf_len = buf_len;
+	return ESIF_OK;
+}
+
+// Release all Mapped Repos held by this DataVault, first copying any Cache keys or values that still point into them
+static esif_error_t DataVault_ReleaseMappings(DataVaultPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+	UInt32 idx = 0;
+
+	if (self->mappingCount == 0) {
+		return ESIF_OK;
+	}
+	for (idx = 0; rc == ESIF_OK && self->cache && idx < self->cache->size; idx++) {
+		DataCacheEntryPtr keyPair = &self->cache->elements[idx];
+
+		if (DataVault_IsMappedData(self, &keyPair->key)) {
+			rc = DataVault_DetachMappedData(&keyPair->key);
+		}
+		// NOCACHE values hold a File Offset rather than a pointer
+		if (rc == ESIF_OK && !FLAGS_TEST(keyPair->flags, ESIF_SERVICE_CONFIG_NOCACHE) && DataVault_IsMappedData(self, &keyPair->value)) {
+			rc = DataVault_DetachMappedData(&keyPair->value);
+		}
+	}
+
+	// Keep the Mappings if any value could not be detached, since the Cache still points into them
+	if (rc == ESIF_OK) {
+		for (idx = 0; idx < self->mappingCount; idx++) {
+			IOMapping_PutRef(self->mappings[idx]);
+		}
+		esif_ccb_free(self->mappings);
+		self->mappings = NULL;
+		self->mappingCount = 0;
+	}
+	return rc;
+}
+
+// Delete all Decompressed Payload Caches for the given DataVault [name-hash.dvc], except for an optional one to keep
+void DataVault_DeletePayloadCaches(
+	const char *name,
+	const char *keepName
+	)
+{
+	char cachePath[MAX_PATH] = { 0 };
+	char cachePattern[MAX_PATH] = { 0 };
+	char cacheName[MAX_PATH] = { 0 };
+	esif_ccb_file_enum_t findHandle = ESIF_INVALID_FILE_ENUM_HANDLE;
+	struct esif_ccb_file ffd = { 0 };
+
+	if (name == NULL || name[0] == 0) {
+		return;
+	}
+	esif_build_path(cachePath, sizeof(cachePath), ESIF_PATHTYPE_DV, NULL, NULL);
+	esif_ccb_sprintf(sizeof(cachePattern), cachePattern, "%s-????????????????%s", name, ESIFDV_CACHEEXT);
+
+	if ((findHandle = esif_ccb_file_enum_first(cachePath, cachePattern, &ffd)) != ESIF_INVALID_FILE_ENUM_HANDLE) {
+		do {
+			esif_build_path(cacheName, sizeof(cacheName), ESIF_PATHTYPE_DV, ffd.filename, NULL);
+			if (keepName == NULL || esif_ccb_stricmp(cacheName, (char *)keepName) != 0) {
+				if (esif_ccb_unlink(cacheName) == EOK) {
+					ESIF_TRACE_INFO("Deleted DV Payload Cache (%s): %s\n", name, cacheName);
+				}
+			}
+		} while (esif_ccb_file_enum_next(findHandle, cachePattern, &ffd));
+		esif_ccb_file_enum_close(findHandle);
+	}
+}
+
+// Build the Decompressed Payload Cache filename for a Compressed Payload [name-hash.dvc]
+static void DataVault_GetPayloadCacheName(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header,
+	char *cacheName,
+	size_t cacheName_len
+	)
+{
+	char hashstr[SHA256_STRING_BYTES] = { 0 };
+	char filename[MAX_PATH] = { 0 };
+
+	// Only the first 64 bits of the Hash are used in the filename; the full Hash is verified in the Cache Header
+	esif_hash_tostring(header->v2.payload_hash, sizeof(header->v2.payload_hash), hashstr, sizeof(hashstr));
+	esif_ccb_sprintf(sizeof(filename), filename, "%s-%.16s", self->name, hashstr);
+	esif_build_path(cacheName, cacheName_len, ESIF_PATHTYPE_DV, filename, ESIFDV_CACHEEXT);
+}
+
+// Open the Decompressed Payload Cache for a Compressed Payload, if it exists and is valid
+static IOStreamPtr DataVault_OpenPayloadCache(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header
+	)
+{
+	char cacheName[MAX_PATH] = { 0 };
+	IOStreamPtr cacheStream = NULL;
+	IOMappingPtr mapping = NULL;
+	DataVaultCacheHeader cacheHeader = { 0 };
+	esif_sha256_t digest = { 0 };
+	Bool valid = ESIF_FALSE;
+
+	if (self->name[0] == 0 || ESIFHDR_GET_MAJOR(header->common.version) != ESIFDV_V2) {
+		return NULL;
+	}
+	DataVault_GetPayloadCacheName(self, header, cacheName, sizeof(cacheName));
+
+	// Payload Caches are private to ESIF and only ever replaced by renaming, so they are safe to memory map
+	if ((mapping = IOMapping_Create(cacheName)) != NULL && mapping->size >= sizeof(cacheHeader)) {
+		esif_ccb_memcpy(&cacheHeader, mapping->buffer, sizeof(cacheHeader));
+
+		if (cacheHeader.signature == ESIFDV_CACHE_SIGNATURE &&
+			cacheHeader.headersize == sizeof(cacheHeader) &&
+			ESIFHDR_GET_MAJOR(cacheHeader.version) == ESIFHDR_GET_MAJOR(ESIFDV_CACHE_VERSION) &&
+			memcmp(cacheHeader.source_hash, header->v2.payload_hash, sizeof(cacheHeader.source_hash)) == 0 &&
+			(size_t)cacheHeader.payload_size == mapping->size - sizeof(cacheHeader)) {
+
+			esif_sha256_init(&digest);
+			esif_sha256_update(&digest, mapping->buffer + sizeof(cacheHeader), cacheHeader.payload_size);
+			esif_sha256_finish(&digest);
+			valid = (memcmp(digest.hash, cacheHeader.payload_hash, sizeof(cacheHeader.payload_hash)) == 0);
+		}
+		if (valid && (cacheStream = IOStream_Create()) != NULL) {
+			if (IOStream_SetMapping(cacheStream, mapping, sizeof(cacheHeader), cacheHeader.payload_size) != EOK) {
+				IOStream_Destroy(cacheStream);
+				cacheStream = NULL;
+			}
+		}
+	}
+	IOMapping_PutRef(mapping);
+	return cacheStream;
+}
+
+// Write a Decompressed Payload to the Payload Cache so later loads can map it directly
+static void DataVault_WritePayloadCache(
+	DataVaultPtr self,
+	DataVaultHeaderPtr header,
+	EsifDataPtr payload
+	)
+{
+	char cacheName[MAX_PATH] = { 0 };
+	char tempName[MAX_PATH] = { 0 };
+	IOStreamPtr cacheStream = NULL;
+	DataVaultCacheHeader cacheHeader = { 0 };
+	esif_sha256_t digest = { 0 };
+	Bool written = ESIF_FALSE;
+
+	if (self->name[0] == 0 || ESIFHDR_GET_MAJOR(header->common.version) != ESIFDV_V2 || payload->data_len == 0) {
+		return;
+	}
+	DataVault_GetPayloadCacheName(self, header, cacheName, sizeof(cacheName));
+	esif_ccb_sprintf(sizeof(tempName), tempName, "%s%s", cacheName, ESIFDV_TEMPEXT);
+
+	esif_sha256_init(&digest);
+	esif_sha256_update(&digest, payload->buf_ptr, payload->data_len);
+	esif_sha256_finish(&digest);
+
+	cacheHeader.signature = ESIFDV_CACHE_SIGNATURE;
+	cacheHeader.headersize = (UInt16)sizeof(cacheHeader);
+	cacheHeader.version = ESIFDV_CACHE_VERSION;
+	esif_ccb_memcpy(cacheHeader.source_hash, header->v2.payload_hash, sizeof(cacheHeader.source_hash));
+	esif_ccb_memcpy(cacheHeader.payload_hash, digest.hash, sizeof(cacheHeader.payload_hash));
+	cacheHeader.payload_size = payload->data_len;
+
+	// Write to a .tmp file and rename it so a partially written Cache is never mapped
+	if ((cacheStream = IOStream_Create()) != NULL && IOStream_OpenFile(cacheStream, StoreReadWrite, tempName, "wb") == EOK) {
+		written = (IOStream_Write(cacheStream, &cacheHeader, sizeof(cacheHeader)) == sizeof(cacheHeader) &&
+			IOStream_Write(cacheStream, payload->buf_ptr, payload->data_len) == payload->data_len);
+	}
+	IOStream_Destroy(cacheStream);
+
+	if (written && (!esif_ccb_file_exists(cacheName) || esif_ccb_unlink(cacheName) == EOK) && esif_ccb_rename(tempName, cacheName) == 0) {
+		ESIF_TRACE_INFO("Cached Decompressed DV Payload (%s): %s\n", self->name, cacheName);
+
+		// Caches for older Payloads can never match again, so remove them
+		DataVault_DeletePayloadCaches(self->name, cacheName);
+	}
+	if (esif_ccb_file_exists(tempName)) {
+		IGNORE_RESULT(esif_ccb_unlink(tempName));
+	}
+}
+
 // Import a (closed) IOStream into the given DataVault in ImportCopy mode, overwriting any existing keys
 esif_error_t DataVault_ImportStream(DataVaultPtr self)
 {
 	esif_error_t rc = ESIF_OK;
 	DataVaultHeader header = { 0 };
+	DataVaultHeader primaryHeader = { 0 };
 	DataRepo repo = { 0 };
+	IOStreamPtr mappedStream = NULL;
 	char filename[MAX_PATH] = { 0 };
 
 	esif_ccb_write_lock(&self->lock);
@@ -931,10 +1653,26 @@ esif_error_t DataVault_ImportStream(DataVaultPtr self)
 		goto exit;
 	}
 
+	// Read the Repo into a private Read-Only copy if possible so unscrambled values can reference it without copying
+	// each value. The Repo is not memory mapped since it may be overwritten in place by other tools.
+	// The DataVault Stream remains the file so that NOCACHE offsets and Journal operations are unaffected.
+	if ((mappedStream = IOStream_Create()) != NULL && IOStream_LoadFile(mappedStream, filename) == EOK && IOStream_Open(mappedStream) == EOK) {
+		IOStream_Close(self->stream);
+		repo.stream = mappedStream;
+	}
+
+	// Values from a previous import may still point into its Mapping; copy them so that Mapping can be released
+	if ((rc = DataVault_ReleaseMappings(self)) != ESIF_OK) {
+		goto exit;
+	}
+
 	// Copy only the first Segment from the Repo into this DataVault, ignoring Segment Name in Header
 	rc = DataRepo_ReadHeader(&repo, &header);
 	if (rc == ESIF_OK) {
 		rc = DataVault_ReadSegment(self, &repo, &header, ImportCopy);
+		if (rc == ESIF_OK) {
+			esif_ccb_memcpy(&primaryHeader, &header, sizeof(primaryHeader));
+		}
 
 		// Mark DataVault Stream as Read-Only if this Repo has more than one segment
 		if (rc == ESIF_OK) {
@@ -946,6 +1684,11 @@ esif_error_t DataVault_ImportStream(DataVaultPtr self)
 
 exit:
 	IOStream_Close(repo.stream);
+	IOStream_Close(self->stream);
+	IOStream_Destroy(mappedStream);
+	if (rc == ESIF_OK) {
+		DataVault_JournalLoad(self, &primaryHeader);
+	}
 	esif_ccb_write_unlock(&self->lock);
 	return rc;
 }
@@ -976,8 +1719,17 @@ static esif_error_t DataVault_ReadPayload(
 		payload_class = header->v2.payload_class;
 	}
 
+	// Use the Decompressed Payload Cache if the Payload is compressed and it was already decompressed
+	if (FLAGS_TEST(payload_flags, ESIF_SERVICE_CONFIG_COMPRESSED) && (uncompressed_stream = DataVault_OpenPayloadCache(self, header)) != NULL) {
+		if (IOStream_Seek(stream, payload_size, SEEK_CUR) != EOK) {
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		stream = uncompressed_stream;
+		payload_size = IOStream_GetSize(uncompressed_stream);
+	}
 	// Decompress Payload if it is compressed
-	if (FLAGS_TEST(payload_flags, ESIF_SERVICE_CONFIG_COMPRESSED)) {
+	else if (FLAGS_TEST(payload_flags, ESIF_SERVICE_CONFIG_COMPRESSED)) {
 		BytePtr payload_buffer = esif_ccb_malloc(payload_size);
 
 		if (payload_buffer == NULL) {
@@ -996,6 +1748,7 @@ static esif_error_t DataVault_ReadPayload(
 				payload_buffer = NULL; // Now owned by payload
 
 				if ((rc = EsifData_Decompress(payload)) == ESIF_OK) {
+					DataVault_WritePayloadCache(self, header, payload);
 					uncompressed_stream = IOStream_Create();
 					if (uncompressed_stream == NULL) {
 						rc = ESIF_E_NO_MEMORY;
@@ -1033,7 +1786,13 @@ static esif_error_t DataVault_ReadPayload(
 
 		esif_sha256_init(&self->digest);
 
-		// Read Key/Value Pair Payload into DataVault Cache
+		// Values read from a Mapped Repo point into the mapping, so keep it alive as long as this DataVault
+		if ((rc = DataVault_RetainMapping(self, IOStream_GetMapping(stream))) != ESIF_OK) {
+			goto exit;
+		}
+
+		// Read Key/Value Pair Payload into DataVault Cache, sorting it only once all pairs are loaded
+		DataCache_BeginBulkLoad(self->cache);
 		while (rc == ESIF_OK) {
 			EsifData_ctor(&key);
 			EsifData_ctor(&value);
@@ -1076,6 +1835,7 @@ static esif_error_t DataVault_ReadPayload(
 			EsifData_dtor(&key);
 			EsifData_dtor(&value);
 		}
+		DataCache_EndBulkLoad(self->cache);
 
 		// Re-Validate SHA256 Hash after loading Payload
 		// TODO: Cannot undo Cache changes if this fails unless DataVault Transaction support is added
@@ -1102,6 +1862,18 @@ static esif_error_t DataVault_ReadPayload(
 				if (stream->memory.offset + payload_size > stream->memory.buf_len) {
 					rc = ESIF_E_IO_ERROR;
 				}
+				// Share the Mapping with the nested Repo so its Segments are also served from it
+				else if (stream->memory.mapping != NULL) {
+					IOMappingPtr mapping = stream->memory.mapping;
+					size_t mapping_offset = (size_t)(stream->memory.buffer - mapping->buffer) + stream->memory.offset;
+
+					if (IOStream_SetMapping(repo->stream, mapping, mapping_offset, payload_size) != EOK) {
+						rc = ESIF_E_IO_ERROR;
+					}
+					else {
+						IOStream_Seek(stream, payload_size, SEEK_CUR);
+					}
+				}
 				else {
 					IOStream_SetMemory(
 						repo->stream,
@@ -1175,6 +1947,8 @@ static esif_error_t DataVault_ReadKeyValuePair(
 	size_t rewind_pos = 0;
 	UInt16 headerSignature = ESIFDV_HEADER_SIGNATURE;
 	esif_flags_t bannedFlags = 0;
+	Bool isStatic = ESIF_FALSE;
+	Bool isMapped = ESIF_FALSE;
 
 	ESIF_ASSERT(self != NULL);
 	ESIF_ASSERT(stream != NULL);
@@ -1257,15 +2031,19 @@ static esif_error_t DataVault_ReadKeyValuePair(
 		goto exit;
 	}
 
-	// Use Memory Pointers for Static DataVaults, otherwise allocate memory
-	if ((IOStream_GetType(stream) == StreamMemory) && FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC)) {
+	// Use Memory Pointers for Static DataVaults and Mapped Repos, otherwise allocate memory
+	isStatic = (IOStream_GetType(stream) == StreamMemory) && FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC);
+	isMapped = (IOStream_GetMapping(stream) != NULL);
+	if (isStatic || isMapped) {
 		keyPtr->buf_len = 0;
 		keyPtr->buf_ptr = IOStream_GetMemoryBuffer(stream) + IOStream_GetOffset(stream);
-		if (IOStream_Seek(stream, keyPtr->data_len, SEEK_CUR) != EOK) {
+		if (keyPtr->data_len > IOStream_GetSize(stream) - IOStream_GetOffset(stream) || IOStream_Seek(stream, keyPtr->data_len, SEEK_CUR) != EOK) {
 			rc = ESIF_E_IO_ERROR;
 			goto exit;
 		}
-		FLAGS_CLEAR(*flagsPtr, ESIF_SERVICE_CONFIG_NOCACHE); // ignore for Static DataVaults
+		if (isStatic) {
+			FLAGS_CLEAR(*flagsPtr, ESIF_SERVICE_CONFIG_NOCACHE); // ignore for Static DataVaults
+		}
 	}
 	else {
 		keyPtr->buf_len = esif_ccb_max(1, keyPtr->data_len);
@@ -1330,11 +2108,11 @@ static esif_error_t DataVault_ReadKeyValuePair(
 		valuePtr->buf_len = 0;	// buf_len == 0 so we don't release buffer as not allocated; data_len = original length
 	} 
 	else {
-		// Use static pointer for static data vaults (unless scrambled), otherwise make a dynamic copy
-		if ((IOStream_GetType(stream) == StreamMemory) && FLAGS_TEST(self->flags, ESIF_SERVICE_CONFIG_STATIC) && !FLAGS_TEST(*flagsPtr, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
+		// Use static pointer for static data vaults and mapped repos (unless scrambled), otherwise make a dynamic copy
+		if ((isStatic || isMapped) && !FLAGS_TEST(*flagsPtr, ESIF_SERVICE_CONFIG_SCRAMBLE)) {
 			valuePtr->buf_len = 0;	// static
 			valuePtr->buf_ptr = IOStream_GetMemoryBuffer(stream) + IOStream_GetOffset(stream);
-			if (valuePtr->buf_ptr == NULL || IOStream_Seek(stream, valuePtr->data_len, SEEK_CUR) != EOK) {
+			if (valuePtr->buf_ptr == NULL || valuePtr->data_len > IOStream_GetSize(stream) - IOStream_GetOffset(stream) || IOStream_Seek(stream, valuePtr->data_len, SEEK_CUR) != EOK) {
 				rc = ESIF_E_IO_ERROR;
 				goto exit;
 			}
@@ -1710,6 +2488,8 @@ esif_error_t DataVault_SetValue(
 	esif_error_t rc = ESIF_OK;
 	DataCacheEntryPtr keypair;
 	DataCachePtr nocacheClone = NULL;
+	esif_string journalKey = NULL;
+	Bool journaled = ESIF_FALSE;
 
 	if (!self)
 		return ESIF_E_PARAMETER_IS_NULL;
@@ -1809,6 +2589,7 @@ esif_error_t DataVault_SetValue(
 	}
 
 	// Get the Data Row or create it if it does not exist
+	journalKey = key;
 	keypair = DataCache_GetValue(self->cache, key);
 
 	if (keypair) {	// Match Found
@@ -1842,10 +2623,15 @@ esif_error_t DataVault_SetValue(
 				}
 			} 
 
-			// Replace the File Offset stored in buf_ptr with a copy of the data for updated NOCACHE values
-			if (FLAGS_TEST(keypair->flags, ESIF_SERVICE_CONFIG_NOCACHE) && keypair->value.buf_len == 0) {
+			// Replace the File Offset (NOCACHE) or Static/Mapped Pointer stored in buf_ptr with a private copy of the data
+			if (keypair->value.buf_len == 0) {
+				void *new_buf = esif_ccb_malloc(esif_ccb_max(1, value->data_len));
+				if (new_buf == NULL) {
+					rc = ESIF_E_NO_MEMORY;
+					goto exit;
+				}
 				keypair->value.buf_len = esif_ccb_max(1, value->data_len);
-				keypair->value.buf_ptr = esif_ccb_malloc(value->buf_len);
+				keypair->value.buf_ptr = new_buf;
 			}
 			keypair->flags = flags;
 			keypair->value.type     = value->type;
@@ -1880,7 +2666,16 @@ exit:
 	if (rc == ESIF_OK && FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_PERSIST)) {
 		if (nocacheClone) {
 			if (!FLAGS_TEST(flags, ESIF_SERVICE_CONFIG_DELAYWRITE)) {
-				rc = DataVault_RepoFlush(self, NULL, ESIF_FALSE);
+				// Append single Key changes to the Journal if possible, otherwise rewrite the Primary Stream
+				if (journalKey != NULL && DataVault_CanJournal(self)) {
+					journaled = (DataVault_JournalAppend(self, journalKey) == ESIF_OK);
+				}
+				if (journaled) {
+					DataVault_JournalCheckCompact(self);
+				}
+				else {
+					rc = DataVault_RepoFlush(self, NULL, ESIF_FALSE);
+				}
 			}
 
 			// Restore NOCACHE Offsets on Failure
@@ -2125,10 +2920,21 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 	DataVaultHeader header = { 0 };
 	DataVaultPtr DV = NULL;
 	char PrimaryDV[sizeof(DV->name)] = { 0 };
+	DataVaultHeader primaryHeader = { 0 };
+	DataRepo mappedRepo = { 0 };
+	DataRepoPtr reader = self;
 	int segments = 0;
 
 	if (self && self->stream) {
-		if (IOStream_Open(self->stream) != EOK) {
+		// Read File Repos into a private Read-Only copy if possible so unscrambled values can reference it without copying each value
+		if (self->stream->type == StreamFile && (mappedRepo.stream = IOStream_Create()) != NULL) {
+			if (IOStream_LoadFile(mappedRepo.stream, self->stream->file.name) == EOK) {
+				esif_ccb_strcpy(mappedRepo.name, self->name, sizeof(mappedRepo.name));
+				reader = &mappedRepo;
+			}
+		}
+
+		if (IOStream_Open(reader->stream) != EOK) {
 			rc = ESIF_E_IO_OPEN_FAILED;
 			goto exit;
 		}
@@ -2140,7 +2946,7 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 		esif_ccb_strcpy(segmentid, reponame, sizeof(segmentid));
 
 		// Keep Reading from Repo Stream until EOF or no more 
-		while ((rc = DataRepo_ReadHeader(self, &header)) == ESIF_OK) {
+		while ((rc = DataRepo_ReadHeader(reader, &header)) == ESIF_OK) {
 			UInt32 major_version = ESIFHDR_GET_MAJOR(header.common.version);
 
 			// Use previous segmentid if not defined in current header
@@ -2174,8 +2980,9 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 					importMode = ImportCopy;
 					DV->stream = self->stream;
 					DataRepo_GetName(self, PrimaryDV, sizeof(PrimaryDV));
+					esif_ccb_memcpy(&primaryHeader, &header, sizeof(primaryHeader));
 				}
-				rc = DataVault_ReadSegment(DV, self, &header, importMode);
+				rc = DataVault_ReadSegment(DV, reader, &header, importMode);
 				DV->stream = currentStream;
 
 				UInt32 keys = DataCache_GetCount(DV->cache);
@@ -2195,7 +3002,7 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 			}
 			segments++;
 		}
-		IOStream_Close(self->stream);
+		IOStream_Close(reader->stream);
 
 		if (rc == ESIF_E_ITERATION_DONE) {
 			rc = ESIF_OK;
@@ -2212,12 +3019,14 @@ esif_error_t DataRepo_LoadSegments(DataRepoPtr self)
 			if (segments > 1 && DV->stream->base.store == StoreReadWrite) {
 				DV->stream->base.store = StoreReadOnly;
 			}
+			DataVault_JournalLoad(DV, &primaryHeader);
 			esif_ccb_write_unlock(&DV->lock);
 			DataVault_PutRef(DV);
 		}
 	}
 
 exit:
+	IOStream_Destroy(mappedRepo.stream);
 	return rc;
 }
 
@@ -21,6 +21,7 @@
 #include "esif_lib_datacache.h"
 #include "esif_lib_iostream.h"
 #include "esif_sdk_sha.h"
+#include "esif_ccb_thread.h"
 
 /*
  * Data Vault 2.0 Repository Overview:
@@ -82,6 +83,19 @@
  *       but for DV 2.0, it will usually be an Embedded Repo so that any Data Segment(s)
  *       contained in the Repo can be compressed and the SHA256 hash will be computed
  *       for all segment(s) in the Payload.
+ *    K. When Journal Mode is enabled, updates to Persisted Keys in a DV 2.0 Primary Repo
+ *       are appended as checksummed change records to a Journal (dvname.dv.jnl) instead of
+ *       rewriting the entire Primary Repo. The Journal is bound to the Payload Hash of the
+ *       Primary Repo it applies to and is replayed when the Primary Repo is loaded. Once the
+ *       Journal grows past a ratio of the Primary Repo size, it is compacted in the background
+ *       by rewriting the Primary Repo in the normal format and deleting the Journal.
+ *    L. Repo files are read into a single private read-only copy, and uncompressed values that
+ *       are not scrambled are served directly from that copy until they are updated. Repo files
+ *       are not memory mapped, since a tool that truncates or overwrites one in place would make
+ *       reading the mapping fault. The copy stays alive as long as any DataVault holds values
+ *       that point into it. Compressed Payloads are decompressed once and cached in the DV folder
+ *       (name-hash.dvc), and later loads memory map the decompressed Payload directly. These
+ *       caches are private to ESIF and only replaced by renaming, so they must not be edited.
  */
 
 // DV Global Definitions
@@ -89,11 +103,20 @@
 #define ESIFDV_REPOEXT              ".dvx"		// Data Repo Extension [repo.dvx]
 #define ESIFDV_TEMPEXT              ".tmp"		// Temp Repo File Extension [name.dv.tmp or repo.dvx.tmp]
 #define ESIFDV_ROLLBACKEXT          ".temp"		// Rollback File Extension [name.dv.temp or repo.dvx.temp]
+#define ESIFDV_JOURNALEXT           ".jnl"		// Journal File Extension [name.dv.jnl]
+#define ESIFDV_CACHEEXT             ".dvc"		// Decompressed Payload Cache Extension [name-hash.dvc]
 #define ESIFDV_TEMP_PREFIX          "$$"		// Temp DV Name Prefix [i.e., $$name.dv]
 #define ESIFDV_EXPORT_PREFIX        "$"			// Exported Repository DV Name Prefix [i.e., $name.dv]
 #define ESIFDV_NAME_LEN				32			// Max DataVault Name (Cache Name) Length (not including NUL)
 #define ESIFDV_DESC_LEN				64			// Max DataVault Description Length (not including NUL)
 
+// DataVault Journal Mode Defaults
+#ifndef ESIFDV_JOURNAL_MODE
+#define ESIFDV_JOURNAL_MODE			ESIF_TRUE	// Journal Persisted Key updates by default
+#endif
+#define ESIFDV_JOURNAL_COMPACT_MIN	(16 * 1024)	// Never compact Journals smaller than this
+#define ESIFDV_JOURNAL_COMPACT_PCT	100			// Compact when Journal exceeds this percentage of the Primary Repo size
+
 // Supported Data Vault Payload Classes
 #define ESIFDV_PAYLOAD_CLASS_NULL	0			// Undefined Payload Class
 #define ESIFDV_PAYLOAD_CLASS_KEYS	'SYEK'		// "KEYS" = DataVault 2.0 Key/Value Pair List
@@ -114,6 +137,14 @@ typedef struct DataVault_s {
 	IOStreamPtr				stream;							// Primary Stream (Cached Key/Values) ["name.dv"]
 	UInt32					dataclass;						// Payload Data Class (KEYS, REPO, ...)
 	esif_sha256_t			digest;							// SHA-256 Hash used to verify Payload
+	Bool					journalMode;					// Append Persisted Key updates to Journal instead of rewriting Primary Stream
+	UInt8					journalBase[SHA256_HASH_BYTES];	// Payload Hash of the Primary Stream the Journal applies to
+	size_t					journalSize;					// Current Journal File Size (0 = No Journal)
+	size_t					baseSize;						// Primary Stream File Size when last Loaded or Flushed
+	atomic_t				compacting;						// Background Journal Compaction in progress
+	esif_thread_t			compactThread;					// Background Journal Compaction Thread
+	IOMappingPtr			*mappings;						// Mapped Repos that Cached values point into
+	UInt32					mappingCount;					// Number of Mapped Repos
 } DataVault, *DataVaultPtr;
 
 #ifdef __cplusplus
@@ -137,6 +168,7 @@ esif_error_t DataVault_SetValue(DataVaultPtr self, esif_string key, EsifDataPtr
 esif_error_t DataVault_SetPayload(DataVaultPtr self, UInt32 payload_class, IOStreamPtr payload, Bool compressPayload);
 void DataVault_SetDefaultComment(DataVaultPtr self);
 esif_error_t DataVault_ImportStream(DataVaultPtr self);
+void DataVault_DeletePayloadCaches(const char *name, const char *keepName);
 
 #ifdef __cplusplus
 }
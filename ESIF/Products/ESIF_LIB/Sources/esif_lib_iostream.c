@@ -63,7 +63,10 @@ void IOStream_dtor(IOStreamPtr self)
 			break;
 
 		case StreamMemory:
-			if (self->memory.store != StoreStatic) {
+			if (self->memory.mapping) {
+				IOMapping_PutRef(self->memory.mapping);
+			}
+			else if (self->memory.store != StoreStatic) {
 				esif_ccb_free(self->memory.buffer);
 			}
 			break;
@@ -96,6 +99,80 @@ void IOStream_Destroy(IOStreamPtr self)
 }
 
 
+// Map a File into memory for Read-Only access. The Mapping is released with the last Reference.
+// Reading the Mapping faults (SIGBUS) if the File is truncated while mapped, so only map Files that are
+// never modified in place, such as private files that are only ever replaced by renaming a new file over them.
+IOMappingPtr IOMapping_Create(StringPtr filename)
+{
+	IOMappingPtr self = NULL;
+	size_t size = 0;
+	void *buffer = NULL;
+
+	if (filename && (buffer = esif_ccb_mmap_readonly(filename, &size)) != NULL) {
+		self = (IOMappingPtr)esif_ccb_malloc(sizeof(*self));
+		if (self == NULL) {
+			esif_ccb_munmap(buffer, size);
+		}
+		else {
+			atomic_set(&self->refCount, 1);
+			self->buffer = (BytePtr)buffer;
+			self->size = size;
+			self->isCopy = ESIF_FALSE;
+		}
+	}
+	return self;
+}
+
+// Load a private copy of a File into memory for Read-Only access. The copy is released with the last Reference.
+// Unlike a Mapping, the copy is unaffected if the File is later truncated or overwritten in place.
+IOMappingPtr IOMapping_Load(StringPtr filename)
+{
+	IOMappingPtr self = NULL;
+	IOStreamPtr file = NULL;
+	BytePtr buffer = NULL;
+	size_t size = 0;
+
+	if (filename && (file = IOStream_Create()) != NULL && IOStream_OpenFile(file, StoreReadOnly, filename, "rb") == EOK) {
+		size = IOStream_GetSize(file);
+		if (size > 0 && (buffer = (BytePtr)esif_ccb_malloc(size)) != NULL && IOStream_Read(file, buffer, size) == size) {
+			self = (IOMappingPtr)esif_ccb_malloc(sizeof(*self));
+			if (self != NULL) {
+				atomic_set(&self->refCount, 1);
+				self->buffer = buffer;
+				self->size = size;
+				self->isCopy = ESIF_TRUE;
+				buffer = NULL;
+			}
+		}
+		IOStream_Close(file);
+	}
+	esif_ccb_free(buffer);
+	IOStream_Destroy(file);
+	return self;
+}
+
+// Take a Reference
+void IOMapping_GetRef(IOMappingPtr self)
+{
+	if (self) {
+		atomic_inc(&self->refCount);
+	}
+}
+
+// Release a Reference, unmapping the File after the final Reference
+void IOMapping_PutRef(IOMappingPtr self)
+{
+	if (self && atomic_dec(&self->refCount) < 1) {
+		if (self->isCopy) {
+			esif_ccb_free(self->buffer);
+		}
+		else {
+			esif_ccb_munmap(self->buffer, self->size);
+		}
+		esif_ccb_free(self);
+	}
+}
+
 // methods
 
 // Set IOStream to use a Static or Dynamic File (do not open)
@@ -179,6 +256,50 @@ int IOStream_SetMemory(
 	return rc;
 }
 
+// Set IOStream to use a Read-Only window into a File Mapping, taking a Reference to it
+int IOStream_SetMapping(
+	IOStreamPtr self,
+	IOMappingPtr mapping,
+	size_t offset,
+	size_t size
+)
+{
+	if (NULL == self || NULL == mapping || offset > mapping->size || size > mapping->size - offset) {
+		return EINVAL;
+	}
+
+	// Take the Reference first in case the Mapping is currently owned by this stream
+	IOMapping_GetRef(mapping);
+	IOStream_dtor(self);
+
+	self->type = StreamMemory;
+	self->memory.store = StoreReadOnly;
+	self->memory.buffer = mapping->buffer + offset;
+	self->memory.buf_len = size;
+	self->memory.data_len = size;
+	self->memory.offset = 0;
+	self->memory.mapping = mapping;
+	return EOK;
+}
+
+// Set IOStream to a Read-Only private copy of an entire File
+int IOStream_LoadFile(
+	IOStreamPtr self,
+	StringPtr filename
+)
+{
+	int rc = EINVAL;
+	if (self && filename) {
+		IOMappingPtr mapping = IOMapping_Load(filename);
+		rc = EIO;
+		if (mapping) {
+			rc = IOStream_SetMapping(self, mapping, 0, mapping->size);
+			IOMapping_PutRef(mapping);
+		}
+	}
+	return rc;
+}
+
 // Set IOStream to use a File and open it
 int IOStream_OpenFile(
 	IOStreamPtr self,
@@ -618,6 +739,16 @@ BytePtr IOStream_GetMemoryBuffer(IOStreamPtr self)
 }
 
 
+// Return the File Mapping of a Mapped Memory IOStream (or NULL if not Mapped)
+IOMappingPtr IOStream_GetMapping(IOStreamPtr self)
+{
+	if (self && self->type == StreamMemory) {
+		return self->memory.mapping;
+	}
+	return NULL;
+}
+
+
 // Helper Function: Get the size of the given File
 size_t IOStream_GetFileSize(StringPtr filename)
 {
@@ -19,6 +19,7 @@
 #define _IOSTREAM_H_
 
 #include "esif_lib.h"
+#include "esif_ccb_atomic.h"
 #include "esif_lib_istringlist.h"
 
 #include <stdio.h>
@@ -46,6 +47,15 @@ typedef enum store_type {
 	StoreReadWrite,	// Stream is Read/Write
 } StoreType;
 
+// Read-Only File Mapping shared by Memory Streams and any objects that hold pointers into it.
+// The contents are either a memory mapping of the File or a private copy of it loaded into the heap.
+typedef struct IOMapping_s {
+	atomic_t	refCount;	// Reference Count
+	BytePtr		buffer;		// Mapped File Contents
+	size_t		size;		// Mapped File Size
+	Bool		isCopy;		// Buffer is a private heap copy rather than a memory mapping
+} IOMapping, *IOMappingPtr;
+
 #ifdef _IOSTREAM_CLASS
 
 union IOStream_s {
@@ -71,6 +81,7 @@ union IOStream_s {
 		size_t      buf_len;	// Buffer Size if Dynamically Allocated
 		size_t      data_len;	// Buffer Data Length
 		size_t      offset;		// Current Offset from Buffer Pointer
+		IOMappingPtr mapping;	// File Mapping that Buffer points into, if any
 	} memory;
 };
 
@@ -86,10 +97,18 @@ void IOStream_dtor(IOStreamPtr self);	// destructor
 IOStreamPtr IOStream_Create();			// new operator
 void IOStream_Destroy(IOStreamPtr self);// delete operator
 
+// File Mappings
+IOMappingPtr IOMapping_Create(StringPtr filename);
+IOMappingPtr IOMapping_Load(StringPtr filename);
+void IOMapping_GetRef(IOMappingPtr self);
+void IOMapping_PutRef(IOMappingPtr self);
+
 // methods
 // Open/Close File or Memory Buffer
 int IOStream_SetFile(IOStreamPtr self, StoreType store, StringPtr filename, StringPtr mode);
 int IOStream_SetMemory(IOStreamPtr self, StoreType store, BytePtr buffer, size_t size);
+int IOStream_SetMapping(IOStreamPtr self, IOMappingPtr mapping, size_t offset, size_t size);
+int IOStream_LoadFile(IOStreamPtr self, StringPtr filename);
 int IOStream_OpenFile(IOStreamPtr self, StoreType store, StringPtr filename, StringPtr mode);
 int IOStream_Open(IOStreamPtr self);	// fopen equivalent
 int IOStream_Close(IOStreamPtr self);	// fclose equivalent
@@ -109,6 +128,7 @@ StreamType IOStream_GetType(IOStreamPtr self);
 StoreType IOStream_GetStore(IOStreamPtr self);
 size_t IOStream_GetSize(IOStreamPtr self);
 BytePtr IOStream_GetMemoryBuffer(IOStreamPtr self);
+IOMappingPtr IOStream_GetMapping(IOStreamPtr self);
 size_t IOStream_GetFileSize(StringPtr filename);	// static member
 
 #ifdef __cplusplus
@@ -79,6 +79,7 @@ LOCAL_SRC_FILES += ESIF_CM/Sources/esif_ipc.c
 LOCAL_SRC_FILES += ../../Common/esif_link_list.c
 LOCAL_SRC_FILES += ../../Common/esif_ccb_timer.c
 LOCAL_SRC_FILES += ../../Common/esif_queue.c
+LOCAL_SRC_FILES += ../../Common/esif_ring.c
 LOCAL_SRC_FILES += ../../Common/esif_sdk_base64_dec.c
 
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf.c
@@ -101,10 +102,13 @@ LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_event_cache.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_eventmgr.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_handlemgr.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_ipc.c
+LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_logconvert.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_loggingmgr.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_participant.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_pm.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_primitive.c
+LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_primstats.c
+LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_sampler.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_sensors.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_service.c
 LOCAL_SRC_FILES += ESIF_UF/Sources/esif_uf_shell.c
@@ -33,6 +33,8 @@
 #include "esif_uf_handlemgr.h"
 #include "esif_uf_upsm.h"
 #include "esif_uf_arbmgr.h"
+#include "esif_uf_sampler.h"
+#include "esif_uf_primstats.h"
 
 /* Init */
 #include "esif_dsp.h"		/* Device Support Package */
@@ -85,7 +87,6 @@ extern int EsifUfTraceMessageArgs(
 #define native_realloc(ptr, siz)    realloc(ptr, siz)
 #define native_free(ptr)            free(ptr)
 
-int g_errorlevel = 0;			// Exit Errorlevel
 int g_quit		 = ESIF_FALSE;	// Quit
 int g_disconnectClient = ESIF_FALSE;// Disconnect client
 
@@ -784,6 +785,38 @@ static char *ESIF_CALLCONV EsifWsShellExec(char *cmd, size_t cmd_len, char *pref
 	return result;
 }
 
+// Create an isolated Shell Execution Context so that Shell Commands may be executed concurrently
+static void *ESIF_CALLCONV EsifWsShellCtxCreate(void)
+{
+	return esif_shell_ctx_create();
+}
+
+static void ESIF_CALLCONV EsifWsShellCtxDestroy(void *ctx)
+{
+	esif_shell_ctx_destroy((EsifShellCtxPtr)ctx);
+}
+
+// Execute a Shell Command in a Shell Execution Context and return a buffer allocated by EsifWebAlloc or NULL
+// The reply is owned by the context, so it may be copied without holding the Shell lock
+static char *ESIF_CALLCONV EsifWsShellCtxExec(void *ctx, char *cmd, size_t cmd_len, char *prefix, size_t prefix_len)
+{
+	char *result = NULL;
+	if (ctx && cmd && cmd_len > 0) {
+		char *reply = esif_shell_ctx_exec_command((EsifShellCtxPtr)ctx, cmd, cmd_len, ESIF_TRUE);
+		if (reply) {
+			size_t reply_len = esif_ccb_strlen(reply, WS_MAX_REST_RESPONSE);
+			size_t result_len = prefix_len + reply_len + 1;
+			result = EsifWebAlloc(result_len);
+
+			if (result) {
+				esif_ccb_strncpy(result, (prefix ? prefix : ""), prefix_len + 1);
+				esif_ccb_strcat(result, reply, result_len);
+			}
+		}
+	}
+	return result;
+}
+
 static int ESIF_CALLCONV EsifWsTraceMessage(
 	int level,
 	const char *func,
@@ -868,6 +901,9 @@ eEsifError EsifWebLoad()
 				self->fInterface.tEsifWsShellExecFuncPtr = EsifWsShellExec;
 				self->fInterface.tEsifWsTraceMessageFuncPtr = EsifWsTraceMessage;
 				self->fInterface.tEsifWsConsoleMessageFuncPtr = EsifWsConsoleMessage;
+				self->fInterface.tEsifWsShellCtxCreateFuncPtr = EsifWsShellCtxCreate;
+				self->fInterface.tEsifWsShellCtxDestroyFuncPtr = EsifWsShellCtxDestroy;
+				self->fInterface.tEsifWsShellCtxExecFuncPtr = EsifWsShellCtxExec;
 
 				rc = ifaceFuncPtr(&self->fInterface);
 			}
@@ -1099,6 +1135,8 @@ EsifInitTableEntry g_esifUfInitTable[] = {
 	{ EsifHandleMgr_Init,				EsifHandleMgr_Exit,					ESIF_INIT_FLAG_NONE },
 	{ EsifCfgMgrInit,					EsifCfgMgrExit,						ESIF_INIT_FLAG_NONE },
 	{ EsifEventMgr_Init,				EsifEventMgr_Exit,					ESIF_INIT_FLAG_NONE },
+	{ EsifSampler_Init,					EsifSampler_Exit,					ESIF_INIT_FLAG_NONE },
+	{ EsifPrimStats_Init,				EsifPrimStats_Exit,					ESIF_INIT_FLAG_NONE },
 	{ EsifDspMgrInit,					EsifDspMgrExit,						ESIF_INIT_FLAG_IGNORE_ERROR | ESIF_INIT_FLAG_CHECK_STOP_AFTER },
 	{ EsifActMgrInit,					EsifActMgrExit,						ESIF_INIT_FLAG_NONE },
 	{ EsifAppMgr_Init,					EsifAppMgr_Exit,					ESIF_INIT_FLAG_NONE },
@@ -102,8 +102,9 @@ extern int EsifConsole_WriteLogFile(const char *format, va_list args);
 // Write to optional shell log only
 #define CMD_LOGFILE(format, ...)	EsifConsole_WriteTo(CMD_WRITETO_LOGFILE, format, ##__VA_ARGS__)
 
-extern  char  *g_outbuf;					// Dynamically created and can grow
-extern  UInt32 g_outbuf_len;				// Current (or Default) Size of ESIF Shell Output Buffer
+// ESIF Shell Output Buffer of the Shell Execution Context bound to the current thread
+#define g_outbuf			(esif_shell_ctx()->outbuf)		// Dynamically created and can grow
+#define g_outbuf_len		(esif_shell_ctx()->outbuf_len)	// Current (or Default) Size of ESIF Shell Output Buffer
 #define OUT_BUF_LEN			g_outbuf_len	// Alias for backwards compatibility
 #define OUT_BUF_LEN_DEFAULT	(64 * 1024)		// Default size for ESIF Shell Output Buffer
 
@@ -141,7 +142,26 @@ enum output_format {
 	FORMAT_XML		// XML
 };
 
-extern enum output_format g_format;
+//
+// Shell Execution Context
+// Holds the per-command state of the ESIF Shell so that commands executed in
+// different contexts do not share output buffers or output format. A context
+// is bound to the calling thread while executing; threads with no bound context
+// use the default context of the interactive shell.
+//
+typedef struct EsifShellCtx_s {
+	char					*outbuf;		// Output Buffer; Dynamically created and can grow
+	UInt32					outbuf_len;		// Current (or Default) Size of Output Buffer
+	enum output_format		format;			// Output Format
+	UInt8					isRest;			// Executing a REST API Command?
+	size_t					cmdlen;			// Length of Current Command Line
+	int						errorlevel;		// Errorlevel of the Last Command
+} EsifShellCtx, *EsifShellCtxPtr;
+
+EsifShellCtxPtr esif_shell_ctx(void);
+
+#define g_format	(esif_shell_ctx()->format)	// Output Format of the current Shell Execution Context
+#define g_errorlevel	(esif_shell_ctx()->errorlevel)	// Errorlevel of the current Shell Execution Context
 
 #define MAX_LINE 256
 
@@ -1006,7 +1006,7 @@ eEsifError EsifActMgrInit()
 		goto exit;
 	}
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER_COMPLETE,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER_COMPLETE,
 		EVENT_MGR_MATCH_ANY,
 		EVENT_MGR_DOMAIN_D0,
 		EsifActMgr_EventCallback,
@@ -125,10 +125,20 @@ static AppParticipantDataMapPtr EsifApp_FindEmptyDataMap(
 	const EsifAppPtr self
 	);
 
+static AppParticipantDataMapPtr EsifApp_GetParticipantDataMapByIndex(
+	const EsifAppPtr self,
+	const size_t index
+	);
+
 static void EsifApp_WaitForAccessCompletion(EsifAppPtr self);
 
 static void EsifApp_ClearParticipantDataMap(AppParticipantDataMapPtr participantDataMapPtr);
 
+static void EsifApp_UnbindParticipantPrimitives(
+	EsifAppPtr self,
+	const esif_handle_t participantId
+	);
+
 static void EsifApp_StripInvalid(EsifString buffer, size_t buf_len)
 {
 	const EsifString banned = "\r\n\t,|";
@@ -153,8 +163,6 @@ eEsifError EsifApp_Create(
 {
 	eEsifError rc = ESIF_OK;
 	EsifAppPtr self = NULL;
-	size_t i = 0;
-	size_t j = 0;
 
 	if ((NULL == appName) || (NULL == appPtr)) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
@@ -176,6 +184,7 @@ eEsifError EsifApp_Create(
 
 	esif_ccb_event_init(&self->deleteEvent);
 	esif_ccb_lock_init(&self->objLock);
+	esif_ccb_lock_init(&self->fPrimitiveBindingLock);
 	self->refCount = 1;
 
 	self->fAppNamePtr = (esif_string)esif_ccb_malloc(appNameLen + 1);
@@ -188,12 +197,6 @@ eEsifError EsifApp_Create(
 	EsifApp_StripInvalid(self->fAppNamePtr, appNameLen + 1);
 	self->isRestartable = (esif_ccb_stricmp(self->fAppNamePtr, self->fLibNamePtr) == 0);
 
-	for (i = 0; i < (sizeof(self->fParticipantData) / sizeof(*self->fParticipantData)); i++) {
-		self->fParticipantData[i].fAppParticipantHandle = ESIF_INVALID_HANDLE;
-		for (j = 0; j < (sizeof(self->fParticipantData[i].fDomainData) / sizeof(*self->fParticipantData[i].fDomainData)); j++) {
-			self->fParticipantData[i].fDomainData[j].fAppDomainHandle = ESIF_INVALID_HANDLE;
-		}
-	}
 	*appPtr = self;
 exit:
 	if (rc != ESIF_OK) {
@@ -207,6 +210,8 @@ void EsifApp_Destroy(
 	EsifAppPtr self
 	)
 {
+	size_t block = 0;
+
 	if (NULL == self) {
 		goto exit;
 	}
@@ -229,6 +234,14 @@ void EsifApp_Destroy(
 	esif_ccb_library_unload(self->fLibHandle);
 	esif_ccb_free(self->fAppNamePtr);
 	esif_ccb_free(self->fLibNamePtr);
+	for (block = 0; block < ESIF_APP_PART_DATA_MAX_BLOCKS; block++) {
+		esif_ccb_free(self->fParticipantData[block]);
+		self->fParticipantData[block] = NULL;
+	}
+	esif_ccb_free(self->fPrimitiveBindings);
+	self->fPrimitiveBindings = NULL;
+	self->fPrimitiveBindingSize = 0;
+	esif_ccb_lock_uninit(&self->fPrimitiveBindingLock);
 	self->isRestartable = ESIF_FALSE;
 	esif_ccb_event_uninit(&self->deleteEvent);
 	esif_ccb_lock_uninit(&self->objLock);
@@ -390,14 +403,21 @@ static eEsifError EsifApp_CreateApp(
 
 	/* GetApplicationInterfaceV2 Handleshake send ESIF receive APP Interface */
 	rc = ifaceFuncPtr(&appIfaceSet);
+
+	/* Fall back to the Version 4 interface set for older applications */
+	if (ESIF_E_NOT_SUPPORTED == rc) {
+		esif_ccb_memset(&appIfaceSet, 0, sizeof(appIfaceSet));
+		appIfaceSet.hdr.fIfaceType    = eIfaceTypeApplication;
+		appIfaceSet.hdr.fIfaceVersion = APP_INTERFACE_VERSION_4;
+		appIfaceSet.hdr.fIfaceSize    = APP_INTERFACE_SET_SIZE_V4;
+		rc = ifaceFuncPtr(&appIfaceSet);
+	}
 	if (ESIF_OK != rc) {
 		goto exit;
 	}
 
 	/* Check EsifAppInterface */
-	if (appIfaceSet.hdr.fIfaceType != eIfaceTypeApplication ||
-		appIfaceSet.hdr.fIfaceSize != (UInt16)sizeof(appIfaceSet) ||
-		appIfaceSet.hdr.fIfaceVersion != APP_INTERFACE_VERSION) {
+	if (!APP_INTERFACE_SET_IS_SUPPORTED(&appIfaceSet.hdr)) {
 		rc = ESIF_E_NOT_SUPPORTED;
 		goto exit;
 	}
@@ -501,6 +521,13 @@ static eEsifError EsifApp_CreateApp(
 	/* Version 3 */
 	appIfaceSet.esifIface.fSendCommandFuncPtr = EsifSvcCommandReceive;
 
+	/* Version 5 */
+	if (appIfaceSet.hdr.fIfaceVersion >= APP_INTERFACE_VERSION_5) {
+		appIfaceSet.esifIface.fPrimitiveBindFuncPtr = EsifSvcPrimitiveBind;
+		appIfaceSet.esifIface.fPrimitiveBoundFuncPtr = EsifSvcPrimitiveExecBound;
+		appIfaceSet.esifIface.fPrimitiveUnbindFuncPtr = EsifSvcPrimitiveUnbind;
+	}
+
 	// Create the application 
 	rc = self->fInterface.fAppCreateFuncPtr(&appIfaceSet,
 											  esifHandle,
@@ -939,6 +966,8 @@ eEsifError EsifApp_DestroyParticipant(
 exit:
 	if (self != NULL) {
 		if ((participant_data_map_ptr != NULL) && isValid) {
+			EsifApp_UnbindParticipantPrimitives(self, participant_data_map_ptr->fAppParticipantHandle);
+
 			/* release reference on participant since we get reference on it in EsifApp_CreateParticipant */
 			EsifUp_PutRef(participant_data_map_ptr->fUpPtr);
 			EsifApp_ClearParticipantDataMap(participant_data_map_ptr);
@@ -1212,15 +1241,16 @@ static void EsifApp_WaitForAccessCompletion(EsifAppPtr self)
 static eEsifError EsifApp_DestroyParticipants(EsifAppPtr self)
 {
 	AppParticipantDataMapPtr participantDataMapPtr = NULL;
-	int i = 0;
+	size_t i = 0;
 
 	ESIF_ASSERT(self != NULL);
 
-	participantDataMapPtr = self->fParticipantData;
-
-	for (i = 0; i < (sizeof(self->fParticipantData) / sizeof(*self->fParticipantData)); i++, participantDataMapPtr++)
+	for (i = 0; i < (ESIF_APP_PART_DATA_MAX_BLOCKS * ESIF_APP_PART_DATA_BLOCK_SIZE); i++)
 	{
-		EsifApp_DestroyParticipant(self, participantDataMapPtr->fUpPtr);
+		participantDataMapPtr = EsifApp_GetParticipantDataMapByIndex(self, i);
+		if (participantDataMapPtr != NULL) {
+			EsifApp_DestroyParticipant(self, participantDataMapPtr->fUpPtr);
+		}
 	}
 	ESIF_TRACE_INFO("Destroy participants in App\n");
 	return ESIF_OK;
@@ -1295,16 +1325,18 @@ AppParticipantDataMapPtr EsifApp_GetParticipantDataMapFromInstance(
 	const esif_handle_t participantId
 )
 {
-	UInt8 i = 0;
+	size_t i = 0;
+	AppParticipantDataMapPtr mapPtr = NULL;
 	AppParticipantDataMapPtr upDataMapPtr = NULL;
 
 	if (EsifUpPm_IsPrimaryParticipantId(participantId) || (ESIF_INVALID_HANDLE == participantId)) {
 		return upDataMapPtr;
 	}
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (self->fParticipantData[i].fAppParticipantHandle == participantId) {
-			upDataMapPtr = &self->fParticipantData[i];
+	for (i = 0; i < (ESIF_APP_PART_DATA_MAX_BLOCKS * ESIF_APP_PART_DATA_BLOCK_SIZE); i++) {
+		mapPtr = EsifApp_GetParticipantDataMapByIndex(self, i);
+		if ((mapPtr != NULL) && (mapPtr->fAppParticipantHandle == participantId)) {
+			upDataMapPtr = mapPtr;
 			break;
 		}
 	}
@@ -1322,13 +1354,40 @@ static AppParticipantDataMapPtr EsifApp_FindEmptyDataMap(
 	const EsifAppPtr self
 	)
 {
+	size_t block = 0;
 	size_t i = 0;
+	AppParticipantDataMapPtr blockPtr = NULL;
 	AppParticipantDataMapPtr upDataMapPtr = NULL;
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (ESIF_INVALID_HANDLE == self->fParticipantData[i].fAppParticipantHandle) {
-			upDataMapPtr = &self->fParticipantData[i];
-			break;
+	for (block = 0; (block < ESIF_APP_PART_DATA_MAX_BLOCKS) && (NULL == upDataMapPtr); block++) {
+		blockPtr = self->fParticipantData[block];
+
+		/* Allocate the next block only once all previous blocks are in use */
+		if (NULL == blockPtr) {
+			blockPtr = (AppParticipantDataMapPtr)esif_ccb_malloc(ESIF_APP_PART_DATA_BLOCK_SIZE * sizeof(*blockPtr));
+			if (NULL == blockPtr) {
+				break;
+			}
+			for (i = 0; i < ESIF_APP_PART_DATA_BLOCK_SIZE; i++) {
+				EsifApp_ClearParticipantDataMap(&blockPtr[i]);
+			}
+
+			esif_ccb_write_lock(&self->objLock);
+			if (NULL == self->fParticipantData[block]) {
+				self->fParticipantData[block] = blockPtr;
+			}
+			else {
+				esif_ccb_free(blockPtr);
+				blockPtr = self->fParticipantData[block];
+			}
+			esif_ccb_write_unlock(&self->objLock);
+		}
+
+		for (i = 0; i < ESIF_APP_PART_DATA_BLOCK_SIZE; i++) {
+			if (ESIF_INVALID_HANDLE == blockPtr[i].fAppParticipantHandle) {
+				upDataMapPtr = &blockPtr[i];
+				break;
+			}
 		}
 	}
 
@@ -1340,6 +1399,22 @@ static AppParticipantDataMapPtr EsifApp_FindEmptyDataMap(
 }
 
 
+/* Returns the participant data map at an overall index; NULL if its block is not allocated */
+static AppParticipantDataMapPtr EsifApp_GetParticipantDataMapByIndex(
+	const EsifAppPtr self,
+	const size_t index
+	)
+{
+	AppParticipantDataMapPtr blockPtr = NULL;
+	size_t block = index / ESIF_APP_PART_DATA_BLOCK_SIZE;
+
+	if (block < ESIF_APP_PART_DATA_MAX_BLOCKS) {
+		blockPtr = self->fParticipantData[block];
+	}
+	return (blockPtr != NULL) ? &blockPtr[index % ESIF_APP_PART_DATA_BLOCK_SIZE] : NULL;
+}
+
+
 AppDomainDataMapPtr EsifApp_GetDomainDataMapFromHandle(
 	const AppParticipantDataMapPtr upMapPtr,
 	const esif_handle_t domainHandle
@@ -1397,6 +1472,157 @@ exit:
 }
 
 
+/* Primitive handles are the binding slot + 1 in the low word and the slot generation in the high word */
+#define ESIF_APP_PRIMITIVE_HANDLE(slot, generation) ((esif_handle_t)(((UInt64)((generation) & 0x7FFFFFFF) << 32) | ((UInt64)(slot) + 1)))
+#define ESIF_APP_PRIMITIVE_HANDLE_SLOT(handle) ((UInt32)((UInt64)(handle) & 0xFFFFFFFF) - 1)
+#define ESIF_APP_PRIMITIVE_HANDLE_GENERATION(handle) ((UInt32)((UInt64)(handle) >> 32))
+#define ESIF_APP_PRIMITIVE_BINDINGS_MIN 32
+
+eEsifError EsifApp_BindPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t upHandle,
+	const esif_handle_t domainHandle,
+	const UInt32 primitiveId,
+	const UInt8 instance,
+	esif_handle_t *primitiveHandlePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	UInt16 domainId = ESIF_PRIMITIVE_DOMAIN_D0;
+	AppPrimitiveBindingPtr bindingsPtr = NULL;
+	AppPrimitiveBindingPtr bindingPtr = NULL;
+	UInt32 newSize = 0;
+	UInt32 slot = 0;
+
+	if ((NULL == self) || (NULL == primitiveHandlePtr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	/* Resolve the handles the same way as EsifSvcPrimitiveExec does on every call */
+	if (EsifUpPm_IsPrimaryParticipantId(upHandle) || (ESIF_INVALID_HANDLE == upHandle)) {
+		participantId = ESIF_HANDLE_PRIMARY_PARTICIPANT;
+	}
+	else {
+		participantId = upHandle;
+		if (domainHandle != ESIF_INVALID_HANDLE) {
+			rc = EsifApp_GetDomainIdByHandle(self, upHandle, domainHandle, &domainId);
+			if (rc != ESIF_OK) {
+				goto exit;
+			}
+		}
+	}
+
+	esif_ccb_write_lock(&self->fPrimitiveBindingLock);
+
+	for (slot = 0; slot < self->fPrimitiveBindingSize; slot++) {
+		if (!self->fPrimitiveBindings[slot].fInUse) {
+			break;
+		}
+	}
+
+	if (slot >= self->fPrimitiveBindingSize) {
+		newSize = (self->fPrimitiveBindingSize ? self->fPrimitiveBindingSize * 2 : ESIF_APP_PRIMITIVE_BINDINGS_MIN);
+		bindingsPtr = (AppPrimitiveBindingPtr)esif_ccb_realloc(self->fPrimitiveBindings, newSize * sizeof(*bindingsPtr));
+		if (NULL == bindingsPtr) {
+			esif_ccb_write_unlock(&self->fPrimitiveBindingLock);
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		esif_ccb_memset(&bindingsPtr[self->fPrimitiveBindingSize], 0, (newSize - self->fPrimitiveBindingSize) * sizeof(*bindingsPtr));
+		self->fPrimitiveBindings = bindingsPtr;
+		self->fPrimitiveBindingSize = newSize;
+	}
+
+	bindingPtr = &self->fPrimitiveBindings[slot];
+	bindingPtr->fGeneration = (bindingPtr->fGeneration + 1) & 0x7FFFFFFF;
+	bindingPtr->fInUse = ESIF_TRUE;
+	bindingPtr->fParticipantId = participantId;
+	bindingPtr->fTuple.id = (u16)primitiveId;
+	bindingPtr->fTuple.domain = domainId;
+	bindingPtr->fTuple.instance = instance;
+	*primitiveHandlePtr = ESIF_APP_PRIMITIVE_HANDLE(slot, bindingPtr->fGeneration);
+
+	esif_ccb_write_unlock(&self->fPrimitiveBindingLock);
+exit:
+	return rc;
+}
+
+
+eEsifError EsifApp_GetBoundPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t primitiveHandle,
+	esif_handle_t *participantIdPtr,
+	EsifPrimitiveTuplePtr tuplePtr
+	)
+{
+	eEsifError rc = ESIF_E_INVALID_HANDLE;
+	AppPrimitiveBindingPtr bindingPtr = NULL;
+	UInt32 slot = ESIF_APP_PRIMITIVE_HANDLE_SLOT(primitiveHandle);
+
+	if ((NULL == self) || (NULL == participantIdPtr) || (NULL == tuplePtr)) {
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	esif_ccb_read_lock(&self->fPrimitiveBindingLock);
+	if (slot < self->fPrimitiveBindingSize) {
+		bindingPtr = &self->fPrimitiveBindings[slot];
+		if (bindingPtr->fInUse && (bindingPtr->fGeneration == ESIF_APP_PRIMITIVE_HANDLE_GENERATION(primitiveHandle))) {
+			*participantIdPtr = bindingPtr->fParticipantId;
+			*tuplePtr = bindingPtr->fTuple;
+			rc = ESIF_OK;
+		}
+	}
+	esif_ccb_read_unlock(&self->fPrimitiveBindingLock);
+	return rc;
+}
+
+
+eEsifError EsifApp_UnbindPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t primitiveHandle
+	)
+{
+	eEsifError rc = ESIF_E_INVALID_HANDLE;
+	AppPrimitiveBindingPtr bindingPtr = NULL;
+	UInt32 slot = ESIF_APP_PRIMITIVE_HANDLE_SLOT(primitiveHandle);
+
+	if (NULL == self) {
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	esif_ccb_write_lock(&self->fPrimitiveBindingLock);
+	if (slot < self->fPrimitiveBindingSize) {
+		bindingPtr = &self->fPrimitiveBindings[slot];
+		if (bindingPtr->fInUse && (bindingPtr->fGeneration == ESIF_APP_PRIMITIVE_HANDLE_GENERATION(primitiveHandle))) {
+			bindingPtr->fInUse = ESIF_FALSE;
+			rc = ESIF_OK;
+		}
+	}
+	esif_ccb_write_unlock(&self->fPrimitiveBindingLock);
+	return rc;
+}
+
+
+/* Release the primitive bindings of a participant being destroyed for the app */
+static void EsifApp_UnbindParticipantPrimitives(
+	EsifAppPtr self,
+	const esif_handle_t participantId
+	)
+{
+	UInt32 slot = 0;
+
+	esif_ccb_write_lock(&self->fPrimitiveBindingLock);
+	for (slot = 0; slot < self->fPrimitiveBindingSize; slot++) {
+		if (self->fPrimitiveBindings[slot].fInUse && (self->fPrimitiveBindings[slot].fParticipantId == participantId)) {
+			self->fPrimitiveBindings[slot].fInUse = ESIF_FALSE;
+		}
+	}
+	esif_ccb_write_unlock(&self->fPrimitiveBindingLock);
+}
+
+
 char *EsifApp_GetDomainQalifierByHandle(
 	EsifAppPtr self,
 	const esif_handle_t upHandle, 
@@ -1726,8 +1952,11 @@ eEsifError EsifApp_GetNextPart(
 	}
 
 	iteratorPtr->index++;
-	while (iteratorPtr->index < MAX_DOMAIN_ENTRY) {
-		nextPtr = &self->fParticipantData[iteratorPtr->index];
+	while (iteratorPtr->index < (ESIF_APP_PART_DATA_MAX_BLOCKS * ESIF_APP_PART_DATA_BLOCK_SIZE)) {
+		nextPtr = EsifApp_GetParticipantDataMapByIndex(self, iteratorPtr->index);
+		if (NULL == nextPtr) {
+			break;
+		}
 		if ((nextPtr->fAppParticipantHandle != ESIF_INVALID_HANDLE) && (nextPtr->fAppParticipantHandle != ESIF_HANDLE_DEFAULT)) {
 			*dataPtr = nextPtr;
 			goto exit;
@@ -32,6 +32,13 @@
 #define	APPNAME_MAXLEN		MAX_PATH
 #define	APPNAME_SEPARATOR	'='
 
+/*
+ * Participant data maps are allocated in blocks on demand so that the number
+ * of participants is not limited by a fixed array and existing maps never move
+ */
+#define ESIF_APP_PART_DATA_BLOCK_SIZE	MAX_PARTICIPANT_ENTRY
+#define ESIF_APP_PART_DATA_MAX_BLOCKS	32
+
 /*
 ** Hierchary
 ** Application
@@ -63,6 +70,18 @@ typedef struct _t_AppParticipantDataMap {
 	AppDomainDataMap  fDomainData[MAX_DOMAIN_ENTRY];
 } AppParticipantDataMap, *AppParticipantDataMapPtr, *AppParticipantDataMapPtrLocation;
 
+/*
+ * Primitive bound to an opaque handle by the application. The primitive
+ * handle encodes the slot and the generation of the slot, so handles for a
+ * binding that was released and reused are rejected.
+ */
+typedef struct _t_AppPrimitiveBinding {
+	UInt32 fGeneration;		/* Incremented each time the slot is bound */
+	Bool fInUse;
+	esif_handle_t fParticipantId;	/* ESIF participant instance */
+	EsifPrimitiveTuple fTuple;
+} AppPrimitiveBinding, *AppPrimitiveBindingPtr;
+
 /* Map App Data To ESIF Prticipants */
 typedef struct _t_EsifApp {
 	esif_handle_t fHandle;				/* The ESIF handle to associate the app */
@@ -75,7 +94,12 @@ typedef struct _t_EsifApp {
 	char loadDir[MAX_PATH];				/* Directory were the app was loaded from */
 
 	/* Each Application May Have Many Participants */
-	AppParticipantDataMap  fParticipantData[MAX_PARTICIPANT_ENTRY];
+	AppParticipantDataMapPtr  fParticipantData[ESIF_APP_PART_DATA_MAX_BLOCKS];
+
+	/* Primitives bound by the application, grown on demand */
+	AppPrimitiveBindingPtr fPrimitiveBindings;
+	UInt32 fPrimitiveBindingSize;
+	esif_ccb_lock_t fPrimitiveBindingLock;
 
 	/* State information for pausing initialization */
 	Bool appCreationDone;
@@ -257,6 +281,33 @@ eEsifError EsifApp_GetHandlesByIds(
 	esif_handle_t *domainHandlePtr
 	);
 
+/*
+ * Resolves a participant/domain/primitive/instance once into a primitive handle
+ * that can be executed repeatedly without resolving the app handles again.
+ * Bindings are released when the participant is destroyed for the app.
+ */
+eEsifError EsifApp_BindPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t upHandle,
+	const esif_handle_t domainHandle,
+	const UInt32 primitiveId,
+	const UInt8 instance,
+	esif_handle_t *primitiveHandlePtr
+	);
+
+/* Gets the participant and primitive tuple of a bound primitive */
+eEsifError EsifApp_GetBoundPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t primitiveHandle,
+	esif_handle_t *participantIdPtr,
+	EsifPrimitiveTuplePtr tuplePtr
+	);
+
+eEsifError EsifApp_UnbindPrimitive(
+	EsifAppPtr self,
+	const esif_handle_t primitiveHandle
+	);
+
 eEsifError EsifApp_SuspendApp(
 	EsifAppPtr self
 );
@@ -23,6 +23,7 @@
 #include "esif_pm.h"
 #include "esif_uf_arbmgr.h"
 #include "esif_link_list.h"
+#include "esif_hash_table.h"
 #include "esif_uf_primitive.h"	/* ESIF Primitive Execution */
 #include "esif_participant.h"
 #include "esif_lib_esifdata.h"
@@ -73,6 +74,8 @@
 
 #define ESIF_UF_ARBMGR_QUEUE_NAME "UfArbMgrPrimitiveQueue"
 #define ESIF_UF_ARBMGR_QUEUE_SIZE 0xFFFFFFFF
+#define ESIF_UF_ARBMGR_NUM_WORKERS 4
+#define ESIF_ARB_CTX_ENTRY_HASHTABLE_SIZE 31
 #define ESIF_ARB_ENTRY_ITERATOR_MARKER 'UFAM'
 #define ESIF_ARB_CTX_ENTRY_TABLE_GROWTH_RATE 10
 
@@ -104,20 +107,44 @@ typedef esif_error_t (*EsifArbMgr_ArbitratorFunc)(
 	int *resultPtr
 	);
 
+/*
+ * Arbitrated Primitive Worker
+ *
+ * Each worker owns a queue of arbitrated primitive requests and the thread
+ * which executes them.  Requests are assigned to a worker by participant, so
+ * requests for a given participant are always executed in the order queued,
+ * while requests for unrelated participants may execute in parallel.
+ */
+typedef struct EsifArbWorker_s {
+	UInt32 index;
+	EsifQueue *queuePtr; /* EsifArbPrimReq primitive requests */
+	esif_thread_t thread;
+	Bool threadStarted;
+
+	atomic64_t queuedCount;		/* Requests queued to the worker */
+	atomic64_t executedCount;	/* Requests executed by the worker */
+	atomic64_t failedCount;		/* Requests which failed execution */
+	atomic64_t maxDepth;		/* Queue depth high-water mark */
+	atomic64_t latencyTotalUsec; /* Enqueue-to-execution latency counters */
+	atomic64_t latencyCount;
+	atomic64_t latencyMinUsec;
+	atomic64_t latencyMaxUsec;
+	atomic64_t lastLatencyUsec;
+} EsifArbWorker;
+
 /*
  * Arbitration Manager
  *
  * The arbitration manager has two primary responsibilities:
  * 1. Create/control access to the arbitration context singleton in the participant
- * 2. Provide a queue for arbitrated primitive requests for execution outside
+ * 2. Provide queues for arbitrated primitive requests for execution outside
  * of other arbitration locks.
  */
 typedef struct EsifArbMgr_s {
 	esif_ccb_lock_t mgrLock;
 	atomic_t arbitrationEnabled;
 
-	EsifQueue *primitiveQueuePtr; /* EsifArbPrimReq primitive requests */
-	esif_thread_t primitiveQueueThread;
+	EsifArbWorker workers[ESIF_UF_ARBMGR_NUM_WORKERS];
 	Bool primitiveQueueExitFlag;
 } EsifArbMgr;
 
@@ -138,6 +165,7 @@ typedef struct EsifArbCtx_s {
 	size_t numEntries;
 	size_t entryCapacity;
 	struct EsifArbEntry_s **entriesPtr;
+	struct esif_ht *entryIndexPtr; /* Entries indexed by primitive/instance */
 
 	esif_handle_t participantId; /* Containing participant */
 	esif_string participantName; /* For tracing */
@@ -206,6 +234,7 @@ typedef struct EsifArbPrimReq_s {
 	UInt16 domain;
 	UInt8 instance;
 	EsifDataPtr dataPtr;
+	esif_ccb_realtime_t queuedTime; /* For latency counters */
 } EsifArbPrimReq;
 
 /*
@@ -338,8 +367,16 @@ static esif_error_t EsifArbMgr_QueuePrimitiveRequest(
 	const EsifDataPtr requestPtr
 	);
 
+/* Selects the worker which executes queued requests for a participant */
+static EsifArbWorker *EsifArbMgr_GetWorker(const esif_handle_t participantId);
+
 static void *ESIF_CALLCONV EsifArbMgr_PrimitiveQueueExecutionThread(void *ctxPtr);
 
+static void EsifArbWorker_UpdateLatency(
+	EsifArbWorker *self,
+	EsifArbPrimReq *primReqPtr
+	);
+
 
 /* EsifArbCtx Functions*/
 
@@ -714,16 +751,12 @@ esif_error_t EsifArbMgr_ExecutePrimitive(
 	)
 {
 	esif_error_t rc = ESIF_OK;
-	EsifUp  *upPtr = NULL;
 	EsifPrimitiveTuple tuple = { 0 };
-	UInt16 domain = 0;
-	EsifArbCtx *arbCtxPtr = NULL;
 
 	if (NULL == domainStr) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
-	domain = domain_str_to_short(domainStr);
 	
 	ESIF_TRACE_PRIMITIVE_DEBUG("\n\n"
 		"Primitive Request:\n"
@@ -742,6 +775,35 @@ esif_error_t EsifArbMgr_ExecutePrimitive(
 		requestPtr,
 		responsePtr);
 
+	tuple.id = (u16)primitiveId;
+	tuple.domain = domain_str_to_short(domainStr);
+	tuple.instance = instance;
+
+	rc = EsifArbMgr_ExecuteTuplePrimitive(appHandle, participantId, &tuple, requestPtr, responsePtr);
+exit:
+	return rc;
+}
+
+
+esif_error_t EsifArbMgr_ExecuteTuplePrimitive(
+	const esif_handle_t appHandle,
+	const esif_handle_t participantId,
+	const struct esif_primitive_tuple *tuplePtr,
+	const EsifDataPtr requestPtr,
+	EsifData *responsePtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	EsifUp  *upPtr = NULL;
+	EsifPrimitiveTuple tuple = { 0 };
+	EsifArbCtx *arbCtxPtr = NULL;
+
+	if (NULL == tuplePtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	tuple = *tuplePtr;
+
 	upPtr = EsifUpPm_GetAvailableParticipantByInstance(participantId);
 	if (NULL == upPtr) {
 		rc = ESIF_E_PARTICIPANT_NOT_FOUND;
@@ -751,14 +813,14 @@ esif_error_t EsifArbMgr_ExecutePrimitive(
 	 * Only accesses to Domain 0 are arbitrated
 	 */
 	rc = ESIF_E_NOT_SUPPORTED;
-	if (atomic_read(&g_arbMgr.arbitrationEnabled) && (ESIF_PRIMITIVE_DOMAIN_D0 == domain)) {
+	if (atomic_read(&g_arbMgr.arbitrationEnabled) && (ESIF_PRIMITIVE_DOMAIN_D0 == tuple.domain)) {
 		/*
 		 * Get/create the arbitration context stored in the participant.
 		 * (While a reference is held on the participant, the arbitration context
 		 * is valid.)
 		 */
 		arbCtxPtr = EsifArbMgr_CtxInst(upPtr);
-		rc = EsifArbCtx_ExecutePrimitive(arbCtxPtr, appHandle, primitiveId, instance, requestPtr);
+		rc = EsifArbCtx_ExecutePrimitive(arbCtxPtr, appHandle, tuple.id, tuple.instance, requestPtr);
 	}
 
 	/*
@@ -766,9 +828,6 @@ esif_error_t EsifArbMgr_ExecutePrimitive(
 	 */
 	if (rc != ESIF_OK) {
 		ESIF_TRACE_PRIMITIVE_DEBUG("Executing unarbitrated primitive.");
-		tuple.id = (u16)primitiveId;
-		tuple.domain = domain;
-		tuple.instance = instance;
 		rc = EsifUp_ExecutePrimitive(upPtr, &tuple, requestPtr, responsePtr);
 	}
 exit:
@@ -838,6 +897,10 @@ static esif_error_t EsifArbMgr_QueuePrimitiveRequest(
 {
 	esif_error_t rc = ESIF_E_NO_MEMORY;
 	EsifArbPrimReq *primReqPtr = NULL;
+	EsifArbWorker *workerPtr = NULL;
+	UInt64 depth = 0;
+	atomic64_basetype maxDepth = 0;
+	atomic64_basetype prevMaxDepth = 0;
 
 	primReqPtr = EsifArbPrimReq_Create(
 		participantId,
@@ -848,7 +911,25 @@ static esif_error_t EsifArbMgr_QueuePrimitiveRequest(
 	);
 	/* Queue will accept NULL requests so, need to check before inserting */
 	if (primReqPtr) {
-		rc = esif_queue_enqueue(g_arbMgr.primitiveQueuePtr, primReqPtr);
+		workerPtr = EsifArbMgr_GetWorker(participantId);
+		rc = esif_queue_enqueue(workerPtr->queuePtr, primReqPtr);
+		if (ESIF_OK == rc) {
+			atomic64_inc(&workerPtr->queuedCount);
+			depth = esif_queue_size(workerPtr->queuePtr);
+
+			/* Concurrent producers race to raise the high-water mark, so only replace the value that was read */
+			maxDepth = atomic64_read(&workerPtr->maxDepth);
+			while ((UInt64)maxDepth < depth) {
+				prevMaxDepth = atomic64_cmpxchg(&workerPtr->maxDepth, maxDepth, (atomic64_basetype)depth);
+				if (prevMaxDepth == maxDepth) {
+					break;
+				}
+				maxDepth = prevMaxDepth;
+			}
+		}
+		else {
+			EsifArbPrimReq_Destroy(primReqPtr);
+		}
 	}
 	ESIF_TRACE_DEBUG("[Prim = %u, Inst = %u, Part = " ESIF_HANDLE_FMT "] : Queued primitive request; rc = %d",
 		primitiveId, instance, esif_ccb_handle2llu(participantId), rc);
@@ -857,11 +938,47 @@ static esif_error_t EsifArbMgr_QueuePrimitiveRequest(
 }
 
 
+/*
+ * Selects the worker for a participant.  All requests for a given participant
+ * go to the same worker so they are executed in the order they were queued.
+ */
+static EsifArbWorker *EsifArbMgr_GetWorker(
+	const esif_handle_t participantId
+	)
+{
+	UInt64 key = (UInt64)participantId;
+
+	key ^= (key >> 16) ^ (key >> 32);
+	return &g_arbMgr.workers[key % ESIF_UF_ARBMGR_NUM_WORKERS];
+}
+
+
+static void EsifArbWorker_UpdateLatency(
+	EsifArbWorker *self,
+	EsifArbPrimReq *primReqPtr
+	)
+{
+	UInt64 latency = esif_ccb_realtime_diff_usec(primReqPtr->queuedTime, esif_ccb_realtime_current());
+
+	if ((0 == atomic64_read(&self->latencyCount)) ||
+		(latency < (UInt64)atomic64_read(&self->latencyMinUsec))) {
+		atomic64_set(&self->latencyMinUsec, (atomic64_basetype)latency);
+	}
+	if (latency > (UInt64)atomic64_read(&self->latencyMaxUsec)) {
+		atomic64_set(&self->latencyMaxUsec, (atomic64_basetype)latency);
+	}
+	atomic64_set(&self->lastLatencyUsec, (atomic64_basetype)latency);
+	atomic64_add((atomic64_basetype)latency, &self->latencyTotalUsec);
+	atomic64_inc(&self->latencyCount);
+}
+
+
 static void *ESIF_CALLCONV EsifArbMgr_PrimitiveQueueExecutionThread(
 	void *ctxPtr
 	)
 {
 	esif_error_t rc = ESIF_OK;
+	EsifArbWorker *workerPtr = (EsifArbWorker *)ctxPtr;
 	EsifArbPrimReq *primReqPtr = NULL;
 	EsifUp *upPtr = NULL;
 	EsifPrimitiveTuple tuple = { 0 };
@@ -870,23 +987,25 @@ static void *ESIF_CALLCONV EsifArbMgr_PrimitiveQueueExecutionThread(
 
 	phonyResponseData.buf_ptr = &phonyData;
 
-	UNREFERENCED_PARAMETER(ctxPtr);
-
 	while (!g_arbMgr.primitiveQueueExitFlag) {
-		primReqPtr = esif_queue_pull(g_arbMgr.primitiveQueuePtr);
+		primReqPtr = esif_queue_pull(workerPtr->queuePtr);
 
 		if (NULL == primReqPtr) {
 			continue;
 		}
 
+		EsifArbWorker_UpdateLatency(workerPtr, primReqPtr);
+
 		tuple.id = (UInt16)primReqPtr->primitiveId;
 		tuple.domain = primReqPtr->domain;
 		tuple.instance = primReqPtr->instance;
 
 		upPtr = EsifUpPm_GetAvailableParticipantByInstance(primReqPtr->participantId);
 		rc = EsifUp_ExecutePrimitive(upPtr, &tuple, primReqPtr->dataPtr, &phonyResponseData);
-		
+
+		atomic64_inc(&workerPtr->executedCount);
 		if (rc != ESIF_OK) {
+			atomic64_inc(&workerPtr->failedCount);
 			ESIF_TRACE_DEBUG("[%s Prim = %lu, Inst = %lu] : Executed queued primitive request, rc = %d",
 				EsifUp_GetName(upPtr),
 				tuple.id, tuple.instance,
@@ -1240,28 +1359,51 @@ esif_error_t EsifArbMgr_SetArbitrationFunction(
 
 esif_error_t EsifArbMgr_Init()
 {
-	esif_error_t rc = ESIF_E_NO_MEMORY;
+	esif_error_t rc = ESIF_OK;
+	UInt32 index = 0;
+	EsifArbWorker *workerPtr = NULL;
+	char queueName[ESIF_QUEUE_NAME_LEN] = { 0 };
 
 	esif_ccb_lock_init(&g_arbMgr.mgrLock);
 
 	atomic_set(&g_arbMgr.arbitrationEnabled, ESIF_TRUE);
 
 	/*
-	* Create a queue for processing arbitrated primitives so they may be
-	* executed outside of locks and still have arbitration be atomic.
+	* Create the worker queues for processing arbitrated primitives so they may
+	* be executed outside of locks and still have arbitration be atomic.
 	*/
-	g_arbMgr.primitiveQueuePtr = esif_queue_create(ESIF_UF_ARBMGR_QUEUE_SIZE, ESIF_UF_ARBMGR_QUEUE_NAME, ESIF_QUEUE_TIMEOUT_INFINITE);
-	if (g_arbMgr.primitiveQueuePtr) {
-		rc = esif_ccb_thread_create(&g_arbMgr.primitiveQueueThread, EsifArbMgr_PrimitiveQueueExecutionThread, NULL);
+	for (index = 0; index < ESIF_UF_ARBMGR_NUM_WORKERS; index++) {
+		workerPtr = &g_arbMgr.workers[index];
+		workerPtr->index = index;
+
+		esif_ccb_sprintf(sizeof(queueName), queueName, "%s-%u", ESIF_UF_ARBMGR_QUEUE_NAME, index);
+		workerPtr->queuePtr = esif_queue_create(ESIF_UF_ARBMGR_QUEUE_SIZE, queueName, ESIF_QUEUE_TIMEOUT_INFINITE);
+		if (NULL == workerPtr->queuePtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+
+		rc = esif_ccb_thread_create(&workerPtr->thread, EsifArbMgr_PrimitiveQueueExecutionThread, workerPtr);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+		workerPtr->threadStarted = ESIF_TRUE;
 	}
+exit:
 	return rc;
 }
 
 
 void EsifArbMgr_Exit()
 {
-	esif_queue_destroy(g_arbMgr.primitiveQueuePtr, (queue_item_destroy_func)EsifArbPrimReq_Destroy);
-	g_arbMgr.primitiveQueuePtr = NULL;
+	UInt32 index = 0;
+	EsifArbWorker *workerPtr = NULL;
+
+	for (index = 0; index < ESIF_UF_ARBMGR_NUM_WORKERS; index++) {
+		workerPtr = &g_arbMgr.workers[index];
+		esif_queue_destroy(workerPtr->queuePtr, (queue_item_destroy_func)EsifArbPrimReq_Destroy);
+		workerPtr->queuePtr = NULL;
+	}
 
 	esif_ccb_lock_uninit(&g_arbMgr.mgrLock);
 }
@@ -1275,12 +1417,66 @@ esif_error_t EsifArbMgr_Start()
 
 void EsifArbMgr_Stop()
 {
+	UInt32 index = 0;
+	EsifArbWorker *workerPtr = NULL;
+
 	/*
-	 * Stop the primitive queue and wait for thread to exit
+	 * Stop the primitive queues and wait for the worker threads to exit
 	 */
 	g_arbMgr.primitiveQueueExitFlag = ESIF_TRUE;
-	esif_queue_signal_event(g_arbMgr.primitiveQueuePtr);
-	esif_ccb_thread_join(&g_arbMgr.primitiveQueueThread);
+	for (index = 0; index < ESIF_UF_ARBMGR_NUM_WORKERS; index++) {
+		workerPtr = &g_arbMgr.workers[index];
+		if (workerPtr->threadStarted) {
+			esif_queue_signal_event(workerPtr->queuePtr);
+			esif_ccb_thread_join(&workerPtr->thread);
+			workerPtr->threadStarted = ESIF_FALSE;
+		}
+	}
+}
+
+
+UInt32 EsifArbMgr_GetWorkerCount(void)
+{
+	return ESIF_UF_ARBMGR_NUM_WORKERS;
+}
+
+
+esif_error_t EsifArbMgr_GetWorkerStats(
+	UInt32 index,
+	EsifArbWorkerStats *statsPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	EsifArbWorker *workerPtr = NULL;
+	UInt64 count = 0;
+
+	if (NULL == statsPtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if (index >= ESIF_UF_ARBMGR_NUM_WORKERS) {
+		rc = ESIF_E_NOT_FOUND;
+		goto exit;
+	}
+
+	workerPtr = &g_arbMgr.workers[index];
+	esif_ccb_memset(statsPtr, 0, sizeof(*statsPtr));
+
+	statsPtr->depth = workerPtr->queuePtr ? esif_queue_size(workerPtr->queuePtr) : 0;
+	statsPtr->maxDepth = (UInt64)atomic64_read(&workerPtr->maxDepth);
+	statsPtr->queuedCount = (UInt64)atomic64_read(&workerPtr->queuedCount);
+	statsPtr->executedCount = (UInt64)atomic64_read(&workerPtr->executedCount);
+	statsPtr->failedCount = (UInt64)atomic64_read(&workerPtr->failedCount);
+
+	count = (UInt64)atomic64_read(&workerPtr->latencyCount);
+	if (count > 0) {
+		statsPtr->latencyMinUsec = (UInt64)atomic64_read(&workerPtr->latencyMinUsec);
+		statsPtr->latencyMaxUsec = (UInt64)atomic64_read(&workerPtr->latencyMaxUsec);
+		statsPtr->latencyAvgUsec = (UInt64)atomic64_read(&workerPtr->latencyTotalUsec) / count;
+		statsPtr->lastLatencyUsec = (UInt64)atomic64_read(&workerPtr->lastLatencyUsec);
+	}
+exit:
+	return rc;
 }
 
 
@@ -1329,6 +1525,14 @@ static EsifArbCtx *EsifArbCtx_Create(
 	self->participantId = EsifUp_GetInstance(upPtr);
 	self->participantName = esif_ccb_strdup(EsifUp_GetName(upPtr));
 
+	self->entryIndexPtr = esif_ht_create(ESIF_ARB_CTX_ENTRY_HASHTABLE_SIZE);
+	if (NULL == self->entryIndexPtr) {
+		ESIF_TRACE_ARB_CTX(ESIF_TRACELEVEL_ERROR, "Unable to create entry index\n");
+		EsifArbCtx_Destroy(self);
+		self = NULL;
+		goto exit;
+	}
+
 	/* Show handle here to allow association between name and handle first */
 	ESIF_TRACE_ARB_CTX(ESIF_TRACELEVEL_DEBUG, "Creating context for " ESIF_HANDLE_FMT "\n",
 		esif_ccb_handle2llu(self->participantId));
@@ -1368,6 +1572,10 @@ static void EsifArbCtx_Destroy(
 			self->entriesPtr[i] = NULL;
 			EsifArbEntry_Destroy(entryPtr);
 		}
+		esif_ccb_free(self->entriesPtr);
+
+		/* Index items are the entries destroyed above */
+		esif_ht_destroy(self->entryIndexPtr, NULL);
 
 		esif_ccb_free(self->participantName);
 		esif_ccb_lock_uninit(&self->ctxLock);
@@ -1507,6 +1715,44 @@ static esif_error_t EsifArbCtx_PopulateDefaultArbitrationTable(
 }
 
 
+/*
+ * Entries are indexed by primitive and instance.  The participant is implied
+ * by the context, and only D0 primitives are arbitrated, so the domain is not
+ * part of the key.
+ */
+static UInt64 EsifArbCtx_GetEntryKey(
+	const UInt32 primitiveId,
+	const UInt8 instance
+	)
+{
+	return ((UInt64)primitiveId << 8) | instance;
+}
+
+
+/*
+ * Adds an entry to the index unless an entry is already indexed for the same
+ * primitive/instance, so the indexed entry is always the first one in the
+ * table, as a scan would find.
+ * Caller is expected to hold the ctxLock
+ */
+static esif_error_t EsifArbCtx_IndexArbEntry_Locked(
+	EsifArbCtx *self,
+	EsifArbEntry *entryPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	UInt64 key = EsifArbCtx_GetEntryKey(entryPtr->primitiveId, entryPtr->instance);
+
+	if (NULL == esif_ht_get_item(self->entryIndexPtr, (u8 *)&key, sizeof(key))) {
+		rc = esif_ht_add_item(self->entryIndexPtr, (u8 *)&key, sizeof(key), entryPtr);
+		if (rc != ESIF_OK) {
+			ESIF_TRACE_ARB_CTX(ESIF_TRACELEVEL_ERROR, "Unable to index entry; rc = %d\n", rc);
+		}
+	}
+	return rc;
+}
+
+
 /* Caller is expected to hold the ctxLock */
 static esif_error_t EsifArbCtx_InsertArbEntry_Locked(
 	EsifArbCtx *self,
@@ -1519,8 +1765,10 @@ static esif_error_t EsifArbCtx_InsertArbEntry_Locked(
 	if (self) {
 		/* Check if capacity needed to add new entry */
 		if (self->numEntries < self->entryCapacity) {
-			self->entriesPtr[self->numEntries++] = entryPtr;
-			rc = ESIF_OK;
+			rc = EsifArbCtx_IndexArbEntry_Locked(self, entryPtr);
+			if (ESIF_OK == rc) {
+				self->entriesPtr[self->numEntries++] = entryPtr;
+			}
 		}
 		else {
 			rc = ESIF_E_NO_MEMORY;
@@ -1593,10 +1841,17 @@ static esif_error_t EsifArbCtx_RemoveArbEntry_Locked(
 	size_t index = 0;
 	size_t moveSize = 0;
 	size_t newCapacity = 0;
+	UInt64 key = 0;
 
 	if (self && entryPtr) {
 		rc = ESIF_OK;
 
+		/* Remove the entry from the index if it is the indexed entry */
+		key = EsifArbCtx_GetEntryKey(entryPtr->primitiveId, entryPtr->instance);
+		if (esif_ht_get_item(self->entryIndexPtr, (u8 *)&key, sizeof(key)) == entryPtr) {
+			esif_ht_remove_item(self->entryIndexPtr, (u8 *)&key, sizeof(key));
+		}
+
 		/* Find the entry to remove */
 		for (index = 0; index < self->numEntries; index++) {
 			if (entryPtr == self->entriesPtr[index]) {
@@ -1614,6 +1869,14 @@ static esif_error_t EsifArbCtx_RemoveArbEntry_Locked(
 				esif_ccb_memcpy(entryMovePtr, entryMovePtr + 1, moveSize);
 			}
 			self->numEntries--;
+
+			/* Index the next entry for the same primitive/instance, if any */
+			for (index = 0; index < self->numEntries; index++) {
+				if (EsifArbEntry_IsMatchingEntry(self->entriesPtr[index], entryPtr->primitiveId, entryPtr->instance)) {
+					(void)EsifArbCtx_IndexArbEntry_Locked(self, self->entriesPtr[index]);
+					break;
+				}
+			}
 		}
 
 		/* Shrink the list if needed */
@@ -1624,7 +1887,7 @@ static esif_error_t EsifArbCtx_RemoveArbEntry_Locked(
 				self->entryCapacity = 0;
 			}
 			else {
-				newCapacity = (self->numEntries / ESIF_ARB_CTX_ENTRY_TABLE_GROWTH_RATE) + 1;
+				newCapacity = ((self->numEntries / ESIF_ARB_CTX_ENTRY_TABLE_GROWTH_RATE) + 1) * ESIF_ARB_CTX_ENTRY_TABLE_GROWTH_RATE;
 				newArbListPtr = esif_ccb_realloc(self->entriesPtr, newCapacity * sizeof(*self->entriesPtr));
 				if (newArbListPtr) {
 					self->entriesPtr = newArbListPtr;
@@ -1651,13 +1914,35 @@ static EsifArbEntry *EsifArbCtx_LookupArbEntry_Locked(
 	)
 {
 	EsifArbEntry *entryPtr = NULL;
+	EsifArbEntry *indexedEntryPtr = NULL;
 	EsifArbEntry **curEntryPtr = NULL;
 	size_t i = 0;
+	UInt64 key = 0;
 	
+	if (NULL == self) {
+		goto exit;
+	}
+
+	/*
+	 * Use the index first; only fall back to scanning the table if the
+	 * indexed entry is being deleted, in which case there may be another
+	 * entry for the same primitive and instance.
+	 */
+	key = EsifArbCtx_GetEntryKey(primitiveId, instance);
+	indexedEntryPtr = (EsifArbEntry *)esif_ht_get_item(self->entryIndexPtr, (u8 *)&key, sizeof(key));
+	if (NULL == indexedEntryPtr) {
+		goto exit;
+	}
+	if (EsifArbEntry_IsMatchingEntry(indexedEntryPtr, primitiveId, instance) &&
+		(ESIF_OK == EsifArbEntry_GetRef(indexedEntryPtr))) {
+		entryPtr = indexedEntryPtr;
+		goto exit;
+	}
+
 	/*
 	 * Looking for valid entry based on the primitive and instance.
 	 */
-	if (self && self->numEntries && self->entriesPtr) {
+	if (self->numEntries && self->entriesPtr) {
 		curEntryPtr = self->entriesPtr;
 		for (i = 0; i < self->numEntries; i++, curEntryPtr++) {
 			if (EsifArbEntry_IsMatchingEntry(*curEntryPtr, primitiveId, instance)) {
@@ -1668,6 +1953,7 @@ static EsifArbEntry *EsifArbCtx_LookupArbEntry_Locked(
 			}
 		}
 	}
+exit:
 	return entryPtr;
 }
 
@@ -2790,6 +3076,7 @@ static EsifArbPrimReq *EsifArbPrimReq_Create(
 		self->primitiveId = primitiveId;
 		self->domain = domain;
 		self->instance = instance;
+		self->queuedTime = esif_ccb_realtime_current();
 		self->dataPtr = EsifData_Clone(requestPtr);
 		if (NULL == self->dataPtr) {
 			EsifArbPrimReq_Destroy(self);
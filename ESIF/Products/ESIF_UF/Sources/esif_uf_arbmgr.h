@@ -105,6 +105,19 @@ typedef struct EsifArbInfo_s {
 	EsifArbCtxInfo arbCtxInfo[1];
 } EsifArbInfo;
 
+/* Counters for a worker executing queued arbitrated primitive requests */
+typedef struct EsifArbWorkerStats_s {
+	UInt64 depth;			/* Current queue depth */
+	UInt64 maxDepth;		/* Queue depth high-water mark */
+	UInt64 queuedCount;		/* Requests queued to the worker */
+	UInt64 executedCount;	/* Requests executed by the worker */
+	UInt64 failedCount;		/* Requests which failed execution */
+	UInt64 latencyMinUsec;	/* Minimum enqueue-to-execution latency */
+	UInt64 latencyMaxUsec;	/* Maximum enqueue-to-execution latency */
+	UInt64 latencyAvgUsec;	/* Average enqueue-to-execution latency */
+	UInt64 lastLatencyUsec;	/* Latency of the most recently executed request */
+} EsifArbWorkerStats;
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -124,6 +137,18 @@ extern "C" {
 		EsifData *responsePtr
 	);
 
+	/*
+	 * Same as EsifArbMgr_ExecutePrimitive, but takes a pre-resolved primitive
+	 * tuple; used for primitives bound to a handle by the application
+	 */
+	esif_error_t EsifArbMgr_ExecuteTuplePrimitive(
+		const esif_handle_t appHandle,
+		const esif_handle_t participantId,
+		const struct esif_primitive_tuple *tuplePtr,
+		const EsifDataPtr requestPtr,
+		EsifData *responsePtr
+	);
+
 	/*
 	 * Gets arbitration information at various arbitration layers
 	 *
@@ -194,6 +219,13 @@ extern "C" {
 		esif_arbitration_type_t arbType
 	);
 
+	/*
+	 * Queued arbitrated primitive requests are executed by a pool of workers,
+	 * with each participant assigned to a single worker
+	 */
+	UInt32 EsifArbMgr_GetWorkerCount(void);
+	esif_error_t EsifArbMgr_GetWorkerStats(UInt32 index, EsifArbWorkerStats *statsPtr);
+
 	/* Boilerplate lifecycle items */
 	esif_error_t EsifArbMgr_Init();
 	void EsifArbMgr_Exit();
@@ -204,11 +236,14 @@ extern "C" {
 #else /* !ESIF_FEAT_OPT_ARBITRATOR_ENABLED */
 
 #define EsifArbMgr_ExecutePrimitive(app, part, prim, dom, inst, req, rsp) EsifExecutePrimitive(part, prim, dom, inst, req, rsp)
+#define EsifArbMgr_ExecuteTuplePrimitive(app, part, tuple, req, rsp) EsifExecuteTuplePrimitive(part, tuple, req, rsp)
 #define EsifArbMgr_GetInformation(part, prim, dom, inst) NULL
 #define EsifArbMgr_SetArbitrationState(part, prim, dom, inst, isEnabled) ESIF_E_NOT_SUPPORTED
 #define EsifArbMgr_StopArbitration(part, prim, dom, inst) ESIF_E_NOT_SUPPORTED
 #define EsifArbMgr_SetLimits(part, prim, dom, inst, upr, lwr) ESIF_E_NOT_SUPPORTED
 #define EsifArbMgr_SetArbitrationFunction(part, prim, dom, inst, type) ESIF_E_NOT_SUPPORTED
+#define EsifArbMgr_GetWorkerCount() 0
+#define EsifArbMgr_GetWorkerStats(index, statsPtr) ESIF_E_NOT_SUPPORTED
 
 	/* Inline to allow pointers to be take for UF intialization table */
 	static ESIF_INLINE esif_error_t EsifArbMgr_Init() { return ESIF_OK; }
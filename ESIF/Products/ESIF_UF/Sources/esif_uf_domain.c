@@ -27,6 +27,7 @@
 #include "esif_temp.h"
 #include "esif_pm.h"		/* Upper Participant Manager */
 #include "esif_lib_esifdata.h"
+#include "esif_uf_sampler.h"
 
 
 #ifdef ESIF_ATTR_OS_WINDOWS
@@ -129,14 +130,29 @@ static eEsifError EsifUpDomain_StartStatePollPriv(
 	EsifUpDomainPtr self
 	);
 
-static void EsifUpDomain_PollTemp(
-	const void *ctx
+static eEsifError EsifUpDomain_CheckTempResolved(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
 	);
 
-static void EsifUpDomain_PollState(
-	const void *ctx
+static eEsifError EsifUpDomain_CheckStateResolved(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
 	);
 
+static ESIF_INLINE eEsifError EsifUpDomain_ExecuteSamplePrimitive(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr,
+	EsifPrimitiveTuplePtr tuplePtr,
+	EsifDataPtr responsePtr
+	)
+{
+	if (resolvedPtr != NULL) {
+		return EsifUp_ExecuteResolvedPrimitive(self->upPtr, resolvedPtr, tuplePtr, NULL, responsePtr);
+	}
+	return EsifUp_ExecutePrimitive(self->upPtr, tuplePtr, NULL, responsePtr);
+}
+
 //
 // Friend functions
 //
@@ -811,8 +827,7 @@ eEsifError EsifUpDomain_SetTempThresh(
 			 being loaded or the device being available
 			 */
 			self->tempPollType = ESIF_POLL_DOMAIN;
-			rc = esif_ccb_timer_set_msec(&self->tempPollTimer,
-				self->tempPollPeriod);
+			rc = EsifSampler_AddDomain(self, ESIF_SAMPLE_TEMP, self->tempPollPeriod);
 		}
 		else {
 			rc = EsifUpDomain_StartTempPollPriv(self);
@@ -846,6 +861,16 @@ eEsifError EsifUpDomain_Poll(EsifUpDomainPtr self)
 }
 
 eEsifError EsifUpDomain_CheckTemp(EsifUpDomainPtr self)
+{
+	return EsifUpDomain_CheckTempResolved(self, NULL);
+}
+
+
+/* resolvedPtr is the sampler's saved read for the domain, or NULL to execute the primitive normally */
+static eEsifError EsifUpDomain_CheckTempResolved(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
+	)
 {
 	eEsifError rc = ESIF_OK;
 	UInt32 temp = ESIF_DOMAIN_TEMP_INVALID;
@@ -854,7 +879,7 @@ eEsifError EsifUpDomain_CheckTemp(EsifUpDomainPtr self)
 	esif_temp_t tempInvalidValue = ESIF_DOMAIN_TEMP_INVALID_VALUE;
 
 	tempTuple.domain = self->domain;
-	rc = EsifUp_ExecutePrimitive(self->upPtr, &tempTuple, NULL, &tempResponse);
+	rc = EsifUpDomain_ExecuteSamplePrimitive(self, resolvedPtr, &tempTuple, &tempResponse);
 	if (rc != ESIF_OK) {
 		if (rc == ESIF_E_STOP_POLL) {
 			self->tempPollType = ESIF_POLL_UNSUPPORTED;
@@ -912,6 +937,15 @@ exit:
 }
 
 eEsifError EsifUpDomain_CheckState(EsifUpDomainPtr self)
+{
+	return EsifUpDomain_CheckStateResolved(self, NULL);
+}
+
+
+static eEsifError EsifUpDomain_CheckStateResolved(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
+	)
 {
 	eEsifError rc = ESIF_OK;
 	UInt32 state = ESIF_DOMAIN_STATE_INVALID;
@@ -923,7 +957,7 @@ eEsifError EsifUpDomain_CheckState(EsifUpDomainPtr self)
 		self->domainStr);
 
 	stateTuple.domain = self->domain;
-	rc = EsifUp_ExecutePrimitive(self->upPtr, &stateTuple, NULL, &stateResponse);
+	rc = EsifUpDomain_ExecuteSamplePrimitive(self, resolvedPtr, &stateTuple, &stateResponse);
 	if (rc != ESIF_OK) {
 		goto exit;
 	}
@@ -937,92 +971,58 @@ exit:
 	return rc;
 }
 
-static void EsifUpDomain_PollState(
-	const void *ctx
+/*
+ * Called by the sampler each period while the domain is in a sample batch.
+ * Returns ESIF_FALSE when the domain should be dropped from its batch.
+ */
+Bool EsifUpDomain_SampleState(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
 	)
 {
-	eEsifError rc = ESIF_OK;
-	EsifUpDomainPtr self = (EsifUpDomainPtr) ctx;
-	
 	if (self == NULL) {
-		goto exit;
+		return ESIF_FALSE;
 	}
 
-	rc = EsifUpDomain_CheckState(self);
+	EsifUpDomain_CheckStateResolved(self, resolvedPtr);
 
-	/* If another type of polling was started, skip the timer reset */
-	if (self->statePollType != ESIF_POLL_DOMAIN) {
-		goto exit;
-	}
-
-	rc = EsifUpDomain_StartStatePollPriv(self);
-exit:
-	
-	if (rc != ESIF_OK) {
-		ESIF_TRACE_DEBUG("Unable to set poll timer on %s %s : %s(%d)\n", self->participantName, self->domainName, esif_rc_str(rc), rc);
-	}
+	/* If another type of polling was started, stop sampling */
+	return (self->statePollType == ESIF_POLL_DOMAIN) ? ESIF_TRUE : ESIF_FALSE;
 }
 
 
-static void EsifUpDomain_PollTemp(
-	const void *ctx
+/*
+ * Called by the sampler each period while the domain is in a sample batch.
+ * The sampler holds a reference on the participant during the call.
+ * Returns ESIF_FALSE when the domain should be dropped from its batch.
+ */
+Bool EsifUpDomain_SampleTemp(
+	EsifUpDomainPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr
 	)
 {
-	eEsifError rc = ESIF_OK;
-	EsifUpDomainPtr self = (EsifUpDomainPtr) ctx;
 	EsifDspPtr dspPtr = NULL;
-	EsifUpPtr upPtr = NULL;
-	UInt32 pollPeriod = 0;
-	
+
 	if (self == NULL) {
-		goto exit;
+		return ESIF_FALSE;
 	}
 
-	
 	/* check to see if anyone has killed the action manager or dsp manager
 	in between polls */
-	upPtr = EsifUpPm_GetAvailableParticipantByInstance(self->participantId);
-	if (upPtr == NULL) {
-		rc = ESIF_E_INVALID_HANDLE;
-		goto exit;
+	dspPtr = EsifUp_GetDsp(self->upPtr);
+	if ((dspPtr == NULL) || (dspPtr->type == NULL)) {
+		ESIF_TRACE_DEBUG("Stopping temp sampling on %s %s : %s(%d)\n", self->participantName, self->domainName, esif_rc_str(ESIF_E_INVALID_HANDLE), ESIF_E_INVALID_HANDLE);
+		return ESIF_FALSE;
 	}
 
-	dspPtr = EsifUp_GetDsp(upPtr);
-	if (dspPtr == NULL) {
-		rc = ESIF_E_INVALID_HANDLE;
-		goto exit;
-	}
+	EsifUpDomain_CheckTempResolved(self, resolvedPtr);
 
-	if (dspPtr->type == NULL) {
-		rc = ESIF_E_INVALID_HANDLE;
-		goto exit;
-	}
-	
-	rc = EsifUpDomain_CheckTemp(self);
-	
-	/* If another type of polling was started, skip the timer reset */
+	/* If another type of polling was started, stop sampling */
 	if (self->tempPollType != ESIF_POLL_DOMAIN) {
-		goto exit;
+		return ESIF_FALSE;
 	}
 
-	if (self->tempPollPeriod > 0 && EsifUpDomain_AnyTempThresholdValid(self)) {
-		if (self->tempPollInitialized == ESIF_TRUE) {
-			pollPeriod = (self->tempInvalidValueDetected && (self->tempPollPeriod < ESIF_DOMAIN_TEMP_INVALID_POLL_PERIOD)) ? self->tempPollPeriod : self->tempPollPeriod;
-			rc = esif_ccb_timer_set_msec(&self->tempPollTimer,
-				pollPeriod);
-		}
-		else {
-			rc = EsifUpDomain_StartTempPollPriv(self);
-		}
-	}
-exit:
-	if (upPtr != NULL) {
-		EsifUp_PutRef(upPtr);
-	}
-
-	if (rc != ESIF_OK) {
-		ESIF_TRACE_DEBUG("Unable to set poll timer on %s %s : %s(%d)\n", self->participantName, self->domainName, esif_rc_str(rc), rc);
-	}
+	return (self->tempPollPeriod > 0 && EsifUpDomain_AnyTempThresholdValid(self)) ? ESIF_TRUE : ESIF_FALSE;
 }
 
 eEsifError EsifUpDomain_InitTempPoll(
@@ -1091,14 +1091,9 @@ static eEsifError EsifUpDomain_StartTempPollPriv(
 		self->participantName,
 		self->domainName);
 
-	rc = esif_ccb_timer_init(&self->tempPollTimer, (esif_ccb_timer_cb)EsifUpDomain_PollTemp, self);
-	if (ESIF_OK != rc)
-		goto exit;
-		
 	self->tempPollInitialized = ESIF_TRUE;
 	self->tempPollType = ESIF_POLL_DOMAIN;
-	rc = esif_ccb_timer_set_msec(&self->tempPollTimer,
-		self->tempPollPeriod);
+	rc = EsifSampler_AddDomain(self, ESIF_SAMPLE_TEMP, self->tempPollPeriod);
 
 exit:
 	if (rc != ESIF_OK) {
@@ -1137,15 +1132,11 @@ static eEsifError EsifUpDomain_StartStatePollPriv(
 			self->participantName,
 			self->domainName);
 
-		rc = esif_ccb_timer_init(&self->statePollTimer, (esif_ccb_timer_cb) EsifUpDomain_PollState, self);
-		if (ESIF_OK != rc)
-			goto exit;
-
 		self->statePollInitialized = ESIF_TRUE;
 		self->statePollType = ESIF_POLL_DOMAIN;
 	}
 	
-	rc = esif_ccb_timer_set_msec(&self->statePollTimer, self->statePollPeriod);
+	rc = EsifSampler_AddDomain(self, ESIF_SAMPLE_STATE, self->statePollPeriod);
 	
 exit:
 	if (rc != ESIF_OK) {
@@ -1221,6 +1212,8 @@ void EsifUpDomain_UnRegisterForStatePoll(EsifUpDomainPtr self)
 void EsifUpDomain_UnInitDomain(EsifUpDomainPtr self)
 {
 	if (self != NULL) {
+		EsifSampler_RemoveDomain(self, ESIF_SAMPLE_TEMP);
+		EsifSampler_RemoveDomain(self, ESIF_SAMPLE_STATE);
 		esif_ccb_lock_uninit(&self->capsLock);
 		esif_ccb_lock_uninit(&self->tempLock);
 	}
@@ -1230,7 +1223,7 @@ void EsifUpDomain_StopTempPoll(
 	EsifUpDomainPtr self
 	)
 {
-	esif_ccb_timer_kill_w_wait(&self->tempPollTimer);
+	EsifSampler_RemoveDomain(self, ESIF_SAMPLE_TEMP);
 
 	self->tempPollInitialized = ESIF_FALSE;
 	self->tempPollType = ESIF_POLL_NONE;
@@ -1248,8 +1241,7 @@ eEsifError EsifUpDomain_SetTempPollPeriod(
 	self->tempPollPeriod = sampleTime;
 	if (sampleTime > 0) {
 		if (self->tempPollInitialized == ESIF_TRUE) {
-			rc = esif_ccb_timer_set_msec(&self->tempPollTimer,
-				self->tempPollPeriod);
+			rc = EsifSampler_AddDomain(self, ESIF_SAMPLE_TEMP, self->tempPollPeriod);
 		}
 		else {
 			rc = EsifUpDomain_StartTempPollPriv(self);
@@ -45,6 +45,7 @@ typedef enum EsifDomainPollType_e {
 
 
 struct _t_EsifUp;
+struct _t_EsifUpResolvedPrimitive;
 
 typedef struct EsifUpDomain_s {
 	UInt16 domain;						/* Domain ID */
@@ -62,7 +63,6 @@ typedef struct EsifUpDomain_s {
 	/* Temperature detection */
 	esif_ccb_lock_t tempLock;
 
-	esif_ccb_timer_t tempPollTimer;		/* Temperature Polling Timer  */
 	UInt32 tempPollPeriod;				/* Temperature polling interval: 0-disabled */
 
 	esif_temp_t virtTemp;				/* Virtual Temperature */
@@ -76,9 +76,8 @@ typedef struct EsifUpDomain_s {
 										*/
 	EsifDomainPollTypeId tempPollType;	/* Single threaded, multi threaded, or none */
 	UInt8 tempPollInitialized;			/*
-										 * Indicates that the temperature polling timer has been initialized,
-										 * since our current timer implementation does not support kill > restart.
-										 * This should remain set until the timer object is killed, even if polling 
+										 * Indicates that temperature sampling has been started for the domain.
+										 * This should remain set until polling is stopped, even if polling
 										 * is suspended.
 										 */
 	UInt8 tempLastTempValid;			/*
@@ -96,7 +95,6 @@ typedef struct EsifUpDomain_s {
 	UInt32 lastState;					/* check perf participants for state change */
 	/* Perf state detection */
 	esif_ccb_lock_t stateLock;
-	esif_ccb_timer_t statePollTimer;	/* Timer for polling participant for state change  */
 	UInt32 statePollPeriod;				/* Perf state polling interval: 0-disabled */
 	EsifDomainPollTypeId statePollType;	/* Single threaded, multi threaded, or none */
 	UInt8 statePollInitialized;
@@ -153,6 +151,14 @@ eEsifError EsifUpDomain_CheckTemp(EsifUpDomainPtr self);
 
 eEsifError EsifUpDomain_CheckState(EsifUpDomainPtr self);
 
+/*
+ * Sampler callbacks; return ESIF_FALSE to stop sampling the domain.
+ * resolvedPtr is the read the sampler keeps for the domain between samples.
+ */
+Bool EsifUpDomain_SampleTemp(EsifUpDomainPtr self, struct _t_EsifUpResolvedPrimitive *resolvedPtr);
+
+Bool EsifUpDomain_SampleState(EsifUpDomainPtr self, struct _t_EsifUpResolvedPrimitive *resolvedPtr);
+
 void EsifUpDomain_RegisterForTempPoll(EsifUpDomainPtr self, EsifDomainPollTypeId pollType);
 
 void EsifUpDomain_UnRegisterForTempPoll(EsifUpDomainPtr self);
@@ -45,6 +45,9 @@
 
 #define MIN_VIABLE_DSP_WEIGHT 1
 
+/* Event GUID Hash Is Sized At Load Time To Keep Chains Short */
+#define MAX_DSP_EVENT_HASHTABLE_SIZE 4096
+
 enum dspSelectorWeight {
 	ACPI_HID_WEIGHT = 10,
 	ACPI_PTYPE_WEIGHT = 18,
@@ -99,6 +102,7 @@ static void esif_dsp_destroy(EsifDspPtr dspPtr)
 	esif_link_list_destroy(dspPtr->domain_ptr);
 	esif_link_list_destroy(dspPtr->cap_ptr);
 	esif_link_list_destroy(dspPtr->evt_ptr);
+	esif_ht_destroy(dspPtr->evt_guid_ht, NULL);
 	esif_ccb_free(dspPtr);
 }
 
@@ -251,35 +255,63 @@ static EsifFpcActionPtr get_action(
 }
 
 
-/* Insert Algorithm Into Linked List */
+/* Insert Algorithm Into Linked List And Index It By Action Type */
 static eEsifError insert_algorithm(
 	EsifDspPtr dspPtr,
 	EsifFpcAlgorithmPtr algoPtr
 	)
 {
+	eEsifError rc = ESIF_OK;
+
 	if ((NULL == dspPtr) || (NULL == algoPtr)) {
 		return ESIF_E_PARAMETER_IS_NULL;
 	}
 
-	return esif_link_list_add_at_back(dspPtr->algo_ptr, (void *)algoPtr);
+	rc = esif_link_list_add_at_back(dspPtr->algo_ptr, (void *)algoPtr);
+
+	/* First Algorithm For A Type Wins, As With The List Search */
+	if ((ESIF_OK == rc) &&
+		((UInt32)algoPtr->action_type < (sizeof(dspPtr->algo_by_type) / sizeof(*dspPtr->algo_by_type))) &&
+		(NULL == dspPtr->algo_by_type[algoPtr->action_type])) {
+		dspPtr->algo_by_type[algoPtr->action_type] = algoPtr;
+	}
+	return rc;
 }
 
 
-/* Insert Event Into Linked List */
+/* Insert Event Into Linked List And Index It By Type And GUID */
 static eEsifError insert_event(
 	EsifDspPtr dspPtr,
 	EsifFpcEventPtr evtPtr
 	)
 {
+	eEsifError rc = ESIF_OK;
+
 	if ((NULL == dspPtr) || (NULL == evtPtr)) {
 		return ESIF_E_PARAMETER_IS_NULL;
 	}
 
-	return esif_link_list_add_at_back(dspPtr->evt_ptr, (void *)evtPtr);
+	rc = esif_link_list_add_at_back(dspPtr->evt_ptr, (void *)evtPtr);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	/* First Event For A Type Or GUID Wins, As With The List Search */
+	if (((UInt32)evtPtr->esif_event < (sizeof(dspPtr->evt_by_type) / sizeof(*dspPtr->evt_by_type))) &&
+		(NULL == dspPtr->evt_by_type[evtPtr->esif_event])) {
+		dspPtr->evt_by_type[evtPtr->esif_event] = evtPtr;
+	}
+
+	if ((dspPtr->evt_guid_ht != NULL) &&
+		(NULL == esif_ht_get_item(dspPtr->evt_guid_ht, (u8 *)evtPtr->event_guid, ESIF_GUID_LEN))) {
+		rc = esif_ht_add_item(dspPtr->evt_guid_ht, (u8 *)evtPtr->event_guid, ESIF_GUID_LEN, evtPtr);
+	}
+exit:
+	return rc;
 }
 
 
-/* Get Algorithm From Linked List */
+/* Get Algorithm By Action Type */
 static EsifFpcAlgorithmPtr get_algorithm(
 	EsifDspPtr dspPtr,
 	const enum esif_action_type actionType
@@ -293,6 +325,11 @@ static EsifFpcAlgorithmPtr get_algorithm(
 		return NULL;
 	}
 
+	if ((UInt32)actionType < (sizeof(dspPtr->algo_by_type) / sizeof(*dspPtr->algo_by_type))) {
+		return dspPtr->algo_by_type[actionType];
+	}
+
+	/* Types Outside The Table Are Not Indexed */
 	listPtr = dspPtr->algo_ptr;
 	currPtr = listPtr->head_ptr;
 
@@ -309,7 +346,7 @@ static EsifFpcAlgorithmPtr get_algorithm(
 }
 
 
-/* Get Event From Linked List By Type */
+/* Get Event By Type */
 static EsifFpcEventPtr get_event_by_type(
 	EsifDspPtr dspPtr,
 	const enum esif_event_type eventType
@@ -323,6 +360,11 @@ static EsifFpcEventPtr get_event_by_type(
 		return NULL;
 	}
 
+	if ((UInt32)eventType < (sizeof(dspPtr->evt_by_type) / sizeof(*dspPtr->evt_by_type))) {
+		return dspPtr->evt_by_type[eventType];
+	}
+
+	/* Types Outside The Table Are Not Indexed */
 	listPtr = dspPtr->evt_ptr;
 	currPtr = listPtr->head_ptr;
 
@@ -339,33 +381,16 @@ static EsifFpcEventPtr get_event_by_type(
 }
 
 
-/* Get Event From Linked List By GUID */
+/* Get Event By GUID */
 EsifFpcEventPtr get_event_by_guid(
 	EsifDspPtr dspPtr,
 	const esif_guid_t guid
 	)
 {
-	struct esif_link_list *listPtr      = NULL;
-	struct esif_link_list_node *currPtr = NULL;
-	EsifFpcEventPtr curEvtPtr  = NULL;
-
-	if (NULL == dspPtr) {
-		goto exit;
-	}
-	listPtr = dspPtr->evt_ptr;
-	currPtr = listPtr->head_ptr;
-
-	while (currPtr) {
-		curEvtPtr = (EsifFpcEventPtr)currPtr->data_ptr;
-		if (curEvtPtr != NULL) {
-			if (memcmp(curEvtPtr->event_guid, guid, ESIF_GUID_LEN) == 0) {
-				return curEvtPtr;
-			}
-		}
-		currPtr = currPtr->next_ptr;
+	if ((NULL == dspPtr) || (NULL == dspPtr->evt_guid_ht)) {
+		return NULL;
 	}
-exit:
-	return NULL;
+	return (EsifFpcEventPtr)esif_ht_get_item(dspPtr->evt_guid_ht, (u8 *)guid, ESIF_GUID_LEN);
 }
 
 
@@ -508,8 +533,11 @@ eEsifError esif_fpc_load(
 	dspPtr->domain_ptr = esif_link_list_create();
 	dspPtr->cap_ptr    = esif_link_list_create();
 	dspPtr->evt_ptr    = esif_link_list_create();
+	dspPtr->evt_guid_ht = esif_ht_create(esif_ccb_min(
+		esif_ccb_max(ESIF_DSP_HASHTABLE_SIZE, (fpcPtr->number_of_events * 2) + 1),
+		MAX_DSP_EVENT_HASHTABLE_SIZE));
 
-	if (!dspPtr->ht_ptr || !dspPtr->algo_ptr || !dspPtr->domain_ptr || !dspPtr->cap_ptr || !dspPtr->evt_ptr) {
+	if (!dspPtr->ht_ptr || !dspPtr->algo_ptr || !dspPtr->domain_ptr || !dspPtr->cap_ptr || !dspPtr->evt_ptr || !dspPtr->evt_guid_ht) {
 		ESIF_TRACE_ERROR("Fail to allocate linked list or hash table\n");
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
@@ -939,6 +967,7 @@ static eEsifError esif_dsp_table_build()
 	eEsifError rc = ESIF_OK;
 	ESIF_TRACE_INFO("Build DSP Table");
 	rc = esif_dsp_file_scan();
+	atomic_inc(&g_dm.generation);
 	return rc;
 }
 
@@ -947,6 +976,7 @@ void esif_dsp_table_destroy()
 {
 	UInt8 i;
 	ESIF_TRACE_INFO("Destroy DSP Table");
+	atomic_inc(&g_dm.generation);
 	for (i = 0; i < g_dm.dme_count; i++) {
 		esif_dsp_destroy(g_dm.dme[i].dsp_ptr);
 		esif_ccb_free(g_dm.dme[i].file_ptr);
@@ -1030,6 +1060,48 @@ EsifString GetDSPFromList(
 	return selection;
 }
 
+/* Get Lookup Table Statistics For The DSP In The Given Manager Slot */
+eEsifError EsifDspMgr_GetLookupStats(
+	UInt8 index,
+	EsifDspLookupStatsPtr statsPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifDspPtr dspPtr = NULL;
+	UInt32 i = 0;
+
+	if (NULL == statsPtr) {
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+	esif_ccb_memset(statsPtr, 0, sizeof(*statsPtr));
+
+	esif_ccb_read_lock(&g_dm.lock);
+
+	dspPtr = (index < MAX_DSP_MANAGER_ENTRY) ? g_dm.dme[index].dsp_ptr : NULL;
+	if (NULL == dspPtr) {
+		rc = ESIF_E_NOT_FOUND;
+		goto exit;
+	}
+
+	esif_ccb_strcpy(statsPtr->code, dspPtr->code_ptr, sizeof(statsPtr->code));
+	statsPtr->numAlgorithms = dspPtr->algo_ptr->nodes;
+	statsPtr->numEvents = dspPtr->evt_ptr->nodes;
+
+	for (i = 0; i < (sizeof(dspPtr->algo_by_type) / sizeof(*dspPtr->algo_by_type)); i++) {
+		statsPtr->numAlgorithmsIndexed += (dspPtr->algo_by_type[i] != NULL);
+	}
+	for (i = 0; i < (sizeof(dspPtr->evt_by_type) / sizeof(*dspPtr->evt_by_type)); i++) {
+		statsPtr->numEventsIndexed += (dspPtr->evt_by_type[i] != NULL);
+	}
+
+	esif_ht_get_stats(dspPtr->ht_ptr, &statsPtr->primitiveStats);
+	esif_ht_get_stats(dspPtr->evt_guid_ht, &statsPtr->eventGuidStats);
+exit:
+	esif_ccb_read_unlock(&g_dm.lock);
+	return rc;
+}
+
+
 EsifString EsifDspMgr_SelectDsp(
 	EsifDspQuery query
 	)
@@ -1151,6 +1223,12 @@ enum dspSelectorWeight weight
 	return score;
 }
 
+UInt32 EsifDspMgr_GetGeneration(void)
+{
+	return (UInt32)atomic_read(&g_dm.generation);
+}
+
+
 eEsifError EsifDspMgrInit(void)
 {
 	eEsifError rc = ESIF_OK;
@@ -23,8 +23,10 @@
 #include "esif_event.h"
 #include "esif_ccb_atomic.h"
 #include "esif_uf_eventmgr.h"
-#include "esif_queue.h"
+#include "esif_ring.h"
+#include "esif_ccb_time.h"
 #include "esif_uf_sensors.h"
+#include "esif_uf_handlemgr.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -35,23 +37,120 @@
 #include "win\banned.h"
 #endif
 
-#define NUM_EVENT_LISTS 64
 #define EVENT_MGR_FILTERED_EVENTS_PER_LINE 64
 #define EVENT_MGR_ITERATOR_MARKER 'UFEM'
 
+/* Observers are indexed directly by event type; the last index holds all event types beyond the known range */
+#define EVENT_MGR_UNKNOWN_EVENT_INDEX (MAX_ESIF_EVENT_ENUM_VALUE + 1)
+#define EVENT_MGR_NUM_EVENT_INDEXES (EVENT_MGR_UNKNOWN_EVENT_INDEX + 1)
+#define EsifEventMgr_EventIndex(eventType) \
+	(((unsigned)(eventType) <= MAX_ESIF_EVENT_ENUM_VALUE) ? (unsigned)(eventType) : EVENT_MGR_UNKNOWN_EVENT_INDEX)
+
+/*
+ * Observer set buckets: bucket 0 holds observers for EVENT_MGR_MATCH_ANY; the
+ * remaining buckets hold observers hashed by participant ID (Must be a power of 2)
+ */
+#define EVENT_MGR_OBSERVER_BUCKETS 16
+#define EVENT_MGR_MATCH_ANY_BUCKET 0
+
+/* Storage used for the payload of a queued event */
+typedef enum EsifEventDataStorage_e {
+	ESIF_EVENT_DATA_NONE = 0,
+	ESIF_EVENT_DATA_INLINE,
+	ESIF_EVENT_DATA_SLAB,
+	ESIF_EVENT_DATA_HEAP,
+} EsifEventDataStorage;
+
+/*
+ * Pool of fixed-size payload buffers. Free buffers are tracked by pointer in
+ * a ring so that producers may allocate and the queue thread may release
+ * without locking.
+ */
+typedef struct EsifEventSlab_s {
+	UInt8 *buffersPtr;
+	EsifRingPtr freeRingPtr;
+} EsifEventSlab, *EsifEventSlabPtr;
+
+/*
+ * Event delivery worker.  Each worker drains its own queue, so a slow observer
+ * only delays events for the participants assigned to that worker.
+ */
+typedef struct EsifEventWorker_s {
+	UInt32 index;
+	EsifRingPtr queuePtr;
+	esif_thread_t thread;
+	Bool isStarted;
+	atomic_t isBusy;			/* Set while the worker is dispatching an event */
+
+	/* Latency statistics; only updated by the worker thread */
+	atomic64_t latencyTotalUsec;
+	atomic64_t latencyCount;
+	atomic64_t latencyMinUsec;
+	atomic64_t latencyMaxUsec;
+	atomic64_t lastLatencyUsec;
+} EsifEventWorker, *EsifEventWorkerPtr;
+
+typedef struct EventMgrEntry_s *EventMgrEntryPtr;
+
+/*
+ * Immutable snapshot of the observers for a single event type, grouped into
+ * buckets by participant.  A new set is published each time the observers
+ * change; readers hold a reference while dispatching so that the set (and the
+ * entries it references) remain valid without holding the list lock.
+ */
+typedef struct EventMgrObserverSet_s {
+	atomic_t refCount;		/* One reference while published, plus one per active reader */
+	UInt32 count;			/* Number of entries */
+	UInt32 bucketStart[EVENT_MGR_OBSERVER_BUCKETS + 1];	/* Index of the first entry in each bucket; last is count */
+	EventMgrEntryPtr entries[1];	/* Variable length; grouped by bucket */
+} EventMgrObserverSet, *EventMgrObserverSetPtr;
+
+/*
+ * Serializes the callbacks of an observer not registered as reentrant.  An
+ * observer is identified by its callback and context, so every entry it
+ * registers (one per event type) shares one lock, while other observers are
+ * still called concurrently.
+ */
+typedef struct EventMgrObserverLock_s {
+	EVENT_OBSERVER_CALLBACK callback;
+	esif_context_t context;
+	UInt32 refCount;			/* Number of entries using the lock; updated under observerLocksLock */
+	esif_ccb_mutex_t lock;		/* Held while the observer callback runs */
+	struct EventMgrObserverLock_s *nextPtr;
+} EventMgrObserverLock, *EventMgrObserverLockPtr;
+
 typedef struct EsifEventMgr_s {
-	EsifLinkListPtr observerLists[NUM_EVENT_LISTS];
+	EsifLinkListPtr observerLists[EVENT_MGR_NUM_EVENT_INDEXES];	/* Registered observers; updated under listLock */
 	esif_ccb_lock_t listLock;
 
+	EventMgrObserverSetPtr observerSets[EVENT_MGR_NUM_EVENT_INDEXES];	/* Published observer sets used for dispatch */
+	esif_ccb_lock_t setLock;	/* Only held while publishing or acquiring a set */
+
 	EsifLinkListPtr garbageList;
+	esif_ccb_lock_t garbageLock;
+
+	EventMgrObserverLockPtr observerLocks;	/* Serial locks of observers not registered as reentrant */
+	esif_ccb_lock_t observerLocksLock;
 
-	EsifQueuePtr eventQueuePtr;
+	EsifEventWorker workers[ESIF_UF_EVENT_WORKERS_MAX];
+	UInt32 workerCount;			/* Number of workers with a queue; fixed after initialization */
+
+	/*
+	 * LF participant instance + 1 of each UF participant, indexed by the handle part of its UF instance;
+	 * 0 if the participant was not created for an LF participant.  Set by the participant manager when
+	 * the participant is indexed, so selecting a worker needs no participant manager lock.
+	 */
+	UInt8 participantLpids[ESIF_HNDLMGR_MAX_HANDLES];
+	EsifEventSlab payloadSlab;	/* Shared by all workers */
+
+	/* Payload statistics */
+	atomic64_t inlinePayloads;
+	atomic64_t slabPayloads;
+	atomic64_t heapPayloads;
 
 	Bool eventQueueExitFlag;
 	Bool eventsDisabled;
 
-	esif_thread_t eventQueueThread;
-
 	UInt64 filteredEvents[(MAX_ESIF_EVENT_ENUM_VALUE / EVENT_MGR_FILTERED_EVENTS_PER_LINE) + 1];
 }EsifEventMgr, *EsifEventMgrPtr;
 
@@ -65,11 +164,18 @@ typedef struct EventMgrEntry_s {
 										 * Expected to act as a context for the callback, an event observer identifier,
 										 * and to help uniquely identify an event observer while unregistering.
 										 */
-	atomic_t refCount;					/* Reference count */
-	Bool isInUse;						/* Indicates the event is being processed */
-	Bool markedForDelete;				/* Indicates the event is marked for deletion */
-} EventMgrEntry, *EventMgrEntryPtr;
+	atomic_t refCount;					/* Registration reference count */
+	atomic_t setRefCount;				/* One reference while in the observer list, plus one per observer set */
+	atomic_t markedForDelete;			/* Indicates the event has been removed from the observer list */
+	Bool isReentrant;					/* Callback may run on several workers at once */
+	EventMgrObserverLockPtr observerLockPtr;	/* Serializes the observer callback; NULL if reentrant */
+} EventMgrEntry;
 
+/*
+ * Queued events are copied by value into the event queue ring.  For inline
+ * payloads, eventData.buf_ptr is not valid until the item has been copied out
+ * of the queue and EsifEventMgr_GetQueueItemData is called.
+ */
 typedef struct EsifEventQueueItem_s {
 	esif_handle_t participantId;
 	UInt16 domainId;
@@ -77,11 +183,20 @@ typedef struct EsifEventQueueItem_s {
 	EsifData eventData;
 	Bool isLfEvent;
 	Bool isUnfiltered;
+	EsifEventDataStorage dataStorage;
+	esif_ccb_realtime_t queuedTime;
+	UInt8 inlineData[ESIF_UF_EVENT_INLINE_DATA_SIZE];
 }EsifEventQueueItem, *EsifEventQueueItemPtr;
 
 
 /*
  * All event received are asynchronous and placed in an event queue to be handled by a worker thread.
+ * There is a pool of workers (g_esifEventWorkers), each with its own queue.  Events are assigned to a worker
+ * by participant, so events for a participant are delivered in order while events for other participants
+ * are delivered concurrently; observers may therefore be called from more than one thread at a time.
+ * Each queue is a bounded lock-free ring of fixed-size items; small payloads are stored inline in
+ * the item and larger payloads in a pooled slab, so signaling an event does not normally allocate.
+ * If a queue is full, the event is dropped and counted (see EsifEventMgr_GetQueueStats).
  *
  * The manager maintains information on registered event "observers"
  * Interface:
@@ -89,8 +204,12 @@ typedef struct EsifEventQueueItem_s {
  *   EsifEventMgr_RegisterEventByType
  *   EsifEventMgr_UnregisterEventByType
  *
- * Event observer information is maintained as an array of linked lists with a list of observers the event types
- * There are 64 event lists (Information is placed in a given list given by the modulo 64 of the event type)
+ * Event observer information is maintained as an array of linked lists indexed directly by event type.
+ * The lists are only used for registration and iteration, under the list lock.  Each time a list changes, an
+ * immutable observer set is built from it and published for dispatch.  The set groups observers into buckets by
+ * participant, so dispatch only visits the EVENT_MGR_MATCH_ANY bucket and the bucket for the event participant.
+ * Dispatch acquires a reference to the published set (briefly holding the set lock for read) and then calls the
+ * observers without holding any lock, so registration and unregistration never wait for event delivery.
  * Event observers may register based on the event type or GUID.
  * EVENT_MGR_MATCH_ANY may be used as the participant ID during registration to observe events from all participants;
  * or if registration takes place before the participants are present.
@@ -98,9 +217,9 @@ typedef struct EsifEventQueueItem_s {
  * Locks are released before any calls outside the event manager which may result in obtaining other locks;
  * locks re-acquired upon return.
  * A reference count is kept for each observer; events are only sent to observers with a positive reference count
- * When the reference count reaches 0, the node is garbage collected
- * Before an observer is called, the reference count is incremented so that the node is not removed while in use;
- * the reference count is decrement upon return and the node is garbage collected if the reference count is then 0.
+ * When the reference count reaches 0, the observer is removed from its list and a new set is published.
+ * The entry is garbage collected once no observer set references it, so an observer removed during dispatch
+ * remains valid until the dispatch completes.
  * A single garbage collection linked list is maintained.  Any garbage nodes are moved to that list for destruction.
  * Any steps required to enable/disable an event, for example DPPE, will be performed during creation/destruction.
  * Simulation Support:
@@ -110,14 +229,26 @@ typedef struct EsifEventQueueItem_s {
 
 static EsifEventMgr g_EsifEventMgr = {0};
 
+UInt32 g_esifEventWorkers = ESIF_UF_EVENT_WORKERS_DEFAULT;
+
 
 
+static eEsifError EsifEventMgr_RegisterEvent(
+	eEsifEventType eventType,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	esif_context_t context,
+	Bool isReentrant
+	);
+
 static eEsifError EsifEventMgr_AddEntry(
 	EsifFpcEventPtr fpcEventPtr,
 	esif_handle_t participantId,
 	UInt16 domainId,
 	EVENT_OBSERVER_CALLBACK eventCallback,
-	esif_context_t context
+	esif_context_t context,
+	Bool isReentrant
 	);
 
 static eEsifError EsifEventMgr_ReleaseEntry(
@@ -139,7 +270,23 @@ static eEsifError EsifEventMgr_EnableEvent(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_DisableEvent(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr);
 static eEsifError EsifEventMgr_DumpGarbage();
+static void EsifEventMgr_RemoveEntry_Locked(EsifLinkListPtr listPtr, EsifLinkListNodePtr nodePtr);
+static void EsifEventMgr_ReleaseEntryRef(EventMgrEntryPtr entryPtr);
+static void EsifEventMgr_FreeEntry(EventMgrEntryPtr entryPtr);
+static EventMgrObserverLockPtr EsifEventMgr_AcquireObserverLock(EVENT_OBSERVER_CALLBACK callback, esif_context_t context);
+static void EsifEventMgr_ReleaseObserverLock(EventMgrObserverLockPtr observerLockPtr);
+static eEsifError EsifEventMgr_PublishObserverSet_Locked(UInt32 index);
+static EventMgrObserverSetPtr EsifEventMgr_AcquireObserverSet(UInt32 index);
+static void EsifEventMgr_ReleaseObserverSet(EventMgrObserverSetPtr setPtr);
+static UInt32 EsifEventMgr_GetObserverBucket(esif_handle_t participantId);
 static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr);
+static eEsifError EsifEventMgr_AllocQueueItemData(EsifEventQueueItemPtr queueEventPtr, const EsifDataPtr eventDataPtr);
+static void EsifEventMgr_ReleaseQueueItemData(EsifEventQueueItemPtr queueEventPtr);
+static EsifDataPtr EsifEventMgr_GetQueueItemData(EsifEventQueueItemPtr queueEventPtr);
+static void EsifEventMgr_UpdateLatency(EsifEventWorkerPtr workerPtr, EsifEventQueueItemPtr queueEventPtr);
+static EsifEventWorkerPtr EsifEventMgr_GetWorker(esif_handle_t participantId, Bool isLfEvent);
+static eEsifError EsifEventMgr_SlabCreate(EsifEventSlabPtr slabPtr);
+static void EsifEventMgr_SlabDestroy(EsifEventSlabPtr slabPtr);
 static void EsifEventMgr_LLEntryDestroyCallback(void *dataPtr);
 
 static eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local (
@@ -212,8 +359,8 @@ eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifEventQueueItemPtr queueEventPtr = NULL;
-	void *queueDataPtr = NULL;
+	EsifEventQueueItem queueEvent = {0};
+	EsifEventWorkerPtr workerPtr = NULL;
 
 	/* Exit if filtered event */
 	if (isFilteredEvent && EsifEventMgr_IsEventFiltered(eventType)) {
@@ -221,82 +368,301 @@ eEsifError ESIF_CALLCONV EsifEventMgr_SignalEvent_Local(
 		goto exit;
 	}
 
-	if (NULL == g_EsifEventMgr.eventQueuePtr) { /* Should never happen */
+	workerPtr = EsifEventMgr_GetWorker(participantId, isLfEvent);
+	if (NULL == workerPtr) { /* Should never happen */
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
 	}
 
-	queueEventPtr = esif_ccb_malloc(sizeof(*queueEventPtr));
-	if (NULL == queueEventPtr) {
-		rc = ESIF_E_NO_MEMORY;
+	rc = EsifEventMgr_AllocQueueItemData(&queueEvent, eventDataPtr);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	queueEvent.participantId = participantId;
+	queueEvent.domainId = domainId;
+	queueEvent.eventType = eventType;
+	queueEvent.isLfEvent = isLfEvent;
+	queueEvent.queuedTime = esif_ccb_realtime_current();
+
+	ESIF_TRACE_INFO("Queuing %s event for Part. %u Dom. 0x%04X on worker %u\n",
+		esif_event_type_str(eventType),
+		participantId,
+		domainId,
+		workerPtr->index);
+
+	rc = esif_ring_enqueue(workerPtr->queuePtr, &queueEvent);
+	if (rc != ESIF_OK) {
+		ESIF_TRACE_WARN("Event queue full; dropping %s event for Part. %u Dom. 0x%04X\n",
+			esif_event_type_str(eventType),
+			participantId,
+			domainId);
+		EsifEventMgr_ReleaseQueueItemData(&queueEvent);
+		goto exit;
+	}
+exit:
+	return rc;
+}
+
+
+/*
+ * Copies the event payload into the queue item, choosing inline, slab or heap
+ * storage based on the payload size and slab availability
+ */
+static eEsifError EsifEventMgr_AllocQueueItemData(
+	EsifEventQueueItemPtr queueEventPtr,
+	const EsifDataPtr eventDataPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	void *queueDataPtr = NULL;
+	UInt32 dataLen = 0;
+
+	ESIF_ASSERT(queueEventPtr != NULL);
+
+	queueEventPtr->dataStorage = ESIF_EVENT_DATA_NONE;
+
+	if ((NULL == eventDataPtr) ||
+		(NULL == eventDataPtr->buf_ptr) ||
+		(0 == eventDataPtr->buf_len) ||
+		(0 == eventDataPtr->data_len) ||
+		(eventDataPtr->buf_len < eventDataPtr->data_len)) {
 		goto exit;
 	}
 
-	if ((eventDataPtr != NULL) &&
-		(eventDataPtr->buf_ptr != NULL) &&
-		(eventDataPtr->buf_len > 0) &&
-		(eventDataPtr->data_len > 0) &&
-		(eventDataPtr->buf_len >= eventDataPtr->data_len)) {
+	dataLen = eventDataPtr->data_len;
 
-		queueDataPtr = esif_ccb_malloc(eventDataPtr->data_len);
+	if (dataLen <= sizeof(queueEventPtr->inlineData)) {
+		queueEventPtr->dataStorage = ESIF_EVENT_DATA_INLINE;
+		queueDataPtr = queueEventPtr->inlineData;
+		atomic64_inc(&g_EsifEventMgr.inlinePayloads);
+	}
+	else if ((dataLen <= ESIF_UF_EVENT_SLAB_ITEM_SIZE) &&
+		(esif_ring_dequeue(g_EsifEventMgr.payloadSlab.freeRingPtr, &queueDataPtr) == ESIF_OK)) {
+		queueEventPtr->dataStorage = ESIF_EVENT_DATA_SLAB;
+		atomic64_inc(&g_EsifEventMgr.slabPayloads);
+	}
+	else {
+		queueDataPtr = esif_ccb_malloc(dataLen);
 		if (NULL == queueDataPtr) {
 			rc = ESIF_E_NO_MEMORY;
 			goto exit;
 		}
+		queueEventPtr->dataStorage = ESIF_EVENT_DATA_HEAP;
+		atomic64_inc(&g_EsifEventMgr.heapPayloads);
+	}
+
+	esif_ccb_memcpy(queueDataPtr, eventDataPtr->buf_ptr, dataLen);
+
+	queueEventPtr->eventData.type = eventDataPtr->type;
+	queueEventPtr->eventData.buf_ptr = queueDataPtr;
+	queueEventPtr->eventData.buf_len = dataLen;
+	queueEventPtr->eventData.data_len = dataLen;
+exit:
+	return rc;
+}
 
-		esif_ccb_memcpy(queueDataPtr, eventDataPtr->buf_ptr, eventDataPtr->data_len);
 
-		queueEventPtr->eventData.type = eventDataPtr->type;
-		queueEventPtr->eventData.buf_ptr = queueDataPtr;
-		queueEventPtr->eventData.buf_len = eventDataPtr->data_len;
-		queueEventPtr->eventData.data_len = eventDataPtr->data_len;
+/* Must be called on the copy of the item removed from the queue */
+static EsifDataPtr EsifEventMgr_GetQueueItemData(
+	EsifEventQueueItemPtr queueEventPtr
+	)
+{
+	ESIF_ASSERT(queueEventPtr != NULL);
+
+	if (ESIF_EVENT_DATA_INLINE == queueEventPtr->dataStorage) {
+		queueEventPtr->eventData.buf_ptr = queueEventPtr->inlineData;
 	}
+	return &queueEventPtr->eventData;
+}
 
-	queueEventPtr->participantId = participantId;
-	queueEventPtr->domainId = domainId;
-	queueEventPtr->eventType = eventType;
-	queueEventPtr->isLfEvent = isLfEvent;
 
-	ESIF_TRACE_INFO("Queuing %s event for Part. %u Dom. 0x%04X\n",
-		esif_event_type_str(eventType),
-		participantId,
-		domainId);
+static void EsifEventMgr_ReleaseQueueItemData(
+	EsifEventQueueItemPtr queueEventPtr
+	)
+{
+	void *queueDataPtr = NULL;
 
-	rc = esif_queue_enqueue(g_EsifEventMgr.eventQueuePtr, queueEventPtr);
-	if (rc != ESIF_OK) {
-		goto exit;
+	if (NULL == queueEventPtr) {
+		return;
 	}
 
-exit:
-	if (rc != ESIF_OK) {
-		esif_ccb_free(queueEventPtr);
+	queueDataPtr = queueEventPtr->eventData.buf_ptr;
+
+	switch (queueEventPtr->dataStorage) {
+	case ESIF_EVENT_DATA_SLAB:
+		esif_ring_enqueue(g_EsifEventMgr.payloadSlab.freeRingPtr, &queueDataPtr);
+		break;
+	case ESIF_EVENT_DATA_HEAP:
 		esif_ccb_free(queueDataPtr);
+		break;
+	case ESIF_EVENT_DATA_INLINE:
+	case ESIF_EVENT_DATA_NONE:
+	default:
+		break;
+	}
+	queueEventPtr->dataStorage = ESIF_EVENT_DATA_NONE;
+	queueEventPtr->eventData.buf_ptr = NULL;
+}
+
+
+/* Called only from the worker thread */
+static void EsifEventMgr_UpdateLatency(
+	EsifEventWorkerPtr workerPtr,
+	EsifEventQueueItemPtr queueEventPtr
+	)
+{
+	UInt64 latency = esif_ccb_realtime_diff_usec(queueEventPtr->queuedTime, esif_ccb_realtime_current());
+
+	if ((0 == atomic64_read(&workerPtr->latencyCount)) ||
+		(latency < (UInt64)atomic64_read(&workerPtr->latencyMinUsec))) {
+		atomic64_set(&workerPtr->latencyMinUsec, (atomic64_basetype)latency);
+	}
+	if (latency > (UInt64)atomic64_read(&workerPtr->latencyMaxUsec)) {
+		atomic64_set(&workerPtr->latencyMaxUsec, (atomic64_basetype)latency);
+	}
+	atomic64_set(&workerPtr->lastLatencyUsec, (atomic64_basetype)latency);
+	atomic64_add((atomic64_basetype)latency, &workerPtr->latencyTotalUsec);
+	atomic64_inc(&workerPtr->latencyCount);
+}
+
+
+/* LF participant instance of a UF participant, or ESIF_INSTANCE_INVALID */
+static UInt8 EsifEventMgr_GetParticipantLpid(esif_handle_t participantId)
+{
+	UInt8 lpid = g_EsifEventMgr.participantLpids[(size_t)((UInt64)(size_t)participantId & ESIF_HNDLMGR_HANDLE_MASK)];
+	return (lpid ? (UInt8)(lpid - 1) : ESIF_INSTANCE_INVALID);
+}
+
+
+void EsifEventMgr_SetParticipantLpid(
+	esif_handle_t participantId,
+	UInt8 lpInstance
+	)
+{
+	if ((ESIF_INVALID_HANDLE == participantId) || EsifUpPm_IsPrimaryParticipantId(participantId)) {
+		return;
+	}
+	g_EsifEventMgr.participantLpids[(size_t)((UInt64)(size_t)participantId & ESIF_HNDLMGR_HANDLE_MASK)] =
+		(lpInstance != ESIF_INSTANCE_INVALID ? (UInt8)(lpInstance + 1) : 0);
+}
+
+
+/*
+ * Selects the worker which delivers events for a participant.  All primary
+ * participant IDs and EVENT_MGR_MATCH_ANY events are delivered by worker 0; other
+ * participants are spread across all workers.  A participant created for an LF
+ * participant is keyed by its LF participant ID whether the event was signaled
+ * by the LF (with the LF ID) or in the UF (with the UF instance).  The LF ID is
+ * known before the UF participant exists, so the creation event and every later
+ * event for that participant are delivered in order by the same worker.
+ * Participants which exist only in the UF are keyed by their UF instance.
+ * The LF ID of a UF participant is cached when the participant manager indexes
+ * it (see EsifEventMgr_SetParticipantLpid), so no lock is taken here.
+ */
+static EsifEventWorkerPtr EsifEventMgr_GetWorker(
+	esif_handle_t participantId,
+	Bool isLfEvent
+	)
+{
+	UInt64 key = 0;
+	UInt32 index = 0;
+	UInt8 lpInstance = ESIF_INSTANCE_INVALID;
+	Bool isPrimary = ESIF_FALSE;
+
+	if (0 == g_EsifEventMgr.workerCount) {
+		return NULL;
+	}
+
+	if (isLfEvent) {
+		lpInstance = (UInt8)participantId;
+		isPrimary = ((lpInstance == ESIF_INSTANCE_LF) || (lpInstance == ESIF_INSTANCE_INVALID));
+		key = lpInstance;
+	}
+	else {
+		isPrimary = ((participantId == EVENT_MGR_MATCH_ANY) || EsifUpPm_IsPrimaryParticipantId(participantId));
+		key = (UInt64)participantId;
+		if (!isPrimary && (g_EsifEventMgr.workerCount > 1)) {
+			lpInstance = EsifEventMgr_GetParticipantLpid(participantId);
+			if (lpInstance != ESIF_INSTANCE_INVALID) {
+				isPrimary = (lpInstance == ESIF_INSTANCE_LF);
+				key = lpInstance;
+			}
+		}
+	}
 
+	if ((g_EsifEventMgr.workerCount > 1) && !isPrimary) {
+		key ^= (key >> 16) ^ (key >> 32);
+		index = (UInt32)(key % g_EsifEventMgr.workerCount);
 	}
+	return &g_EsifEventMgr.workers[index];
+}
+
+
+static eEsifError EsifEventMgr_SlabCreate(EsifEventSlabPtr slabPtr)
+{
+	eEsifError rc = ESIF_E_NO_MEMORY;
+	void *bufferPtr = NULL;
+	UInt32 i = 0;
+
+	ESIF_ASSERT(slabPtr != NULL);
+
+	slabPtr->buffersPtr = esif_ccb_malloc((size_t)ESIF_UF_EVENT_SLAB_ITEMS * ESIF_UF_EVENT_SLAB_ITEM_SIZE);
+	slabPtr->freeRingPtr = esif_ring_create(ESIF_UF_EVENT_SLAB_ITEMS, sizeof(void *), "UfEventSlab", ESIF_RING_TIMEOUT_INFINITE);
+
+	if ((NULL == slabPtr->buffersPtr) || (NULL == slabPtr->freeRingPtr)) {
+		goto exit;
+	}
+
+	for (i = 0; i < ESIF_UF_EVENT_SLAB_ITEMS; i++) {
+		bufferPtr = slabPtr->buffersPtr + ((size_t)i * ESIF_UF_EVENT_SLAB_ITEM_SIZE);
+		rc = esif_ring_enqueue(slabPtr->freeRingPtr, &bufferPtr);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
+	rc = ESIF_OK;
+exit:
 	return rc;
 }
 
 
+/* Any queue referencing slab buffers must be destroyed first */
+static void EsifEventMgr_SlabDestroy(EsifEventSlabPtr slabPtr)
+{
+	ESIF_ASSERT(slabPtr != NULL);
+
+	esif_ring_destroy(slabPtr->freeRingPtr, NULL);
+	slabPtr->freeRingPtr = NULL;
+	esif_ccb_free(slabPtr->buffersPtr);
+	slabPtr->buffersPtr = NULL;
+}
+
+
 static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 {
 	esif_error_t rc = ESIF_OK;
-	EsifEventQueueItemPtr queueEventPtr = NULL;
+	EsifEventWorkerPtr workerPtr = (EsifEventWorkerPtr)ctxPtr;
+	EsifEventQueueItem queueEvent = {0};
+	EsifEventQueueItemPtr queueEventPtr = &queueEvent;
 	esif_handle_t participantId = ESIF_INVALID_HANDLE;
 
-	UNREFERENCED_PARAMETER(ctxPtr);
+	ESIF_ASSERT(workerPtr != NULL);
 
 	while(!g_EsifEventMgr.eventQueueExitFlag) {
-		rc = ESIF_OK;
-		queueEventPtr = esif_queue_pull(g_EsifEventMgr.eventQueuePtr);
+		rc = esif_ring_pull(workerPtr->queuePtr, queueEventPtr);
 
-		if (NULL == queueEventPtr) {
+		if (rc != ESIF_OK) {
 			continue;
 		}
+		atomic_set(&workerPtr->isBusy, 1);
+		EsifEventMgr_UpdateLatency(workerPtr, queueEventPtr);
 
-		ESIF_TRACE_INFO("Dequeuing %s event for Part. %u Dom. 0x%04X\n",
+		ESIF_TRACE_INFO("Dequeuing %s event for Part. %u Dom. 0x%04X on worker %u\n",
 			esif_event_type_str(queueEventPtr->eventType),
 			queueEventPtr->participantId,
-			queueEventPtr->domainId);
+			queueEventPtr->domainId,
+			workerPtr->index);
 
 		participantId = queueEventPtr->participantId;
 		if (queueEventPtr->isLfEvent) {
@@ -313,10 +679,10 @@ static void *ESIF_CALLCONV EsifEventMgr_EventQueueThread(void *ctxPtr)
 			EsifEventMgr_ProcessEvent(participantId,
 				queueEventPtr->domainId,
 				queueEventPtr->eventType,
-				&queueEventPtr->eventData);
+				EsifEventMgr_GetQueueItemData(queueEventPtr));
 		}
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+		EsifEventMgr_ReleaseQueueItemData(queueEventPtr);
+		atomic_set(&workerPtr->isBusy, 0);
 	}
 	return 0;
 }
@@ -330,13 +696,13 @@ static eEsifError EsifEventMgr_ProcessEvent(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = NULL;
-	EsifLinkListNodePtr nodePtr = NULL;
-	EsifLinkListNodePtr nextNodePtr = NULL;
+	EventMgrObserverSetPtr setPtr = NULL;
 	EventMgrEntryPtr entryPtr = NULL;
+	UInt32 buckets[2] = {0};
+	UInt32 numBuckets = 0;
+	UInt32 bucket = 0;
+	UInt32 i = 0;
 	char domain_str[8] = "";
-	atomic_t refCount = 0;
-	UInt8 shouldDumpGarbage = ESIF_FALSE;
 
 	UNREFERENCED_PARAMETER(domain_str);
 
@@ -377,66 +743,45 @@ static eEsifError EsifEventMgr_ProcessEvent(
 		}
 	}
 
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-
-	listPtr = g_EsifEventMgr.observerLists[(unsigned)eventType % NUM_EVENT_LISTS];
-	if(NULL == listPtr) {
-		rc = ESIF_E_UNSPECIFIED;
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	setPtr = EsifEventMgr_AcquireObserverSet(EsifEventMgr_EventIndex(eventType));
+	if (NULL == setPtr) {
 		goto exit;
 	}
 
-	nodePtr = listPtr->head_ptr;
-	while (NULL != nodePtr) {
-		nextNodePtr = nodePtr->next_ptr;
-
-		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
-		ESIF_ASSERT(entryPtr != NULL);
-
-		if ((eventType == entryPtr->fpcEvent.esif_event) &&
-			((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY) || (entryPtr->isParticipant0Id && EsifUpPm_IsPrimaryParticipantId(participantId))) &&
-			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY_DOMAIN) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
-			(entryPtr->refCount > 0) &&
-			(!entryPtr->markedForDelete)) {
-
-			/*
-			 * Increment the reference count so that the node is not removed while in use,
-			 * then release the lock so that we avoid a deadlock condition
-			 */
-			atomic_inc(&entryPtr->refCount);
-			entryPtr->isInUse = ESIF_TRUE;
-			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-
-			entryPtr->callback(entryPtr->context,
-				participantId,
-				domainId,
-				&entryPtr->fpcEvent,
-				eventDataPtr);
+	/* Visit the match-any bucket, then the bucket for the event participant */
+	buckets[numBuckets++] = EVENT_MGR_MATCH_ANY_BUCKET;
+	if (participantId != EVENT_MGR_MATCH_ANY) {
+		buckets[numBuckets++] = EsifEventMgr_GetObserverBucket(participantId);
+	}
 
-			/* 
-			 * Get the lock back and decrement the reference count.  Remove the node now
-			 * if the reference count is 0
-			 */
-			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+	for (bucket = 0; bucket < numBuckets; bucket++) {
+		for (i = setPtr->bucketStart[buckets[bucket]]; i < setPtr->bucketStart[buckets[bucket] + 1]; i++) {
+			entryPtr = setPtr->entries[i];
+			ESIF_ASSERT(entryPtr != NULL);
 
-			nextNodePtr = nodePtr->next_ptr;
+			if ((eventType == entryPtr->fpcEvent.esif_event) &&
+				((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY) || (entryPtr->isParticipant0Id && EsifUpPm_IsPrimaryParticipantId(participantId))) &&
+				((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY_DOMAIN) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
+				(atomic_read(&entryPtr->refCount) > 0) &&
+				(!atomic_read(&entryPtr->markedForDelete))) {
 
-			entryPtr->isInUse = ESIF_FALSE;
-			refCount = atomic_dec(&entryPtr->refCount);
-			if ((refCount <= 0) || (entryPtr->markedForDelete)) {
-				EsifEventMgr_MoveEntryToGarbage(entryPtr);
-				esif_link_list_node_remove(listPtr, nodePtr);
-				shouldDumpGarbage = ESIF_TRUE;
+				if (entryPtr->observerLockPtr != NULL) {
+					esif_ccb_mutex_lock(&entryPtr->observerLockPtr->lock);
+				}
+				entryPtr->callback(entryPtr->context,
+					participantId,
+					domainId,
+					&entryPtr->fpcEvent,
+					eventDataPtr);
+				if (entryPtr->observerLockPtr != NULL) {
+					esif_ccb_mutex_unlock(&entryPtr->observerLockPtr->lock);
+				}
 			}
 		}
-		nodePtr = nextNodePtr;
 	}
 
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-
-	if (shouldDumpGarbage) {
-		EsifEventMgr_DumpGarbage();
-	}
+	EsifEventMgr_ReleaseObserverSet(setPtr);
+	EsifEventMgr_DumpGarbage();
 
 exit:
 	return rc;
@@ -450,6 +795,31 @@ eEsifError ESIF_CALLCONV EsifEventMgr_RegisterEventByType(
 	EVENT_OBSERVER_CALLBACK eventCallback,
 	esif_context_t context
 	)
+{
+	return EsifEventMgr_RegisterEvent(eventType, participantId, domainId, eventCallback, context, ESIF_FALSE);
+}
+
+
+eEsifError ESIF_CALLCONV EsifEventMgr_RegisterReentrantEventByType(
+	eEsifEventType eventType,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	esif_context_t context
+	)
+{
+	return EsifEventMgr_RegisterEvent(eventType, participantId, domainId, eventCallback, context, ESIF_TRUE);
+}
+
+
+static eEsifError EsifEventMgr_RegisterEvent(
+	eEsifEventType eventType,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	esif_context_t context,
+	Bool isReentrant
+	)
 {
 	eEsifError rc = ESIF_OK;
 	EsifFpcEventPtr fpcEventPtr = NULL;
@@ -502,7 +872,8 @@ eEsifError ESIF_CALLCONV EsifEventMgr_RegisterEventByType(
 		participantId,
 		domainId,
 		eventCallback,
-		context);
+		context,
+		isReentrant);
 
 exit:
 	if (upPtr != NULL) {
@@ -574,7 +945,8 @@ eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterAllForApp(
 	EsifLinkListNodePtr curNodePtr = NULL;
 	EsifLinkListNodePtr nextNodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
-	UInt8 i = 0;
+	Bool isChanged = ESIF_FALSE;
+	UInt32 i = 0;
 
 	ESIF_TRACE_DEBUG("Unregistering all events for app " ESIF_HANDLE_FMT "\n", context);
 
@@ -585,14 +957,15 @@ eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterAllForApp(
 
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	for (i = 0; i < NUM_EVENT_LISTS; i++) {
+	for (i = 0; i < EVENT_MGR_NUM_EVENT_INDEXES; i++) {
 
 		listPtr = g_EsifEventMgr.observerLists[i];
 		if (NULL == listPtr) {
 			continue;
 		}
 
-		/* Find the matching entry */
+		/* Find the matching entries */
+		isChanged = ESIF_FALSE;
 		curNodePtr = listPtr->head_ptr;
 		while (curNodePtr != NULL) {
 			nextNodePtr = curNodePtr->next_ptr; // Get next ptr now as the current node may be removed below
@@ -600,15 +973,15 @@ eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterAllForApp(
 			curEntryPtr = (EventMgrEntryPtr)curNodePtr->data_ptr;
 			if ((curEntryPtr->callback == eventCallback) &&
 				(curEntryPtr->context == context)) {
-
-				curEntryPtr->markedForDelete = ESIF_TRUE;
-				if (!curEntryPtr->isInUse) {
-					EsifEventMgr_MoveEntryToGarbage(curEntryPtr);
-					esif_link_list_node_remove(listPtr, curNodePtr);
-				}
+				EsifEventMgr_RemoveEntry_Locked(listPtr, curNodePtr);
+				isChanged = ESIF_TRUE;
 			}
 			curNodePtr = nextNodePtr;
 		}
+
+		if (isChanged) {
+			EsifEventMgr_PublishObserverSet_Locked(i);
+		}
 	}
 
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
@@ -623,7 +996,8 @@ static eEsifError EsifEventMgr_AddEntry(
 	esif_handle_t participantId,
 	UInt16 domainId,
 	EVENT_OBSERVER_CALLBACK eventCallback,
-	esif_context_t context
+	esif_context_t context,
+	Bool isReentrant
 	)
 {
 	eEsifError rc = ESIF_OK;
@@ -631,14 +1005,17 @@ static eEsifError EsifEventMgr_AddEntry(
 	EsifLinkListNodePtr nodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
 	EventMgrEntryPtr newEntryPtr = NULL;
+	UInt32 index = 0;
 	atomic_t refCount = 1;
 
 	ESIF_ASSERT(fpcEventPtr != NULL);
 	ESIF_ASSERT(eventCallback != NULL);
 
+	index = EsifEventMgr_EventIndex(fpcEventPtr->esif_event);
+
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
+	listPtr = g_EsifEventMgr.observerLists[index];
 	if(NULL == listPtr) {
 		rc = ESIF_E_UNSPECIFIED;
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
@@ -663,12 +1040,7 @@ static eEsifError EsifEventMgr_AddEntry(
 	}
 	/* If we found an existing entry, update the reference count */
 	if (nodePtr != NULL) {
-		if (!curEntryPtr->markedForDelete) {
-			atomic_inc(&curEntryPtr->refCount);
-		}
-		else {
-			rc = ESIF_E_NO_CREATE;
-		}
+		refCount = atomic_inc(&curEntryPtr->refCount);
 		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 		goto exit;
 	}
@@ -689,6 +1061,16 @@ static eEsifError EsifEventMgr_AddEntry(
 	newEntryPtr->domainId = domainId;
 	newEntryPtr->participantId = participantId;
 	newEntryPtr->refCount = refCount;
+	newEntryPtr->setRefCount = 1;
+	newEntryPtr->isReentrant = isReentrant;
+	newEntryPtr->observerLockPtr = NULL;
+	if (!isReentrant) {
+		newEntryPtr->observerLockPtr = EsifEventMgr_AcquireObserverLock(eventCallback, context);
+		if (NULL == newEntryPtr->observerLockPtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+	}
 	esif_ccb_memcpy(&newEntryPtr->fpcEvent, fpcEventPtr, sizeof(newEntryPtr->fpcEvent));
 	newEntryPtr->isParticipant0Id = EsifUpPm_IsPrimaryParticipantId(participantId);
 
@@ -697,21 +1079,31 @@ static eEsifError EsifEventMgr_AddEntry(
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
-	
+
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 	esif_link_list_add_node_at_back(listPtr, nodePtr);
+	rc = EsifEventMgr_PublishObserverSet_Locked(index);
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	rc = EsifEventMgr_EnableEvent(newEntryPtr);
+	if (ESIF_OK == rc) {
+		rc = EsifEventMgr_EnableEvent(newEntryPtr);
+	}
 
 exit:
 	ESIF_TRACE_DEBUG("  RefCount: " ATOMIC_FMT "\n", refCount);
 
-	if (ESIF_OK != rc) {
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-		esif_link_list_node_remove(listPtr, nodePtr);
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
-		esif_ccb_free(newEntryPtr);
+	if ((ESIF_OK != rc) && (newEntryPtr != NULL)) {
+		if (nodePtr != NULL) {
+			/* Entry may already be referenced by a published set; retire it once released */
+			esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+			EsifEventMgr_RemoveEntry_Locked(listPtr, nodePtr);
+			EsifEventMgr_PublishObserverSet_Locked(index);
+			esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+			EsifEventMgr_DumpGarbage();
+		}
+		else {
+			EsifEventMgr_FreeEntry(newEntryPtr);
+		}
 	}
 
 	return rc;
@@ -730,14 +1122,17 @@ static eEsifError EsifEventMgr_ReleaseEntry(
 	EsifLinkListPtr listPtr = NULL;
 	EsifLinkListNodePtr nodePtr = NULL;
 	EventMgrEntryPtr curEntryPtr = NULL;
+	UInt32 index = 0;
 	atomic_t refCount = -1;
 
 	ESIF_ASSERT(eventCallback != NULL);
 	ESIF_ASSERT(fpcEventPtr != NULL);
 
+	index = EsifEventMgr_EventIndex(fpcEventPtr->esif_event);
+
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	listPtr = g_EsifEventMgr.observerLists[fpcEventPtr->esif_event % NUM_EVENT_LISTS];
+	listPtr = g_EsifEventMgr.observerLists[index];
 	if(NULL == listPtr) {
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
@@ -759,9 +1154,9 @@ static eEsifError EsifEventMgr_ReleaseEntry(
 
 	if (nodePtr != NULL) {
 		refCount = atomic_dec(&curEntryPtr->refCount);
-		if ((refCount <= 0) || (curEntryPtr->markedForDelete)) {
-			EsifEventMgr_MoveEntryToGarbage(curEntryPtr);
-			esif_link_list_node_remove(listPtr, nodePtr);
+		if (refCount <= 0) {
+			EsifEventMgr_RemoveEntry_Locked(listPtr, nodePtr);
+			EsifEventMgr_PublishObserverSet_Locked(index);
 		}
 		goto exit;
 	}
@@ -884,7 +1279,7 @@ Bool EsifEventMgr_IsEventRegistered(
 	EventMgrEntryPtr entryPtr = NULL;
 
 	esif_ccb_read_lock(&g_EsifEventMgr.listLock);
-	listPtr = g_EsifEventMgr.observerLists[eventType % NUM_EVENT_LISTS];
+	listPtr = g_EsifEventMgr.observerLists[EsifEventMgr_EventIndex(eventType)];
 	if (NULL == listPtr) {
 		goto exit;
 	}
@@ -897,7 +1292,7 @@ Bool EsifEventMgr_IsEventRegistered(
 			(entryPtr->context == key) && 
 			((entryPtr->participantId == participantId) || (entryPtr->participantId == EVENT_MGR_MATCH_ANY) || (entryPtr->isParticipant0Id && EsifUpPm_IsPrimaryParticipantId(participantId))) &&
 			((entryPtr->domainId == domainId) || (entryPtr->domainId == EVENT_MGR_MATCH_ANY_DOMAIN) || (domainId == EVENT_MGR_DOMAIN_NA)) &&
-			(entryPtr->refCount > 0)) {
+			(atomic_read(&entryPtr->refCount) > 0)) {
 
 			bRet = ESIF_TRUE;
 			break;
@@ -961,11 +1356,11 @@ esif_error_t EsifEventMgr_GetNextEvent(
 
 		eventType = iterPtr->eventType;
 
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		esif_ccb_read_lock(&g_EsifEventMgr.listLock);
 
 		while (eventType <= MAX_ESIF_EVENT_ENUM_VALUE) {
 
-			listPtr = g_EsifEventMgr.observerLists[(unsigned)eventType % NUM_EVENT_LISTS];
+			listPtr = g_EsifEventMgr.observerLists[EsifEventMgr_EventIndex(eventType)];
 			if (NULL == listPtr) {
 				rc = ESIF_E_UNSPECIFIED;
 				goto lockExit;
@@ -1015,7 +1410,7 @@ esif_error_t EsifEventMgr_GetNextEvent(
 		rc = ESIF_E_ITERATION_DONE;
 
 lockExit:
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+		esif_ccb_read_unlock(&g_EsifEventMgr.listLock);
 	}
 exit:
 	return rc;
@@ -1025,13 +1420,19 @@ exit:
 eEsifError EsifEventMgr_Init(void)
 {
 	eEsifError rc = ESIF_OK;
-	UInt8 i;
+	EsifEventWorkerPtr workerPtr = NULL;
+	char queueName[ESIF_NAME_LEN] = { 0 };
+	UInt32 workerCount = 0;
+	UInt32 i;
 
 	ESIF_TRACE_ENTRY_INFO();
 
 	esif_ccb_lock_init(&g_EsifEventMgr.listLock);
+	esif_ccb_lock_init(&g_EsifEventMgr.setLock);
+	esif_ccb_lock_init(&g_EsifEventMgr.garbageLock);
+	esif_ccb_lock_init(&g_EsifEventMgr.observerLocksLock);
 
-	for (i = 0; i < NUM_EVENT_LISTS; i++) {
+	for (i = 0; i < EVENT_MGR_NUM_EVENT_INDEXES; i++) {
 		g_EsifEventMgr.observerLists[i] = esif_link_list_create();
 		if (NULL == g_EsifEventMgr.observerLists[i]) {
 			rc = ESIF_E_NO_MEMORY;
@@ -1039,19 +1440,42 @@ eEsifError EsifEventMgr_Init(void)
 		}
 	}
 
-	g_EsifEventMgr.eventQueuePtr = esif_queue_create(ESIF_UF_EVENT_QUEUE_SIZE, ESIF_UF_EVENT_QUEUE_NAME, ESIF_UF_EVENT_QUEUE_TIMEOUT);
-	g_EsifEventMgr.garbageList = esif_link_list_create();
+	rc = EsifEventMgr_SlabCreate(&g_EsifEventMgr.payloadSlab);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
 
-	if ((NULL == g_EsifEventMgr.eventQueuePtr) ||
-		(NULL == g_EsifEventMgr.garbageList)) {
+	g_EsifEventMgr.garbageList = esif_link_list_create();
+	if (NULL == g_EsifEventMgr.garbageList) {
 		rc = ESIF_E_NO_MEMORY;
 		goto exit;
 	}
 
-	rc = esif_ccb_thread_create(&g_EsifEventMgr.eventQueueThread, EsifEventMgr_EventQueueThread, NULL);
-	if (rc != ESIF_OK) {
-		goto exit;
+	workerCount = esif_ccb_max(1, esif_ccb_min(g_esifEventWorkers, ESIF_UF_EVENT_WORKERS_MAX));
+
+	/* All worker queues must exist before any worker can be selected */
+	for (i = 0; i < workerCount; i++) {
+		workerPtr = &g_EsifEventMgr.workers[i];
+		workerPtr->index = i;
+		esif_ccb_sprintf(sizeof(queueName), queueName, "%s%u", ESIF_UF_EVENT_QUEUE_NAME, i);
+
+		workerPtr->queuePtr = esif_ring_create(ESIF_UF_EVENT_QUEUE_SIZE, sizeof(EsifEventQueueItem), queueName, ESIF_UF_EVENT_QUEUE_TIMEOUT);
+		if (NULL == workerPtr->queuePtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
 	}
+	g_EsifEventMgr.workerCount = workerCount;
+
+	for (i = 0; i < workerCount; i++) {
+		workerPtr = &g_EsifEventMgr.workers[i];
+		rc = esif_ccb_thread_create(&workerPtr->thread, EsifEventMgr_EventQueueThread, workerPtr);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+		workerPtr->isStarted = ESIF_TRUE;
+	}
+	ESIF_TRACE_INFO("Started %u event workers\n", workerCount);
 exit:
 	if (rc != ESIF_OK) {
 		EsifEventMgr_Exit();
@@ -1063,8 +1487,9 @@ exit:
 
 void EsifEventMgr_Exit(void)
 {
-	UInt8 i;
+	UInt32 i;
 	EsifLinkListPtr listPtr = NULL;
+	EventMgrObserverSetPtr setPtr = NULL;
 
 	ESIF_TRACE_ENTRY_INFO();
 
@@ -1072,10 +1497,20 @@ void EsifEventMgr_Exit(void)
 		EsifEventMgr_Disable();
 	}
 
+	/* Release all published observer sets; the event thread is already stopped */
+	for (i = 0; i < EVENT_MGR_NUM_EVENT_INDEXES; i++) {
+		esif_ccb_write_lock(&g_EsifEventMgr.setLock);
+		setPtr = g_EsifEventMgr.observerSets[i];
+		g_EsifEventMgr.observerSets[i] = NULL;
+		esif_ccb_write_unlock(&g_EsifEventMgr.setLock);
+
+		EsifEventMgr_ReleaseObserverSet(setPtr);
+	}
+
 	/* Remove all listeners */
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 
-	for (i = 0; i < NUM_EVENT_LISTS; i++) {
+	for (i = 0; i < EVENT_MGR_NUM_EVENT_INDEXES; i++) {
 		listPtr = g_EsifEventMgr.observerLists[i];
 		esif_link_list_free_data_and_destroy(listPtr, EsifEventMgr_LLEntryDestroyCallback);
 		g_EsifEventMgr.observerLists[i] = NULL;
@@ -1083,19 +1518,25 @@ void EsifEventMgr_Exit(void)
 
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 
-	/* Destroy the event thread */
-
-	/* Event thread should already be destroyed in the disable func. Destroy the queue */
-	esif_queue_destroy(g_EsifEventMgr.eventQueuePtr, EsifEventMgr_QueueDestroyCallback);
-	g_EsifEventMgr.eventQueuePtr = NULL;
+	/* Worker threads should already be destroyed in the disable func. Destroy the queues */
+	g_EsifEventMgr.workerCount = 0;
+	for (i = 0; i < ESIF_UF_EVENT_WORKERS_MAX; i++) {
+		esif_ring_destroy(g_EsifEventMgr.workers[i].queuePtr, EsifEventMgr_QueueDestroyCallback);
+		g_EsifEventMgr.workers[i].queuePtr = NULL;
+	}
+	EsifEventMgr_SlabDestroy(&g_EsifEventMgr.payloadSlab);
 
 
 	/* Destroy the garbage list */
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
-	esif_link_list_free_data_and_destroy(g_EsifEventMgr.garbageList, EsifEventMgr_LLEntryDestroyCallback);
+	EsifEventMgr_DumpGarbage();
+	esif_ccb_write_lock(&g_EsifEventMgr.garbageLock);
+	esif_link_list_destroy(g_EsifEventMgr.garbageList);
 	g_EsifEventMgr.garbageList = NULL;
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	esif_ccb_write_unlock(&g_EsifEventMgr.garbageLock);
 
+	esif_ccb_lock_uninit(&g_EsifEventMgr.garbageLock);
+	esif_ccb_lock_uninit(&g_EsifEventMgr.observerLocksLock);
+	esif_ccb_lock_uninit(&g_EsifEventMgr.setLock);
 	esif_ccb_lock_uninit(&g_EsifEventMgr.listLock);
 
 	ESIF_TRACE_EXIT_INFO();
@@ -1103,12 +1544,21 @@ void EsifEventMgr_Exit(void)
 
 void EsifEventMgr_Disable(void)
 {
+	EsifEventWorkerPtr workerPtr = NULL;
+	UInt32 i;
+
 	ESIF_TRACE_ENTRY_INFO();
 
-	/* Release and destroy the event thread */
+	/* Release and destroy the worker threads */
 	g_EsifEventMgr.eventQueueExitFlag = ESIF_TRUE;
-	esif_queue_signal_event(g_EsifEventMgr.eventQueuePtr);
-	esif_ccb_thread_join(&g_EsifEventMgr.eventQueueThread);
+	for (i = 0; i < ESIF_UF_EVENT_WORKERS_MAX; i++) {
+		workerPtr = &g_EsifEventMgr.workers[i];
+		if (workerPtr->isStarted) {
+			esif_ring_signal_event(workerPtr->queuePtr);
+			esif_ccb_thread_join(&workerPtr->thread);
+			workerPtr->isStarted = ESIF_FALSE;
+		}
+	}
 	g_EsifEventMgr.eventsDisabled = ESIF_TRUE;
 
 	ESIF_TRACE_EXIT_INFO();
@@ -1118,10 +1568,13 @@ void EsifEventMgr_Disable(void)
 static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr)
 {
 	eEsifError rc = ESIF_OK;
-	EsifLinkListPtr listPtr = g_EsifEventMgr.garbageList;
+	EsifLinkListPtr listPtr = NULL;
 
 	ESIF_ASSERT(NULL != entryPtr);
 
+	esif_ccb_write_lock(&g_EsifEventMgr.garbageLock);
+
+	listPtr = g_EsifEventMgr.garbageList;
 	if (NULL == listPtr) {
 		rc = ESIF_E_UNSPECIFIED;
 		goto exit;
@@ -1129,10 +1582,237 @@ static eEsifError EsifEventMgr_MoveEntryToGarbage(EventMgrEntryPtr entryPtr)
 
 	rc = esif_link_list_add_at_back(listPtr, (void *)entryPtr);
 exit:
+	esif_ccb_write_unlock(&g_EsifEventMgr.garbageLock);
 	return rc;
 }
 
 
+/*
+ * Removes an entry from its observer list and marks it for deletion.
+ * The caller must publish a new observer set for the list afterwards.
+ * List lock should be held when called.
+ */
+static void EsifEventMgr_RemoveEntry_Locked(
+	EsifLinkListPtr listPtr,
+	EsifLinkListNodePtr nodePtr
+	)
+{
+	EventMgrEntryPtr entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+
+	ESIF_ASSERT(entryPtr != NULL);
+
+	atomic_set(&entryPtr->markedForDelete, ESIF_TRUE);
+	esif_link_list_node_remove(listPtr, nodePtr);
+	EsifEventMgr_ReleaseEntryRef(entryPtr);
+}
+
+
+/*
+ * Drops one list or observer set reference to an entry.  Only the caller which
+ * drops the last reference moves the entry to the garbage list, so the entry is
+ * never touched again by any other caller after its decrement.
+ */
+static void EsifEventMgr_ReleaseEntryRef(EventMgrEntryPtr entryPtr)
+{
+	if (0 == atomic_dec(&entryPtr->setRefCount)) {
+		EsifEventMgr_MoveEntryToGarbage(entryPtr);
+	}
+}
+
+
+static UInt32 EsifEventMgr_GetObserverBucket(esif_handle_t participantId)
+{
+	UInt64 key = 0;
+
+	if (EVENT_MGR_MATCH_ANY == participantId) {
+		return EVENT_MGR_MATCH_ANY_BUCKET;
+	}
+
+	/* All primary participant IDs share a bucket as they match each other */
+	key = (UInt64)(EsifUpPm_IsPrimaryParticipantId(participantId) ? ESIF_HANDLE_PRIMARY_PARTICIPANT : participantId);
+	key ^= (key >> 16) ^ (key >> 32);
+	return 1 + (UInt32)(key % (EVENT_MGR_OBSERVER_BUCKETS - 1));
+}
+
+
+/*
+ * Builds a new observer set from the observer list for the given index and
+ * publishes it in place of the current set.  List lock should be held when called.
+ */
+static eEsifError EsifEventMgr_PublishObserverSet_Locked(UInt32 index)
+{
+	eEsifError rc = ESIF_OK;
+	EsifLinkListPtr listPtr = g_EsifEventMgr.observerLists[index];
+	EsifLinkListNodePtr nodePtr = NULL;
+	EventMgrEntryPtr entryPtr = NULL;
+	EventMgrObserverSetPtr newSetPtr = NULL;
+	EventMgrObserverSetPtr oldSetPtr = NULL;
+	UInt32 bucketNext[EVENT_MGR_OBSERVER_BUCKETS] = {0};
+	UInt32 bucket = 0;
+	UInt32 count = 0;
+
+	if (NULL == listPtr) {
+		rc = ESIF_E_UNSPECIFIED;
+		goto exit;
+	}
+
+	for (nodePtr = listPtr->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+		entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+		bucketNext[EsifEventMgr_GetObserverBucket(entryPtr->participantId)]++;
+		count++;
+	}
+
+	/* An empty list is published as a NULL set */
+	if (count > 0) {
+		newSetPtr = esif_ccb_malloc(sizeof(*newSetPtr) + (count * sizeof(newSetPtr->entries[0])));
+		if (NULL == newSetPtr) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		newSetPtr->refCount = 1;
+		newSetPtr->count = count;
+
+		/* Convert bucket counts to starting offsets, then place each entry in its bucket */
+		count = 0;
+		for (bucket = 0; bucket < EVENT_MGR_OBSERVER_BUCKETS; bucket++) {
+			newSetPtr->bucketStart[bucket] = count;
+			count += bucketNext[bucket];
+			bucketNext[bucket] = newSetPtr->bucketStart[bucket];
+		}
+		newSetPtr->bucketStart[EVENT_MGR_OBSERVER_BUCKETS] = count;
+
+		for (nodePtr = listPtr->head_ptr; nodePtr != NULL; nodePtr = nodePtr->next_ptr) {
+			entryPtr = (EventMgrEntryPtr)nodePtr->data_ptr;
+			bucket = EsifEventMgr_GetObserverBucket(entryPtr->participantId);
+			atomic_inc(&entryPtr->setRefCount);
+			newSetPtr->entries[bucketNext[bucket]++] = entryPtr;
+		}
+	}
+
+	esif_ccb_write_lock(&g_EsifEventMgr.setLock);
+	oldSetPtr = g_EsifEventMgr.observerSets[index];
+	g_EsifEventMgr.observerSets[index] = newSetPtr;
+	esif_ccb_write_unlock(&g_EsifEventMgr.setLock);
+
+	EsifEventMgr_ReleaseObserverSet(oldSetPtr);
+exit:
+	return rc;
+}
+
+
+/* Returns a referenced observer set, or NULL if there are no observers; release with EsifEventMgr_ReleaseObserverSet */
+static EventMgrObserverSetPtr EsifEventMgr_AcquireObserverSet(UInt32 index)
+{
+	EventMgrObserverSetPtr setPtr = NULL;
+
+	esif_ccb_read_lock(&g_EsifEventMgr.setLock);
+	setPtr = g_EsifEventMgr.observerSets[index];
+	if (setPtr != NULL) {
+		atomic_inc(&setPtr->refCount);
+	}
+	esif_ccb_read_unlock(&g_EsifEventMgr.setLock);
+
+	return setPtr;
+}
+
+
+/* Entries no longer referenced by any set or list are moved to the garbage list; call EsifEventMgr_DumpGarbage to free them */
+static void EsifEventMgr_ReleaseObserverSet(EventMgrObserverSetPtr setPtr)
+{
+	EventMgrEntryPtr entryPtr = NULL;
+	UInt32 i = 0;
+
+	if ((NULL == setPtr) || (atomic_dec(&setPtr->refCount) > 0)) {
+		return;
+	}
+
+	for (i = 0; i < setPtr->count; i++) {
+		entryPtr = setPtr->entries[i];
+		EsifEventMgr_ReleaseEntryRef(entryPtr);
+	}
+	esif_ccb_free(setPtr);
+}
+
+
+static void EsifEventMgr_FreeEntry(EventMgrEntryPtr entryPtr)
+{
+	if (entryPtr != NULL) {
+		EsifEventMgr_ReleaseObserverLock(entryPtr->observerLockPtr);
+		esif_ccb_free(entryPtr);
+	}
+}
+
+
+/* Returns the serial lock of an observer, creating it for the first entry the observer registers */
+static EventMgrObserverLockPtr EsifEventMgr_AcquireObserverLock(
+	EVENT_OBSERVER_CALLBACK callback,
+	esif_context_t context
+	)
+{
+	EventMgrObserverLockPtr observerLockPtr = NULL;
+
+	esif_ccb_write_lock(&g_EsifEventMgr.observerLocksLock);
+
+	for (observerLockPtr = g_EsifEventMgr.observerLocks; observerLockPtr != NULL; observerLockPtr = observerLockPtr->nextPtr) {
+		if ((observerLockPtr->callback == callback) && (observerLockPtr->context == context)) {
+			break;
+		}
+	}
+
+	if (NULL == observerLockPtr) {
+		observerLockPtr = esif_ccb_malloc(sizeof(*observerLockPtr));
+		if (observerLockPtr != NULL) {
+			observerLockPtr->callback = callback;
+			observerLockPtr->context = context;
+			observerLockPtr->refCount = 0;
+			esif_ccb_mutex_init(&observerLockPtr->lock);
+			observerLockPtr->nextPtr = g_EsifEventMgr.observerLocks;
+			g_EsifEventMgr.observerLocks = observerLockPtr;
+		}
+	}
+	if (observerLockPtr != NULL) {
+		observerLockPtr->refCount++;
+	}
+
+	esif_ccb_write_unlock(&g_EsifEventMgr.observerLocksLock);
+	return observerLockPtr;
+}
+
+
+/* Called once no observer set references the entry, so the lock is not held when the last entry releases it */
+static void EsifEventMgr_ReleaseObserverLock(
+	EventMgrObserverLockPtr observerLockPtr
+	)
+{
+	EventMgrObserverLockPtr *linkPtr = NULL;
+
+	if (NULL == observerLockPtr) {
+		return;
+	}
+
+	esif_ccb_write_lock(&g_EsifEventMgr.observerLocksLock);
+
+	if (--observerLockPtr->refCount > 0) {
+		observerLockPtr = NULL;
+	}
+	else {
+		for (linkPtr = &g_EsifEventMgr.observerLocks; *linkPtr != NULL; linkPtr = &(*linkPtr)->nextPtr) {
+			if (*linkPtr == observerLockPtr) {
+				*linkPtr = observerLockPtr->nextPtr;
+				break;
+			}
+		}
+	}
+
+	esif_ccb_write_unlock(&g_EsifEventMgr.observerLocksLock);
+
+	if (observerLockPtr != NULL) {
+		esif_ccb_mutex_uninit(&observerLockPtr->lock);
+		esif_ccb_free(observerLockPtr);
+	}
+}
+
+
 static eEsifError EsifEventMgr_DumpGarbage()
 {
 	eEsifError rc = ESIF_OK;
@@ -1145,21 +1825,26 @@ static eEsifError EsifEventMgr_DumpGarbage()
 		goto exit;
 	}
 
-	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+	/* Unlocked check avoids taking the lock on every dispatch; anything missed is collected next time */
+	if (NULL == listPtr->head_ptr) {
+		goto exit;
+	}
+
+	esif_ccb_write_lock(&g_EsifEventMgr.garbageLock);
 	nodePtr = listPtr->head_ptr;
 	while(nodePtr) {
 		entryPtr = nodePtr->data_ptr;
 
 		/* remove the node first so that it isn't considered active while we disable events */
 		esif_link_list_node_remove(listPtr, nodePtr); 
-		esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+		esif_ccb_write_unlock(&g_EsifEventMgr.garbageLock);
 		EsifEventMgr_DisableEvent(entryPtr);
-		esif_ccb_free(entryPtr);
-		esif_ccb_write_lock(&g_EsifEventMgr.listLock);
+		EsifEventMgr_FreeEntry(entryPtr);
+		esif_ccb_write_lock(&g_EsifEventMgr.garbageLock);
 
 		nodePtr = listPtr->head_ptr;
 	}
-	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
+	esif_ccb_write_unlock(&g_EsifEventMgr.garbageLock);
 
 exit:
 	return rc;
@@ -1168,12 +1853,116 @@ exit:
 
 static void EsifEventMgr_QueueDestroyCallback(void *ctxPtr)
 {
-	EsifEventQueueItemPtr queueEventPtr = (EsifEventQueueItemPtr)ctxPtr;
+	EsifEventMgr_ReleaseQueueItemData((EsifEventQueueItemPtr)ctxPtr);
+}
+
 
-	if(queueEventPtr != NULL) {
-		esif_ccb_free(queueEventPtr->eventData.buf_ptr);
-		esif_ccb_free(queueEventPtr);
+esif_error_t EsifEventMgr_GetQueueStats(EsifEventQueueStatsPtr statsPtr)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+	EsifEventWorkerPtr workerPtr = NULL;
+	EsifRingStats ringStats = {0};
+	UInt64 count = 0;
+	UInt64 totalCount = 0;
+	UInt64 totalUsec = 0;
+	UInt64 minUsec = 0;
+	UInt32 i;
+
+	if (statsPtr != NULL) {
+		esif_ccb_memset(statsPtr, 0, sizeof(*statsPtr));
+
+		/* Totals across all workers; the high-water mark is that of the deepest worker queue */
+		for (i = 0; i < g_EsifEventMgr.workerCount; i++) {
+			workerPtr = &g_EsifEventMgr.workers[i];
+			esif_ring_get_stats(workerPtr->queuePtr, &ringStats);
+			statsPtr->queue.enqueued += ringStats.enqueued;
+			statsPtr->queue.dequeued += ringStats.dequeued;
+			statsPtr->queue.drops += ringStats.drops;
+			statsPtr->queue.depth += ringStats.depth;
+			statsPtr->queue.capacity += ringStats.capacity;
+			statsPtr->queue.high_water = esif_ccb_max(statsPtr->queue.high_water, ringStats.high_water);
+
+			count = (UInt64)atomic64_read(&workerPtr->latencyCount);
+			if (count > 0) {
+				minUsec = (UInt64)atomic64_read(&workerPtr->latencyMinUsec);
+				if ((0 == totalCount) || (minUsec < statsPtr->latencyMinUsec)) {
+					statsPtr->latencyMinUsec = minUsec;
+				}
+				statsPtr->latencyMaxUsec = esif_ccb_max(statsPtr->latencyMaxUsec, (UInt64)atomic64_read(&workerPtr->latencyMaxUsec));
+				totalUsec += (UInt64)atomic64_read(&workerPtr->latencyTotalUsec);
+				totalCount += count;
+			}
+		}
+		if (totalCount > 0) {
+			statsPtr->latencyAvgUsec = totalUsec / totalCount;
+		}
+		statsPtr->inlinePayloads = (UInt64)atomic64_read(&g_EsifEventMgr.inlinePayloads);
+		statsPtr->slabPayloads = (UInt64)atomic64_read(&g_EsifEventMgr.slabPayloads);
+		statsPtr->heapPayloads = (UInt64)atomic64_read(&g_EsifEventMgr.heapPayloads);
+		rc = ESIF_OK;
 	}
+	return rc;
+}
+
+
+void EsifEventMgr_ResetQueueStats(void)
+{
+	EsifEventWorkerPtr workerPtr = NULL;
+	UInt32 i;
+
+	for (i = 0; i < g_EsifEventMgr.workerCount; i++) {
+		workerPtr = &g_EsifEventMgr.workers[i];
+		esif_ring_reset_stats(workerPtr->queuePtr);
+		atomic64_set(&workerPtr->latencyCount, 0);
+		atomic64_set(&workerPtr->latencyTotalUsec, 0);
+		atomic64_set(&workerPtr->latencyMinUsec, 0);
+		atomic64_set(&workerPtr->latencyMaxUsec, 0);
+		atomic64_set(&workerPtr->lastLatencyUsec, 0);
+	}
+	atomic64_set(&g_EsifEventMgr.inlinePayloads, 0);
+	atomic64_set(&g_EsifEventMgr.slabPayloads, 0);
+	atomic64_set(&g_EsifEventMgr.heapPayloads, 0);
+}
+
+
+UInt32 EsifEventMgr_GetWorkerCount(void)
+{
+	return g_EsifEventMgr.workerCount;
+}
+
+
+esif_error_t EsifEventMgr_GetWorkerStats(
+	UInt32 index,
+	EsifEventWorkerStatsPtr statsPtr
+	)
+{
+	esif_error_t rc = ESIF_OK;
+	EsifEventWorkerPtr workerPtr = NULL;
+	UInt64 count = 0;
+
+	if (NULL == statsPtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if (index >= g_EsifEventMgr.workerCount) {
+		rc = ESIF_E_NOT_FOUND;
+		goto exit;
+	}
+
+	workerPtr = &g_EsifEventMgr.workers[index];
+	esif_ccb_memset(statsPtr, 0, sizeof(*statsPtr));
+	esif_ring_get_stats(workerPtr->queuePtr, &statsPtr->queue);
+
+	count = (UInt64)atomic64_read(&workerPtr->latencyCount);
+	if (count > 0) {
+		statsPtr->latencyMinUsec = (UInt64)atomic64_read(&workerPtr->latencyMinUsec);
+		statsPtr->latencyMaxUsec = (UInt64)atomic64_read(&workerPtr->latencyMaxUsec);
+		statsPtr->latencyAvgUsec = (UInt64)atomic64_read(&workerPtr->latencyTotalUsec) / count;
+		statsPtr->lastLatencyUsec = (UInt64)atomic64_read(&workerPtr->lastLatencyUsec);
+	}
+	statsPtr->isBusy = (atomic_read(&workerPtr->isBusy) != 0);
+exit:
+	return rc;
 }
 
 
@@ -1183,7 +1972,7 @@ static void EsifEventMgr_LLEntryDestroyCallback(
 {
 	esif_ccb_write_unlock(&g_EsifEventMgr.listLock);
 	EsifEventMgr_DisableEvent((EventMgrEntryPtr)dataPtr);
-	esif_ccb_free(dataPtr);
+	EsifEventMgr_FreeEntry((EventMgrEntryPtr)dataPtr);
 	esif_ccb_write_lock(&g_EsifEventMgr.listLock);
 }
 
@@ -56,7 +56,7 @@
 #include "esif.h"
 #include "esif_uf_fpc.h"
 #include "esif_link_list.h"
-#include "esif_queue.h"
+#include "esif_ring.h"
 #include "esif_ccb_thread.h"
 
 #define EVENT_MGR_DOMAIN_D0 '0D'
@@ -77,9 +77,26 @@
 #define EVENT_MGR_MATCH_ANY ESIF_HANDLE_MATCH_ANY_EVENT
 
 
-#define ESIF_UF_EVENT_QUEUE_SIZE 0xFFFFFFFF
+#define ESIF_UF_EVENT_QUEUE_SIZE 4096	/* Per worker */
 #define ESIF_UF_EVENT_QUEUE_NAME "UfQueue"
-#define ESIF_UF_EVENT_QUEUE_TIMEOUT ESIF_QUEUE_TIMEOUT_INFINITE /* No timeout */
+#define ESIF_UF_EVENT_QUEUE_TIMEOUT ESIF_RING_TIMEOUT_INFINITE /* No timeout */
+
+/*
+ * Events are delivered by a pool of worker threads, each with its own queue.
+ * Events are assigned to a worker by participant so that events for any one
+ * participant are delivered in order.
+ */
+#define ESIF_UF_EVENT_WORKERS_DEFAULT 4
+#define ESIF_UF_EVENT_WORKERS_MAX 16
+
+/*
+ * Event payloads up to ESIF_UF_EVENT_INLINE_DATA_SIZE bytes are stored inside
+ * the queue item; larger payloads use a preallocated slab buffer, falling back
+ * to the heap only when the slab is exhausted or the payload is too large.
+ */
+#define ESIF_UF_EVENT_INLINE_DATA_SIZE 64
+#define ESIF_UF_EVENT_SLAB_ITEM_SIZE 1024
+#define ESIF_UF_EVENT_SLAB_ITEMS 64
 
 #if defined(ESIF_ATTR_OS_WINDOWS)
 #include "win\dppe.h"
@@ -158,10 +175,32 @@ typedef struct EventMgr_IteratorData_s {
 
 #pragma pack(pop)
 
+typedef struct EsifEventQueueStats_s {
+	EsifRingStats queue;		/* Queue counters (depth, high-water mark, drops) */
+	UInt64 latencyMinUsec;		/* Minimum enqueue-to-dispatch latency */
+	UInt64 latencyMaxUsec;		/* Maximum enqueue-to-dispatch latency */
+	UInt64 latencyAvgUsec;		/* Average enqueue-to-dispatch latency */
+	UInt64 inlinePayloads;		/* Payloads stored inline in the queue item */
+	UInt64 slabPayloads;		/* Payloads stored in a slab buffer */
+	UInt64 heapPayloads;		/* Payloads allocated from the heap */
+} EsifEventQueueStats, *EsifEventQueueStatsPtr;
+
+typedef struct EsifEventWorkerStats_s {
+	EsifRingStats queue;		/* Worker queue counters (depth, high-water mark, drops) */
+	UInt64 latencyMinUsec;		/* Minimum enqueue-to-dispatch latency */
+	UInt64 latencyMaxUsec;		/* Maximum enqueue-to-dispatch latency */
+	UInt64 latencyAvgUsec;		/* Average enqueue-to-dispatch latency */
+	UInt64 lastLatencyUsec;		/* Latency of the most recently dispatched event */
+	Bool isBusy;				/* Worker is currently dispatching an event */
+} EsifEventWorkerStats, *EsifEventWorkerStatsPtr;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* Number of event workers to create; set before EsifEventMgr_Init */
+extern UInt32 g_esifEventWorkers;
+
 eEsifError EsifEventMgr_Init(void);
 void EsifEventMgr_Exit(void);
 void EsifEventMgr_Disable(void);
@@ -174,6 +213,22 @@ eEsifError ESIF_CALLCONV EsifEventMgr_RegisterEventByType(
 	esif_context_t context
 	);
 
+/*
+ * Observers registered with EsifEventMgr_RegisterEventByType are never called
+ * on more than one event worker at a time.  An observer is identified by its
+ * callback and context; different observers are still called concurrently.
+ * Use this variant only for callbacks
+ * which protect their own state and may run concurrently for different
+ * participants.
+ */
+eEsifError ESIF_CALLCONV EsifEventMgr_RegisterReentrantEventByType(
+	eEsifEventType eventType,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EVENT_OBSERVER_CALLBACK eventCallback,
+	esif_context_t context
+	);
+
 eEsifError ESIF_CALLCONV EsifEventMgr_UnregisterEventByType(
 	eEsifEventType eventType,
 	esif_handle_t participantId,
@@ -216,6 +271,18 @@ Bool EsifEventMgr_IsEventRegistered(
 	UInt16 domainId
 	);
 
+/* For shell use */
+esif_error_t EsifEventMgr_GetQueueStats(EsifEventQueueStatsPtr statsPtr);
+void EsifEventMgr_ResetQueueStats(void);
+UInt32 EsifEventMgr_GetWorkerCount(void);
+esif_error_t EsifEventMgr_GetWorkerStats(UInt32 index, EsifEventWorkerStatsPtr statsPtr);
+
+/*
+ * For participant manager use: records the LF participant instance a UF participant was created for
+ * (ESIF_INSTANCE_INVALID if none), so its events are delivered by the same worker as the LF events
+ */
+void EsifEventMgr_SetParticipantLpid(esif_handle_t participantId, UInt8 lpInstance);
+
 eEsifError HandlePackagedEvent(
 	EsifEventParamsPtr eventParamsPtr,
 	size_t dataLen
@@ -0,0 +1,631 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+#define ESIF_TRACE_ID	ESIF_TRACEMODULE_LOGGINGMGR
+
+/*
+ * Participant Log CSV formatting and Binary Participant Log conversion.
+ * Kept apart from the Logging Manager so that it has no dependencies on the
+ * running UF and can be linked into the standalone esif_logconvert tool.
+ */
+#include "esif_uf_loggingmgr.h"
+#include "esif_temp.h"
+
+// Same as EsifDomainIdToIndex, which is not available to the offline converter
+static void EsifLogMgr_DomainIdToIndex(
+	UInt16 domain,
+	UInt8 *indexPtr
+	)
+{
+	UInt8 indexVal = (UInt8)(domain >> 8);
+
+	if (((domain & 0xFF) == ESIF_DOMAIN_IDENT_CHAR_D) && (indexVal >= '0') && (indexVal <= '9')) {
+		*indexPtr = (UInt8)(indexVal & 0x0F);
+	}
+}
+
+eEsifError EsifLogMgr_ParticipantLogAddHeaderData(
+	char *logString,
+	size_t dataLength,
+	EsifCapabilityDataPtr capabilityPtr,
+	EsifString participantName,
+	UInt8 domainId
+	)
+{
+	eEsifError rc = ESIF_OK;
+
+	ESIF_ASSERT(logString != NULL);
+	ESIF_ASSERT(capabilityPtr != NULL);
+	ESIF_ASSERT(participantName != NULL);
+	ESIF_ASSERT(participantName != NULL);
+
+	switch (capabilityPtr->type) {
+	case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " ControlID, Speed, Min Fan Speed %%, Max Fan Speed %%,");
+		break;
+	case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " Active Cores, Lower Limit, Upper Limit,");
+		break;
+	case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " Brightness Limit, Lower Limit, Upper Limit,");
+		break;
+	case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%dPriority,",participantName,domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_Energy Counter, %s_Instantaneous Power (mW),", participantName, participantName);
+		break;
+	case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PState Index, %s_D%d_Lower Limit, %s_D%d_Upper Limit,", 
+			participantName, 
+			domainId,
+			participantName, 
+			domainId,
+			participantName, 
+			domainId
+			);
+		break;
+	case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
+	{
+		UInt32 powerType = 0;
+		for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
+		{
+			esif_ccb_sprintf_concat(dataLength, logString, " PL%d Limit(mW), PL%d Min Power Limit(mW), PL%d Max Power Limit(mW), Stepsize(mW),"
+				" Minimum TimeWindow(ms), Maximum TimeWindow(ms), Minimum DutyCycle, Maximum DutyCycle,",
+				powerType + 1,
+				powerType + 1,
+				powerType + 1
+				);
+		}
+		esif_ccb_sprintf_concat(dataLength, logString, " SoC Power Floor State,");
+		break;
+	}
+	case ESIF_CAPABILITY_TYPE_POWER_STATUS:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Current Power(mW), %s_D%d_Current Power Sent To Filter(mW),"
+			" %s_D%d_Power Calculated By Filter(mW),",
+			participantName, domainId,
+			participantName,domainId,
+			participantName, domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Temperature(C),", participantName,domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Utilization,",participantName,domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PROP(mW), %s_D%d_ARTG(mW),"
+			" %s_D%d_PSRC, %s_D%d_AVOL(mV), %s_D%d_ACUR(mA), %s_D%d_AP01(%%), %s_D%d_AP02(%%), %s_D%d_AP10(%%),",
+			participantName,domainId,participantName,domainId,
+			participantName,domainId,participantName,domainId,
+			participantName,domainId,participantName,domainId,
+			participantName,domainId,participantName,domainId
+			);
+		break;
+	case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PMAX(mW), %s_D%d_PBSS(mW),"
+			" %s_D%d_CTYP, %s_D%d_RBHF(mOhm), %s_D%d_CMPP(mA), %s_D%d_VBNL(mV), %s_D%d_batteryPercentage(%%),",
+			participantName, domainId, participantName, domainId,
+			participantName, domainId, participantName, domainId,
+			participantName, domainId, participantName, domainId,
+			participantName, domainId
+		);
+		break;
+	case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Aux0(C), %s_D%d_Aux1(C), %s_D%d_Hysteresis(C),", 
+			participantName, 
+			domainId, 
+			participantName, 
+			domainId, 
+			participantName, 
+			domainId
+			);
+		break;
+	case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
+	{
+		for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
+		{
+			esif_ccb_sprintf_concat(dataLength, logString, " Channel Number, %s_D%d_Center Frequency(Hz), %s_D%d_Left Frequency Spread(Hz), %s_D%d_Right Frequency Spread(Hz),", 
+				participantName, domainId, participantName, domainId, participantName, domainId);
+		}
+		break;
+	}
+	case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Min Frequency(Hz), %s_D%d_Center Frequency(Hz), %s_D%d_Max Frequency(Hz), %s_D%d_SSC,",
+			participantName, domainId, participantName, domainId, participantName, domainId,
+			participantName, domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
+	{
+		UInt32 psysType = 0;
+		for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++) {
+			esif_ccb_sprintf_concat(dataLength, logString, " Psys PL%d Power Limit (mW), Psys PL%d Duty Cycle, Psys PL%d Time Window (ms),",
+				psysType + 1,
+				psysType + 1,
+				psysType + 1
+				);
+		}
+	}
+		break;
+	case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " AC Peak Power, DC Peak Power,");
+		break;
+	case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
+		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_TCC Offset(C), %s_D%d_Under Voltage Threshold (mV),", participantName, domainId, participantName, domainId);
+		break;
+	case ESIF_CAPABILITY_TYPE_MANAGER:
+		esif_ccb_sprintf_concat(dataLength, logString, " OS Power Source, OS Battery Percent, OS Dock Mode, OS Game Mode, OS Lid State, OS Power Slider, OS User Interaction,"
+			" OS User Presence, OS Screen State, Device Orientation, In Motion, System Cooling Mode, OS Platform Type,"
+			" Display Orientation, OS Power Scheme Personality, OS Mixed Reality Mode, Platform User Presence, Foreground Background Ratio,");
+		break;
+	default:
+		break;
+	}
+
+	return rc;
+}
+
+eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
+	char *logString,
+	size_t dataLength,
+	EsifParticipantLogDataNodePtr dataNodePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifCapabilityDataPtr capabilityPtr = NULL;
+
+	ESIF_ASSERT(logString != NULL);
+	ESIF_ASSERT(dataNodePtr != NULL);
+
+	capabilityPtr = &dataNodePtr->capabilityData;
+
+	if ((dataNodePtr->state >= ESIF_DATA_INITIALIZED) && (dataNodePtr->isPresent != ESIF_FALSE)) {
+	
+		switch (capabilityPtr->type) {
+		case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,",
+				capabilityPtr->data.activeControl.controlId,
+				capabilityPtr->data.activeControl.speed,
+				capabilityPtr->data.activeControl.lowerLimit,
+				capabilityPtr->data.activeControl.upperLimit
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
+				capabilityPtr->data.coreControl.activeLogicalProcessors,
+				capabilityPtr->data.coreControl.maximumActiveCores,
+				capabilityPtr->data.coreControl.minimumActiveCores
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
+				capabilityPtr->data.displayControl.currentDPTFLimit,
+				capabilityPtr->data.displayControl.lowerLimit,
+				capabilityPtr->data.displayControl.upperLimit
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u,",
+				capabilityPtr->data.domainPriority.priority
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u,",
+				capabilityPtr->data.energyControl.energyCounter,
+				capabilityPtr->data.energyControl.instantaneousPower);
+			break;
+		case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
+				capabilityPtr->data.performanceControl.pStateLimit,
+				capabilityPtr->data.performanceControl.lowerLimit,
+				capabilityPtr->data.performanceControl.upperLimit
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
+		{
+			UInt32 powerType = 0;
+			for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
+			{
+				if ((capabilityPtr->data.powerControl.powerDataSet[powerType].powerType <= MAX_POWER_CONTROL_TYPE) &&
+					(capabilityPtr->data.powerControl.powerDataSet[powerType].isEnabled != ESIF_FALSE)) {
+					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u, %u,",
+						capabilityPtr->data.powerControl.powerDataSet[powerType].powerLimit,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].lowerLimit,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].upperLimit,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].stepsize,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].minTimeWindow,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].maxTimeWindow,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].minDutyCycle,
+						capabilityPtr->data.powerControl.powerDataSet[powerType].maxDutyCycle
+					);
+				}
+				else {
+					esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
+				}
+			}
+			if (capabilityPtr->data.powerControl.socPowerFloorData.isSupported != ESIF_FALSE) {
+				esif_ccb_sprintf_concat(dataLength, logString, " %u,",
+					capabilityPtr->data.powerControl.socPowerFloorData.socPowerFloorState);
+			}
+			else {
+				esif_ccb_sprintf_concat(dataLength, logString, " X,");
+			}
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_POWER_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
+				capabilityPtr->data.powerStatus.currentPower,
+				capabilityPtr->data.powerStatus.powerFilterData.currentPowerSentToFilter,
+				capabilityPtr->data.powerStatus.powerFilterData.powerCalculatedByFilter
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
+		{
+			int temp = (int)capabilityPtr->data.temperatureStatus.temperature;
+			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&temp);
+
+			esif_ccb_sprintf_concat(dataLength, logString, " %.1f,", temp / 10.0);
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u,",
+				capabilityPtr->data.utilizationStatus.utilization
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u, %u,",
+				capabilityPtr->data.platformPowerStatus.platformRestOfPower,
+				capabilityPtr->data.platformPowerStatus.adapterPowerRating,
+				capabilityPtr->data.platformPowerStatus.platformPowerSource,
+				capabilityPtr->data.platformPowerStatus.acNominalVoltage,
+				capabilityPtr->data.platformPowerStatus.acOperationalCurrent,
+				capabilityPtr->data.platformPowerStatus.ac1msOverload,
+				capabilityPtr->data.platformPowerStatus.ac2msOverload,
+				capabilityPtr->data.platformPowerStatus.ac10msOverload
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u,",
+				capabilityPtr->data.batteryStatus.maxBatteryPower,
+				capabilityPtr->data.batteryStatus.steadyStateBatteryPower,
+				capabilityPtr->data.batteryStatus.chargerType,
+				capabilityPtr->data.batteryStatus.highFrequencyImpedance,
+				capabilityPtr->data.batteryStatus.maxPeakCurrent,
+				capabilityPtr->data.batteryStatus.noLoadVoltage,
+				capabilityPtr->data.batteryStatus.batteryPercentage
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
+		{
+			int tempAux0 = (int)capabilityPtr->data.temperatureThresholdControl.aux0;
+			int tempAux1 = (int)capabilityPtr->data.temperatureThresholdControl.aux1;
+			int tempHyst = (int)capabilityPtr->data.temperatureThresholdControl.hysteresis;
+
+			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempAux0);
+			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempAux1);
+			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempHyst);
+
+			esif_ccb_sprintf_concat(dataLength, logString, " %.1f, %.1f, %.1f,",
+				tempAux0 / 10.0,
+				tempAux1 / 10.0,
+				tempHyst / 10.0
+				);
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
+		{
+			for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
+			{
+				UInt32 centerFrequency = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].centerFrequency;
+				UInt32 leftFrequencySpread = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].leftFrequencySpread;
+				UInt32 rightFrequencySpread = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].rightFrequencySpread;
+				if (centerFrequency != ESIF_INVALID_DATA && leftFrequencySpread != ESIF_INVALID_DATA && rightFrequencySpread != ESIF_INVALID_DATA) {
+					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,", channelNumber, centerFrequency,
+						leftFrequencySpread, rightFrequencySpread);
+				}
+				else {
+					esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
+				}
+			}
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,",
+				capabilityPtr->data.rfProfileControl.rfProfileMinFrequency,
+				capabilityPtr->data.rfProfileControl.rfProfileCenterFrequency,
+				capabilityPtr->data.rfProfileControl.rfProfileMaxFrequency,
+				capabilityPtr->data.rfProfileControl.rfProfileSSC
+				);
+			break;
+		case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
+		{
+			UInt32 psysType = 0;
+			for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++)
+			{
+				if (capabilityPtr->data.psysControl.powerDataSet[psysType].powerLimitType <= MAX_PSYS_CONTROL_TYPE) {
+					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, ",
+						capabilityPtr->data.psysControl.powerDataSet[psysType].powerLimit,
+						capabilityPtr->data.psysControl.powerDataSet[psysType].PowerLimitDutyCycle,
+						capabilityPtr->data.psysControl.powerDataSet[psysType].PowerLimitTimeWindow
+					);
+				}
+			}
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u,",
+				capabilityPtr->data.peakPowerControl.acPeakPower,
+				capabilityPtr->data.peakPowerControl.dcPeakPower
+			);
+			break;
+		case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
+		{
+			int temp = (int)capabilityPtr->data.processorControlStatus.tccOffset;
+			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&temp);
+
+			esif_ccb_sprintf_concat(dataLength, logString, " %.1f, %u,", temp / 10.0, capabilityPtr->data.processorControlStatus.uvth);
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_MANAGER:
+		{
+			if (capabilityPtr->data.managerStatus.osPowerSource == ESIF_INVALID_DATA) {
+				esif_ccb_sprintf_concat(dataLength, logString, " X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,");
+			}
+			else {
+				esif_ccb_sprintf_concat(dataLength, logString, " %u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,",
+					capabilityPtr->data.managerStatus.osPowerSource,
+					capabilityPtr->data.managerStatus.batteryPercent,
+					capabilityPtr->data.managerStatus.dockMode,
+					capabilityPtr->data.managerStatus.gameMode,
+					capabilityPtr->data.managerStatus.lidState,
+					capabilityPtr->data.managerStatus.powerSlider,
+					capabilityPtr->data.managerStatus.userInteraction,
+					capabilityPtr->data.managerStatus.userPresence,
+					capabilityPtr->data.managerStatus.screenState,
+					capabilityPtr->data.managerStatus.deviceOrientation,
+					capabilityPtr->data.managerStatus.inMotion,
+					capabilityPtr->data.managerStatus.systemCoolingMode,
+					capabilityPtr->data.managerStatus.platformType,
+					capabilityPtr->data.managerStatus.displayOrientation,
+					capabilityPtr->data.managerStatus.powerSchemePersonality,
+					capabilityPtr->data.managerStatus.mixedRealityMode,
+					capabilityPtr->data.managerStatus.platformUserPresence,
+					capabilityPtr->data.managerStatus.foregroundBackgroundRatio
+				);
+			}
+			break;
+		}
+			
+		default:
+			rc = ESIF_E_UNSPECIFIED;
+			break;
+		}
+	}
+	else {
+		switch (capabilityPtr->type) {
+		case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
+		case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
+		case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
+		case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
+		case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
+		case ESIF_CAPABILITY_TYPE_POWER_STATUS:
+		case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
+		case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
+		{
+			UInt32 powerType = 0;
+			for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
+			{
+				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
+			}
+			esif_ccb_sprintf_concat(dataLength, logString, " X,");
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
+		{
+			for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
+			{
+				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
+			}
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
+		{
+			UInt32 psysType = 0;
+			for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++)
+			{
+				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, ");
+			}
+			break;
+		}
+		case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
+			esif_ccb_sprintf_concat(dataLength, logString, " X, X,");
+			break;
+		case ESIF_CAPABILITY_TYPE_MANAGER:
+			esif_ccb_sprintf_concat(dataLength, logString, " X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,");
+			break;
+		default:
+			rc = ESIF_E_UNSPECIFIED;
+			break;
+		}
+	}
+
+	return rc;
+}
+
+// Convert a binary participant log to the CSV participant log format
+eEsifError EsifLogMgr_BinaryLogConvert(
+	const char *binaryPath,
+	const char *csvPath,
+	UInt32 *rowsPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	FILE *binFile = NULL;
+	FILE *csvFile = NULL;
+	char *logData = NULL;
+	UInt8 *record = NULL;
+	size_t recordAlloc = 0;
+	EsifParticipantLogSchemaColumnPtr schema = NULL;
+	UInt32 schemaColumns = 0;
+	EsifParticipantLogRecordHdr hdr = { 0 };
+	EsifParticipantLogDataNode node = { 0 };
+
+	*rowsPtr = 0;
+	binFile = esif_ccb_fopen((esif_string)binaryPath, (esif_string)FILEMODE_READ FILEMODE_BINARY, NULL);
+	csvFile = esif_ccb_fopen((esif_string)csvPath, (esif_string)FILEMODE_WRITE, NULL);
+	logData = (char *)esif_ccb_malloc(MAX_LOG_DATA);
+	if ((binFile == NULL) || (csvFile == NULL)) {
+		rc = ESIF_E_IO_OPEN_FAILED;
+		goto exit;
+	}
+	if (logData == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	while (esif_ccb_fread(&hdr, sizeof(hdr), sizeof(hdr), 1, binFile) == 1) {
+		size_t bodySize = 0;
+		size_t columnSize = 0;
+		size_t logLen = 0;
+		esif_handle_t currentParticipantId = ESIF_INVALID_HANDLE;
+		UInt32 currentDomainId = (UInt32)-1;
+		UInt32 column = 0;
+
+		columnSize = (hdr.recordType == PARTICIPANTLOG_BIN_RECORD_SCHEMA ? sizeof(EsifParticipantLogSchemaColumn) : sizeof(EsifParticipantLogSampleColumn));
+		if ((hdr.signature != PARTICIPANTLOG_BIN_SIGNATURE) ||
+			(hdr.version != PARTICIPANTLOG_BIN_VERSION) ||
+			(hdr.recordSize != sizeof(hdr) + ((size_t)hdr.columns * columnSize))) {
+			rc = ESIF_E_INVALID_REQUEST_TYPE;
+			goto exit;
+		}
+
+		bodySize = hdr.recordSize - sizeof(hdr);
+		if (bodySize > recordAlloc) {
+			UInt8 *newRecord = (UInt8 *)esif_ccb_realloc(record, bodySize);
+			if (newRecord == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+				goto exit;
+			}
+			record = newRecord;
+			recordAlloc = bodySize;
+		}
+		if ((bodySize > 0) && (esif_ccb_fread(record, recordAlloc, bodySize, 1, binFile) != 1)) {
+			break; // Truncated final record
+		}
+
+		if (hdr.recordType == PARTICIPANTLOG_BIN_RECORD_SCHEMA) {
+			esif_ccb_free(schema);
+			schema = (EsifParticipantLogSchemaColumnPtr)esif_ccb_malloc(bodySize + 1);
+			if (schema == NULL) {
+				rc = ESIF_E_NO_MEMORY;
+				goto exit;
+			}
+			esif_ccb_memcpy(schema, record, bodySize);
+			schemaColumns = hdr.columns;
+
+			esif_ccb_sprintf(MAX_LOG_DATA, logData, " Date, Time, Server Msec,");
+			logLen = esif_ccb_strlen(logData, MAX_LOG_DATA);
+			for (column = 0; column < schemaColumns; column++) {
+				UInt8 domainIndex = 0;
+				schema[column].name[sizeof(schema[column].name) - 1] = 0;
+				if (currentParticipantId != (esif_handle_t)schema[column].participantId) {
+					esif_ccb_sprintf_concat(MAX_LOG_DATA - logLen, logData + logLen, " Participant ID, Participant Name, Domain Id,");
+				}
+				else if (currentDomainId != schema[column].domainId) {
+					esif_ccb_sprintf_concat(MAX_LOG_DATA - logLen, logData + logLen, " Domain Id,");
+				}
+				node.capabilityData.type = schema[column].capabilityType;
+				EsifLogMgr_DomainIdToIndex((UInt16)schema[column].domainId, &domainIndex);
+				EsifLogMgr_ParticipantLogAddHeaderData(logData + logLen, MAX_LOG_DATA - logLen, &node.capabilityData, schema[column].name, domainIndex);
+				logLen += esif_ccb_strlen(logData + logLen, MAX_LOG_DATA - logLen);
+
+				currentParticipantId = (esif_handle_t)schema[column].participantId;
+				currentDomainId = schema[column].domainId;
+			}
+		}
+		else if ((hdr.recordType == PARTICIPANTLOG_BIN_RECORD_SAMPLE) && (schema != NULL) && (hdr.columns == schemaColumns)) {
+			EsifParticipantLogSampleColumnPtr sample = (EsifParticipantLogSampleColumnPtr)record;
+			time_t now = (time_t)hdr.timestamp;
+			struct tm time = { 0 };
+
+			logData[0] = 0;
+			if (esif_ccb_localtime(&time, &now) == 0) {
+				esif_ccb_sprintf(MAX_LOG_DATA, logData, " %04d-%02d-%02d, %02d:%02d:%02d, %llu,",
+					time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec, (unsigned long long)hdr.msec);
+			}
+			logLen = esif_ccb_strlen(logData, MAX_LOG_DATA);
+			for (column = 0; column < schemaColumns; column++) {
+				UInt8 domainIndex = 0;
+				EsifLogMgr_DomainIdToIndex((UInt16)schema[column].domainId, &domainIndex);
+				if (currentParticipantId != (esif_handle_t)schema[column].participantId) {
+					esif_ccb_sprintf_concat(MAX_LOG_DATA - logLen, logData + logLen, " %llu, %s, %d,",
+						(unsigned long long)schema[column].participantId,
+						((sample[column].flags & PARTICIPANTLOG_COLUMN_AVAILABLE) ? schema[column].name : "UNAVAIL"),
+						domainIndex);
+				}
+				else if (currentDomainId != schema[column].domainId) {
+					esif_ccb_sprintf_concat(MAX_LOG_DATA - logLen, logData + logLen, " %d,", domainIndex);
+				}
+				node.state = ((sample[column].flags & PARTICIPANTLOG_COLUMN_INITIALIZED) ? ESIF_DATA_INITIALIZED : ESIF_DATA_CREATED);
+				node.isPresent = ((sample[column].flags & PARTICIPANTLOG_COLUMN_PRESENT) ? ESIF_TRUE : ESIF_FALSE);
+				esif_ccb_memcpy(&node.capabilityData, &sample[column].capabilityData, sizeof(node.capabilityData));
+				EsifLogMgr_ParticipantLogAddCapabilityData(logData + logLen, MAX_LOG_DATA - logLen, &node);
+				logLen += esif_ccb_strlen(logData + logLen, MAX_LOG_DATA - logLen);
+
+				currentParticipantId = (esif_handle_t)schema[column].participantId;
+				currentDomainId = schema[column].domainId;
+			}
+			(*rowsPtr)++;
+		}
+		else {
+			continue;
+		}
+		fprintf(csvFile, "%s \n", logData);
+	}
+exit:
+	if (binFile != NULL) {
+		esif_ccb_fclose(binFile);
+	}
+	if (csvFile != NULL) {
+		esif_ccb_fclose(csvFile);
+	}
+	esif_ccb_free(schema);
+	esif_ccb_free(record);
+	esif_ccb_free(logData);
+	return rc;
+}
@@ -23,8 +23,6 @@
 #include "esif_uf_event_cache.h"
 
 
-#define ESIF_INVALID_DATA        0xFFFFFFFF
-
 // Bounds checking
 #define MAX_SCHEDULER_MS	(24 * 60 * 60 * 1000)	// 24 hours; cannot exceed 2^31-1 (~24 days)
 
@@ -138,18 +136,6 @@ static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 void EsifLogMgr_ParticipantLogStart(EsifLoggingManagerPtr self);
 void EsifLogMgr_ParticipantLogStop(EsifLoggingManagerPtr self);
 static void EsifLogMgr_UpdateStatusCapabilityData(EsifParticipantLogDataNodePtr dataNodePtr);
-static eEsifError EsifLogMgr_ParticipantLogAddHeaderData(
-	char *logString,
-	size_t dataLength,
-	EsifCapabilityDataPtr capabilityPtr,
-	EsifString participantName,
-	UInt8 domainId
-	);
-static eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
-	char *logString,
-	size_t dataLength,
-	EsifParticipantLogDataNodePtr dataNodePtr
-	);
 static void EsifLogMgr_DataLogWrite(
 	EsifLoggingManagerPtr self,
 	char *logstring,
@@ -192,6 +178,17 @@ static void EsifLogMgr_ScheduledStartThread(const void *contextPtr);
 static void EsifLogMgr_DestroyParticipantLogData(EsifLoggingManagerPtr self);
 static void EsifLogMgr_DestroyEntry(EsifParticipantLogDataNodePtr curEntryPtr);
 static void EsifLogMgr_DestroyArgv(EsifLoggingManagerPtr self);
+static eEsifError EsifLogMgr_BinaryLogOpen(EsifLoggingManagerPtr self);
+static void EsifLogMgr_BinaryLogClose(EsifLoggingManagerPtr self);
+static void *ESIF_CALLCONV EsifLogMgr_BinaryLogWriterThread(void *ptr);
+static void EsifLogMgr_BinaryLogWriteSample(
+	EsifLoggingManagerPtr self,
+	Bool refreshStatus
+	);
+static eEsifError EsifLogMgr_ParseCmdConvert(
+	EsifLoggingManagerPtr self,
+	EsifShellCmdPtr shell
+	);
 
 //
 // PUBLIC INTERFACE---------------------------------------------------------------------
@@ -254,6 +251,7 @@ static eEsifError EsifLogMgr_Init(EsifLoggingManagerPtr self)
 	self->isLogStopped = ESIF_FALSE;
 	self->isLogSuspended = ESIF_FALSE;
 	self->isDefaultFile = ESIF_TRUE;
+	self->isDefaultBinaryFile = ESIF_TRUE;
 	self->listenersMask = ESIF_LISTENER_NONE;
 	self->listenerHeadersWrittenMask = ESIF_LISTENER_NONE;
 
@@ -268,31 +266,31 @@ static eEsifError EsifLogMgr_Init(EsifLoggingManagerPtr self)
 		goto exit;
 	}
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_DPTF_PARTICIPANT_CONTROL_ACTION,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_DPTF_PARTICIPANT_CONTROL_ACTION,
 		EVENT_MGR_MATCH_ANY,
 		EVENT_MGR_MATCH_ANY_DOMAIN,
 		EsifLogMgr_EventCallback,
 		esif_ccb_ptr2context(self));
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_CREATE_COMPLETE,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_CREATE_COMPLETE,
 		EVENT_MGR_MATCH_ANY,
 		EVENT_MGR_DOMAIN_D0,
 		EsifLogMgr_EventCallback,
 		esif_ccb_ptr2context(self));
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_SUSPEND,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_SUSPEND,
 		ESIF_HANDLE_PRIMARY_PARTICIPANT,
 		EVENT_MGR_DOMAIN_D0,
 		EsifLogMgr_EventCallback,
 		esif_ccb_ptr2context(self));
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_RESUME,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_RESUME,
 		ESIF_HANDLE_PRIMARY_PARTICIPANT,
 		EVENT_MGR_DOMAIN_D0,
 		EsifLogMgr_EventCallback,
 		esif_ccb_ptr2context(self));
 
-	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER,
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER,
 		EVENT_MGR_MATCH_ANY,
 		EVENT_MGR_DOMAIN_D0,
 		EsifLogMgr_EventCallback,
@@ -318,6 +316,7 @@ void EsifLogMgr_Exit()
 	if (self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) {
 		EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
 	}
+	EsifLogMgr_BinaryLogClose(self);
 	/*
 	 * Uninitialize the manager structure
 	 */
@@ -449,6 +448,10 @@ eEsifError EsifLogMgr_ParseCmdParticipantLog(
 	else if (esif_ccb_stricmp(argv[PARTICITPANTLOG_CMD_INDEX], PARTICIPANTLOG_CMD_SCHEDULE_STR) == 0) {
 		rc = EsifLogMgr_ParseCmdSchedule(self, shell);
 	}
+	else if (esif_ccb_stricmp(argv[PARTICITPANTLOG_CMD_INDEX], PARTICIPANTLOG_CMD_CONVERT_STR) == 0) {
+		rc = EsifLogMgr_ParseCmdConvert(self, shell);
+		goto exit;
+	}
 	else {
 		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error:Invalid usage. See help for command usage.\n");
 		rc = ESIF_E_NOT_SUPPORTED;
@@ -566,6 +569,7 @@ static eEsifError EsifLogMgr_ParseCmdStop(
 	if (self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) {
 		EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
 	}
+	EsifLogMgr_BinaryLogClose(self);
 
 	esif_ccb_strcat(output, "Stopped participant logging\n", OUT_BUF_LEN);
 
@@ -641,6 +645,28 @@ eEsifError EsifLogMgr_ParseCmdRoute(
 					}
 				}
 			}
+			else if (esif_ccb_stricmp(argv[i], ESIF_LISTENER_BINARY_STR) == 0) {
+				self->listenersMask = self->listenersMask | ESIF_LISTENER_BINARY_MASK;
+				i++;
+
+				// Check if file name is available as argument
+				if ((UInt32)argc <= i) {
+					self->isDefaultBinaryFile = ESIF_TRUE;
+				}
+				else {
+					char *fileExtn = esif_ccb_strchr(argv[i], '.');
+
+					//File name is given as input
+					self->isDefaultBinaryFile = ESIF_FALSE;
+
+					if (fileExtn == NULL) {
+						esif_ccb_sprintf(sizeof(self->binaryFilename), self->binaryFilename, "%s.bin", argv[i]);
+					}
+					else {
+						esif_ccb_sprintf(sizeof(self->binaryFilename), self->binaryFilename, "%s", argv[i]);
+					}
+				}
+			}
 			else {
 				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Invalid participant log target specified. See help for command line usage\n");
 				rc = ESIF_E_NOT_SUPPORTED;
@@ -657,6 +683,11 @@ eEsifError EsifLogMgr_ParseCmdRoute(
 		//Update the header flag here if log is started already
 		//otherwise not required
 		self->isLogHeader = ESIF_TRUE;
+
+		// The binary log stays open until logging stops so the polling thread never sees it closed underneath it
+		if (self->listenersMask & ESIF_LISTENER_BINARY_MASK) {
+			rc = EsifLogMgr_BinaryLogOpen(self);
+		}
 	}
 exit:
 	return rc;
@@ -1174,6 +1205,7 @@ static void EsifLogMgr_CleanupLoggingContext(EsifLoggingManagerPtr self)
 
 	//Close the old file
 	EsifLogFile_Close(ESIF_LOG_PARTICIPANT);
+	EsifLogMgr_BinaryLogClose(self);
 
 	//Free the input argv
 	EsifLogMgr_DestroyArgv(self);
@@ -1601,6 +1633,13 @@ static eEsifError EsifLogMgr_OpenRouteTargetLogFileIfRequired(EsifLoggingManager
 			}
 		}
 	}
+
+	if (self->listenersMask & ESIF_LISTENER_BINARY_MASK) {
+		rc = EsifLogMgr_BinaryLogOpen(self);
+		if (rc != ESIF_OK) {
+			goto exit;
+		}
+	}
 exit:
 	return rc;
 }
@@ -1891,13 +1930,23 @@ static void *ESIF_CALLCONV EsifLogMgr_ParticipantLogWorkerThread(void *ptr)
 		 */
 		if (self->listenersMask != ESIF_LISTENER_NONE) {
 			esif_ccb_system_time(&msecStart);
+			esif_listenermask_t textListeners = self->listenersMask & ~ESIF_LISTENER_BINARY_MASK;
+
 			//Header needs to be updated
 			if (self->isLogHeader) {
-				EsifLogMgr_ParticipantLogWriteHeader(self);
+				if (textListeners != ESIF_LISTENER_NONE) {
+					EsifLogMgr_ParticipantLogWriteHeader(self);
+				}
+				self->binaryLog.schemaColumns = 0;
 				self->listenerHeadersWrittenMask |= ESIF_LISTENER_ALL_MASK;
 				self->isLogHeader = ESIF_FALSE;
 			}
-			EsifLogMgr_ParticipantLogWriteData(self);
+			if (textListeners != ESIF_LISTENER_NONE) {
+				EsifLogMgr_ParticipantLogWriteData(self);
+			}
+			if (self->listenersMask & ESIF_LISTENER_BINARY_MASK) {
+				EsifLogMgr_BinaryLogWriteSample(self, (textListeners == ESIF_LISTENER_NONE));
+			}
 
 			esif_ccb_system_time(&msecStop);
 		}
@@ -1933,6 +1982,7 @@ static void EsifLogMgr_ParticipantLogWriteHeader(
 	UInt32 currentDomainId = (UInt32)-1;
 	UInt8 domainIndex = 0;
 	size_t dataLength = MAX_LOG_DATA;
+	size_t logLen = 0;
 	EsifString partName = "UNK";
 	EsifUpPtr upPtr = NULL;
 	Bool printTimeInfo = ESIF_TRUE;
@@ -1958,11 +2008,11 @@ static void EsifLogMgr_ParticipantLogWriteHeader(
 				printTimeInfo = ESIF_FALSE;
 			}
 			if (currentParticipantId != curEntryPtr->participantId) {
-				esif_ccb_sprintf_concat(dataLength, self->logData, " Participant ID, Participant Name, Domain Id,");
+				esif_ccb_sprintf_concat(dataLength - logLen, self->logData + logLen, " Participant ID, Participant Name, Domain Id,");
 			}
 			else if ((currentParticipantId == curEntryPtr->participantId) &&
 				(currentDomainId != curEntryPtr->domainId)) {
-				esif_ccb_sprintf_concat(dataLength, self->logData, " Domain Id,");
+				esif_ccb_sprintf_concat(dataLength - logLen, self->logData + logLen, " Domain Id,");
 			}
 
 			partName = "UNK";
@@ -1973,9 +2023,11 @@ static void EsifLogMgr_ParticipantLogWriteHeader(
 			}
 			EsifDomainIdToIndex((UInt16)curEntryPtr->domainId, &domainIndex);
 			esif_ccb_read_lock(&curEntryPtr->capabilityDataLock);
-			EsifLogMgr_ParticipantLogAddHeaderData(self->logData, dataLength, &curEntryPtr->capabilityData, partName, domainIndex);
+			EsifLogMgr_ParticipantLogAddHeaderData(self->logData + logLen, dataLength - logLen, &curEntryPtr->capabilityData, partName, domainIndex);
 			esif_ccb_read_unlock(&curEntryPtr->capabilityDataLock);
 
+			// Only scan the text appended for this entry so building the row stays linear
+			logLen += esif_ccb_strlen(self->logData + logLen, dataLength - logLen);
 			currentParticipantId = curEntryPtr->participantId;
 			currentDomainId = curEntryPtr->domainId;
 		}
@@ -2005,6 +2057,7 @@ static void EsifLogMgr_ParticipantLogWriteData(
 	UInt32 currentDomainId = (UInt32)-1;
 	UInt8 domainIndex = 0;
 	size_t dataLength = MAX_LOG_DATA;
+	size_t logLen = 0;
 	EsifUpPtr upPtr = NULL;
 	Bool printTimeInfo = ESIF_TRUE;
 
@@ -2047,18 +2100,21 @@ static void EsifLogMgr_ParticipantLogWriteData(
 							(1 << curEntryPtr->capabilityData.type)
 						);
 					}
-					esif_ccb_sprintf_concat(dataLength, self->logData, " %llu, %s, %d,", esif_ccb_handle2llu(curEntryPtr->participantId), EsifUp_GetName(upPtr), domainIndex);
+					esif_ccb_sprintf_concat(dataLength - logLen, self->logData + logLen, " %llu, %s, %d,", esif_ccb_handle2llu(curEntryPtr->participantId), EsifUp_GetName(upPtr), domainIndex);
 					EsifUp_PutRef(upPtr);
 				}
 				else {
-					esif_ccb_sprintf_concat(dataLength, self->logData, " %llu, UNAVAIL, %d,", esif_ccb_handle2llu(curEntryPtr->participantId), domainIndex);
+					esif_ccb_sprintf_concat(dataLength - logLen, self->logData + logLen, " %llu, UNAVAIL, %d,", esif_ccb_handle2llu(curEntryPtr->participantId), domainIndex);
 				}
 			}
 			else if ((currentParticipantId == curEntryPtr->participantId) &&
 				(currentDomainId != curEntryPtr->domainId)) {
-				esif_ccb_sprintf_concat(dataLength, self->logData, " %d,", domainIndex);
+				esif_ccb_sprintf_concat(dataLength - logLen, self->logData + logLen, " %d,", domainIndex);
 			}
-			EsifLogMgr_ParticipantLogAddDataNode(self->logData, dataLength, curEntryPtr);
+			EsifLogMgr_ParticipantLogAddDataNode(self->logData + logLen, dataLength - logLen, curEntryPtr);
+
+			// Only scan the text appended for this entry so building the row stays linear
+			logLen += esif_ccb_strlen(self->logData + logLen, dataLength - logLen);
 
 			currentParticipantId = curEntryPtr->participantId;
 			currentDomainId = curEntryPtr->domainId;
@@ -2075,147 +2131,6 @@ exit:
 	return;
 }
 
-static eEsifError EsifLogMgr_ParticipantLogAddHeaderData(
-	char *logString,
-	size_t dataLength,
-	EsifCapabilityDataPtr capabilityPtr,
-	EsifString participantName,
-	UInt8 domainId
-	)
-{
-	eEsifError rc = ESIF_OK;
-
-	ESIF_ASSERT(logString != NULL);
-	ESIF_ASSERT(capabilityPtr != NULL);
-	ESIF_ASSERT(participantName != NULL);
-	ESIF_ASSERT(participantName != NULL);
-
-	switch (capabilityPtr->type) {
-	case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " ControlID, Speed, Min Fan Speed %%, Max Fan Speed %%,");
-		break;
-	case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " Active Cores, Lower Limit, Upper Limit,");
-		break;
-	case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " Brightness Limit, Lower Limit, Upper Limit,");
-		break;
-	case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%dPriority,",participantName,domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_Energy Counter, %s_Instantaneous Power (mW),", participantName, participantName);
-		break;
-	case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PState Index, %s_D%d_Lower Limit, %s_D%d_Upper Limit,", 
-			participantName, 
-			domainId,
-			participantName, 
-			domainId,
-			participantName, 
-			domainId
-			);
-		break;
-	case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
-	{
-		UInt32 powerType = 0;
-		for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
-		{
-			esif_ccb_sprintf_concat(dataLength, logString, " PL%d Limit(mW), PL%d Min Power Limit(mW), PL%d Max Power Limit(mW), Stepsize(mW),"
-				" Minimum TimeWindow(ms), Maximum TimeWindow(ms), Minimum DutyCycle, Maximum DutyCycle,",
-				powerType + 1,
-				powerType + 1,
-				powerType + 1
-				);
-		}
-		esif_ccb_sprintf_concat(dataLength, logString, " SoC Power Floor State,");
-		break;
-	}
-	case ESIF_CAPABILITY_TYPE_POWER_STATUS:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Current Power(mW), %s_D%d_Current Power Sent To Filter(mW),"
-			" %s_D%d_Power Calculated By Filter(mW),",
-			participantName, domainId,
-			participantName,domainId,
-			participantName, domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Temperature(C),", participantName,domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Utilization,",participantName,domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PROP(mW), %s_D%d_ARTG(mW),"
-			" %s_D%d_PSRC, %s_D%d_AVOL(mV), %s_D%d_ACUR(mA), %s_D%d_AP01(%%), %s_D%d_AP02(%%), %s_D%d_AP10(%%),",
-			participantName,domainId,participantName,domainId,
-			participantName,domainId,participantName,domainId,
-			participantName,domainId,participantName,domainId,
-			participantName,domainId,participantName,domainId
-			);
-		break;
-	case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_PMAX(mW), %s_D%d_PBSS(mW),"
-			" %s_D%d_CTYP, %s_D%d_RBHF(mOhm), %s_D%d_CMPP(mA), %s_D%d_VBNL(mV), %s_D%d_batteryPercentage(%%),",
-			participantName, domainId, participantName, domainId,
-			participantName, domainId, participantName, domainId,
-			participantName, domainId, participantName, domainId,
-			participantName, domainId
-		);
-		break;
-	case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Aux0(C), %s_D%d_Aux1(C), %s_D%d_Hysteresis(C),", 
-			participantName, 
-			domainId, 
-			participantName, 
-			domainId, 
-			participantName, 
-			domainId
-			);
-		break;
-	case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
-	{
-		for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
-		{
-			esif_ccb_sprintf_concat(dataLength, logString, " Channel Number, %s_D%d_Center Frequency(Hz), %s_D%d_Left Frequency Spread(Hz), %s_D%d_Right Frequency Spread(Hz),", 
-				participantName, domainId, participantName, domainId, participantName, domainId);
-		}
-		break;
-	}
-	case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_Min Frequency(Hz), %s_D%d_Center Frequency(Hz), %s_D%d_Max Frequency(Hz), %s_D%d_SSC,",
-			participantName, domainId, participantName, domainId, participantName, domainId,
-			participantName, domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
-	{
-		UInt32 psysType = 0;
-		for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++) {
-			esif_ccb_sprintf_concat(dataLength, logString, " Psys PL%d Power Limit (mW), Psys PL%d Duty Cycle, Psys PL%d Time Window (ms),",
-				psysType + 1,
-				psysType + 1,
-				psysType + 1
-				);
-		}
-	}
-		break;
-	case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " AC Peak Power, DC Peak Power,");
-		break;
-	case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
-		esif_ccb_sprintf_concat(dataLength, logString, " %s_D%d_TCC Offset(C), %s_D%d_Under Voltage Threshold (mV),", participantName, domainId, participantName, domainId);
-		break;
-	case ESIF_CAPABILITY_TYPE_MANAGER:
-		esif_ccb_sprintf_concat(dataLength, logString, " OS Power Source, OS Battery Percent, OS Dock Mode, OS Game Mode, OS Lid State, OS Power Slider, OS User Interaction,"
-			" OS User Presence, OS Screen State, Device Orientation, In Motion, System Cooling Mode, OS Platform Type,"
-			" Display Orientation, OS Power Scheme Personality, OS Mixed Reality Mode, Platform User Presence, Foreground Background Ratio,");
-		break;
-	default:
-		break;
-	}
-
-	return rc;
-}
-
 static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 	char *logString,
 	size_t dataLength,
@@ -2240,315 +2155,6 @@ static eEsifError EsifLogMgr_ParticipantLogAddDataNode(
 	return rc;
 }
 
-static eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
-	char *logString,
-	size_t dataLength,
-	EsifParticipantLogDataNodePtr dataNodePtr
-	)
-{
-	eEsifError rc = ESIF_OK;
-	EsifCapabilityDataPtr capabilityPtr = NULL;
-
-	ESIF_ASSERT(logString != NULL);
-	ESIF_ASSERT(dataNodePtr != NULL);
-
-	capabilityPtr = &dataNodePtr->capabilityData;
-
-	if ((dataNodePtr->state >= ESIF_DATA_INITIALIZED) && (dataNodePtr->isPresent != ESIF_FALSE)) {
-	
-		switch (capabilityPtr->type) {
-		case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,",
-				capabilityPtr->data.activeControl.controlId,
-				capabilityPtr->data.activeControl.speed,
-				capabilityPtr->data.activeControl.lowerLimit,
-				capabilityPtr->data.activeControl.upperLimit
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
-				capabilityPtr->data.coreControl.activeLogicalProcessors,
-				capabilityPtr->data.coreControl.maximumActiveCores,
-				capabilityPtr->data.coreControl.minimumActiveCores
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
-				capabilityPtr->data.displayControl.currentDPTFLimit,
-				capabilityPtr->data.displayControl.lowerLimit,
-				capabilityPtr->data.displayControl.upperLimit
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u,",
-				capabilityPtr->data.domainPriority.priority
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u,",
-				capabilityPtr->data.energyControl.energyCounter,
-				capabilityPtr->data.energyControl.instantaneousPower);
-			break;
-		case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
-				capabilityPtr->data.performanceControl.pStateLimit,
-				capabilityPtr->data.performanceControl.lowerLimit,
-				capabilityPtr->data.performanceControl.upperLimit
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
-		{
-			UInt32 powerType = 0;
-			for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
-			{
-				if ((capabilityPtr->data.powerControl.powerDataSet[powerType].powerType <= MAX_POWER_CONTROL_TYPE) &&
-					(capabilityPtr->data.powerControl.powerDataSet[powerType].isEnabled != ESIF_FALSE)) {
-					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u, %u,",
-						capabilityPtr->data.powerControl.powerDataSet[powerType].powerLimit,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].lowerLimit,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].upperLimit,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].stepsize,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].minTimeWindow,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].maxTimeWindow,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].minDutyCycle,
-						capabilityPtr->data.powerControl.powerDataSet[powerType].maxDutyCycle
-					);
-				}
-				else {
-					esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
-				}
-			}
-			if (capabilityPtr->data.powerControl.socPowerFloorData.isSupported != ESIF_FALSE) {
-				esif_ccb_sprintf_concat(dataLength, logString, " %u,",
-					capabilityPtr->data.powerControl.socPowerFloorData.socPowerFloorState);
-			}
-			else {
-				esif_ccb_sprintf_concat(dataLength, logString, " X,");
-			}
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_POWER_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u,",
-				capabilityPtr->data.powerStatus.currentPower,
-				capabilityPtr->data.powerStatus.powerFilterData.currentPowerSentToFilter,
-				capabilityPtr->data.powerStatus.powerFilterData.powerCalculatedByFilter
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
-		{
-			int temp = (int)capabilityPtr->data.temperatureStatus.temperature;
-			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&temp);
-
-			esif_ccb_sprintf_concat(dataLength, logString, " %.1f,", temp / 10.0);
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u,",
-				capabilityPtr->data.utilizationStatus.utilization
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u, %u,",
-				capabilityPtr->data.platformPowerStatus.platformRestOfPower,
-				capabilityPtr->data.platformPowerStatus.adapterPowerRating,
-				capabilityPtr->data.platformPowerStatus.platformPowerSource,
-				capabilityPtr->data.platformPowerStatus.acNominalVoltage,
-				capabilityPtr->data.platformPowerStatus.acOperationalCurrent,
-				capabilityPtr->data.platformPowerStatus.ac1msOverload,
-				capabilityPtr->data.platformPowerStatus.ac2msOverload,
-				capabilityPtr->data.platformPowerStatus.ac10msOverload
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u, %u, %u, %u,",
-				capabilityPtr->data.batteryStatus.maxBatteryPower,
-				capabilityPtr->data.batteryStatus.steadyStateBatteryPower,
-				capabilityPtr->data.batteryStatus.chargerType,
-				capabilityPtr->data.batteryStatus.highFrequencyImpedance,
-				capabilityPtr->data.batteryStatus.maxPeakCurrent,
-				capabilityPtr->data.batteryStatus.noLoadVoltage,
-				capabilityPtr->data.batteryStatus.batteryPercentage
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
-		{
-			int tempAux0 = (int)capabilityPtr->data.temperatureThresholdControl.aux0;
-			int tempAux1 = (int)capabilityPtr->data.temperatureThresholdControl.aux1;
-			int tempHyst = (int)capabilityPtr->data.temperatureThresholdControl.hysteresis;
-
-			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempAux0);
-			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempAux1);
-			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&tempHyst);
-
-			esif_ccb_sprintf_concat(dataLength, logString, " %.1f, %.1f, %.1f,",
-				tempAux0 / 10.0,
-				tempAux1 / 10.0,
-				tempHyst / 10.0
-				);
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
-		{
-			for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
-			{
-				UInt32 centerFrequency = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].centerFrequency;
-				UInt32 leftFrequencySpread = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].leftFrequencySpread;
-				UInt32 rightFrequencySpread = capabilityPtr->data.rfProfileStatus.rfProfileFrequencyData[channelNumber].rightFrequencySpread;
-				if (centerFrequency != ESIF_INVALID_DATA && leftFrequencySpread != ESIF_INVALID_DATA && rightFrequencySpread != ESIF_INVALID_DATA) {
-					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,", channelNumber, centerFrequency,
-						leftFrequencySpread, rightFrequencySpread);
-				}
-				else {
-					esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
-				}
-			}
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, %u,",
-				capabilityPtr->data.rfProfileControl.rfProfileMinFrequency,
-				capabilityPtr->data.rfProfileControl.rfProfileCenterFrequency,
-				capabilityPtr->data.rfProfileControl.rfProfileMaxFrequency,
-				capabilityPtr->data.rfProfileControl.rfProfileSSC
-				);
-			break;
-		case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
-		{
-			UInt32 psysType = 0;
-			for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++)
-			{
-				if (capabilityPtr->data.psysControl.powerDataSet[psysType].powerLimitType <= MAX_PSYS_CONTROL_TYPE) {
-					esif_ccb_sprintf_concat(dataLength, logString, " %u, %u, %u, ",
-						capabilityPtr->data.psysControl.powerDataSet[psysType].powerLimit,
-						capabilityPtr->data.psysControl.powerDataSet[psysType].PowerLimitDutyCycle,
-						capabilityPtr->data.psysControl.powerDataSet[psysType].PowerLimitTimeWindow
-					);
-				}
-			}
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " %u, %u,",
-				capabilityPtr->data.peakPowerControl.acPeakPower,
-				capabilityPtr->data.peakPowerControl.dcPeakPower
-			);
-			break;
-		case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
-		{
-			int temp = (int)capabilityPtr->data.processorControlStatus.tccOffset;
-			esif_convert_temp(NORMALIZE_TEMP_TYPE, ESIF_TEMP_DECIC, (esif_temp_t *)&temp);
-
-			esif_ccb_sprintf_concat(dataLength, logString, " %.1f, %u,", temp / 10.0, capabilityPtr->data.processorControlStatus.uvth);
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_MANAGER:
-		{
-			if (capabilityPtr->data.managerStatus.osPowerSource == ESIF_INVALID_DATA) {
-				esif_ccb_sprintf_concat(dataLength, logString, " X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,");
-			}
-			else {
-				esif_ccb_sprintf_concat(dataLength, logString, " %u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u,",
-					capabilityPtr->data.managerStatus.osPowerSource,
-					capabilityPtr->data.managerStatus.batteryPercent,
-					capabilityPtr->data.managerStatus.dockMode,
-					capabilityPtr->data.managerStatus.gameMode,
-					capabilityPtr->data.managerStatus.lidState,
-					capabilityPtr->data.managerStatus.powerSlider,
-					capabilityPtr->data.managerStatus.userInteraction,
-					capabilityPtr->data.managerStatus.userPresence,
-					capabilityPtr->data.managerStatus.screenState,
-					capabilityPtr->data.managerStatus.deviceOrientation,
-					capabilityPtr->data.managerStatus.inMotion,
-					capabilityPtr->data.managerStatus.systemCoolingMode,
-					capabilityPtr->data.managerStatus.platformType,
-					capabilityPtr->data.managerStatus.displayOrientation,
-					capabilityPtr->data.managerStatus.powerSchemePersonality,
-					capabilityPtr->data.managerStatus.mixedRealityMode,
-					capabilityPtr->data.managerStatus.platformUserPresence,
-					capabilityPtr->data.managerStatus.foregroundBackgroundRatio
-				);
-			}
-			break;
-		}
-			
-		default:
-			rc = ESIF_E_UNSPECIFIED;
-			break;
-		}
-	}
-	else {
-		switch (capabilityPtr->type) {
-		case ESIF_CAPABILITY_TYPE_DOMAIN_PRIORITY:
-		case ESIF_CAPABILITY_TYPE_TEMP_STATUS:
-		case ESIF_CAPABILITY_TYPE_UTIL_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_ACTIVE_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_CORE_CONTROL:
-		case ESIF_CAPABILITY_TYPE_DISPLAY_CONTROL:
-		case ESIF_CAPABILITY_TYPE_PERF_CONTROL:
-		case ESIF_CAPABILITY_TYPE_POWER_STATUS:
-		case ESIF_CAPABILITY_TYPE_TEMP_THRESHOLD:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_RFPROFILE_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_PROCESSOR_CONTROL:
-		case ESIF_CAPABILITY_TYPE_ENERGY_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_PLAT_POWER_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_BATTERY_STATUS:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_POWER_CONTROL:
-		{
-			UInt32 powerType = 0;
-			for (powerType = 0; powerType < MAX_POWER_CONTROL_TYPE; powerType++)
-			{
-				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X, X, X, X, X,");
-			}
-			esif_ccb_sprintf_concat(dataLength, logString, " X,");
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_RFPROFILE_STATUS:
-		{
-			for (UInt32 channelNumber = 0; channelNumber < MAX_FREQUENCY_CHANNEL_NUM; channelNumber++)
-			{
-				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, X,");
-			}
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_PSYS_CONTROL:
-		{
-			UInt32 psysType = 0;
-			for (psysType = 0; psysType < MAX_PSYS_CONTROL_TYPE; psysType++)
-			{
-				esif_ccb_sprintf_concat(dataLength, logString, " X, X, X, ");
-			}
-			break;
-		}
-		case ESIF_CAPABILITY_TYPE_PEAK_POWER_CONTROL:
-			esif_ccb_sprintf_concat(dataLength, logString, " X, X,");
-			break;
-		case ESIF_CAPABILITY_TYPE_MANAGER:
-			esif_ccb_sprintf_concat(dataLength, logString, " X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,X,");
-			break;
-		default:
-			rc = ESIF_E_UNSPECIFIED;
-			break;
-		}
-	}
-
-	return rc;
-}
-
-
 //
 // WARNING:  Any new cases must be added to g_statusCapability
 //
@@ -2904,6 +2510,403 @@ static void EsifLogMgr_UpdateStatusCapabilityData(EsifParticipantLogDataNodePtr
 	return;
 }
 
+/*
+ * Binary Participant Log
+ */
+static eEsifError EsifLogMgr_BinaryLogOpen(EsifLoggingManagerPtr self)
+{
+	eEsifError rc = ESIF_OK;
+	EsifParticipantLogBinaryPtr binLog = NULL;
+	char logname[MAX_PATH] = { 0 };
+	char fullpath[MAX_PATH] = { 0 };
+
+	ESIF_ASSERT(self != NULL);
+	binLog = &self->binaryLog;
+
+	if (atomic_read(&binLog->isOpen)) {
+		goto exit;
+	}
+
+	if ((self->isDefaultBinaryFile == ESIF_FALSE) && (*self->binaryFilename != '\0')) {
+		esif_ccb_strcpy(logname, self->binaryFilename, sizeof(logname));
+	}
+	else {
+		time_t now = time(NULL);
+		struct tm time = { 0 };
+		if (esif_ccb_localtime(&time, &now) == 0) {
+			esif_ccb_sprintf(sizeof(logname), logname, "participant_log_%04d-%02d-%02d-%02d%02d%02d.bin",
+				time.tm_year + TIME_BASE_YEAR, time.tm_mon + 1, time.tm_mday, time.tm_hour, time.tm_min, time.tm_sec);
+		}
+	}
+	EsifLogFile_GetFullPath(fullpath, sizeof(fullpath), logname);
+
+	binLog->ringSize = PARTICIPANTLOG_BIN_RING_SIZE;
+	binLog->ring = (UInt8 *)esif_ccb_malloc(binLog->ringSize);
+	if (binLog->ring == NULL) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	binLog->fileHandle = esif_ccb_fopen(fullpath, (esif_string)FILEMODE_WRITE FILEMODE_BINARY, NULL);
+	if (binLog->fileHandle == NULL) {
+		ESIF_TRACE_ERROR("Unable to open binary participant log %s", fullpath);
+		rc = ESIF_E_IO_ERROR;
+		goto exit;
+	}
+	esif_ccb_strcpy(self->binaryFilename, logname, sizeof(self->binaryFilename));
+
+	atomic64_set(&binLog->head, 0);
+	atomic64_set(&binLog->tail, 0);
+	atomic64_set(&binLog->dropped, 0);
+	atomic_set(&binLog->isWriterStopped, 0);
+	binLog->schemaColumns = 0;
+
+	esif_ccb_event_init(&binLog->writerStopEvent);
+	rc = esif_ccb_thread_create(&binLog->writerThread, EsifLogMgr_BinaryLogWriterThread, binLog);
+	if (rc != ESIF_OK) {
+		esif_ccb_event_uninit(&binLog->writerStopEvent);
+		goto exit;
+	}
+
+	// Records may only be queued once the writer is ready
+	atomic_set(&binLog->isOpen, 1);
+exit:
+	if (rc != ESIF_OK) {
+		if (binLog->fileHandle != NULL) {
+			esif_ccb_fclose(binLog->fileHandle);
+			binLog->fileHandle = NULL;
+		}
+		esif_ccb_free(binLog->ring);
+		binLog->ring = NULL;
+	}
+	return rc;
+}
+
+static void EsifLogMgr_BinaryLogClose(EsifLoggingManagerPtr self)
+{
+	EsifParticipantLogBinaryPtr binLog = NULL;
+
+	ESIF_ASSERT(self != NULL);
+	binLog = &self->binaryLog;
+
+	if (atomic_read(&binLog->isOpen)) {
+		atomic_set(&binLog->isOpen, 0);
+
+		// The writer drains any queued records before exiting
+		atomic_set(&binLog->isWriterStopped, 1);
+		esif_ccb_event_set(&binLog->writerStopEvent);
+		esif_ccb_thread_join(&binLog->writerThread);
+		esif_ccb_event_uninit(&binLog->writerStopEvent);
+
+		if (atomic64_read(&binLog->dropped) > 0) {
+			ESIF_TRACE_WARN("Binary participant log dropped %lld records", (long long)atomic64_read(&binLog->dropped));
+		}
+		esif_ccb_fclose(binLog->fileHandle);
+		binLog->fileHandle = NULL;
+		esif_ccb_free(binLog->ring);
+		binLog->ring = NULL;
+	}
+	esif_ccb_free(binLog->record);
+	binLog->record = NULL;
+	binLog->recordSize = 0;
+}
+
+// Queue a record to the ring buffer. Called by the polling thread only (single producer).
+static Bool EsifLogMgr_BinaryLogQueue(
+	EsifParticipantLogBinaryPtr binLog,
+	const UInt8 *record,
+	size_t recordSize
+	)
+{
+	UInt64 head = (UInt64)atomic64_read(&binLog->head);
+	UInt64 tail = (UInt64)atomic64_read(&binLog->tail);
+	size_t offset = 0;
+	size_t firstLen = 0;
+
+	if (recordSize > binLog->ringSize - (size_t)(head - tail)) {
+		atomic64_inc(&binLog->dropped);
+		return ESIF_FALSE;
+	}
+
+	offset = (size_t)(head % binLog->ringSize);
+	firstLen = esif_ccb_min(recordSize, binLog->ringSize - offset);
+	esif_ccb_memcpy(binLog->ring + offset, record, firstLen);
+	if (firstLen < recordSize) {
+		esif_ccb_memcpy(binLog->ring, record + firstLen, recordSize - firstLen);
+	}
+
+	// Publish the record to the writer
+	atomic64_set(&binLog->head, (atomic64_basetype)(head + recordSize));
+	return ESIF_TRUE;
+}
+
+// Write all queued records to disk. Called by the writer thread only (single consumer).
+static void EsifLogMgr_BinaryLogFlush(EsifParticipantLogBinaryPtr binLog)
+{
+	UInt64 head = (UInt64)atomic64_read(&binLog->head);
+	UInt64 tail = (UInt64)atomic64_read(&binLog->tail);
+
+	while (tail < head) {
+		size_t offset = (size_t)(tail % binLog->ringSize);
+		size_t chunkLen = esif_ccb_min((size_t)(head - tail), binLog->ringSize - offset);
+
+		esif_ccb_fwrite(binLog->ring + offset, sizeof(UInt8), chunkLen, binLog->fileHandle);
+		tail += chunkLen;
+
+		// Release the space back to the producer
+		atomic64_set(&binLog->tail, (atomic64_basetype)tail);
+	}
+	fflush(binLog->fileHandle);
+}
+
+static void *ESIF_CALLCONV EsifLogMgr_BinaryLogWriterThread(void *ptr)
+{
+	EsifParticipantLogBinaryPtr binLog = (EsifParticipantLogBinaryPtr)ptr;
+
+	ESIF_TRACE_ENTRY_INFO();
+
+	if (binLog == NULL) {
+		goto exit;
+	}
+
+	while (!atomic_read(&binLog->isWriterStopped)) {
+		if (EsifTimedEventWait(&binLog->writerStopEvent, PARTICIPANTLOG_BIN_FLUSH_INTERVAL) != ESIF_OK) {
+			ESIF_TRACE_ERROR("Error waiting on binary log event");
+			break;
+		}
+		EsifLogMgr_BinaryLogFlush(binLog);
+	}
+	EsifLogMgr_BinaryLogFlush(binLog);
+exit:
+	ESIF_TRACE_EXIT_INFO();
+	return 0;
+}
+
+// Make sure the record staging buffer can hold a record with the given number of columns
+static eEsifError EsifLogMgr_BinaryLogReserve(
+	EsifParticipantLogBinaryPtr binLog,
+	size_t recordSize
+	)
+{
+	eEsifError rc = ESIF_OK;
+
+	if (recordSize > binLog->recordSize) {
+		UInt8 *newRecord = (UInt8 *)esif_ccb_realloc(binLog->record, recordSize);
+		if (newRecord == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		binLog->record = newRecord;
+		binLog->recordSize = recordSize;
+	}
+exit:
+	return rc;
+}
+
+static void EsifLogMgr_BinaryLogInitHeader(
+	EsifParticipantLogRecordHdrPtr hdrPtr,
+	UInt16 recordType,
+	size_t recordSize,
+	UInt32 columns
+	)
+{
+	esif_ccb_time_t msec = 0;
+
+	esif_ccb_system_time(&msec);
+	hdrPtr->signature = PARTICIPANTLOG_BIN_SIGNATURE;
+	hdrPtr->version = PARTICIPANTLOG_BIN_VERSION;
+	hdrPtr->recordType = recordType;
+	hdrPtr->recordSize = (UInt32)recordSize;
+	hdrPtr->columns = columns;
+	hdrPtr->timestamp = (UInt64)time(NULL);
+	hdrPtr->msec = (UInt64)msec;
+}
+
+// Write the column schema for the current participant list. Caller must hold the list lock.
+static void EsifLogMgr_BinaryLogWriteSchema(
+	EsifLoggingManagerPtr self,
+	UInt32 columns
+	)
+{
+	EsifParticipantLogBinaryPtr binLog = &self->binaryLog;
+	EsifLinkListNodePtr nodePtr = NULL;
+	EsifParticipantLogSchemaColumnPtr columnPtr = NULL;
+	size_t recordSize = sizeof(EsifParticipantLogRecordHdr) + (columns * sizeof(EsifParticipantLogSchemaColumn));
+
+	if (EsifLogMgr_BinaryLogReserve(binLog, recordSize) != ESIF_OK) {
+		goto exit;
+	}
+	esif_ccb_memset(binLog->record, 0, recordSize);
+	EsifLogMgr_BinaryLogInitHeader((EsifParticipantLogRecordHdrPtr)binLog->record, PARTICIPANTLOG_BIN_RECORD_SCHEMA, recordSize, columns);
+
+	columnPtr = (EsifParticipantLogSchemaColumnPtr)(binLog->record + sizeof(EsifParticipantLogRecordHdr));
+	for (nodePtr = self->participantLogData.list->head_ptr; nodePtr != NULL && columns > 0; nodePtr = nodePtr->next_ptr, columnPtr++, columns--) {
+		EsifParticipantLogDataNodePtr curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
+		EsifUpPtr upPtr = NULL;
+
+		if (curEntryPtr == NULL) {
+			continue;
+		}
+		columnPtr->participantId = esif_ccb_handle2llu(curEntryPtr->participantId);
+		columnPtr->domainId = curEntryPtr->domainId;
+		columnPtr->capabilityType = curEntryPtr->capabilityData.type;
+		esif_ccb_strcpy(columnPtr->name, "UNK", sizeof(columnPtr->name));
+		upPtr = EsifUpPm_GetAvailableParticipantByInstance(curEntryPtr->participantId);
+		if (upPtr != NULL) {
+			esif_ccb_strcpy(columnPtr->name, EsifUp_GetName(upPtr), sizeof(columnPtr->name));
+			EsifUp_PutRef(upPtr);
+		}
+	}
+
+	if (EsifLogMgr_BinaryLogQueue(binLog, binLog->record, recordSize)) {
+		binLog->schemaColumns = ((EsifParticipantLogRecordHdrPtr)binLog->record)->columns;
+	}
+exit:
+	return;
+}
+
+// Write one sample record; status capability data is refreshed unless the text logger already did so
+static void EsifLogMgr_BinaryLogWriteSample(
+	EsifLoggingManagerPtr self,
+	Bool refreshStatus
+	)
+{
+	EsifParticipantLogBinaryPtr binLog = &self->binaryLog;
+	EsifLinkListNodePtr nodePtr = NULL;
+	EsifParticipantLogSampleColumnPtr columnPtr = NULL;
+	esif_handle_t currentParticipantId = ESIF_INVALID_HANDLE;
+	Bool isAvailable = ESIF_FALSE;
+	UInt32 columns = 0;
+	size_t recordSize = 0;
+
+	ESIF_ASSERT(self != NULL);
+
+	if (!atomic_read(&binLog->isOpen) || (self->participantLogData.list == NULL)) {
+		goto exit;
+	}
+
+	esif_ccb_read_lock(&self->participantLogData.listLock);
+	columns = esif_link_list_get_node_count(self->participantLogData.list);
+
+	// Emit a new schema whenever the participant list changes
+	if (columns != binLog->schemaColumns) {
+		EsifLogMgr_BinaryLogWriteSchema(self, columns);
+	}
+
+	recordSize = sizeof(EsifParticipantLogRecordHdr) + (columns * sizeof(EsifParticipantLogSampleColumn));
+	if ((columns == 0) || (columns != binLog->schemaColumns) || (EsifLogMgr_BinaryLogReserve(binLog, recordSize) != ESIF_OK)) {
+		esif_ccb_read_unlock(&self->participantLogData.listLock);
+		goto exit;
+	}
+	EsifLogMgr_BinaryLogInitHeader((EsifParticipantLogRecordHdrPtr)binLog->record, PARTICIPANTLOG_BIN_RECORD_SAMPLE, recordSize, columns);
+
+	columnPtr = (EsifParticipantLogSampleColumnPtr)(binLog->record + sizeof(EsifParticipantLogRecordHdr));
+	for (nodePtr = self->participantLogData.list->head_ptr; nodePtr != NULL && columns > 0; nodePtr = nodePtr->next_ptr, columnPtr++, columns--) {
+		EsifParticipantLogDataNodePtr curEntryPtr = (EsifParticipantLogDataNodePtr)nodePtr->data_ptr;
+
+		columnPtr->flags = 0;
+		if (curEntryPtr == NULL) {
+			esif_ccb_memset(&columnPtr->capabilityData, 0, sizeof(columnPtr->capabilityData));
+			continue;
+		}
+
+		// Participant availability only needs to be checked once per participant
+		if (currentParticipantId != curEntryPtr->participantId) {
+			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByInstance(curEntryPtr->participantId);
+			isAvailable = (upPtr != NULL);
+			if ((upPtr != NULL) && !curEntryPtr->isAcknowledged && refreshStatus) {
+				/* Covers a race condition where the app may not know about participant at the time we tell it to enable logging */
+				EsifLogMgr_SendParticipantLogEvent(ESIF_EVENT_DPTF_PARTICIPANT_ACTIVITY_LOGGING_ENABLED,
+					curEntryPtr->participantId,
+					(UInt16)curEntryPtr->domainId,
+					(1 << curEntryPtr->capabilityData.type)
+				);
+			}
+			EsifUp_PutRef(upPtr);
+			currentParticipantId = curEntryPtr->participantId;
+		}
+
+		if (refreshStatus && EsifLogMgr_IsStatusCapable(curEntryPtr->capabilityData.type)) {
+			esif_ccb_write_lock(&curEntryPtr->capabilityDataLock);
+			EsifLogMgr_UpdateStatusCapabilityData(curEntryPtr);
+			esif_ccb_write_unlock(&curEntryPtr->capabilityDataLock);
+		}
+
+		esif_ccb_read_lock(&curEntryPtr->capabilityDataLock);
+		esif_ccb_memcpy(&columnPtr->capabilityData, &curEntryPtr->capabilityData, sizeof(columnPtr->capabilityData));
+		esif_ccb_read_unlock(&curEntryPtr->capabilityDataLock);
+
+		columnPtr->flags |= (curEntryPtr->state >= ESIF_DATA_INITIALIZED ? PARTICIPANTLOG_COLUMN_INITIALIZED : 0);
+		columnPtr->flags |= (curEntryPtr->isPresent != ESIF_FALSE ? PARTICIPANTLOG_COLUMN_PRESENT : 0);
+		columnPtr->flags |= (isAvailable ? PARTICIPANTLOG_COLUMN_AVAILABLE : 0);
+	}
+	esif_ccb_read_unlock(&self->participantLogData.listLock);
+
+	EsifLogMgr_BinaryLogQueue(binLog, binLog->record, recordSize);
+exit:
+	return;
+}
+
+static eEsifError EsifLogMgr_ParseCmdConvert(
+	EsifLoggingManagerPtr self,
+	EsifShellCmdPtr shell
+	)
+{
+	eEsifError rc = ESIF_OK;
+	int argc = 0;
+	char **argv = NULL;
+	char *output = NULL;
+	char binaryPath[MAX_PATH] = { 0 };
+	char csvPath[MAX_PATH] = { 0 };
+	char csvName[MAX_PATH] = { 0 };
+	UInt32 rows = 0;
+
+	ESIF_ASSERT(self != NULL);
+	ESIF_ASSERT(shell != NULL);
+	ESIF_ASSERT(shell->outbuf != NULL);
+
+	UNREFERENCED_PARAMETER(self);
+	argc = shell->argc;
+	argv = shell->argv;
+	output = shell->outbuf;
+
+	if (argc <= PARTICITPANTLOG_SUB_CMD_INDEX) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error:Invalid usage. See help for command usage.\n");
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	// Default CSV file name is the binary file name with a .csv extension
+	if (argc > PARTICITPANTLOG_SUB_CMD_INDEX + 1) {
+		esif_ccb_strcpy(csvName, argv[PARTICITPANTLOG_SUB_CMD_INDEX + 1], sizeof(csvName));
+	}
+	else {
+		char *fileExtn = NULL;
+		esif_ccb_strcpy(csvName, argv[PARTICITPANTLOG_SUB_CMD_INDEX], sizeof(csvName));
+		fileExtn = esif_ccb_strrchr(csvName, '.');
+		if (fileExtn != NULL) {
+			*fileExtn = 0;
+		}
+		esif_ccb_strcat(csvName, ".csv", sizeof(csvName));
+	}
+	EsifLogFile_GetFullPath(binaryPath, sizeof(binaryPath), argv[PARTICITPANTLOG_SUB_CMD_INDEX]);
+	EsifLogFile_GetFullPath(csvPath, sizeof(csvPath), csvName);
+
+	if (esif_ccb_stricmp(binaryPath, csvPath) == 0) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+	}
+	else {
+		rc = EsifLogMgr_BinaryLogConvert(binaryPath, csvPath, &rows);
+	}
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Error converting %s: %s(%d)\n", binaryPath, esif_rc_str(rc), rc);
+		goto exit;
+	}
+	esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "Converted %u rows to %s\n", rows, csvPath);
+exit:
+	return rc;
+}
+
 static void EsifLogMgr_DataLogWrite(
 	EsifLoggingManagerPtr self,
 	char *logstring,
@@ -3266,6 +3269,10 @@ static void EsifLogMgr_PrintListenerStatus(
 			esif_ccb_strcat(output, ESIF_LISTENER_LOGFILE_STR, datalength);
 			esif_ccb_strcat(output, " ", datalength);
 		}
+		if ((self->listenersMask & ESIF_LISTENER_BINARY_MASK) == ESIF_LISTENER_BINARY_MASK) {
+			esif_ccb_strcat(output, ESIF_LISTENER_BINARY_STR, datalength);
+			esif_ccb_strcat(output, " ", datalength);
+		}
 		esif_ccb_strcat(output, "\n", datalength);
 
 		if ((self->listenersMask & ESIF_LISTENER_LOGFILE_MASK) == ESIF_LISTENER_LOGFILE_MASK) {
@@ -3304,5 +3311,19 @@ static void EsifLogMgr_PrintListenerStatus(
 			}
 			esif_ccb_strcat(output, "\n", datalength);
 		}
+
+		if ((self->listenersMask & ESIF_LISTENER_BINARY_MASK) == ESIF_LISTENER_BINARY_MASK) {
+			if (atomic_read(&self->binaryLog.isOpen) || !self->isDefaultBinaryFile) {
+				EsifLogFile_GetFullPath(filepath, sizeof(filepath), self->binaryFilename);
+			}
+			else {
+				esif_ccb_strcpy(filepath, "NA", sizeof(filepath));
+			}
+			esif_ccb_sprintf_concat(datalength, output, "Binary File   : %s\n", filepath);
+
+			if (atomic_read(&self->binaryLog.isOpen)) {
+				esif_ccb_sprintf_concat(datalength, output, "Binary Dropped: %lld\n", (long long)atomic64_read(&self->binaryLog.dropped));
+			}
+		}
 	}
 }
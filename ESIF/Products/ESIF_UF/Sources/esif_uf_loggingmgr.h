@@ -42,6 +42,7 @@
 #define PARTICIPANTLOG_CMD_ROUTE_STR        "route"
 #define PARTICIPANTLOG_CMD_INTERVAL_STR     "interval"
 #define PARTICIPANTLOG_CMD_SCHEDULE_STR     "schedule"
+#define PARTICIPANTLOG_CMD_CONVERT_STR      "convert"
 
 #define MAX_DOMAIN_ID_LENGTH      2
 #define ESIF_DOMAIN_IDENT_CHAR_D  'D'
@@ -51,6 +52,7 @@
 #define ESIF_HEX_IDENT_CHAR_x     'x'
 #define BASE_HEX				  16
 #define TIME_BASE_YEAR            1900
+#define ESIF_INVALID_DATA         0xFFFFFFFF
 
 typedef struct EsifParticipantLogData_s {
 	EsifLinkListPtr list;		/*List to maintain the complete list of Capability that we are tracking for logging and OS Notification*/
@@ -74,6 +76,66 @@ typedef struct EsifParticipantLogScheduler_s{
 	UInt32 delay;                           /* delay in ms*/
 } EsifParticipantLogScheduler, *EsifParticipantLogSchedulerPtr;
 
+/*
+ * Binary Participant Log
+ * Each sample is a fixed-layout record with one column per logged participant/domain/capability,
+ * in the order given by the most recent schema record. Records are queued to a single-producer,
+ * single-consumer ring buffer by the polling thread and written to disk by a background writer.
+ * Use "participantlog convert" or the standalone esif_logconvert tool to produce the equivalent CSV log.
+ */
+#define PARTICIPANTLOG_BIN_SIGNATURE       0x474C5045  /* "EPLG" */
+#define PARTICIPANTLOG_BIN_VERSION         1
+#define PARTICIPANTLOG_BIN_RECORD_SCHEMA   1           /* Column definitions for all following samples */
+#define PARTICIPANTLOG_BIN_RECORD_SAMPLE   2           /* One row of capability data */
+#define PARTICIPANTLOG_BIN_RING_SIZE       (1024 * 1024) /* Ring buffer size in bytes */
+#define PARTICIPANTLOG_BIN_FLUSH_INTERVAL  1000        /* in ms*/
+
+#define PARTICIPANTLOG_COLUMN_INITIALIZED  0x00000001  /* Capability data initialized */
+#define PARTICIPANTLOG_COLUMN_PRESENT      0x00000002  /* Capability present */
+#define PARTICIPANTLOG_COLUMN_AVAILABLE    0x00000004  /* Participant available when sampled */
+
+#pragma pack(push, 1)
+
+typedef struct EsifParticipantLogRecordHdr_s {
+	UInt32 signature;       /* PARTICIPANTLOG_BIN_SIGNATURE */
+	UInt16 version;         /* PARTICIPANTLOG_BIN_VERSION */
+	UInt16 recordType;      /* PARTICIPANTLOG_BIN_RECORD_xxx */
+	UInt32 recordSize;      /* Record size including this header */
+	UInt32 columns;         /* Number of columns that follow */
+	UInt64 timestamp;       /* Local time (seconds since epoch) */
+	UInt64 msec;            /* Server msec */
+} EsifParticipantLogRecordHdr, *EsifParticipantLogRecordHdrPtr;
+
+typedef struct EsifParticipantLogSchemaColumn_s {
+	UInt64 participantId;
+	UInt32 domainId;
+	UInt32 capabilityType;
+	char name[ESIF_NAME_LEN];
+} EsifParticipantLogSchemaColumn, *EsifParticipantLogSchemaColumnPtr;
+
+typedef struct EsifParticipantLogSampleColumn_s {
+	UInt32 flags;           /* PARTICIPANTLOG_COLUMN_xxx */
+	EsifCapabilityData capabilityData;
+} EsifParticipantLogSampleColumn, *EsifParticipantLogSampleColumnPtr;
+
+#pragma pack(pop)
+
+typedef struct EsifParticipantLogBinary_s {
+	atomic_t isOpen;             /* Ring buffer and file are ready for records */
+	FILE *fileHandle;
+	UInt8 *ring;                 /* Ring buffer */
+	size_t ringSize;
+	atomic64_t head;             /* Total bytes queued by the polling thread */
+	atomic64_t tail;             /* Total bytes written by the writer thread */
+	atomic64_t dropped;          /* Records dropped because the ring buffer was full */
+	esif_thread_t writerThread;
+	esif_ccb_event_t writerStopEvent;
+	atomic_t isWriterStopped;
+	UInt8 *record;               /* Record staging buffer (polling thread only) */
+	size_t recordSize;
+	UInt32 schemaColumns;        /* Columns in the most recent schema record */
+} EsifParticipantLogBinary, *EsifParticipantLogBinaryPtr;
+
 typedef struct EsifLoggingManager_s {
 	Bool isInitialized;
 	EsifParticipantLogData participantLogData; /*Pointer to the Data structure which maintains the list of participant Data*/
@@ -85,6 +147,9 @@ typedef struct EsifLoggingManager_s {
 	Bool isLogSuspended;
 	Bool isDefaultFile;
 	char filename[MAX_PATH];
+	Bool isDefaultBinaryFile;
+	char binaryFilename[MAX_PATH];
+	EsifParticipantLogBinary binaryLog;
 	UInt32 listenersMask;
 	UInt32 listenerHeadersWrittenMask;
 	char **argv;
@@ -100,6 +165,7 @@ typedef struct EsifLoggingManager_s {
 #define ESIF_LISTENER_DEBUGGER_MASK  0x00000002
 #define ESIF_LISTENER_LOGFILE_MASK   0x00000004
 #define ESIF_LISTENER_CONSOLE_MASK   0x00000008
+#define ESIF_LISTENER_BINARY_MASK    0x00000010	/* Binary log file; not included in "all" */
 #define ESIF_LISTENER_ALL_MASK       (ESIF_LISTENER_EVENTLOG_MASK | \
 									  ESIF_LISTENER_DEBUGGER_MASK | \
 									  ESIF_LISTENER_LOGFILE_MASK  | \
@@ -109,6 +175,7 @@ typedef struct EsifLoggingManager_s {
 #define ESIF_LISTENER_DEBUGGER_STR   "debugger"
 #define ESIF_LISTENER_LOGFILE_STR    "file"
 #define ESIF_LISTENER_CONSOLE_STR    "console"
+#define ESIF_LISTENER_BINARY_STR     "binary"
 #define ESIF_LISTENER_ALL_STR        "all"
 
 typedef UInt32 esif_listenermask_t;
@@ -142,6 +209,25 @@ eEsifError EsifUf_GetNextCapability(
 	UInt32 startIndex,
 	UInt32 *capabilityId
 	);
+
+/* CSV formatting and binary log conversion (esif_uf_logconvert.c) */
+eEsifError EsifLogMgr_ParticipantLogAddHeaderData(
+	char *logString,
+	size_t dataLength,
+	EsifCapabilityDataPtr capabilityPtr,
+	EsifString participantName,
+	UInt8 domainId
+	);
+eEsifError EsifLogMgr_ParticipantLogAddCapabilityData(
+	char *logString,
+	size_t dataLength,
+	EsifParticipantLogDataNodePtr dataNodePtr
+	);
+eEsifError EsifLogMgr_BinaryLogConvert(
+	const char *binaryPath,
+	const char *csvPath,
+	UInt32 *rowsPtr
+	);
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,7 @@
 #include "esif_uf_xform.h"
 #include "esif_sdk_iface_upe.h"
 #include "esif_uf_handlemgr.h"
+#include "esif_uf_primstats.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -124,6 +125,15 @@ static eEsifError EsifUp_ExecuteAction(
 	const EsifDataPtr requestPtr,
 	EsifDataPtr responsePtr
 	);
+static eEsifError EsifUp_ExecuteTimedAction(
+	EsifUpPtr self,
+	const EsifPrimitiveTuplePtr tuplePtr,
+	const EsifFpcPrimitivePtr primitivePtr,
+	const EsifFpcActionPtr fpcActionPtr,
+	UInt16 kernelActNum,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	);
 static eEsifError EsifUp_ExecuteIfaceSet(
 	EsifUpPtr self,
 	EsifActPtr actionPtr,
@@ -134,6 +144,14 @@ static eEsifError EsifUp_ExecuteIfaceSet(
 static EsifString EsifUp_SelectDsp(
 	EsifUpPtr self
 	);
+static eEsifError EsifUp_ExecuteSelectedActions(
+	EsifUpPtr self,
+	EsifPrimitiveTuplePtr tuplePtr,
+	const EsifPrimitiveActionSelectorPtr selectorPtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr,
+	EsifUpResolvedPrimitivePtr resolvedPtr
+	);
 
 /*
  * Friend functions
@@ -893,6 +911,9 @@ void EsifUp_DestroyParticipant(
 		ESIF_TRACE_INFO("Destroy participant %d : wait for delete event...\n", EsifUp_GetInstance(self));
 		esif_ccb_event_wait(&self->deleteEvent);
 
+		/* No primitive of the participant can be executing once all references are released */
+		EsifPrimStats_ReleaseParticipant(EsifUp_GetInstance(self));
+
 		/*
 		* Destroy arbitration context contained within the participant.
 		*/
@@ -1154,9 +1175,24 @@ eEsifError EsifUp_ExecuteSpecificActionPrimitive(
 	const EsifDataPtr requestPtr,
 	EsifDataPtr responsePtr
 	)
+{
+	return EsifUp_ExecuteSelectedActions(self, tuplePtr, selectorPtr, requestPtr, responsePtr, NULL);
+}
+
+
+/* Executes the selected actions; if resolvedPtr is not NULL, the action that succeeds is saved in it */
+static eEsifError EsifUp_ExecuteSelectedActions(
+	EsifUpPtr self,
+	EsifPrimitiveTuplePtr tuplePtr,
+	const EsifPrimitiveActionSelectorPtr selectorPtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr,
+	EsifUpResolvedPrimitivePtr resolvedPtr
+	)
 {
 	eEsifError rc = ESIF_OK;
 	eEsifError supActRc = ESIF_E_UNSUPPORTED_ACTION_TYPE;
+	UInt32 dspGeneration = EsifDspMgr_GetGeneration();
 	EsifDspPtr dspPtr = NULL;
 	EsifFpcPrimitivePtr primitivePtr = NULL;
 	EsifFpcActionPtr fpcActionPtr = NULL;
@@ -1169,6 +1205,12 @@ eEsifError EsifUp_ExecuteSpecificActionPrimitive(
 	Bool excludeAction = ESIF_FALSE;
 	Bool typeValid = ESIF_FALSE;
 	Bool indexValid = ESIF_FALSE;
+	Bool isTimed = EsifPrimStats_IsEnabled();
+	esif_ccb_realtime_t startTime = esif_ccb_realtime_null();
+
+	if (isTimed) {
+		startTime = esif_ccb_realtime_current();
+	}
 
 	if (NULL == self) {
 		ESIF_TRACE_ERROR("Participant pointer is NULL\n");
@@ -1321,7 +1363,7 @@ eEsifError EsifUp_ExecuteSpecificActionPrimitive(
 
 		if (tryAll || (isTargetAction && !excludeAction) || (!isTargetAction && excludeAction)) {
 
-			rc = EsifUp_ExecuteAction(self, primitivePtr, fpcActionPtr, kernAct, requestPtr, responsePtr);
+			rc = EsifUp_ExecuteTimedAction(self, tuplePtr, primitivePtr, fpcActionPtr, kernAct, requestPtr, responsePtr);
 			if (ESIF_OK == rc) {
 				break;
 			}
@@ -1351,7 +1393,7 @@ eEsifError EsifUp_ExecuteSpecificActionPrimitive(
 					rc = ESIF_E_NO_MEMORY;
 					goto exit;
 				}
-				rc = EsifUp_ExecuteAction(self, primitivePtr, fpcActionPtr, kernAct, requestPtr, responsePtr);
+				rc = EsifUp_ExecuteTimedAction(self, tuplePtr, primitivePtr, fpcActionPtr, kernAct, requestPtr, responsePtr);
 				if (ESIF_OK == rc) {
 					break;
 				}
@@ -1373,7 +1415,23 @@ eEsifError EsifUp_ExecuteSpecificActionPrimitive(
 		}
 	}
 
+	if ((ESIF_OK == rc) && (resolvedPtr != NULL)) {
+		resolvedPtr->dspPtr = dspPtr;
+		resolvedPtr->dspGeneration = dspGeneration;
+		resolvedPtr->primitivePtr = primitivePtr;
+		resolvedPtr->fpcActionPtr = fpcActionPtr;
+		resolvedPtr->kernelActNum = kernAct;
+	}
+
 exit:
+	if (isTimed && (self != NULL) && (tuplePtr != NULL)) {
+		EsifPrimStats_Record(
+			EsifUp_GetInstance(self),
+			tuplePtr->id,
+			ESIF_PRIMSTATS_ALL_ACTIONS,
+			rc,
+			esif_ccb_realtime_diff_usec(startTime, esif_ccb_realtime_current()));
+	}
 	ESIF_TRACE_DEBUG("Primitive result = %s\n", esif_rc_str(rc));
 	return rc;
 }
@@ -1399,6 +1457,104 @@ eEsifError EsifUp_ExecutePrimitive(
 }
 
 
+eEsifError EsifUp_ExecuteResolvedPrimitive(
+	EsifUpPtr self,
+	EsifUpResolvedPrimitivePtr resolvedPtr,
+	EsifPrimitiveTuplePtr tuplePtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifPrimitiveActionSelector actionSelector = {0};
+	Bool isTimed = EsifPrimStats_IsEnabled();
+	esif_ccb_realtime_t startTime = esif_ccb_realtime_null();
+
+	if ((NULL == self) || (NULL == resolvedPtr) || (NULL == tuplePtr) || (NULL == responsePtr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	/*
+	 * The saved action is only used for fixed-size responses; anything the
+	 * full path would retype or allocate goes through it every time.
+	 */
+#ifndef ESIF_FEAT_OPT_SIM_SUPPORT_ENABLED
+	if ((resolvedPtr->primitivePtr != NULL) &&
+		(resolvedPtr->dspPtr == EsifUp_GetDsp(self)) &&
+		(resolvedPtr->dspGeneration == EsifDspMgr_GetGeneration()) &&
+		(responsePtr->buf_ptr != NULL) &&
+		(responsePtr->type != ESIF_DATA_AUTO) &&
+		(responsePtr->type != ESIF_DATA_UINT8) &&
+		(responsePtr->type != ESIF_DATA_UINT16) &&
+		(responsePtr->type != ESIF_DATA_UNICODE) &&
+		((NULL == requestPtr) || (requestPtr->type != ESIF_DATA_AUTO))) {
+
+		if (isTimed) {
+			startTime = esif_ccb_realtime_current();
+		}
+		rc = EsifUp_ExecuteTimedAction(self,
+			tuplePtr,
+			resolvedPtr->primitivePtr,
+			resolvedPtr->fpcActionPtr,
+			resolvedPtr->kernelActNum,
+			requestPtr,
+			responsePtr);
+		if (isTimed) {
+			EsifPrimStats_Record(
+				EsifUp_GetInstance(self),
+				tuplePtr->id,
+				ESIF_PRIMSTATS_ALL_ACTIONS,
+				rc,
+				esif_ccb_realtime_diff_usec(startTime, esif_ccb_realtime_current()));
+		}
+		if (ESIF_OK == rc) {
+			goto exit;
+		}
+	}
+#endif
+
+	/* Resolve (again) through the full primitive path */
+	esif_ccb_memset(resolvedPtr, 0, sizeof(*resolvedPtr));
+	rc = EsifUp_ExecuteSelectedActions(self, tuplePtr, &actionSelector, requestPtr, responsePtr, resolvedPtr);
+exit:
+	return rc;
+}
+
+
+/* Executes the action, recording its latency in the primitive execution statistics */
+static eEsifError EsifUp_ExecuteTimedAction(
+	EsifUpPtr self,
+	const EsifPrimitiveTuplePtr tuplePtr,
+	const EsifFpcPrimitivePtr primitivePtr,
+	const EsifFpcActionPtr fpcActionPtr,
+	UInt16 kernelActNum,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	Bool isTimed = EsifPrimStats_IsEnabled();
+	esif_ccb_realtime_t startTime = esif_ccb_realtime_null();
+
+	if (isTimed) {
+		startTime = esif_ccb_realtime_current();
+	}
+
+	rc = EsifUp_ExecuteAction(self, primitivePtr, fpcActionPtr, kernelActNum, requestPtr, responsePtr);
+
+	if (isTimed) {
+		EsifPrimStats_Record(
+			EsifUp_GetInstance(self),
+			tuplePtr->id,
+			fpcActionPtr->type,
+			rc,
+			esif_ccb_realtime_diff_usec(startTime, esif_ccb_realtime_current()));
+	}
+	return rc;
+}
+
+
 static eEsifError EsifUp_ExecuteAction(
 	EsifUpPtr self,
 	const EsifFpcPrimitivePtr primitivePtr,
@@ -30,6 +30,7 @@
 #include "esif_uf_handlemgr.h"
 #include "esif_command.h"
 #include "esif_ccb_string.h"
+#include "esif_hash_table.h"
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -129,22 +130,47 @@ Bool EsifUp_IsPreferredParticipant(
 );
 
 
-static EsifUpPtr EsifUpPm_GetAvailableParticipantByIndex(
-	const UInt8 index
-);
-
 static EsifUpPtr EsifUpPm_GetAvailableParticipantByInstanceLocked(
 	const esif_handle_t upInstance
 );
 
 static EsifUpPtr EsifUpPm_GetAvailableParticipantByIndexLocked(
-	const UInt8 index
+	const UInt32 index
 );
 
 static EsifUpManagerEntryPtr EsifUpPm_GetEntryByInstanceLocked(
 	const esif_handle_t upInstance
 );
 
+static EsifUpManagerEntryPtr EsifUpPm_GetEntryByNameLocked(
+	const char *participantName,
+	Bool isCaseSensitive
+);
+
+static EsifUpManagerEntryPtr EsifUpPm_GetFreeEntryLocked(
+	Bool isPrimaryParticipant
+);
+
+static eEsifError EsifUpPm_GrowTableLocked(void);
+
+static void EsifUpPm_SetEntryStateLocked(
+	EsifUpManagerEntryPtr entryPtr,
+	enum esif_pm_participant_state state
+);
+
+static void EsifUpPm_IndexEntryLocked(
+	EsifUpManagerEntryPtr entryPtr
+);
+
+static void EsifUpPm_UnindexEntryLocked(
+	EsifUpManagerEntryPtr entryPtr
+);
+
+static esif_handle_t *EsifUpPm_GetDynamicInstances(
+	Bool conjuredUfOnly,
+	UInt32 *countPtr
+);
+
 /*
  * ===========================================================================
  * PRIVATE
@@ -175,8 +201,10 @@ static void EsifUpPm_ResumeDynamicUfParticipants();
 
 static void *ESIF_CALLCONV EsifUfPollWorkerThread(void *ptr)
 {
-	UInt8 i = 0;
-	
+	UfPmIterator upIter = { 0 };
+	EsifUpPtr upPtr = NULL;
+	eEsifError iterRc = ESIF_OK;
+
 	UNREFERENCED_PARAMETER(ptr);
 
 	atomic_set(&g_ufpollQuit, 0);
@@ -185,16 +213,15 @@ static void *ESIF_CALLCONV EsifUfPollWorkerThread(void *ptr)
 
 	/* check temperature */
 	while (!atomic_read(&g_ufpollQuit)) {
-		
-		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByIndex(i);
-			
-			if (NULL == upPtr) {
-				continue;
-			}
-			
+
+		/* Only participants in the available list are visited */
+		iterRc = EsifUpPm_InitIterator(&upIter);
+		if (ESIF_OK == iterRc) {
+			iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
+		}
+		while (ESIF_OK == iterRc) {
 			EsifUp_PollParticipant(upPtr);
-			EsifUp_PutRef(upPtr);
+			iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
 		}
 		esif_ccb_sleep_msec(g_ufpollPeriod);
 	}
@@ -285,7 +312,6 @@ eEsifError EsifUpPm_RegisterParticipant(
 	EsifUpPtr newUpPtr = NULL;
 	EsifUpPtr tempUpPtr = NULL;
 	EsifUpManagerEntryPtr entryPtr = NULL;
-	UInt8 i = 0;
 	Bool isUppMgrLocked = ESIF_FALSE;
 	Bool isPreferredParticipant = ESIF_FALSE;
 	esif_handle_t newUpInstance = ESIF_INVALID_HANDLE;
@@ -336,8 +362,8 @@ eEsifError EsifUpPm_RegisterParticipant(
 				goto exit;
 			}
 
-			entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-			g_uppMgr.fEntryCount++;
+			EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_CREATED);
+			EsifUpPm_IndexEntryLocked(entryPtr);
 
 			esif_ccb_write_unlock(&g_uppMgr.fLock);
 			isUppMgrLocked = ESIF_FALSE;
@@ -359,12 +385,10 @@ eEsifError EsifUpPm_RegisterParticipant(
 
 			EsifUp_SuspendParticipant(tempUpPtr);
 
-			if (entryPtr->fState != ESIF_PM_PARTICIPANT_STATE_CREATED) {
-				entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-				g_uppMgr.fEntryCount++;
-			}
+			EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_CREATED);
 
 			entryPtr->fUpPtr = newUpPtr;
+			EsifUpPm_IndexEntryLocked(entryPtr);
 
 			esif_ccb_write_unlock(&g_uppMgr.fLock);
 			isUppMgrLocked = ESIF_FALSE;
@@ -386,20 +410,14 @@ eEsifError EsifUpPm_RegisterParticipant(
 		}
 
 		/*
-		 *  Find available slot in participant manager table.  Simple Table Lookup For Now.
-		 *  Scan table and find first empty slot.  Empty slot indicated by AVAILABLE state.
+		 *  Find an empty slot in the participant manager table, growing the table if it is full.
+		 *  Empty slot indicated by AVAILABLE state.
 		 */
-		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-			if (ESIF_PM_PARTICIPANT_STATE_AVAILABLE == g_uppMgr.fEntries[i].fState) {
-				if ((i != ESIF_PARTICIPANT0_INDEX) || (EsifUp_IsPrimaryParticipant(upPtr))) {
-					break;
-				}
-			}
-		}
+		entryPtr = EsifUpPm_GetFreeEntryLocked(EsifUp_IsPrimaryParticipant(upPtr));
 
 		/* If no available slots return */
-		if (i >= MAX_PARTICIPANT_ENTRY) {
-			ESIF_TRACE_ERROR("Unable to add participant, the maximum number of participants has been reached.\n");
+		if (NULL == entryPtr) {
+			ESIF_TRACE_ERROR("Unable to add participant, the participant table could not be grown.\n");
 			EsifUp_DestroyParticipant(upPtr);
 			/* clear upPtr since we don't need to call EsifUp_PutRef in the end */
 			upPtr = NULL;
@@ -432,9 +450,9 @@ eEsifError EsifUpPm_RegisterParticipant(
 			goto exit;
 		}
 
-		g_uppMgr.fEntries[i].fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-		g_uppMgr.fEntries[i].fUpPtr = upPtr;
-		g_uppMgr.fEntryCount++;
+		entryPtr->fUpPtr = upPtr;
+		EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_CREATED);
+		EsifUpPm_IndexEntryLocked(entryPtr);
 
 		esif_ccb_write_unlock(&g_uppMgr.fLock);
 		isUppMgrLocked = ESIF_FALSE;
@@ -564,8 +582,9 @@ static eEsifError EsifUpPm_ActionChangeHandler(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	UInt8 i = 0;
+	UfPmIterator upIter = { 0 };
 	EsifUpPtr upPtr = NULL;
+	eEsifError iterRc = ESIF_OK;
 	UInt32 actionType = 0;
 
 	if ((NULL == eventDataPtr) ||
@@ -582,18 +601,15 @@ static eEsifError EsifUpPm_ActionChangeHandler(
 
 	actionType = *((UInt32 *)eventDataPtr->buf_ptr);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-
-		upPtr = EsifUpPm_GetAvailableParticipantByIndex(i);
-		if (NULL == upPtr) {
-			continue;
-		}
-
+	iterRc = EsifUpPm_InitIterator(&upIter);
+	if (ESIF_OK == iterRc) {
+		iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
+	}
+	while (ESIF_OK == iterRc) {
 		if(EsifUp_IsActionInDsp(upPtr, actionType)) {
 			EsifUp_ReevaluateParticipantCaps(upPtr);
 		}
-
-		EsifUp_PutRef(upPtr);
+		iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
 	}
 exit:
 	return rc;
@@ -603,22 +619,21 @@ exit:
 eEsifError EsifUFPollStart(int pollInterval)
 {
 	eEsifError rc = ESIF_OK;
-	UInt8 i = 0;
+	UfPmIterator upIter = { 0 };
+	EsifUpPtr upPtr = NULL;
+	eEsifError iterRc = ESIF_OK;
 
 	if (pollInterval >= ESIF_UFPOLL_PERIOD_MIN) {
 		g_ufpollPeriod = pollInterval;
 	}
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByIndex(i);
-		
-		if (NULL == upPtr) {
-			continue;
-		}
-		
+	iterRc = EsifUpPm_InitIterator(&upIter);
+	if (ESIF_OK == iterRc) {
+		iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
+	}
+	while (ESIF_OK == iterRc) {
 		EsifUp_RegisterParticipantForPolling(upPtr);
-
-		EsifUp_PutRef(upPtr);
+		iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
 	}
 
 	if (!EsifUFPollStarted()) {
@@ -630,20 +645,19 @@ eEsifError EsifUFPollStart(int pollInterval)
 void EsifUFPollStop()
 {
 	if (EsifUFPollStarted()) {
-		UInt8 i = 0;
-		
-		EsifUfPollExit(&g_ufpollThread);
+		UfPmIterator upIter = { 0 };
+		EsifUpPtr upPtr = NULL;
+		eEsifError iterRc = ESIF_OK;
 
-		for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-			EsifUpPtr upPtr = EsifUpPm_GetAvailableParticipantByIndex(i);
-			
-			if (NULL == upPtr) {
-				continue;
-			}
+		EsifUfPollExit(&g_ufpollThread);
 
+		iterRc = EsifUpPm_InitIterator(&upIter);
+		if (ESIF_OK == iterRc) {
+			iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
+		}
+		while (ESIF_OK == iterRc) {
 			EsifUp_UnRegisterParticipantForPolling(upPtr);
-
-			EsifUp_PutRef(upPtr);
+			iterRc = EsifUpPm_GetNextUp(&upIter, &upPtr);
 		}
 	}
 }
@@ -735,8 +749,8 @@ static eEsifError EsifUpPm_ResumeParticipant(
 
 	upPtr = entryPtr->fUpPtr;
 	if ((NULL != upPtr) && (entryPtr->fState < ESIF_PM_PARTICIPANT_STATE_CREATED)) {
-		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_CREATED;
-		g_uppMgr.fEntryCount++;
+		EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_CREATED);
+		EsifUpPm_IndexEntryLocked(entryPtr);
 
 		/*
 		* Get reference on participant before pass it to other function
@@ -769,23 +783,17 @@ exit:
 /* Resumes all upper participants instances (except primary) that exist */
 eEsifError EsifUpPm_ResumeParticipants()
 {
-	UInt8 i = 0;
-	EsifUpPtr upPtr = NULL;
-	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	UInt32 i = 0;
+	UInt32 count = 0;
+	esif_handle_t *participantIds = NULL;
 
 	ESIF_TRACE_INFO("Resuming all participants\n");
 
-	for (i = ESIF_PARTICIPANT0_INDEX + 1; i < MAX_PARTICIPANT_ENTRY; i++) {
-
-		esif_ccb_write_lock(&g_uppMgr.fLock);
-		upPtr = g_uppMgr.fEntries[i].fUpPtr;
-		participantId = EsifUp_GetInstance(upPtr);
-		esif_ccb_write_unlock(&g_uppMgr.fLock);
-
-		if (upPtr != NULL) {
-			EsifUpPm_ResumeParticipant(participantId);
-		}
+	participantIds = EsifUpPm_GetDynamicInstances(ESIF_FALSE, &count);
+	for (i = 0; i < count; i++) {
+		EsifUpPm_ResumeParticipant(participantIds[i]);
 	}
+	esif_ccb_free(participantIds);
 
 	ESIF_TRACE_INFO("Resumption of participants complete\n");
 	return ESIF_OK;
@@ -815,8 +823,7 @@ static eEsifError EsifUpPm_SuspendParticipant(
 
 		EsifUp_SuspendParticipant(upPtr);
 
-		entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_REMOVED;
-		g_uppMgr.fEntryCount--;
+		EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_REMOVED);
 
 		/*
 		* Get reference on participant before passing it to other functions
@@ -847,27 +854,18 @@ exit:
 
 static void EsifUpPm_SuspendDynamicUfParticipants()
 {
-	UInt8 i = 0;
-	EsifUpPtr upPtr = NULL;
-	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	UInt32 i = 0;
+	UInt32 count = 0;
+	esif_handle_t *participantIds = NULL;
 
 	ESIF_TRACE_INFO("Suspending all dynamic participants\n");
 
-	for (i = ESIF_PARTICIPANT0_INDEX + 1; i < MAX_PARTICIPANT_ENTRY; i++) {
-
-		esif_ccb_read_lock(&g_uppMgr.fLock);
-		upPtr = g_uppMgr.fEntries[i].fUpPtr;
-
-		if (upPtr && (eParticipantOriginUF == upPtr->fOrigin) && (ESIF_PARTICIPANT_ENUM_CONJURE == upPtr->fMetadata.fEnumerator)) {
-			participantId = EsifUp_GetInstance(upPtr);
-		}
-		esif_ccb_read_unlock(&g_uppMgr.fLock);
-
-		if (participantId != ESIF_INVALID_HANDLE) {
-			ESIF_TRACE_INFO("Suspending dynamic participant " ESIF_HANDLE_FMT "\n", participantId);
-			EsifEventMgr_SignalEvent(participantId, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_PARTICIPANT_SUSPEND, NULL);
-		}
+	participantIds = EsifUpPm_GetDynamicInstances(ESIF_TRUE, &count);
+	for (i = 0; i < count; i++) {
+		ESIF_TRACE_INFO("Suspending dynamic participant " ESIF_HANDLE_FMT "\n", participantIds[i]);
+		EsifEventMgr_SignalEvent(participantIds[i], EVENT_MGR_DOMAIN_D0, ESIF_EVENT_PARTICIPANT_SUSPEND, NULL);
 	}
+	esif_ccb_free(participantIds);
 
 	ESIF_TRACE_INFO("Suspension of all dynamic participants complete\n");
 	return;
@@ -876,27 +874,18 @@ static void EsifUpPm_SuspendDynamicUfParticipants()
 
 static void EsifUpPm_ResumeDynamicUfParticipants()
 {
-	UInt8 i = 0;
-	EsifUpPtr upPtr = NULL;
-	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	UInt32 i = 0;
+	UInt32 count = 0;
+	esif_handle_t *participantIds = NULL;
 
 	ESIF_TRACE_INFO("Resuming all dynamic participants\n");
 
-	for (i = ESIF_PARTICIPANT0_INDEX + 1; i < MAX_PARTICIPANT_ENTRY; i++) {
-
-		esif_ccb_read_lock(&g_uppMgr.fLock);
-		upPtr = g_uppMgr.fEntries[i].fUpPtr;
-
-		if (upPtr && (eParticipantOriginUF == upPtr->fOrigin) && (ESIF_PARTICIPANT_ENUM_CONJURE == upPtr->fMetadata.fEnumerator)) {
-			participantId = EsifUp_GetInstance(upPtr);
-		}
-		esif_ccb_read_unlock(&g_uppMgr.fLock);
-
-		if (participantId != ESIF_INVALID_HANDLE) {
-			ESIF_TRACE_INFO("Rsuming dynamic participant " ESIF_HANDLE_FMT "\n", participantId);
-			EsifEventMgr_SignalEvent(participantId, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_PARTICIPANT_RESUME, NULL);
-		}
+	participantIds = EsifUpPm_GetDynamicInstances(ESIF_TRUE, &count);
+	for (i = 0; i < count; i++) {
+		ESIF_TRACE_INFO("Rsuming dynamic participant " ESIF_HANDLE_FMT "\n", participantIds[i]);
+		EsifEventMgr_SignalEvent(participantIds[i], EVENT_MGR_DOMAIN_D0, ESIF_EVENT_PARTICIPANT_RESUME, NULL);
 	}
+	esif_ccb_free(participantIds);
 
 	ESIF_TRACE_INFO("Resumption of all dynamic participants complete\n");
 	return;
@@ -907,18 +896,18 @@ static void EsifUpPm_SuspendLfParticipants()
 {
 	EsifUpManagerEntryPtr entryPtr = NULL;
 	EsifUpPtr upPtr = NULL;
-	UInt8 i = 0;
+	UInt32 i = 0;
 
 	esif_ccb_write_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		entryPtr = &g_uppMgr.fEntries[i];
+	for (i = 0; i < g_uppMgr.fEntrySize; i++) {
+		entryPtr = g_uppMgr.fEntries[i];
 		upPtr = entryPtr->fUpPtr;
 		if (upPtr && (eParticipantOriginLF == upPtr->fOrigin)) {
 			EsifEventMgr_SignalEvent(EsifUp_GetInstance(upPtr), EVENT_MGR_DOMAIN_D0, ESIF_EVENT_PARTICIPANT_SUSPEND, NULL);
 		}
 		if (ESIF_PARTICIPANT0_INDEX == i) {
-			entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_LF_REMOVED;
+			EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_LF_REMOVED);
 		}
 	}
 
@@ -1001,31 +990,12 @@ EsifUpPtr EsifUpPm_GetAvailableParticipantByInstance(
 }
 
 
-/*
-* Get participant by index
-* NOTE:  The caller should call EsifUp_PutRef to release reference on participant when done with it
-*/
-static EsifUpPtr EsifUpPm_GetAvailableParticipantByIndex(
-	const UInt8 index
-	)
-{
-	EsifUpPtr upPtr = NULL;
-
-	esif_ccb_read_lock(&g_uppMgr.fLock);
-
-	upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(index);
-
-	esif_ccb_read_unlock(&g_uppMgr.fLock);
-	return upPtr;
-}
-
-
 /*
 * Get participant by index (locked version - lock already held)
 * NOTE:  The caller should call EsifUp_PutRef to release reference on participant when done with it
 */
 static EsifUpPtr EsifUpPm_GetAvailableParticipantByIndexLocked(
-	const UInt8 index
+	const UInt32 index
 	)
 {
 	EsifUpPtr upPtr = NULL;
@@ -1033,14 +1003,14 @@ static EsifUpPtr EsifUpPm_GetAvailableParticipantByIndexLocked(
 
 	ESIF_TRACE_DEBUG("Index %d\n", index);
 
-	if (index >= MAX_PARTICIPANT_ENTRY) {
+	if (index >= g_uppMgr.fEntrySize) {
 		ESIF_TRACE_ERROR("Instance id %d is out of range\n", index);
 		ESIF_ASSERT(ESIF_FALSE);
 		goto exit;
 	}
 
-	if (g_uppMgr.fEntries[index].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) {
-		upPtr = g_uppMgr.fEntries[index].fUpPtr;
+	if (g_uppMgr.fEntries[index]->fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) {
+		upPtr = g_uppMgr.fEntries[index]->fUpPtr;
 		if (upPtr != NULL) {
 			rc = EsifUp_GetRef(upPtr);
 			if (rc != ESIF_OK) {
@@ -1062,21 +1032,332 @@ static EsifUpManagerEntryPtr EsifUpPm_GetEntryByInstanceLocked(
 	)
 {
 	EsifUpManagerEntryPtr entryPtr = NULL;
-	size_t index = 0;
+	esif_handle_t key = upInstance;
 
-	for (index = 0; index < MAX_PARTICIPANT_ENTRY; index++) {
-		entryPtr = &g_uppMgr.fEntries[index];
-		if (entryPtr != NULL) {
-			if (upInstance == EsifUp_GetInstance(entryPtr->fUpPtr)) {
-				break;
+	if ((ESIF_INVALID_HANDLE == upInstance) || (NULL == g_uppMgr.fInstanceIndex)) {
+		goto exit;
+	}
+
+	entryPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fInstanceIndex, (u8 *)&key, sizeof(key));
+	if ((entryPtr != NULL) && (upInstance != EsifUp_GetInstance(entryPtr->fUpPtr))) {
+		entryPtr = NULL;
+	}
+exit:
+	return entryPtr;
+}
+
+
+/*
+* Get PM entry by participant name (locked version - lock already held)
+* Names are indexed case-insensitively; isCaseSensitive requests an exact match.
+*/
+static EsifUpManagerEntryPtr EsifUpPm_GetEntryByNameLocked(
+	const char *participantName,
+	Bool isCaseSensitive
+	)
+{
+	EsifUpManagerEntryPtr entryPtr = NULL;
+	char key[ESIF_NAME_LEN] = { 0 };
+	UInt32 index = 0;
+
+	if ((NULL == participantName) || (NULL == g_uppMgr.fNameIndex)) {
+		goto exit;
+	}
+
+	/*
+	 * Case-insensitive duplicates are left out of the index, so fall back to a
+	 * table scan for as long as any exist. Names too long to index are never found.
+	 */
+	if (g_uppMgr.fNameCollisions > 0) {
+		for (index = 0; index < g_uppMgr.fEntrySize; index++) {
+			entryPtr = g_uppMgr.fEntries[index];
+			if ((entryPtr->fUpPtr != NULL) &&
+				((isCaseSensitive ? esif_ccb_strcmp(EsifUp_GetName(entryPtr->fUpPtr), participantName) : esif_ccb_stricmp(EsifUp_GetName(entryPtr->fUpPtr), participantName)) == 0)) {
+				goto exit;
 			}
 		}
 		entryPtr = NULL;
+		goto exit;
+	}
+
+	if (esif_ccb_strlen(participantName, sizeof(key)) >= sizeof(key)) {
+		goto exit;
+	}
+	esif_ccb_strcpy(key, participantName, sizeof(key));
+	esif_ccb_strupr(key, sizeof(key));
+
+	entryPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fNameIndex, (u8 *)key, (u32)esif_ccb_strlen(key, sizeof(key)));
+	if ((entryPtr != NULL) &&
+		((NULL == entryPtr->fUpPtr) ||
+		 ((isCaseSensitive ? esif_ccb_strcmp(EsifUp_GetName(entryPtr->fUpPtr), participantName) : esif_ccb_stricmp(EsifUp_GetName(entryPtr->fUpPtr), participantName)) != 0))) {
+		entryPtr = NULL;
 	}
+exit:
+	return entryPtr;
+}
+
+
+/*
+* Get an empty PM entry, growing the table when there is none (locked version - lock already held)
+* Only the primary participant may use the Participant 0 entry.
+*/
+static EsifUpManagerEntryPtr EsifUpPm_GetFreeEntryLocked(
+	Bool isPrimaryParticipant
+	)
+{
+	EsifUpManagerEntryPtr entryPtr = NULL;
+	UInt32 index = 0;
+
+	do {
+		for (; index < g_uppMgr.fEntrySize; index++) {
+			if (ESIF_PM_PARTICIPANT_STATE_AVAILABLE == g_uppMgr.fEntries[index]->fState) {
+				if ((index != ESIF_PARTICIPANT0_INDEX) || isPrimaryParticipant) {
+					entryPtr = g_uppMgr.fEntries[index];
+					goto exit;
+				}
+			}
+		}
+	} while (EsifUpPm_GrowTableLocked() == ESIF_OK);
+exit:
 	return entryPtr;
 }
 
 
+/*
+* Double the size of the participant table (locked version - lock already held)
+* Existing entries are not moved, so entry pointers held by callers stay valid.
+*/
+static eEsifError EsifUpPm_GrowTableLocked(void)
+{
+	eEsifError rc = ESIF_OK;
+	EsifUpManagerEntryPtr *newEntries = NULL;
+	UInt32 *newAvailable = NULL;
+	UInt32 newSize = 0;
+	UInt32 index = 0;
+
+	newSize = (g_uppMgr.fEntrySize ? g_uppMgr.fEntrySize * 2 : MAX_PARTICIPANT_ENTRY);
+
+	newEntries = (EsifUpManagerEntryPtr *)esif_ccb_realloc(g_uppMgr.fEntries, newSize * sizeof(*newEntries));
+	if (NULL == newEntries) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	g_uppMgr.fEntries = newEntries;
+
+	newAvailable = (UInt32 *)esif_ccb_realloc(g_uppMgr.fAvailable, newSize * sizeof(*newAvailable));
+	if (NULL == newAvailable) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+	g_uppMgr.fAvailable = newAvailable;
+
+	for (index = g_uppMgr.fEntrySize; index < newSize; index++) {
+		g_uppMgr.fEntries[index] = (EsifUpManagerEntryPtr)esif_ccb_malloc(sizeof(EsifUpManagerEntry));
+		if (NULL == g_uppMgr.fEntries[index]) {
+			rc = ESIF_E_NO_MEMORY;
+			break;
+		}
+		g_uppMgr.fEntries[index]->fState = ESIF_PM_PARTICIPANT_STATE_AVAILABLE;
+		g_uppMgr.fEntries[index]->fUpPtr = NULL;
+		g_uppMgr.fEntries[index]->fIndex = index;
+		g_uppMgr.fEntries[index]->fIndexedInstance = ESIF_INVALID_HANDLE;
+		g_uppMgr.fEntries[index]->fIndexedName[0] = 0;
+		g_uppMgr.fEntries[index]->fIsNameCollision = ESIF_FALSE;
+		g_uppMgr.fEntrySize = index + 1;
+	}
+
+	ESIF_TRACE_INFO("Participant table size is now %u\n", g_uppMgr.fEntrySize);
+exit:
+	return rc;
+}
+
+
+/*
+* Set the state of a PM entry and maintain the available list (locked version - lock already held)
+*/
+static void EsifUpPm_SetEntryStateLocked(
+	EsifUpManagerEntryPtr entryPtr,
+	enum esif_pm_participant_state state
+	)
+{
+	Bool wasAvailable = ESIF_FALSE;
+	Bool isAvailable = ESIF_FALSE;
+	UInt32 lo = 0;
+	UInt32 hi = 0;
+	UInt32 mid = 0;
+
+	ESIF_ASSERT(entryPtr != NULL);
+
+	wasAvailable = (entryPtr->fState > ESIF_PM_PARTICIPANT_STATE_REMOVED);
+	isAvailable = (state > ESIF_PM_PARTICIPANT_STATE_REMOVED);
+	entryPtr->fState = state;
+
+	if (wasAvailable == isAvailable) {
+		goto exit;
+	}
+
+	/* Binary search for the insertion point of this entry */
+	hi = g_uppMgr.fEntryCount;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (g_uppMgr.fAvailable[mid] < entryPtr->fIndex) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+
+	if (isAvailable) {
+		esif_ccb_memmove(&g_uppMgr.fAvailable[lo + 1], &g_uppMgr.fAvailable[lo], (g_uppMgr.fEntryCount - lo) * sizeof(*g_uppMgr.fAvailable));
+		g_uppMgr.fAvailable[lo] = entryPtr->fIndex;
+		g_uppMgr.fEntryCount++;
+	}
+	else if ((lo < g_uppMgr.fEntryCount) && (g_uppMgr.fAvailable[lo] == entryPtr->fIndex)) {
+		esif_ccb_memmove(&g_uppMgr.fAvailable[lo], &g_uppMgr.fAvailable[lo + 1], (g_uppMgr.fEntryCount - lo - 1) * sizeof(*g_uppMgr.fAvailable));
+		g_uppMgr.fEntryCount--;
+	}
+exit:
+	return;
+}
+
+
+/*
+* Add a PM entry to the instance, name and LP indexes, replacing any keys it
+* was previously indexed by (locked version - lock already held)
+*/
+static void EsifUpPm_IndexEntryLocked(
+	EsifUpManagerEntryPtr entryPtr
+	)
+{
+	EsifUpManagerEntryPtr otherPtr = NULL;
+	esif_handle_t key = ESIF_INVALID_HANDLE;
+	char *participantName = NULL;
+	UInt8 lpInstance = ESIF_INSTANCE_INVALID;
+
+	ESIF_ASSERT(entryPtr != NULL);
+
+	EsifUpPm_UnindexEntryLocked(entryPtr);
+
+	if (NULL == entryPtr->fUpPtr) {
+		goto exit;
+	}
+
+	key = EsifUp_GetInstance(entryPtr->fUpPtr);
+	if ((key != ESIF_INVALID_HANDLE) &&
+		(esif_ht_add_item(g_uppMgr.fInstanceIndex, (u8 *)&key, sizeof(key), entryPtr) == ESIF_OK)) {
+		entryPtr->fIndexedInstance = key;
+	}
+
+	participantName = EsifUp_GetName(entryPtr->fUpPtr);
+	if (esif_ccb_strlen(participantName, sizeof(entryPtr->fIndexedName)) < sizeof(entryPtr->fIndexedName)) {
+		esif_ccb_strcpy(entryPtr->fIndexedName, participantName, sizeof(entryPtr->fIndexedName));
+		esif_ccb_strupr(entryPtr->fIndexedName, sizeof(entryPtr->fIndexedName));
+
+		otherPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fNameIndex, (u8 *)entryPtr->fIndexedName, (u32)esif_ccb_strlen(entryPtr->fIndexedName, sizeof(entryPtr->fIndexedName)));
+		if ((otherPtr != NULL) ||
+			(esif_ht_add_item(g_uppMgr.fNameIndex, (u8 *)entryPtr->fIndexedName, (u32)esif_ccb_strlen(entryPtr->fIndexedName, sizeof(entryPtr->fIndexedName)), entryPtr) != ESIF_OK)) {
+			entryPtr->fIndexedName[0] = 0;
+		}
+	}
+
+	/* Entries that could not be indexed by name are found by scanning the table */
+	if (0 == entryPtr->fIndexedName[0]) {
+		entryPtr->fIsNameCollision = ESIF_TRUE;
+		g_uppMgr.fNameCollisions++;
+	}
+
+	lpInstance = EsifUp_GetLpInstance(entryPtr->fUpPtr);
+	if (lpInstance != ESIF_INSTANCE_INVALID) {
+		g_uppMgr.fLpIndex[lpInstance] = entryPtr->fIndex + 1;
+	}
+	EsifEventMgr_SetParticipantLpid(key, lpInstance);
+exit:
+	return;
+}
+
+
+/*
+* Remove a PM entry from the instance and name indexes (locked version - lock already held)
+*/
+static void EsifUpPm_UnindexEntryLocked(
+	EsifUpManagerEntryPtr entryPtr
+	)
+{
+	esif_handle_t key = ESIF_INVALID_HANDLE;
+	EsifUpManagerEntryPtr otherPtr = NULL;
+	UInt32 lpInstance = 0;
+
+	ESIF_ASSERT(entryPtr != NULL);
+
+	if (entryPtr->fIndexedInstance != ESIF_INVALID_HANDLE) {
+		key = entryPtr->fIndexedInstance;
+		esif_ht_remove_item(g_uppMgr.fInstanceIndex, (u8 *)&key, sizeof(key));
+		EsifEventMgr_SetParticipantLpid(key, ESIF_INSTANCE_INVALID);
+		entryPtr->fIndexedInstance = ESIF_INVALID_HANDLE;
+	}
+
+	if (entryPtr->fIndexedName[0]) {
+		otherPtr = (EsifUpManagerEntryPtr)esif_ht_get_item(g_uppMgr.fNameIndex, (u8 *)entryPtr->fIndexedName, (u32)esif_ccb_strlen(entryPtr->fIndexedName, sizeof(entryPtr->fIndexedName)));
+		if (otherPtr == entryPtr) {
+			esif_ht_remove_item(g_uppMgr.fNameIndex, (u8 *)entryPtr->fIndexedName, (u32)esif_ccb_strlen(entryPtr->fIndexedName, sizeof(entryPtr->fIndexedName)));
+		}
+		entryPtr->fIndexedName[0] = 0;
+	}
+
+	if (entryPtr->fIsNameCollision) {
+		entryPtr->fIsNameCollision = ESIF_FALSE;
+		g_uppMgr.fNameCollisions--;
+	}
+
+	for (lpInstance = 0; lpInstance < ESIF_UPPMGR_LP_INDEX_SIZE; lpInstance++) {
+		if (g_uppMgr.fLpIndex[lpInstance] == entryPtr->fIndex + 1) {
+			g_uppMgr.fLpIndex[lpInstance] = 0;
+		}
+	}
+}
+
+
+/*
+* Returns a copy of the instances of all participants other than the primary
+* participant, in any state, optionally limited to conjured UF participants.
+* The caller must free the returned array.
+*/
+static esif_handle_t *EsifUpPm_GetDynamicInstances(
+	Bool conjuredUfOnly,
+	UInt32 *countPtr
+	)
+{
+	esif_handle_t *participantIds = NULL;
+	EsifUpPtr upPtr = NULL;
+	UInt32 count = 0;
+	UInt32 index = 0;
+
+	ESIF_ASSERT(countPtr != NULL);
+
+	esif_ccb_read_lock(&g_uppMgr.fLock);
+
+	if (g_uppMgr.fEntrySize > 0) {
+		participantIds = (esif_handle_t *)esif_ccb_malloc(g_uppMgr.fEntrySize * sizeof(*participantIds));
+	}
+	if (participantIds != NULL) {
+		for (index = ESIF_PARTICIPANT0_INDEX + 1; index < g_uppMgr.fEntrySize; index++) {
+			upPtr = g_uppMgr.fEntries[index]->fUpPtr;
+			if ((NULL == upPtr) ||
+				(conjuredUfOnly && ((eParticipantOriginUF != upPtr->fOrigin) || (ESIF_PARTICIPANT_ENUM_CONJURE != upPtr->fMetadata.fEnumerator)))) {
+				continue;
+			}
+			participantIds[count++] = EsifUp_GetInstance(upPtr);
+		}
+	}
+
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
+
+	*countPtr = count;
+	return participantIds;
+}
+
+
 /*
 * Get participant by handle (locked version - lock already held)
 * NOTE:  The caller should call EsifUp_PutRef to release reference on participant when done with it
@@ -1086,30 +1367,23 @@ static EsifUpPtr EsifUpPm_GetAvailableParticipantByInstanceLocked(
 )
 {
 	EsifUpPtr upPtr = NULL;
+	EsifUpManagerEntryPtr entryPtr = NULL;
 	eEsifError rc = ESIF_OK;
-	size_t index = 0;
 	esif_handle_t localInstance = upInstance;
-	esif_handle_t curUpInstance = ESIF_INVALID_HANDLE;
 
 	if (EsifUpPm_IsPrimaryParticipantId(upInstance)) {
 		localInstance = ESIF_HANDLE_PRIMARY_PARTICIPANT;
 	}
-	for (index = 0; index < MAX_PARTICIPANT_ENTRY; index++) {
-		if (g_uppMgr.fEntries[index].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) {
-			upPtr = g_uppMgr.fEntries[index].fUpPtr;
-			if (upPtr != NULL) {
-
-				curUpInstance = EsifUp_GetInstance(upPtr);
-				if (localInstance == curUpInstance) {
-					rc = EsifUp_GetRef(upPtr);
-					if (rc != ESIF_OK) {
-						ESIF_TRACE_INFO("Unable to acquire reference on participant\n");
-						upPtr = NULL;
-					}
-					break;
-				}
+
+	entryPtr = EsifUpPm_GetEntryByInstanceLocked(localInstance);
+	if ((entryPtr != NULL) && (entryPtr->fState > ESIF_PM_PARTICIPANT_STATE_REMOVED)) {
+		upPtr = entryPtr->fUpPtr;
+		if (upPtr != NULL) {
+			rc = EsifUp_GetRef(upPtr);
+			if (rc != ESIF_OK) {
+				ESIF_TRACE_INFO("Unable to acquire reference on participant\n");
+				upPtr = NULL;
 			}
-			upPtr = NULL;
 		}
 	}
 	return upPtr;
@@ -1124,7 +1398,7 @@ Bool EsifUpPm_DoesAvailableParticipantExistByHID(
 	Bool bRet = ESIF_FALSE;
 	EsifUpPtr upPtr = NULL;
 	EsifUpDataPtr metaPtr = NULL;
-	UInt8 i;
+	UInt32 i;
 
 	if (NULL == participantHID) {
 		ESIF_TRACE_ERROR("The participant HID pointer is NULL\n");
@@ -1133,18 +1407,15 @@ Bool EsifUpPm_DoesAvailableParticipantExistByHID(
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(i);
+	for (i = 0; i < g_uppMgr.fEntryCount; i++) {
+		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(g_uppMgr.fAvailable[i]);
 
 		if (NULL == upPtr) {
 			continue;
 		}
 
 		metaPtr = EsifUp_GetMetadata(upPtr);
-		if (NULL == metaPtr) {
-			continue;
-		}
-		if ((g_uppMgr.fEntries[i].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) && !esif_ccb_strcmp(metaPtr->fAcpiDevice, participantHID)) {
+		if ((metaPtr != NULL) && !esif_ccb_strcmp(metaPtr->fAcpiDevice, participantHID)) {
 			bRet = ESIF_TRUE;
 			break;
 		}
@@ -1170,7 +1441,7 @@ Bool EsifUpPm_DoesAvailableParticipantExistByDevicePath(
 	Bool bRet = ESIF_FALSE;
 	EsifUpPtr upPtr = NULL;
 	EsifUpDataPtr metaPtr = NULL;
-	UInt8 i;
+	UInt32 i;
 
 	if (NULL == participantDevicePath) {
 		ESIF_TRACE_ERROR("The participant device path pointer is NULL\n");
@@ -1179,18 +1450,15 @@ Bool EsifUpPm_DoesAvailableParticipantExistByDevicePath(
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(i);
+	for (i = 0; i < g_uppMgr.fEntryCount; i++) {
+		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(g_uppMgr.fAvailable[i]);
 
 		if (NULL == upPtr) {
 			continue;
 		}
 
 		metaPtr = EsifUp_GetMetadata(upPtr);
-		if (NULL == metaPtr) {
-			continue;
-		}
-		if ((g_uppMgr.fEntries[i].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) && !esif_ccb_stricmp(metaPtr->fDevicePath, participantDevicePath)) {
+		if ((metaPtr != NULL) && !esif_ccb_stricmp(metaPtr->fDevicePath, participantDevicePath)) {
 			bRet = ESIF_TRUE;
 			break;
 		}
@@ -1216,8 +1484,7 @@ Bool EsifUpPm_DoesAvailableParticipantExistByName (
 	)
 {
 	Bool bRet = ESIF_FALSE;
-	EsifUpPtr upPtr = NULL;
-	UInt8 i;
+	EsifUpManagerEntryPtr entryPtr = NULL;
 
 	if (NULL == participantName) {
 		ESIF_TRACE_ERROR("The participant name pointer is NULL\n");
@@ -1226,28 +1493,13 @@ Bool EsifUpPm_DoesAvailableParticipantExistByName (
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(i);
-
-		if (NULL == upPtr) {
-			continue;
-		}
-
-		if ((g_uppMgr.fEntries[i].fState > ESIF_PM_PARTICIPANT_STATE_REMOVED) && !esif_ccb_strcmp(EsifUp_GetName(upPtr), participantName)) {
-			bRet = ESIF_TRUE;
-			break;
-		}
-
-		EsifUp_PutRef(upPtr);
-		upPtr = NULL;
+	entryPtr = EsifUpPm_GetEntryByNameLocked(participantName, ESIF_TRUE);
+	if ((entryPtr != NULL) && (entryPtr->fState > ESIF_PM_PARTICIPANT_STATE_REMOVED)) {
+		bRet = ESIF_TRUE;
 	}
 
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
 exit:
-	if (upPtr != NULL) {
-		EsifUp_PutRef(upPtr);
-	}
-	
 	return bRet;
 }
 
@@ -1257,7 +1509,7 @@ EsifUpPtr EsifUpPm_GetAvailableParticipantByName (
 	)
 {
 	EsifUpPtr upPtr = NULL;
-	UInt8 i;
+	EsifUpManagerEntryPtr entryPtr = NULL;
 
 	if (NULL == participantName) {
 		ESIF_TRACE_ERROR("The participant name pointer is NULL\n");
@@ -1266,19 +1518,9 @@ EsifUpPtr EsifUpPm_GetAvailableParticipantByName (
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(i);
-
-		if (NULL == upPtr) {
-			continue;
-		}
-
-		if (!esif_ccb_stricmp(participantName, EsifUp_GetName(upPtr))) {
-			break;
-		}
-
-		EsifUp_PutRef(upPtr);
-		upPtr = NULL;
+	entryPtr = EsifUpPm_GetEntryByNameLocked(participantName, ESIF_FALSE);
+	if (entryPtr != NULL) {
+		upPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(entryPtr->fIndex);
 	}
 
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
@@ -1294,7 +1536,6 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadataLocked(
 {
 	EsifUpManagerEntryPtr entryPtr = NULL;
 	char *participantName = "";
-	UInt8 i;
 
 	/* Validate parameters */
 	if (NULL == metadataPtr) {
@@ -1307,8 +1548,8 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadataLocked(
 	case eParticipantOriginLF:
 		// If the participant is a DPTFZ, then it will only match the primary participant
 		if (((struct esif_ipc_event_data_create_participant *)metadataPtr)->flags & ESIF_FLAG_DPTFZ) {
-			if (g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX].fUpPtr != NULL) {
-				entryPtr = &g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX];
+			if (g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX]->fUpPtr != NULL) {
+				entryPtr = g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX];
 			}
 			goto exit;
 		}
@@ -1319,8 +1560,8 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadataLocked(
 	case eParticipantOriginUF:
 		// If the participant is a DPTFZ, then it will only match the primary participant
 		if (((EsifParticipantIfacePtr)metadataPtr)->flags & ESIF_FLAG_DPTFZ) {
-			if (g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX].fUpPtr != NULL) {
-				entryPtr = &g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX];
+			if (g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX]->fUpPtr != NULL) {
+				entryPtr = g_uppMgr.fEntries[ESIF_PARTICIPANT0_INDEX];
 			}
 			goto exit;
 		}
@@ -1333,16 +1574,7 @@ static EsifUpManagerEntryPtr EsifUpPm_GetParticipantEntryFromMetadataLocked(
 		break;
 	}
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		entryPtr = &g_uppMgr.fEntries[i];
-
-		if (NULL != entryPtr->fUpPtr) {
-			if (!strcmp(EsifUp_GetName(entryPtr->fUpPtr), participantName)) {
-				break;
-			}
-		}
-		entryPtr = NULL;
-	}
+	entryPtr = EsifUpPm_GetEntryByNameLocked(participantName, ESIF_TRUE);
 exit:
 	return entryPtr;
 }
@@ -1355,7 +1587,8 @@ eEsifError EsifUpPm_MapLpidToParticipantInstance(
 	)
 {
 	eEsifError rc    = ESIF_E_INVALID_HANDLE;
-	UInt8 i = 0;
+	EsifUpPtr upPtr = NULL;
+	UInt32 i = 0;
 
 	/* Validate parameters */
 	if (NULL == upInstancePtr) {
@@ -1366,21 +1599,27 @@ eEsifError EsifUpPm_MapLpidToParticipantInstance(
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (g_uppMgr.fEntries[i].fUpPtr && (EsifUp_GetLpInstance(g_uppMgr.fEntries[i].fUpPtr) == lpInstance)) {
-			break;
+	/* The LP index is only a hint; verify it and fall back to a table scan */
+	i = g_uppMgr.fLpIndex[lpInstance];
+	if ((i > 0) && (i <= g_uppMgr.fEntrySize)) {
+		upPtr = g_uppMgr.fEntries[i - 1]->fUpPtr;
+	}
+	if ((NULL == upPtr) || (EsifUp_GetLpInstance(upPtr) != lpInstance)) {
+		upPtr = NULL;
+		for (i = 0; i < g_uppMgr.fEntrySize; i++) {
+			if (g_uppMgr.fEntries[i]->fUpPtr && (EsifUp_GetLpInstance(g_uppMgr.fEntries[i]->fUpPtr) == lpInstance)) {
+				upPtr = g_uppMgr.fEntries[i]->fUpPtr;
+				break;
+			}
 		}
 	}
 
-	esif_ccb_read_unlock(&g_uppMgr.fLock);
-
-	if (i >= MAX_PARTICIPANT_ENTRY) {
-		goto exit;
+	if (upPtr != NULL) {
+		*upInstancePtr = EsifUp_GetInstance(upPtr);
+		rc = ESIF_OK;
 	}
 
-	*upInstancePtr = EsifUp_GetInstance(g_uppMgr.fEntries[i].fUpPtr);
-	rc = ESIF_OK;
-
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
 exit:
 	return rc;
 }
@@ -1392,12 +1631,12 @@ Bool EsifUpPm_IsActionUsedByParticipants(
 {
 	Bool isUsed = ESIF_FALSE;
 	EsifUpPtr upPtr = NULL;
-	UInt8 i;
+	UInt32 i;
 
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		upPtr = g_uppMgr.fEntries[i].fUpPtr;
+	for (i = 0; i < g_uppMgr.fEntrySize; i++) {
+		upPtr = g_uppMgr.fEntries[i]->fUpPtr;
 		if (NULL == upPtr) {
 			continue;
 		}
@@ -1450,7 +1689,9 @@ eEsifError EsifUpPm_GetNextUp(
 {
 	eEsifError rc = ESIF_OK;
 	EsifUpPtr nextUpPtr = NULL;
-	UInt8 i;
+	UInt32 lo = 0;
+	UInt32 hi = 0;
+	UInt32 mid = 0;
 
 	if ((NULL == upPtr) || (NULL == iteratorPtr)) {
 		ESIF_TRACE_WARN("Parameter is NULL\n");
@@ -1459,8 +1700,7 @@ eEsifError EsifUpPm_GetNextUp(
 	}
 
 	/* Verify the iterator is initialized */
-	if ((iteratorPtr->marker != UF_PM_ITERATOR_MARKER) ||
-		(iteratorPtr->index >= MAX_PARTICIPANT_ENTRY)) {
+	if (iteratorPtr->marker != UF_PM_ITERATOR_MARKER) {
 		ESIF_TRACE_WARN("Iterator invalid\n");
 		rc = ESIF_E_INVALID_HANDLE;
 		goto exit;
@@ -1473,16 +1713,36 @@ eEsifError EsifUpPm_GetNextUp(
 		iteratorPtr->ref_taken = ESIF_FALSE;
 	}
 
-	for (i = iteratorPtr->index; i < MAX_PARTICIPANT_ENTRY; i++) {
-		nextUpPtr = EsifUpPm_GetAvailableParticipantByIndex(i);
+	esif_ccb_read_lock(&g_uppMgr.fLock);
+
+	/*
+	 * The index is a table position, so participants added or removed during
+	 * the iteration do not disturb it. Find the first available entry at or
+	 * after it in the sorted available list.
+	 */
+	hi = g_uppMgr.fEntryCount;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (g_uppMgr.fAvailable[mid] < iteratorPtr->index) {
+			lo = mid + 1;
+		}
+		else {
+			hi = mid;
+		}
+	}
+
+	for (; lo < g_uppMgr.fEntryCount; lo++) {
+		nextUpPtr = EsifUpPm_GetAvailableParticipantByIndexLocked(g_uppMgr.fAvailable[lo]);
 		if (nextUpPtr != NULL) {
-			iteratorPtr->index = i;
+			iteratorPtr->index = g_uppMgr.fAvailable[lo];
 			iteratorPtr->upPtr = nextUpPtr;
 			iteratorPtr->ref_taken = ESIF_TRUE;
 			break;
 		}
 	}
 
+	esif_ccb_read_unlock(&g_uppMgr.fLock);
+
 	*upPtr = nextUpPtr;
 
 	if (NULL == nextUpPtr) {
@@ -1492,9 +1752,9 @@ exit:
 	return rc;
 }
 
-UInt8 EsifUpPm_ParticipantCount(void)
+UInt32 EsifUpPm_ParticipantCount(void)
 {
-	UInt8 result = 0;
+	UInt32 result = 0;
 	esif_ccb_read_lock(&g_uppMgr.fLock);
 	result = g_uppMgr.fEntryCount;
 	esif_ccb_read_unlock(&g_uppMgr.fLock);
@@ -1511,6 +1771,21 @@ eEsifError EsifUpPm_Init(void)
 	/* Initialize Lock */
 	esif_ccb_lock_init(&g_uppMgr.fLock);
 
+	g_uppMgr.fInstanceIndex = esif_ht_create(ESIF_UPPMGR_INDEX_SIZE);
+	g_uppMgr.fNameIndex = esif_ht_create(ESIF_UPPMGR_INDEX_SIZE);
+	if ((NULL == g_uppMgr.fInstanceIndex) || (NULL == g_uppMgr.fNameIndex)) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	/* Participant 0 is reserved for the primary participant, so the table must always exist */
+	esif_ccb_write_lock(&g_uppMgr.fLock);
+	rc = EsifUpPm_GrowTableLocked();
+	esif_ccb_write_unlock(&g_uppMgr.fLock);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_CREATE, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_SUSPEND, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_PARTICIPANT_RESUME, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
@@ -1521,7 +1796,7 @@ eEsifError EsifUpPm_Init(void)
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_APP_CONNECTED_STANDBY_EXIT, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_BATTERY_COUNT_NOTIFICATION, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
 	EsifEventMgr_RegisterEventByType(ESIF_EVENT_LF_UNLOADED, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
-
+exit:
 	ESIF_TRACE_EXIT_INFO_W_STATUS(rc);
 	return rc;
 }
@@ -1530,6 +1805,8 @@ eEsifError EsifUpPm_Init(void)
 /* Exit manager */
 void EsifUpPm_Exit(void)
 {
+	UInt32 i = 0;
+
 	ESIF_TRACE_ENTRY_INFO();
 
 	EsifEventMgr_UnregisterEventByType(ESIF_EVENT_PARTICIPANT_CREATE, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, EsifUpPm_EventCallback, 0);
@@ -1546,6 +1823,25 @@ void EsifUpPm_Exit(void)
 	/* Clean up resources */
 	EsifUpPm_DestroyParticipants();
 
+	esif_ccb_write_lock(&g_uppMgr.fLock);
+	for (i = 0; i < g_uppMgr.fEntrySize; i++) {
+		esif_ccb_free(g_uppMgr.fEntries[i]);
+	}
+	esif_ccb_free(g_uppMgr.fEntries);
+	esif_ccb_free(g_uppMgr.fAvailable);
+	g_uppMgr.fEntries = NULL;
+	g_uppMgr.fAvailable = NULL;
+	g_uppMgr.fEntrySize = 0;
+	g_uppMgr.fEntryCount = 0;
+
+	esif_ht_destroy(g_uppMgr.fInstanceIndex, NULL);
+	esif_ht_destroy(g_uppMgr.fNameIndex, NULL);
+	g_uppMgr.fInstanceIndex = NULL;
+	g_uppMgr.fNameIndex = NULL;
+	g_uppMgr.fNameCollisions = 0;
+	esif_ccb_memset(g_uppMgr.fLpIndex, 0, sizeof(g_uppMgr.fLpIndex));
+	esif_ccb_write_unlock(&g_uppMgr.fLock);
+
 	/* Uninitialize Lock */
 	esif_ccb_lock_uninit(&g_uppMgr.fLock);
 
@@ -1558,18 +1854,24 @@ eEsifError EsifUpPm_DestroyParticipant(char *participantName)
 {
 	eEsifError rc = ESIF_E_NOT_FOUND;
 	EsifUpManagerEntryPtr entryPtr = NULL;
+	EsifUpManagerEntryPtr namedEntryPtr = NULL;
 	EsifUpPtr upPtr = NULL;
-	UInt8 i = 0;
+	UInt32 i = 0;
 	esif_handle_t upInstance = ESIF_INVALID_HANDLE;
 	Bool isConjuredLfParticipant = ESIF_FALSE;
 
 	esif_ccb_write_lock(&g_uppMgr.fLock);
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		entryPtr = &g_uppMgr.fEntries[i];
+	if (participantName != NULL) {
+		namedEntryPtr = EsifUpPm_GetEntryByNameLocked(participantName, ESIF_FALSE);
+	}
+
+	// The lock is released while destroying, so the table size is re-read on every pass
+	for (i = 0; i < g_uppMgr.fEntrySize; i++) {
+		entryPtr = g_uppMgr.fEntries[i];
 
 		// Destroy Participant if Name=NULL or the name matches
-		if ((participantName == NULL) || (entryPtr->fUpPtr && esif_ccb_stricmp(participantName, entryPtr->fUpPtr->fMetadata.fName) == 0)) {
+		if ((participantName == NULL) || (entryPtr == namedEntryPtr)) {
 			rc = ESIF_OK;
 			
 			if (NULL != entryPtr->fUpPtr) {
@@ -1599,9 +1901,10 @@ eEsifError EsifUpPm_DestroyParticipant(char *participantName)
 
 				esif_ccb_write_lock(&g_uppMgr.fLock);
 
+				EsifUpPm_UnindexEntryLocked(entryPtr);
+				EsifUpPm_SetEntryStateLocked(entryPtr, ESIF_PM_PARTICIPANT_STATE_AVAILABLE);
 				upPtr = entryPtr->fUpPtr;
 				entryPtr->fUpPtr = NULL;
-				entryPtr->fState = ESIF_PM_PARTICIPANT_STATE_AVAILABLE;
 
 				esif_ccb_write_unlock(&g_uppMgr.fLock);
 				EsifUp_DestroyParticipant(upPtr);
@@ -22,6 +22,7 @@
 #include "esif_uf_trace.h"
 #include "esif_dsp.h"
 #include "esif_uf_action.h"
+#include "esif_uf_primitive.h"	/* ESIF Primitive Execution */
 
 #ifdef ESIF_ATTR_OS_WINDOWS
 //
@@ -140,15 +141,12 @@ eEsifError EsifExecutePrimitive(
 	)
 {
 	eEsifError rc = ESIF_OK;
-	EsifUpPtr upPtr   = NULL;
 	EsifPrimitiveTuple tuple = {0};
-	UInt16 domain = 0;
 	
 	if (NULL == domainStr) {
 		rc = ESIF_E_PARAMETER_IS_NULL;
 		goto exit;
 	}
-	domain = domain_str_to_short(domainStr);
 
 	ESIF_TRACE_DEBUG("\n\n"
 		"Primitive Request:\n"
@@ -165,19 +163,40 @@ eEsifError EsifExecutePrimitive(
 		requestPtr,
 		responsePtr);
 
+	tuple.id       = (u16)primitiveId;
+	tuple.domain   = domain_str_to_short(domainStr);
+	tuple.instance = instance;
+	
+	rc = EsifExecuteTuplePrimitive(participantId, &tuple, requestPtr, responsePtr);
+exit:
+	ESIF_TRACE_DEBUG("Primitive result = %s\n", esif_rc_str(rc));
+	return rc;
+}
+
+
+eEsifError EsifExecuteTuplePrimitive(
+	const esif_handle_t participantId,
+	const EsifPrimitiveTuplePtr tuplePtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifUpPtr upPtr = NULL;
+
+	if (NULL == tuplePtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
 	upPtr = EsifUpPm_GetAvailableParticipantByInstance(participantId);
 	if (NULL == upPtr) {
 		rc = ESIF_E_PARTICIPANT_NOT_FOUND;
 		goto exit;
 	}
 
-	tuple.id       = (u16)primitiveId;
-	tuple.domain   = domain;
-	tuple.instance = instance;
-	
-	rc = EsifUp_ExecutePrimitive(upPtr, &tuple, requestPtr, responsePtr);
+	rc = EsifUp_ExecutePrimitive(upPtr, tuplePtr, requestPtr, responsePtr);
 exit:
-	ESIF_TRACE_DEBUG("Primitive result = %s\n", esif_rc_str(rc));
 	if (upPtr != NULL) {
 		EsifUp_PutRef(upPtr);
 	}
@@ -52,6 +52,17 @@ eEsifError EsifExecutePrimitive(
 	EsifDataPtr responsePtr
 	);
 
+/*
+ * Execute Primitive using a pre-resolved tuple
+ * Same as EsifExecutePrimitive without the domain qualifier string conversion
+ */
+eEsifError EsifExecuteTuplePrimitive(
+	const esif_handle_t participantId,
+	const EsifPrimitiveTuplePtr tuplePtr,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	);
+
 Bool EsifPrimitiveVerifyOpcode(
 	const esif_handle_t participantId,
 	const UInt32 primitiveId,
@@ -0,0 +1,437 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+
+#define ESIF_TRACE_ID	ESIF_TRACEMODULE_PRIMITIVE
+
+#include "esif_uf.h"	/* Upper Framework */
+#include "esif_uf_primstats.h"
+
+#ifdef ESIF_ATTR_OS_WINDOWS
+//
+// The Windows banned-API check header must be included after all other headers, or issues can be identified
+// against Windows SDK/DDK included headers which we have no control over.
+//
+#define _SDL_BANNED_RECOMMENDED
+#include "win\banned.h"
+#endif
+
+#define ESIF_PRIMSTATS_MAX_SLOTS	1024	/* Must be a power of 2 */
+#define ESIF_PRIMSTATS_MAX_PROBES	32	/* Slots searched for a key before it is counted as an overflow */
+#define ESIF_PRIMSTATS_MAX_CLAIM_RETRIES	4
+
+#define ESIF_PRIMSTATS_SLOT_EMPTY	0
+#define ESIF_PRIMSTATS_SLOT_CLAIMED	1	/* Key is being written by the thread which claimed the slot */
+#define ESIF_PRIMSTATS_SLOT_READY	2
+#define ESIF_PRIMSTATS_SLOT_RELEASED	3	/* Free for reuse, but keys may have been placed past it */
+
+/*
+ * Slots are claimed on first use and released when their participant is
+ * destroyed, so a slot's key does not change while the participant exists;
+ * a reset only clears the counters. Released slots stay in the probe chain
+ * of other keys, so a lookup searches past them and only stops at an empty
+ * slot.
+ */
+typedef struct EsifPrimStatsSlot_s {
+	atomic_t state;
+	esif_handle_t participantId;
+	UInt32 primitiveId;
+	esif_action_type_t actionType;
+	atomic64_t count;
+	atomic64_t errorCount;
+	atomic64_t totalUsec;
+	atomic64_t maxUsec;
+	atomic64_t buckets[ESIF_PRIMSTATS_BUCKETS];
+} EsifPrimStatsSlot, *EsifPrimStatsSlotPtr;
+
+typedef struct EsifPrimStats_s {
+	atomic_t isEnabled;
+	atomic64_t droppedCount;	/* Overflow count of executions whose key found no slot within ESIF_PRIMSTATS_MAX_PROBES */
+	atomic64_t resetTime;	/* esif_ccb_system_time of the last reset */
+	EsifPrimStatsSlot slots[ESIF_PRIMSTATS_MAX_SLOTS];
+} EsifPrimStats;
+
+/* Statically allocated so recording never races with the table being freed */
+static EsifPrimStats g_primStats = { 0 };
+
+
+static UInt32 EsifPrimStats_Hash(
+	const esif_handle_t participantId,
+	const UInt32 primitiveId,
+	const esif_action_type_t actionType
+	)
+{
+	UInt64 key = ((UInt64)participantId * 0x9E3779B97F4A7C15ULL) ^ ((UInt64)primitiveId << 8) ^ (UInt64)actionType;
+
+	key ^= key >> 29;
+	key *= 0xBF58476D1CE4E5B9ULL;
+	key ^= key >> 32;
+	return (UInt32)key;
+}
+
+
+static void EsifPrimStats_ClearSlot(EsifPrimStatsSlotPtr slotPtr)
+{
+	UInt32 bucket = 0;
+
+	atomic64_set(&slotPtr->count, 0);
+	atomic64_set(&slotPtr->errorCount, 0);
+	atomic64_set(&slotPtr->totalUsec, 0);
+	atomic64_set(&slotPtr->maxUsec, 0);
+	for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+		atomic64_set(&slotPtr->buckets[bucket], 0);
+	}
+}
+
+
+/* Waits for a claimed slot to become ready or released and returns its state */
+static atomic_basetype EsifPrimStats_WaitForSlot(EsifPrimStatsSlotPtr slotPtr)
+{
+	atomic_basetype state = atomic_read(&slotPtr->state);
+
+	while (ESIF_PRIMSTATS_SLOT_CLAIMED == state) {
+		state = atomic_read(&slotPtr->state);
+	}
+	return state;
+}
+
+
+/*
+ * Returns the slot for the key, claiming a free slot if it has none. Only
+ * ESIF_PRIMSTATS_MAX_PROBES slots are searched, so NULL is returned if they
+ * hold other keys. If another participant's slots are released while two
+ * threads add the same key, each may claim a different slot, so a snapshot
+ * can rarely list a key twice.
+ */
+static EsifPrimStatsSlotPtr EsifPrimStats_GetSlot(
+	const esif_handle_t participantId,
+	const UInt32 primitiveId,
+	const esif_action_type_t actionType
+	)
+{
+	EsifPrimStatsSlotPtr slotPtr = NULL;
+	EsifPrimStatsSlotPtr freeSlotPtr = NULL;
+	UInt32 hash = EsifPrimStats_Hash(participantId, primitiveId, actionType);
+	UInt32 probe = 0;
+	UInt32 retry = 0;
+	atomic_basetype state = ESIF_PRIMSTATS_SLOT_EMPTY;
+	atomic_basetype freeState = ESIF_PRIMSTATS_SLOT_EMPTY;
+
+	for (retry = 0; retry < ESIF_PRIMSTATS_MAX_CLAIM_RETRIES; retry++) {
+		freeSlotPtr = NULL;
+
+		for (probe = 0; probe < ESIF_PRIMSTATS_MAX_PROBES; probe++) {
+			slotPtr = &g_primStats.slots[(hash + probe) & (ESIF_PRIMSTATS_MAX_SLOTS - 1)];
+
+			/* Another thread claimed the slot; its key is only valid once it is ready */
+			state = EsifPrimStats_WaitForSlot(slotPtr);
+
+			if (ESIF_PRIMSTATS_SLOT_READY == state) {
+				if ((slotPtr->participantId == participantId) &&
+					(slotPtr->primitiveId == primitiveId) &&
+					(slotPtr->actionType == actionType)) {
+					return slotPtr;
+				}
+				continue;
+			}
+
+			/* Reuse the first released slot, but the key may still be found later in the chain */
+			if (NULL == freeSlotPtr) {
+				freeSlotPtr = slotPtr;
+				freeState = state;
+			}
+			if (ESIF_PRIMSTATS_SLOT_EMPTY == state) {
+				break;
+			}
+		}
+
+		if (NULL == freeSlotPtr) {
+			return NULL;
+		}
+
+		/* If another thread took the free slot first, search again since it may have added this key */
+		state = atomic_cmpxchg(&freeSlotPtr->state, freeState, ESIF_PRIMSTATS_SLOT_CLAIMED);
+		if (state == freeState) {
+			EsifPrimStats_ClearSlot(freeSlotPtr);
+			freeSlotPtr->participantId = participantId;
+			freeSlotPtr->primitiveId = primitiveId;
+			freeSlotPtr->actionType = actionType;
+			atomic_set(&freeSlotPtr->state, ESIF_PRIMSTATS_SLOT_READY);
+			return freeSlotPtr;
+		}
+	}
+	return NULL;
+}
+
+
+static UInt32 EsifPrimStats_GetBucket(UInt64 elapsedUsec)
+{
+	UInt32 bucket = 0;
+
+	while ((elapsedUsec > 0) && (bucket < ESIF_PRIMSTATS_BUCKETS - 1)) {
+		elapsedUsec >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+
+static UInt64 EsifPrimStats_ReadCounter(
+	atomic64_t *counterPtr,
+	Bool isReset
+	)
+{
+	return (UInt64)(isReset ? atomic64_set(counterPtr, 0) : atomic64_read(counterPtr));
+}
+
+
+static int EsifPrimStats_CompareEntry(
+	const EsifPrimStatsEntry *leftPtr,
+	const EsifPrimStatsEntry *rightPtr
+	)
+{
+	if (leftPtr->participantId != rightPtr->participantId) {
+		return (leftPtr->participantId < rightPtr->participantId) ? -1 : 1;
+	}
+	if (leftPtr->primitiveId != rightPtr->primitiveId) {
+		return (leftPtr->primitiveId < rightPtr->primitiveId) ? -1 : 1;
+	}
+	if (leftPtr->actionType != rightPtr->actionType) {
+		return (leftPtr->actionType < rightPtr->actionType) ? -1 : 1;
+	}
+	return 0;
+}
+
+
+Bool EsifPrimStats_IsEnabled(void)
+{
+	return (atomic_read(&g_primStats.isEnabled) ? ESIF_TRUE : ESIF_FALSE);
+}
+
+
+void EsifPrimStats_SetEnabled(Bool isEnabled)
+{
+	atomic_set(&g_primStats.isEnabled, (isEnabled ? ESIF_TRUE : ESIF_FALSE));
+}
+
+
+void EsifPrimStats_Record(
+	const esif_handle_t participantId,
+	const UInt32 primitiveId,
+	const esif_action_type_t actionType,
+	const eEsifError rc,
+	const UInt64 elapsedUsec
+	)
+{
+	EsifPrimStatsSlotPtr slotPtr = NULL;
+	atomic64_basetype maxUsec = 0;
+	atomic64_basetype prevMaxUsec = 0;
+
+	if (!EsifPrimStats_IsEnabled()) {
+		return;
+	}
+
+	slotPtr = EsifPrimStats_GetSlot(participantId, primitiveId, actionType);
+	if (NULL == slotPtr) {
+		atomic64_inc(&g_primStats.droppedCount);
+		return;
+	}
+
+	atomic64_inc(&slotPtr->count);
+	if (rc != ESIF_OK) {
+		atomic64_inc(&slotPtr->errorCount);
+	}
+	atomic64_add((atomic64_basetype)elapsedUsec, &slotPtr->totalUsec);
+	atomic64_inc(&slotPtr->buckets[EsifPrimStats_GetBucket(elapsedUsec)]);
+
+	maxUsec = atomic64_read(&slotPtr->maxUsec);
+	while ((UInt64)maxUsec < elapsedUsec) {
+		prevMaxUsec = atomic64_cmpxchg(&slotPtr->maxUsec, maxUsec, (atomic64_basetype)elapsedUsec);
+		if (prevMaxUsec == maxUsec) {
+			break;
+		}
+		maxUsec = prevMaxUsec;
+	}
+}
+
+
+eEsifError EsifPrimStats_GetSnapshot(
+	EsifPrimStatsSnapshotPtr snapshotPtr,
+	Bool isReset
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifPrimStatsSlotPtr slotPtr = NULL;
+	EsifPrimStatsEntryPtr entryPtr = NULL;
+	EsifPrimStatsEntry entry = { 0 };
+	esif_ccb_time_t now = 0;
+	UInt32 index = 0;
+	UInt32 bucket = 0;
+	UInt32 pos = 0;
+
+	if (NULL == snapshotPtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	esif_ccb_memset(snapshotPtr, 0, sizeof(*snapshotPtr));
+
+	snapshotPtr->entries = (EsifPrimStatsEntryPtr)esif_ccb_malloc(sizeof(EsifPrimStatsEntry) * ESIF_PRIMSTATS_MAX_SLOTS);
+	if (NULL == snapshotPtr->entries) {
+		rc = ESIF_E_NO_MEMORY;
+		goto exit;
+	}
+
+	esif_ccb_system_time(&now);
+	snapshotPtr->intervalMsec = now - (UInt64)EsifPrimStats_ReadCounter(&g_primStats.resetTime, ESIF_FALSE);
+	snapshotPtr->droppedCount = EsifPrimStats_ReadCounter(&g_primStats.droppedCount, isReset);
+	if (isReset) {
+		atomic64_set(&g_primStats.resetTime, (atomic64_basetype)now);
+	}
+
+	for (index = 0; index < ESIF_PRIMSTATS_MAX_SLOTS; index++) {
+		slotPtr = &g_primStats.slots[index];
+		if (atomic_read(&slotPtr->state) != ESIF_PRIMSTATS_SLOT_READY) {
+			continue;
+		}
+
+		entry.participantId = slotPtr->participantId;
+		entry.primitiveId = slotPtr->primitiveId;
+		entry.actionType = slotPtr->actionType;
+		entry.count = EsifPrimStats_ReadCounter(&slotPtr->count, isReset);
+		entry.errorCount = EsifPrimStats_ReadCounter(&slotPtr->errorCount, isReset);
+		entry.totalUsec = EsifPrimStats_ReadCounter(&slotPtr->totalUsec, isReset);
+		entry.maxUsec = EsifPrimStats_ReadCounter(&slotPtr->maxUsec, isReset);
+		for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+			entry.buckets[bucket] = EsifPrimStats_ReadCounter(&slotPtr->buckets[bucket], isReset);
+		}
+		if (0 == entry.count) {
+			continue;
+		}
+
+		/* Insertion sort; entries are only sorted when a snapshot is taken */
+		pos = snapshotPtr->count;
+		entryPtr = snapshotPtr->entries;
+		while ((pos > 0) && (EsifPrimStats_CompareEntry(&entryPtr[pos - 1], &entry) > 0)) {
+			entryPtr[pos] = entryPtr[pos - 1];
+			pos--;
+		}
+		entryPtr[pos] = entry;
+		snapshotPtr->count++;
+	}
+exit:
+	return rc;
+}
+
+
+void EsifPrimStats_FreeSnapshot(EsifPrimStatsSnapshotPtr snapshotPtr)
+{
+	if (snapshotPtr != NULL) {
+		esif_ccb_free(snapshotPtr->entries);
+		esif_ccb_memset(snapshotPtr, 0, sizeof(*snapshotPtr));
+	}
+}
+
+
+void EsifPrimStats_Reset(void)
+{
+	EsifPrimStatsSlotPtr slotPtr = NULL;
+	esif_ccb_time_t now = 0;
+	UInt32 index = 0;
+
+	for (index = 0; index < ESIF_PRIMSTATS_MAX_SLOTS; index++) {
+		slotPtr = &g_primStats.slots[index];
+		if (atomic_read(&slotPtr->state) != ESIF_PRIMSTATS_SLOT_READY) {
+			continue;
+		}
+		EsifPrimStats_ClearSlot(slotPtr);
+	}
+	atomic64_set(&g_primStats.droppedCount, 0);
+
+	esif_ccb_system_time(&now);
+	atomic64_set(&g_primStats.resetTime, (atomic64_basetype)now);
+}
+
+
+void EsifPrimStats_ReleaseParticipant(const esif_handle_t participantId)
+{
+	EsifPrimStatsSlotPtr slotPtr = NULL;
+	UInt32 index = 0;
+
+	for (index = 0; index < ESIF_PRIMSTATS_MAX_SLOTS; index++) {
+		slotPtr = &g_primStats.slots[index];
+		if ((EsifPrimStats_WaitForSlot(slotPtr) == ESIF_PRIMSTATS_SLOT_READY) &&
+			(slotPtr->participantId == participantId)) {
+			atomic_set(&slotPtr->state, ESIF_PRIMSTATS_SLOT_RELEASED);
+		}
+	}
+}
+
+
+UInt64 EsifPrimStats_GetBucketLimitUsec(UInt32 bucket)
+{
+	return (bucket < ESIF_PRIMSTATS_BUCKETS - 1) ? ((UInt64)1 << bucket) : 0;
+}
+
+
+UInt64 EsifPrimStats_GetPercentileUsec(
+	const EsifPrimStatsEntry *entryPtr,
+	UInt32 percentile
+	)
+{
+	UInt64 limitUsec = 0;
+	UInt64 target = 0;
+	UInt64 total = 0;
+	UInt64 count = 0;
+	UInt32 bucket = 0;
+
+	if ((NULL == entryPtr) || (0 == percentile)) {
+		return 0;
+	}
+
+	for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+		total += entryPtr->buckets[bucket];
+	}
+	target = ((total * esif_ccb_min(percentile, 100)) + 99) / 100;
+
+	for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+		count += entryPtr->buckets[bucket];
+		if ((count > 0) && (count >= target)) {
+			limitUsec = EsifPrimStats_GetBucketLimitUsec(bucket);
+			break;
+		}
+	}
+	return ((0 == limitUsec) || (limitUsec > entryPtr->maxUsec)) ? entryPtr->maxUsec : limitUsec;
+}
+
+
+eEsifError EsifPrimStats_Init(void)
+{
+	EsifPrimStats_Reset();
+	EsifPrimStats_SetEnabled(ESIF_TRUE);
+	return ESIF_OK;
+}
+
+
+void EsifPrimStats_Exit(void)
+{
+	EsifPrimStats_SetEnabled(ESIF_FALSE);
+}
+
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
@@ -0,0 +1,121 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "esif_ccb_rc.h"
+#include "esif_sdk_action_type.h"
+
+/*
+ * Primitive Execution Statistics
+ *
+ * Counts and times every primitive execution per participant, primitive and
+ * action type, and keeps a log2-scale latency histogram for each. The whole
+ * primitive, including action selection and fallback to later actions, is
+ * recorded under ESIF_PRIMSTATS_ALL_ACTIONS in addition to each action that
+ * was tried. Recording is lock-free so it may be done from any thread.
+ */
+
+#define ESIF_PRIMSTATS_ALL_ACTIONS	((esif_action_type_t)0)
+
+/*
+ * Bucket 0 counts latencies under 1 usec and bucket N counts latencies under
+ * 2^N usec not counted by a lower bucket. The last bucket counts everything
+ * else (>= 2^(ESIF_PRIMSTATS_BUCKETS - 2) usec).
+ */
+#define ESIF_PRIMSTATS_BUCKETS		20
+
+typedef struct EsifPrimStatsEntry_s {
+	esif_handle_t participantId;
+	UInt32 primitiveId;
+	esif_action_type_t actionType;
+	UInt64 count;
+	UInt64 errorCount;
+	UInt64 totalUsec;
+	UInt64 maxUsec;
+	UInt64 buckets[ESIF_PRIMSTATS_BUCKETS];
+} EsifPrimStatsEntry, *EsifPrimStatsEntryPtr;
+
+typedef struct EsifPrimStatsSnapshot_s {
+	UInt64 intervalMsec;	/* Time since the counters were last reset */
+	UInt64 droppedCount;	/* Executions not recorded because their entry overflowed the table */
+	UInt32 count;
+	EsifPrimStatsEntryPtr entries;	/* Sorted by participant, primitive and action type */
+} EsifPrimStatsSnapshot, *EsifPrimStatsSnapshotPtr;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard lifecycle functions */
+eEsifError EsifPrimStats_Init(void);
+void EsifPrimStats_Exit(void);
+
+Bool EsifPrimStats_IsEnabled(void);
+void EsifPrimStats_SetEnabled(Bool isEnabled);
+
+/* Records one execution; elapsedUsec is the time taken to execute */
+void EsifPrimStats_Record(
+	const esif_handle_t participantId,
+	const UInt32 primitiveId,
+	const esif_action_type_t actionType,
+	const eEsifError rc,
+	const UInt64 elapsedUsec
+	);
+
+/*
+ * Copies all entries executed since the last reset. If isReset is set, each
+ * counter is atomically exchanged with zero as it is read, so that
+ * consecutive snapshots cover adjacent intervals without losing executions
+ * recorded in between. The snapshot must be freed with
+ * EsifPrimStats_FreeSnapshot.
+ */
+eEsifError EsifPrimStats_GetSnapshot(
+	EsifPrimStatsSnapshotPtr snapshotPtr,
+	Bool isReset
+	);
+void EsifPrimStats_FreeSnapshot(EsifPrimStatsSnapshotPtr snapshotPtr);
+
+void EsifPrimStats_Reset(void);
+
+/*
+ * Frees the entries of a destroyed participant for reuse. No primitive of the
+ * participant may be executing, since its entries would be cleared for
+ * another key while they are being recorded.
+ */
+void EsifPrimStats_ReleaseParticipant(const esif_handle_t participantId);
+
+/* Returns the exclusive upper limit of a histogram bucket; 0 for the unbounded last bucket */
+UInt64 EsifPrimStats_GetBucketLimitUsec(UInt32 bucket);
+
+/*
+ * Returns an upper bound for the given percentile (1-100) of an entry's
+ * latencies, from the limit of the bucket it falls in, capped at the maximum
+ */
+UInt64 EsifPrimStats_GetPercentileUsec(
+	const EsifPrimStatsEntry *entryPtr,
+	UInt32 percentile
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
@@ -0,0 +1,534 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#define ESIF_TRACE_ID	ESIF_TRACEMODULE_DOMAIN
+
+#include "esif_uf.h"	/* Upper Framework */
+#include "esif_uf_sampler.h"
+#include "esif_participant.h"
+#include "esif_pm.h"		/* Upper Participant Manager */
+#include "esif_ccb_timer.h"
+
+#ifdef ESIF_ATTR_OS_WINDOWS
+//
+// The Windows banned-API check header must be included after all other headers, or issues can be identified
+// against Windows SDK/DDK included headers which we have no control over.
+//
+#define _SDL_BANNED_RECOMMENDED
+#include "win\banned.h"
+#endif
+
+#define ESIF_SAMPLER_MIN_CAPACITY 8
+
+typedef struct EsifSampleMember_s {
+	esif_handle_t participantId;
+	UInt16 domain;
+	EsifSampleType sampleType;
+	Bool isDropped;					/* Set in a batch copy when the domain stopped sampling */
+	EsifUpResolvedPrimitive resolved;	/* Read resolved by the last sample; reused by the next */
+} EsifSampleMember, *EsifSampleMemberPtr;
+
+/*
+ * All domains sampled with the same period. Members are kept sorted by
+ * participant so a batch visits each participant's domains consecutively.
+ * A group is unlinked and its timer killed by the batch callback that finds
+ * it empty; it is freed once no remover is waiting on its batch lock.
+ */
+typedef struct EsifSampleGroup_s {
+	struct EsifSampleGroup_s *nextPtr;
+	UInt32 periodMs;
+	esif_ccb_timer_t timer;
+	Bool isArmed;					/* Timer is set or the batch callback is running */
+	Bool isUnlinked;				/* Removed from the group list; freed when refCount drops to 0 */
+	UInt32 refCount;				/* Removers waiting on the batch lock */
+	esif_ccb_mutex_t batchLock;		/* Held while a batch is being sampled */
+	EsifSampleMemberPtr members;
+	UInt32 memberCount;
+	UInt32 memberCapacity;
+	EsifSampleMemberPtr batch;		/* Members copied at the start of a batch; batch callback only */
+	UInt32 batchCapacity;
+} EsifSampleGroup, *EsifSampleGroupPtr;
+
+typedef struct EsifSampler_s {
+	esif_ccb_lock_t lock;
+	EsifSampleGroupPtr groupsPtr;
+	Bool isEnabled;
+	UInt32 skippedSamples;			/* Samples not taken because the batch could not grow */
+} EsifSampler;
+
+static EsifSampler g_sampler = { 0 };
+
+
+static int EsifSampler_CompareMember(
+	const EsifSampleMember *leftPtr,
+	const EsifSampleMember *rightPtr
+	)
+{
+	if (leftPtr->participantId != rightPtr->participantId) {
+		return (leftPtr->participantId < rightPtr->participantId) ? -1 : 1;
+	}
+	if (leftPtr->domain != rightPtr->domain) {
+		return (leftPtr->domain < rightPtr->domain) ? -1 : 1;
+	}
+	if (leftPtr->sampleType != rightPtr->sampleType) {
+		return (leftPtr->sampleType < rightPtr->sampleType) ? -1 : 1;
+	}
+	return 0;
+}
+
+
+/* Returns the index of the member, or the index it would be inserted at if not found */
+static Bool EsifSampler_FindMemberInGroupLocked(
+	EsifSampleGroupPtr self,
+	const EsifSampleMember *keyPtr,
+	UInt32 *indexPtr
+	)
+{
+	UInt32 low = 0;
+	UInt32 high = self->memberCount;
+	UInt32 mid = 0;
+	int cmp = 0;
+
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		cmp = EsifSampler_CompareMember(&self->members[mid], keyPtr);
+		if (cmp == 0) {
+			*indexPtr = mid;
+			return ESIF_TRUE;
+		}
+		if (cmp < 0) {
+			low = mid + 1;
+		}
+		else {
+			high = mid;
+		}
+	}
+	*indexPtr = low;
+	return ESIF_FALSE;
+}
+
+
+static EsifSampleGroupPtr EsifSampler_FindMemberLocked(
+	const EsifSampleMember *keyPtr,
+	UInt32 *indexPtr
+	)
+{
+	EsifSampleGroupPtr groupPtr = NULL;
+
+	for (groupPtr = g_sampler.groupsPtr; groupPtr != NULL; groupPtr = groupPtr->nextPtr) {
+		if (EsifSampler_FindMemberInGroupLocked(groupPtr, keyPtr, indexPtr)) {
+			break;
+		}
+	}
+	return groupPtr;
+}
+
+
+static void EsifSampler_RemoveMemberLocked(
+	EsifSampleGroupPtr self,
+	UInt32 index
+	)
+{
+	if (index < self->memberCount) {
+		esif_ccb_memmove(&self->members[index],
+			&self->members[index + 1],
+			(self->memberCount - index - 1) * sizeof(*self->members));
+		self->memberCount--;
+	}
+}
+
+
+static void EsifSampler_DestroyGroup(
+	EsifSampleGroupPtr self
+	)
+{
+	if (self != NULL) {
+		esif_ccb_mutex_uninit(&self->batchLock);
+		esif_ccb_free(self->members);
+		esif_ccb_free(self->batch);
+		esif_ccb_free(self);
+	}
+}
+
+
+static void EsifSampler_UnlinkGroupLocked(
+	EsifSampleGroupPtr self
+	)
+{
+	EsifSampleGroupPtr *linkPtr = &g_sampler.groupsPtr;
+
+	while (*linkPtr != NULL) {
+		if (*linkPtr == self) {
+			*linkPtr = self->nextPtr;
+			self->nextPtr = NULL;
+			self->isUnlinked = ESIF_TRUE;
+			break;
+		}
+		linkPtr = &(*linkPtr)->nextPtr;
+	}
+}
+
+
+static void EsifSampler_BatchCallback(
+	void *ctx
+	)
+{
+	EsifSampleGroupPtr self = (EsifSampleGroupPtr)ctx;
+	EsifSampleMemberPtr memberPtr = NULL;
+	EsifSampleMemberPtr newBatch = NULL;
+	EsifUpPtr upPtr = NULL;
+	EsifUpDomainPtr domainPtr = NULL;
+	esif_handle_t lastParticipantId = ESIF_INVALID_HANDLE;
+	UInt32 count = 0;
+	UInt32 index = 0;
+	UInt32 i = 0;
+	Bool isDestroyed = ESIF_FALSE;
+
+	if (NULL == self) {
+		return;
+	}
+
+	esif_ccb_mutex_lock(&self->batchLock);
+
+	esif_ccb_write_lock(&g_sampler.lock);
+	if (!g_sampler.isEnabled) {
+		esif_ccb_write_unlock(&g_sampler.lock);
+		goto exit;
+	}
+	if (self->batchCapacity < self->memberCount) {
+		newBatch = (EsifSampleMemberPtr)esif_ccb_realloc(self->batch, self->memberCapacity * sizeof(*self->batch));
+		if (newBatch != NULL) {
+			self->batch = newBatch;
+			self->batchCapacity = self->memberCapacity;
+		}
+	}
+	count = esif_ccb_min(self->memberCount, self->batchCapacity);
+	if (count < self->memberCount) {
+		g_sampler.skippedSamples += self->memberCount - count;
+		ESIF_TRACE_ERROR("Sample group %u ms: no memory for batch; %u of %u domains not sampled (%u total skipped)\n",
+			self->periodMs,
+			self->memberCount - count,
+			self->memberCount,
+			g_sampler.skippedSamples);
+	}
+	if (count > 0) {
+		esif_ccb_memcpy(self->batch, self->members, count * sizeof(*self->batch));
+	}
+	esif_ccb_write_unlock(&g_sampler.lock);
+
+	/* Sample every member back-to-back, taking one reference per participant */
+	for (i = 0; i < count; i++) {
+		memberPtr = &self->batch[i];
+
+		if (memberPtr->participantId != lastParticipantId) {
+			if (upPtr != NULL) {
+				EsifUp_PutRef(upPtr);
+			}
+			lastParticipantId = memberPtr->participantId;
+			upPtr = EsifUpPm_GetAvailableParticipantByInstance(lastParticipantId);
+		}
+
+		domainPtr = (upPtr != NULL) ? EsifUp_GetDomainById(upPtr, memberPtr->domain) : NULL;
+		if (NULL == domainPtr) {
+			memberPtr->isDropped = ESIF_TRUE;
+			continue;
+		}
+
+		switch (memberPtr->sampleType) {
+		case ESIF_SAMPLE_TEMP:
+			memberPtr->isDropped = !EsifUpDomain_SampleTemp(domainPtr, &memberPtr->resolved);
+			break;
+		case ESIF_SAMPLE_STATE:
+			memberPtr->isDropped = !EsifUpDomain_SampleState(domainPtr, &memberPtr->resolved);
+			break;
+		default:
+			memberPtr->isDropped = ESIF_TRUE;
+			break;
+		}
+	}
+	if (upPtr != NULL) {
+		EsifUp_PutRef(upPtr);
+	}
+
+	/*
+	 * Drop members that stopped sampling, keep the resolved reads of the rest
+	 * and re-arm the timer if any remain; otherwise retire the group.
+	 */
+	esif_ccb_write_lock(&g_sampler.lock);
+	for (i = 0; i < count; i++) {
+		memberPtr = &self->batch[i];
+		if (!EsifSampler_FindMemberInGroupLocked(self, memberPtr, &index)) {
+			continue;
+		}
+		if (memberPtr->isDropped) {
+			EsifSampler_RemoveMemberLocked(self, index);
+		}
+		else {
+			self->members[index].resolved = memberPtr->resolved;
+		}
+	}
+	self->isArmed = ESIF_FALSE;
+	if (g_sampler.isEnabled) {
+		if (self->memberCount > 0) {
+			self->isArmed = (esif_ccb_timer_set_msec(&self->timer, self->periodMs) == ESIF_OK);
+		}
+		else {
+			ESIF_TRACE_DEBUG("Destroying empty sample group for period %u ms\n", self->periodMs);
+			EsifSampler_UnlinkGroupLocked(self);
+			esif_ccb_timer_kill(&self->timer); /* Completes when this callback returns */
+			isDestroyed = (0 == self->refCount);
+		}
+	}
+	esif_ccb_write_unlock(&g_sampler.lock);
+exit:
+	esif_ccb_mutex_unlock(&self->batchLock);
+
+	if (isDestroyed) {
+		EsifSampler_DestroyGroup(self);
+	}
+}
+
+
+static EsifSampleGroupPtr EsifSampler_GetGroupLocked(
+	UInt32 periodMs
+	)
+{
+	EsifSampleGroupPtr groupPtr = NULL;
+
+	for (groupPtr = g_sampler.groupsPtr; groupPtr != NULL; groupPtr = groupPtr->nextPtr) {
+		if (groupPtr->periodMs == periodMs) {
+			goto exit;
+		}
+	}
+
+	groupPtr = (EsifSampleGroupPtr)esif_ccb_malloc(sizeof(*groupPtr));
+	if (NULL == groupPtr) {
+		goto exit;
+	}
+	groupPtr->periodMs = periodMs;
+	groupPtr->isUnlinked = ESIF_FALSE;
+	groupPtr->refCount = 0;
+	esif_ccb_mutex_init(&groupPtr->batchLock);
+
+	if (esif_ccb_timer_init(&groupPtr->timer, EsifSampler_BatchCallback, groupPtr) != ESIF_OK) {
+		esif_ccb_mutex_uninit(&groupPtr->batchLock);
+		esif_ccb_free(groupPtr);
+		groupPtr = NULL;
+		goto exit;
+	}
+
+	groupPtr->nextPtr = g_sampler.groupsPtr;
+	g_sampler.groupsPtr = groupPtr;
+	ESIF_TRACE_DEBUG("Created sample group for period %u ms\n", periodMs);
+exit:
+	return groupPtr;
+}
+
+
+static eEsifError EsifSampler_InsertMemberLocked(
+	EsifSampleGroupPtr self,
+	const EsifSampleMember *memberPtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifSampleMemberPtr newMembers = NULL;
+	UInt32 newCapacity = 0;
+	UInt32 index = 0;
+
+	if (EsifSampler_FindMemberInGroupLocked(self, memberPtr, &index)) {
+		goto exit;
+	}
+
+	if (self->memberCount >= self->memberCapacity) {
+		newCapacity = esif_ccb_max(ESIF_SAMPLER_MIN_CAPACITY, self->memberCapacity * 2);
+		newMembers = (EsifSampleMemberPtr)esif_ccb_realloc(self->members, newCapacity * sizeof(*newMembers));
+		if (NULL == newMembers) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+		self->members = newMembers;
+		self->memberCapacity = newCapacity;
+	}
+
+	esif_ccb_memmove(&self->members[index + 1],
+		&self->members[index],
+		(self->memberCount - index) * sizeof(*self->members));
+	self->members[index] = *memberPtr;
+	self->memberCount++;
+
+	if (!self->isArmed) {
+		rc = esif_ccb_timer_set_msec(&self->timer, self->periodMs);
+		self->isArmed = (ESIF_OK == rc);
+	}
+exit:
+	return rc;
+}
+
+
+eEsifError EsifSampler_AddDomain(
+	EsifUpDomainPtr domainPtr,
+	EsifSampleType sampleType,
+	UInt32 periodMs
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifSampleMember member = { 0 };
+	EsifSampleGroupPtr curGroupPtr = NULL;
+	EsifSampleGroupPtr groupPtr = NULL;
+	EsifSampleGroupPtr orphanPtr = NULL;
+	UInt32 index = 0;
+
+	if (NULL == domainPtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+	if ((0 == periodMs) || (sampleType >= ESIF_SAMPLE_TYPE_MAX)) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+		goto exit;
+	}
+
+	member.participantId = domainPtr->participantId;
+	member.domain = domainPtr->domain;
+	member.sampleType = sampleType;
+
+	esif_ccb_write_lock(&g_sampler.lock);
+
+	if (!g_sampler.isEnabled) {
+		rc = ESIF_E_NOT_INITIALIZED;
+		goto lockExit;
+	}
+
+	curGroupPtr = EsifSampler_FindMemberLocked(&member, &index);
+	if ((curGroupPtr != NULL) && (curGroupPtr->periodMs == periodMs)) {
+		goto lockExit;
+	}
+
+	groupPtr = EsifSampler_GetGroupLocked(periodMs);
+	if (NULL == groupPtr) {
+		rc = ESIF_E_NO_MEMORY;
+		goto lockExit;
+	}
+
+	rc = EsifSampler_InsertMemberLocked(groupPtr, &member);
+	if ((ESIF_OK == rc) && (curGroupPtr != NULL)) {
+		EsifSampler_RemoveMemberLocked(curGroupPtr, index);
+	}
+
+	/* A group left empty with no timer armed has no callback to retire it */
+	orphanPtr = (ESIF_OK == rc) ? curGroupPtr : groupPtr;
+	if ((orphanPtr != NULL) && (0 == orphanPtr->memberCount) && !orphanPtr->isArmed) {
+		EsifSampler_UnlinkGroupLocked(orphanPtr);
+	}
+	else {
+		orphanPtr = NULL;
+	}
+lockExit:
+	esif_ccb_write_unlock(&g_sampler.lock);
+
+	if (orphanPtr != NULL) {
+		esif_ccb_timer_kill_w_wait(&orphanPtr->timer);
+		EsifSampler_DestroyGroup(orphanPtr);
+	}
+exit:
+	return rc;
+}
+
+
+eEsifError EsifSampler_RemoveDomain(
+	EsifUpDomainPtr domainPtr,
+	EsifSampleType sampleType
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifSampleMember member = { 0 };
+	EsifSampleGroupPtr groupPtr = NULL;
+	UInt32 index = 0;
+	Bool isDestroyed = ESIF_FALSE;
+
+	if (NULL == domainPtr) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	member.participantId = domainPtr->participantId;
+	member.domain = domainPtr->domain;
+	member.sampleType = sampleType;
+
+	esif_ccb_write_lock(&g_sampler.lock);
+	groupPtr = EsifSampler_FindMemberLocked(&member, &index);
+	if (groupPtr != NULL) {
+		EsifSampler_RemoveMemberLocked(groupPtr, index);
+		groupPtr->refCount++;
+	}
+	esif_ccb_write_unlock(&g_sampler.lock);
+
+	/* Wait out a batch that may still be sampling the domain */
+	if (groupPtr != NULL) {
+		esif_ccb_mutex_lock(&groupPtr->batchLock);
+		esif_ccb_mutex_unlock(&groupPtr->batchLock);
+
+		esif_ccb_write_lock(&g_sampler.lock);
+		groupPtr->refCount--;
+		isDestroyed = (groupPtr->isUnlinked && (0 == groupPtr->refCount));
+		esif_ccb_write_unlock(&g_sampler.lock);
+
+		if (isDestroyed) {
+			EsifSampler_DestroyGroup(groupPtr);
+		}
+	}
+exit:
+	return rc;
+}
+
+
+eEsifError EsifSampler_Init(void)
+{
+	esif_ccb_lock_init(&g_sampler.lock);
+	g_sampler.groupsPtr = NULL;
+	g_sampler.isEnabled = ESIF_TRUE;
+	g_sampler.skippedSamples = 0;
+	return ESIF_OK;
+}
+
+
+void EsifSampler_Exit(void)
+{
+	EsifSampleGroupPtr groupPtr = NULL;
+	EsifSampleGroupPtr nextPtr = NULL;
+
+	esif_ccb_write_lock(&g_sampler.lock);
+	g_sampler.isEnabled = ESIF_FALSE;
+	groupPtr = g_sampler.groupsPtr;
+	g_sampler.groupsPtr = NULL;
+	esif_ccb_write_unlock(&g_sampler.lock);
+
+	while (groupPtr != NULL) {
+		nextPtr = groupPtr->nextPtr;
+
+		esif_ccb_timer_kill_w_wait(&groupPtr->timer);
+		EsifSampler_DestroyGroup(groupPtr);
+
+		groupPtr = nextPtr;
+	}
+
+	esif_ccb_lock_uninit(&g_sampler.lock);
+}
+
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
@@ -0,0 +1,75 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+#pragma once
+
+#include "esif_ccb_rc.h"
+#include "esif_uf_domain.h"
+
+/*
+ * Domain Sampler
+ *
+ * Domains that are polled with the same period are grouped into a single
+ * batch which is serviced by one timer. Each time the timer fires, every
+ * member of the batch is sampled back-to-back on the timer thread, reusing
+ * the participant reference for consecutive domains of the same participant,
+ * and the results are handed to the domain threshold/state check logic.
+ */
+
+typedef enum EsifSampleType_e {
+	ESIF_SAMPLE_TEMP = 0,	/* Temperature threshold polling */
+	ESIF_SAMPLE_STATE,		/* Perf state capability polling */
+	ESIF_SAMPLE_TYPE_MAX
+} EsifSampleType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Standard lifecycle functions */
+eEsifError EsifSampler_Init(void);
+void EsifSampler_Exit(void);
+
+/*
+ * Adds the domain to the batch for the given period, moving it from any
+ * batch it is currently in. The first sample is taken on the next firing of
+ * the batch timer.
+ */
+eEsifError EsifSampler_AddDomain(
+	EsifUpDomainPtr domainPtr,
+	EsifSampleType sampleType,
+	UInt32 periodMs
+	);
+
+/*
+ * Removes the domain from its batch. On return, the domain is not being
+ * sampled and will not be sampled again until re-added.
+ */
+eEsifError EsifSampler_RemoveDomain(
+	EsifUpDomainPtr domainPtr,
+	EsifSampleType sampleType
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+/*****************************************************************************/
+/*****************************************************************************/
+/*****************************************************************************/
@@ -238,6 +238,109 @@ exit:
 	return rc;
 }
 
+/* Resolve a primitive once and return a handle for repeated execution */
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveBind(
+	const esif_handle_t esifHandle,
+	const esif_handle_t participantId,
+	const esif_handle_t domainHandle,
+	const ePrimitiveType primitive,
+	const UInt8 instance,
+	esif_handle_t *primitiveHandlePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifAppPtr appPtr = NULL;
+
+	if (NULL == primitiveHandlePtr) {
+		ESIF_TRACE_ERROR("Invalid primitive handle pointer\n");
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+	*primitiveHandlePtr = ESIF_INVALID_HANDLE;
+
+	appPtr = EsifAppMgr_GetAppFromHandle(esifHandle);
+	if (NULL == appPtr) {
+		ESIF_TRACE_ERROR("The app was not found from handle\n");
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	rc = EsifApp_BindPrimitive(appPtr, participantId, domainHandle, primitive, instance, primitiveHandlePtr);
+
+	ESIF_TRACE_DEBUG("Bound %s(%u) instance %u for participant " ESIF_HANDLE_FMT " domain " ESIF_HANDLE_FMT " to " ESIF_HANDLE_FMT "; status %s(%d)\n",
+		esif_primitive_str((enum esif_primitive_type)primitive), primitive,
+		instance,
+		esif_ccb_handle2llu(participantId),
+		esif_ccb_handle2llu(domainHandle),
+		esif_ccb_handle2llu(*primitiveHandlePtr),
+		esif_rc_str(rc), rc);
+exit:
+	EsifAppMgr_PutRef(appPtr);
+	return rc;
+}
+
+/* Execute a primitive previously resolved by EsifSvcPrimitiveBind */
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveExecBound(
+	const esif_handle_t esifHandle,
+	const esif_handle_t primitiveHandle,
+	const EsifDataPtr requestPtr,
+	EsifDataPtr responsePtr
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifAppPtr appPtr = NULL;
+	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	EsifPrimitiveTuple tuple = { 0 };
+
+	if (NULL == requestPtr) {
+		ESIF_TRACE_ERROR("Invalid request buffer pointer\n");
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	if (NULL == responsePtr) {
+		ESIF_TRACE_ERROR("Invalid response buffer pointer\n");
+		return ESIF_E_PARAMETER_IS_NULL;
+	}
+
+	appPtr = EsifAppMgr_GetAppFromHandle(esifHandle);
+	if (NULL == appPtr) {
+		ESIF_TRACE_ERROR("The app was not found from handle\n");
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	rc = EsifApp_GetBoundPrimitive(appPtr, primitiveHandle, &participantId, &tuple);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	rc = EsifArbMgr_ExecuteTuplePrimitive(esifHandle, participantId, &tuple, requestPtr, responsePtr);
+exit:
+	EsifAppMgr_PutRef(appPtr);
+	return rc;
+}
+
+/* Release a handle returned by EsifSvcPrimitiveBind */
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveUnbind(
+	const esif_handle_t esifHandle,
+	const esif_handle_t primitiveHandle
+	)
+{
+	eEsifError rc = ESIF_OK;
+	EsifAppPtr appPtr = NULL;
+
+	appPtr = EsifAppMgr_GetAppFromHandle(esifHandle);
+	if (NULL == appPtr) {
+		ESIF_TRACE_ERROR("The app was not found from handle\n");
+		rc = ESIF_E_INVALID_HANDLE;
+		goto exit;
+	}
+
+	rc = EsifApp_UnbindPrimitive(appPtr, primitiveHandle);
+exit:
+	EsifAppMgr_PutRef(appPtr);
+	return rc;
+}
+
 /* Provide write access to ESIF log object */
 eEsifError ESIF_CALLCONV EsifSvcWriteLog(
 	const esif_handle_t esifHandle,
@@ -45,6 +45,21 @@ eEsifError ESIF_CALLCONV EsifSvcPrimitiveExec(const esif_handle_t esifHandle,
 								const ePrimitiveType primitive,
 								const UInt8 instance);
 
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveBind(const esif_handle_t esifHandle,
+								const esif_handle_t participantId,
+								const esif_handle_t domainId,
+								const ePrimitiveType primitive,
+								const UInt8 instance,
+								esif_handle_t *primitiveHandlePtr);
+
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveExecBound(const esif_handle_t esifHandle,
+								const esif_handle_t primitiveHandle,
+								const EsifDataPtr requestPtr,
+								EsifDataPtr responsePtr);
+
+eEsifError ESIF_CALLCONV EsifSvcPrimitiveUnbind(const esif_handle_t esifHandle,
+								const esif_handle_t primitiveHandle);
+
 eEsifError ESIF_CALLCONV EsifSvcWriteLog(const esif_handle_t esifHandle,
 						   const esif_handle_t participantId,
 						   const esif_handle_t domainId,
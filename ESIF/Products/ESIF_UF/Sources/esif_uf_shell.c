@@ -44,6 +44,7 @@
 #include "esif_cpc.h"		/* Compact Primitive Catalog */
 #include "esif_uf_ccb_thermalapi.h"
 #include "esif_uf_loggingmgr.h"
+#include "esif_uf_primstats.h"
 
 // SDK
 #include "esif_sdk_capability_type.h" /* For Capability Id Description*/
@@ -132,17 +133,15 @@ char *g_dstName = NULL;
 // StopWatch
 struct timeval g_timer = {0};
 
-enum output_format g_format = FORMAT_TEXT;
 int g_shell_enabled = 0;	// user shell enabled?
 int g_shell_stopped = 0;    // Used to stop shell processing when exiting ESIF
 int g_cmdshell_enabled = 1;	// "!cmd" type shell commands enabled (if shell enabled)?
-static UInt8 g_isRest = 0;
+#define g_isRest	(esif_shell_ctx()->isRest)	// Executing a REST API Command in the current Shell Execution Context?
 
 //
 // NOT Declared In Header Only This Module Should Use These
 //
 int g_binary_buf_size = 4096;	// Buffer Size
-extern int g_errorlevel;	// Exit Errorlevel
 extern int g_quit;			// Quit Application?
 extern int g_disconnectClient;	// Disconnect shell client
 int g_repeat = 1;		// Repeat N Times
@@ -156,15 +155,33 @@ static const char *g_shellStartScript = NULL;
 
 static eEsifError esif_shell_get_participant_id(char *participantNameOrId, esif_handle_t *targetParticipantIdPtr);
 
-// Global Shell lock to limit parse_cmd to one thread at a time
-static esif_ccb_mutex_t g_shellLock;
+// Global Shell lock to limit parse_cmd to one thread at a time, except for read-only
+// commands executed in their own Shell Execution Context, which share the lock.
+// Locks may be nested, so the nesting depth of shared and exclusive holds is tracked for each thread.
+static esif_ccb_lock_t g_shellLock;
+static ESIF_THREAD_LOCAL int g_shellLockDepth = 0;
 static esif_ccb_event_t g_shellStopEvent = { 0 };
 
-// ESIF Global Shell Output Buffer
-char *g_outbuf = NULL;						// Dynamically created and can grow
-UInt32 g_outbuf_len = OUT_BUF_LEN_DEFAULT;	// Current (or Default) Size of ESIF Shell Output Buffer
-
-size_t g_cmdlen = 0;
+// Default Shell Execution Context, used by all threads with no bound context
+static EsifShellCtx g_shellDefaultCtx = { NULL, OUT_BUF_LEN_DEFAULT, FORMAT_TEXT, 0, 0, 0 };
+static ESIF_THREAD_LOCAL EsifShellCtxPtr g_shellBoundCtx = NULL;
+
+#define g_cmdlen	(esif_shell_ctx()->cmdlen)
+
+// Commands that only read state and may run concurrently in separate Shell Execution Contexts.
+// Commands that change state or run nested commands that do (such as "participant create") must not be listed.
+// NOTE: This list must be sorted alphabetically so we can do a binary search
+static const char *g_shellConcurrentCmds[] = {
+	"about",
+	"apps",
+	"devices",
+	"echo",
+	"format",
+	"getp_part",
+	"participants",
+	"primstats",
+	"status",
+};
 
 #define SHELL_OUT(msg, ...)	esif_ccb_sprintf_concat(OUT_BUF_LEN, output, msg, ##__VA_ARGS__)
 
@@ -611,19 +628,20 @@ esif_error_t CreateParticipantFromJson(esif_string jsonStr)
 					// Create Dynamic Participant
 					if (IString_DataLen(cmd) > 0) {
 						char *output = esif_shell_exec_command(IString_GetString(cmd), IString_BufLen(cmd) + 1, ESIF_FALSE, ESIF_TRUE);
+						// The UF participant table grows as needed, so a failure here is not a capacity limit
 						if (output && esif_ccb_strstr(output, "ESIF_E_") != NULL) {
-							rc = (EsifUpPm_ParticipantCount() >= MAX_PARTICIPANT_ENTRY ? ESIF_E_MAXIMUM_CAPACITY_REACHED : ESIF_E_NO_CREATE);
+							rc = ESIF_E_NO_CREATE;
 						}
 						else if (!EsifUpPm_DoesAvailableParticipantExistByName(name)) {
 							// Conjured Participants are created synchronously, so if it doesn't exist by now, it failed.
 							if (enum_type == ESIF_PARTICIPANT_ENUM_CONJURE) {
-								rc = (EsifUpPm_ParticipantCount() >= MAX_PARTICIPANT_ENTRY ? ESIF_E_MAXIMUM_CAPACITY_REACHED : ESIF_E_NO_CREATE);
+								rc = ESIF_E_NO_CREATE;
 							}
 							// Kernel Participants are created in the kernel synchronously, but are sent to the UF asynchronously,
-							// so if it doesn't exist by now, it may not have arrived yet, so return ESIF_OK unless PM is full
+							// so if it doesn't exist by now, it may not have arrived yet, so return ESIF_I_AGAIN
 							// and the UI can decide whether to check again later or just assume that it worked.
 							else {
-								rc = (EsifUpPm_ParticipantCount() >= MAX_PARTICIPANT_ENTRY ? ESIF_E_MAXIMUM_CAPACITY_REACHED : ESIF_I_AGAIN);
+								rc = ESIF_I_AGAIN;
 							}
 						}
 					}
@@ -786,7 +804,7 @@ esif_error_t DestroyDynamicParticipants()
 // Init Shell
 eEsifError esif_uf_shell_init()
 {
-	esif_ccb_mutex_init(&g_shellLock);
+	esif_ccb_lock_init(&g_shellLock);
 
 	esif_ccb_event_init(&g_shellStopEvent);
 	esif_ccb_event_set(&g_shellStopEvent);
@@ -808,9 +826,9 @@ void esif_uf_shell_exit()
 	esif_ccb_free(g_dstName);
 
 	esif_ccb_event_uninit(&g_shellStopEvent);
-	esif_ccb_mutex_uninit(&g_shellLock);
-	esif_ccb_free(g_outbuf);
-	g_outbuf = NULL;
+	esif_ccb_lock_uninit(&g_shellLock);
+	esif_ccb_free(g_shellDefaultCtx.outbuf);
+	g_shellDefaultCtx.outbuf = NULL;
 }
 
 void esif_uf_shell_stop()
@@ -822,13 +840,121 @@ void esif_uf_shell_stop()
 // Exclusively Lock Shell
 void esif_uf_shell_lock()
 {
-	esif_ccb_mutex_lock(&g_shellLock);
+	if (g_shellLockDepth++ == 0) {
+		esif_ccb_write_lock(&g_shellLock);
+	}
 }
 
 // Unlock Lock Shell
 void esif_uf_shell_unlock()
 {
-	esif_ccb_mutex_unlock(&g_shellLock);
+	if (g_shellLockDepth > 0 && --g_shellLockDepth == 0) {
+		esif_ccb_write_unlock(&g_shellLock);
+	}
+}
+
+// Shell Execution Context bound to the current thread, or the Default Context
+EsifShellCtxPtr esif_shell_ctx(void)
+{
+	return (g_shellBoundCtx ? g_shellBoundCtx : &g_shellDefaultCtx);
+}
+
+// Create a Shell Execution Context. Its Output Buffer is created on first use.
+EsifShellCtxPtr esif_shell_ctx_create(void)
+{
+	EsifShellCtxPtr self = (EsifShellCtxPtr)esif_ccb_malloc(sizeof(*self));
+	if (self) {
+		self->outbuf = NULL;
+		self->outbuf_len = OUT_BUF_LEN_DEFAULT;
+		self->format = FORMAT_TEXT;
+		self->isRest = 0;
+		self->cmdlen = 0;
+		self->errorlevel = 0;
+	}
+	return self;
+}
+
+// Destroy a Shell Execution Context, which must not be bound to any thread
+void esif_shell_ctx_destroy(EsifShellCtxPtr self)
+{
+	if (self && self != &g_shellDefaultCtx) {
+		esif_ccb_free(self->outbuf);
+		esif_ccb_free(self);
+	}
+}
+
+// Bind a Shell Execution Context to the current thread (NULL = Default) and return the previous one
+EsifShellCtxPtr esif_shell_ctx_bind(EsifShellCtxPtr self)
+{
+	EsifShellCtxPtr prevCtx = g_shellBoundCtx;
+	g_shellBoundCtx = (self == &g_shellDefaultCtx ? NULL : self);
+	return prevCtx;
+}
+
+// Execute a Shell Command in the given Shell Execution Context. Results are in the context's Output Buffer.
+char *esif_shell_ctx_exec_command(
+	EsifShellCtxPtr self,
+	const char *line,
+	size_t buf_len,
+	UInt8 isRest
+	)
+{
+	char *result = NULL;
+	EsifShellCtxPtr prevCtx = esif_shell_ctx_bind(self);
+	result = esif_shell_exec_command(line, buf_len, isRest, ESIF_FALSE);
+	esif_shell_ctx_bind(prevCtx);
+	return result;
+}
+
+// Is every command in a command line one that may run concurrently with other read-only commands?
+static Bool esif_shell_is_concurrent_cmd(const char *line)
+{
+	const char *separators[] = { "\n", " && " };
+	const char *cmd = line;
+	Bool result = ESIF_TRUE;
+
+	while (result && cmd && *cmd) {
+		char cmd_name[ESIF_NAME_LEN] = { 0 };
+		const char *next = NULL;
+		int start = 0, end = ESIF_ARRAY_LEN(g_shellConcurrentCmds) - 1, node = 0;
+		size_t j = 0;
+
+		// Extract Command Name
+		while (*cmd && isspace((unsigned char)*cmd)) {
+			cmd++;
+		}
+		for (j = 0; j < sizeof(cmd_name) - 1 && cmd[j] && !isspace((unsigned char)cmd[j]); j++) {
+			cmd_name[j] = cmd[j];
+		}
+
+		// Binary search of concurrent commands
+		result = ESIF_FALSE;
+		while (cmd_name[0] && start <= end) {
+			int comp = 0;
+			node = (end - start) / 2 + start;
+			comp = esif_ccb_stricmp(cmd_name, g_shellConcurrentCmds[node]);
+			if (comp == 0) {
+				result = ESIF_TRUE;
+				break;
+			}
+			else if (comp > 0) {
+				start = node + 1;
+			}
+			else {
+				end = node - 1;
+			}
+		}
+
+		// Find next command, if any. Separators in quoted strings are treated as separators, which is conservative.
+		for (j = 0; j < ESIF_ARRAY_LEN(separators); j++) {
+			const char *sep = esif_ccb_strstr(cmd, separators[j]);
+			if (sep && (next == NULL || sep < next)) {
+				next = sep + esif_ccb_strlen(separators[j], MAX_LINE);
+			}
+		}
+		cmd = next;
+	}
+	return result;
 }
 
 // Resize ESIF Shell Buffer if necessary
@@ -1133,6 +1259,47 @@ static char *esif_shell_cmd_dsps(EsifShellCmdPtr shell)
 }
 
 
+static char *esif_shell_cmd_dspstats(EsifShellCmdPtr shell)
+{
+	char *output = shell->outbuf;
+	EsifDspLookupStats stats = { 0 };
+	u8 i = 0;
+
+	// dspstats
+	esif_ccb_sprintf(OUT_BUF_LEN, output,
+		"\nDSP LOOKUP TABLES:\n\n"
+		"                Algorithms    Events        Primitive Hash                Event GUID Hash\n"
+		"ID DSP PACKAGE  Count Indexed Count Indexed Size Items Used Coll MaxChain Size Items Used Coll MaxChain\n"
+		"-- ------------ ----- ------- ----- ------- ---- ----- ---- ---- -------- ---- ----- ---- ---- --------\n");
+
+	for (i = 0; i < g_dm.dme_count; i++) {
+		if (EsifDspMgr_GetLookupStats(i, &stats) != ESIF_OK) {
+			continue;
+		}
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+			"%02u %-12s %5u %7u %5u %7u %4u %5u %4u %4u %8u %4u %5u %4u %4u %8u\n",
+			i,
+			stats.code,
+			stats.numAlgorithms,
+			stats.numAlgorithmsIndexed,
+			stats.numEvents,
+			stats.numEventsIndexed,
+			stats.primitiveStats.size,
+			stats.primitiveStats.items,
+			stats.primitiveStats.used_buckets,
+			stats.primitiveStats.collisions,
+			stats.primitiveStats.max_chain,
+			stats.eventGuidStats.size,
+			stats.eventGuidStats.items,
+			stats.eventGuidStats.used_buckets,
+			stats.eventGuidStats.collisions,
+			stats.eventGuidStats.max_chain);
+	}
+	esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	return output;
+}
+
+
 static char *esif_shell_cmd_conjures(EsifShellCmdPtr shell)
 {
 	int argc     = shell->argc;
@@ -1913,6 +2080,86 @@ static char *esif_shell_cmd_events(EsifShellCmdPtr shell)
 	return output;
 }
 
+static char *esif_shell_cmd_eventstats(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	EsifEventQueueStats stats = { 0 };
+
+	// eventstats [reset]
+	if (argc > 1 && esif_ccb_stricmp(argv[1], "reset") == 0) {
+		EsifEventMgr_ResetQueueStats();
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "Event queue statistics reset\n");
+		return output;
+	}
+
+	if (EsifEventMgr_GetQueueStats(&stats) != ESIF_OK) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "Event queue statistics unavailable\n");
+		return output;
+	}
+
+	esif_ccb_sprintf(OUT_BUF_LEN, output,
+		"\nEVENT QUEUE STATISTICS:\n\n"
+		"Capacity        : %u\n"
+		"Depth           : %u\n"
+		"High-Water Mark : %u\n"
+		"Enqueued        : %llu\n"
+		"Dispatched      : %llu\n"
+		"Dropped         : %llu\n"
+		"Latency (usec)  : min=%llu avg=%llu max=%llu\n"
+		"Payloads        : inline=%llu slab=%llu heap=%llu\n\n",
+		stats.queue.capacity,
+		stats.queue.depth,
+		stats.queue.high_water,
+		(unsigned long long)stats.queue.enqueued,
+		(unsigned long long)stats.queue.dequeued,
+		(unsigned long long)stats.queue.drops,
+		(unsigned long long)stats.latencyMinUsec,
+		(unsigned long long)stats.latencyAvgUsec,
+		(unsigned long long)stats.latencyMaxUsec,
+		(unsigned long long)stats.inlinePayloads,
+		(unsigned long long)stats.slabPayloads,
+		(unsigned long long)stats.heapPayloads);
+	return output;
+}
+
+static char *esif_shell_cmd_eventworkers(EsifShellCmdPtr shell)
+{
+	char *output = shell->outbuf;
+	EsifEventWorkerStats stats = { 0 };
+	UInt32 count = EsifEventMgr_GetWorkerCount();
+	UInt32 i;
+
+	// eventworkers
+	esif_ccb_sprintf(OUT_BUF_LEN, output,
+		"\nEVENT WORKERS: %u\n\n"
+		"ID State Depth  HWM    Capacity Dispatched   Dropped    Last(us)   Min(us)    Avg(us)    Max(us)\n"
+		"-- ----- ------ ------ -------- ------------ ---------- ---------- ---------- ---------- ----------\n",
+		count);
+
+	for (i = 0; i < count; i++) {
+		if (EsifEventMgr_GetWorkerStats(i, &stats) != ESIF_OK) {
+			continue;
+		}
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+			"%2u %-5s %6u %6u %8u %12llu %10llu %10llu %10llu %10llu %10llu\n",
+			i,
+			(stats.isBusy ? "busy" : "idle"),
+			stats.queue.depth,
+			stats.queue.high_water,
+			stats.queue.capacity,
+			(unsigned long long)stats.queue.dequeued,
+			(unsigned long long)stats.queue.drops,
+			(unsigned long long)stats.lastLatencyUsec,
+			(unsigned long long)stats.latencyMinUsec,
+			(unsigned long long)stats.latencyAvgUsec,
+			(unsigned long long)stats.latencyMaxUsec);
+	}
+	esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	return output;
+}
+
 static char *esif_shell_cmd_appstart(EsifShellCmdPtr shell)
 {
 	int argc = shell->argc;
@@ -2115,6 +2362,7 @@ static char *esif_shell_cmd_arb(EsifShellCmdPtr shell)
 			"  arb delete  <partname> <primitive> [<instance>]\n"
 			"  arb enable  [<partname> [<primitive> [<instance>]]]\n"
 			"  arb disable [<partname> [<primitive> [<instance>]]]\n"
+			"  arb workers\n"
 			"Where <param>=<value> is:\n"
 			"  type=<arbtype>\n"
 			"  upper=<upperLimit>\n"
@@ -2287,6 +2535,45 @@ static char *esif_shell_cmd_arb(EsifShellCmdPtr shell)
 			rc = EsifArbMgr_SetArbitrationState(participantId, primitive, domain, instance, ESIF_FALSE);
 		}
 	}
+	// arb workers
+	else if (esif_ccb_stricmp(command, "workers") == 0) {
+		EsifArbWorkerStats stats = { 0 };
+		UInt32 workerCount = EsifArbMgr_GetWorkerCount();
+		UInt32 index = 0;
+
+		if (participantId != ESIF_INVALID_HANDLE || nparams) {
+			rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+		}
+		else if (0 == workerCount) {
+			rc = ESIF_E_NOT_SUPPORTED;
+		}
+		else {
+			esif_ccb_sprintf(OUT_BUF_LEN, output,
+				"\nArbitrated Primitive Workers: %u\n\n"
+				"ID  Depth  MaxDepth  Queued      Executed    Failed      MinUsec   MaxUsec   AvgUsec   LastUsec\n"
+				"--  -----  --------  ----------  ----------  ----------  --------  --------  --------  --------\n",
+				workerCount);
+
+			for (index = 0; index < workerCount; index++) {
+				if (EsifArbMgr_GetWorkerStats(index, &stats) != ESIF_OK) {
+					continue;
+				}
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+					"%2u  %5llu  %8llu  %10llu  %10llu  %10llu  %8llu  %8llu  %8llu  %8llu\n",
+					index,
+					(unsigned long long)stats.depth,
+					(unsigned long long)stats.maxDepth,
+					(unsigned long long)stats.queuedCount,
+					(unsigned long long)stats.executedCount,
+					(unsigned long long)stats.failedCount,
+					(unsigned long long)stats.latencyMinUsec,
+					(unsigned long long)stats.latencyMaxUsec,
+					(unsigned long long)stats.latencyAvgUsec,
+					(unsigned long long)stats.lastLatencyUsec);
+			}
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+		}
+	}
 	else {
 		rc = ESIF_E_COMMAND_DATA_INVALID;
 	}
@@ -4677,6 +4964,266 @@ exit:
 	return output;
 }
 
+// Returns the action type name without its ESIF_ACTION_ prefix
+static esif_string esif_shell_primstats_action_str(esif_action_type_t actionType)
+{
+	if (ESIF_PRIMSTATS_ALL_ACTIONS == actionType) {
+		return "ALL";
+	}
+	return ltrim(esif_action_type_str(actionType), PREFIX_ACTION_TYPE);
+}
+
+static char *esif_shell_cmd_primstats(EsifShellCmdPtr shell)
+{
+	int argc = shell->argc;
+	char **argv = shell->argv;
+	char *output = shell->outbuf;
+	esif_error_t rc = ESIF_OK;
+	esif_string command = "show";
+	esif_string partname = NULL;
+	EsifUpPtr upPtr = NULL;
+	esif_handle_t participantId = ESIF_INVALID_HANDLE;
+	esif_handle_t namedParticipantId = ESIF_INVALID_HANDLE;
+	char name[ESIF_NAME_LEN] = { 0 };
+	EsifPrimStatsSnapshot snapshot = { 0 };
+	EsifPrimStatsEntryPtr entryPtr = NULL;
+	Bool isHistogram = ESIF_FALSE;
+	Bool isReset = ESIF_FALSE;
+	size_t entryLen = 0;
+	size_t buf_len = 0;
+	UInt64 avgUsec = 0;
+	UInt64 limitUsec = 0;
+	UInt32 index = 0;
+	UInt32 bucket = 0;
+
+	*output = 0;
+
+	// primstats [<command>] ...
+	if (argc > 1) {
+		command = argv[1];
+	}
+
+	if (esif_ccb_stricmp(command, "help") == 0) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"Usage:\n"
+			"  primstats [show] [<partname>]        Show primitive execution counters and latencies\n"
+			"  primstats histogram [<partname>]     Also show the latency histogram of each entry\n"
+			"  primstats snapshot                   Show all counters and reset them in the same pass\n"
+			"  primstats reset                      Reset all counters\n"
+			"  primstats on|off                     Enable or disable collection\n"
+			"Entries are per participant, primitive and action type. Action ALL times the whole\n"
+			"primitive, including any actions which failed before one succeeded.\n"
+			"Latencies are in usec. Percentiles are the upper limit of the histogram bucket they\n"
+			"fall in, which doubles from one bucket to the next.\n");
+		goto exit;
+	}
+	else if ((esif_ccb_stricmp(command, "on") == 0) || (esif_ccb_stricmp(command, "off") == 0)) {
+		if (argc > 2) {
+			rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+			goto exit;
+		}
+		EsifPrimStats_SetEnabled(esif_ccb_stricmp(command, "on") == 0);
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "primstats %s\n", EsifPrimStats_IsEnabled() ? "on" : "off");
+		goto exit;
+	}
+	else if (esif_ccb_stricmp(command, "reset") == 0) {
+		if (argc > 2) {
+			rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+			goto exit;
+		}
+		EsifPrimStats_Reset();
+		esif_ccb_sprintf(OUT_BUF_LEN, output, "primstats reset\n");
+		goto exit;
+	}
+	else if (esif_ccb_stricmp(command, "snapshot") == 0) {
+		if (argc > 2) {
+			rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+			goto exit;
+		}
+		isReset = ESIF_TRUE;
+	}
+	else if (esif_ccb_stricmp(command, "histogram") == 0) {
+		isHistogram = ESIF_TRUE;
+	}
+	else if (esif_ccb_stricmp(command, "show") != 0) {
+		rc = ESIF_E_COMMAND_DATA_INVALID;
+		goto exit;
+	}
+
+	// primstats show|histogram [<partname>]
+	if (argc > 3) {
+		rc = ESIF_E_INVALID_ARGUMENT_COUNT;
+		goto exit;
+	}
+	if (argc > 2) {
+		partname = argv[2];
+		upPtr = EsifUpPm_GetAvailableParticipantByName(partname);
+		if (NULL == upPtr) {
+			rc = ESIF_E_PARTICIPANT_NOT_FOUND;
+			goto exit;
+		}
+		participantId = EsifUp_GetInstance(upPtr);
+		EsifUp_PutRef(upPtr);
+		upPtr = NULL;
+	}
+
+	rc = EsifPrimStats_GetSnapshot(&snapshot, isReset);
+	if (rc != ESIF_OK) {
+		goto exit;
+	}
+
+	// Each histogram bucket adds about 16 characters of text or 64 of XML to an entry
+	entryLen = (FORMAT_XML == g_format) ? 640 + (ESIF_PRIMSTATS_BUCKETS * 64) : 160;
+	if (isHistogram) {
+		entryLen += ESIF_PRIMSTATS_BUCKETS * 16;
+	}
+	buf_len = ((size_t)snapshot.count * entryLen) + 1024;
+	if (buf_len > OUT_BUF_LEN) {
+		output = shell->outbuf = esif_shell_resize(buf_len);
+		if (NULL == output) {
+			rc = ESIF_E_NO_MEMORY;
+			goto exit;
+		}
+	}
+
+	if (FORMAT_XML == g_format) {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"<primstats>\n"
+			"  <enabled>%d</enabled>\n"
+			"  <intervalMsec>%llu</intervalMsec>\n"
+			"  <dropped>%llu</dropped>\n",
+			EsifPrimStats_IsEnabled(),
+			(unsigned long long)snapshot.intervalMsec,
+			(unsigned long long)snapshot.droppedCount);
+	}
+	else {
+		esif_ccb_sprintf(OUT_BUF_LEN, output,
+			"\nPrimitive Execution Statistics (%s): %llu ms, %u entries, %llu dropped\n\n"
+			"Participant  Primitive                                 Action          Count       Errors      AvgUsec   P50Usec   P99Usec   MaxUsec\n"
+			"-----------  ----------------------------------------  --------------  ----------  ----------  --------  --------  --------  --------\n",
+			EsifPrimStats_IsEnabled() ? "on" : "off",
+			(unsigned long long)snapshot.intervalMsec,
+			snapshot.count,
+			(unsigned long long)snapshot.droppedCount);
+	}
+
+	for (index = 0; index < snapshot.count; index++) {
+		entryPtr = &snapshot.entries[index];
+		if ((partname != NULL) && (entryPtr->participantId != participantId)) {
+			continue;
+		}
+
+		// Entries are sorted by participant, so the name only needs to be looked up once per participant
+		if ((0 == index) || (entryPtr->participantId != namedParticipantId)) {
+			namedParticipantId = entryPtr->participantId;
+			upPtr = EsifUpPm_GetAvailableParticipantByInstance(namedParticipantId);
+			if (upPtr != NULL) {
+				esif_ccb_strcpy(name, EsifUp_GetName(upPtr), sizeof(name));
+				EsifUp_PutRef(upPtr);
+				upPtr = NULL;
+			}
+			else {
+				esif_ccb_sprintf(sizeof(name), name, ESIF_HANDLE_FMT, esif_ccb_handle2llu(namedParticipantId));
+			}
+		}
+		avgUsec = entryPtr->totalUsec / entryPtr->count;
+
+		if (FORMAT_XML == g_format) {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"  <entry>\n"
+				"    <participant>%s</participant>\n"
+				"    <participantId>%llu</participantId>\n"
+				"    <primitive>%s</primitive>\n"
+				"    <primitiveId>%u</primitiveId>\n"
+				"    <action>%s</action>\n"
+				"    <actionType>%u</actionType>\n"
+				"    <count>%llu</count>\n"
+				"    <errors>%llu</errors>\n"
+				"    <totalUsec>%llu</totalUsec>\n"
+				"    <avgUsec>%llu</avgUsec>\n"
+				"    <p50Usec>%llu</p50Usec>\n"
+				"    <p99Usec>%llu</p99Usec>\n"
+				"    <maxUsec>%llu</maxUsec>\n"
+				"    <histogram>\n",
+				name,
+				esif_ccb_handle2llu(entryPtr->participantId),
+				esif_primitive_str((esif_primitive_type_t)entryPtr->primitiveId),
+				entryPtr->primitiveId,
+				esif_shell_primstats_action_str(entryPtr->actionType),
+				(UInt32)entryPtr->actionType,
+				(unsigned long long)entryPtr->count,
+				(unsigned long long)entryPtr->errorCount,
+				(unsigned long long)entryPtr->totalUsec,
+				(unsigned long long)avgUsec,
+				(unsigned long long)EsifPrimStats_GetPercentileUsec(entryPtr, 50),
+				(unsigned long long)EsifPrimStats_GetPercentileUsec(entryPtr, 99),
+				(unsigned long long)entryPtr->maxUsec);
+
+			// Only non-empty buckets are listed; a limit of 0 is the unbounded last bucket
+			for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+				if (entryPtr->buckets[bucket] > 0) {
+					esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+						"      <bucket><limitUsec>%llu</limitUsec><count>%llu</count></bucket>\n",
+						(unsigned long long)EsifPrimStats_GetBucketLimitUsec(bucket),
+						(unsigned long long)entryPtr->buckets[bucket]);
+				}
+			}
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"    </histogram>\n"
+				"  </entry>\n");
+		}
+		else {
+			esif_ccb_sprintf_concat(OUT_BUF_LEN, output,
+				"%-11s  %-40s  %-14s  %10llu  %10llu  %8llu  %8llu  %8llu  %8llu\n",
+				name,
+				esif_primitive_str((esif_primitive_type_t)entryPtr->primitiveId),
+				esif_shell_primstats_action_str(entryPtr->actionType),
+				(unsigned long long)entryPtr->count,
+				(unsigned long long)entryPtr->errorCount,
+				(unsigned long long)avgUsec,
+				(unsigned long long)EsifPrimStats_GetPercentileUsec(entryPtr, 50),
+				(unsigned long long)EsifPrimStats_GetPercentileUsec(entryPtr, 99),
+				(unsigned long long)entryPtr->maxUsec);
+
+			if (isHistogram) {
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "             ");
+				for (bucket = 0; bucket < ESIF_PRIMSTATS_BUCKETS; bucket++) {
+					if (0 == entryPtr->buckets[bucket]) {
+						continue;
+					}
+					limitUsec = EsifPrimStats_GetBucketLimitUsec(bucket);
+					if (limitUsec > 0) {
+						esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " <%llu:%llu",
+							(unsigned long long)limitUsec,
+							(unsigned long long)entryPtr->buckets[bucket]);
+					}
+					else {
+						esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " >=%llu:%llu",
+							(unsigned long long)EsifPrimStats_GetBucketLimitUsec(bucket - 1),
+							(unsigned long long)entryPtr->buckets[bucket]);
+					}
+				}
+				esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+			}
+		}
+	}
+
+	if (FORMAT_XML == g_format) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "</primstats>\n");
+	}
+	else {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, "\n");
+	}
+
+exit:
+	// Return any Error Code as string
+	if (rc != ESIF_OK) {
+		esif_ccb_sprintf_concat(OUT_BUF_LEN, output, " %s (%d)\n", esif_rc_str(rc), rc);
+	}
+	EsifPrimStats_FreeSnapshot(&snapshot);
+	return output;
+}
+
 static char* esif_shell_cmd_addpart(EsifShellCmdPtr shell)
 {
 	int argc = shell->argc;
@@ -8103,6 +8650,7 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"echo [?] [parameter...]                  Echos Parameters - if ? is used, each\n"
 		"                                         parameter is on a separate line\n"
 		"memstats [reset]                         Show/Reset Memory Statistics\n"
+		"primstats [<command>]...                 Primitive Execution Statistics, see 'primstats help'\n"
 		"autoexec [command] [...]                 Execute Default Startup Script\n"
 		"\n"
 		"TEST SCRIPT COMMANDS:\n"
@@ -8130,6 +8678,7 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"\n"
 		"DSP COMMANDS:\n"
 		"dsps                                     List all loaded DSPs\n"
+		"dspstats                                 Show DSP lookup table sizes and collisions\n"
 		"dspquery [name [vendorid [deviceid [enum [ptype [hid [uid]]]]]]] Query for matching DSP\n"
 		"infocpc <filename> [pattern]             Get Dst CPC Information\n"
 		"infofpc <filename> [pattern]             Get Dst FPC Information\n"
@@ -8246,6 +8795,8 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"EVENT API:\n"
 		"event [enable|disable] <eventType> [participant] [domain]   Enable/Disable/Send a User Mode Event\n" 
 		"events [namespec] [appspec]                   Display all events registered in the Event Manager\n"
+		"eventstats [reset]                            Display or Reset Event Queue Statistics\n"
+		"eventworkers                                  Display Event Worker Queue Depth and Latency\n"
 		"eventkpe <eventType> <index> [u32 data]       Send Kernel Event to KPE\n"
 		"                                              index - Index of the KPE based on\n"
 		"                                              the order of driversk (0-based)\n"
@@ -8341,15 +8892,20 @@ static char *esif_shell_cmd_help(EsifShellCmdPtr shell)
 		"                                        If ALL is specified, data is sent to\n"
 		"                                        all available targets.\n"
 		"                                        The target can be any of the following:\n"
-		"                                        CONSOLE, EVENTVIEWER, DEBUGGER, or FILE.\n"
-		"                                        If FILE is specified as the target, the\n"
-		"                                        next argument, if present, must specify\n"
-		"                                        the file name.*\n"
+		"                                        CONSOLE, EVENTVIEWER, DEBUGGER, FILE or\n"
+		"                                        BINARY. BINARY is not included in ALL.\n"
+		"                                        If FILE or BINARY is specified as the\n"
+		"                                        target, the next argument, if present,\n"
+		"                                        must specify the file name.*\n"
 		"                                        *If a filename is not specified, a default\n"
 		"                                        file name is used based on the timestamp;\n"
 		"                                        e.g, participant_log_2015-11-24-142412.csv.\n"
 		"participantlog "PARTICIPANTLOG_CMD_STOP_STR"                     Stops participant data logging if\n"
 		"                                        started already\n"
+		"participantlog "PARTICIPANTLOG_CMD_CONVERT_STR" <binfile> [csvfile]\n"
+		"                                        Converts a BINARY participant log to\n"
+		"                                        the FILE (CSV) format. Default output\n"
+		"                                        is binfile with a .csv extension.\n"
 		"\n"										  
 		"USER-MODE TRACE LOGGING:\n"
 		"trace                             Show User Mode Trace Settings\n"
@@ -10482,6 +11038,15 @@ static char *esif_shell_cmd_config(EsifShellCmdPtr shell)
 					rc = ESIF_E_NOT_FOUND;
 				}
 				else {
+					// Drop any Journal or Payload Caches left behind for this DataVault
+					if (dvname) {
+						char journalpath[MAX_PATH] = { 0 };
+						esif_ccb_sprintf(sizeof(journalpath), journalpath, "%s%s", fullpath, ESIFDV_JOURNALEXT);
+						if (esif_ccb_file_exists(journalpath)) {
+							IGNORE_RESULT(esif_ccb_unlink(journalpath));
+						}
+						DataVault_DeletePayloadCaches(dvname, NULL);
+					}
 					rc = ESIF_OK;
 					dropped++;
 				}
@@ -12692,6 +13257,7 @@ char *esif_shell_exec_command(
 	char *cmdPtr = NULL;
 	char *lineCpy = NULL;
 	char *local_context = NULL;
+	Bool isShared = ESIF_FALSE;
 
 	if (esif_ccb_strlen(line, buf_len) >= (buf_len - 1)) {
 		return NULL;
@@ -12702,7 +13268,16 @@ char *esif_shell_exec_command(
 		return NULL;
 	}
 
-	esif_uf_shell_lock();
+	// Read-only commands executed in their own Shell Execution Context only share the Shell lock.
+	// The shared hold counts toward the nesting depth so nested commands do not lock again.
+	isShared = (esif_shell_ctx() != &g_shellDefaultCtx && g_shellLockDepth == 0 && esif_shell_is_concurrent_cmd(lineCpy));
+	if (isShared) {
+		esif_ccb_read_lock(&g_shellLock);
+		g_shellLockDepth++;
+	}
+	else {
+		esif_uf_shell_lock();
+	}
 
 	// Create output buffer if necessary
 	if ((g_outbuf == NULL) && ((g_outbuf = esif_ccb_malloc(OUT_BUF_LEN)) == NULL)) {
@@ -12791,7 +13366,13 @@ display_output:
 exit:
 	esif_ccb_free(lineCpy);
 	esif_ccb_free(temp_line);
-	esif_uf_shell_unlock();
+	if (isShared) {
+		g_shellLockDepth--;
+		esif_ccb_read_unlock(&g_shellLock);
+	}
+	else {
+		esif_uf_shell_unlock();
+	}
 	return out_str;
 }
 
@@ -12915,6 +13496,7 @@ static EsifShellMap ShellCommands[] = {
 	{"driversk",             fnArgv, (VoidFunc)esif_shell_cmd_driversk            },
 	{"dspquery",             fnArgv, (VoidFunc)esif_shell_cmd_dspquery			  },
 	{"dsps",                 fnArgv, (VoidFunc)esif_shell_cmd_dsps                },
+	{"dspstats",             fnArgv, (VoidFunc)esif_shell_cmd_dspstats            },
 	{"dst",                  fnArgv, (VoidFunc)esif_shell_cmd_dst                 },
 	{"dstn",                 fnArgv, (VoidFunc)esif_shell_cmd_dstn                },
 	{"dv",                   fnArgv, (VoidFunc)esif_shell_cmd_config              },
@@ -12922,6 +13504,8 @@ static EsifShellMap ShellCommands[] = {
 	{"event",                fnArgv, (VoidFunc)esif_shell_cmd_event               },
 	{"eventkpe",             fnArgv, (VoidFunc)esif_shell_cmd_eventkpe            },
 	{"events",               fnArgv, (VoidFunc)esif_shell_cmd_events              },
+	{"eventstats",           fnArgv, (VoidFunc)esif_shell_cmd_eventstats          },
+	{"eventworkers",         fnArgv, (VoidFunc)esif_shell_cmd_eventworkers        },
 	{"exit",                 fnArgv, (VoidFunc)esif_shell_cmd_exit                },
 	{"format",               fnArgv, (VoidFunc)esif_shell_cmd_format              },
 	{"getb",                 fnArgv, (VoidFunc)esif_shell_cmd_getb                },
@@ -12963,6 +13547,7 @@ static EsifShellMap ShellCommands[] = {
 	{"parts",                fnArgv, (VoidFunc)esif_shell_cmd_participants        },
 	{"partsk",               fnArgv, (VoidFunc)esif_shell_cmd_participantsk       },
 	{"paths",                fnArgv, (VoidFunc)esif_shell_cmd_paths               },
+	{"primstats",            fnArgv, (VoidFunc)esif_shell_cmd_primstats           },
 	{"proof",                fnArgv, (VoidFunc)esif_shell_cmd_load                },
 	{"prooftst",             fnArgv, (VoidFunc)esif_shell_cmd_load                },
 	{"quit",                 fnArgv, (VoidFunc)esif_shell_cmd_quit                },
@@ -40,6 +40,12 @@ void esif_uf_shell_stop(void);
 void esif_uf_shell_lock();
 void esif_uf_shell_unlock();
 
+// Shell Execution Contexts; Read-only commands executed in their own context may run concurrently
+struct EsifShellCtx_s *esif_shell_ctx_create(void);
+void esif_shell_ctx_destroy(struct EsifShellCtx_s *self);
+struct EsifShellCtx_s *esif_shell_ctx_bind(struct EsifShellCtx_s *self);
+char *esif_shell_ctx_exec_command(struct EsifShellCtx_s *self, const char *line, size_t buf_len, UInt8 isRest);
+
 eEsifError esif_shell_dispatch(int argc, char **argv, char **output_ptr);
 eEsifError esif_shell_dispatch_cmd(const char *line, char **output_ptr);
 
@@ -0,0 +1,66 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+#define ESIF_TRACE_ID	ESIF_TRACEMODULE_LOGGINGMGR
+
+/*
+ * esif_logconvert: Offline Binary Participant Log to CSV converter
+ * Equivalent to "participantlog convert" but does not require a running esif_ufd.
+ * Usage: esif_logconvert <binaryfile> [csvfile]
+ */
+#include "esif_uf_loggingmgr.h"
+
+int main(int argc, char **argv)
+{
+	eEsifError rc = ESIF_OK;
+	char csvPath[MAX_PATH] = { 0 };
+	UInt32 rows = 0;
+
+	if (argc < 2 || argc > 3) {
+		fprintf(stderr, "Usage: %s <binaryfile> [csvfile]\n", argv[0]);
+		return 1;
+	}
+
+	// Default CSV file name is the binary file name with a .csv extension
+	if (argc > 2) {
+		esif_ccb_strcpy(csvPath, argv[2], sizeof(csvPath));
+	}
+	else {
+		char *fileExtn = NULL;
+		char *fileName = NULL;
+		esif_ccb_strcpy(csvPath, argv[1], sizeof(csvPath));
+		fileName = esif_ccb_strrchr(csvPath, *ESIF_PATH_SEP);
+		fileExtn = esif_ccb_strrchr((fileName != NULL ? fileName : csvPath), '.');
+		if (fileExtn != NULL) {
+			*fileExtn = 0;
+		}
+		esif_ccb_strcat(csvPath, ".csv", sizeof(csvPath));
+	}
+
+	if (esif_ccb_stricmp(argv[1], csvPath) == 0) {
+		rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
+	}
+	else {
+		rc = EsifLogMgr_BinaryLogConvert(argv[1], csvPath, &rows);
+	}
+	if (rc != ESIF_OK) {
+		fprintf(stderr, "Error converting %s: %s(%d)\n", argv[1], esif_rc_str(rc), rc);
+		return 1;
+	}
+	printf("Converted %u rows to %s\n", rows, csvPath);
+	return 0;
+}
@@ -177,6 +177,23 @@ struct tzPolicy {
 };
 #pragma pack(pop)
 
+/*
+ * Execution plan for a primitive that resolved to a single sysfs or dev node.
+ * The plan is built the first time the primitive is resolved; later calls skip
+ * parameter parsing, token replacement and the node search and read the open
+ * node directly. A plan is only used with the DSP action it was built from and
+ * while the DSP table it was resolved in is loaded, so a reloaded DSP rebuilds
+ * it, and it is dropped when the participant goes away.
+ */
+typedef struct SysfsActionPlan_s {
+	struct sysfsActionHashKey key;
+	EsifFpcActionPtr fpcActionPtr;	/* DSP action the plan was built from */
+	UInt32 dspGeneration;		/* DSP table generation fpcActionPtr was resolved in */
+	int fd;				/* Open sysfs or dev node */
+	Bool isOffsetRead;		/* Binary 64-bit read at offset (MSR) instead of a text read */
+	off_t offset;
+} SysfsActionPlan, *SysfsActionPlanPtr;
+
 static struct tzPolicy* tzPolicies = NULL;
 
 static int replace_str(char *str, char *old, char *new, char *rpl_buff, int rpl_buff_len);
@@ -193,8 +210,12 @@ static enum esif_rc get_participant_current_control_capabilities(char *table_str
 static enum esif_rc get_perf_support_states(char *table_str, char *participant_path);
 static enum esif_rc get_supported_brightness_levels(char *table_str, char *participant_path);
 static eEsifError get_participant_scope(char *acpi_name, char *acpi_scope);
-static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString devicePathName, EsifString deviceNodeName);
-static struct esif_ht *actionHashTablePtr = NULL;
+static int SetActionContext(struct sysfsActionHashKey *keyPtr, const EsifFpcActionPtr fpcActionPtr, UInt32 dspGeneration, EsifString devicePathName, EsifString deviceNodeName, EsifString offsetStr);
+static void RemoveActionPlansLocked(const esif_handle_t participantId, const struct sysfsActionHashKey *keyPtr);
+static eEsifError ESIF_CALLCONV ActionPlanEventCallback(esif_context_t context, esif_handle_t participantId, UInt16 domainId, EsifFpcEventPtr fpcEventPtr, EsifDataPtr eventDataPtr);
+static struct esif_ht *actionHashTablePtr = NULL;	/* Action plans by participant and primitive tuple */
+static struct esif_link_list *actionPlanListPtr = NULL;	/* All action plans, for removal by participant */
+static esif_ccb_lock_t actionPlanLock;
 static char sys_long_string_val[MAX_SYSFS_STRING];
 static eEsifError SetFanLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
 static eEsifError SetBrightnessLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr);
@@ -215,60 +236,71 @@ static void NotifyJhs(EsifUpPtr upPtr, const EsifDataPtr requestPtr);
 #endif
 
 /*
- * Inline function: GetUIntFromActionContext
- * -----------------------------------------
- * Read a 32-bit or 64-bit integer from the file that is associated to the context and return this value to the caller.
+ * Function: ExecuteActionPlan
+ * ---------------------------
+ * Execute the cached plan for a primitive, if there is one, and return the value read to the caller.
  * ESIF spawns multiple timer threads to read participant temperatures or performance states periodically.
  * The polling period could be quite frequent - for example, one thread polls the SoC temperature once every second,
- * per each of the 3 available domains. Such repeated open/read/close procedures would cause unnecessary system call
- * overhead. To reduce this call overhead, we open the associated node only once (twice actually) and then store the
- * corresponding file descriptor in a hash table. So on the next read, we can retrieve the file descriptor quickly
- * without going through the costly open/close calls.
+ * per each of the 3 available domains. Parsing the action parameters, replacing tokens, searching for the node and
+ * opening/reading/closing it on every call would cost far more than the read itself. Instead, the node is resolved and
+ * opened once and the resulting plan stored in a hash table, so later reads are a single pread of the open node.
  *
- * Here the context is the file descriptor that we have obtained from the hash table. File descriptors are unsigned integers
- * and since 0 is reserved for stdin, we first check if the descriptor is greater than 0. Once this is verified, we then
- * issue a read using this file descriptor.
+ * Most plans read a decimal value from the start of a sysfs node, for example, a temperature value. Plans for MSR reads
+ * (PC2 to PC10 residencies and the TSC) read a binary 64-bit value at the MSR address instead.
  *
- * Most such reads return a 32-bit integer, however, there are certain primitives defined in the DSP files that require
- * 64-bit return values, among those, are the PC2 to PC10 primitives and the TSC primitive. We use the size of the
- * response buffer to tell what type of read it is, then cast the read value to the type of the return value.
+ * Most such reads return a 32-bit integer, however, some primitives defined in the DSP files require 64-bit return
+ * values. We use the size of the response buffer to tell what type of read it is, then cast the read value to the type
+ * of the return value.
  *
- * Most cached read will do a direct read from the sysfs node, for example, a temperature value. However for MSR reads, we
- * use the pread system call to read from a particular offset passed by the caller. The sysopt is used to distinguish
- * if the read is a direct read or a read from a certain offset.
+ * ESIF_E_NOT_FOUND is returned when there is no usable plan; any other error means the plan failed and should be
+ * rebuilt by resolving the primitive again. A plan built from a DSP table that has since been unloaded is not usable
+ * even if a new DSP action happens to be allocated at the same address.
  */
-
-static ESIF_INLINE eEsifError GetUIntFromActionContext(const size_t context, const EsifString parm, const EsifDataPtr responsePtr)
+static eEsifError ExecuteActionPlan(const struct sysfsActionHashKey *keyPtr, const EsifFpcActionPtr fpcActionPtr, UInt32 dspGeneration, const EsifDataPtr responsePtr)
 {
-	eEsifError rc = ESIF_OK;
+	eEsifError rc = ESIF_E_NOT_FOUND;
+	SysfsActionPlanPtr planPtr = NULL;
+	char buf[MAX_SYSFS_STRING] = { 0 };
+	ssize_t len = 0;
 	Int64 sysval = 0;
 
-	if (context > 0) { // valid file descriptor pointing to an open sysfs node or dev node
-		if (parm != NULL) { // parm is the offset
-			long msrAddr = strtol(parm, NULL, 0);
-			if (pread(context, &sysval, sizeof(UInt64), msrAddr) != sizeof(UInt64)) {
-				ESIF_TRACE_WARN("Failed to get action context, will attemp to read directly the device file\n");
-				rc = ESIF_E_IO_ERROR;
-				goto exit;
-			}
-		} else { // parm is not used, do a direct read
-			if (SysfsGetInt64Direct((int) context, &sysval) <= 0) {
-				ESIF_TRACE_WARN("Failed to get action context, will attemp to read directly from the sysfs\n");
-				rc = ESIF_E_UNSPECIFIED;
-				goto exit;
-			}
+	esif_ccb_read_lock(&actionPlanLock);
+
+	planPtr = (SysfsActionPlanPtr) esif_ht_get_item(actionHashTablePtr, (u8 *)keyPtr, sizeof(*keyPtr));
+	if ((NULL == planPtr) || (planPtr->fpcActionPtr != fpcActionPtr) || (planPtr->dspGeneration != dspGeneration)) {
+		goto exit;
+	}
+
+	if (planPtr->isOffsetRead) {
+		if (pread(planPtr->fd, &sysval, sizeof(UInt64), planPtr->offset) != sizeof(UInt64)) {
+			ESIF_TRACE_WARN("Failed to read from action plan, will resolve the device file again\n");
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
 		}
-		if (responsePtr->buf_len < sizeof(u64)) {
-			*(u32 *) responsePtr->buf_ptr = (u32) sysval;
-		} else {
-			*(u64 *) responsePtr->buf_ptr = sysval;
+	}
+	else {
+		len = pread(planPtr->fd, buf, sizeof(buf) - 1, 0);
+		if (len <= 0) {
+			ESIF_TRACE_WARN("Failed to read from action plan, will resolve the sysfs node again: %s\n", strerror(errno));
+			rc = ESIF_E_IO_ERROR;
+			goto exit;
+		}
+		buf[len] = 0;
+		if (esif_ccb_sscanf(buf, "%lld", &sysval) < 1) {
+			rc = ESIF_E_UNSPECIFIED;
+			goto exit;
 		}
-	} else {
-		rc = ESIF_E_INVALID_HANDLE;
 	}
 
+	if (responsePtr->buf_len < sizeof(u64)) {
+		*(u32 *) responsePtr->buf_ptr = (u32) sysval;
+	} else {
+		*(u64 *) responsePtr->buf_ptr = sysval;
+	}
+	rc = ESIF_OK;
 exit:
-    return rc;
+	esif_ccb_read_unlock(&actionPlanLock);
+	return rc;
 }
 
 // Checking the supported Capability 
@@ -342,12 +374,28 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	char table_str[BINARY_TABLE_SIZE];
 	TableObject tableObject = {0};
 	struct sysfsActionHashKey key = {0};
-	size_t actionContext = 0;
+	UInt32 dspGeneration = EsifDspMgr_GetGeneration();
 	EsifUpDataPtr metaPtr = NULL;
 
 	UNREFERENCED_PARAMETER(actCtx);
 	UNREFERENCED_PARAMETER(requestPtr);
 
+	if ((NULL == upPtr) || (NULL == primitivePtr) || (NULL == responsePtr) || (NULL == responsePtr->buf_ptr)) {
+		rc = ESIF_E_PARAMETER_IS_NULL;
+		goto exit;
+	}
+
+	// Execute the cached plan for this primitive if it has already been resolved to a node
+	key.participantId = EsifUp_GetInstance(upPtr);
+	key.primitiveTuple = primitivePtr->tuple;
+	if (responsePtr->buf_len >= sizeof(u32)) {
+		rc = ExecuteActionPlan(&key, fpcActionPtr, dspGeneration, responsePtr);
+		if (ESIF_OK == rc) {
+			goto exit;
+		}
+		rc = ESIF_OK;
+	}
+
 	rc = EsifFpcAction_GetParams(fpcActionPtr,
 		params,
 		sizeof(params)/sizeof(*params));
@@ -403,17 +451,10 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		goto exit;
 	}
 
-	// Assemble hash table key to look for existing file pointer to sysfs node
-	key.participantId = EsifUp_GetInstance(upPtr);
-	key.primitiveTuple = primitivePtr->tuple;
-	actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *)&key, sizeof(key));
 	sysopt = *(enum esif_sysfs_command *) command;
 
 	switch (sysopt) {
 	case ESIF_SYSFS_DIRECT_PATH:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
-
 		if (0 == esif_ccb_strcmp(parm2, "alt") && deviceAltPathPtr != NULL) {
 			deviceTargetPathPtr = deviceAltPathPtr;
 		}
@@ -427,7 +468,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 			ESIF_TRACE_WARN("Failed to get value from path: %s/%s . Error: %d \n",devicePathPtr,parm1,pathAccessReturn);
 			goto exit;
 		}
-		if (SetActionContext(&key, deviceTargetPathPtr, parm1)) {
+		if (SetActionContext(&key, fpcActionPtr, dspGeneration, deviceTargetPathPtr, parm1, NULL)) {
 			ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 				esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 		}
@@ -435,9 +476,6 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		*(u32 *) responsePtr->buf_ptr = (u32) tripval;
 		break;
 	case ESIF_SYSFS_DIRECT_ENUM:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
-
 		candidate_found = 0;
 		for (node_idx = 0; node_idx < max_node_idx; node_idx++) {
 			esif_ccb_sprintf(MAX_IDX_HOLDER, idx_holder, "%d", node_idx);
@@ -450,7 +488,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 					continue;
 
 				candidate_found = 1;
-				if (SetActionContext(&key, devicePathPtr, cur_node_name)) {
+				if (SetActionContext(&key, fpcActionPtr, dspGeneration, devicePathPtr, cur_node_name, NULL)) {
 					ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 						esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 				}
@@ -464,23 +502,17 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		}
 		break;
 	case ESIF_SYSFS_ALT_PATH:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
-
 		if (SysfsGetInt64(parm1, parm2, &sysval) < SYSFS_FILE_RETRIEVAL_SUCCESS) {
 			rc = ESIF_E_PRIMITIVE_ACTION_FAILURE;
 			goto exit;
 		}
-		if (SetActionContext(&key, parm1, parm2)) {
+		if (SetActionContext(&key, fpcActionPtr, dspGeneration, parm1, parm2, NULL)) {
 			ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT " primitive %d, domain %d, instance %d\n",
 				esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 		}
 		*(u32 *) responsePtr->buf_ptr = (u32) sysval;
 		break;
 	case ESIF_SYSFS_DIRECT_QUERY:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
-
 		min_idx = 0;
 		if(parm4) {
 			min_idx = esif_atoi(parm4);
@@ -501,7 +533,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 			if (SysfsGetString(devicePathPtr, cur_node_name, sysvalstring, sizeof(sysvalstring)) > -1) {
 				if (esif_ccb_stricmp(parm2, sysvalstring) == 0) {
 					if (SysfsGetInt64(devicePathPtr, alt_node_name, &sysval) > 0 && sysval > 0 && node_idx >= min_idx) {
-						if (SetActionContext(&key, devicePathPtr, alt_node_name)) {
+						if (SetActionContext(&key, fpcActionPtr, dspGeneration, devicePathPtr, alt_node_name, NULL)) {
 							ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 								esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 						}
@@ -522,8 +554,6 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		break;
 
 	case ESIF_SYSFS_ALT_QUERY:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
 		for (node_idx = 0; node_idx < max_node_idx; node_idx++) {
 			candidate_found = ESIF_FALSE;
 			esif_ccb_sprintf(MAX_IDX_HOLDER, idx_holder, "%d", node_idx);
@@ -550,7 +580,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 							node_name_ptr = alt_node_name;
 						}
 						if (SysfsGetInt64(cur_node_name, node_name_ptr, &sysval) > 0 && sysval > 0) {
-							if (SetActionContext(&key, cur_node_name, node_name_ptr)) {
+							if (SetActionContext(&key, fpcActionPtr, dspGeneration, cur_node_name, node_name_ptr, NULL)) {
 								ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 									esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 							}
@@ -574,7 +604,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		break;
 	case ESIF_SYSFS_CALC:
 		// Most CALC type reads happen very infrequently, also the read-back value is often massaged before they
-		// are sent back to ESIF. Thereof we do not call GetUIntFromActionContext() blankly.
+		// are sent back to ESIF. Thereof only C-state residency reads build an action plan.
 		calc_type = *(enum esif_sysfs_param *) parm3;
 		switch (calc_type) {
 			case ESIF_SYSFS_GET_SOC_RAPL: /* rapl */
@@ -697,15 +727,8 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 				rc = GetDisplayBrightness(parm1,responsePtr);
 				break;
 			case ESIF_SYSFS_GET_CSTATE_RESIDENCY:
-				// Due to the frequent CSTATE_RESIDENCY queries, we want to try the hash table first
-				// to look for a cached file descriptor to /dev/cpu/0/msr. We must also
-				// re-evaluate the action context because all various instances of C-state residency
-				// (PC2 - PC10) share the same file descriptor.
-				key.primitiveTuple.instance = 255; // Do no care - all PCx reads share the same file path
-				actionContext = (size_t) esif_ht_get_item(actionHashTablePtr, (u8 *)&key, sizeof(key));
-				if (ESIF_OK == GetUIntFromActionContext(actionContext, parm4, responsePtr))
-					goto exit;
-
+				// Due to the frequent CSTATE_RESIDENCY queries, each instance (PC2 - PC10) gets an action
+				// plan that reads its MSR address from /dev/cpu/0/msr directly.
 				msrAddr = (UInt32) strtol(parm4, NULL, 0);
 				if (msrAddr <= 0) {
 					rc = ESIF_E_PARAMETER_IS_OUT_OF_BOUNDS;
@@ -713,7 +736,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 				}
 				rc = GetCStateResidency(parm1, parm2, msrAddr, responsePtr);
 				if (ESIF_OK == rc) {
-					if (SetActionContext(&key, parm1, parm2)) {
+					if (SetActionContext(&key, fpcActionPtr, dspGeneration, parm1, parm2, parm4)) {
 						ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 							esif_ccb_handle2llu(key.participantId),
 							key.primitiveTuple.id,
@@ -743,9 +766,6 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 		}
 		break;
 	case ESIF_SYSFS_DIRECT_QUERY_ENUM:
-		if (ESIF_OK == GetUIntFromActionContext(actionContext, NULL, responsePtr))
-			goto exit;
-
 		/* This is a search loop, so default to failure */
 		rc = ESIF_E_PRIMITIVE_ACTION_FAILURE;
 
@@ -776,7 +796,7 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 						else {
 							rc = ESIF_OK;
 						}
-						if (SetActionContext(&key, devicePathPtr, alt_node_name)) {
+						if (SetActionContext(&key, fpcActionPtr, dspGeneration, devicePathPtr, alt_node_name, NULL)) {
 							ESIF_TRACE_WARN("Fail to save context for participant " ESIF_HANDLE_FMT ", primitive %d, domain %d, instance %d\n",
 								esif_ccb_handle2llu(key.participantId), key.primitiveTuple.id, key.primitiveTuple.domain, key.primitiveTuple.instance);
 						}
@@ -886,6 +906,9 @@ static eEsifError ESIF_CALLCONV ActionSysfsGet(
 	}
 
 exit:
+	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
+		esif_ccb_free(replacedStrs[i]);
+	}
 	return rc;
 }
 
@@ -1124,6 +1147,9 @@ static eEsifError ESIF_CALLCONV ActionSysfsSet(
 	}
 
 exit:
+	for (i = 0; i < sizeof(replacedStrs) / sizeof(*replacedStrs); i++) {
+		esif_ccb_free(replacedStrs[i]);
+	}
 	return rc;
 }
 
@@ -1226,9 +1252,13 @@ static void get_full_scope_str(char *orig, char *new)
 }
 
 
-static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString devicePathName, EsifString deviceNodeName)
+/*
+ * Open the node a primitive resolved to and save it as the action plan for the primitive, replacing
+ * any previous plan. offsetStr is the MSR address for binary reads of dev nodes, or NULL for sysfs nodes.
+ */
+static int SetActionContext(struct sysfsActionHashKey *keyPtr, const EsifFpcActionPtr fpcActionPtr, UInt32 dspGeneration, EsifString devicePathName, EsifString deviceNodeName, EsifString offsetStr)
 {
-	int fd = 0;
+	SysfsActionPlanPtr planPtr = NULL;
 	char filepath[MAX_SYSFS_PATH] = { 0 };
 	int ret = 0;
 
@@ -1238,17 +1268,96 @@ static int SetActionContext(struct sysfsActionHashKey *keyPtr, EsifString device
                 return ret;
         }
 
+	planPtr = (SysfsActionPlanPtr) esif_ccb_malloc(sizeof(*planPtr));
+	if (NULL == planPtr) {
+		return ESIF_E_NO_MEMORY;
+	}
+	planPtr->key = *keyPtr;
+	planPtr->fpcActionPtr = fpcActionPtr;
+	planPtr->dspGeneration = dspGeneration;
+	planPtr->isOffsetRead = (offsetStr != NULL);
+	planPtr->offset = (offsetStr != NULL ? (off_t) strtol(offsetStr, NULL, 0) : 0);
+
 	esif_ccb_sprintf(MAX_SYSFS_PATH, filepath, "%s/%s", devicePathName, deviceNodeName);
-	fd = open(filepath, O_RDONLY);
+	planPtr->fd = open(filepath, O_RDONLY);
+	if (planPtr->fd == -1) {
+		esif_ccb_free(planPtr);
+		return ret;
+	}
 
-	if (fd != -1) {
-		size_t actionContext = (size_t) fd;
-		ret = esif_ht_add_item(actionHashTablePtr, (u8 *) keyPtr, sizeof(struct sysfsActionHashKey), (void *) actionContext);
+	esif_ccb_write_lock(&actionPlanLock);
+	RemoveActionPlansLocked(keyPtr->participantId, keyPtr);
+	ret = esif_ht_add_item(actionHashTablePtr, (u8 *) &planPtr->key, sizeof(planPtr->key), planPtr);
+	if (ESIF_OK == ret) {
+		ret = esif_link_list_add_at_back(actionPlanListPtr, planPtr);
+		if (ret != ESIF_OK) {
+			esif_ht_remove_item(actionHashTablePtr, (u8 *) &planPtr->key, sizeof(planPtr->key));
+		}
 	}
+	esif_ccb_write_unlock(&actionPlanLock);
 
+	if (ret != ESIF_OK) {
+		close(planPtr->fd);
+		esif_ccb_free(planPtr);
+	}
 	return ret;
 }
 
+/*
+ * Remove the action plan for a primitive, or all action plans for the participant if keyPtr is NULL
+ * (action plan lock already held)
+ */
+static void RemoveActionPlansLocked(const esif_handle_t participantId, const struct sysfsActionHashKey *keyPtr)
+{
+	struct esif_link_list_node *nodePtr = NULL;
+	struct esif_link_list_node *nextNodePtr = NULL;
+	SysfsActionPlanPtr planPtr = NULL;
+
+	if (NULL == actionPlanListPtr) {
+		return;
+	}
+
+	nodePtr = actionPlanListPtr->head_ptr;
+	while (nodePtr != NULL) {
+		nextNodePtr = nodePtr->next_ptr;
+		planPtr = (SysfsActionPlanPtr) nodePtr->data_ptr;
+
+		if ((planPtr != NULL) &&
+			(planPtr->key.participantId == participantId) &&
+			((NULL == keyPtr) || (memcmp(&planPtr->key, keyPtr, sizeof(planPtr->key)) == 0))) {
+			esif_ht_remove_item(actionHashTablePtr, (u8 *) &planPtr->key, sizeof(planPtr->key));
+			esif_link_list_node_remove(actionPlanListPtr, nodePtr);
+			close(planPtr->fd);
+			esif_ccb_free(planPtr);
+		}
+		nodePtr = nextNodePtr;
+	}
+}
+
+/*
+ * Drop the action plans of a participant once it is unregistered, so that its
+ * nodes are closed and a participant reusing the handle resolves its own plans
+ */
+static eEsifError ESIF_CALLCONV ActionPlanEventCallback(
+	esif_context_t context,
+	esif_handle_t participantId,
+	UInt16 domainId,
+	EsifFpcEventPtr fpcEventPtr,
+	EsifDataPtr eventDataPtr
+	)
+{
+	UNREFERENCED_PARAMETER(context);
+	UNREFERENCED_PARAMETER(domainId);
+	UNREFERENCED_PARAMETER(eventDataPtr);
+
+	if ((fpcEventPtr != NULL) && (ESIF_EVENT_PARTICIPANT_UNREGISTER_COMPLETE == fpcEventPtr->esif_event)) {
+		esif_ccb_write_lock(&actionPlanLock);
+		RemoveActionPlansLocked(participantId, NULL);
+		esif_ccb_write_unlock(&actionPlanLock);
+	}
+	return ESIF_OK;
+}
+
 static int replace_str(char *str, char *orig, char *new, char *rpl_buff, int rpl_buff_len)
 {
 	int rc = 0;
@@ -1734,9 +1843,11 @@ static void ActionContextCleanUp(void *itemPtr)
 {
 	ESIF_TRACE_ENTRY();
 
-	size_t actionContext = (size_t) itemPtr;
-	int fd = (int) actionContext;
-	if (fd) close(fd);
+	SysfsActionPlanPtr planPtr = (SysfsActionPlanPtr) itemPtr;
+	if (planPtr) {
+		close(planPtr->fd);
+		esif_ccb_free(planPtr);
+	}
 }
 
 static eEsifError SetFanLevel(const EsifUpPtr upPtr, const EsifDataPtr requestPtr, const EsifString devicePathPtr)
@@ -2230,8 +2341,11 @@ static EsifActIfaceStatic g_sysfs = {
 
 enum esif_rc EsifActSysfsInit()
 {
-	EsifActMgr_RegisterAction((EsifActIfacePtr)&g_sysfs);
+	esif_ccb_lock_init(&actionPlanLock);
 	actionHashTablePtr = esif_ht_create(MAX_ACTION_HT_SIZE);
+	actionPlanListPtr = esif_link_list_create();
+	EsifEventMgr_RegisterReentrantEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER_COMPLETE, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, ActionPlanEventCallback, 0);
+	EsifActMgr_RegisterAction((EsifActIfacePtr)&g_sysfs);
 	SetThermalZonePolicy();
 	GetNumberOfCpuCores();
 	ESIF_TRACE_EXIT_INFO();
@@ -2242,8 +2356,16 @@ enum esif_rc EsifActSysfsInit()
 void EsifActSysfsExit()
 {
 	EsifActMgr_UnregisterAction((EsifActIfacePtr)&g_sysfs);
+	EsifEventMgr_UnregisterEventByType(ESIF_EVENT_PARTICIPANT_UNREGISTER_COMPLETE, EVENT_MGR_MATCH_ANY, EVENT_MGR_DOMAIN_D0, ActionPlanEventCallback, 0);
+	esif_ccb_write_lock(&actionPlanLock);
+	/* The hash table owns the plans; the list only references them */
+	esif_link_list_destroy(actionPlanListPtr);
+	actionPlanListPtr = NULL;
 	if (actionHashTablePtr)
 		esif_ht_destroy(actionHashTablePtr, ActionContextCleanUp);
+	actionHashTablePtr = NULL;
+	esif_ccb_write_unlock(&actionPlanLock);
+	esif_ccb_lock_uninit(&actionPlanLock);
 	if(cpufreq)
 		esif_ccb_free(cpufreq);
 	ResetThermalZonePolicy();
@@ -35,8 +35,16 @@
 #include <sys/file.h>
 #include <math.h>
 #include <dirent.h>
-
-#define ESIF_IIO_SAMPLE_PERIOD 5 // In seconds
+#include <poll.h>
+#include <time.h>
+#include <sys/eventfd.h>
+
+#define ESIF_IIO_SAMPLE_PERIOD 5 // In seconds; only used for sources that cannot notify of changes
+#define IIO_BUFFER_LENGTH 16 // Scans read per wakeup (buffer watermark) for each IIO device
+#define IIO_BUFFER_SLACK 2 // Kernel buffer holds this many watermarks so a late wakeup does not drop scans
+#define IIO_SAMPLING_FREQUENCY_MIN ((float)IIO_BUFFER_LENGTH / ESIF_IIO_SAMPLE_PERIOD) // Hz; one wakeup per sample period
+#define IIO_MAX_SCAN_BYTES 64 // Largest scan (all enabled channels plus padding) supported
+#define SENSOR_MAX_POLL_FDS 4 // Wake event, two buffered accelerometers and docking
 #define MAX_GFORCE (9.8 * 2) // All Chromebooks accel have default -2G to 2G range
 #define MOTION_CHANGE_THRESHOLD 0.007 // Normalize threshold to declare motion state change
 #define PLAT_TYPE_CLAMSHELL_ANGLE_MIN 5
@@ -55,11 +63,54 @@ typedef enum SensorLocation_e {
 	SENSOR_LOC_NA
 } SensorLoc;
 
+// Sources for which the latency from the kernel change to the signaled event is tracked
+typedef enum SensorLatencyType_e {
+	SENSOR_LATENCY_ACCEL = 0,
+	SENSOR_LATENCY_LID_ANGLE,
+	SENSOR_LATENCY_LID_STATE,
+	SENSOR_LATENCY_DOCK_MODE,
+	SENSOR_LATENCY_POWER_SRC,
+	SENSOR_LATENCY_BATTERY,
+	SENSOR_LATENCY_MAX
+} SensorLatencyType;
+
+typedef struct SensorLatency_s {
+	UInt64 count;
+	UInt64 totalUsec;
+	UInt64 maxUsec;
+} SensorLatency, *SensorLatencyPtr;
+
+// Time at which the kernel reported a change, in the clock the kernel used
+typedef struct SensorStamp_s {
+	clockid_t clock;
+	UInt64 nsec;
+} SensorStamp, *SensorStampPtr;
+
 typedef struct SensorBase_s {
 	SensorType type;
 	SensorLoc loc;
 } SensorBase, *SensorBasePtr;
 
+typedef enum IioChannelId_e {
+	IIO_CHANNEL_X = 0,
+	IIO_CHANNEL_Y,
+	IIO_CHANNEL_Z,
+	IIO_CHANNEL_TIMESTAMP,
+	IIO_CHANNEL_MAX
+} IioChannelId;
+
+// Layout of one channel within a buffered IIO scan
+typedef struct IioChannel_s {
+	Bool isEnabled;
+	UInt32 index;		// scan_elements/<channel>_index
+	size_t offset;		// Byte offset within the scan
+	UInt8 bytes;		// Storage size
+	UInt8 bits;		// Significant bits
+	UInt8 shift;
+	Bool isSigned;
+	Bool isBigEndian;
+} IioChannel, *IioChannelPtr;
+
 typedef struct Accelerometer_s {
 	int fdX;	// File descriptors for each open sysfs node
 	int fdY;
@@ -68,6 +119,11 @@ typedef struct Accelerometer_s {
 	int yRaw;
 	int zRaw;
 	float scale;
+	int fdBuffer;	// IIO buffer character device; -1 if the raw nodes must be polled
+	size_t scanBytes;
+	IioChannel channels[IIO_CHANNEL_MAX];
+	clockid_t timestampClock;	// Clock used by the kernel for the timestamp channel
+	char devPath[MAX_PATH];
 } Accelerometer, *AccelerometerPtr;
 
 typedef struct LidAngle_s {
@@ -93,6 +149,8 @@ static const char gXRawNodeName[] = "in_accel_x_raw";
 static const char gYRawNodeName[] = "in_accel_y_raw";
 static const char gZRawNodeName[] = "in_accel_z_raw";
 static const char gAngleRawNodeName[] = "in_angl_raw";
+static const char *gScanElementNames[IIO_CHANNEL_MAX] = { "in_accel_x", "in_accel_y", "in_accel_z", "in_timestamp" };
+static const char *gSensorLatencyNames[SENSOR_LATENCY_MAX] = { "Accelerometer", "Lid Angle", "Lid State", "Dock Mode", "Power Source", "Battery Percent" };
 static const char gSensorBasePath[] =  "/sys/bus/iio/devices";
 static char gLidStateBasePath[] = "/proc/acpi/button/lid/LID0";
 static char gPowerSrcBasePath[] = "/sys/class/power_supply/BAT0";
@@ -124,6 +182,17 @@ static int gFdPowerSrc;
 static int gFdBattCharge;
 static int gFdDocking;
 
+// Wakes the sensor manager thread when it must stop or a power_supply uevent arrives
+static int gFdWake = -1;
+
+// Set while the uevent listener is forwarding power_supply changes; otherwise they are polled
+static atomic_t gPowerSupplyUevents = ATOMIC_INIT(0);
+static atomic_t gPowerSupplyChanged = ATOMIC_INIT(0);
+static atomic64_t gPowerSupplyChangeNsec = ATOMIC_INIT(0);
+
+// Only updated by the sensor manager thread
+static SensorLatency gSensorLatency[SENSOR_LATENCY_MAX];
+
 // Global variables keeping track of current x/y/z vectors and platform/display orientation/platform type
 static AccelerometerData gCurAccelData;
 static PlatformOrientation gPlatOrientation = ORIENTATION_PLAT_MAX;
@@ -135,22 +204,71 @@ static PowerSrc gPowerSrc = POWER_SRC_AC;
 static PlatformType gPlatType = PLATFORM_TYPE_INVALID;
 static int gBatteryPercentage = 0;
 
-// The SIGUSR1 handler below is the alternative
-// solution for Android where the pthread_cancel()
-// is not implemented in Android NDK
+static UInt64 SensorClockNsec(clockid_t clock)
+{
+	struct timespec ts = { 0 };
+
+	clock_gettime(clock, &ts);
+	return ((UInt64)ts.tv_sec * 1000000000ULL) + (UInt64)ts.tv_nsec;
+}
+
+static void SensorStampNow(SensorStampPtr stampPtr)
+{
+	stampPtr->clock = CLOCK_MONOTONIC;
+	stampPtr->nsec = SensorClockNsec(CLOCK_MONOTONIC);
+}
+
+static void SensorLatencyRecord(SensorLatencyType type, const SensorStampPtr stampPtr)
+{
+	UInt64 now = 0;
+	UInt64 usec = 0;
+
+	if (type >= SENSOR_LATENCY_MAX || stampPtr == NULL || stampPtr->nsec == 0)
+		return;
+
+	now = SensorClockNsec(stampPtr->clock);
+	usec = (now > stampPtr->nsec) ? (now - stampPtr->nsec) / 1000 : 0;
+
+	gSensorLatency[type].count++;
+	gSensorLatency[type].totalUsec += usec;
+	if (usec > gSensorLatency[type].maxUsec) {
+		gSensorLatency[type].maxUsec = usec;
+	}
+	ESIF_TRACE_DEBUG("%s change signaled %llu usec after kernel change\n", gSensorLatencyNames[type], (unsigned long long)usec);
+}
+
+static void SensorLatencyReport(void)
+{
+	int i = 0;
+
+	for (i = 0; i < SENSOR_LATENCY_MAX; ++i) {
+		if (gSensorLatency[i].count > 0) {
+			ESIF_TRACE_INFO("%s latency: events=%llu avg=%llu usec max=%llu usec\n",
+				gSensorLatencyNames[i],
+				(unsigned long long)gSensorLatency[i].count,
+				(unsigned long long)(gSensorLatency[i].totalUsec / gSensorLatency[i].count),
+				(unsigned long long)gSensorLatency[i].maxUsec);
+		}
+	}
+	esif_ccb_memset(gSensorLatency, 0, sizeof(gSensorLatency));
+}
 
-/* SIGUSR1 Signal Handler */
-static void sigusr1_handler(int signum)
+static void SignalSensorEvent(eEsifEventType eventType, UInt32 value, SensorLatencyType latencyType, const SensorStampPtr stampPtr)
 {
-	pthread_exit(0);
+	EsifData evtData = { 0 };
+
+	SensorLatencyRecord(latencyType, stampPtr);
+	ESIF_DATA_UINT32_ASSIGN(evtData, &value, sizeof(UInt32));
+	EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, eventType, &evtData);
 }
 
-/* Enable or Disable SIGTERM Handler */
-static void sigusr1_enable()
+static void WakeSensorMgr(void)
 {
-	struct sigaction action={0};
-	action.sa_handler = sigusr1_handler;
-	sigaction(SIGUSR1, &action, NULL);
+	eventfd_t one = 1;
+
+	if (gFdWake >= 0) {
+		eventfd_write(gFdWake, one);
+	}
 }
 
 static int IioDeviceFilter(const struct dirent *entry)
@@ -204,6 +322,269 @@ static void AccelOpenFileDescriptors(SensorPtr sensorPtr, char *fullPath)
 	sensorPtr->data.accel.fdZ = open(axixNodePath, O_RDONLY);
 }
 
+static clockid_t IioGetTimestampClock(const char *fullPath)
+{
+	char clockName[IIO_STR_LEN] = { 0 };
+	clockid_t clock = CLOCK_REALTIME; // IIO default
+
+	if (SysfsGetString((char *)fullPath, "current_timestamp_clock", clockName, sizeof(clockName)) > 0) {
+		if (esif_ccb_strcmp(clockName, "monotonic") == 0) {
+			clock = CLOCK_MONOTONIC;
+		} else if (esif_ccb_strcmp(clockName, "monotonic_raw") == 0) {
+			clock = CLOCK_MONOTONIC_RAW;
+		} else if (esif_ccb_strcmp(clockName, "boottime") == 0) {
+			clock = CLOCK_BOOTTIME;
+		}
+	}
+	return clock;
+}
+
+// Parse scan_elements/<channel>_type, e.g. "le:s16/16>>0"
+static Bool IioParseChannelType(const char *typeStr, IioChannelPtr channelPtr)
+{
+	char endian = 0;
+	char sign = 0;
+	unsigned int bits = 0;
+	unsigned int storage = 0;
+	unsigned int shift = 0;
+
+	if (esif_ccb_sscanf(typeStr, "%ce:%c%u/%u>>%u", &endian, &sign, &bits, &storage, &shift) != 5)
+		return ESIF_FALSE;
+	if (bits == 0 || bits > storage || (storage != 8 && storage != 16 && storage != 32 && storage != 64))
+		return ESIF_FALSE;
+
+	channelPtr->isBigEndian = (endian == 'b');
+	channelPtr->isSigned = (sign == 's' || sign == 'S');
+	channelPtr->bits = (UInt8)bits;
+	channelPtr->bytes = (UInt8)(storage / 8);
+	channelPtr->shift = (UInt8)shift;
+	return ESIF_TRUE;
+}
+
+static Int64 IioChannelValue(const IioChannelPtr channelPtr, const UInt8 *scan)
+{
+	UInt64 value = 0;
+	UInt8 i = 0;
+
+	for (i = 0; i < channelPtr->bytes; ++i) {
+		UInt8 pos = (channelPtr->isBigEndian ? i : (UInt8)(channelPtr->bytes - 1 - i));
+		value = (value << 8) | scan[channelPtr->offset + pos];
+	}
+	value >>= channelPtr->shift;
+	if (channelPtr->bits < 64) {
+		UInt64 mask = ((UInt64)1 << channelPtr->bits) - 1;
+		value &= mask;
+		if (channelPtr->isSigned && (value & ((UInt64)1 << (channelPtr->bits - 1)))) {
+			value |= ~mask;
+		}
+	}
+	return (Int64)value;
+}
+
+// Disable every scan element except the ones this manager reads so the scan layout is known
+static void IioSelectScanElements(const char *fullPath)
+{
+	char scanPath[MAX_PATH] = { 0 };
+	DIR *dir = NULL;
+	struct dirent *entry = NULL;
+
+	esif_ccb_sprintf(sizeof(scanPath), scanPath, "%s/scan_elements", fullPath);
+	dir = opendir(scanPath);
+	if (NULL == dir)
+		return;
+
+	while ((entry = readdir(dir)) != NULL) {
+		size_t len = esif_ccb_strlen(entry->d_name, sizeof(entry->d_name));
+		Bool isWanted = ESIF_FALSE;
+		int i = 0;
+
+		if (len < 3 || esif_ccb_strcmp(entry->d_name + len - 3, "_en") != 0)
+			continue;
+		for (i = 0; i < IIO_CHANNEL_MAX; ++i) {
+			size_t nameLen = esif_ccb_strlen(gScanElementNames[i], IIO_STR_LEN);
+			if (len == nameLen + 3 && esif_ccb_strncmp(entry->d_name, gScanElementNames[i], nameLen) == 0) {
+				isWanted = ESIF_TRUE;
+			}
+		}
+		SysfsSetString(scanPath, entry->d_name, (isWanted ? "1" : "0"));
+	}
+	closedir(dir);
+}
+
+/*
+ * Pick the lowest advertised sampling frequency that still fills the buffer
+ * watermark at least once per ESIF_IIO_SAMPLE_PERIOD (or the fastest one if all
+ * are slower) and return the rate the device reports afterwards; 0 if unknown.
+ */
+static float IioSetSamplingFrequency(char *fullPath)
+{
+	char available[MAX_PATH] = { 0 };
+	char chosen[IIO_STR_LEN] = { 0 };
+	char fastest[IIO_STR_LEN] = { 0 };
+	float chosenRate = 0.0;
+	float fastestRate = 0.0;
+	float rate = 0.0;
+	char *token = NULL;
+	char *context = NULL;
+
+	if (SysfsGetString(fullPath, "sampling_frequency_available", available, sizeof(available)) > 0) {
+		for (token = esif_ccb_strtok(available, " \t\n", &context); token != NULL; token = esif_ccb_strtok(NULL, " \t\n", &context)) {
+			float candidate = (float)atof(token);
+			if (candidate >= IIO_SAMPLING_FREQUENCY_MIN && (chosenRate == 0.0 || candidate < chosenRate)) {
+				chosenRate = candidate;
+				esif_ccb_strcpy(chosen, token, sizeof(chosen));
+			}
+			if (candidate > fastestRate) {
+				fastestRate = candidate;
+				esif_ccb_strcpy(fastest, token, sizeof(fastest));
+			}
+		}
+	}
+	if (chosenRate == 0.0) {
+		if (fastestRate > 0.0) {
+			esif_ccb_strcpy(chosen, fastest, sizeof(chosen));
+		}
+		else {
+			esif_ccb_sprintf(sizeof(chosen), chosen, "%.1f", IIO_SAMPLING_FREQUENCY_MIN);
+		}
+	}
+	SysfsSetString(fullPath, "sampling_frequency", chosen);
+
+	if (SysfsGetFloat(fullPath, "sampling_frequency", &rate) != ESIF_OK || rate < 0.0) {
+		rate = 0.0;
+	}
+	return rate;
+}
+
+/*
+ * Switch an accelerometer to buffered reads from its IIO character device so
+ * samples are delivered by the kernel in batches of IIO_BUFFER_LENGTH scans at
+ * a low sampling frequency. Fall back to polling the raw sysfs nodes if the
+ * device has no buffer, another client (iio-sensor-proxy, iioservice, ...)
+ * already has it enabled, or the rate and watermark cannot be configured.
+ */
+static void AccelOpenBuffer(SensorPtr sensorPtr, char *fullPath, char *devName)
+{
+	AccelerometerPtr accelPtr = NULL;
+	char attrName[MAX_PATH] = { 0 };
+	char typeStr[IIO_STR_LEN] = { 0 };
+	char devNodePath[MAX_PATH] = { 0 };
+	size_t offset = 0;
+	size_t maxBytes = 1;
+	int isEnabled = 0;
+	int watermark = 0;
+	float rate = 0.0;
+	Bool isPlaced[IIO_CHANNEL_MAX] = { 0 };
+	int i = 0;
+	int j = 0;
+
+	if (!sensorPtr)
+		return;
+
+	accelPtr = &sensorPtr->data.accel;
+	accelPtr->fdBuffer = -1;
+	esif_ccb_strcpy(accelPtr->devPath, fullPath, sizeof(accelPtr->devPath));
+
+	for (i = 0; i < IIO_CHANNEL_MAX; ++i) {
+		IioChannelPtr channelPtr = &accelPtr->channels[i];
+		int index = 0;
+
+		esif_ccb_memset(channelPtr, 0, sizeof(*channelPtr));
+		esif_ccb_sprintf(sizeof(attrName), attrName, "scan_elements/%s_type", gScanElementNames[i]);
+		if (SysfsGetString(fullPath, attrName, typeStr, sizeof(typeStr)) <= 0 ||
+			!IioParseChannelType(typeStr, channelPtr)) {
+			continue;
+		}
+		esif_ccb_sprintf(sizeof(attrName), attrName, "scan_elements/%s_index", gScanElementNames[i]);
+		if (SysfsGetInt(fullPath, attrName, &index) != ESIF_OK || index < 0) {
+			continue;
+		}
+		channelPtr->index = (UInt32)index;
+		channelPtr->isEnabled = ESIF_TRUE;
+	}
+
+	// All three axes are required; the timestamp is optional
+	if (!accelPtr->channels[IIO_CHANNEL_X].isEnabled ||
+		!accelPtr->channels[IIO_CHANNEL_Y].isEnabled ||
+		!accelPtr->channels[IIO_CHANNEL_Z].isEnabled) {
+		return;
+	}
+
+	// Channels are laid out in index order, each aligned to its own storage size
+	for (i = 0; i < IIO_CHANNEL_MAX; ++i) {
+		IioChannelPtr channelPtr = NULL;
+		int next = -1;
+
+		for (j = 0; j < IIO_CHANNEL_MAX; ++j) {
+			if (accelPtr->channels[j].isEnabled && !isPlaced[j] &&
+				(next < 0 || accelPtr->channels[j].index < accelPtr->channels[next].index)) {
+				next = j;
+			}
+		}
+		if (next < 0)
+			break;
+
+		channelPtr = &accelPtr->channels[next];
+		offset = (offset + channelPtr->bytes - 1) / channelPtr->bytes * channelPtr->bytes;
+		channelPtr->offset = offset;
+		offset += channelPtr->bytes;
+		maxBytes = esif_ccb_max(maxBytes, (size_t)channelPtr->bytes);
+		isPlaced[next] = ESIF_TRUE;
+	}
+	accelPtr->scanBytes = (offset + maxBytes - 1) / maxBytes * maxBytes;
+	if (accelPtr->scanBytes == 0 || accelPtr->scanBytes > IIO_MAX_SCAN_BYTES) {
+		return;
+	}
+
+	// Never reconfigure a buffer that another client has enabled
+	if (SysfsGetInt(fullPath, "buffer/enable", &isEnabled) != ESIF_OK || isEnabled != 0) {
+		ESIF_TRACE_DEBUG("IIO buffer for %s is unavailable or in use; polling raw values\n", devName);
+		return;
+	}
+
+	// The buffer must be disabled while it is configured
+	rate = IioSetSamplingFrequency(fullPath);
+	if (rate <= 0.0) {
+		ESIF_TRACE_DEBUG("Unable to set the sampling frequency for %s; polling raw values\n", devName);
+		return;
+	}
+	IioSelectScanElements(fullPath);
+	esif_ccb_sprintf(sizeof(attrName), attrName, "%d", IIO_BUFFER_LENGTH * IIO_BUFFER_SLACK);
+	SysfsSetString(fullPath, "buffer/length", attrName);
+	esif_ccb_sprintf(sizeof(attrName), attrName, "%d", IIO_BUFFER_LENGTH);
+	SysfsSetString(fullPath, "buffer/watermark", attrName);
+	if (SysfsGetInt(fullPath, "buffer/watermark", &watermark) != ESIF_OK || watermark != IIO_BUFFER_LENGTH) {
+		ESIF_TRACE_DEBUG("Unable to set the buffer watermark for %s; polling raw values\n", devName);
+		return;
+	}
+	SysfsSetString(fullPath, "buffer/enable", "1");
+	if (SysfsGetInt(fullPath, "buffer/enable", &isEnabled) != ESIF_OK || isEnabled != 1) {
+		ESIF_TRACE_DEBUG("IIO buffer unavailable for %s; polling raw values\n", devName);
+		return;
+	}
+
+	esif_ccb_sprintf(sizeof(devNodePath), devNodePath, "/dev/%s", devName);
+	accelPtr->fdBuffer = open(devNodePath, O_RDONLY | O_NONBLOCK);
+	if (accelPtr->fdBuffer < 0) {
+		SysfsSetString(fullPath, "buffer/enable", "0");
+		ESIF_TRACE_DEBUG("Unable to open %s; polling raw values\n", devNodePath);
+		return;
+	}
+	accelPtr->timestampClock = IioGetTimestampClock(fullPath);
+	ESIF_TRACE_DEBUG("Using buffered reads for %s (%zu byte scans, %.3f Hz, %d scans per wakeup)\n",
+		devName, accelPtr->scanBytes, rate, IIO_BUFFER_LENGTH);
+}
+
+// Stop buffered reads; the accelerometer is polled through its raw nodes from then on
+static void AccelCloseBuffer(AccelerometerPtr accelPtr)
+{
+	if (accelPtr->fdBuffer >= 0) {
+		close(accelPtr->fdBuffer);
+		accelPtr->fdBuffer = -1;
+		SysfsSetString(accelPtr->devPath, "buffer/enable", "0");
+	}
+}
+
 static void LidAngleOpenFileDescriptors(SensorPtr sensorPtr, char *fullPath)
 {
 	char nodePath[MAX_PATH] = { 0 };
@@ -232,6 +613,7 @@ static void InitSensor(int index, char *devName)
 			AccelGetLoc(sensorPtr, fullPath);
 			AccelGetScale(sensorPtr, fullPath);
 			AccelOpenFileDescriptors(sensorPtr, fullPath);
+			AccelOpenBuffer(sensorPtr, fullPath, devName);
 		} else if (esif_ccb_strstr(iioSysfsNode, "lid-angle")) {
 			sensorPtr->base.type = SENSOR_TYPE_LID_ANGLE;
 			LidAngleOpenFileDescriptors(sensorPtr, fullPath);
@@ -248,6 +630,7 @@ static void DeinitSensor(int index)
 		if (fd > 0) close(fd);
 		fd = gSensors[index].data.accel.fdZ;
 		if (fd > 0) close(fd);
+		AccelCloseBuffer(&gSensors[index].data.accel);
 	} else if (SENSOR_TYPE_LID_ANGLE == gSensors[index].base.type) {
 		int fd = gSensors[index].data.lidAngle.fdAngle;
 		if (fd > 0) close(fd);
@@ -350,6 +733,31 @@ static void AccelRawUpdate(SensorPtr sensorPtr)
 	}
 }
 
+// Read all buffered scans; the most recent one becomes the current raw value
+static Bool AccelBufferUpdate(SensorPtr sensorPtr, SensorStampPtr stampPtr)
+{
+	AccelerometerPtr accelPtr = NULL;
+	UInt8 scans[IIO_MAX_SCAN_BYTES * IIO_BUFFER_LENGTH];
+	UInt8 *lastScan = NULL;
+	ssize_t len = 0;
+
+	if (!sensorPtr)
+		return ESIF_FALSE;
+
+	accelPtr = &sensorPtr->data.accel;
+	while ((len = read(accelPtr->fdBuffer, scans, accelPtr->scanBytes * IIO_BUFFER_LENGTH)) >= (ssize_t)accelPtr->scanBytes) {
+		lastScan = scans + ((len / accelPtr->scanBytes) - 1) * accelPtr->scanBytes;
+		accelPtr->xRaw = (int)IioChannelValue(&accelPtr->channels[IIO_CHANNEL_X], lastScan);
+		accelPtr->yRaw = (int)IioChannelValue(&accelPtr->channels[IIO_CHANNEL_Y], lastScan);
+		accelPtr->zRaw = (int)IioChannelValue(&accelPtr->channels[IIO_CHANNEL_Z], lastScan);
+		if (accelPtr->channels[IIO_CHANNEL_TIMESTAMP].isEnabled) {
+			stampPtr->clock = accelPtr->timestampClock;
+			stampPtr->nsec = (UInt64)IioChannelValue(&accelPtr->channels[IIO_CHANNEL_TIMESTAMP], lastScan);
+		}
+	}
+	return (lastScan != NULL);
+}
+
 static AccelerometerData NormalizeAccelRawData(SensorPtr sensorPtr)
 {
 	AccelerometerData data = { 0 };
@@ -364,11 +772,10 @@ static AccelerometerData NormalizeAccelRawData(SensorPtr sensorPtr)
 	return data;
 };
 
-static void CheckDispPlatOrientation(SensorPtr sensorPtr)
+static void CheckDispPlatOrientation(SensorPtr sensorPtr, const SensorStampPtr stampPtr)
 {
 	PlatformOrientation newPlatOrientation = ORIENTATION_PLAT_MAX;
 	DisplayOrientation newDispOrientation = ORIENTATION_DISP_MAX;
-	EsifData evtData = { 0 };
 
 	if (!sensorPtr)
 		return;
@@ -383,22 +790,19 @@ static void CheckDispPlatOrientation(SensorPtr sensorPtr)
 			&newDispOrientation);
 
 	if (newDispOrientation != gDispOrientation) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &newDispOrientation, sizeof(DisplayOrientation));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_DISPLAY_ORIENTATION_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_DISPLAY_ORIENTATION_CHANGED, (UInt32)newDispOrientation, SENSOR_LATENCY_ACCEL, stampPtr);
 		gDispOrientation = newDispOrientation;
 	}
 
 	if (newPlatOrientation != gPlatOrientation) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &newPlatOrientation, sizeof(PlatformOrientation));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_DEVICE_ORIENTATION_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_DEVICE_ORIENTATION_CHANGED, (UInt32)newPlatOrientation, SENSOR_LATENCY_ACCEL, stampPtr);
 		gPlatOrientation = newPlatOrientation;
 	}
 }
 
 
-static void CheckMotionChange(SensorPtr sensorPtr)
+static void CheckMotionChange(SensorPtr sensorPtr, const SensorStampPtr stampPtr)
 {
-	EsifData evtData = { 0 };
 	float delta = 0;
 	AccelerometerData data = { 0 };
 	Motion newMotionState = MOTION_OFF;
@@ -415,16 +819,14 @@ static void CheckMotionChange(SensorPtr sensorPtr)
 	}
 
 	if (newMotionState != gInMotion) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &newMotionState, sizeof(UInt32));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_MOTION_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_MOTION_CHANGED, (UInt32)newMotionState, SENSOR_LATENCY_ACCEL, stampPtr);
 		gInMotion = newMotionState;
 	}
 	gCurAccelData = data;
 }
 
-static void CheckPlatTypeChange(SensorPtr sensorPtr)
+static void CheckPlatTypeChange(SensorPtr sensorPtr, const SensorStampPtr stampPtr)
 {
-	EsifData evtData = { 0 };
 	PlatformType newPlatType = PLATFORM_TYPE_INVALID;
 	int fd = 0;
 
@@ -447,18 +849,16 @@ static void CheckPlatTypeChange(SensorPtr sensorPtr)
 		}
 
 		if (newPlatType != gPlatType) {
-			ESIF_DATA_UINT32_ASSIGN(evtData, &newPlatType, sizeof(UInt32));
-			EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_OS_PLATFORM_TYPE_CHANGED, &evtData);
+			SignalSensorEvent(ESIF_EVENT_OS_PLATFORM_TYPE_CHANGED, (UInt32)newPlatType, SENSOR_LATENCY_LID_ANGLE, stampPtr);
 			gPlatType = newPlatType;
 		}
 	}
 }
 
-static void CheckDockModeChange(void)
+static void CheckDockModeChange(const SensorStampPtr stampPtr)
 {
 	DockMode dockMode = DOCK_MODE_INVALID;
 	char sysvalstring[MAX_SYSFS_STRING] = { 0 };
-	EsifData evtData = { 0 };
 
 	if (gFdDocking > 0) {
 		lseek(gFdDocking, 0 , SEEK_SET);
@@ -471,17 +871,15 @@ static void CheckDockModeChange(void)
 	}
 
 	if (dockMode != gDockMode) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &dockMode, sizeof(UInt32));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_OS_DOCK_MODE_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_OS_DOCK_MODE_CHANGED, (UInt32)dockMode, SENSOR_LATENCY_DOCK_MODE, stampPtr);
 		gDockMode = dockMode;
 	}
 }
 
-static void CheckLidStateChange(void)
+static void CheckLidStateChange(const SensorStampPtr stampPtr)
 {
 	LidState lidState = LID_STATE_CLOSED;
 	char sysvalstring[MAX_SYSFS_STRING] = { 0 };
-	EsifData evtData = { 0 };
 
 	if (gFdLidState > 0) {
 		lseek(gFdLidState, 0 , SEEK_SET);
@@ -494,17 +892,15 @@ static void CheckLidStateChange(void)
 	}
 
 	if (lidState != gLidState) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &lidState, sizeof(UInt32));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_OS_LID_STATE_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_OS_LID_STATE_CHANGED, (UInt32)lidState, SENSOR_LATENCY_LID_STATE, stampPtr);
 		gLidState = lidState;
 	}
 }
 
-static void CheckPowerSrcChange(void)
+static void CheckPowerSrcChange(const SensorStampPtr stampPtr)
 {
 	PowerSrc powerSrc = POWER_SRC_AC;
 	char sysvalstring[MAX_SYSFS_STRING] = { 0 };
-	EsifData evtData = { 0 };
 
 	if (gFdPowerSrc > 0) {
 		lseek(gFdPowerSrc, 0 , SEEK_SET);
@@ -517,17 +913,15 @@ static void CheckPowerSrcChange(void)
 	}
 
 	if (powerSrc != gPowerSrc) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &powerSrc, sizeof(UInt32));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_OS_POWER_SOURCE_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_OS_POWER_SOURCE_CHANGED, (UInt32)powerSrc, SENSOR_LATENCY_POWER_SRC, stampPtr);
 		gPowerSrc = powerSrc;
 	}
 }
 
-static void CheckBatteryPercentChange(void)
+static void CheckBatteryPercentChange(const SensorStampPtr stampPtr)
 {
 	int batteryPercentage = 0;
 	char sysvalstring[MAX_SYSFS_STRING] = { 0 };
-	EsifData evtData = { 0 };
 
 	if (gFdBattCharge > 0) {
 		lseek(gFdBattCharge, 0, SEEK_SET);
@@ -539,58 +933,170 @@ static void CheckBatteryPercentChange(void)
 	}
 
 	if (batteryPercentage != gBatteryPercentage) {
-		ESIF_DATA_UINT32_ASSIGN(evtData, &batteryPercentage, sizeof(UInt32));
-		EsifEventMgr_SignalEvent(ESIF_HANDLE_PRIMARY_PARTICIPANT, EVENT_MGR_DOMAIN_D0, ESIF_EVENT_OS_BATTERY_PERCENT_CHANGED, &evtData);
+		SignalSensorEvent(ESIF_EVENT_OS_BATTERY_PERCENT_CHANGED, (UInt32)batteryPercentage, SENSOR_LATENCY_BATTERY, stampPtr);
 		gBatteryPercentage = batteryPercentage;
 	}
 }
 
-static void *EsifIio_Poll(void *ptr)
+// Sources that cannot notify of changes are re-read every ESIF_IIO_SAMPLE_PERIOD
+static Bool SensorMgrNeedsPolling(void)
+{
+	return (gAccelLid && gAccelLid->data.accel.fdBuffer < 0) ||
+		(gAccelBase && gAccelBase->data.accel.fdBuffer < 0) ||
+		(gLidAngle && gLidAngle->data.lidAngle.fdAngle > 0) ||
+		(gFdLidState > 0) ||
+		(!atomic_read(&gPowerSupplyUevents) && (gFdPowerSrc > 0 || gFdBattCharge > 0));
+}
+
+/*
+ * Wait for the kernel to report changes: buffered IIO scans, sysfs_notify() on
+ * the docking attribute and power_supply uevents forwarded by the uevent
+ * listener. Sources without a notification mechanism (raw IIO nodes, lid angle
+ * and the procfs lid state) are still polled, but only when one of them exists.
+ * For polled sources the change time is when the poll detected it, so their
+ * latency does not include the time spent waiting for the next poll.
+ */
+static void *EsifSensorMgr_Monitor(void *ptr)
 {
+	struct pollfd fds[SENSOR_MAX_POLL_FDS];
+	UInt64 nextPollNsec = 0;
+	Bool isFirstPass = ESIF_TRUE;
+
 	UNREFERENCED_PARAMETER(ptr);
 
-#ifdef ESIF_ATTR_OS_ANDROID
-	sigusr1_enable();
-#endif
+	while (gEsifSensorMgrStarted) {
+		SensorStamp wakeStamp = { 0 };
+		SensorStamp lidStamp = { 0 };
+		SensorStamp baseStamp = { 0 };
+		Bool isPollDue = ESIF_FALSE;
+		Bool isLidUpdated = ESIF_FALSE;
+		Bool isBaseUpdated = ESIF_FALSE;
+		int lidIndex = -1;
+		int baseIndex = -1;
+		int dockIndex = -1;
+		int timeout = -1;
+		nfds_t nfds = 0;
+
+		esif_ccb_memset(fds, 0, sizeof(fds));
+		fds[nfds].fd = gFdWake;
+		fds[nfds++].events = POLLIN;
+		if (gAccelLid && gAccelLid->data.accel.fdBuffer >= 0) {
+			lidIndex = (int)nfds;
+			fds[nfds].fd = gAccelLid->data.accel.fdBuffer;
+			fds[nfds++].events = POLLIN;
+		}
+		if (gAccelBase && gAccelBase->data.accel.fdBuffer >= 0) {
+			baseIndex = (int)nfds;
+			fds[nfds].fd = gAccelBase->data.accel.fdBuffer;
+			fds[nfds++].events = POLLIN;
+		}
+		if (gFdDocking > 0) {
+			dockIndex = (int)nfds;
+			fds[nfds].fd = gFdDocking;
+			fds[nfds++].events = POLLPRI | POLLERR;
+		}
+
+		if (!isFirstPass) {
+			if (SensorMgrNeedsPolling()) {
+				UInt64 now = SensorClockNsec(CLOCK_MONOTONIC);
+				timeout = (now >= nextPollNsec) ? 0 : (int)((nextPollNsec - now + 999999) / 1000000);
+			}
+			if (poll(fds, nfds, timeout) < 0) {
+				if (EINTR == errno)
+					continue;
+				ESIF_TRACE_ERROR("Sensor manager poll failed: %s\n", strerror(errno));
+				break;
+			}
+		}
+		if (!gEsifSensorMgrStarted)
+			break;
+
+		SensorStampNow(&wakeStamp);
+		if (isFirstPass || wakeStamp.nsec >= nextPollNsec) {
+			isPollDue = ESIF_TRUE;
+			nextPollNsec = wakeStamp.nsec + ((UInt64)ESIF_IIO_SAMPLE_PERIOD * 1000000000ULL);
+		}
+
+		if (fds[0].revents & POLLIN) {
+			eventfd_t value = 0;
+			eventfd_read(gFdWake, &value);
+		}
 
-	while(gEsifSensorMgrStarted) {
 		// Update sensor values
+		lidStamp = wakeStamp;
+		baseStamp = wakeStamp;
+		// A buffer that reports an error (for example because the device was removed) would make poll() return
+		// immediately forever, so drop back to polling the raw nodes
+		if (lidIndex >= 0 && (fds[lidIndex].revents & (POLLERR | POLLHUP | POLLNVAL))) {
+			ESIF_TRACE_WARN("Lid accelerometer buffer failed; polling raw values\n");
+			AccelCloseBuffer(&gAccelLid->data.accel);
+			lidIndex = -1;
+		}
+		if (baseIndex >= 0 && (fds[baseIndex].revents & (POLLERR | POLLHUP | POLLNVAL))) {
+			ESIF_TRACE_WARN("Base accelerometer buffer failed; polling raw values\n");
+			AccelCloseBuffer(&gAccelBase->data.accel);
+			baseIndex = -1;
+		}
+
 		if (gAccelLid) {
-			AccelRawUpdate(gAccelLid);
+			if (lidIndex >= 0) {
+				if (isFirstPass || (fds[lidIndex].revents & POLLIN)) {
+					isLidUpdated = AccelBufferUpdate(gAccelLid, &lidStamp);
+				}
+			} else if (isPollDue) {
+				AccelRawUpdate(gAccelLid);
+				isLidUpdated = ESIF_TRUE;
+			}
 		}
 
 		if (gAccelBase) {
-			AccelRawUpdate(gAccelBase);
+			if (baseIndex >= 0) {
+				if (isFirstPass || (fds[baseIndex].revents & POLLIN)) {
+					isBaseUpdated = AccelBufferUpdate(gAccelBase, &baseStamp);
+				}
+			} else if (isPollDue) {
+				AccelRawUpdate(gAccelBase);
+				isBaseUpdated = ESIF_TRUE;
+			}
 		}
 
 		// Platform and display orientation are only valid if the lid accel is present
-		if (gAccelLid) {
-			CheckDispPlatOrientation(gAccelLid);
+		if (isLidUpdated) {
+			CheckDispPlatOrientation(gAccelLid, &lidStamp);
 		}
 
 		// Motion detection
 		if (gAccelLid) {
-			CheckMotionChange(gAccelLid);
-		} else if (gAccelBase) {
-			CheckMotionChange(gAccelBase);
+			if (isLidUpdated) {
+				CheckMotionChange(gAccelLid, &lidStamp);
+			}
+		} else if (isBaseUpdated) {
+			CheckMotionChange(gAccelBase, &baseStamp);
 		}
 
-		// Dock mode change detection
-		CheckDockModeChange();
-
-		// Power source change detection
-		CheckPowerSrcChange();
-
-		// Battery percent change detection
-		CheckBatteryPercentChange();
+		// Dock mode change detection; reading the attribute re-arms the notification
+		if (isFirstPass || (dockIndex >= 0 && (fds[dockIndex].revents & (POLLPRI | POLLERR)))) {
+			CheckDockModeChange(&wakeStamp);
+		}
 
-		// Lid state change detection
-		CheckLidStateChange();
+		// Power source and battery percent change detection
+		if (atomic_cmpxchg(&gPowerSupplyChanged, 1, 0) == 1) {
+			SensorStamp ueventStamp = { CLOCK_MONOTONIC, (UInt64)atomic64_read(&gPowerSupplyChangeNsec) };
+			CheckPowerSrcChange(&ueventStamp);
+			CheckBatteryPercentChange(&ueventStamp);
+		} else if (isFirstPass || (isPollDue && !atomic_read(&gPowerSupplyUevents))) {
+			CheckPowerSrcChange(&wakeStamp);
+			CheckBatteryPercentChange(&wakeStamp);
+		}
 
-		// Platform type change detection (clamshell, tablet, tent, etc.)
-		CheckPlatTypeChange(gLidAngle);
+		if (isPollDue) {
+			// Lid state change detection
+			CheckLidStateChange(&wakeStamp);
 
-		esif_ccb_sleep(ESIF_IIO_SAMPLE_PERIOD);
+			// Platform type change detection (clamshell, tablet, tent, etc.)
+			CheckPlatTypeChange(gLidAngle, &wakeStamp);
+		}
+		isFirstPass = ESIF_FALSE;
 	}
 
 	return NULL;
@@ -602,13 +1108,18 @@ static void StartEsifSensorMgr()
 	eEsifError rc2 = ESIF_OK;
 
 	if (!gEsifSensorMgrStarted) {
+		if (gFdWake < 0) {
+			ESIF_TRACE_ERROR("ESIF Sensor Manager: no wake event, abort\n");
+			return;
+		}
+
 		ESIF_TRACE_DEBUG("Starting ESIF Sensor Manager\n");
 		rc1 = EsifSensorMgr_RegisterSensors();
 		rc2 = EsifSensorMgr_InitializeNonIioBusSensors();
 
 		if (ESIF_OK == rc1 || ESIF_OK == rc2) {
 			gEsifSensorMgrStarted = ESIF_TRUE;
-			esif_ccb_thread_create(&gEsifSensorMgrThread, EsifIio_Poll, NULL);
+			esif_ccb_thread_create(&gEsifSensorMgrThread, EsifSensorMgr_Monitor, NULL);
 		} else {
 			ESIF_TRACE_DEBUG("ESIF Sensor Manager: could not find any sensor, abort\n");
 		}
@@ -620,15 +1131,10 @@ static void StopEsifSensorMgr()
 	if (gEsifSensorMgrStarted) {
 		ESIF_TRACE_DEBUG("Stopping ESIF Sensor Manager...\n");
 		gEsifSensorMgrStarted = ESIF_FALSE;
-#ifdef ESIF_ATTR_OS_ANDROID
-		// Android NDK does not support pthread_cancel()
-		// Use pthread_kill() to emualte
-		pthread_kill(gEsifSensorMgrThread, SIGUSR1);
-#else
-		pthread_cancel(gEsifSensorMgrThread);
-#endif
+		WakeSensorMgr();
 		esif_ccb_thread_join(&gEsifSensorMgrThread);
 		EsifSensorMgr_DeregisterSensors();
+		SensorLatencyReport();
 	}
 }
 
@@ -638,12 +1144,36 @@ static void StopEsifSensorMgr()
 
 void EsifSensorMgr_Init()
 {
-	// Nothing to do
+	gFdWake = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (gFdWake < 0) {
+		ESIF_TRACE_ERROR("Unable to create sensor manager wake event: %s\n", strerror(errno));
+	}
 }
 
 void EsifSensorMgr_Exit()
 {
 	StopEsifSensorMgr();
+	if (gFdWake >= 0) {
+		close(gFdWake);
+		gFdWake = -1;
+	}
+}
+
+/**
+ * Called by the uevent listener. While enabled, power source and battery
+ * changes are taken from power_supply uevents instead of being polled.
+ */
+void EsifSensorMgr_EnablePowerSupplyUevents(Bool isEnabled)
+{
+	atomic_set(&gPowerSupplyUevents, (isEnabled ? 1 : 0));
+	WakeSensorMgr();
+}
+
+void EsifSensorMgr_PowerSupplyChanged()
+{
+	atomic64_set(&gPowerSupplyChangeNsec, (atomic64_basetype)SensorClockNsec(CLOCK_MONOTONIC));
+	atomic_set(&gPowerSupplyChanged, 1);
+	WakeSensorMgr();
 }
 
 /**
@@ -26,6 +26,8 @@ extern "C" {
 
 void EsifSensorMgr_Init();
 void EsifSensorMgr_Exit();
+void EsifSensorMgr_EnablePowerSupplyUevents(Bool isEnabled);
+void EsifSensorMgr_PowerSupplyChanged();
 
 eEsifError esif_register_sensor_lin(eEsifEventType eventType);
 eEsifError esif_unregister_sensor_lin(eEsifEventType eventType);
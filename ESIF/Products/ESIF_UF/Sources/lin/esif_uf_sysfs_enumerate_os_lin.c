@@ -90,7 +90,9 @@ struct thermalZone {
 	char thermalPath[MAX_SYSFS_PATH];
 };
 
-struct thermalZone thermalZones[MAX_PARTICIPANT_ENTRY] = { {0} };
+// Thermal zones and cooling devices found by scanThermal(); grown on demand and freed once registration completes
+static struct thermalZone *g_thermalZones = NULL;
+static int g_zone_capacity = 0;
 
 static void createParticipantsFromThermalSysfs(void)
 {
@@ -106,10 +108,10 @@ static void createParticipantsFromThermalSysfs(void)
 	esif_guid_t classGuidCpu = ESIF_PARTICIPANT_CPU_CLASS_GUID;
 	esif_guid_t *classGuidPtr = &classGuidPlat;
 
-	for (i = 0; i < MAX_PARTICIPANT_ENTRY; i++) {
-		if (ESIF_TRUE == thermalZones[i].bound) continue;
+	for (i = 0; i < (unsigned int)g_zone_count; i++) {
+		if (ESIF_TRUE == g_thermalZones[i].bound) continue;
 		for (j = 0; j < sizeof(partInfo) / sizeof(struct participantInfo); j++) {
-			if (0 == esif_ccb_stricmp(thermalZones[i].acpiCode, partInfo[j].sysfsType)) {
+			if (0 == esif_ccb_stricmp(g_thermalZones[i].acpiCode, partInfo[j].sysfsType)) {
 				// Found a matching sysfs thermal zone/cooling device
 				if (0 == esif_ccb_stricmp(partInfo[j].deviceName, SYSFS_PROCESSOR_HID)) {
 					if (gSocParticipantFound) continue; // No need to instantiate another SoC participant
@@ -127,7 +129,7 @@ static void createParticipantsFromThermalSysfs(void)
 					partInfo[j].desc,
 					"N/A", // driver name - N/A for all Linux implementation
 					partInfo[j].deviceName, // "INT340X"
-					thermalZones[i].thermalPath,
+					g_thermalZones[i].thermalPath,
 					partInfo[j].acpiScope,
 					ESIF_PARTICIPANT_INVALID_TYPE); // Only WWAN/WIFI need to use different types
 
@@ -175,6 +177,11 @@ void SysfsRegisterParticipants ()
 	// commonly known types exposed in sysfs such as "x86_pkg_temp"
 	createParticipantsFromThermalSysfs();
 
+	esif_ccb_free(g_thermalZones);
+	g_thermalZones = NULL;
+	g_zone_capacity = 0;
+	g_zone_count = 0;
+
 	// Special handling for Android OS that may have Java based participants
 	// Possibly add two more Java participants - Display and WWAN - but only if they do not exist yet
 #ifdef ESIF_ATTR_OS_ANDROID
@@ -290,8 +297,8 @@ static int scanPCI(void)
 						}
 						char *ACPI_name = participant_scope + (scope_len - ACPI_DEVICE_NAME_LEN);
 						/* map to thermal zone (try pkg thermal zone first)*/
-						for (thermal_counter=0; thermal_counter <= g_zone_count; thermal_counter++) {
-							struct thermalZone tz = (struct thermalZone)thermalZones[thermal_counter];
+						for (thermal_counter=0; thermal_counter < g_zone_count; thermal_counter++) {
+							struct thermalZone tz = g_thermalZones[thermal_counter];
 							if (esif_ccb_strcmp(tz.acpiCode, ACPI_name)==0) {
 								// Re-initialize the device path to one of the thermal zones
 								esif_ccb_sprintf(MAX_SYSFS_PATH, participant_path, "%s", tz.thermalPath);
@@ -456,7 +463,18 @@ static int scanThermal(void)
 				tz.zoneType = zt;
 				esif_ccb_sprintf(MAX_ZONE_NAME_LEN,tz.acpiCode,"%s",acpi_name);
 				esif_ccb_sprintf(MAX_SYSFS_PATH,tz.thermalPath,"%s",target_path);
-				thermalZones[thermal_counter] = tz;
+
+				if (thermal_counter >= g_zone_capacity) {
+					int new_capacity = (g_zone_capacity ? g_zone_capacity * 2 : MAX_PARTICIPANT_ENTRY);
+					struct thermalZone *new_zones = (struct thermalZone *)esif_ccb_realloc(g_thermalZones, new_capacity * sizeof(*new_zones));
+					if (NULL == new_zones) {
+						ESIF_TRACE_ERROR("Unable to allocate thermal zone %s\n", target_path);
+						goto exit_zone;
+					}
+					g_thermalZones = new_zones;
+					g_zone_capacity = new_capacity;
+				}
+				g_thermalZones[thermal_counter] = tz;
 				thermal_counter++;
 			}
 
@@ -477,11 +495,11 @@ static Bool match_thermal_zone(const char *matchToName, char *participant_path)
 	int thermal_counter = 0;
 	Bool thermalZoneFound = ESIF_FALSE;
 
-	for (thermal_counter=0; thermal_counter <= g_zone_count; thermal_counter++) {
-		struct thermalZone tz = (struct thermalZone)thermalZones[thermal_counter];
+	for (thermal_counter=0; thermal_counter < g_zone_count; thermal_counter++) {
+		struct thermalZone tz = g_thermalZones[thermal_counter];
 		if (esif_ccb_strcmp(tz.acpiCode, matchToName)==0) {
 			thermalZoneFound = ESIF_TRUE;
-			thermalZones[thermal_counter].bound = ESIF_TRUE;
+			g_thermalZones[thermal_counter].bound = ESIF_TRUE;
 			esif_ccb_sprintf(MAX_SYSFS_PATH, participant_path, "%s", tz.thermalPath);
 			break;
 		}
@@ -28,6 +28,7 @@
 #include "esif_uf_ccb_imp_spec.h"
 #include "esif_uf_sysfs_os_lin.h"
 
+#include <signal.h>
 #include <sys/socket.h>
 #include <linux/netlink.h>
 #include <termios.h>
@@ -62,11 +63,7 @@ static esif_thread_t g_udev_thread;
 static Bool g_udev_quit = ESIF_TRUE;
 static char *g_udev_target = NULL;
 
-/* Dedicated thread pool to handle SIGRTMIN timer signals */
-static esif_thread_t *g_sigrtmin_thread_pool;
-static Bool g_os_quit = ESIF_FALSE; /* global flag to supress KW flagging as while(1) alternative */
-
-/* Number of threads in thread pool: default to 1, but will
+/* Number of timer callback threads: default to 1, but will
  * change to the actual number of processore cores if there
  * is support to the _SC_NPROCESSORS_ONLN system configuration
  * at run time. This value can also be overriden by command
@@ -74,8 +71,12 @@ static Bool g_os_quit = ESIF_FALSE; /* global flag to supress KW flagging as whi
  */
 static long g_nproc = 1;
 
+/* Timer coalescing slack in msec; 0 uses the timer manager default */
+static long g_timer_slack_msec = 0;
+
 #define MAX_TIMER_THREADS_AUTO 16 /* max number of timer work threads allowed from auto-detection */
 #define MAX_TIMER_THREADS_CLI 256 /* max number of timer work threads allowed from command line */
+#define MAX_TIMER_SLACK_MSEC 1000 /* max timer coalescing slack allowed from command line */
 #define MAX_PAYLOAD 1024 /* max message size*/
 #define MAX_AUTO_REPOS 4 /* max Repos that can be loaded with -m option */
 #define EVENT_INTERVAL_THRESHOLD 100 /* in ms, the threshold we process successive THERMAL_TABLE_CHANGED events */
@@ -105,6 +106,7 @@ struct instancelock {
 };
 static struct instancelock g_instance = {"esif_ufd.pid"};
 static char device_path[] = "/devices/virtual/thermal/thermal_zone";
+static char power_supply_path[] = "/power_supply/";
 
 #define HOME_DIRECTORY	NULL /* use OS-specific default */
 
@@ -181,7 +183,6 @@ static const esif_string ESIF_PATHLIST =
 */
 extern int g_dst;
 extern int g_binary_buf_size;
-extern int g_errorlevel;
 extern int g_quit;
 extern int g_repeat;
 extern int g_repeat_delay;
@@ -413,6 +414,11 @@ static int check_for_uevent(int fd) {
 				}
 				return 1;
 			}
+			else if (esif_ccb_strstr(buf_ptr + dev_path_len, power_supply_path) != NULL) {
+				/* Battery or adapter changed; the sensor manager re-reads the power supply state */
+				EsifSensorMgr_PowerSupplyChanged();
+				return 1;
+			}
 		}
 		i += esif_ccb_strlen(buffer + i, len - i) + 1;
 	}
@@ -454,62 +460,6 @@ static void sigusr1_enable()
 	sigaction(SIGUSR1, &action, NULL);
 }
 
-static void sigrtmin_block(void)
-{
-	/* Block SIGRTMIN; other threads created from the main thread
-	 * will inherit a copy of the signal mask.
-	 */
-	sigset_t set = {0};
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-	if (pthread_sigmask(SIG_BLOCK, &set, NULL)) {
-		ESIF_TRACE_ERROR("Fail to block SIGRTMIN\n");
-	}
-}
-
-static void *sigrtmin_worker_thread(void *ptr)
-{
-	sigset_t set = {0};
-	siginfo_t info = {0};
-	struct esif_tmrm_cb_obj *cb_object_ptr = NULL;
-
-	UNREFERENCED_PARAMETER(ptr);
-	sigemptyset(&set);
-	sigaddset(&set, SIGRTMIN);
-
-	while (!g_os_quit) { /* This thread will be canceled/killed after esif_uf_exit() */
-		if (-1 == sigwaitinfo(&set, &info)) { /* sigwaitinfo is a cancellation point */
-			/* When there are multiple worker threads waiting for the same signal,
-			 * only one thread will get the signal and its associated info structure,
-			 * and the rest will get an errno of EINTR. In this case, simply continue
-			 * the loop and wait again.
-			 */
-			continue;
-		}
-
-		if (SIGRTMIN != info.si_signo) {
-			ESIF_TRACE_ERROR("Received signal is not SIGRTMIN, ignore\n");
-			continue;
-		}
-
-		cb_object_ptr = (struct esif_tmrm_cb_obj *) info.si_value.sival_ptr;
-		if (cb_object_ptr && cb_object_ptr->func) {
-			cb_object_ptr->func(cb_object_ptr->cb_handle);
-			cb_object_ptr->func = NULL;
-			/* Use native free function instead of esif_ccb_free(). For explanation,
-			 * please see the comments under esif_ccb_timer_obj_enable_timer() in
-			 * file esif_ccb_timer_lin_user.h.
-			 */
-			free(cb_object_ptr);
-		} else {
-			ESIF_TRACE_ERROR("Invalid timer callback object: (obj=%p, func=%p)\n",
-				cb_object_ptr, (cb_object_ptr ? cb_object_ptr->func : NULL));
-		}
-	}
-
-	return NULL;
-}
-
 static long get_nproc(long old, long new, long max)
 {
 	if (new > 0) {
@@ -519,53 +469,6 @@ static long get_nproc(long old, long new, long max)
 	}
 }
 
-static enum esif_rc create_timer_thread_pool(void)
-{
-	int i = 0;
-	enum esif_rc rc = ESIF_OK;
-
-	/* Use native malloc instead of esif_ccb_malloc
-	 * because the poll will be freed after esif_uf_exit().
-	 */
-	g_sigrtmin_thread_pool = (esif_thread_t *) malloc(g_nproc * sizeof(esif_thread_t));
-	if (g_sigrtmin_thread_pool) {
-		pthread_attr_t attr;
-
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_attr_init(&attr);
-			pthread_create(&g_sigrtmin_thread_pool[i], &attr, sigrtmin_worker_thread, NULL);
-			pthread_attr_destroy(&attr);
-		}
-	} else {
-		rc = ESIF_E_NO_MEMORY;
-	}
-
-	return rc;
-}
-
-static void release_timer_thread_pool(void)
-{
-	int i = 0;
-
-	if (g_sigrtmin_thread_pool) {
-		/* All ESIF timers should have been canceled
-		 * after esif_uf_exit() call, so it is safe
-		 * to terminate the g_sigrtmin_thread_pool now.
-		 */
-		for (i = 0; i < g_nproc; ++i) {
-#ifdef ESIF_ATTR_OS_ANDROID
-			pthread_kill(g_sigrtmin_thread_pool[i], SIGRTMIN);
-#else
-			pthread_cancel(g_sigrtmin_thread_pool[i]);
-#endif
-		}
-		for (i = 0; i < g_nproc; ++i) {
-			pthread_join(g_sigrtmin_thread_pool[i], NULL);
-		}
-		free(g_sigrtmin_thread_pool);
-	}
-}
-
 int SysfsGetString(char *path, char *filename, char *str, size_t buf_len)
 {
 	FILE *fd = NULL;
@@ -859,6 +762,7 @@ void register_events_for_available_uf_participants(EnumerableUFParticipants type
 static void esif_udev_exit()
 {
 	g_udev_quit = ESIF_TRUE;
+	EsifSensorMgr_EnablePowerSupplyUevents(ESIF_FALSE);
 #ifdef ESIF_ATTR_OS_ANDROID
 	// Android NDK does not support pthread_cancel()
 	// Use pthread_kill() to emualte
@@ -892,7 +796,9 @@ static void *esif_udev_listen(void *ptr)
 	sock_addr_src.nl_pid = getpid();
 	sock_addr_src.nl_groups = -1;
 
-	bind(sock_fd, (struct sockaddr *)&sock_addr_src, sizeof(sock_addr_src));
+	if (bind(sock_fd, (struct sockaddr *)&sock_addr_src, sizeof(sock_addr_src)) == 0) {
+		EsifSensorMgr_EnablePowerSupplyUevents(ESIF_TRUE);
+	}
 
 	memset(&sock_addr_dest, 0, sizeof(sock_addr_dest));
 	sock_addr_dest.nl_family = AF_NETLINK;
@@ -1165,12 +1071,8 @@ static int run_as_daemon(int start_with_pipe, int start_with_log, int start_in_b
 	}
 	sigterm_enable();
 
-	/* 4. Block SIGRTMIN (will re-enable it in dedicated thread pool) */
-	sigrtmin_block();
-	/* Start the thread pool that handles SIGRTMIN */
-	if (ESIF_OK != create_timer_thread_pool()) {
-		return ESIF_FALSE;
-	}
+	/* 4. Configure the timer callback threads started by esif_uf_init */
+	esif_ccb_tmrm_set_options((u32)g_nproc, (u32)g_timer_slack_msec);
 
 	/* 5. Change to known directory.  Performed in main */
 	/* 6. Close all file descriptors incuding stdin, stdout, stderr */
@@ -1304,12 +1206,8 @@ static int run_as_server(FILE* input, char* command, int quit_after_command)
 	if (!instance_lock()) {
 		return ESIF_FALSE;
 	}
-	sigrtmin_block(); /* Block SIGRTMIN (will re-enable it in dedicated thread pool) */
-	/* Start the thread pool that handles SIGRTMIN */
-	if (ESIF_OK != create_timer_thread_pool()) {
-		CMD_OUT("Cannot create timer thread pool, exiting\n");
-		return ESIF_FALSE;
-	}
+	/* Configure the timer callback threads started by esif_uf_init */
+	esif_ccb_tmrm_set_options((u32)g_nproc, (u32)g_timer_slack_msec);
 	sigterm_enable();
 	esif_shell_set_start_script(ESIF_STARTUP_SCRIPT_SERVER_MODE);
 	esif_uf_init();
@@ -1436,7 +1334,7 @@ int main (int argc, char **argv)
 
 	optind = 1;	// Rest To 1 Restart Vector Scan
 
-	while ((c = getopt(argc, argv, "d:f:c:b:r:i:g:a:xqtsnzplhv?")) != -1) {
+	while ((c = getopt(argc, argv, "d:f:c:b:r:i:g:k:e:a:xqtsnzplhv?")) != -1) {
 		switch (c) {
 		case 'd':
 			g_dst = (esif_handle_t)esif_atoi64(optarg);
@@ -1480,6 +1378,14 @@ int main (int argc, char **argv)
 			g_nproc = get_nproc(g_nproc, esif_atoi(optarg), MAX_TIMER_THREADS_CLI);
 			break;
 
+		case 'k':
+			g_timer_slack_msec = get_nproc(g_timer_slack_msec, esif_atoi(optarg), MAX_TIMER_SLACK_MSEC);
+			break;
+
+		case 'e':
+			g_esifEventWorkers = (UInt32)get_nproc(g_esifEventWorkers, esif_atoi(optarg), ESIF_UF_EVENT_WORKERS_MAX);
+			break;
+
 		case 'a':
 			if (repolistlen < MAX_AUTO_REPOS) {
 				repolist[repolistlen++] = optarg;
@@ -1529,6 +1435,8 @@ int main (int argc, char **argv)
 			"-r [*msec]          Set IPC Retry Timeout in msec\n"
 			"-i [*msec]          Set IPC Retry Interval in msec\n"
 			"-g [*pool size]     Set Number of Threads to Handle Timer Functions\n"
+			"-k [*msec]          Set Timer Coalescing Slack in msec\n"
+			"-e [*pool size]     Set Number of Threads to Deliver Events\n"
 			"-a [*filename]      Automatically Load Data Repository File on Startup\n"
 #if defined (ESIF_ATTR_DAEMON)
 			"-t or 'reload'      Terminate and Reload Daemon or Server\n"
@@ -1626,10 +1534,6 @@ int main (int argc, char **argv)
 	/* Exit ESIF */
 	esif_uf_exit();
 
-	/* Stop and join the SIGRTMIN worker thread */
-	g_os_quit = ESIF_TRUE;
-	release_timer_thread_pool();
-
 	/* Release Instance Lock and exit*/
 	instance_unlock();
 	esif_main_exit();
@@ -267,6 +267,46 @@ char *EsifWsShellExec(char *cmd, size_t cmd_len, char *prefix, size_t prefix_len
 	return result;
 }
 
+// Create a Shell Execution Context, or return NULL to execute commands using the Global Shell
+void *EsifWsShellCtxCreate(void)
+{
+	void *result = NULL;
+
+	// Web Interface only; ESIF/App Interface commands are always executed by the Global Shell
+	if (g_ifaceWs) {
+		EsifWsInterfacePtr self = g_ifaceWs;
+		if (self->tEsifWsShellCtxCreateFuncPtr) {
+			result = self->tEsifWsShellCtxCreateFuncPtr();
+		}
+	}
+	return result;
+}
+
+void EsifWsShellCtxDestroy(void *ctx)
+{
+	if (ctx && g_ifaceWs) {
+		EsifWsInterfacePtr self = g_ifaceWs;
+		if (self->tEsifWsShellCtxDestroyFuncPtr) {
+			self->tEsifWsShellCtxDestroyFuncPtr(ctx);
+		}
+	}
+}
+
+// Execute a Shell Command in a Shell Execution Context, or the Global Shell if none
+char *EsifWsShellCtxExec(void *ctx, char *cmd, size_t cmd_len, char *prefix, size_t prefix_len)
+{
+	char *result = NULL;
+
+	if (ctx && g_ifaceWs && g_ifaceWs->tEsifWsShellCtxExecFuncPtr) {
+		// Calls into ESIF_UF, which calls back into EsifWsAlloc()
+		result = g_ifaceWs->tEsifWsShellCtxExecFuncPtr(ctx, cmd, cmd_len, prefix, prefix_len);
+	}
+	else {
+		result = EsifWsShellExec(cmd, cmd_len, prefix, prefix_len);
+	}
+	return result;
+}
+
 int EsifWsTraceLevel(void)
 {
 	int rc = TRACELEVEL_NONE;
@@ -0,0 +1,568 @@
+/******************************************************************************
+** Copyright (c) 2013-2020 Intel Corporation All Rights Reserved
+**
+** Licensed under the Apache License, Version 2.0 (the "License"); you may not
+** use this file except in compliance with the License.
+**
+** You may obtain a copy of the License at
+**     http://www.apache.org/licenses/LICENSE-2.0
+**
+** Unless required by applicable law or agreed to in writing, software
+** distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+** WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**
+** See the License for the specific language governing permissions and
+** limitations under the License.
+**
+******************************************************************************/
+
+//
+// ESIF Web Server Load Test
+//
+// Opens N websocket clients to a running esif_ufd Web Server, keeps a fixed
+// number of REST API requests outstanding on each client, and reports the
+// command throughput and the latency distribution of the responses.
+//
+// REST API requests are sent as "<msgid>:<command>" text frames and each
+// response begins with "<msgid>:", so responses are matched by message ID.
+//
+// usage: esif_ws_loadtest [-h host] [-p port] [-c clients] [-n requests]
+//                         [-d depth] [-t seconds] [command]
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+
+#define LT_DEFAULT_HOST		"127.0.0.1"
+#define LT_DEFAULT_PORT		"8888"
+#define LT_DEFAULT_COMMAND	"status"
+#define LT_DEFAULT_CLIENTS	16
+#define LT_DEFAULT_REQUESTS	1000
+#define LT_DEFAULT_DEPTH	1
+#define LT_DEFAULT_TIMEOUT	60
+
+#define LT_MAX_CLIENTS		4096
+#define LT_MAX_DEPTH		64
+#define LT_MAX_EVENTS		256
+#define LT_RECV_CHUNK		65536
+#define LT_HANDSHAKE_KEY	"dGhlIHNhbXBsZSBub25jZQ=="	// Any 16-byte base64 nonce
+
+#define WS_OPCODE_CONTINUATION	0x0
+#define WS_OPCODE_TEXT			0x1
+#define WS_OPCODE_CLOSE			0x8
+#define WS_FIN					0x80
+#define WS_MASK					0x80
+
+// REST API Responses the Web Server returns instead of executing a command
+static const char *g_errorResponses[] = { "ERROR", "Shell Disabled", "Unsupported Command", NULL };
+
+typedef enum LoadClientState_e {
+	ClientHandshake = 0,	// Waiting for HTTP 101 Switching Protocols
+	ClientRunning,			// Sending Requests and Receiving Responses
+	ClientDone,				// All Responses Received
+	ClientFailed			// Connection or Protocol Error
+} LoadClientState;
+
+typedef struct LoadClient_s {
+	int				socket;
+	LoadClientState	state;
+	unsigned char	*recvBuf;		// Received, unparsed data
+	size_t			recvLen;
+	size_t			recvSize;
+	unsigned char	*sendBuf;		// Pending, unsent data
+	size_t			sendLen;
+	size_t			sendSize;
+	unsigned int	sent;			// Requests Sent
+	unsigned int	received;		// Responses Received
+	int				inMessage;		// Receiving continuation frames of a message
+	unsigned int	msgId;			// Message ID of the message being received
+	double			*sentAt;		// Send time of each Request, indexed by (msgId - 1)
+} LoadClient, *LoadClientPtr;
+
+typedef struct LoadTest_s {
+	const char		*host;
+	const char		*port;
+	const char		*command;
+	unsigned int	clients;
+	unsigned int	requests;		// Requests per Client
+	unsigned int	depth;			// Outstanding Requests per Client
+	unsigned int	timeout;		// Seconds
+	LoadClientPtr	client;
+	double			*latency;		// Latency of every Response, in usec
+	size_t			latencyCount;
+	unsigned long	errors;			// Responses reporting an error instead of command output
+	int				epollFd;
+} LoadTest, *LoadTestPtr;
+
+// Monotonic time in seconds
+static double LoadTest_Now(void)
+{
+	struct timespec ts = { 0 };
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+// Grow a buffer so it can hold at least the given size
+static int LoadTest_Reserve(unsigned char **buf, size_t *size, size_t needed)
+{
+	if (needed > *size) {
+		size_t newSize = (*size ? *size : LT_RECV_CHUNK);
+		unsigned char *newBuf = NULL;
+		while (newSize < needed) {
+			newSize *= 2;
+		}
+		if ((newBuf = (unsigned char *)realloc(*buf, newSize)) == NULL) {
+			return -1;
+		}
+		*buf = newBuf;
+		*size = newSize;
+	}
+	return 0;
+}
+
+// Append data to a client's send buffer
+static int LoadClient_Queue(LoadClientPtr self, const void *data, size_t len)
+{
+	if (LoadTest_Reserve(&self->sendBuf, &self->sendSize, self->sendLen + len) != 0) {
+		return -1;
+	}
+	memcpy(self->sendBuf + self->sendLen, data, len);
+	self->sendLen += len;
+	return 0;
+}
+
+// Queue a masked websocket text frame containing the next REST API Request
+static int LoadClient_QueueRequest(LoadClientPtr self, LoadTestPtr test)
+{
+	char payload[1024] = { 0 };
+	unsigned char header[14] = { 0 };
+	unsigned char mask[4] = { 0 };
+	size_t headerLen = 2;
+	size_t payloadLen = 0;
+	size_t j = 0;
+	int len = 0;
+
+	len = snprintf(payload, sizeof(payload), "%u:%s", self->sent + 1, test->command);
+	if (len <= 0 || (size_t)len >= sizeof(payload)) {
+		return -1;
+	}
+	payloadLen = (size_t)len;
+
+	header[0] = WS_FIN | WS_OPCODE_TEXT;
+	if (payloadLen < 126) {
+		header[1] = WS_MASK | (unsigned char)payloadLen;
+	}
+	else {
+		header[1] = WS_MASK | 126;
+		header[2] = (unsigned char)(payloadLen >> 8);
+		header[3] = (unsigned char)(payloadLen);
+		headerLen = 4;
+	}
+	for (j = 0; j < sizeof(mask); j++) {
+		mask[j] = (unsigned char)rand();
+		header[headerLen++] = mask[j];
+	}
+	for (j = 0; j < payloadLen; j++) {
+		payload[j] ^= mask[j % 4];
+	}
+
+	if (LoadClient_Queue(self, header, headerLen) != 0 || LoadClient_Queue(self, payload, payloadLen) != 0) {
+		return -1;
+	}
+	self->sentAt[self->sent++] = LoadTest_Now();
+	return 0;
+}
+
+// Keep up to depth Requests outstanding
+static int LoadClient_Refill(LoadClientPtr self, LoadTestPtr test)
+{
+	while (self->sent < test->requests && self->sent - self->received < test->depth) {
+		if (LoadClient_QueueRequest(self, test) != 0) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+// Send as much pending data as the socket will take, and only wait for EPOLLOUT while data remains
+static int LoadClient_Flush(LoadClientPtr self, LoadTestPtr test)
+{
+	struct epoll_event event = { 0 };
+
+	while (self->sendLen > 0) {
+		ssize_t bytes = send(self->socket, self->sendBuf, self->sendLen, MSG_NOSIGNAL);
+		if (bytes < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				break;
+			}
+			return -1;
+		}
+		memmove(self->sendBuf, self->sendBuf + bytes, self->sendLen - (size_t)bytes);
+		self->sendLen -= (size_t)bytes;
+	}
+	event.events = EPOLLIN | (self->sendLen > 0 ? EPOLLOUT : 0);
+	event.data.ptr = self;
+	return epoll_ctl(test->epollFd, EPOLL_CTL_MOD, self->socket, &event);
+}
+
+// Parse the HTTP Upgrade Response
+static int LoadClient_ParseHandshake(LoadClientPtr self)
+{
+	unsigned char *end = NULL;
+	size_t headerLen = 0;
+
+	if (LoadTest_Reserve(&self->recvBuf, &self->recvSize, self->recvLen + 1) != 0) {
+		return -1;
+	}
+	self->recvBuf[self->recvLen] = 0;
+	if ((end = (unsigned char *)strstr((char *)self->recvBuf, "\r\n\r\n")) == NULL) {
+		return 0;
+	}
+	if (strncmp((char *)self->recvBuf, "HTTP/1.1 101", 12) != 0) {
+		fprintf(stderr, "Websocket Upgrade Rejected: %.*s\n", (int)(strchr((char *)self->recvBuf, '\r') - (char *)self->recvBuf), self->recvBuf);
+		return -1;
+	}
+	headerLen = (size_t)(end - self->recvBuf) + 4;
+	memmove(self->recvBuf, self->recvBuf + headerLen, self->recvLen - headerLen);
+	self->recvLen -= headerLen;
+	self->state = ClientRunning;
+	return 1;
+}
+
+// Parse all complete websocket frames in the receive buffer
+static int LoadClient_ParseFrames(LoadClientPtr self, LoadTestPtr test)
+{
+	size_t offset = 0;
+
+	while (self->recvLen - offset >= 2) {
+		unsigned char *frame = self->recvBuf + offset;
+		size_t avail = self->recvLen - offset;
+		unsigned int opcode = frame[0] & 0x0F;
+		int fin = (frame[0] & WS_FIN) != 0;
+		size_t headerLen = 2 + ((frame[1] & WS_MASK) ? 4 : 0);
+		unsigned long long payloadLen = frame[1] & 0x7F;
+		unsigned char *payload = NULL;
+		int j = 0;
+
+		if (payloadLen == 126) {
+			if (avail < 4) {
+				break;
+			}
+			payloadLen = ((unsigned long long)frame[2] << 8) | frame[3];
+			headerLen += 2;
+		}
+		else if (payloadLen == 127) {
+			if (avail < 10) {
+				break;
+			}
+			for (payloadLen = 0, j = 0; j < 8; j++) {
+				payloadLen = (payloadLen << 8) | frame[2 + j];
+			}
+			headerLen += 8;
+		}
+		if (avail < headerLen || avail - headerLen < payloadLen) {
+			break;
+		}
+		payload = frame + headerLen;
+
+		if (opcode == WS_OPCODE_CLOSE) {
+			fprintf(stderr, "Connection Closed by Server\n");
+			return -1;
+		}
+		// The Message ID and Status are at the start of the first fragment of each message
+		if (opcode == WS_OPCODE_TEXT || (opcode == WS_OPCODE_CONTINUATION && !self->inMessage)) {
+			unsigned char *sep = memchr(payload, ':', (size_t)payloadLen);
+			self->msgId = (unsigned int)strtoul((char *)payload, NULL, 10);
+			for (j = 0; sep && g_errorResponses[j] != NULL; j++) {
+				size_t errLen = strlen(g_errorResponses[j]);
+				if ((size_t)(sep + 1 - payload) + errLen <= payloadLen && memcmp(sep + 1, g_errorResponses[j], errLen) == 0) {
+					test->errors++;
+					break;
+				}
+			}
+			self->inMessage = 1;
+		}
+		if (fin && self->inMessage) {
+			if (self->msgId == 0 || self->msgId > self->sent) {
+				fprintf(stderr, "Unexpected Response ID: %u\n", self->msgId);
+				return -1;
+			}
+			test->latency[test->latencyCount++] = (LoadTest_Now() - self->sentAt[self->msgId - 1]) * 1e6;
+			self->received++;
+			self->inMessage = 0;
+		}
+		offset += headerLen + (size_t)payloadLen;
+	}
+	memmove(self->recvBuf, self->recvBuf + offset, self->recvLen - offset);
+	self->recvLen -= offset;
+	return 0;
+}
+
+// Read and process everything available on a client socket
+static int LoadClient_Receive(LoadClientPtr self, LoadTestPtr test)
+{
+	for (;;) {
+		ssize_t bytes = 0;
+		if (LoadTest_Reserve(&self->recvBuf, &self->recvSize, self->recvLen + LT_RECV_CHUNK) != 0) {
+			return -1;
+		}
+		bytes = recv(self->socket, self->recvBuf + self->recvLen, LT_RECV_CHUNK, 0);
+		if (bytes == 0) {
+			return -1;
+		}
+		if (bytes < 0) {
+			return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+		}
+		self->recvLen += (size_t)bytes;
+
+		if (self->state == ClientHandshake) {
+			int rc = LoadClient_ParseHandshake(self);
+			if (rc < 0) {
+				return -1;
+			}
+			if (rc > 0 && LoadClient_Refill(self, test) != 0) {
+				return -1;
+			}
+		}
+		if (self->state == ClientRunning) {
+			if (LoadClient_ParseFrames(self, test) != 0 || LoadClient_Refill(self, test) != 0) {
+				return -1;
+			}
+			if (self->received == test->requests) {
+				self->state = ClientDone;
+			}
+		}
+	}
+}
+
+// Connect a client and queue its Websocket Upgrade Request
+static int LoadClient_Connect(LoadClientPtr self, LoadTestPtr test, const struct addrinfo *addr)
+{
+	char request[512] = { 0 };
+	struct epoll_event event = { 0 };
+	int one = 1;
+	int len = 0;
+
+	if ((self->socket = socket(addr->ai_family, SOCK_STREAM, IPPROTO_TCP)) < 0) {
+		return -1;
+	}
+	if (connect(self->socket, addr->ai_addr, addr->ai_addrlen) != 0) {
+		return -1;
+	}
+	setsockopt(self->socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+	fcntl(self->socket, F_SETFL, fcntl(self->socket, F_GETFL, 0) | O_NONBLOCK);
+
+	len = snprintf(request, sizeof(request),
+		"GET / HTTP/1.1\r\n"
+		"Host: %s:%s\r\n"
+		"Origin: http://%s:%s\r\n"
+		"Upgrade: websocket\r\n"
+		"Connection: Upgrade\r\n"
+		"Sec-WebSocket-Key: " LT_HANDSHAKE_KEY "\r\n"
+		"Sec-WebSocket-Version: 13\r\n"
+		"\r\n",
+		test->host, test->port, test->host, test->port);
+	if (len <= 0 || (size_t)len >= sizeof(request) || LoadClient_Queue(self, request, (size_t)len) != 0) {
+		return -1;
+	}
+
+	event.events = EPOLLIN;
+	event.data.ptr = self;
+	if (epoll_ctl(test->epollFd, EPOLL_CTL_ADD, self->socket, &event) != 0) {
+		return -1;
+	}
+	return LoadClient_Flush(self, test);
+}
+
+static int LoadTest_CompareDouble(const void *a, const void *b)
+{
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+static double LoadTest_Percentile(LoadTestPtr self, double pct)
+{
+	size_t idx = (size_t)(pct / 100.0 * (double)(self->latencyCount - 1) + 0.5);
+	return self->latency[idx];
+}
+
+static void LoadTest_Usage(const char *prog)
+{
+	fprintf(stderr,
+		"usage: %s [-h host] [-p port] [-c clients] [-n requests] [-d depth] [-t seconds] [command]\n"
+		"  -h host      Web Server Address (default %s)\n"
+		"  -p port      Web Server Port (default %s)\n"
+		"  -c clients   Concurrent Websocket Clients (default %d, max %d)\n"
+		"  -n requests  REST API Requests per Client (default %d)\n"
+		"  -d depth     Outstanding Requests per Client (default %d, max %d)\n"
+		"  -t seconds   Abort if not complete after this long (default %d)\n"
+		"  command      REST API Shell Command (default \"%s\")\n",
+		prog, LT_DEFAULT_HOST, LT_DEFAULT_PORT, LT_DEFAULT_CLIENTS, LT_MAX_CLIENTS,
+		LT_DEFAULT_REQUESTS, LT_DEFAULT_DEPTH, LT_MAX_DEPTH, LT_DEFAULT_TIMEOUT, LT_DEFAULT_COMMAND);
+}
+
+int main(int argc, char **argv)
+{
+	LoadTest test = { 0 };
+	struct addrinfo hints = { 0 };
+	struct addrinfo *addr = NULL;
+	struct epoll_event events[LT_MAX_EVENTS];
+	unsigned int running = 0;
+	unsigned int failed = 0;
+	unsigned int j = 0;
+	double start = 0.0;
+	double elapsed = 0.0;
+	double total = 0.0;
+	int opt = 0;
+	int rc = EXIT_FAILURE;
+
+	test.host = LT_DEFAULT_HOST;
+	test.port = LT_DEFAULT_PORT;
+	test.command = LT_DEFAULT_COMMAND;
+	test.clients = LT_DEFAULT_CLIENTS;
+	test.requests = LT_DEFAULT_REQUESTS;
+	test.depth = LT_DEFAULT_DEPTH;
+	test.timeout = LT_DEFAULT_TIMEOUT;
+	test.epollFd = -1;
+
+	while ((opt = getopt(argc, argv, "h:p:c:n:d:t:")) != -1) {
+		switch (opt) {
+		case 'h': test.host = optarg; break;
+		case 'p': test.port = optarg; break;
+		case 'c': test.clients = (unsigned int)strtoul(optarg, NULL, 0); break;
+		case 'n': test.requests = (unsigned int)strtoul(optarg, NULL, 0); break;
+		case 'd': test.depth = (unsigned int)strtoul(optarg, NULL, 0); break;
+		case 't': test.timeout = (unsigned int)strtoul(optarg, NULL, 0); break;
+		default:
+			LoadTest_Usage(argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+	if (optind < argc) {
+		test.command = argv[optind];
+	}
+	if (test.clients == 0 || test.clients > LT_MAX_CLIENTS || test.requests == 0 || test.depth == 0 || test.depth > LT_MAX_DEPTH) {
+		LoadTest_Usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	hints.ai_family = AF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	if (getaddrinfo(test.host, test.port, &hints, &addr) != 0 || addr == NULL) {
+		fprintf(stderr, "Unable to resolve %s:%s\n", test.host, test.port);
+		return EXIT_FAILURE;
+	}
+
+	test.client = (LoadClientPtr)calloc(test.clients, sizeof(*test.client));
+	test.latency = (double *)calloc((size_t)test.clients * test.requests, sizeof(*test.latency));
+	if ((test.epollFd = epoll_create1(0)) < 0 || test.client == NULL || test.latency == NULL) {
+		fprintf(stderr, "Out of Memory\n");
+		goto exit;
+	}
+
+	for (j = 0; j < test.clients; j++) {
+		test.client[j].socket = -1;
+	}
+
+	srand((unsigned int)time(NULL));
+	start = LoadTest_Now();
+	for (j = 0; j < test.clients; j++) {
+		if ((test.client[j].sentAt = (double *)calloc(test.requests, sizeof(double))) == NULL ||
+			LoadClient_Connect(&test.client[j], &test, addr) != 0) {
+			fprintf(stderr, "Unable to connect client %u to %s:%s: %s\n", j, test.host, test.port, strerror(errno));
+			goto exit;
+		}
+	}
+	running = test.clients;
+
+	while (running > 0) {
+		int count = 0;
+		int k = 0;
+
+		if (LoadTest_Now() - start > (double)test.timeout) {
+			fprintf(stderr, "Timed out with %u clients still running\n", running);
+			break;
+		}
+		if ((count = epoll_wait(test.epollFd, events, LT_MAX_EVENTS, 1000)) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			break;
+		}
+		for (k = 0; k < count; k++) {
+			LoadClientPtr client = (LoadClientPtr)events[k].data.ptr;
+			int ok = 0;
+
+			if (client->state == ClientDone || client->state == ClientFailed) {
+				continue;
+			}
+			if (events[k].events & (EPOLLERR | EPOLLHUP)) {
+				ok = -1;
+			}
+			if (ok == 0 && (events[k].events & EPOLLIN)) {
+				ok = LoadClient_Receive(client, &test);
+			}
+			if (ok == 0) {
+				ok = LoadClient_Flush(client, &test);
+			}
+			if (ok != 0) {
+				client->state = ClientFailed;
+				failed++;
+			}
+			if (client->state == ClientDone || client->state == ClientFailed) {
+				epoll_ctl(test.epollFd, EPOLL_CTL_DEL, client->socket, NULL);
+				running--;
+			}
+		}
+	}
+	elapsed = LoadTest_Now() - start;
+
+	printf("Command:     %s\n", test.command);
+	printf("Clients:     %u (%u failed)\n", test.clients, failed);
+	printf("Depth:       %u\n", test.depth);
+	printf("Responses:   %zu of %llu (%lu errors)\n", test.latencyCount, (unsigned long long)test.clients * test.requests, test.errors);
+	printf("Elapsed:     %.3f sec\n", elapsed);
+	if (test.latencyCount > 0) {
+		for (j = 0; j < test.latencyCount; j++) {
+			total += test.latency[j];
+		}
+		qsort(test.latency, test.latencyCount, sizeof(*test.latency), LoadTest_CompareDouble);
+		printf("Throughput:  %.1f cmds/sec\n", (double)test.latencyCount / elapsed);
+		printf("Latency:     avg=%.0f p50=%.0f p90=%.0f p99=%.0f p99.9=%.0f max=%.0f usec\n",
+			total / (double)test.latencyCount,
+			LoadTest_Percentile(&test, 50.0),
+			LoadTest_Percentile(&test, 90.0),
+			LoadTest_Percentile(&test, 99.0),
+			LoadTest_Percentile(&test, 99.9),
+			test.latency[test.latencyCount - 1]);
+	}
+	rc = (failed == 0 && running == 0 ? EXIT_SUCCESS : EXIT_FAILURE);
+
+exit:
+	for (j = 0; test.client && j < test.clients; j++) {
+		if (test.client[j].socket >= 0) {
+			close(test.client[j].socket);
+		}
+		free(test.client[j].recvBuf);
+		free(test.client[j].sendBuf);
+		free(test.client[j].sentAt);
+	}
+	if (test.epollFd >= 0) {
+		close(test.epollFd);
+	}
+	free(test.client);
+	free(test.latency);
+	freeaddrinfo(addr);
+	return rc;
+}
@@ -22,6 +22,7 @@
 #include "esif_ccb_atomic.h"
 #include "esif_ccb_lock.h"
 #include "esif_ccb_string.h"
+#include "esif_ccb_time.h"
 #include "esif_link_list.h"
 
 #include "esif_ws_server.h"
@@ -33,6 +34,10 @@
 #include "win\banned.h"
 #endif
 
+#ifdef WS_USE_EPOLL
+#include <sys/epoll.h>
+#endif
+
 // Use Non-Blocking Socket I/O
 #ifdef MSG_NOSIGNAL
 #define WS_NONBLOCKING_FLAGS (MSG_NOSIGNAL|MSG_DONTWAIT)
@@ -45,13 +50,16 @@
 #define WS_NETWORK_BUFFER_LEN	65535	// Network Buffer Size for HTTP/Websocket Send and Receive Buffer
 #define WS_SOCKET_TIMEOUT		2		// Socket activity timeout waiting on blocking select() [2 or greater]
 
+#define WS_MIN_CLIENT_SENDBUF	(16*1024)		// Initial size of client send buffer, which grows geometrically
 #define WS_MAX_CLIENT_SENDBUF	(8*1024*1024)	// Max size of client send buffer (multiple messages)
+#define WS_KEEP_CLIENT_SENDBUF	(256*1024)		// Max size of client send buffer kept for reuse once drained
 #define WS_MAX_CLIENT_RECVBUF	(8*1024*1024)	// Max size of client receive buffer (multiple messages)
 
 WebServerPtr g_WebServer = NULL;	// Global Web Server Singleton Intance
 
 // Doorbell Opcodes
 #define WS_OPCODE_NOOP			0x00	// No-Operation
+#define WS_OPCODE_RESPONSE		0x01	// REST API Responses Completed
 #define WS_OPCODE_QUIT			0xFF	// Quit Web Server
 
 //// TCP Doorbell Object Methods ////
@@ -276,6 +284,7 @@ void WebClient_Init(WebClientPtr self)
 void WebClient_Close(WebClientPtr self)
 {
 	if (self) {
+		u32 generation = self->generation;
 		esif_ccb_free(self->ipAddr);
 		esif_ccb_free(self->sendBuf);
 		esif_ccb_free(self->recvBuf);
@@ -286,6 +295,7 @@ void WebClient_Close(WebClientPtr self)
 			esif_ccb_socket_close(self->socket);
 		}
 		WebClient_Init(self);
+		self->generation = generation + 1;
 	}
 }
 
@@ -306,24 +316,26 @@ esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
 
 		// Do Non-Blocking Send of any data already in send buffer first
 		if (self->sendBuf != NULL && self->sendBufLen > 0) {
-			ret = send(self->socket, (const char *)self->sendBuf, (int)self->sendBufLen, WS_NONBLOCKING_FLAGS);
+			ret = send(self->socket, (const char *)self->sendBuf + self->sendBufPos, (int)self->sendBufLen, WS_NONBLOCKING_FLAGS);
 
-			// Destroy send buffer if Complete send, otherwise remove sent data before appending new data
-			if (ret == (int)self->sendBufLen) {
-				esif_ccb_free(self->sendBuf);
-				self->sendBuf = NULL;
-				self->sendBufLen = 0;
-				ret = 0;
-			}
-			else if (ret > 0) {
-				esif_ccb_memmove(self->sendBuf, self->sendBuf + ret, self->sendBufLen - ret);
+			// Skip past sent data; The send buffer is kept for reuse unless it has grown large
+			if (ret > 0) {
+				self->sendBufPos += ret;
 				self->sendBufLen -= ret;
 				ret = 0;
 			}
+			if (self->sendBufLen == 0) {
+				self->sendBufPos = 0;
+				if (self->sendBufSize > WS_KEEP_CLIENT_SENDBUF) {
+					esif_ccb_free(self->sendBuf);
+					self->sendBuf = NULL;
+					self->sendBufSize = 0;
+				}
+			}
 		}
 
 		// Do Blocking or Non-Blocking send if send buffer is clear
-		if (self->sendBuf == NULL && buffer != NULL && buf_len > 0) {
+		if (self->sendBufLen == 0 && buffer != NULL && buf_len > 0) {
 			ret = send(self->socket, (char*)buffer, (int)buf_len, send_flags);
 		}
 
@@ -338,19 +350,35 @@ esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
 			}
 		}
 
-		// Append any unsent data to send buffer
+		// Append any unsent data to send buffer, compacting it or growing it geometrically if necessary
 		if (rc == ESIF_OK && buffer != NULL && ret != (ssize_t)buf_len) {
-			size_t newBufLen = self->sendBufLen + buf_len - ret;
-			u8 *newBuffer = NULL;
-			if (newBufLen <= WS_MAX_CLIENT_SENDBUF) {
-				newBuffer = esif_ccb_realloc(self->sendBuf, newBufLen);
+			size_t unsentLen = buf_len - ret;
+			size_t newBufLen = self->sendBufLen + unsentLen;
+
+			if (self->sendBufPos + newBufLen > self->sendBufSize && self->sendBufPos > 0) {
+				esif_ccb_memmove(self->sendBuf, self->sendBuf + self->sendBufPos, self->sendBufLen);
+				self->sendBufPos = 0;
 			}
-			if (newBuffer == NULL) {
-				rc = ESIF_E_NO_MEMORY;
+			if (newBufLen > self->sendBufSize) {
+				size_t newBufSize = esif_ccb_max(self->sendBufSize, WS_MIN_CLIENT_SENDBUF);
+				u8 *newBuffer = NULL;
+				while (newBufSize < newBufLen) {
+					newBufSize *= 2;
+				}
+				newBufSize = esif_ccb_min(newBufSize, WS_MAX_CLIENT_SENDBUF);
+				if (newBufLen <= newBufSize) {
+					newBuffer = esif_ccb_realloc(self->sendBuf, newBufSize);
+				}
+				if (newBuffer == NULL) {
+					rc = ESIF_E_NO_MEMORY;
+				}
+				else {
+					self->sendBuf = newBuffer;
+					self->sendBufSize = newBufSize;
+				}
 			}
-			else {
-				esif_ccb_memmove(newBuffer + self->sendBufLen, (u8*)buffer + ret, buf_len - ret);
-				self->sendBuf = newBuffer;
+			if (rc == ESIF_OK) {
+				esif_ccb_memcpy(self->sendBuf + self->sendBufPos + self->sendBufLen, (u8*)buffer + ret, unsentLen);
 				self->sendBufLen = newBufLen;
 			}
 			WS_TRACE_DEBUG("WS SEND Buffering (%d): buffer=%zd sent=%d error=%d send_buf=%zd\n", (int)self->socket, buf_len, ret, esif_ccb_socket_error(), self->sendBufLen);
@@ -365,6 +393,249 @@ esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len)
 	return rc;
 }
 
+//// REST Worker Object Methods ////
+
+// Destroy a REST API Request
+static void WebRestJob_Destroy(WebRestJobPtr self)
+{
+	if (self) {
+		esif_ccb_free(self->ipAddr);
+		esif_ccb_free(self->request);
+		esif_ccb_free(self->response);
+		esif_ccb_free(self);
+	}
+}
+
+// Initialize a REST Worker Object
+static void WebRestWorker_Init(WebRestWorkerPtr self, WebServerPtr server)
+{
+	if (self) {
+		esif_ccb_memset(self, 0, sizeof(*self));
+		self->server = server;
+		atomic_set(&self->isActive, 0);
+	}
+}
+
+// Add a Client to the end of the Ready Clients. Requires restLock.
+static void WebServer_ReadyRestQueue(WebServerPtr self, int clientId)
+{
+	WebRestQueuePtr queue = &self->restQueues[clientId];
+	if (!queue->isReady && !queue->isClaimed && queue->jobs && queue->jobs->nodes > 0) {
+		self->restReady[(self->restReadyHead + self->restReadyCount) % WS_MAX_CLIENTS] = clientId;
+		self->restReadyCount++;
+		queue->isReady = ESIF_TRUE;
+	}
+}
+
+// Claim the first Ready Client and remove its next Request, or return NULL if no Client is Ready. Requires restLock.
+static WebRestJobPtr WebServer_ClaimRestJob(WebServerPtr self)
+{
+	WebRestJobPtr job = NULL;
+	if (self->restReadyCount > 0) {
+		WebRestQueuePtr queue = &self->restQueues[self->restReady[self->restReadyHead]];
+		self->restReadyHead = (self->restReadyHead + 1) % WS_MAX_CLIENTS;
+		self->restReadyCount--;
+		queue->isReady = ESIF_FALSE;
+
+		if (queue->jobs && queue->jobs->head_ptr) {
+			job = (WebRestJobPtr)queue->jobs->head_ptr->data_ptr;
+			esif_link_list_node_remove(queue->jobs, queue->jobs->head_ptr);
+			queue->isClaimed = ESIF_TRUE;
+		}
+	}
+	return job;
+}
+
+// Move a completed REST API Request to the Server's Completed list and signal the Server Thread
+static void WebServer_CompleteRestJob(WebServerPtr self, WebRestJobPtr job)
+{
+	esif_error_t rc = ESIF_E_WS_DISC;
+	Bool ringDoorbell = ESIF_FALSE;
+
+	esif_ccb_write_lock(&self->completedLock);
+	if (self->completedJobs) {
+		// Only ring the Doorbell for the first Response since the Server sends all Completed Responses at once
+		ringDoorbell = (self->completedJobs->nodes == 0);
+		rc = esif_link_list_add_at_back(self->completedJobs, job);
+	}
+	esif_ccb_write_unlock(&self->completedLock);
+
+	if (rc != ESIF_OK) {
+		WebRestJob_Destroy(job);
+	}
+	else if (ringDoorbell) {
+		TcpDoorbell_Ring(&self->doorbell, WS_OPCODE_RESPONSE);
+	}
+}
+
+// REST Worker Thread: Execute queued REST API Requests of any Client in this Worker's Shell Execution Context
+static void *ESIF_CALLCONV WebRestWorker_Thread(void *ctx)
+{
+	WebRestWorkerPtr self = (WebRestWorkerPtr)ctx;
+	WebServerPtr server = self->server;
+
+	while (atomic_read(&self->isActive)) {
+		esif_ccb_sem_down(&server->restSignal);
+
+		while (atomic_read(&self->isActive)) {
+			WebRestJobPtr job = NULL;
+			esif_ccb_realtime_t startTime = { 0 };
+			u64 elapsedUsec = 0;
+			int clientId = 0;
+
+			esif_ccb_write_lock(&server->restLock);
+			job = WebServer_ClaimRestJob(server);
+			esif_ccb_write_unlock(&server->restLock);
+
+			if (job == NULL) {
+				break;
+			}
+			clientId = job->clientId;
+
+			startTime = esif_ccb_realtime_current();
+			job->rc = WebServer_WebSocketExecRestCmd(
+				server,
+				self->shellCtx,
+				job->ipAddr,
+				job->request,
+				job->request_len,
+				&job->response,
+				&job->response_len);
+			elapsedUsec = esif_ccb_realtime_diff_usec(startTime, esif_ccb_realtime_current());
+
+			self->requests++;
+			self->totalUsec += elapsedUsec;
+			self->maxUsec = esif_ccb_max(self->maxUsec, elapsedUsec);
+
+			// Complete the Response before releasing the Client so that its Responses are sent in order
+			WebServer_CompleteRestJob(server, job);
+
+			esif_ccb_write_lock(&server->restLock);
+			server->restQueues[clientId].isClaimed = ESIF_FALSE;
+			WebServer_ReadyRestQueue(server, clientId);
+			esif_ccb_write_unlock(&server->restLock);
+		}
+	}
+	return 0;
+}
+
+// Start a REST Worker Thread with its own Shell Execution Context
+static esif_error_t WebRestWorker_Start(WebRestWorkerPtr self)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+	if (self) {
+		self->requests = 0;
+		self->totalUsec = 0;
+		self->maxUsec = 0;
+		self->shellCtx = EsifWsShellCtxCreate();
+		atomic_set(&self->isActive, 1);
+		rc = esif_ccb_thread_create(&self->thread, WebRestWorker_Thread, self);
+		self->threadStarted = (rc == ESIF_OK);
+		if (rc != ESIF_OK) {
+			atomic_set(&self->isActive, 0);
+			EsifWsShellCtxDestroy(self->shellCtx);
+			self->shellCtx = NULL;
+		}
+	}
+	return rc;
+}
+
+// Stop a REST Worker Thread; the Worker Threads must already have been told to stop and signaled
+static void WebRestWorker_Stop(WebRestWorkerPtr self)
+{
+	if (self) {
+		atomic_set(&self->isActive, 0);
+		if (self->threadStarted) {
+			esif_ccb_thread_join(&self->thread);
+			self->threadStarted = ESIF_FALSE;
+
+			WS_TRACE_INFO("REST Worker[%d]: Requests=%llu AvgUsec=%llu MaxUsec=%llu\n",
+				(int)(self - self->server->restWorkers),
+				(unsigned long long)self->requests,
+				(unsigned long long)(self->requests ? self->totalUsec / self->requests : 0),
+				(unsigned long long)self->maxUsec
+			);
+		}
+		EsifWsShellCtxDestroy(self->shellCtx);
+		self->shellCtx = NULL;
+	}
+}
+
+// Stop all REST Worker Threads and discard any unexecuted Requests
+static void WebServer_StopRestWorkers(WebServerPtr self)
+{
+	int j = 0;
+
+	for (j = 0; j < WS_REST_WORKERS; j++) {
+		atomic_set(&self->restWorkers[j].isActive, 0);
+	}
+	for (j = 0; j < WS_REST_WORKERS; j++) {
+		if (self->restWorkers[j].threadStarted) {
+			esif_ccb_sem_up(&self->restSignal);
+		}
+	}
+	for (j = 0; j < WS_REST_WORKERS; j++) {
+		WebRestWorker_Stop(&self->restWorkers[j]);
+	}
+	self->restWorkerCount = 0;
+
+	esif_ccb_write_lock(&self->restLock);
+	for (j = 0; j < WS_MAX_CLIENTS; j++) {
+		esif_link_list_free_data_and_destroy(self->restQueues[j].jobs, (link_list_data_destroy_func)WebRestJob_Destroy);
+		self->restQueues[j].jobs = NULL;
+		self->restQueues[j].isClaimed = ESIF_FALSE;
+		self->restQueues[j].isReady = ESIF_FALSE;
+	}
+	self->restReadyHead = 0;
+	self->restReadyCount = 0;
+	esif_ccb_write_unlock(&self->restLock);
+}
+
+// Queue a REST API Request for the given Client, to be executed by the next idle REST Worker. The Worker owns the request if successful.
+esif_error_t WebServer_QueueRestCmd(WebServerPtr self, WebClientPtr client, char *request, size_t request_len)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+
+	if (self && client && request && client >= self->clients && client < self->clients + WS_MAX_CLIENTS) {
+		int clientId = (int)(client - self->clients);
+		WebRestQueuePtr queue = &self->restQueues[clientId];
+		WebRestJobPtr job = NULL;
+
+		if (self->restWorkerCount == 0) {
+			rc = ESIF_E_NOT_SUPPORTED;
+		}
+		else if ((job = (WebRestJobPtr)esif_ccb_malloc(sizeof(*job))) == NULL) {
+			rc = ESIF_E_NO_MEMORY;
+		}
+		else {
+			job->clientId = clientId;
+			job->generation = client->generation;
+			job->ipAddr = esif_ccb_strdup(client->ipAddr ? client->ipAddr : "NA");
+			job->request = request;
+			job->request_len = request_len;
+
+			esif_ccb_write_lock(&self->restLock);
+			if (queue->jobs == NULL) {
+				queue->jobs = esif_link_list_create();
+			}
+			rc = (queue->jobs ? esif_link_list_add_at_back(queue->jobs, job) : ESIF_E_NO_MEMORY);
+			if (rc == ESIF_OK) {
+				WebServer_ReadyRestQueue(self, clientId);
+			}
+			esif_ccb_write_unlock(&self->restLock);
+
+			if (rc == ESIF_OK) {
+				esif_ccb_sem_up(&self->restSignal);
+			}
+			else {
+				job->request = NULL;
+				WebRestJob_Destroy(job);
+			}
+		}
+	}
+	return rc;
+}
+
 //// WebServer Object Methods ////
 
 // Initialize WebServer Object
@@ -380,10 +651,24 @@ void WebServer_Init(WebServerPtr self)
 		for (j = 0; j < WS_MAX_CLIENTS; j++) {
 			WebClient_Init(&self->clients[j]);
 		}
+		for (j = 0; j < WS_REST_WORKERS; j++) {
+			WebRestWorker_Init(&self->restWorkers[j], self);
+		}
+		self->restWorkerCount = 0;
+		esif_ccb_lock_init(&self->restLock);
+		esif_ccb_sem_init(&self->restSignal);
+		esif_ccb_memset(self->restQueues, 0, sizeof(self->restQueues));
+		self->restReadyHead = 0;
+		self->restReadyCount = 0;
 		atomic_set(&self->isActive, 0);
 		atomic_set(&self->activeThreads, 0);
 		self->netBuf = NULL;
 		self->netBufLen = 0;
+		esif_ccb_lock_init(&self->completedLock);
+		self->completedJobs = NULL;
+#ifdef WS_USE_EPOLL
+		self->epollFd = -1;
+#endif
 	}
 }
 
@@ -392,6 +677,14 @@ void WebServer_Close(WebServerPtr self)
 {
 	if (self) {
 		int j = 0;
+
+		// Stop REST Workers before closing the Doorbell they use to signal completed requests
+		WebServer_StopRestWorkers(self);
+		esif_ccb_write_lock(&self->completedLock);
+		esif_link_list_free_data_and_destroy(self->completedJobs, (link_list_data_destroy_func)WebRestJob_Destroy);
+		self->completedJobs = NULL;
+		esif_ccb_write_unlock(&self->completedLock);
+
 		TcpDoorbell_Close(&self->doorbell);
 		for (j = 0; j < WS_MAX_LISTENERS; j++) {
 			WebListener_Close(&self->listeners[j]);
@@ -399,6 +692,12 @@ void WebServer_Close(WebServerPtr self)
 		for (j = 0; j < WS_MAX_CLIENTS; j++) {
 			WebClient_Close(&self->clients[j]);
 		}
+#ifdef WS_USE_EPOLL
+		if (self->epollFd != -1) {
+			close(self->epollFd);
+			self->epollFd = -1;
+		}
+#endif
 		esif_ccb_free(self->netBuf);
 		self->netBuf = NULL;
 		self->netBufLen = 0;
@@ -412,6 +711,9 @@ void WebServer_Exit(WebServerPtr self)
 	if (self) {
 		WebServer_Stop(self);
 		WebServer_Close(self);
+		esif_ccb_sem_uninit(&self->restSignal);
+		esif_ccb_lock_uninit(&self->restLock);
+		esif_ccb_lock_uninit(&self->completedLock);
 		esif_ccb_lock_uninit(&self->lock);
 	}
 }
@@ -496,19 +798,358 @@ esif_error_t WebServer_ProcessRequest(WebServerPtr self, WebClientPtr client)
 	return rc;
 }
 
+#ifdef WS_USE_EPOLL
+
+// epoll Event Tokens: Client Tokens include the Client Generation to detect events for Clients already closed
+#define WS_EPOLL_LISTENER_FLAG		0x80000000
+#define WS_EPOLL_DOORBELL			((u64)0xFFFFFFFF)
+#define WS_EPOLL_LISTENER(j)		((u64)(WS_EPOLL_LISTENER_FLAG | (u32)(j)))
+#define WS_EPOLL_CLIENT(j, gen)		((((u64)(gen)) << 32) | (u32)(j))
+
+// Add a Socket to the epoll instance, waiting for it to become readable
+static esif_error_t WebServer_EpollAdd(WebServerPtr self, esif_ccb_socket_t socket, u64 token)
+{
+	struct epoll_event event = { 0 };
+	event.events = EPOLLIN;
+	event.data.u64 = token;
+	return (epoll_ctl(self->epollFd, EPOLL_CTL_ADD, socket, &event) == 0 ? ESIF_OK : ESIF_E_WS_SOCKET_ERROR);
+}
+
+// Wait for a Client Socket to become writable only while it has a pending Send Buffer
+static void WebServer_UpdatePolling(WebServerPtr self, int clientId)
+{
+	WebClientPtr client = &self->clients[clientId];
+	Bool isPending = (client->sendBufLen > 0);
+
+	if (client->socket != INVALID_SOCKET && client->isPollingOut != isPending) {
+		struct epoll_event event = { 0 };
+		event.events = EPOLLIN | (isPending ? EPOLLOUT : 0);
+		event.data.u64 = WS_EPOLL_CLIENT(clientId, client->generation);
+		if (epoll_ctl(self->epollFd, EPOLL_CTL_MOD, client->socket, &event) == 0) {
+			client->isPollingOut = isPending;
+		}
+	}
+}
+
+#else
+
+#define WebServer_UpdatePolling(self, clientId)	((void)0)
+
+#endif
+
+// Send Completed REST API Responses to their Clients, discarding any for Clients that have since disconnected
+static void WebServer_SendRestResponses(WebServerPtr self)
+{
+	WebRestJobPtr job = NULL;
+	do {
+		job = NULL;
+		esif_ccb_write_lock(&self->completedLock);
+		if (self->completedJobs && self->completedJobs->head_ptr) {
+			job = (WebRestJobPtr)self->completedJobs->head_ptr->data_ptr;
+			esif_link_list_node_remove(self->completedJobs, self->completedJobs->head_ptr);
+		}
+		esif_ccb_write_unlock(&self->completedLock);
+
+		if (job) {
+			WebClientPtr client = &self->clients[job->clientId];
+			if (client->type == ClientWebsocket && client->socket != INVALID_SOCKET && client->generation == job->generation) {
+				esif_error_t rc = job->rc;
+				if (rc == ESIF_OK) {
+					rc = WebServer_WebsocketSendText(self, client, job->response, job->response_len);
+				}
+				if (rc != ESIF_OK) {
+					WebClient_Close(client);
+					WS_TRACE_DEBUG("Client[%d] Disconnected: %s (%d)\n", job->clientId, esif_rc_str(rc), (int)rc);
+				}
+				WebServer_UpdatePolling(self, job->clientId);
+			}
+			WebRestJob_Destroy(job);
+		}
+	} while (job);
+}
+
+// Respond to Incoming Doorbell Socket signals. Returns ESIF_E_WS_DISC if the Server should exit.
+static esif_error_t WebServer_DoorbellSignaled(WebServerPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+	u8 opcode = WS_OPCODE_NOOP;
+
+	// Exit if Doorbell socket(s) shutdown or a QUIT opcode received
+	if (TcpDoorbell_Receive(&self->doorbell, &opcode) != ESIF_OK) {
+		WS_TRACE_DEBUG("Doorbell Closed; Exiting");
+		rc = ESIF_E_WS_DISC;
+	}
+	else {
+		WS_TRACE_DEBUG("Doorbell Received: 0x%02X", ((int)opcode & 0xFF));
+		if (opcode == WS_OPCODE_QUIT) {
+			rc = ESIF_E_WS_DISC;
+		}
+		else if (opcode == WS_OPCODE_RESPONSE) {
+			WebServer_SendRestResponses(self);
+		}
+	}
+	return rc;
+}
+
+// Accept a new connection on a Listener Socket, returning the new Client index or -1
+static int WebServer_AcceptClient(WebServerPtr self, WebListenerPtr listener)
+{
+	esif_error_t rc = ESIF_OK;
+	esif_ccb_socket_t clientSocket = INVALID_SOCKET;
+	WebClientPtr client = NULL;
+	char *clientIpAddr = NULL;
+	int k = 0;
+
+	// Find first Unused Client
+	for (k = 0; k < WS_MAX_CLIENTS; k++) {
+		if (self->clients[k].type == ClientClosed) {
+			client = &self->clients[k];
+			break;
+		}
+	}
+
+	// Accept Incoming Connection
+	if ((rc = WebListener_AcceptClient(listener, &clientSocket, &clientIpAddr)) != ESIF_OK) {
+		WS_TRACE_DEBUG("Listener[%d] Socket[%d]: Accept Error: %s (%d)\n", (int)(listener - self->listeners), listener->socket, esif_rc_str(rc), rc);
+		return -1;
+	}
+
+	// Close Client if Max Connections exceeded
+	if (client == NULL) {
+		WS_TRACE_WARNING("Connection Limit Exceeded (%d)\n", WS_MAX_CLIENTS);
+		esif_ccb_socket_close(clientSocket);
+		return -1;
+	}
+
+	// Client is now an HTTP Connection
+	client->type = ClientHttp;
+	client->socket = clientSocket;
+	client->ipAddr = esif_ccb_strdup(clientIpAddr ? clientIpAddr : "NA");
+	WS_TRACE_DEBUG("Accepted Client[%d]: Socket[%d]\n", k, (int)client->socket);
+	return k;
+}
+
+// Process Activity on an Active Client Socket
+static void WebServer_ServiceClient(WebServerPtr self, int clientId, Bool isReadable, Bool isWritable, Bool isException)
+{
+	WebClientPtr client = &self->clients[clientId];
+	esif_error_t rc = ESIF_OK;
+
+	// Close sockets with Exceptions
+	if (client->socket != INVALID_SOCKET && isException) {
+		WS_TRACE_DEBUG("Closing Client[%d]: (Exception) Socket[%d]\n", clientId, (int)client->socket);
+		WebClient_Close(client);
+		return;
+	}
+
+	// Receive and Process Requests from Readable Clients
+	if (client->socket != INVALID_SOCKET && isReadable) {
+		if ((rc = WebServer_ProcessRequest(self, client)) != ESIF_OK) {
+			WebClient_Close(client);
+			WS_TRACE_DEBUG("Client[%d] Disconnected: %s (%d)\n", clientId, esif_rc_str(rc), (int)rc);
+		}
+	}
+
+	// Flush pending Send Buffer when socket becomes writable
+	if (client->socket != INVALID_SOCKET && isWritable) {
+		size_t sendBufLen = client->sendBufLen;
+		UNREFERENCED_PARAMETER(sendBufLen);
+		WebClient_Write(client, NULL, 0);
+		WS_TRACE_DEBUG("WS SEND Unbuffering (%d): before=%zd after=%zd\n", (int)client->socket, sendBufLen, client->sendBufLen);
+	}
+}
+
+#ifdef WS_USE_EPOLL
+
+// Wait for Socket Activity using epoll() until Quit signaled
+static esif_error_t WebServer_WaitLoop(WebServerPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+	struct epoll_event events[WS_MAX_SOCKETS] = { 0 };
+	int j = 0;
+
+	if ((self->epollFd = epoll_create1(EPOLL_CLOEXEC)) == -1) {
+		WS_TRACE_ERROR("EPOLL Create Error (%d)\n", errno);
+		return ESIF_E_WS_INIT_FAILED;
+	}
+
+	// Add Doorbell Ringer and Listener Socket(s)
+	rc = WebServer_EpollAdd(self, self->doorbell.sockets[DOORBELL_RINGER], WS_EPOLL_DOORBELL);
+	for (j = 0; rc == ESIF_OK && j < WS_MAX_LISTENERS; j++) {
+		if (self->listeners[j].socket != INVALID_SOCKET) {
+			rc = WebServer_EpollAdd(self, self->listeners[j].socket, WS_EPOLL_LISTENER(j));
+		}
+	}
+
+	// Process all active sockets and accept new connections until Quit signaled
+	while (rc == ESIF_OK && atomic_read(&self->isActive)) {
+
+		// Use Timeout of N + 0.05 seconds where >= 2 (Since UI polls every second)
+		int eventCount = epoll_wait(self->epollFd, events, ESIF_ARRAY_LEN(events), (WS_SOCKET_TIMEOUT * 1000) + 50);
+
+		// Exit loop if epoll error or server stopping; continue loop if inactivity timeout or interrupted
+		if (eventCount == -1 && errno != EINTR) {
+			WS_TRACE_ERROR("EPOLL Error (%d)\n", errno);
+			rc = ESIF_E_WS_SOCKET_ERROR;
+			break;
+		}
+		else if (!atomic_read(&self->isActive)) { // Exit if Server not Active
+			break;
+		}
+
+		for (j = 0; j < eventCount && rc == ESIF_OK && atomic_read(&self->isActive); j++) {
+			u64 token = events[j].data.u64;
+			u32 id = (u32)token;
+
+			// Respond to Incoming Doorbell Socket signals
+			if (token == WS_EPOLL_DOORBELL) {
+				if (WebServer_DoorbellSignaled(self) != ESIF_OK) {
+					atomic_set(&self->isActive, 0);
+				}
+			}
+			// Accept any new connections on the Listener Socket(s)
+			else if (id & WS_EPOLL_LISTENER_FLAG) {
+				int clientId = WebServer_AcceptClient(self, &self->listeners[id & ~WS_EPOLL_LISTENER_FLAG]);
+				if (clientId >= 0) {
+					WebClientPtr client = &self->clients[clientId];
+					if (WebServer_EpollAdd(self, client->socket, WS_EPOLL_CLIENT(clientId, client->generation)) != ESIF_OK) {
+						WebClient_Close(client);
+					}
+				}
+			}
+			// Process Active Client Requests, ignoring events for Clients closed earlier in this batch
+			else if (id < WS_MAX_CLIENTS && self->clients[id].generation == (u32)(token >> 32)) {
+				WebServer_ServiceClient(
+					self,
+					(int)id,
+					(events[j].events & (EPOLLIN | EPOLLHUP)) != 0,
+					(events[j].events & EPOLLOUT) != 0,
+					(events[j].events & EPOLLERR) != 0);
+				WebServer_UpdatePolling(self, (int)id);
+			}
+		}
+	}
+	return rc;
+}
+
+#else
+
+// Wait for Socket Activity using select() until Quit signaled
+static esif_error_t WebServer_WaitLoop(WebServerPtr self)
+{
+	esif_error_t rc = ESIF_OK;
+	struct timeval tv = { 0 };	// Timeout
+	fd_set readFDs = { 0 };		// Readable Sockets List
+	fd_set writeFDs = { 0 };	// Writable Sockets List
+	fd_set exceptFDs = { 0 };	// Exception Sockets List
+
+	int selectResult = 0;		// select() result
+	int maxfd = 0;				// Max file descriptor ID + 1
+	int setsize = 0;			// Number of items in FD List
+	int j = 0;
+
+	// Process all active sockets and accept new connections until Quit signaled
+	while (rc == ESIF_OK && atomic_read(&self->isActive)) {
+
+		// Reset File Descriptor Lists after each iteration
+		FD_ZERO(&readFDs);
+		FD_ZERO(&writeFDs);
+		FD_ZERO(&exceptFDs);
+		maxfd = 0;
+		setsize = 0;
+
+		// Add Doorbell Ringer
+		FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs);
+		FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &exceptFDs);
+		maxfd = (int)self->doorbell.sockets[DOORBELL_RINGER] + 1;
+		setsize++;
+
+		// Add Listener Socket(s)
+		for (j = 0; j < WS_MAX_LISTENERS && setsize < WS_MAX_SOCKETS; j++) {
+			if (self->listeners[j].socket != INVALID_SOCKET) {
+				FD_SET(self->listeners[j].socket, &readFDs);
+				FD_SET(self->listeners[j].socket, &exceptFDs);
+				maxfd = esif_ccb_max(maxfd, (int)self->listeners[j].socket + 1);
+				setsize++;
+			}
+		}
+
+		// Add Client Socket(s)
+		for (j = 0; j < WS_MAX_CLIENTS && setsize < WS_MAX_SOCKETS; j++) {
+			if (self->clients[j].socket != INVALID_SOCKET) {
+				FD_SET(self->clients[j].socket, &readFDs);
+				FD_SET(self->clients[j].socket, &exceptFDs);
+				maxfd = esif_ccb_max(maxfd, (int)self->clients[j].socket + 1);
+				setsize++;
+
+				// Wait for socket to become writable if pending send buffer
+				if (self->clients[j].sendBufLen > 0) {
+					FD_SET(self->clients[j].socket, &writeFDs);
+				}
+			}
+		}
+
+		// Use Timeout of N + 0.05 seconds where >= 2 (Since UI polls every second)
+		tv.tv_sec = WS_SOCKET_TIMEOUT;
+		tv.tv_usec = 50000;
+
+		//// WAIT FOR SOCKET ACTIVITY ////
+
+		selectResult = select(maxfd, &readFDs, &writeFDs, &exceptFDs, &tv);
+
+		// Exit loop if select error or server stopping; continue loop if inactivity timeout
+		if (selectResult == SOCKET_ERROR) {
+			WS_TRACE_ERROR("SELECT Error (%d)\n", selectResult);
+			rc = ESIF_E_WS_SOCKET_ERROR;
+			break;
+		}
+		else if (!atomic_read(&self->isActive)) { // Exit if Server not Active
+			break;
+		}
+		else if (selectResult == 0) { // Timeout
+			continue;
+		}
+
+		//// PROCESS ALL ACTIVE SOCKETS ////
+
+		// 1. Respond to Incoming Doorbell Socket signals
+		if (FD_ISSET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs)) {
+			if (WebServer_DoorbellSignaled(self) != ESIF_OK) {
+				break;
+			}
+		}
+
+		// 2. Accept any new connections on the Listener Socket(s)
+		for (j = 0; j < WS_MAX_LISTENERS && atomic_read(&self->isActive); j++) {
+			WebListenerPtr listener = &self->listeners[j];
+			if (listener->socket != INVALID_SOCKET && FD_ISSET(listener->socket, &readFDs)) {
+				WebServer_AcceptClient(self, listener);
+			}
+		}
+
+		// 3. Process Active Client Requests
+		for (j = 0; j < WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
+			WebClientPtr client = &self->clients[j];
+			if (client->socket != INVALID_SOCKET) {
+				WebServer_ServiceClient(
+					self,
+					j,
+					FD_ISSET(client->socket, &readFDs) != 0,
+					FD_ISSET(client->socket, &writeFDs) != 0,
+					FD_ISSET(client->socket, &exceptFDs) != 0);
+			}
+		}
+	}
+	return rc;
+}
+
+#endif
+
 // Web Server Main Module (One per Thread)
 static esif_error_t WebServer_Main(WebServerPtr self)
 {
 	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
 	if (self) {
-		struct timeval tv = { 0 };	// Timeout
-		fd_set readFDs = { 0 };		// Readable Sockets List
-		fd_set writeFDs = { 0 };	// Writable Sockets List
-		fd_set exceptFDs = { 0 };	// Exception Sockets List
-
-		int selectResult = 0;		// select() result
-		int maxfd = 0;				// Max file descriptor ID + 1
-		int setsize = 0;			// Number of items in FD List
 		int j = 0;
 
 		atomic_inc(&self->activeThreads);
@@ -533,159 +1174,23 @@ static esif_error_t WebServer_Main(WebServerPtr self)
 			}
 		}
 
-		//// MAIN LOOP ////
-		
-		// Process all active sockets and accept new connections until Quit signaled
-		while (rc == ESIF_OK && atomic_read(&self->isActive)) {
-
-			// Reset File Descriptor Lists after each iteration
-			FD_ZERO(&readFDs);
-			FD_ZERO(&writeFDs);
-			FD_ZERO(&exceptFDs);
-			maxfd = 0;
-			setsize = 0;
-
-			// Add Doorbell Ringer
-			FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs);
-			FD_SET(self->doorbell.sockets[DOORBELL_RINGER], &exceptFDs);
-			maxfd = (int)self->doorbell.sockets[DOORBELL_RINGER] + 1;
-			setsize++;
-
-			// Add Listener Socket(s)
-			for (j = 0; j < WS_MAX_LISTENERS && setsize < WS_MAX_SOCKETS; j++) {
-				if (self->listeners[j].socket != INVALID_SOCKET) {
-					FD_SET(self->listeners[j].socket, &readFDs);
-					FD_SET(self->listeners[j].socket, &exceptFDs);
-					maxfd = esif_ccb_max(maxfd, (int)self->listeners[j].socket + 1);
-					setsize++;
-				}
-			}
-
-			// Add Client Socket(s)
-			for (j = 0; j < WS_MAX_CLIENTS && setsize < WS_MAX_SOCKETS; j++) {
-				if (self->clients[j].socket != INVALID_SOCKET) {
-					FD_SET(self->clients[j].socket, &readFDs);
-					FD_SET(self->clients[j].socket, &exceptFDs);
-					maxfd = esif_ccb_max(maxfd, (int)self->clients[j].socket + 1);
-					setsize++;
-
-					// Wait for socket to become writable if pending send buffer
-					if (self->clients[j].sendBuf) {
-						FD_SET(self->clients[j].socket, &writeFDs);
-					}
-				}
-			}
-
-			// Use Timeout of N + 0.05 seconds where >= 2 (Since UI polls every second)
-			tv.tv_sec = WS_SOCKET_TIMEOUT;
-			tv.tv_usec = 50000;
-
-			//// WAIT FOR SOCKET ACTIVITY ////
-
-			selectResult = select(maxfd, &readFDs, &writeFDs, &exceptFDs, &tv);
-
-			// Exit loop if select error or server stopping; continue loop if inactivity timeout
-			if (selectResult == SOCKET_ERROR) {
-				WS_TRACE_ERROR("SELECT Error (%d)\n", selectResult);
-				rc = ESIF_E_WS_SOCKET_ERROR;
-				break;
-			}
-			else if (!atomic_read(&self->isActive)) { // Exit if Server not Active
-				break;
-			}
-			else if (selectResult == 0) { // Timeout
-				continue;
-			}
-
-			//// PROCESS ALL ACTIVE SOCKETS ////
-
-			// 1. Respond to Incoming Doorbell Socket signals
-			if (FD_ISSET(self->doorbell.sockets[DOORBELL_RINGER], &readFDs)) {
-				u8 opcode = WS_OPCODE_NOOP;
-
-				// Exit if Doorbell socket(s) shutdown or a QUIT opcode received
-				if (TcpDoorbell_Receive(&self->doorbell, &opcode) != ESIF_OK) {
-					WS_TRACE_DEBUG("Doorbell Closed; Exiting");
-					break;
-				}
-				WS_TRACE_DEBUG("Doorbell Received: 0x%02X", ((int)opcode & 0xFF));
-				if (opcode == WS_OPCODE_QUIT) {
-					break;
+		// Start REST Workers; REST API Requests are executed by the Server Thread if none are available
+		if (rc == ESIF_OK) {
+			self->completedJobs = esif_link_list_create();
+			for (j = 0; self->completedJobs && j < WS_REST_WORKERS; j++) {
+				if (WebRestWorker_Start(&self->restWorkers[j]) != ESIF_OK) {
+					WS_TRACE_WARNING("Unable to start REST Worker[%d]\n", j);
 				}
-			}
-
-			// 2. Accept any new connections on the Listener Socket(s)
-			int sockets = setsize;
-			for (j = 0; j < WS_MAX_LISTENERS && atomic_read(&self->isActive); j++) {
-				WebListenerPtr listener = &self->listeners[j];
-				if (listener->socket != INVALID_SOCKET && FD_ISSET(listener->socket, &readFDs)) {
-					esif_ccb_socket_t clientSocket = INVALID_SOCKET;
-					WebClientPtr client = NULL;
-					int k = 0;
-
-					// Find first Unused Client
-					for (k = 0; k < WS_MAX_CLIENTS && sockets < WS_MAX_SOCKETS; k++) {
-						if (self->clients[k].type == ClientClosed) {
-							client = &self->clients[k];
-							break;
-						}
-					}
-
-					// Accept Incoming Connection
-					char *clientIpAddr = NULL;
-					if ((rc = WebListener_AcceptClient(listener, &clientSocket, &clientIpAddr)) != ESIF_OK) {
-						WS_TRACE_DEBUG("Listener[%d] Socket[%d]: Accept Error: %s (%d)\n", j, listener->socket, esif_rc_str(rc), rc);
-					}
-					else {
-						// Close Client if Max Connections exceeded
-						if (client == NULL) {
-							WS_TRACE_WARNING("Connection Limit Exceeded (%d)\n", WS_MAX_CLIENTS);
-							esif_ccb_socket_close(clientSocket);
-							clientSocket = INVALID_SOCKET;
-							continue;
-						}
-
-						// Client is now an HTTP Connection
-						client->type = ClientHttp;
-						client->socket = clientSocket;
-						client->ipAddr = esif_ccb_strdup(clientIpAddr ? clientIpAddr : "NA");
-						clientSocket = INVALID_SOCKET;
-						sockets++;	
-						WS_TRACE_DEBUG("Accepted Client[%d]: Socket[%d]\n", k, (int)client->socket);
-					}
+				else {
+					self->restWorkerCount++;
 				}
 			}
+		}
 
-			// 3. Process Active Client Requests
-			for (j = 0; j < WS_MAX_CLIENTS && atomic_read(&self->isActive); j++) {
-				WebClientPtr client = &self->clients[j];
-				if (client->socket != INVALID_SOCKET) {
-
-					// Close sockets with Exceptions
-					if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &exceptFDs)) {
-						WebClient_Close(client);
-						WS_TRACE_DEBUG("Closing Client[%d]: (Exception) Socket[%d]\n", j, (int)client->socket);
-						continue;
-					}
-
-					// Receive and Process Requests from Readable Clients
-					if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &readFDs)) {
-						if ((rc = WebServer_ProcessRequest(self, client)) != ESIF_OK) {
-							WebClient_Close(client);
-							WS_TRACE_DEBUG("Client[%d] Disconnected: %s (%d)\n", j, esif_rc_str(rc), (int)rc);
-						}
-					}
+		//// MAIN LOOP ////
 
-					// Flush pending Send Buffer when socket becomes writable
-					if (client->socket != INVALID_SOCKET && FD_ISSET(client->socket, &writeFDs)) {
-						size_t sendBufLen = client->sendBufLen;
-						UNREFERENCED_PARAMETER(sendBufLen);
-						rc = WebClient_Write(client, NULL, 0);
-						WS_TRACE_DEBUG("WS SEND Unbuffering (%d): before=%zd after=%zd\n", (int)client->socket, sendBufLen, client->sendBufLen);
-					}
-				}
-			}
-			rc = ESIF_OK;
+		if (rc == ESIF_OK) {
+			rc = WebServer_WaitLoop(self);
 		}
 
 		// Cleanup
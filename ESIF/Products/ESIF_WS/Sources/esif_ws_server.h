@@ -22,6 +22,12 @@
 #include "esif_ccb_lock.h"
 #include "esif_ccb_socket.h"
 #include "esif_ccb_thread.h"
+#include "esif_link_list.h"
+
+// Use epoll() instead of select() to wait for socket activity, so the client limit is not bound by FD_SETSIZE
+#ifdef ESIF_ATTR_OS_LINUX
+# define WS_USE_EPOLL
+#endif
 
 // Client Types
 typedef enum ClientType_e {
@@ -70,8 +76,14 @@ typedef struct WebClient_s {
 	ClientType			type;			// Client Type (Closed, Http, Websocket)
 	esif_ccb_socket_t	socket;			// Client Socket Handle or INVALID_SOCKET
 	char				*ipAddr;		// Client IP Address
+	u32					generation;		// Connection Generation, incremented when closed
 	u8					*sendBuf;		// TCP/IP Send Buffer
-	size_t				sendBufLen;		// TCP/IP Send Buffer Length
+	size_t				sendBufLen;		// TCP/IP Send Buffer Length (Unsent Bytes)
+	size_t				sendBufPos;		// TCP/IP Send Buffer Offset of Unsent Bytes
+	size_t				sendBufSize;	// TCP/IP Send Buffer Allocated Size
+#ifdef WS_USE_EPOLL
+	Bool				isPollingOut;	// Waiting for socket to become writable
+#endif
 	u8					*recvBuf;		// TCP/IP Receive Buffer (Partial HTTP Request or Websocket Frame)
 	size_t				recvBufLen;		// TCP/IP Receive Buffer Length
 	
@@ -85,10 +97,14 @@ typedef struct WebClient_s {
 } WebClient, *WebClientPtr;
 
 #define WS_MAX_LISTENERS	1	// Number of Web Server Listener Sockets
+#ifdef WS_USE_EPOLL
+#define WS_MAX_CLIENTS		64	// 32 simultaneous UI websocket clients
+#else
 #define WS_MAX_CLIENTS		10	// 5 simultaneous UI websocket clients
+#endif
 
 // Max Active Sockets (per WebServer) cannot exceed FD_SETSIZE (Default: Windows=64, Linux=1024)
-#if ((WS_MAX_LISTENERS + WS_MAX_CLIENTS + 1) > FD_SETSIZE)
+#if !defined(WS_USE_EPOLL) && ((WS_MAX_LISTENERS + WS_MAX_CLIENTS + 1) > FD_SETSIZE)
 # undef  WS_MAX_CLIENTS
 # define WS_MAX_CLIENTS	(FD_SETSIZE - WS_MAX_LISTENERS - 1)
 #endif
@@ -101,6 +117,40 @@ typedef struct WebClient_s {
 
 #define CRLF	"\r\n"
 
+#define WS_REST_WORKERS		4	// REST API Worker Threads, each with its own Shell Execution Context
+
+// REST API Request queued to a REST Worker
+typedef struct WebRestJob_s {
+	int					clientId;		// Index of Web Client that sent the Request
+	u32					generation;		// Web Client Generation when the Request was received
+	char				*ipAddr;		// Client IP Address
+	char				*request;		// REST API Request ("msgid:command")
+	size_t				request_len;	// REST API Request Length
+	char				*response;		// REST API Response or NULL
+	size_t				response_len;	// REST API Response Length
+	esif_error_t		rc;				// REST API Result
+} WebRestJob, *WebRestJobPtr;
+
+// REST API Worker Thread. Any idle Worker executes the Requests of the next Client that has Requests queued.
+typedef struct WebRestWorker_s {
+	struct WebServer_s	*server;		// Owning Web Server
+	esif_thread_t		thread;			// Worker Thread
+	Bool				threadStarted;	// Worker Thread Started?
+	atomic_t			isActive;		// Worker Active Flag
+	void				*shellCtx;		// Shell Execution Context or NULL to use the Global Shell
+
+	u64					requests;		// Requests Executed
+	u64					totalUsec;		// Total Execution Time (usec)
+	u64					maxUsec;		// Max Execution Time (usec)
+} WebRestWorker, *WebRestWorkerPtr;
+
+// REST API Requests queued for one Client. Only the Worker that claims the Client executes them, so its Responses stay in order.
+typedef struct WebRestQueue_s {
+	EsifLinkListPtr		jobs;			// Queued REST API Requests or NULL
+	Bool				isClaimed;		// A Worker is executing a Request for this Client
+	Bool				isReady;		// Client is listed in the Server's Ready Clients
+} WebRestQueue, *WebRestQueuePtr;
+
 // Web Server Object (One per Worker Thread)
 typedef struct WebServer_s {
 	esif_ccb_lock_t		lock;						// Thread Lock
@@ -115,6 +165,20 @@ typedef struct WebServer_s {
 
 	u8					*netBuf;					// Network Send/Receive Buffer
 	size_t				netBufLen;					// Network Send/Receive Buffer Length
+
+	WebRestWorker		restWorkers[WS_REST_WORKERS];// REST API Worker Threads
+	int					restWorkerCount;			// Started REST API Worker Threads
+	esif_ccb_lock_t		restLock;					// REST API Request Queue Lock
+	esif_ccb_sem_t		restSignal;					// Signaled once for each queued REST API Request
+	WebRestQueue		restQueues[WS_MAX_CLIENTS];	// Queued REST API Requests for each Client
+	int					restReady[WS_MAX_CLIENTS];	// Unclaimed Clients with queued Requests, in arrival order
+	int					restReadyHead;				// First Ready Client
+	int					restReadyCount;				// Number of Ready Clients
+	esif_ccb_lock_t		completedLock;				// Completed REST API Request Lock
+	EsifLinkListPtr		completedJobs;				// Completed REST API Requests waiting to be sent
+#ifdef WS_USE_EPOLL
+	int					epollFd;					// epoll instance or -1
+#endif
 } WebServer, *WebServerPtr;
 
 extern WebServerPtr g_WebServer;
@@ -127,6 +191,7 @@ esif_error_t WebServer_Start(WebServerPtr self);
 void WebServer_Stop(WebServerPtr self);
 Bool WebServer_IsStarted(WebServerPtr self);
 esif_error_t WebServer_Config(WebServerPtr self, u8 instance, char *ipAddr, short port, esif_flags_t flags);
+esif_error_t WebServer_QueueRestCmd(WebServerPtr self, WebClientPtr client, char *request, size_t request_len);
 
 esif_error_t WebClient_Write(WebClientPtr self, void *buffer, size_t buf_len);
 void WebClient_Close(WebClientPtr self);
@@ -160,6 +225,9 @@ void EsifWsUnlock(void);
 const char *EsifWsDocRoot(void);
 Bool EsifWsShellEnabled(void);
 char *EsifWsShellExec(char *cmd, size_t cmd_len, char *prefix, size_t prefix_len);
+void *EsifWsShellCtxCreate(void);
+void EsifWsShellCtxDestroy(void *ctx);
+char *EsifWsShellCtxExec(void *ctx, char *cmd, size_t cmd_len, char *prefix, size_t prefix_len);
 int EsifWsTraceLevel(void);
 int EsifWsTraceMessageEx(int level, const char *func, const char *file, int line, const char *msg, ...);
 int EsifWsConsoleMessageEx(const char *msg, ...);
@@ -308,10 +308,12 @@ static esif_error_t WebSocket_BuildFrame(
 	return rc;
 }
 
-// Execute a request against the REST API
+// Execute a request against the REST API using the given Shell Execution Context (NULL = Global Shell)
+// This may be called from a REST Worker Thread, so it must not access any Web Client state
 esif_error_t WebServer_WebSocketExecRestCmd(
 	WebServerPtr self,
-	WebClientPtr client,
+	void *shellCtx,
+	const char *clientIpAddr,
 	char *request,
 	size_t request_len,
 	char **response_ptr,
@@ -319,8 +321,7 @@ esif_error_t WebServer_WebSocketExecRestCmd(
 {
 	int rc = ESIF_E_PARAMETER_IS_NULL;
 
-	UNREFERENCED_PARAMETER(client);
-	if (request && response_ptr && response_len_ptr) {
+	if (self && request && response_ptr && response_len_ptr) {
 		UInt32 msg_id = (UInt32)atoi(request);
 		char *shell_cmd = esif_ccb_strchr(request, ':');
 		char response_buf[MAX_WEBSOCKET_MSGID_LEN + DEF_WEBSOCKET_RESPONSE_LEN] = { 0 };
@@ -429,7 +430,7 @@ esif_error_t WebServer_WebSocketExecRestCmd(
 			// Execute Shell Command against REST API
 			if (shell_cmd) {
 				if (atomic_read(&self->isActive)) {
-					response = EsifWsShellExec(shell_cmd, shell_cmd_len + 1, response_buf, esif_ccb_strlen(response_buf, sizeof(response_buf)));
+					response = EsifWsShellCtxExec(shellCtx, shell_cmd, shell_cmd_len + 1, response_buf, esif_ccb_strlen(response_buf, sizeof(response_buf)));
 					if (response) {
 						// Strip Non-ASCII characters from REST API results
 						unsigned char *source = (unsigned char *)response;
@@ -471,7 +472,7 @@ esif_error_t WebServer_WebSocketExecRestCmd(
 				if (error_code[0]) {
 					size_t maxcmd = 80;
 					WS_TRACE_ERROR("REST API Error [IP=%s] (%s): [%.*s%s]\n",
-						client->ipAddr,
+						(clientIpAddr ? clientIpAddr : "NA"),
 						error_code,
 						(int)maxcmd,
 						rest_cmd,
@@ -495,6 +496,47 @@ esif_error_t WebServer_WebSocketExecRestCmd(
 	return rc;
 }
 
+// Send a Text Message to a Websocket Client, breaking up large Messages into Multiple Fragments
+esif_error_t WebServer_WebsocketSendText(
+	WebServerPtr self,
+	WebClientPtr client,
+	const char *message,
+	size_t message_len)
+{
+	esif_error_t rc = ESIF_E_PARAMETER_IS_NULL;
+	if (self && client && message) {
+		WsFrame outFrame = { 0 };
+		size_t bytes_sent = 0;
+		rc = ESIF_OK;
+
+		while (rc == ESIF_OK && bytes_sent < message_len) {
+			size_t header_size = WebSocket_HeaderSize(message_len - bytes_sent, ESIF_FALSE);
+			size_t max_payload = (self->netBufLen <= header_size ? 0 : self->netBufLen - header_size);
+			size_t fragment_size = esif_ccb_min(message_len - bytes_sent, max_payload);
+			FrameType frame_type = (bytes_sent > 0 ? FRAME_CONTINUATION : FRAME_TEXT);
+			FinType fin_type = (fragment_size < message_len - bytes_sent ? FIN_FRAGMENT : FIN_FINAL);
+
+			if (fragment_size < 1) {
+				rc = ESIF_E_NEED_LARGER_BUFFER;
+			}
+			else {
+				rc = WebSocket_BuildFrame(
+					&outFrame,
+					self->netBuf, self->netBufLen,
+					(void *)(message + bytes_sent), fragment_size,
+					frame_type,
+					fin_type);
+			}
+
+			if (rc == ESIF_OK) {
+				rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
+			}
+			bytes_sent += fragment_size;
+		}
+	}
+	return rc;
+}
+
 // Process a Websocket Request and send a Response
 esif_error_t WebServer_WebsocketResponse(
 	WebServerPtr self,
@@ -541,43 +583,24 @@ esif_error_t WebServer_WebsocketResponse(
 				total_message[total_message_len] = 0;
 			}
 
-			// Execute Command against REST API
-			rc = WebServer_WebSocketExecRestCmd(
-				self,
-				client,
-				total_message,
-				total_message_len,
-				&response,
-				&response_len);
-
-			// Send REST API Response
-			if (rc == ESIF_OK) {
-				size_t bytes_sent = 0;
-
-				// Break up large Websocket Messages into Multiple Fragments
-				while (rc == ESIF_OK && bytes_sent < response_len) {
-					size_t header_size = WebSocket_HeaderSize(response_len - bytes_sent, ESIF_FALSE);
-					size_t max_payload = (self->netBufLen <= header_size ? 0 : self->netBufLen - header_size);
-					size_t fragment_size = esif_ccb_min(response_len - bytes_sent, max_payload);
-					FrameType frame_type = (bytes_sent > 0 ? FRAME_CONTINUATION : FRAME_TEXT);
-					FinType fin_type = (fragment_size < response_len - bytes_sent ? FIN_FRAGMENT : FIN_FINAL);
-
-					if (fragment_size < 1) {
-						rc = ESIF_E_NEED_LARGER_BUFFER;
-					}
-					else {
-						rc = WebSocket_BuildFrame(
-							&outFrame,
-							self->netBuf, self->netBufLen,
-							response + bytes_sent, fragment_size,
-							frame_type,
-							fin_type);
-					}
+			// Queue Command to a REST Worker, which owns the message if successful. The Response is sent when it completes.
+			if (total_message && WebServer_QueueRestCmd(self, client, total_message, total_message_len) == ESIF_OK) {
+				total_message = NULL;
+				rc = ESIF_OK;
+			}
+			// Otherwise Execute Command against REST API and Send REST API Response
+			else {
+				rc = WebServer_WebSocketExecRestCmd(
+					self,
+					NULL,
+					client->ipAddr,
+					total_message,
+					total_message_len,
+					&response,
+					&response_len);
 
-					if (rc == ESIF_OK) {
-						rc = WebClient_Write(client, self->netBuf, outFrame.frameSize);
-					}
-					bytes_sent += fragment_size;
+				if (rc == ESIF_OK) {
+					rc = WebServer_WebsocketSendText(self, client, response, response_len);
 				}
 			}
 			esif_ccb_free(total_message);
@@ -22,3 +22,5 @@
 
 // WebSocket Server Public Interface
 esif_error_t WebServer_WebsocketRequest(WebServerPtr self, WebClientPtr client, u8 *buffer, size_t buf_len);
+esif_error_t WebServer_WebsocketSendText(WebServerPtr self, WebClientPtr client, const char *message, size_t message_len);
+esif_error_t WebServer_WebSocketExecRestCmd(WebServerPtr self, void *shellCtx, const char *clientIpAddr, char *request, size_t request_len, char **response_ptr, size_t *response_len_ptr);